@@ -25,7 +25,11 @@
 struct AppConfig {
     DataSourceType dataSourceType = DataSourceType::SQL; ///< Loại nguồn dữ liệu (MOCK, CSV, SQL)
     std::map<EntityType, std::filesystem::path> csvFilePaths; ///< Ánh xạ từ loại thực thể đến đường dẫn file CSV
+    std::filesystem::path csvDataDirectory = "data"; ///< Thư mục chứa các file CSV không được khai báo riêng trong csvFilePaths
+    std::size_t csvCompactionThreshold = 1000; ///< Số thay đổi trong journal trước khi file CSV được ghi lại (compaction)
     std::string sqlConnectionString; ///< Chuỗi kết nối SQL
+    std::string sqlArchivePath; ///< File cơ sở dữ liệu lưu trữ được ATTACH vào kết nối SQL (rỗng: không dùng)
+    std::string sqlShardDirectory; ///< Thư mục chứa các file shard theo khoa của nguồn SQL (rỗng: không phân vùng)
 
     Logger::Level logLevel = Logger::Level::INFO; ///< Cấp độ ghi log (mặc định là INFO)
     std::filesystem::path logFilePath = "logs/app.log"; ///< Đường dẫn đến file log
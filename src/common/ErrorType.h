@@ -57,6 +57,7 @@ namespace ErrorCode {
     constexpr int STUDENT_ALREADY_ENROLLED = 1204;
     constexpr int FEE_PAYMENT_REQUIRED = 1205;
     constexpr int GRADING_PERIOD_CLOSED = 1206;
+    constexpr int COURSE_SCHEDULE_CONFLICT = 1207;
 
     // Lỗi liên quan đến file
     constexpr int FILE_NOT_FOUND = 1301;
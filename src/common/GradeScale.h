@@ -0,0 +1,82 @@
+#ifndef GRADESCALE_H
+#define GRADESCALE_H
+
+/**
+ * @namespace GradeScale
+ * @brief Không gian tên chứa thang điểm chữ và điểm hệ 4 dùng chung
+ *
+ * Các ngưỡng điểm được khai báo tại một chỗ để CourseResult (tính từng bản ghi)
+ * và các kernel xử lý hàng loạt (MarksColumn) luôn cho cùng một kết quả.
+ */
+namespace GradeScale {
+    constexpr int UNGRADED_MARKS = -1; ///< Giá trị điểm biểu thị "chưa có điểm"
+    constexpr int MIN_MARKS = 0;       ///< Điểm hợp lệ nhỏ nhất
+    constexpr int MAX_MARKS = 100;     ///< Điểm hợp lệ lớn nhất
+
+    constexpr int D_MIN_MARKS = 40; ///< 40-54 là D (cũng là điểm qua môn)
+    constexpr int C_MIN_MARKS = 55; ///< 55-69 là C
+    constexpr int B_MIN_MARKS = 70; ///< 70-84 là B
+    constexpr int A_MIN_MARKS = 85; ///< 85-100 là A
+
+    constexpr int PASS_MARKS = D_MIN_MARKS; ///< Điểm tối thiểu để qua môn
+
+    /**
+     * @brief Chuyển điểm số sang điểm chữ
+     * @param marks Điểm số (-1 là chưa có điểm)
+     * @return Điểm chữ (A, B, C, D, F, - nếu chưa có điểm, ? nếu ngoài thang điểm)
+     */
+    constexpr char gradeFromMarks(int marks) {
+        if (marks < MIN_MARKS) return '-';
+        if (marks < D_MIN_MARKS) return 'F';
+        if (marks < C_MIN_MARKS) return 'D';
+        if (marks < B_MIN_MARKS) return 'C';
+        if (marks < A_MIN_MARKS) return 'B';
+        if (marks <= MAX_MARKS) return 'A';
+        return '?';
+    }
+
+    /**
+     * @brief Chuyển điểm chữ sang điểm hệ 4 (A=4, B=3, C=2, D=1, F=0)
+     * @param grade Điểm chữ
+     * @return Điểm hệ 4, hoặc -1 nếu điểm chữ không hợp lệ / chưa có điểm
+     */
+    constexpr int gradePointFromGrade(char grade) {
+        switch (grade) {
+            case 'A': return 4;
+            case 'B': return 3;
+            case 'C': return 2;
+            case 'D': return 1;
+            case 'F': return 0;
+            default: return -1;
+        }
+    }
+
+    /**
+     * @brief Chuyển điểm số trực tiếp sang điểm hệ 4
+     * @param marks Điểm số (-1 là chưa có điểm)
+     * @return Điểm hệ 4, hoặc -1 nếu chưa có điểm
+     */
+    constexpr int gradePointFromMarks(int marks) {
+        return gradePointFromGrade(gradeFromMarks(marks));
+    }
+
+    constexpr int MAX_GRADE_POINT = 4; ///< Điểm hệ 4 cao nhất (A)
+
+    /**
+     * @brief Điểm số nhỏ nhất để đạt một mức điểm hệ 4
+     * @param gradePoint Điểm hệ 4 (0-4)
+     * @return Điểm số tối thiểu, hoặc -1 nếu gradePoint ngoài thang điểm
+     */
+    constexpr int minMarksForGradePoint(int gradePoint) {
+        switch (gradePoint) {
+            case 4: return A_MIN_MARKS;
+            case 3: return B_MIN_MARKS;
+            case 2: return C_MIN_MARKS;
+            case 1: return D_MIN_MARKS;
+            case 0: return MIN_MARKS;
+            default: return -1;
+        }
+    }
+}
+
+#endif // GRADESCALE_H
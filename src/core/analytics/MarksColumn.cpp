@@ -0,0 +1,494 @@
+#include "MarksColumn.h"
+#include <algorithm>
+#include <cmath>
+
+// Chỉ bật các kernel SIMD khi trình biên dịch hỗ trợ target attribute (GCC/Clang, kể cả MinGW)
+// để binary vẫn chạy được trên CPU cũ: bộ lệnh được chọn khi chạy, không phải khi build.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MARKS_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+// --- Các struct kết quả ---
+
+double WeightedGradePoints::average() const {
+    if (gradedCredits <= 0) return 0.0;
+    return static_cast<double>(weightedPoints) / static_cast<double>(gradedCredits);
+}
+
+std::size_t GradeHistogram::countFor(char grade) const {
+    if (grade == '-') return buckets[UNGRADED_BUCKET];
+    int point = GradeScale::gradePointFromGrade(grade);
+    if (point < 0) return 0;
+    return buckets[static_cast<std::size_t>(point)];
+}
+
+std::size_t GradeHistogram::total() const {
+    std::size_t sum = 0;
+    for (std::size_t count : buckets) sum += count;
+    return sum;
+}
+
+MarksAffine MarksAffine::fromReal(double scale, double offset, int ceiling) {
+    constexpr double unit = static_cast<double>(1 << FRACTION_BITS);
+    MarksAffine transform;
+    transform.scale = static_cast<std::int32_t>(std::lround(std::clamp(scale, -MAX_SCALE, MAX_SCALE) * unit));
+    transform.offset = static_cast<std::int32_t>(std::lround(std::clamp(offset, -MAX_OFFSET, MAX_OFFSET) * unit));
+    transform.ceiling = static_cast<std::int16_t>(std::clamp(ceiling, GradeScale::MIN_MARKS, GradeScale::MAX_MARKS));
+    return transform;
+}
+
+int MarksAffine::apply(int marks) const {
+    if (marks < GradeScale::MIN_MARKS) return marks;
+    // Cộng nửa đơn vị rồi dịch phải số học: làm tròn nửa lên, giống hệt các bản SIMD
+    std::int32_t value = (marks * scale + offset + (1 << (FRACTION_BITS - 1))) >> FRACTION_BITS;
+    return std::clamp<std::int32_t>(value, GradeScale::MIN_MARKS, ceiling);
+}
+
+namespace {
+    // Số điểm hệ 4 = số ngưỡng (D, C, B, A) mà điểm vượt qua. Cách viết không rẽ nhánh này
+    // trùng với GradeScale::gradePointFromMarks trên miền [0, 100] và là cơ sở cho các bản SIMD.
+    inline int scalarGradePoint(int marks) {
+        if (marks < GradeScale::MIN_MARKS) return -1;
+        return (marks >= GradeScale::D_MIN_MARKS) + (marks >= GradeScale::C_MIN_MARKS) +
+               (marks >= GradeScale::B_MIN_MARKS) + (marks >= GradeScale::A_MIN_MARKS);
+    }
+
+    void scalarGradePoints(const std::int16_t* marks, std::size_t count, std::int8_t* outPoints) {
+        for (std::size_t i = 0; i < count; ++i) {
+            outPoints[i] = static_cast<std::int8_t>(scalarGradePoint(marks[i]));
+        }
+    }
+
+    WeightedGradePoints scalarWeighted(const std::int16_t* marks, const std::uint8_t* credits, std::size_t count) {
+        WeightedGradePoints result;
+        for (std::size_t i = 0; i < count; ++i) {
+            int point = scalarGradePoint(marks[i]);
+            if (point < 0) continue;
+            result.weightedPoints += static_cast<long long>(point) * credits[i];
+            result.gradedCredits += credits[i];
+        }
+        return result;
+    }
+
+    GradeHistogram scalarHistogram(const std::int16_t* marks, std::size_t count) {
+        GradeHistogram histogram;
+        for (std::size_t i = 0; i < count; ++i) {
+            int point = scalarGradePoint(marks[i]);
+            histogram.buckets[point < 0 ? GradeHistogram::UNGRADED_BUCKET : static_cast<std::size_t>(point)]++;
+        }
+        return histogram;
+    }
+
+    PassFailCounts scalarPassFail(const std::int16_t* marks, std::size_t count) {
+        PassFailCounts counts;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (marks[i] < GradeScale::MIN_MARKS) counts.ungraded++;
+            else if (marks[i] >= GradeScale::PASS_MARKS) counts.passed++;
+            else counts.failed++;
+        }
+        return counts;
+    }
+
+    void scalarAffine(const std::int16_t* marks, std::size_t count, std::int16_t* outMarks, const MarksAffine& transform) {
+        for (std::size_t i = 0; i < count; ++i) {
+            outMarks[i] = static_cast<std::int16_t>(transform.apply(marks[i]));
+        }
+    }
+
+#ifdef MARKS_KERNELS_X86
+    // Số phần tử tối đa xử lý trước khi cộng dồn bộ đếm 32-bit sang 64-bit (tránh tràn số).
+    constexpr std::size_t ACCUMULATOR_FLUSH_ELEMENTS = std::size_t{1} << 20;
+
+    // ---------- AVX2: 16 điểm int16 mỗi vòng ----------
+
+    __attribute__((target("avx2")))
+    inline __m256i avx2GradePoints(__m256i m, __m256i& ungradedMask) {
+        const __m256i zero = _mm256_setzero_si256();
+        // cmpgt trả về -1 ở các lane thỏa mãn, trừ đi tức là cộng 1 cho mỗi ngưỡng vượt qua
+        __m256i points = _mm256_sub_epi16(zero, _mm256_cmpgt_epi16(m, _mm256_set1_epi16(GradeScale::D_MIN_MARKS - 1)));
+        points = _mm256_sub_epi16(points, _mm256_cmpgt_epi16(m, _mm256_set1_epi16(GradeScale::C_MIN_MARKS - 1)));
+        points = _mm256_sub_epi16(points, _mm256_cmpgt_epi16(m, _mm256_set1_epi16(GradeScale::B_MIN_MARKS - 1)));
+        points = _mm256_sub_epi16(points, _mm256_cmpgt_epi16(m, _mm256_set1_epi16(GradeScale::A_MIN_MARKS - 1)));
+        ungradedMask = _mm256_cmpgt_epi16(zero, m);
+        return points;
+    }
+
+    __attribute__((target("avx2")))
+    inline std::size_t avx2CountLanes(__m256i mask16) {
+        // Mỗi lane 16-bit đóng góp 2 bit vào movemask
+        return static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(mask16)))) / 2;
+    }
+
+    __attribute__((target("avx2")))
+    void avx2GradePointsKernel(const std::int16_t* marks, std::size_t count, std::int8_t* outPoints) {
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m256i ungraded;
+            __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(marks + i));
+            __m256i points = avx2GradePoints(m, ungraded);
+            points = _mm256_or_si256(points, ungraded); // Lane chưa có điểm thành -1
+            __m128i packed = _mm_packs_epi16(_mm256_castsi256_si128(points), _mm256_extracti128_si256(points, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(outPoints + i), packed);
+        }
+        scalarGradePoints(marks + i, count - i, outPoints + i);
+    }
+
+    __attribute__((target("avx2")))
+    WeightedGradePoints avx2WeightedKernel(const std::int16_t* marks, const std::uint8_t* credits, std::size_t count) {
+        WeightedGradePoints result;
+        const __m256i ones = _mm256_set1_epi16(1);
+        std::size_t i = 0;
+        while (i + 16 <= count) {
+            __m256i pointAcc = _mm256_setzero_si256();
+            __m256i creditAcc = _mm256_setzero_si256();
+            std::size_t blockEnd = (count - i > ACCUMULATOR_FLUSH_ELEMENTS) ? i + ACCUMULATOR_FLUSH_ELEMENTS : count;
+            for (; i + 16 <= blockEnd; i += 16) {
+                __m256i ungraded;
+                __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(marks + i));
+                __m256i points = avx2GradePoints(m, ungraded);
+                __m256i c = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(credits + i)));
+                c = _mm256_andnot_si256(ungraded, c); // Môn chưa có điểm không tính tín chỉ
+                pointAcc = _mm256_add_epi32(pointAcc, _mm256_madd_epi16(points, c));
+                creditAcc = _mm256_add_epi32(creditAcc, _mm256_madd_epi16(c, ones));
+            }
+            alignas(32) std::int32_t pointLanes[8];
+            alignas(32) std::int32_t creditLanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(pointLanes), pointAcc);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(creditLanes), creditAcc);
+            for (int lane = 0; lane < 8; ++lane) {
+                result.weightedPoints += pointLanes[lane];
+                result.gradedCredits += creditLanes[lane];
+            }
+        }
+        WeightedGradePoints tail = scalarWeighted(marks + i, credits + i, count - i);
+        result.weightedPoints += tail.weightedPoints;
+        result.gradedCredits += tail.gradedCredits;
+        return result;
+    }
+
+    __attribute__((target("avx2")))
+    GradeHistogram avx2HistogramKernel(const std::int16_t* marks, std::size_t count) {
+        GradeHistogram histogram;
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m256i ungraded;
+            __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(marks + i));
+            __m256i points = avx2GradePoints(m, ungraded);
+            __m256i graded = _mm256_xor_si256(ungraded, _mm256_set1_epi16(-1));
+            for (int point = 0; point <= 4; ++point) {
+                __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi16(points, _mm256_set1_epi16(static_cast<short>(point))), graded);
+                histogram.buckets[static_cast<std::size_t>(point)] += avx2CountLanes(eq);
+            }
+            histogram.buckets[GradeHistogram::UNGRADED_BUCKET] += avx2CountLanes(ungraded);
+        }
+        GradeHistogram tail = scalarHistogram(marks + i, count - i);
+        for (std::size_t b = 0; b < histogram.buckets.size(); ++b) histogram.buckets[b] += tail.buckets[b];
+        return histogram;
+    }
+
+    __attribute__((target("avx2")))
+    PassFailCounts avx2PassFailKernel(const std::int16_t* marks, std::size_t count) {
+        PassFailCounts counts;
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i passThreshold = _mm256_set1_epi16(GradeScale::PASS_MARKS - 1);
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(marks + i));
+            counts.passed += avx2CountLanes(_mm256_cmpgt_epi16(m, passThreshold));
+            counts.ungraded += avx2CountLanes(_mm256_cmpgt_epi16(zero, m));
+        }
+        counts.failed = i - counts.passed - counts.ungraded;
+        PassFailCounts tail = scalarPassFail(marks + i, count - i);
+        counts.passed += tail.passed;
+        counts.failed += tail.failed;
+        counts.ungraded += tail.ungraded;
+        return counts;
+    }
+
+    __attribute__((target("avx2")))
+    void avx2AffineKernel(const std::int16_t* marks, std::size_t count, std::int16_t* outMarks, const MarksAffine& transform) {
+        const __m256i scale = _mm256_set1_epi32(transform.scale);
+        const __m256i bias = _mm256_set1_epi32(transform.offset + (1 << (MarksAffine::FRACTION_BITS - 1)));
+        const __m256i floor = _mm256_setzero_si256();
+        const __m256i ceiling = _mm256_set1_epi16(transform.ceiling);
+        std::size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(marks + i));
+            // Nhân trên int32 để không tràn, rồi gộp lại int16 (packs bão hòa, nên clamp sau vẫn đúng)
+            __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(m));
+            __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(m, 1));
+            lo = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(lo, scale), bias), MarksAffine::FRACTION_BITS);
+            hi = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(hi, scale), bias), MarksAffine::FRACTION_BITS);
+            // packs làm việc theo từng nửa 128 bit; permute đưa các lane về đúng thứ tự
+            __m256i curved = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+            curved = _mm256_min_epi16(_mm256_max_epi16(curved, floor), ceiling);
+            __m256i ungraded = _mm256_cmpgt_epi16(floor, m);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(outMarks + i), _mm256_blendv_epi8(curved, m, ungraded));
+        }
+        scalarAffine(marks + i, count - i, outMarks + i, transform);
+    }
+
+    // ---------- SSE4.1: 8 điểm int16 mỗi vòng ----------
+
+    __attribute__((target("sse4.1")))
+    inline __m128i sseGradePoints(__m128i m, __m128i& ungradedMask) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i points = _mm_sub_epi16(zero, _mm_cmpgt_epi16(m, _mm_set1_epi16(GradeScale::D_MIN_MARKS - 1)));
+        points = _mm_sub_epi16(points, _mm_cmpgt_epi16(m, _mm_set1_epi16(GradeScale::C_MIN_MARKS - 1)));
+        points = _mm_sub_epi16(points, _mm_cmpgt_epi16(m, _mm_set1_epi16(GradeScale::B_MIN_MARKS - 1)));
+        points = _mm_sub_epi16(points, _mm_cmpgt_epi16(m, _mm_set1_epi16(GradeScale::A_MIN_MARKS - 1)));
+        ungradedMask = _mm_cmpgt_epi16(zero, m);
+        return points;
+    }
+
+    __attribute__((target("sse4.1")))
+    inline std::size_t sseCountLanes(__m128i mask16) {
+        return static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(_mm_movemask_epi8(mask16)))) / 2;
+    }
+
+    __attribute__((target("sse4.1")))
+    void sseGradePointsKernel(const std::int16_t* marks, std::size_t count, std::int8_t* outPoints) {
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m128i ungraded;
+            __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(marks + i));
+            __m128i points = sseGradePoints(m, ungraded);
+            points = _mm_or_si128(points, ungraded); // Lane chưa có điểm thành -1
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(outPoints + i), _mm_packs_epi16(points, points));
+        }
+        scalarGradePoints(marks + i, count - i, outPoints + i);
+    }
+
+    __attribute__((target("sse4.1")))
+    WeightedGradePoints sseWeightedKernel(const std::int16_t* marks, const std::uint8_t* credits, std::size_t count) {
+        WeightedGradePoints result;
+        const __m128i ones = _mm_set1_epi16(1);
+        std::size_t i = 0;
+        while (i + 8 <= count) {
+            __m128i pointAcc = _mm_setzero_si128();
+            __m128i creditAcc = _mm_setzero_si128();
+            std::size_t blockEnd = (count - i > ACCUMULATOR_FLUSH_ELEMENTS) ? i + ACCUMULATOR_FLUSH_ELEMENTS : count;
+            for (; i + 8 <= blockEnd; i += 8) {
+                __m128i ungraded;
+                __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(marks + i));
+                __m128i points = sseGradePoints(m, ungraded);
+                __m128i c = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(credits + i)));
+                c = _mm_andnot_si128(ungraded, c);
+                pointAcc = _mm_add_epi32(pointAcc, _mm_madd_epi16(points, c));
+                creditAcc = _mm_add_epi32(creditAcc, _mm_madd_epi16(c, ones));
+            }
+            alignas(16) std::int32_t pointLanes[4];
+            alignas(16) std::int32_t creditLanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(pointLanes), pointAcc);
+            _mm_store_si128(reinterpret_cast<__m128i*>(creditLanes), creditAcc);
+            for (int lane = 0; lane < 4; ++lane) {
+                result.weightedPoints += pointLanes[lane];
+                result.gradedCredits += creditLanes[lane];
+            }
+        }
+        WeightedGradePoints tail = scalarWeighted(marks + i, credits + i, count - i);
+        result.weightedPoints += tail.weightedPoints;
+        result.gradedCredits += tail.gradedCredits;
+        return result;
+    }
+
+    __attribute__((target("sse4.1")))
+    GradeHistogram sseHistogramKernel(const std::int16_t* marks, std::size_t count) {
+        GradeHistogram histogram;
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m128i ungraded;
+            __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(marks + i));
+            __m128i points = sseGradePoints(m, ungraded);
+            __m128i graded = _mm_xor_si128(ungraded, _mm_set1_epi16(-1));
+            for (int point = 0; point <= 4; ++point) {
+                __m128i eq = _mm_and_si128(_mm_cmpeq_epi16(points, _mm_set1_epi16(static_cast<short>(point))), graded);
+                histogram.buckets[static_cast<std::size_t>(point)] += sseCountLanes(eq);
+            }
+            histogram.buckets[GradeHistogram::UNGRADED_BUCKET] += sseCountLanes(ungraded);
+        }
+        GradeHistogram tail = scalarHistogram(marks + i, count - i);
+        for (std::size_t b = 0; b < histogram.buckets.size(); ++b) histogram.buckets[b] += tail.buckets[b];
+        return histogram;
+    }
+
+    __attribute__((target("sse4.1")))
+    PassFailCounts ssePassFailKernel(const std::int16_t* marks, std::size_t count) {
+        PassFailCounts counts;
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i passThreshold = _mm_set1_epi16(GradeScale::PASS_MARKS - 1);
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(marks + i));
+            counts.passed += sseCountLanes(_mm_cmpgt_epi16(m, passThreshold));
+            counts.ungraded += sseCountLanes(_mm_cmpgt_epi16(zero, m));
+        }
+        counts.failed = i - counts.passed - counts.ungraded;
+        PassFailCounts tail = scalarPassFail(marks + i, count - i);
+        counts.passed += tail.passed;
+        counts.failed += tail.failed;
+        counts.ungraded += tail.ungraded;
+        return counts;
+    }
+    __attribute__((target("sse4.1")))
+    void sseAffineKernel(const std::int16_t* marks, std::size_t count, std::int16_t* outMarks, const MarksAffine& transform) {
+        const __m128i scale = _mm_set1_epi32(transform.scale);
+        const __m128i bias = _mm_set1_epi32(transform.offset + (1 << (MarksAffine::FRACTION_BITS - 1)));
+        const __m128i floor = _mm_setzero_si128();
+        const __m128i ceiling = _mm_set1_epi16(transform.ceiling);
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(marks + i));
+            __m128i lo = _mm_cvtepi16_epi32(m);
+            __m128i hi = _mm_cvtepi16_epi32(_mm_srli_si128(m, 8));
+            lo = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(lo, scale), bias), MarksAffine::FRACTION_BITS);
+            hi = _mm_srai_epi32(_mm_add_epi32(_mm_mullo_epi32(hi, scale), bias), MarksAffine::FRACTION_BITS);
+            __m128i curved = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(lo, hi), floor), ceiling);
+            __m128i ungraded = _mm_cmpgt_epi16(floor, m);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(outMarks + i), _mm_blendv_epi8(curved, m, ungraded));
+        }
+        scalarAffine(marks + i, count - i, outMarks + i, transform);
+    }
+#endif // MARKS_KERNELS_X86
+
+    MarksKernels::InstructionSet resolve(MarksKernels::InstructionSet requested) {
+        return MarksKernels::isSupported(requested) ? requested : MarksKernels::InstructionSet::SCALAR;
+    }
+}
+
+// --- MarksKernels ---
+
+bool MarksKernels::isSupported(InstructionSet isa) {
+    switch (isa) {
+        case InstructionSet::SCALAR:
+            return true;
+#ifdef MARKS_KERNELS_X86
+        case InstructionSet::SSE4_1:
+            return __builtin_cpu_supports("sse4.1");
+        case InstructionSet::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+MarksKernels::InstructionSet MarksKernels::activeInstructionSet() {
+    static const InstructionSet detected = [] {
+        if (isSupported(InstructionSet::AVX2)) return InstructionSet::AVX2;
+        if (isSupported(InstructionSet::SSE4_1)) return InstructionSet::SSE4_1;
+        return InstructionSet::SCALAR;
+    }();
+    return detected;
+}
+
+const char* MarksKernels::toString(InstructionSet isa) {
+    switch (isa) {
+        case InstructionSet::AVX2: return "AVX2";
+        case InstructionSet::SSE4_1: return "SSE4.1";
+        default: return "Scalar";
+    }
+}
+
+void MarksKernels::computeGradePoints(const std::int16_t* marks, std::size_t count, std::int8_t* outPoints, InstructionSet isa) {
+    switch (resolve(isa)) {
+#ifdef MARKS_KERNELS_X86
+        case InstructionSet::AVX2: avx2GradePointsKernel(marks, count, outPoints); return;
+        case InstructionSet::SSE4_1: sseGradePointsKernel(marks, count, outPoints); return;
+#endif
+        default: scalarGradePoints(marks, count, outPoints); return;
+    }
+}
+
+WeightedGradePoints MarksKernels::weightedGradePoints(const std::int16_t* marks, const std::uint8_t* credits, std::size_t count, InstructionSet isa) {
+    switch (resolve(isa)) {
+#ifdef MARKS_KERNELS_X86
+        case InstructionSet::AVX2: return avx2WeightedKernel(marks, credits, count);
+        case InstructionSet::SSE4_1: return sseWeightedKernel(marks, credits, count);
+#endif
+        default: return scalarWeighted(marks, credits, count);
+    }
+}
+
+GradeHistogram MarksKernels::gradeHistogram(const std::int16_t* marks, std::size_t count, InstructionSet isa) {
+    switch (resolve(isa)) {
+#ifdef MARKS_KERNELS_X86
+        case InstructionSet::AVX2: return avx2HistogramKernel(marks, count);
+        case InstructionSet::SSE4_1: return sseHistogramKernel(marks, count);
+#endif
+        default: return scalarHistogram(marks, count);
+    }
+}
+
+PassFailCounts MarksKernels::passFailCounts(const std::int16_t* marks, std::size_t count, InstructionSet isa) {
+    switch (resolve(isa)) {
+#ifdef MARKS_KERNELS_X86
+        case InstructionSet::AVX2: return avx2PassFailKernel(marks, count);
+        case InstructionSet::SSE4_1: return ssePassFailKernel(marks, count);
+#endif
+        default: return scalarPassFail(marks, count);
+    }
+}
+
+void MarksKernels::applyAffine(const std::int16_t* marks, std::size_t count, std::int16_t* outMarks, const MarksAffine& transform,
+                               InstructionSet isa) {
+    switch (resolve(isa)) {
+#ifdef MARKS_KERNELS_X86
+        case InstructionSet::AVX2: avx2AffineKernel(marks, count, outMarks, transform); return;
+        case InstructionSet::SSE4_1: sseAffineKernel(marks, count, outMarks, transform); return;
+#endif
+        default: scalarAffine(marks, count, outMarks, transform); return;
+    }
+}
+
+// --- MarksColumn ---
+
+void MarksColumn::reserve(std::size_t capacity) {
+    _marks.reserve(capacity);
+    _credits.reserve(capacity);
+}
+
+bool MarksColumn::append(int marks, int credits) {
+    if (marks < GradeScale::UNGRADED_MARKS || marks > GradeScale::MAX_MARKS) return false;
+    if (credits < 0 || credits > 255) return false;
+    _marks.push_back(static_cast<std::int16_t>(marks));
+    _credits.push_back(static_cast<std::uint8_t>(credits));
+    return true;
+}
+
+void MarksColumn::clear() {
+    _marks.clear();
+    _credits.clear();
+}
+
+std::size_t MarksColumn::size() const { return _marks.size(); }
+bool MarksColumn::empty() const { return _marks.empty(); }
+const std::vector<std::int16_t>& MarksColumn::getMarks() const { return _marks; }
+const std::vector<std::uint8_t>& MarksColumn::getCredits() const { return _credits; }
+
+std::vector<std::int8_t> MarksColumn::toGradePoints() const {
+    std::vector<std::int8_t> points(_marks.size());
+    MarksKernels::computeGradePoints(_marks.data(), _marks.size(), points.data());
+    return points;
+}
+
+WeightedGradePoints MarksColumn::weightedGradePoints() const {
+    return MarksKernels::weightedGradePoints(_marks.data(), _credits.data(), _marks.size());
+}
+
+GradeHistogram MarksColumn::histogram() const {
+    return MarksKernels::gradeHistogram(_marks.data(), _marks.size());
+}
+
+PassFailCounts MarksColumn::passFailCounts() const {
+    return MarksKernels::passFailCounts(_marks.data(), _marks.size());
+}
+
+MarksColumn MarksColumn::transformed(const MarksAffine& transform) const {
+    MarksColumn result;
+    result._marks.resize(_marks.size());
+    result._credits = _credits;
+    MarksKernels::applyAffine(_marks.data(), _marks.size(), result._marks.data(), transform);
+    return result;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file MarksColumn.h
+ * @brief Định nghĩa cột điểm dạng columnar và các kernel tính toán hàng loạt
+ *
+ * File này định nghĩa lớp MarksColumn lưu điểm (int16_t) và tín chỉ (uint8_t)
+ * thành hai mảng liên tục, cùng các kernel AVX2/SSE4.1 (có bản scalar dự phòng)
+ * để đổi điểm sang điểm hệ 4, tính tổng có trọng số, lập phân bố điểm chữ và
+ * đếm số qua/trượt. Dùng cho các tác vụ tính GPA và thống kê hàng loạt.
+ */
+#ifndef MARKSCOLUMN_H
+#define MARKSCOLUMN_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../../common/GradeScale.h"
+
+/**
+ * @struct WeightedGradePoints
+ * @brief Tổng điểm hệ 4 có trọng số tín chỉ của một tập kết quả
+ */
+struct WeightedGradePoints {
+    long long weightedPoints = 0; ///< Tổng (điểm hệ 4 * tín chỉ) của các môn đã có điểm
+    long long gradedCredits = 0;  ///< Tổng tín chỉ của các môn đã có điểm
+
+    /**
+     * @brief Điểm trung bình có trọng số
+     * @return weightedPoints / gradedCredits, hoặc 0.0 nếu chưa có tín chỉ nào
+     */
+    double average() const;
+};
+
+/**
+ * @struct GradeHistogram
+ * @brief Phân bố số lượng kết quả theo điểm chữ
+ *
+ * Chỉ số của mảng buckets chính là điểm hệ 4 (F=0 ... A=4), riêng
+ * UNGRADED_BUCKET dành cho các kết quả chưa có điểm.
+ */
+struct GradeHistogram {
+    static constexpr std::size_t UNGRADED_BUCKET = 5; ///< Vị trí của nhóm chưa có điểm
+    std::array<std::size_t, 6> buckets{};              ///< Số lượng theo từng nhóm
+
+    /**
+     * @brief Lấy số lượng kết quả theo điểm chữ
+     * @param grade Điểm chữ (A, B, C, D, F, -)
+     * @return Số lượng kết quả, 0 nếu điểm chữ không hợp lệ
+     */
+    std::size_t countFor(char grade) const;
+
+    /**
+     * @brief Tổng số kết quả đã được đếm
+     */
+    std::size_t total() const;
+};
+
+/**
+ * @struct PassFailCounts
+ * @brief Số lượng kết quả qua môn, trượt và chưa có điểm
+ */
+struct PassFailCounts {
+    std::size_t passed = 0;   ///< Số kết quả có điểm >= GradeScale::PASS_MARKS
+    std::size_t failed = 0;   ///< Số kết quả có điểm trong [0, PASS_MARKS)
+    std::size_t ungraded = 0; ///< Số kết quả chưa có điểm
+};
+
+/**
+ * @struct MarksAffine
+ * @brief Phép biến đổi điểm new = clamp(round(scale * marks + offset), 0, ceiling)
+ *
+ * scale và offset là số thực dấu phẩy tĩnh FRACTION_BITS bit phần lẻ để bản scalar và
+ * các bản SIMD cho cùng một kết quả. Điểm chưa có (-1) được giữ nguyên.
+ */
+struct MarksAffine {
+    static constexpr int FRACTION_BITS = 16;      ///< Số bit phần lẻ
+    static constexpr double MAX_SCALE = 16.0;     ///< |scale| tối đa để không tràn int32
+    static constexpr double MAX_OFFSET = 1000.0;  ///< |offset| tối đa để không tràn int32
+
+    std::int32_t scale = 1 << FRACTION_BITS;          ///< Hệ số nhân (dấu phẩy tĩnh)
+    std::int32_t offset = 0;                          ///< Số cộng thêm (dấu phẩy tĩnh)
+    std::int16_t ceiling = GradeScale::MAX_MARKS;     ///< Điểm tối đa sau biến đổi
+
+    /**
+     * @brief Tạo phép biến đổi từ số thực
+     * @param scale Hệ số nhân, bị giới hạn trong [-MAX_SCALE, MAX_SCALE]
+     * @param offset Số cộng thêm, bị giới hạn trong [-MAX_OFFSET, MAX_OFFSET]
+     * @param ceiling Điểm tối đa, bị giới hạn trong [0, MAX_MARKS]
+     */
+    static MarksAffine fromReal(double scale, double offset, int ceiling = GradeScale::MAX_MARKS);
+
+    /**
+     * @brief Áp dụng cho một điểm (bản tham chiếu của các kernel)
+     */
+    int apply(int marks) const;
+};
+
+/**
+ * @namespace MarksKernels
+ * @brief Các kernel xử lý mảng điểm liên tục
+ *
+ * Mỗi kernel chọn bộ lệnh tốt nhất mà CPU hỗ trợ tại thời điểm chạy
+ * (AVX2 > SSE4.1 > scalar). Đầu vào phải nằm trong [-1, 100]; MarksColumn
+ * đảm bảo điều này khi thêm phần tử.
+ */
+namespace MarksKernels {
+    /**
+     * @enum InstructionSet
+     * @brief Bộ lệnh được dùng để thực thi kernel
+     */
+    enum class InstructionSet {
+        SCALAR, ///< Vòng lặp thông thường, chạy trên mọi nền tảng
+        SSE4_1, ///< 8 điểm mỗi lệnh
+        AVX2    ///< 16 điểm mỗi lệnh
+    };
+
+    /**
+     * @brief Bộ lệnh tốt nhất được CPU hiện tại hỗ trợ
+     */
+    InstructionSet activeInstructionSet();
+
+    /**
+     * @brief Kiểm tra CPU hiện tại có hỗ trợ bộ lệnh hay không
+     */
+    bool isSupported(InstructionSet isa);
+
+    /**
+     * @brief Tên hiển thị của bộ lệnh (dùng khi ghi log)
+     */
+    const char* toString(InstructionSet isa);
+
+    /**
+     * @brief Đổi điểm số sang điểm hệ 4
+     * @param marks Mảng điểm
+     * @param count Số phần tử
+     * @param outPoints Mảng kết quả (ít nhất count phần tử), -1 nếu chưa có điểm
+     * @param isa Bộ lệnh sử dụng (tự lùi về scalar nếu CPU không hỗ trợ)
+     */
+    void computeGradePoints(const std::int16_t* marks, std::size_t count, std::int8_t* outPoints,
+                            InstructionSet isa = activeInstructionSet());
+
+    /**
+     * @brief Tính tổng điểm hệ 4 có trọng số tín chỉ, bỏ qua các môn chưa có điểm
+     */
+    WeightedGradePoints weightedGradePoints(const std::int16_t* marks, const std::uint8_t* credits, std::size_t count,
+                                            InstructionSet isa = activeInstructionSet());
+
+    /**
+     * @brief Lập phân bố điểm chữ
+     */
+    GradeHistogram gradeHistogram(const std::int16_t* marks, std::size_t count,
+                                  InstructionSet isa = activeInstructionSet());
+
+    /**
+     * @brief Đếm số kết quả qua môn / trượt / chưa có điểm
+     */
+    PassFailCounts passFailCounts(const std::int16_t* marks, std::size_t count,
+                                  InstructionSet isa = activeInstructionSet());
+
+    /**
+     * @brief Biến đổi toàn bộ mảng điểm theo MarksAffine
+     * @param marks Mảng điểm
+     * @param count Số phần tử
+     * @param outMarks Mảng kết quả (ít nhất count phần tử, có thể trùng marks)
+     * @param transform Phép biến đổi
+     * @param isa Bộ lệnh sử dụng
+     */
+    void applyAffine(const std::int16_t* marks, std::size_t count, std::int16_t* outMarks, const MarksAffine& transform,
+                     InstructionSet isa = activeInstructionSet());
+}
+
+/**
+ * @class MarksColumn
+ * @brief Cột điểm và tín chỉ lưu liên tục trong bộ nhớ
+ *
+ * Thay vì duyệt từng đối tượng CourseResult, các tác vụ hàng loạt nạp điểm vào
+ * MarksColumn một lần rồi gọi các kernel trong MarksKernels trên toàn bộ cột.
+ */
+class MarksColumn {
+private:
+    std::vector<std::int16_t> _marks;  ///< Điểm số (-1 là chưa có điểm)
+    std::vector<std::uint8_t> _credits; ///< Số tín chỉ tương ứng với từng điểm
+
+public:
+    /**
+     * @brief Constructor mặc định tạo cột rỗng
+     */
+    MarksColumn() = default;
+
+    /**
+     * @brief Cấp phát trước bộ nhớ cho một số lượng phần tử
+     * @param capacity Số phần tử dự kiến
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Thêm một điểm vào cột
+     * @param marks Điểm số (-1 đến 100)
+     * @param credits Số tín chỉ (0 đến 255)
+     * @return true nếu thành công, false nếu giá trị nằm ngoài miền cho phép
+     */
+    bool append(int marks, int credits = 0);
+
+    /**
+     * @brief Xóa toàn bộ dữ liệu của cột
+     */
+    void clear();
+
+    /**
+     * @brief Số phần tử trong cột
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Kiểm tra cột rỗng
+     */
+    bool empty() const;
+
+    /**
+     * @brief Lấy mảng điểm
+     */
+    const std::vector<std::int16_t>& getMarks() const;
+
+    /**
+     * @brief Lấy mảng tín chỉ
+     */
+    const std::vector<std::uint8_t>& getCredits() const;
+
+    /**
+     * @brief Đổi toàn bộ cột sang điểm hệ 4 (-1 nếu chưa có điểm)
+     */
+    std::vector<std::int8_t> toGradePoints() const;
+
+    /**
+     * @brief Tổng điểm hệ 4 có trọng số tín chỉ của toàn bộ cột
+     */
+    WeightedGradePoints weightedGradePoints() const;
+
+    /**
+     * @brief Phân bố điểm chữ của toàn bộ cột
+     */
+    GradeHistogram histogram() const;
+
+    /**
+     * @brief Số lượng qua môn / trượt / chưa có điểm của toàn bộ cột
+     */
+    PassFailCounts passFailCounts() const;
+
+    /**
+     * @brief Cột điểm sau khi biến đổi theo MarksAffine (giữ nguyên tín chỉ)
+     */
+    MarksColumn transformed(const MarksAffine& transform) const;
+};
+
+#endif // MARKSCOLUMN_H
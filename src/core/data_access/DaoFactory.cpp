@@ -9,6 +9,51 @@
 #include "sql/SqlCourseResultDao.h"
 #include "sql/SqlFeeRecordDao.h"
 #include "sql/SqlSalaryRecordDao.h"
+#include "sql/SqlSequenceDao.h"
+#include "sql/SqlTransactionManager.h"
+#include "sql/SqlFinanceReportDao.h"
+#include "sql/SqlPayrollDao.h"
+#include "sql/SqlTuitionRateDao.h"
+#include "sql/SqlTuitionDao.h"
+#include "sql/SqlInstallmentDao.h"
+#include "sql/SqlWaitlistDao.h"
+#include "sql/SqlPrerequisiteDao.h"
+#include "sql/SqlExamScheduleDao.h"
+#include "sql/SqlDegreeRequirementDao.h"
+#include "sql/SqlAttendanceDao.h"
+#include "sql/SqlTermDao.h"
+#include "sql/SqlStudentArchiveDao.h"
+#include "sql/SqlShardRouter.h"
+#include "sql/SqlShardedStudentDao.h"
+#include "sql/SqlShardedCourseDao.h"
+#include "sql/SqlShardedEnrollmentDao.h"
+#include "sql/SqlShardedCourseResultDao.h"
+#include "sql/SqlShardedFeeRecordDao.h"
+// Include các CSV DAO cụ thể
+#include "csv/CsvStudentDao.h"
+#include "csv/CsvTeacherDao.h"
+#include "csv/CsvFacultyDao.h"
+#include "csv/CsvCourseDao.h"
+#include "csv/CsvLoginDao.h"
+#include "csv/CsvEnrollmentDao.h"
+#include "csv/CsvCourseResultDao.h"
+#include "csv/CsvFeeRecordDao.h"
+#include "csv/CsvSalaryRecordDao.h"
+#include "csv/CsvSequenceDao.h"
+#include "csv/CsvPayrollDao.h"
+#include "csv/CsvTuitionRateDao.h"
+#include "csv/CsvInstallmentDao.h"
+#include "csv/CsvWaitlistDao.h"
+#include "csv/CsvPrerequisiteDao.h"
+#include "csv/CsvExamScheduleDao.h"
+#include "csv/CsvDegreeRequirementDao.h"
+#include "csv/CsvAttendanceDao.h"
+#include "csv/CsvTermDao.h"
+#include "NullTransactionManager.h"
+#include "NullStudentArchiveDao.h"
+#include "StreamingFinanceReportDao.h"
+#include "StreamingTuitionDao.h"
+#include "../../utils/PasswordInput.h" // Cho PasswordUtils khi tạo admin mặc định
 
 // Khởi tạo các con trỏ static
 std::shared_ptr<IDatabaseAdapter> DaoFactory::_dbAdapterInstance = nullptr;
@@ -25,6 +70,91 @@ std::shared_ptr<IEntityParser<FeeRecord, DbQueryResultRow>> DaoFactory::_feeReco
 std::shared_ptr<IEntityParser<SalaryRecord, DbQueryResultRow>> DaoFactory::_salaryRecordSqlParserInstance = nullptr;
 std::mutex DaoFactory::_parserMutex;
 
+std::shared_ptr<SqlShardRouter> DaoFactory::_shardRouterInstance = nullptr;
+std::mutex DaoFactory::_shardRouterMutex;
+
+std::map<EntityType, std::shared_ptr<CsvTable>> DaoFactory::_csvTables;
+std::mutex DaoFactory::_csvTableMutex;
+std::map<std::string, std::shared_ptr<CsvTable>> DaoFactory::_csvAuxiliaryTables;
+
+namespace {
+    // Bố cục cột, khóa chính và các cột có chỉ mục của từng file CSV
+    CsvTableSchema csvSchemaFor(EntityType entityType) {
+        switch (entityType) {
+            case EntityType::STUDENT:
+                return {StudentCsvParser::columns(), {StudentCsvParser::ID},
+                        {StudentCsvParser::FACULTY_ID, StudentCsvParser::EMAIL, StudentCsvParser::STATUS}};
+            case EntityType::TEACHER:
+                return {TeacherCsvParser::columns(), {TeacherCsvParser::ID},
+                        {TeacherCsvParser::FACULTY_ID, TeacherCsvParser::EMAIL}};
+            case EntityType::FACULTY:
+                return {FacultyCsvParser::columns(), {FacultyCsvParser::ID}, {FacultyCsvParser::NAME}};
+            case EntityType::COURSE:
+                return {CourseCsvParser::columns(), {CourseCsvParser::ID}, {CourseCsvParser::FACULTY_ID}};
+            case EntityType::ENROLLMENT:
+                return {EnrollmentRecordCsvParser::columns(),
+                        {EnrollmentRecordCsvParser::STUDENT_ID, EnrollmentRecordCsvParser::COURSE_ID},
+                        {EnrollmentRecordCsvParser::STUDENT_ID, EnrollmentRecordCsvParser::COURSE_ID, EnrollmentRecordCsvParser::TERM_ID}};
+            case EntityType::COURSERESULT:
+                return {CourseResultCsvParser::columns(),
+                        {CourseResultCsvParser::STUDENT_ID, CourseResultCsvParser::COURSE_ID},
+                        {CourseResultCsvParser::STUDENT_ID, CourseResultCsvParser::COURSE_ID, CourseResultCsvParser::TERM_ID}};
+            case EntityType::FEERECORD:
+                return {FeeRecordCsvParser::columns(), {FeeRecordCsvParser::STUDENT_ID}, {}};
+            case EntityType::SALARYRECORD:
+                return {SalaryRecordCsvParser::columns(), {SalaryRecordCsvParser::TEACHER_ID}, {}};
+            case EntityType::LOGIN:
+                return {LoginCredentialsCsvParser::columns(), {LoginCredentialsCsvParser::USER_ID},
+                        {LoginCredentialsCsvParser::STATUS}};
+        }
+        throw std::runtime_error("DaoFactory: Unknown entity type for CSV table.");
+    }
+
+    std::string csvDefaultFileName(EntityType entityType) {
+        switch (entityType) {
+            case EntityType::STUDENT: return "students.csv";
+            case EntityType::TEACHER: return "teachers.csv";
+            case EntityType::FACULTY: return "faculties.csv";
+            case EntityType::COURSE: return "courses.csv";
+            case EntityType::ENROLLMENT: return "enrollments.csv";
+            case EntityType::COURSERESULT: return "course_results.csv";
+            case EntityType::FEERECORD: return "fee_records.csv";
+            case EntityType::SALARYRECORD: return "salary_records.csv";
+            case EntityType::LOGIN: return "logins.csv";
+        }
+        return "unknown.csv";
+    }
+}
+
+
+std::vector<CsvCascade> DaoFactory::getCsvCascades(const AppConfig& config, EntityType entityType) {
+    // Cùng danh sách khóa ngoại ON DELETE CASCADE của schema SQL (AttendanceRoster.studentId cố ý không có)
+    switch (entityType) {
+        case EntityType::STUDENT:
+            return {{getCsvTable(config, EntityType::LOGIN), LoginCredentialsCsvParser::USER_ID},
+                    {getCsvTable(config, EntityType::ENROLLMENT), EnrollmentRecordCsvParser::STUDENT_ID},
+                    {getCsvTable(config, EntityType::COURSERESULT), CourseResultCsvParser::STUDENT_ID},
+                    {getCsvTable(config, EntityType::FEERECORD), FeeRecordCsvParser::STUDENT_ID},
+                    {getCsvAuxiliaryTable(config, "feepayments.csv", CsvFeeRecordDao::paymentSchema()), CsvFeeRecordDao::PAYMENT_STUDENT},
+                    {getCsvAuxiliaryTable(config, "feeinstallments.csv", CsvInstallmentDao::schema()), CsvInstallmentDao::STUDENT_ID},
+                    {getCsvAuxiliaryTable(config, "waitlist.csv", CsvWaitlistDao::schema()), CsvWaitlistDao::STUDENT_ID}};
+        case EntityType::TEACHER:
+            return {{getCsvTable(config, EntityType::LOGIN), LoginCredentialsCsvParser::USER_ID},
+                    {getCsvTable(config, EntityType::SALARYRECORD), SalaryRecordCsvParser::TEACHER_ID},
+                    {getCsvAuxiliaryTable(config, "salarypayments.csv", CsvPayrollDao::schema()), CsvPayrollDao::TEACHER_ID}};
+        case EntityType::COURSE:
+            return {{getCsvTable(config, EntityType::ENROLLMENT), EnrollmentRecordCsvParser::COURSE_ID},
+                    {getCsvTable(config, EntityType::COURSERESULT), CourseResultCsvParser::COURSE_ID},
+                    {getCsvAuxiliaryTable(config, "waitlist.csv", CsvWaitlistDao::schema()), CsvWaitlistDao::COURSE_ID},
+                    {getCsvAuxiliaryTable(config, "course_prerequisites.csv", CsvPrerequisiteDao::schema()), CsvPrerequisiteDao::COURSE_ID},
+                    {getCsvAuxiliaryTable(config, "course_prerequisites.csv", CsvPrerequisiteDao::schema()), CsvPrerequisiteDao::PREREQUISITE_ID},
+                    {getCsvAuxiliaryTable(config, "exam_schedule.csv", CsvExamScheduleDao::schema()), CsvExamScheduleDao::COURSE_ID},
+                    {getCsvAuxiliaryTable(config, "attendance_roster.csv", CsvAttendanceDao::rosterSchema()), CsvAttendanceDao::ROSTER_COURSE_ID},
+                    {getCsvAuxiliaryTable(config, "attendance_sessions.csv", CsvAttendanceDao::sessionSchema()), CsvAttendanceDao::SESSION_COURSE_ID}};
+        default:
+            return {};
+    }
+}
 
 std::shared_ptr<IDatabaseAdapter> DaoFactory::getDatabaseAdapter(const AppConfig& config) {
     std::lock_guard<std::mutex> lock(_dbAdapterMutex);
@@ -63,6 +193,17 @@ std::shared_ptr<IDatabaseAdapter> DaoFactory::getDatabaseAdapter(const AppConfig
                 LOG_CRITICAL("DaoFactory: Failed to ensure SQLite tables exist: " + errMsg);
                 throw std::runtime_error("DaoFactory: Failed to ensure database tables. Reason: " + errMsg);
             }
+
+            if (!config.sqlArchivePath.empty()) {
+                std::filesystem::path archivePath(config.sqlArchivePath);
+                std::error_code ec;
+                if (archivePath.has_parent_path()) std::filesystem::create_directories(archivePath.parent_path(), ec);
+                auto attachResult = sqliteAdapter->attachArchive(config.sqlArchivePath);
+                if (!attachResult.has_value()) {
+                    LOG_CRITICAL("DaoFactory: Failed to attach archive database (" + config.sqlArchivePath + "): " + attachResult.error().message);
+                    throw std::runtime_error("DaoFactory: Failed to attach archive database. Reason: " + attachResult.error().message);
+                }
+            }
             _dbAdapterInstance = sqliteAdapter;
         } else {
             throw std::runtime_error("DaoFactory: SQL data source type selected, but no SQL configuration available or invalid type.");
@@ -71,6 +212,73 @@ std::shared_ptr<IDatabaseAdapter> DaoFactory::getDatabaseAdapter(const AppConfig
     return _dbAdapterInstance;
 }
 
+bool DaoFactory::isSqlSharded(const AppConfig& config) {
+    return config.dataSourceType == DataSourceType::SQL && !config.sqlShardDirectory.empty();
+}
+
+std::shared_ptr<SqlShardRouter> DaoFactory::getShardRouter(const AppConfig& config) {
+    auto mainAdapter = getDatabaseAdapter(config); // Lấy trước khi khoá để không giữ hai mutex cùng lúc
+    std::lock_guard<std::mutex> lock(_shardRouterMutex);
+    if (_shardRouterInstance == nullptr) {
+        _shardRouterInstance = std::make_shared<SqlShardRouter>(mainAdapter, config.sqlConnectionString, config.sqlShardDirectory);
+        LOG_INFO("DaoFactory: SQL data is sharded by faculty under " + config.sqlShardDirectory);
+    }
+    return _shardRouterInstance;
+}
+
+std::shared_ptr<CsvTable> DaoFactory::getCsvTable(const AppConfig& config, EntityType entityType) {
+    std::lock_guard<std::mutex> lock(_csvTableMutex);
+    auto it = _csvTables.find(entityType);
+    if (it != _csvTables.end()) {
+        return it->second;
+    }
+
+    auto pathIt = config.csvFilePaths.find(entityType);
+    std::filesystem::path filePath = pathIt != config.csvFilePaths.end()
+        ? pathIt->second
+        : config.csvDataDirectory / csvDefaultFileName(entityType);
+
+    auto table = std::make_shared<CsvTable>(filePath, csvSchemaFor(entityType), config.csvCompactionThreshold);
+    auto loadResult = table->load();
+    if (!loadResult.has_value()) {
+        LOG_CRITICAL("DaoFactory: Failed to load CSV file (" + filePath.string() + "): " + loadResult.error().message);
+        throw std::runtime_error("DaoFactory: Failed to load CSV data. Reason: " + loadResult.error().message);
+    }
+
+    // Giống SQLiteAdapter::ensureTablesExist: bảo đảm luôn có tài khoản admin mặc định
+    if (entityType == EntityType::LOGIN && !table->contains("admin")) {
+        std::string salt = PasswordUtils::generateSalt();
+        LoginCredentials admin{"admin", PasswordUtils::hashPassword("admin123", salt), salt, UserRole::ADMIN, LoginStatus::ACTIVE};
+        auto adminRow = LoginCredentialsCsvParser().serialize(admin);
+        if (adminRow.has_value() && table->insert(std::move(adminRow.value())).has_value()) {
+            LOG_INFO("DaoFactory: Default admin user 'admin' created with default password. PLEASE CHANGE IT AFTER FIRST LOGIN.");
+        } else {
+            LOG_ERROR("DaoFactory: Failed to create default admin credentials in " + filePath.string());
+        }
+    }
+
+    _csvTables.emplace(entityType, table);
+    return table;
+}
+
+std::shared_ptr<CsvTable> DaoFactory::getCsvAuxiliaryTable(const AppConfig& config, const std::string& fileName, const CsvTableSchema& schema) {
+    std::lock_guard<std::mutex> lock(_csvTableMutex);
+    auto it = _csvAuxiliaryTables.find(fileName);
+    if (it != _csvAuxiliaryTables.end()) {
+        return it->second;
+    }
+
+    std::filesystem::path filePath = config.csvDataDirectory / fileName;
+    auto table = std::make_shared<CsvTable>(filePath, schema, config.csvCompactionThreshold);
+    auto loadResult = table->load();
+    if (!loadResult.has_value()) {
+        LOG_CRITICAL("DaoFactory: Failed to load CSV file (" + filePath.string() + "): " + loadResult.error().message);
+        throw std::runtime_error("DaoFactory: Failed to load CSV data. Reason: " + loadResult.error().message);
+    }
+    _csvAuxiliaryTables.emplace(fileName, table);
+    return table;
+}
+
 // Triển khai các getXxxSqlParser()
 std::shared_ptr<IEntityParser<Student, DbQueryResultRow>> DaoFactory::getStudentSqlParser() {
     std::lock_guard<std::mutex> lock(_parserMutex);
@@ -149,11 +357,13 @@ std::shared_ptr<IEntityParser<SalaryRecord, DbQueryResultRow>> DaoFactory::getSa
 std::shared_ptr<IStudentDao> DaoFactory::createStudentDao(const AppConfig& config) {
     switch (config.dataSourceType) {
         case DataSourceType::SQL:
+            if (isSqlSharded(config)) return std::make_shared<SqlShardedStudentDao>(getShardRouter(config), getStudentSqlParser());
             return std::make_shared<SqlStudentDao>(getDatabaseAdapter(config), getStudentSqlParser());
         case DataSourceType::MOCK:
              return std::make_shared<MockStudentDao>();
-        // case DataSourceType::CSV:
-        //     // return std::make_shared<CsvStudentDao>(...); // Cần file handler và CSV parser
+        case DataSourceType::CSV:
+            return std::make_shared<CsvStudentDao>(getCsvTable(config, EntityType::STUDENT), std::make_shared<StudentCsvParser>(),
+                                                   getCsvCascades(config, EntityType::STUDENT));
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for StudentDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for StudentDao");
@@ -166,6 +376,9 @@ std::shared_ptr<ITeacherDao> DaoFactory::createTeacherDao(const AppConfig& confi
             return std::make_shared<SqlTeacherDao>(getDatabaseAdapter(config), getTeacherSqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockTeacherDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvTeacherDao>(getCsvTable(config, EntityType::TEACHER), std::make_shared<TeacherCsvParser>(),
+                                                   getCsvCascades(config, EntityType::TEACHER));
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for TeacherDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for TeacherDao");
@@ -178,6 +391,8 @@ std::shared_ptr<IFacultyDao> DaoFactory::createFacultyDao(const AppConfig& confi
             return std::make_shared<SqlFacultyDao>(getDatabaseAdapter(config), getFacultySqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockFacultyDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvFacultyDao>(getCsvTable(config, EntityType::FACULTY), std::make_shared<FacultyCsvParser>());
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for FacultyDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for FacultyDao");
@@ -187,9 +402,13 @@ std::shared_ptr<IFacultyDao> DaoFactory::createFacultyDao(const AppConfig& confi
 std::shared_ptr<ICourseDao> DaoFactory::createCourseDao(const AppConfig& config) {
     switch (config.dataSourceType) {
         case DataSourceType::SQL:
+            if (isSqlSharded(config)) return std::make_shared<SqlShardedCourseDao>(getShardRouter(config), getCourseSqlParser());
             return std::make_shared<SqlCourseDao>(getDatabaseAdapter(config), getCourseSqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockCourseDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvCourseDao>(getCsvTable(config, EntityType::COURSE), std::make_shared<CourseCsvParser>(),
+                                                  getCsvCascades(config, EntityType::COURSE));
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for CourseDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for CourseDao");
@@ -202,18 +421,223 @@ std::shared_ptr<ILoginDao> DaoFactory::createLoginDao(const AppConfig& config) {
             return std::make_shared<SqlLoginDao>(getDatabaseAdapter(config), getLoginCredentialsSqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockLoginDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvLoginDao>(getCsvTable(config, EntityType::LOGIN), std::make_shared<LoginCredentialsCsvParser>());
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for LoginDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for LoginDao");
     }
 }
 
+std::shared_ptr<ISequenceDao> DaoFactory::createSequenceDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlSequenceDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockSequenceDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvSequenceDao>(getCsvAuxiliaryTable(config, "sequences.csv", CsvSequenceDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for SequenceDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for SequenceDao");
+    }
+}
+
+std::shared_ptr<ITransactionManager> DaoFactory::createTransactionManager(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlTransactionManager>(getDatabaseAdapter(config), !isSqlSharded(config));
+        case DataSourceType::MOCK:
+        case DataSourceType::CSV:
+            return std::make_shared<NullTransactionManager>();
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for TransactionManager: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for TransactionManager");
+    }
+}
+
+std::shared_ptr<IFinanceReportDao> DaoFactory::createFinanceReportDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            if (!isSqlSharded(config)) return std::make_shared<SqlFinanceReportDao>(getDatabaseAdapter(config));
+            [[fallthrough]]; // Học phí nằm rải rác trong các shard, không JOIN được với bảng lương
+        case DataSourceType::MOCK:
+        case DataSourceType::CSV:
+            return std::make_shared<StreamingFinanceReportDao>(createFeeRecordDao(config), createSalaryRecordDao(config),
+                                                               createStudentDao(config), createTeacherDao(config));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for FinanceReportDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for FinanceReportDao");
+    }
+}
+
+std::shared_ptr<IPayrollDao> DaoFactory::createPayrollDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlPayrollDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockPayrollDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvPayrollDao>(getCsvAuxiliaryTable(config, "salarypayments.csv", CsvPayrollDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for PayrollDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for PayrollDao");
+    }
+}
+
+std::shared_ptr<ITuitionRateDao> DaoFactory::createTuitionRateDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlTuitionRateDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockTuitionRateDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvTuitionRateDao>(getCsvAuxiliaryTable(config, "tuitionrates.csv", CsvTuitionRateDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for TuitionRateDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for TuitionRateDao");
+    }
+}
+
+std::shared_ptr<ITuitionDao> DaoFactory::createTuitionDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            if (!isSqlSharded(config)) return std::make_shared<SqlTuitionDao>(getDatabaseAdapter(config));
+            [[fallthrough]];
+        case DataSourceType::MOCK:
+        case DataSourceType::CSV:
+            return std::make_shared<StreamingTuitionDao>(createTuitionRateDao(config), createStudentDao(config),
+                                                         createEnrollmentDao(config), createCourseDao(config), createFeeRecordDao(config));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for TuitionDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for TuitionDao");
+    }
+}
+
+std::shared_ptr<IInstallmentDao> DaoFactory::createInstallmentDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlInstallmentDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockInstallmentDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvInstallmentDao>(getCsvAuxiliaryTable(config, "feeinstallments.csv", CsvInstallmentDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for InstallmentDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for InstallmentDao");
+    }
+}
+
+std::shared_ptr<IWaitlistDao> DaoFactory::createWaitlistDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlWaitlistDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockWaitlistDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvWaitlistDao>(getCsvAuxiliaryTable(config, "waitlist.csv", CsvWaitlistDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for WaitlistDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for WaitlistDao");
+    }
+}
+
+std::shared_ptr<IPrerequisiteDao> DaoFactory::createPrerequisiteDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlPrerequisiteDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockPrerequisiteDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvPrerequisiteDao>(getCsvAuxiliaryTable(config, "course_prerequisites.csv", CsvPrerequisiteDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for PrerequisiteDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for PrerequisiteDao");
+    }
+}
+
+std::shared_ptr<IExamScheduleDao> DaoFactory::createExamScheduleDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlExamScheduleDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockExamScheduleDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvExamScheduleDao>(getCsvAuxiliaryTable(config, "exam_schedule.csv", CsvExamScheduleDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for ExamScheduleDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for ExamScheduleDao");
+    }
+}
+
+std::shared_ptr<IDegreeRequirementDao> DaoFactory::createDegreeRequirementDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlDegreeRequirementDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockDegreeRequirementDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvDegreeRequirementDao>(getCsvAuxiliaryTable(config, "degree_requirements.csv", CsvDegreeRequirementDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for DegreeRequirementDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for DegreeRequirementDao");
+    }
+}
+
+std::shared_ptr<IAttendanceDao> DaoFactory::createAttendanceDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlAttendanceDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockAttendanceDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvAttendanceDao>(getCsvAuxiliaryTable(config, "attendance_roster.csv", CsvAttendanceDao::rosterSchema()),
+                                                      getCsvAuxiliaryTable(config, "attendance_sessions.csv", CsvAttendanceDao::sessionSchema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for AttendanceDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for AttendanceDao");
+    }
+}
+
+std::shared_ptr<ITermDao> DaoFactory::createTermDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            return std::make_shared<SqlTermDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockTermDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvTermDao>(getCsvAuxiliaryTable(config, "terms.csv", CsvTermDao::schema()));
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for TermDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for TermDao");
+    }
+}
+
+std::shared_ptr<IStudentArchiveDao> DaoFactory::createStudentArchiveDao(const AppConfig& config) {
+    switch (config.dataSourceType) {
+        case DataSourceType::SQL:
+            if (isSqlSharded(config)) return std::make_shared<NullStudentArchiveDao>();
+            return std::make_shared<SqlStudentArchiveDao>(getDatabaseAdapter(config));
+        case DataSourceType::MOCK:
+            return std::make_shared<MockStudentArchiveDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<NullStudentArchiveDao>();
+        default:
+            LOG_ERROR("DaoFactory: Unsupported data source type for StudentArchiveDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
+            throw std::runtime_error("Unsupported data source type for StudentArchiveDao");
+    }
+}
+
 std::shared_ptr<IEnrollmentDao> DaoFactory::createEnrollmentDao(const AppConfig& config) {
     switch (config.dataSourceType) {
         case DataSourceType::SQL:
+            if (isSqlSharded(config)) return std::make_shared<SqlShardedEnrollmentDao>(getShardRouter(config), getEnrollmentRecordSqlParser());
             return std::make_shared<SqlEnrollmentDao>(getDatabaseAdapter(config), getEnrollmentRecordSqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockEnrollmentDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvEnrollmentDao>(getCsvTable(config, EntityType::ENROLLMENT), std::make_shared<EnrollmentRecordCsvParser>(),
+                                                      getCsvTable(config, EntityType::COURSE));
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for EnrollmentDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for EnrollmentDao");
@@ -223,9 +647,12 @@ std::shared_ptr<IEnrollmentDao> DaoFactory::createEnrollmentDao(const AppConfig&
 std::shared_ptr<ICourseResultDao> DaoFactory::createCourseResultDao(const AppConfig& config) {
     switch (config.dataSourceType) {
         case DataSourceType::SQL:
+            if (isSqlSharded(config)) return std::make_shared<SqlShardedCourseResultDao>(getShardRouter(config), getCourseResultSqlParser());
             return std::make_shared<SqlCourseResultDao>(getDatabaseAdapter(config), getCourseResultSqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockCourseResultDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvCourseResultDao>(getCsvTable(config, EntityType::COURSERESULT), std::make_shared<CourseResultCsvParser>());
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for CourseResultDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for CourseResultDao");
@@ -235,9 +662,14 @@ std::shared_ptr<ICourseResultDao> DaoFactory::createCourseResultDao(const AppCon
 std::shared_ptr<IFeeRecordDao> DaoFactory::createFeeRecordDao(const AppConfig& config) {
     switch (config.dataSourceType) {
         case DataSourceType::SQL:
+            if (isSqlSharded(config)) return std::make_shared<SqlShardedFeeRecordDao>(getShardRouter(config), getFeeRecordSqlParser());
             return std::make_shared<SqlFeeRecordDao>(getDatabaseAdapter(config), getFeeRecordSqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockFeeRecordDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvFeeRecordDao>(getCsvTable(config, EntityType::FEERECORD),
+                                                     getCsvAuxiliaryTable(config, "feepayments.csv", CsvFeeRecordDao::paymentSchema()),
+                                                     std::make_shared<FeeRecordCsvParser>());
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for FeeRecordDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for FeeRecordDao");
@@ -250,6 +682,8 @@ std::shared_ptr<ISalaryRecordDao> DaoFactory::createSalaryRecordDao(const AppCon
             return std::make_shared<SqlSalaryRecordDao>(getDatabaseAdapter(config), getSalaryRecordSqlParser());
         case DataSourceType::MOCK:
             return std::make_shared<MockSalaryRecordDao>();
+        case DataSourceType::CSV:
+            return std::make_shared<CsvSalaryRecordDao>(getCsvTable(config, EntityType::SALARYRECORD), std::make_shared<SalaryRecordCsvParser>());
         default:
             LOG_ERROR("DaoFactory: Unsupported data source type for SalaryRecordDao: " + std::to_string(static_cast<int>(config.dataSourceType)));
             throw std::runtime_error("Unsupported data source type for SalaryRecordDao");
@@ -257,6 +691,10 @@ std::shared_ptr<ISalaryRecordDao> DaoFactory::createSalaryRecordDao(const AppCon
 }
 
 void DaoFactory::cleanup() {
+    {
+        std::lock_guard<std::mutex> lock_router(_shardRouterMutex);
+        _shardRouterInstance.reset(); // Đóng các file shard trước adapter chính
+    }
     std::lock_guard<std::mutex> lock(_dbAdapterMutex);
     if (_dbAdapterInstance) {
         LOG_INFO("DaoFactory: Cleaning up database adapter.");
@@ -276,5 +714,8 @@ void DaoFactory::cleanup() {
     _courseResultSqlParserInstance.reset();
     _feeRecordSqlParserInstance.reset();
     _salaryRecordSqlParserInstance.reset();
+    std::lock_guard<std::mutex> lock_csv(_csvTableMutex);
+    _csvTables.clear(); // Hủy bảng sẽ chờ compaction đang chạy và đóng journal
+    _csvAuxiliaryTables.clear();
     LOG_INFO("DaoFactory: Static resources cleaned up.");
 }
\ No newline at end of file
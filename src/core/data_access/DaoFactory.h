@@ -19,6 +19,20 @@
 #include "interface/IFeeRecordDao.h"
 #include "interface/ISalaryRecordDao.h"
 #include "interface/ILoginDao.h"
+#include "interface/ISequenceDao.h"
+#include "interface/ITransactionManager.h"
+#include "interface/IFinanceReportDao.h"
+#include "interface/IPayrollDao.h"
+#include "interface/ITuitionRateDao.h"
+#include "interface/ITuitionDao.h"
+#include "interface/IInstallmentDao.h"
+#include "interface/IWaitlistDao.h"
+#include "interface/IPrerequisiteDao.h"
+#include "interface/IExamScheduleDao.h"
+#include "interface/IDegreeRequirementDao.h"
+#include "interface/IAttendanceDao.h"
+#include "interface/ITermDao.h"
+#include "interface/IStudentArchiveDao.h"
 
 // Interface cho DB Adapter
 #include "../database_adapter/interface/IDatabaseAdapter.h"
@@ -49,6 +63,21 @@
 #include "../parsing/impl_sql_parser/FeeRecordSqlParser.h"
 #include "../parsing/impl_sql_parser/SalaryRecordSqlParser.h"
 
+// Các Parser CSV cụ thể
+#include "../parsing/impl_csv_parser/StudentCsvParser.h"
+#include "../parsing/impl_csv_parser/TeacherCsvParser.h"
+#include "../parsing/impl_csv_parser/FacultyCsvParser.h"
+#include "../parsing/impl_csv_parser/CourseCsvParser.h"
+#include "../parsing/impl_csv_parser/LoginCredentialsCsvParser.h"
+#include "../parsing/impl_csv_parser/EnrollmentRecordCsvParser.h"
+#include "../parsing/impl_csv_parser/CourseResultCsvParser.h"
+#include "../parsing/impl_csv_parser/FeeRecordCsvParser.h"
+#include "../parsing/impl_csv_parser/SalaryRecordCsvParser.h"
+
+// Bảng CSV dùng chung cho các CSV DAO
+#include "csv/CsvTable.h"
+#include "csv/CsvDaoUtils.h"
+
 // Các Mock DAO (➕)
 #include "mock/MockStudentDao.h"
 #include "mock/MockTeacherDao.h"
@@ -59,15 +88,28 @@
 #include "mock/MockCourseResultDao.h"
 #include "mock/MockFeeRecordDao.h"
 #include "mock/MockSalaryRecordDao.h"
+#include "mock/MockSequenceDao.h"
+#include "mock/MockPayrollDao.h"
+#include "mock/MockTuitionRateDao.h"
+#include "mock/MockInstallmentDao.h"
+#include "mock/MockWaitlistDao.h"
+#include "mock/MockPrerequisiteDao.h"
+#include "mock/MockExamScheduleDao.h"
+#include "mock/MockDegreeRequirementDao.h"
+#include "mock/MockAttendanceDao.h"
+#include "mock/MockTermDao.h"
+#include "mock/MockStudentArchiveDao.h"
 
 // File Handler không cần thiết cho DaoFactory tạo SQL DAO hoặc Mock DAO nữa.
 
+class SqlShardRouter;
+
 /**
  * @class DaoFactory
  * @brief Lớp factory tạo các đối tượng DAO (Data Access Object)
  * 
  * Lớp này cung cấp các phương thức tĩnh để tạo các đối tượng DAO
- * tương ứng với loại nguồn dữ liệu được cấu hình (SQL, Mock).
+ * tương ứng với loại nguồn dữ liệu được cấu hình (SQL, CSV, Mock).
  */
 class DaoFactory {
 private:
@@ -86,6 +128,41 @@ private:
     static std::shared_ptr<IEntityParser<SalaryRecord, DbQueryResultRow>> _salaryRecordSqlParserInstance; ///< Parser instance cho SalaryRecord
     static std::mutex _parserMutex; ///< Mutex để đảm bảo thread-safety khi truy cập parsers
 
+    static std::shared_ptr<SqlShardRouter> _shardRouterInstance; ///< Bộ định tuyến shard theo khoa (chỉ khi cấu hình SqlShardDirectory)
+    static std::mutex _shardRouterMutex; ///< Mutex để đảm bảo thread-safety khi truy cập bộ định tuyến shard
+
+    // Mỗi loại thực thể dùng một CsvTable duy nhất để mọi DAO thấy cùng dữ liệu và chỉ mục
+    static std::map<EntityType, std::shared_ptr<CsvTable>> _csvTables; ///< Các bảng CSV đã nạp
+    static std::mutex _csvTableMutex; ///< Mutex để đảm bảo thread-safety khi truy cập các bảng CSV
+    static std::map<std::string, std::shared_ptr<CsvTable>> _csvAuxiliaryTables; ///< Các bảng CSV không gắn với thực thể (bộ đếm, sổ cái), theo tên file
+
+    /**
+     * @brief Lấy hoặc nạp bảng CSV của một loại thực thể
+     * @param config Cấu hình ứng dụng (đường dẫn file, ngưỡng compaction)
+     * @param entityType Loại thực thể
+     * @return Con trỏ thông minh đến bảng đã nạp
+     * @throws std::runtime_error nếu không thể nạp file CSV
+     */
+    static std::shared_ptr<CsvTable> getCsvTable(const AppConfig& config, EntityType entityType);
+
+    /**
+     * @brief Lấy hoặc nạp một bảng CSV không gắn với thực thể (ví dụ sequences.csv) trong thư mục dữ liệu CSV
+     * @param config Cấu hình ứng dụng
+     * @param fileName Tên file trong thư mục dữ liệu CSV
+     * @param schema Bố cục cột của file
+     * @return Con trỏ thông minh đến bảng đã nạp
+     * @throws std::runtime_error nếu không thể nạp file CSV
+     */
+    static std::shared_ptr<CsvTable> getCsvAuxiliaryTable(const AppConfig& config, const std::string& fileName, const CsvTableSchema& schema);
+
+    /**
+     * @brief Liệt kê các bảng CSV phụ thuộc bị xóa theo khi xóa một dòng cha (tương đương ON DELETE CASCADE của SQL)
+     * @param config Cấu hình ứng dụng
+     * @param entityType Loại thực thể cha (STUDENT, TEACHER hoặc COURSE)
+     * @return Các bảng phụ thuộc và cột chứa khóa của dòng cha
+     */
+    static std::vector<CsvCascade> getCsvCascades(const AppConfig& config, EntityType entityType);
+
 
     /**
      * @brief Lấy hoặc tạo mới database adapter
@@ -94,6 +171,20 @@ private:
      */
     static std::shared_ptr<IDatabaseAdapter> getDatabaseAdapter(const AppConfig& config);
 
+    /**
+     * @brief Kiểm tra nguồn SQL có được phân vùng theo khoa thành nhiều file hay không
+     * @param config Cấu hình ứng dụng
+     * @return true nếu nguồn là SQL và SqlShardDirectory không rỗng
+     */
+    static bool isSqlSharded(const AppConfig& config);
+
+    /**
+     * @brief Lấy hoặc tạo mới bộ định tuyến shard theo khoa
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ thông minh đến bộ định tuyến dùng chung database adapter chính
+     */
+    static std::shared_ptr<SqlShardRouter> getShardRouter(const AppConfig& config);
+
     /**
      * @brief Lấy hoặc tạo mới parser cho một entity
      * @tparam TEntity Kiểu dữ liệu của entity
@@ -220,6 +311,105 @@ public:
      */
     static std::shared_ptr<ILoginDao> createLoginDao(const AppConfig& config);
 
+    /**
+     * @brief Tạo đối tượng DAO cho bộ đếm số thứ tự
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của bộ đếm số thứ tự
+     */
+    static std::shared_ptr<ISequenceDao> createSequenceDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo bộ quản lý transaction dùng chung cho các DAO của nguồn dữ liệu
+     * @param config Cấu hình ứng dụng
+     * @return Bộ quản lý transaction trên database adapter dùng chung (SQL), hoặc bộ quản lý rỗng (CSV, Mock).
+     *         Khi phân vùng theo khoa, transaction không bao các file shard nên UnitOfWork chạy thêm thao tác bù trừ
+     */
+    static std::shared_ptr<ITransactionManager> createTransactionManager(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho số liệu tổng hợp tài chính
+     * @param config Cấu hình ứng dụng
+     * @return DAO dùng truy vấn GROUP BY (SQL), hoặc DAO duyệt tuần tự qua các DAO khác (CSV, Mock)
+     */
+    static std::shared_ptr<IFinanceReportDao> createFinanceReportDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho lịch sử trả lương hàng tháng
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của lịch sử trả lương
+     */
+    static std::shared_ptr<IPayrollDao> createPayrollDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho bảng đơn giá học phí theo tín chỉ
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của bảng đơn giá
+     */
+    static std::shared_ptr<ITuitionRateDao> createTuitionRateDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO tính học phí theo tín chỉ
+     * @param config Cấu hình ứng dụng
+     * @return DAO dùng một truy vấn nối bảng (SQL), hoặc DAO duyệt tuần tự qua các DAO khác (CSV, Mock)
+     */
+    static std::shared_ptr<ITuitionDao> createTuitionDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho lịch trả góp học phí
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của lịch trả góp
+     */
+    static std::shared_ptr<IInstallmentDao> createInstallmentDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho danh sách chờ của các khóa học
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của danh sách chờ
+     */
+    static std::shared_ptr<IWaitlistDao> createWaitlistDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho quan hệ môn tiên quyết
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của môn tiên quyết
+     */
+    static std::shared_ptr<IPrerequisiteDao> createPrerequisiteDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho lịch thi
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của lịch thi
+     */
+    static std::shared_ptr<IExamScheduleDao> createExamScheduleDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho điều kiện tốt nghiệp của các khoa
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của điều kiện tốt nghiệp
+     */
+    static std::shared_ptr<IDegreeRequirementDao> createDegreeRequirementDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho điểm danh
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của điểm danh
+     */
+    static std::shared_ptr<IAttendanceDao> createAttendanceDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho học kỳ
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của học kỳ
+     */
+    static std::shared_ptr<ITermDao> createTermDao(const AppConfig& config);
+
+    /**
+     * @brief Tạo đối tượng DAO cho kho lưu trữ sinh viên
+     * @param config Cấu hình ứng dụng
+     * @return Con trỏ đến đối tượng DAO của kho lưu trữ (không có kho lưu trữ với nguồn CSV hoặc SQL phân vùng theo khoa)
+     */
+    static std::shared_ptr<IStudentArchiveDao> createStudentArchiveDao(const AppConfig& config);
+
     /**
      * @brief Giải phóng tài nguyên tĩnh
      * 
@@ -0,0 +1,17 @@
+#include "NullStudentArchiveDao.h"
+
+bool NullStudentArchiveDao::isAvailable() const {
+    return false;
+}
+
+std::expected<std::vector<std::string>, Error> NullStudentArchiveDao::findDisabledStudentIds(const std::string&, std::size_t) const {
+    return std::vector<std::string>{};
+}
+
+std::expected<std::size_t, Error> NullStudentArchiveDao::archiveStudents(const std::vector<std::string>&) {
+    return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Archiving students requires the SQL data source with an archive database."});
+}
+
+std::expected<bool, Error> NullStudentArchiveDao::isArchived(const std::string&) const {
+    return false;
+}
@@ -0,0 +1,25 @@
+/**
+ * @file NullStudentArchiveDao.h
+ * @brief Kho lưu trữ rỗng cho các nguồn dữ liệu không hỗ trợ ATTACH cơ sở dữ liệu lưu trữ
+ */
+#ifndef NULLSTUDENTARCHIVEDAO_H
+#define NULLSTUDENTARCHIVEDAO_H
+
+#include "interface/IStudentArchiveDao.h"
+
+/**
+ * @class NullStudentArchiveDao
+ * @brief Không có kho lưu trữ; dùng cho nguồn dữ liệu CSV
+ *
+ * Không tìm thấy sinh viên nào cần lưu trữ và từ chối mọi yêu cầu chuyển sinh viên.
+ */
+class NullStudentArchiveDao : public IStudentArchiveDao {
+public:
+    bool isAvailable() const override;
+    std::expected<std::vector<std::string>, Error> findDisabledStudentIds(const std::string& disabledOnOrBefore,
+                                                                          std::size_t limit) const override;
+    std::expected<std::size_t, Error> archiveStudents(const std::vector<std::string>& studentIds) override;
+    std::expected<bool, Error> isArchived(const std::string& studentId) const override;
+};
+
+#endif // NULLSTUDENTARCHIVEDAO_H
@@ -0,0 +1,17 @@
+#include "NullTransactionManager.h"
+
+std::expected<bool, Error> NullTransactionManager::begin() {
+    return true;
+}
+
+std::expected<bool, Error> NullTransactionManager::commit() {
+    return true;
+}
+
+std::expected<bool, Error> NullTransactionManager::rollback() {
+    return true;
+}
+
+bool NullTransactionManager::isTransactional() const {
+    return false;
+}
@@ -0,0 +1,25 @@
+/**
+ * @file NullTransactionManager.h
+ * @brief Bộ quản lý transaction rỗng cho các nguồn dữ liệu không hỗ trợ transaction
+ */
+#ifndef NULLTRANSACTIONMANAGER_H
+#define NULLTRANSACTIONMANAGER_H
+
+#include "interface/ITransactionManager.h"
+
+/**
+ * @class NullTransactionManager
+ * @brief Không làm gì khi begin/commit/rollback; dùng cho nguồn dữ liệu CSV và Mock
+ *
+ * Mỗi lời gọi DAO trên các nguồn này được ghi ngay, nên UnitOfWork sẽ chạy các thao tác
+ * bù trừ đã đăng ký thay cho rollback.
+ */
+class NullTransactionManager : public ITransactionManager {
+public:
+    std::expected<bool, Error> begin() override;
+    std::expected<bool, Error> commit() override;
+    std::expected<bool, Error> rollback() override;
+    bool isTransactional() const override;
+};
+
+#endif // NULLTRANSACTIONMANAGER_H
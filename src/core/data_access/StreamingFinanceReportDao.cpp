@@ -0,0 +1,86 @@
+#include "StreamingFinanceReportDao.h"
+#include <cctype>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    // Giống điều kiện GLOB '[0-9][0-9]' của SqlFinanceReportDao
+    std::string cohortOf(const std::string& studentId) {
+        if (studentId.size() >= 2 && std::isdigit(static_cast<unsigned char>(studentId[0])) &&
+            std::isdigit(static_cast<unsigned char>(studentId[1]))) {
+            return studentId.substr(0, 2);
+        }
+        return "";
+    }
+}
+
+StreamingFinanceReportDao::StreamingFinanceReportDao(std::shared_ptr<IFeeRecordDao> feeDao,
+                                                     std::shared_ptr<ISalaryRecordDao> salaryDao,
+                                                     std::shared_ptr<IStudentDao> studentDao,
+                                                     std::shared_ptr<ITeacherDao> teacherDao)
+    : _feeDao(std::move(feeDao)),
+      _salaryDao(std::move(salaryDao)),
+      _studentDao(std::move(studentDao)),
+      _teacherDao(std::move(teacherDao)) {
+    if (!_feeDao || !_salaryDao || !_studentDao || !_teacherDao) {
+        throw std::invalid_argument("One or more DAO is null for StreamingFinanceReportDao.");
+    }
+}
+
+std::expected<std::vector<FacultyFeeSummary>, Error> StreamingFinanceReportDao::sumFeesByFacultyAndCohort() const {
+    std::unordered_map<std::string, std::string> facultyOfStudent;
+    auto studentScan = _studentDao->forEach([&facultyOfStudent](const Student& student) {
+        facultyOfStudent.emplace(student.getId(), student.getFacultyId());
+        return true;
+    });
+    if (!studentScan.has_value()) return std::unexpected(studentScan.error());
+
+    std::map<std::pair<std::string, std::string>, FacultyFeeSummary> totals;
+    auto feeScan = _feeDao->forEach([&](const FeeRecord& record) {
+        auto faculty = facultyOfStudent.find(record.getStudentId());
+        std::pair<std::string, std::string> key{faculty != facultyOfStudent.end() ? faculty->second : "", cohortOf(record.getStudentId())};
+        FacultyFeeSummary& summary = totals[key];
+        summary.studentCount++;
+        summary.totalBilled += record.getTotalFee();
+        summary.totalPaid += record.getPaidFee();
+        return true;
+    });
+    if (!feeScan.has_value()) return std::unexpected(feeScan.error());
+
+    std::vector<FacultyFeeSummary> summaries;
+    summaries.reserve(totals.size());
+    for (auto& [key, summary] : totals) {
+        summary.facultyId = key.first;
+        summary.cohort = key.second;
+        summaries.push_back(std::move(summary));
+    }
+    return summaries;
+}
+
+std::expected<std::vector<FacultyPayrollSummary>, Error> StreamingFinanceReportDao::sumPayrollByFaculty() const {
+    std::unordered_map<std::string, std::string> facultyOfTeacher;
+    auto teacherScan = _teacherDao->forEach([&facultyOfTeacher](const Teacher& teacher) {
+        facultyOfTeacher.emplace(teacher.getId(), teacher.getFacultyId());
+        return true;
+    });
+    if (!teacherScan.has_value()) return std::unexpected(teacherScan.error());
+
+    std::map<std::string, FacultyPayrollSummary> totals;
+    auto salaryScan = _salaryDao->forEach([&](const SalaryRecord& record) {
+        auto faculty = facultyOfTeacher.find(record.getTeacherId());
+        FacultyPayrollSummary& summary = totals[faculty != facultyOfTeacher.end() ? faculty->second : ""];
+        summary.teacherCount++;
+        summary.totalMonthlyPay += record.getBasicMonthlyPay();
+        return true;
+    });
+    if (!salaryScan.has_value()) return std::unexpected(salaryScan.error());
+
+    std::vector<FacultyPayrollSummary> summaries;
+    summaries.reserve(totals.size());
+    for (auto& [facultyId, summary] : totals) {
+        summary.facultyId = facultyId;
+        summaries.push_back(std::move(summary));
+    }
+    return summaries;
+}
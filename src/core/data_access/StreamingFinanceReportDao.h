@@ -0,0 +1,45 @@
+/**
+ * @file StreamingFinanceReportDao.h
+ * @brief Tính số liệu tổng hợp tài chính bằng cách duyệt tuần tự qua các DAO (cho nguồn CSV và Mock)
+ */
+#ifndef STREAMINGFINANCEREPORTDAO_H
+#define STREAMINGFINANCEREPORTDAO_H
+
+#include <memory>
+#include "interface/IFinanceReportDao.h"
+#include "interface/IFeeRecordDao.h"
+#include "interface/ISalaryRecordDao.h"
+#include "interface/IStudentDao.h"
+#include "interface/ITeacherDao.h"
+
+/**
+ * @class StreamingFinanceReportDao
+ * @brief Triển khai IFinanceReportDao cho nguồn dữ liệu không có truy vấn GROUP BY
+ *
+ * Mỗi báo cáo duyệt bảng người dùng một lần để lập chỉ mục mã -> khoa, rồi duyệt bảng
+ * học phí (hoặc lương) một lần để cộng dồn; không lấy toàn bộ bảng vào bộ nhớ.
+ */
+class StreamingFinanceReportDao : public IFinanceReportDao {
+private:
+    std::shared_ptr<IFeeRecordDao> _feeDao;       ///< Đối tượng dao để duyệt hồ sơ học phí
+    std::shared_ptr<ISalaryRecordDao> _salaryDao; ///< Đối tượng dao để duyệt hồ sơ lương
+    std::shared_ptr<IStudentDao> _studentDao;     ///< Đối tượng dao để lấy khoa của sinh viên
+    std::shared_ptr<ITeacherDao> _teacherDao;     ///< Đối tượng dao để lấy khoa của giảng viên
+
+public:
+    /**
+     * @brief Hàm khởi tạo StreamingFinanceReportDao
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    StreamingFinanceReportDao(std::shared_ptr<IFeeRecordDao> feeDao,
+                              std::shared_ptr<ISalaryRecordDao> salaryDao,
+                              std::shared_ptr<IStudentDao> studentDao,
+                              std::shared_ptr<ITeacherDao> teacherDao);
+
+    ~StreamingFinanceReportDao() override = default;
+
+    std::expected<std::vector<FacultyFeeSummary>, Error> sumFeesByFacultyAndCohort() const override;
+    std::expected<std::vector<FacultyPayrollSummary>, Error> sumPayrollByFaculty() const override;
+};
+
+#endif // STREAMINGFINANCEREPORTDAO_H
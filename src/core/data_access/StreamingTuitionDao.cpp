@@ -0,0 +1,83 @@
+#include "StreamingTuitionDao.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+StreamingTuitionDao::StreamingTuitionDao(std::shared_ptr<ITuitionRateDao> rateDao,
+                                         std::shared_ptr<IStudentDao> studentDao,
+                                         std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                                         std::shared_ptr<ICourseDao> courseDao,
+                                         std::shared_ptr<IFeeRecordDao> feeDao)
+    : _rateDao(std::move(rateDao)),
+      _studentDao(std::move(studentDao)),
+      _enrollmentDao(std::move(enrollmentDao)),
+      _courseDao(std::move(courseDao)),
+      _feeDao(std::move(feeDao)) {
+    if (!_rateDao || !_studentDao || !_enrollmentDao || !_courseDao || !_feeDao) {
+        throw std::invalid_argument("One or more DAO is null for StreamingTuitionDao.");
+    }
+}
+
+std::expected<TuitionAssessment, Error> StreamingTuitionDao::assessTuition(const std::string& termId) const {
+    auto rateList = _rateDao->getAll();
+    if (!rateList.has_value()) return std::unexpected(rateList.error());
+    std::unordered_map<std::string, long> rateOfFaculty;
+    for (const auto& rate : rateList.value()) rateOfFaculty.emplace(rate.facultyId, rate.ratePerCredit);
+
+    std::unordered_map<std::string, long> creditsOfCourse;
+    auto courseScan = _courseDao->forEach([&creditsOfCourse](const Course& course) {
+        creditsOfCourse.emplace(course.getId(), course.getCredits());
+        return true;
+    });
+    if (!courseScan.has_value()) return std::unexpected(courseScan.error());
+
+    // Giống phép JOIN Courses của SqlTuitionDao: lượt đăng ký vào khóa học không tồn tại bị bỏ qua
+    std::unordered_map<std::string, long> creditsOfStudent;
+    auto enrollmentScan = _enrollmentDao->forEachEnrollment([&](const EnrollmentRecord& enrollment) {
+        if (!termId.empty() && !enrollment.termId.empty() && enrollment.termId != termId) return true;
+        auto course = creditsOfCourse.find(enrollment.courseId);
+        if (course != creditsOfCourse.end()) creditsOfStudent[enrollment.studentId] += course->second;
+        return true;
+    });
+    if (!enrollmentScan.has_value()) return std::unexpected(enrollmentScan.error());
+
+    std::unordered_map<std::string, std::pair<long, long>> feeOfStudent; // studentId -> (totalFee, paidFee)
+    auto feeScan = _feeDao->forEach([&feeOfStudent](const FeeRecord& record) {
+        feeOfStudent.emplace(record.getStudentId(), std::make_pair(record.getTotalFee(), record.getPaidFee()));
+        return true;
+    });
+    if (!feeScan.has_value()) return std::unexpected(feeScan.error());
+
+    TuitionAssessment assessment;
+    auto studentScan = _studentDao->forEach([&](const Student& student) {
+        ++assessment.studentCount;
+        auto rate = rateOfFaculty.find(student.getFacultyId());
+        if (rate == rateOfFaculty.end()) {
+            ++assessment.unratedCount;
+            return true;
+        }
+        TuitionChange change;
+        change.studentId = student.getId();
+        change.facultyId = student.getFacultyId();
+        auto credits = creditsOfStudent.find(student.getId());
+        change.credits = credits != creditsOfStudent.end() ? credits->second : 0;
+        change.newTotalFee = change.credits * rate->second;
+
+        auto fee = feeOfStudent.find(student.getId());
+        if (fee == feeOfStudent.end()) {
+            if (change.newTotalFee == 0) return true;
+        } else {
+            if (fee->second.first == change.newTotalFee) return true;
+            change.previousTotalFee = fee->second.first;
+            change.paidFee = fee->second.second;
+        }
+        assessment.changes.push_back(std::move(change));
+        return true;
+    });
+    if (!studentScan.has_value()) return std::unexpected(studentScan.error());
+
+    std::sort(assessment.changes.begin(), assessment.changes.end(), [](const TuitionChange& a, const TuitionChange& b) {
+        return a.studentId < b.studentId;
+    });
+    return assessment;
+}
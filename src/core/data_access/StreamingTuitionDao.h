@@ -0,0 +1,47 @@
+/**
+ * @file StreamingTuitionDao.h
+ * @brief Tính học phí theo tín chỉ bằng cách duyệt tuần tự qua các DAO (cho nguồn CSV và Mock)
+ */
+#ifndef STREAMINGTUITIONDAO_H
+#define STREAMINGTUITIONDAO_H
+
+#include <memory>
+#include "interface/ITuitionDao.h"
+#include "interface/ITuitionRateDao.h"
+#include "interface/IStudentDao.h"
+#include "interface/IEnrollmentDao.h"
+#include "interface/ICourseDao.h"
+#include "interface/IFeeRecordDao.h"
+
+/**
+ * @class StreamingTuitionDao
+ * @brief Triển khai ITuitionDao cho nguồn dữ liệu không có phép nối bảng
+ *
+ * Mỗi bảng (khóa học, đăng ký, học phí, sinh viên) được duyệt đúng một lần; chỉ giữ trong bộ nhớ
+ * các ánh xạ mã -> tín chỉ / tổng tín chỉ / học phí cần cho phép so sánh.
+ */
+class StreamingTuitionDao : public ITuitionDao {
+private:
+    std::shared_ptr<ITuitionRateDao> _rateDao;        ///< Đối tượng dao để lấy đơn giá tín chỉ
+    std::shared_ptr<IStudentDao> _studentDao;         ///< Đối tượng dao để duyệt sinh viên
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;   ///< Đối tượng dao để duyệt các lượt đăng ký
+    std::shared_ptr<ICourseDao> _courseDao;           ///< Đối tượng dao để lấy số tín chỉ của khóa học
+    std::shared_ptr<IFeeRecordDao> _feeDao;           ///< Đối tượng dao để lấy học phí đang lưu
+
+public:
+    /**
+     * @brief Hàm khởi tạo StreamingTuitionDao
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    StreamingTuitionDao(std::shared_ptr<ITuitionRateDao> rateDao,
+                        std::shared_ptr<IStudentDao> studentDao,
+                        std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                        std::shared_ptr<ICourseDao> courseDao,
+                        std::shared_ptr<IFeeRecordDao> feeDao);
+
+    ~StreamingTuitionDao() override = default;
+
+    std::expected<TuitionAssessment, Error> assessTuition(const std::string& termId) const override;
+};
+
+#endif // STREAMINGTUITIONDAO_H
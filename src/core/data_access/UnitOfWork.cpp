@@ -0,0 +1,63 @@
+#include "UnitOfWork.h"
+#include "../../utils/Logger.h"
+#include <stdexcept>
+
+UnitOfWork::UnitOfWork(std::shared_ptr<ITransactionManager> manager) : _manager(std::move(manager)) {}
+
+std::expected<UnitOfWork, Error> UnitOfWork::begin(std::shared_ptr<ITransactionManager> manager) {
+    if (!manager) {
+        throw std::invalid_argument("TransactionManager cannot be null for UnitOfWork.");
+    }
+    auto started = manager->begin();
+    if (!started.has_value()) return std::unexpected(started.error());
+    UnitOfWork unit(std::move(manager));
+    unit._active = true;
+    return unit;
+}
+
+UnitOfWork::UnitOfWork(UnitOfWork&& other) noexcept
+    : _manager(std::move(other._manager)),
+      _active(other._active),
+      _compensations(std::move(other._compensations)) {
+    other._active = false;
+}
+
+UnitOfWork::~UnitOfWork() {
+    if (_active) {
+        auto rolledBack = rollback();
+        if (!rolledBack.has_value()) {
+            LOG_ERROR("UnitOfWork: Rollback on scope exit failed: " + rolledBack.error().message);
+        }
+    }
+}
+
+void UnitOfWork::addCompensation(std::function<void()> compensation) {
+    if (!_manager->isTransactional()) {
+        _compensations.push_back(std::move(compensation));
+    }
+}
+
+std::expected<bool, Error> UnitOfWork::commit() {
+    if (!_active) {
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Unit of work is not active."});
+    }
+    auto committed = _manager->commit();
+    if (!committed.has_value()) return std::unexpected(committed.error());
+    _active = false;
+    _compensations.clear();
+    return true;
+}
+
+std::expected<bool, Error> UnitOfWork::rollback() {
+    if (!_active) return true;
+    _active = false;
+    for (auto it = _compensations.rbegin(); it != _compensations.rend(); ++it) {
+        (*it)();
+    }
+    _compensations.clear();
+    return _manager->rollback();
+}
+
+bool UnitOfWork::isActive() const {
+    return _active;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file UnitOfWork.h
+ * @brief Định nghĩa phạm vi transaction bao quanh nhiều lời gọi DAO
+ *
+ * Ví dụ: thêm sinh viên, thông tin đăng nhập và học phí trong một transaction duy nhất,
+ * thay vì ba transaction riêng và rollback thủ công bằng remove.
+ */
+#ifndef UNITOFWORK_H
+#define UNITOFWORK_H
+
+#include <memory>
+#include <vector>
+#include <functional>
+#include <expected>
+#include "interface/ITransactionManager.h"
+
+/**
+ * @class UnitOfWork
+ * @brief Phạm vi transaction theo RAII trên ITransactionManager
+ *
+ * Transaction được mở bởi begin() và phải được commit() rõ ràng; nếu đối tượng bị hủy
+ * khi chưa commit (return sớm vì lỗi), transaction được rollback. Các DAO mở transaction
+ * riêng bên trong phạm vi này sẽ nhận savepoint, nên chỉ có một lần commit xuống đĩa.
+ *
+ * Với nguồn dữ liệu không hỗ trợ transaction, rollback chạy các thao tác bù trừ đã
+ * đăng ký bằng addCompensation() theo thứ tự ngược lại.
+ */
+class UnitOfWork {
+private:
+    std::shared_ptr<ITransactionManager> _manager;     ///< Bộ quản lý transaction của nguồn dữ liệu
+    bool _active = false;                              ///< Transaction đang mở (chưa commit/rollback)
+    std::vector<std::function<void()>> _compensations; ///< Thao tác bù trừ cho nguồn không hỗ trợ transaction
+
+    explicit UnitOfWork(std::shared_ptr<ITransactionManager> manager);
+
+public:
+    /**
+     * @brief Mở một phạm vi transaction
+     * @param manager Bộ quản lý transaction (xem DaoFactory::createTransactionManager)
+     * @return Phạm vi đã mở, hoặc Error nếu không thể mở transaction
+     */
+    static std::expected<UnitOfWork, Error> begin(std::shared_ptr<ITransactionManager> manager);
+
+    UnitOfWork(UnitOfWork&& other) noexcept;
+    UnitOfWork& operator=(UnitOfWork&&) = delete;
+    UnitOfWork(const UnitOfWork&) = delete;
+    UnitOfWork& operator=(const UnitOfWork&) = delete;
+
+    /**
+     * @brief Rollback nếu transaction vẫn còn mở
+     */
+    ~UnitOfWork();
+
+    /**
+     * @brief Đăng ký thao tác hoàn tác một lần ghi (chỉ chạy khi nguồn dữ liệu không hỗ trợ transaction)
+     * @param compensation Thao tác hoàn tác, ví dụ xóa bản ghi vừa thêm
+     */
+    void addCompensation(std::function<void()> compensation);
+
+    /**
+     * @brief Xác nhận toàn bộ thay đổi trong phạm vi
+     * @return true nếu thành công, hoặc Error (transaction vẫn mở và sẽ bị rollback khi hủy)
+     */
+    std::expected<bool, Error> commit();
+
+    /**
+     * @brief Hủy toàn bộ thay đổi trong phạm vi
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    std::expected<bool, Error> rollback();
+
+    /**
+     * @brief Transaction còn mở hay không
+     */
+    bool isActive() const;
+};
+
+#endif // UNITOFWORK_H
@@ -0,0 +1,120 @@
+#include "CsvAttendanceDao.h"
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+namespace {
+    constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+    std::expected<int, Error> parseInt(const CsvTable::Row& row, std::size_t column) {
+        int value = 0;
+        const std::string& text = row[column];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid number '" + text + "' in attendance of course '" + row[0] + "'."});
+        }
+        return value;
+    }
+
+    std::string toHex(const std::vector<unsigned char>& bytes) {
+        std::string text;
+        text.reserve(bytes.size() * 2);
+        for (unsigned char byte : bytes) {
+            text.push_back(HEX_DIGITS[byte >> 4]);
+            text.push_back(HEX_DIGITS[byte & 0x0F]);
+        }
+        return text;
+    }
+
+    std::expected<std::vector<unsigned char>, Error> fromHex(const std::string& text) {
+        if (text.size() % 2 != 0) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Attendance bitmap has an odd number of hex digits."});
+        }
+        std::vector<unsigned char> bytes(text.size() / 2);
+        for (std::size_t i = 0; i < bytes.size(); ++i) {
+            auto [end, ec] = std::from_chars(text.data() + 2 * i, text.data() + 2 * i + 2, bytes[i], 16);
+            if (ec != std::errc() || end != text.data() + 2 * i + 2) {
+                return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid hex digits in attendance bitmap."});
+            }
+        }
+        return bytes;
+    }
+
+    std::expected<AttendanceSession, Error> parseSession(const CsvTable::Row& row) {
+        auto sessionNo = parseInt(row, CsvAttendanceDao::SESSION_NO);
+        if (!sessionNo) return std::unexpected(sessionNo.error());
+        auto presence = fromHex(row[CsvAttendanceDao::SESSION_PRESENCE]);
+        if (!presence) return std::unexpected(presence.error());
+        return AttendanceSession{row[CsvAttendanceDao::SESSION_COURSE_ID], sessionNo.value(), std::move(presence.value())};
+    }
+}
+
+CsvTableSchema CsvAttendanceDao::rosterSchema() {
+    return {{"courseId", "slot", "studentId"}, {ROSTER_COURSE_ID, ROSTER_SLOT}, {ROSTER_COURSE_ID}};
+}
+
+CsvTableSchema CsvAttendanceDao::sessionSchema() {
+    return {{"courseId", "sessionNo", "presence"}, {SESSION_COURSE_ID, SESSION_NO}, {SESSION_COURSE_ID}};
+}
+
+CsvAttendanceDao::CsvAttendanceDao(std::shared_ptr<CsvTable> rosterTable, std::shared_ptr<CsvTable> sessionTable)
+    : _rosterTable(std::move(rosterTable)), _sessionTable(std::move(sessionTable)) {
+    if (!_rosterTable || !_sessionTable) {
+        throw std::invalid_argument("CsvAttendanceDao: tables cannot be null.");
+    }
+}
+
+std::expected<std::vector<std::string>, Error> CsvAttendanceDao::getRoster(const std::string& courseId) const {
+    std::vector<std::string> roster;
+    for (const auto& row : _rosterTable->findBy(ROSTER_COURSE_ID, courseId)) {
+        auto slot = parseInt(row, ROSTER_SLOT);
+        if (!slot) return std::unexpected(slot.error());
+        if (slot.value() < 0) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Negative attendance slot in course '" + courseId + "'."});
+        }
+        auto index = static_cast<std::size_t>(slot.value());
+        if (index >= roster.size()) roster.resize(index + 1);
+        roster[index] = row[ROSTER_STUDENT_ID];
+    }
+    return roster;
+}
+
+std::expected<bool, Error> CsvAttendanceDao::addToRoster(const std::string& courseId, int slot, const std::string& studentId) {
+    if (courseId.empty() || studentId.empty() || slot < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid attendance roster entry for student '" + studentId + "'."});
+    }
+    auto rows = _rosterTable->findBy(ROSTER_COURSE_ID, courseId);
+    bool listed = std::any_of(rows.begin(), rows.end(), [&](const CsvTable::Row& row) { return row[ROSTER_STUDENT_ID] == studentId; });
+    if (listed) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " is already on the attendance roster of course " + courseId + "."});
+    }
+    return _rosterTable->insert({courseId, std::to_string(slot), studentId});
+}
+
+std::expected<std::vector<AttendanceSession>, Error> CsvAttendanceDao::getSessions(const std::string& courseId) const {
+    std::vector<AttendanceSession> sessions;
+    for (const auto& row : _sessionTable->findBy(SESSION_COURSE_ID, courseId)) {
+        auto session = parseSession(row);
+        if (!session) return std::unexpected(session.error());
+        sessions.push_back(std::move(session.value()));
+    }
+    // Khóa chính là chuỗi nên "10" đứng trước "2"; sắp lại theo số buổi
+    std::sort(sessions.begin(), sessions.end(),
+              [](const AttendanceSession& a, const AttendanceSession& b) { return a.sessionNo < b.sessionNo; });
+    return sessions;
+}
+
+std::expected<AttendanceSession, Error> CsvAttendanceDao::findSession(const std::string& courseId, int sessionNo) const {
+    auto row = _sessionTable->find(CsvTable::compositeKey({courseId, std::to_string(sessionNo)}));
+    if (!row.has_value()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Attendance for session " + std::to_string(sessionNo) + " of course " + courseId + " not found."});
+    }
+    return parseSession(row.value());
+}
+
+std::expected<bool, Error> CsvAttendanceDao::saveSession(const AttendanceSession& session) {
+    if (session.courseId.empty() || session.sessionNo < 1) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid attendance session for course '" + session.courseId + "'."});
+    }
+    return _sessionTable->upsert({session.courseId, std::to_string(session.sessionNo), toHex(session.presence)});
+}
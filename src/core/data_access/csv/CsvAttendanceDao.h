@@ -0,0 +1,61 @@
+#ifndef CSVATTENDANCEDAO_H
+#define CSVATTENDANCEDAO_H
+
+/**
+ * @file CsvAttendanceDao.h
+ * @brief CSV implementation of the attendance data access object
+ */
+
+#include "../interface/IAttendanceDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvAttendanceDao
+ * @brief CSV implementation of IAttendanceDao on top of two shared CsvTables
+ *
+ * The roster table is keyed by (courseId, slot) and the session table by (courseId, sessionNo);
+ * both are indexed by course. Presence bitmaps are stored as lowercase hex text.
+ */
+class CsvAttendanceDao : public IAttendanceDao {
+private:
+    std::shared_ptr<CsvTable> _rosterTable;  ///< Loaded table holding one row per roster slot
+    std::shared_ptr<CsvTable> _sessionTable; ///< Loaded table holding one row per recorded session
+
+public:
+    static constexpr std::size_t ROSTER_COURSE_ID = 0;  ///< Roster column of the course ID (key, indexed)
+    static constexpr std::size_t ROSTER_SLOT = 1;       ///< Roster column of the slot (key)
+    static constexpr std::size_t ROSTER_STUDENT_ID = 2; ///< Roster column of the student ID
+
+    static constexpr std::size_t SESSION_COURSE_ID = 0;  ///< Session column of the course ID (key, indexed)
+    static constexpr std::size_t SESSION_NO = 1;         ///< Session column of the session number (key)
+    static constexpr std::size_t SESSION_PRESENCE = 2;   ///< Session column of the hex-encoded presence bitmap
+
+    /**
+     * @brief Column layout of the roster file
+     */
+    static CsvTableSchema rosterSchema();
+
+    /**
+     * @brief Column layout of the session file
+     */
+    static CsvTableSchema sessionSchema();
+
+    /**
+     * @brief Constructor for CsvAttendanceDao
+     * @param rosterTable Loaded CSV table (see CsvTable::load()) using rosterSchema()
+     * @param sessionTable Loaded CSV table using sessionSchema()
+     * @throws std::invalid_argument if a table is null
+     */
+    CsvAttendanceDao(std::shared_ptr<CsvTable> rosterTable, std::shared_ptr<CsvTable> sessionTable);
+
+    ~CsvAttendanceDao() override = default;
+
+    std::expected<std::vector<std::string>, Error> getRoster(const std::string& courseId) const override;
+    std::expected<bool, Error> addToRoster(const std::string& courseId, int slot, const std::string& studentId) override;
+    std::expected<std::vector<AttendanceSession>, Error> getSessions(const std::string& courseId) const override;
+    std::expected<AttendanceSession, Error> findSession(const std::string& courseId, int sessionNo) const override;
+    std::expected<bool, Error> saveSession(const AttendanceSession& session) override;
+};
+
+#endif // CSVATTENDANCEDAO_H
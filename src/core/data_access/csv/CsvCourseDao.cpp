@@ -0,0 +1,59 @@
+#include "CsvCourseDao.h"
+#include "CsvDaoUtils.h"
+#include "../../parsing/impl_csv_parser/CourseCsvParser.h"
+
+CsvCourseDao::CsvCourseDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Course, CsvRow>> parser,
+                           std::vector<CsvCascade> cascades)
+    : _table(std::move(table)), _parser(std::move(parser)), _cascades(std::move(cascades)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvCourseDao");
+}
+
+std::expected<Course, Error> CsvCourseDao::getById(const std::string& id) const {
+    auto row = _table->find(id);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course with ID " + id + " not found."});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<std::vector<Course>, Error> CsvCourseDao::getAll() const {
+    return CsvDaoUtils::parseRows(_table->all(), *_parser);
+}
+
+std::expected<std::size_t, Error> CsvCourseDao::forEach(const std::function<bool(const Course&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
+
+std::expected<Course, Error> CsvCourseDao::add(const Course& course) {
+    ValidationResult vr = course.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Course data for add: " + vr.getErrorMessagesCombined()});
+    }
+    auto row = _parser->serialize(course);
+    if (!row) return std::unexpected(row.error());
+    auto inserted = _table->insert(std::move(*row));
+    if (!inserted) return std::unexpected(inserted.error());
+    return course;
+}
+
+std::expected<bool, Error> CsvCourseDao::update(const Course& course) {
+    ValidationResult vr = course.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Course data for update: " + vr.getErrorMessagesCombined()});
+    }
+    auto row = _parser->serialize(course);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<bool, Error> CsvCourseDao::remove(const std::string& id) {
+    return CsvDaoUtils::eraseWithCascades(*_table, _cascades, id);
+}
+
+std::expected<bool, Error> CsvCourseDao::exists(const std::string& id) const {
+    return _table->contains(id);
+}
+
+std::expected<std::vector<Course>, Error> CsvCourseDao::findByFacultyId(const std::string& facultyId) const {
+    return CsvDaoUtils::parseRows(_table->findBy(CourseCsvParser::FACULTY_ID, facultyId), *_parser);
+}
@@ -0,0 +1,54 @@
+#ifndef CSVCOURSEDAO_H
+#define CSVCOURSEDAO_H
+
+/**
+ * @file CsvCourseDao.h
+ * @brief CSV implementation of the course data access object
+ */
+
+#include "../interface/ICourseDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include "CsvDaoUtils.h"
+#include <memory>
+
+/**
+ * @class CsvCourseDao
+ * @brief CSV implementation of ICourseDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvCourseDao : public ICourseDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the course rows
+    std::shared_ptr<IEntityParser<Course, CsvRow>> _parser; ///< Parser converting rows to Course objects
+    std::vector<CsvCascade> _cascades; ///< Tables whose rows referencing a removed course are deleted with it
+
+public:
+    /**
+     * @brief Constructor for CsvCourseDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to Course objects
+     * @param cascades Dependent tables cleaned up by remove(), as the SQL foreign keys do
+     * @throws std::invalid_argument if table or parser is null
+     */
+    CsvCourseDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Course, CsvRow>> parser,
+                 std::vector<CsvCascade> cascades = {});
+
+    ~CsvCourseDao() override = default;
+
+    std::expected<Course, Error> getById(const std::string& id) const override;
+    std::expected<std::vector<Course>, Error> getAll() const override;
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Course&)>& visitor) const override;
+    std::expected<Course, Error> add(const Course& course) override;
+    std::expected<bool, Error> update(const Course& course) override;
+    std::expected<bool, Error> remove(const std::string& id) override;
+    std::expected<bool, Error> exists(const std::string& id) const override;
+
+    /**
+     * @brief Finds courses of a faculty through the facultyId index
+     */
+    std::expected<std::vector<Course>, Error> findByFacultyId(const std::string& facultyId) const override;
+};
+
+#endif // CSVCOURSEDAO_H
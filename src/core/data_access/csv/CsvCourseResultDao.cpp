@@ -0,0 +1,91 @@
+#include "CsvCourseResultDao.h"
+#include "CsvDaoUtils.h"
+#include "../../parsing/impl_csv_parser/CourseResultCsvParser.h"
+
+CsvCourseResultDao::CsvCourseResultDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<CourseResult, CsvRow>> parser)
+    : _table(std::move(table)), _parser(std::move(parser)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvCourseResultDao");
+}
+
+std::expected<CourseResult, Error> CsvCourseResultDao::find(const std::string& studentId, const std::string& courseId) const {
+    auto row = _table->find(CsvTable::compositeKey({studentId, courseId}));
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "CourseResult not found for Student " + studentId + ", Course " + courseId});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<std::vector<CourseResult>, Error> CsvCourseResultDao::findByStudentId(const std::string& studentId) const {
+    return CsvDaoUtils::parseRows(_table->findBy(CourseResultCsvParser::STUDENT_ID, studentId), *_parser);
+}
+
+std::expected<std::vector<CourseResult>, Error> CsvCourseResultDao::findByCourseId(const std::string& courseId) const {
+    return CsvDaoUtils::parseRows(_table->findBy(CourseResultCsvParser::COURSE_ID, courseId), *_parser);
+}
+
+std::expected<std::vector<CourseResult>, Error> CsvCourseResultDao::findByTerm(const std::string& termId) const {
+    return CsvDaoUtils::parseRows(_table->findBy(CourseResultCsvParser::TERM_ID, termId), *_parser);
+}
+
+std::expected<std::vector<CourseResult>, Error> CsvCourseResultDao::findByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    auto rows = _table->findBy(CourseResultCsvParser::TERM_ID, termId);
+    std::erase_if(rows, [&](const CsvRow& row) { return row[CourseResultCsvParser::COURSE_ID] != courseId; });
+    return CsvDaoUtils::parseRows(std::move(rows), *_parser);
+}
+
+void CsvCourseResultDao::keepStoredTerm(CsvRow& row) const {
+    if (!row[CourseResultCsvParser::TERM_ID].empty()) return;
+    auto stored = _table->find(CsvTable::compositeKey({row[CourseResultCsvParser::STUDENT_ID], row[CourseResultCsvParser::COURSE_ID]}));
+    if (stored) row[CourseResultCsvParser::TERM_ID] = (*stored)[CourseResultCsvParser::TERM_ID];
+}
+
+std::expected<std::size_t, Error> CsvCourseResultDao::forEachResult(const std::function<bool(const CourseResult&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
+
+std::expected<bool, Error> CsvCourseResultDao::addOrUpdate(const CourseResult& result) {
+    ValidationResult vr = result.validate();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid CourseResult data: " + vr.getErrorMessagesCombined()});
+    }
+    auto row = _parser->serialize(result);
+    if (!row) return std::unexpected(row.error());
+    keepStoredTerm(*row);
+    return _table->upsert(std::move(*row));
+}
+
+std::expected<bool, Error> CsvCourseResultDao::addOrUpdateBatch(const std::vector<CourseResult>& results) {
+    std::vector<CsvRow> rows;
+    rows.reserve(results.size());
+    for (const auto& result : results) {
+        ValidationResult vr = result.validate();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid CourseResult data: " + vr.getErrorMessagesCombined()});
+        }
+        auto row = _parser->serialize(result);
+        if (!row) return std::unexpected(row.error());
+        keepStoredTerm(*row);
+        rows.push_back(std::move(*row));
+    }
+    return _table->upsertMany(std::move(rows));
+}
+
+std::expected<bool, Error> CsvCourseResultDao::remove(const std::string& studentId, const std::string& courseId) {
+    auto removed = _table->erase(CsvTable::compositeKey({studentId, courseId}));
+    if (!removed && removed.error().code == ErrorCode::NOT_FOUND) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "CourseResult not found for Student " + studentId + ", Course " + courseId + " to remove."});
+    }
+    return removed;
+}
+
+std::expected<bool, Error> CsvCourseResultDao::removeAllForStudent(const std::string& studentId) {
+    auto removed = _table->eraseBy(CourseResultCsvParser::STUDENT_ID, studentId);
+    if (!removed) return std::unexpected(removed.error());
+    return true;
+}
+
+std::expected<bool, Error> CsvCourseResultDao::removeAllForCourse(const std::string& courseId) {
+    auto removed = _table->eraseBy(CourseResultCsvParser::COURSE_ID, courseId);
+    if (!removed) return std::unexpected(removed.error());
+    return true;
+}
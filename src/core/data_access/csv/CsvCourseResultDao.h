@@ -0,0 +1,63 @@
+#ifndef CSVCOURSERESULTDAO_H
+#define CSVCOURSERESULTDAO_H
+
+/**
+ * @file CsvCourseResultDao.h
+ * @brief CSV implementation of the course result data access object
+ */
+
+#include "../interface/ICourseResultDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvCourseResultDao
+ * @brief CSV implementation of ICourseResultDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvCourseResultDao : public ICourseResultDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the course result rows
+    std::shared_ptr<IEntityParser<CourseResult, CsvRow>> _parser; ///< Parser converting rows to CourseResult objects
+
+    /**
+     * @brief Copies the stored term into a row written without one, so an upsert never clears the term
+     */
+    void keepStoredTerm(CsvRow& row) const;
+
+public:
+    /**
+     * @brief Constructor for CsvCourseResultDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to CourseResult objects
+     * @throws std::invalid_argument if table or parser is null
+     */
+    CsvCourseResultDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<CourseResult, CsvRow>> parser);
+
+    ~CsvCourseResultDao() override = default;
+
+    std::expected<CourseResult, Error> find(const std::string& studentId, const std::string& courseId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByStudentId(const std::string& studentId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByCourseId(const std::string& courseId) const override;
+
+    /**
+     * @brief Lists the results of a term through the termId index
+     */
+    std::expected<std::vector<CourseResult>, Error> findByTerm(const std::string& termId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
+    std::expected<std::size_t, Error> forEachResult(const std::function<bool(const CourseResult&)>& visitor) const override;
+    std::expected<bool, Error> addOrUpdate(const CourseResult& result) override;
+
+    /**
+     * @brief Validates every result, then writes them with a single journal append (all or nothing)
+     */
+    std::expected<bool, Error> addOrUpdateBatch(const std::vector<CourseResult>& results) override;
+
+    std::expected<bool, Error> remove(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> removeAllForStudent(const std::string& studentId) override;
+    std::expected<bool, Error> removeAllForCourse(const std::string& courseId) override;
+};
+
+#endif // CSVCOURSERESULTDAO_H
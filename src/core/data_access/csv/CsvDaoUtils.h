@@ -0,0 +1,97 @@
+#ifndef CSVDAOUTILS_H
+#define CSVDAOUTILS_H
+
+/**
+ * @file CsvDaoUtils.h
+ * @brief Helpers shared by the CSV data access objects
+ */
+
+#include <vector>
+#include <memory>
+#include <expected>
+#include <stdexcept>
+#include <string>
+#include <functional>
+#include <cstddef>
+#include "CsvTable.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "../../../utils/Logger.h"
+
+/**
+ * @struct CsvCascade
+ * @brief A dependent table whose rows are deleted with their parent row (the CSV counterpart of ON DELETE CASCADE)
+ */
+struct CsvCascade {
+    std::shared_ptr<CsvTable> table; ///< Dependent table
+    std::size_t column = 0;          ///< Column holding the parent key
+};
+
+namespace CsvDaoUtils {
+
+    /**
+     * @brief Parses table rows into entities, skipping (and logging) rows that fail to parse
+     */
+    template <typename TEntity>
+    std::vector<TEntity> parseRows(const std::vector<CsvRow>& rows, const IEntityParser<TEntity, CsvRow>& parser) {
+        std::vector<TEntity> entities;
+        entities.reserve(rows.size());
+        for (const auto& row : rows) {
+            auto entity = parser.parse(row);
+            if (entity.has_value()) {
+                entities.push_back(std::move(entity.value()));
+            } else {
+                LOG_WARN("CsvDao: Skipping unparsable row: " + entity.error().message);
+            }
+        }
+        return entities;
+    }
+
+    /**
+     * @brief Streams the table's rows through the parser into the visitor, skipping (and logging) unparsable rows
+     * @return Number of entities passed to the visitor
+     */
+    template <typename TEntity>
+    std::size_t streamRows(const CsvTable& table, const IEntityParser<TEntity, CsvRow>& parser,
+                           const std::function<bool(const TEntity&)>& visitor) {
+        std::size_t visited = 0;
+        table.forEachRow([&](const CsvRow& row) {
+            auto entity = parser.parse(row);
+            if (!entity.has_value()) {
+                LOG_WARN("CsvDao: Skipping unparsable row: " + entity.error().message);
+                return true;
+            }
+            ++visited;
+            return visitor(entity.value());
+        });
+        return visited;
+    }
+
+    /**
+     * @brief Deletes a parent row after the rows that reference it
+     *
+     * Dependents go first so that a failed delete can be retried: the parent still exists to be found again.
+     * @return true, NOT_FOUND if the parent does not exist, or the first journal error
+     */
+    inline std::expected<bool, Error> eraseWithCascades(CsvTable& table, const std::vector<CsvCascade>& cascades,
+                                                        const std::string& key) {
+        if (!table.contains(key)) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Record with key " + key + " not found in " + table.getFilePath().filename().string()});
+        }
+        for (const auto& cascade : cascades) {
+            auto erased = cascade.table->eraseBy(cascade.column, key);
+            if (!erased.has_value()) return std::unexpected(erased.error());
+        }
+        return table.erase(key);
+    }
+
+    /**
+     * @brief Throws std::invalid_argument when a dependency is missing (same contract as the SQL DAOs)
+     */
+    template <typename TTable, typename TParser>
+    void requireDependencies(const std::shared_ptr<TTable>& table, const std::shared_ptr<TParser>& parser, const std::string& daoName) {
+        if (!table) throw std::invalid_argument(daoName + ": CSV table cannot be null.");
+        if (!parser) throw std::invalid_argument(daoName + ": Parser cannot be null.");
+    }
+}
+
+#endif // CSVDAOUTILS_H
@@ -0,0 +1,56 @@
+#include "CsvDegreeRequirementDao.h"
+#include "../../../utils/StringUtils.h"
+#include <array>
+#include <charconv>
+#include <stdexcept>
+
+namespace {
+    template<typename TNumber>
+    std::expected<TNumber, Error> parseNumber(const CsvTable::Row& row, std::size_t column) {
+        TNumber value{};
+        const std::string& text = row[column];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid number '" + text + "' in degree requirement of faculty '" +
+                                                                   row[CsvDegreeRequirementDao::FACULTY_ID] + "'."});
+        }
+        return value;
+    }
+}
+
+CsvTableSchema CsvDegreeRequirementDao::schema() {
+    return {{"facultyId", "minTotalCredits", "minCgpa", "requiredCourses"}, {FACULTY_ID}, {}};
+}
+
+CsvDegreeRequirementDao::CsvDegreeRequirementDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvDegreeRequirementDao: table cannot be null.");
+    }
+}
+
+std::expected<std::vector<DegreeRequirement>, Error> CsvDegreeRequirementDao::getAll() const {
+    std::vector<DegreeRequirement> requirements;
+    for (const auto& row : _table->all()) {
+        auto minTotalCredits = parseNumber<int>(row, MIN_TOTAL_CREDITS);
+        if (!minTotalCredits) return std::unexpected(minTotalCredits.error());
+        auto minCgpa = parseNumber<double>(row, MIN_CGPA);
+        if (!minCgpa) return std::unexpected(minCgpa.error());
+        requirements.push_back(DegreeRequirement{row[FACULTY_ID], minTotalCredits.value(), minCgpa.value(),
+                                                 StringUtils::split(row[REQUIRED_COURSES], ';')});
+    }
+    return requirements;
+}
+
+std::expected<bool, Error> CsvDegreeRequirementDao::upsert(const DegreeRequirement& requirement) {
+    if (requirement.facultyId.empty() || requirement.minTotalCredits < 0 || requirement.minCgpa < 0.0 || requirement.minCgpa > 4.0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid degree requirement for faculty '" + requirement.facultyId + "'."});
+    }
+    std::array<char, 32> minCgpa{};
+    auto [end, ec] = std::to_chars(minCgpa.data(), minCgpa.data() + minCgpa.size(), requirement.minCgpa);
+    return _table->upsert({requirement.facultyId, std::to_string(requirement.minTotalCredits), std::string(minCgpa.data(), end),
+                           StringUtils::join(requirement.requiredCourseIds, ';')});
+}
+
+std::expected<bool, Error> CsvDegreeRequirementDao::remove(const std::string& facultyId) {
+    return _table->erase(facultyId);
+}
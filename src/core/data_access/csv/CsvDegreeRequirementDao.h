@@ -0,0 +1,46 @@
+#ifndef CSVDEGREEREQUIREMENTDAO_H
+#define CSVDEGREEREQUIREMENTDAO_H
+
+/**
+ * @file CsvDegreeRequirementDao.h
+ * @brief CSV implementation of the per-faculty degree requirement data access object
+ */
+
+#include "../interface/IDegreeRequirementDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvDegreeRequirementDao
+ * @brief CSV implementation of IDegreeRequirementDao on top of a shared CsvTable keyed by facultyId
+ */
+class CsvDegreeRequirementDao : public IDegreeRequirementDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per faculty
+
+public:
+    static constexpr std::size_t FACULTY_ID = 0;        ///< Column of the faculty ID (key)
+    static constexpr std::size_t MIN_TOTAL_CREDITS = 1; ///< Column of the minimum passed credits
+    static constexpr std::size_t MIN_CGPA = 2;          ///< Column of the minimum CGPA on the 4-point scale
+    static constexpr std::size_t REQUIRED_COURSES = 3;  ///< Column of the ';'-separated required course IDs
+
+    /**
+     * @brief Column layout of the degree requirement file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvDegreeRequirementDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvDegreeRequirementDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvDegreeRequirementDao() override = default;
+
+    std::expected<std::vector<DegreeRequirement>, Error> getAll() const override;
+    std::expected<bool, Error> upsert(const DegreeRequirement& requirement) override;
+    std::expected<bool, Error> remove(const std::string& facultyId) override;
+};
+
+#endif // CSVDEGREEREQUIREMENTDAO_H
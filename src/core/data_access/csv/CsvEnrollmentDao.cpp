@@ -0,0 +1,115 @@
+#include "CsvEnrollmentDao.h"
+#include "CsvDaoUtils.h"
+#include "../../parsing/impl_csv_parser/EnrollmentRecordCsvParser.h"
+#include "../../parsing/impl_csv_parser/CourseCsvParser.h"
+#include "../../parsing/impl_csv_parser/CsvParserUtils.h"
+#include <stdexcept>
+
+CsvEnrollmentDao::CsvEnrollmentDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<EnrollmentRecord, CsvRow>> parser,
+                                   std::shared_ptr<CsvTable> courseTable)
+    : _table(std::move(table)), _parser(std::move(parser)), _courseTable(std::move(courseTable)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvEnrollmentDao");
+    if (!_courseTable) throw std::invalid_argument("CsvEnrollmentDao: Course table cannot be null.");
+}
+
+std::expected<bool, Error> CsvEnrollmentDao::addEnrollment(const std::string& studentId, const std::string& courseId) {
+    auto row = _parser->serialize(EnrollmentRecord{studentId, courseId});
+    if (!row) return std::unexpected(row.error());
+    auto inserted = _table->insert(std::move(*row));
+    if (!inserted && inserted.error().code == ErrorCode::ALREADY_EXISTS) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " already enrolled in course " + courseId});
+    }
+    return inserted;
+}
+
+std::expected<bool, Error> CsvEnrollmentDao::enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) {
+    auto course = _courseTable->find(courseId);
+    if (!course) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course with ID '" + courseId + "' not found."});
+    }
+    auto row = _parser->serialize(EnrollmentRecord{studentId, courseId});
+    if (!row) return std::unexpected(row.error());
+
+    long long capacity = CsvParserUtils::toLongLong((*course)[CourseCsvParser::CAPACITY]);
+    auto inserted = capacity > 0
+        ? _table->insertIfFewer(std::move(*row), EnrollmentRecordCsvParser::COURSE_ID, static_cast<std::size_t>(capacity))
+        : _table->insert(std::move(*row));
+    if (!inserted) {
+        if (inserted.error().code == ErrorCode::ALREADY_EXISTS) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " already enrolled in course " + courseId});
+        }
+        if (inserted.error().code == ErrorCode::OPERATION_FAILED) {
+            return std::unexpected(Error{ErrorCode::COURSE_CAPACITY_REACHED, "Course " + courseId + " has no seats left."});
+        }
+    }
+    return inserted;
+}
+
+std::expected<bool, Error> CsvEnrollmentDao::removeEnrollment(const std::string& studentId, const std::string& courseId) {
+    auto removed = _table->erase(CsvTable::compositeKey({studentId, courseId}));
+    if (!removed && removed.error().code == ErrorCode::NOT_FOUND) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Enrollment not found for Student " + studentId + " in Course " + courseId + " to remove."});
+    }
+    return removed;
+}
+
+std::expected<bool, Error> CsvEnrollmentDao::removeEnrollmentsByStudent(const std::string& studentId) {
+    auto removed = _table->eraseBy(EnrollmentRecordCsvParser::STUDENT_ID, studentId);
+    if (!removed) return std::unexpected(removed.error());
+    return true;
+}
+
+std::expected<bool, Error> CsvEnrollmentDao::removeEnrollmentsByCourse(const std::string& courseId) {
+    auto removed = _table->eraseBy(EnrollmentRecordCsvParser::COURSE_ID, courseId);
+    if (!removed) return std::unexpected(removed.error());
+    return true;
+}
+
+std::expected<bool, Error> CsvEnrollmentDao::isEnrolled(const std::string& studentId, const std::string& courseId) const {
+    return _table->contains(CsvTable::compositeKey({studentId, courseId}));
+}
+
+std::expected<std::vector<std::string>, Error> CsvEnrollmentDao::findCourseIdsByStudentId(const std::string& studentId) const {
+    std::vector<std::string> courseIds;
+    for (auto& row : _table->findBy(EnrollmentRecordCsvParser::STUDENT_ID, studentId)) {
+        courseIds.push_back(std::move(row[EnrollmentRecordCsvParser::COURSE_ID]));
+    }
+    return courseIds;
+}
+
+std::expected<std::vector<std::string>, Error> CsvEnrollmentDao::findStudentIdsByCourseId(const std::string& courseId) const {
+    std::vector<std::string> studentIds;
+    for (auto& row : _table->findBy(EnrollmentRecordCsvParser::COURSE_ID, courseId)) {
+        studentIds.push_back(std::move(row[EnrollmentRecordCsvParser::STUDENT_ID]));
+    }
+    return studentIds;
+}
+
+std::expected<std::vector<EnrollmentRecord>, Error> CsvEnrollmentDao::findByTerm(const std::string& termId) const {
+    return CsvDaoUtils::parseRows(_table->findBy(EnrollmentRecordCsvParser::TERM_ID, termId), *_parser);
+}
+
+std::expected<std::vector<std::string>, Error> CsvEnrollmentDao::findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    std::vector<std::string> studentIds;
+    for (auto& row : _table->findBy(EnrollmentRecordCsvParser::TERM_ID, termId)) {
+        if (row[EnrollmentRecordCsvParser::COURSE_ID] == courseId) studentIds.push_back(std::move(row[EnrollmentRecordCsvParser::STUDENT_ID]));
+    }
+    return studentIds;
+}
+
+std::expected<bool, Error> CsvEnrollmentDao::setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) {
+    auto row = _table->find(CsvTable::compositeKey({studentId, courseId}));
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Enrollment not found for Student " + studentId + " in Course " + courseId + "."});
+    }
+    (*row)[EnrollmentRecordCsvParser::TERM_ID] = termId;
+    return _table->upsert(std::move(*row));
+}
+
+std::expected<std::vector<EnrollmentRecord>, Error> CsvEnrollmentDao::getAllEnrollments() const {
+    return CsvDaoUtils::parseRows(_table->all(), *_parser);
+}
+
+std::expected<std::size_t, Error> CsvEnrollmentDao::forEachEnrollment(const std::function<bool(const EnrollmentRecord&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
@@ -0,0 +1,75 @@
+#ifndef CSVENROLLMENTDAO_H
+#define CSVENROLLMENTDAO_H
+
+/**
+ * @file CsvEnrollmentDao.h
+ * @brief CSV implementation of the enrollment data access object
+ */
+
+#include "../interface/IEnrollmentDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvEnrollmentDao
+ * @brief CSV implementation of IEnrollmentDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvEnrollmentDao : public IEnrollmentDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the enrollment rows
+    std::shared_ptr<IEntityParser<EnrollmentRecord, CsvRow>> _parser; ///< Parser converting rows to EnrollmentRecord objects
+    std::shared_ptr<CsvTable> _courseTable; ///< Course table, read for the capacity of a course
+
+public:
+    /**
+     * @brief Constructor for CsvEnrollmentDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to EnrollmentRecord objects
+     * @param courseTable Loaded course table (capacity lookups)
+     * @throws std::invalid_argument if any argument is null
+     */
+    CsvEnrollmentDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<EnrollmentRecord, CsvRow>> parser,
+                     std::shared_ptr<CsvTable> courseTable);
+
+    ~CsvEnrollmentDao() override = default;
+
+    std::expected<bool, Error> addEnrollment(const std::string& studentId, const std::string& courseId) override;
+
+    /**
+     * @brief Counts the course's seats through the courseId index and inserts under the same table lock
+     */
+    std::expected<bool, Error> enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> removeEnrollment(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> removeEnrollmentsByStudent(const std::string& studentId) override;
+    std::expected<bool, Error> removeEnrollmentsByCourse(const std::string& courseId) override;
+    std::expected<bool, Error> isEnrolled(const std::string& studentId, const std::string& courseId) const override;
+
+    /**
+     * @brief Lists the courses of a student through the studentId index
+     */
+    std::expected<std::vector<std::string>, Error> findCourseIdsByStudentId(const std::string& studentId) const override;
+
+    /**
+     * @brief Lists the students of a course through the courseId index
+     */
+    std::expected<std::vector<std::string>, Error> findStudentIdsByCourseId(const std::string& courseId) const override;
+
+    std::expected<std::vector<EnrollmentRecord>, Error> getAllEnrollments() const override;
+
+    /**
+     * @brief Lists the enrollments of a term through the termId index
+     */
+    std::expected<std::vector<EnrollmentRecord>, Error> findByTerm(const std::string& termId) const override;
+
+    /**
+     * @brief Lists the students of a course in a term, scanning only the term's rows
+     */
+    std::expected<std::vector<std::string>, Error> findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
+    std::expected<bool, Error> setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) override;
+    std::expected<std::size_t, Error> forEachEnrollment(const std::function<bool(const EnrollmentRecord&)>& visitor) const override;
+};
+
+#endif // CSVENROLLMENTDAO_H
@@ -0,0 +1,78 @@
+#include "CsvExamScheduleDao.h"
+#include <algorithm>
+#include <charconv>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_set>
+
+namespace {
+    std::expected<int, Error> parseNumber(const CsvTable::Row& row, std::size_t column) {
+        int value = 0;
+        const std::string& text = row[column];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid number '" + text + "' in exam slot of course '" +
+                                                                   row[CsvExamScheduleDao::COURSE_ID] + "'."});
+        }
+        return value;
+    }
+}
+
+CsvTableSchema CsvExamScheduleDao::schema() {
+    return {{"courseId", "examDay", "period"}, {COURSE_ID}, {}};
+}
+
+CsvExamScheduleDao::CsvExamScheduleDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvExamScheduleDao: table cannot be null.");
+    }
+}
+
+std::expected<bool, Error> CsvExamScheduleDao::replaceAll(const std::vector<ExamSlot>& slots) {
+    std::vector<CsvTable::Row> rows;
+    rows.reserve(slots.size());
+    std::unordered_set<std::string> scheduled;
+    for (const auto& slot : slots) {
+        if (slot.courseId.empty() || slot.day < 1 || slot.period < 1 || !scheduled.insert(slot.courseId).second) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid exam slot for course '" + slot.courseId + "'."});
+        }
+        rows.push_back({slot.courseId, std::to_string(slot.day), std::to_string(slot.period)});
+    }
+
+    std::vector<std::string> stale;
+    _table->forEachRow([&](const CsvTable::Row& row) {
+        if (!scheduled.contains(row[COURSE_ID])) stale.push_back(row[COURSE_ID]);
+        return true;
+    });
+    if (!rows.empty()) {
+        auto upserted = _table->upsertMany(std::move(rows));
+        if (!upserted) return upserted;
+    }
+    for (const auto& courseId : stale) {
+        auto erased = _table->erase(courseId);
+        if (!erased && erased.error().code != ErrorCode::NOT_FOUND) return erased;
+    }
+    return true;
+}
+
+std::expected<std::vector<ExamSlot>, Error> CsvExamScheduleDao::getAll() const {
+    std::vector<ExamSlot> slots;
+    slots.reserve(_table->size());
+    std::optional<Error> parseError;
+    _table->forEachRow([&](const CsvTable::Row& row) {
+        auto day = parseNumber(row, EXAM_DAY);
+        auto period = parseNumber(row, PERIOD);
+        if (!day || !period) {
+            parseError = !day ? day.error() : period.error();
+            return false;
+        }
+        slots.push_back(ExamSlot{row[COURSE_ID], day.value(), period.value()});
+        return true;
+    });
+    if (parseError.has_value()) return std::unexpected(parseError.value());
+    std::sort(slots.begin(), slots.end(), [](const ExamSlot& a, const ExamSlot& b) {
+        return std::tie(a.day, a.period, a.courseId) < std::tie(b.day, b.period, b.courseId);
+    });
+    return slots;
+}
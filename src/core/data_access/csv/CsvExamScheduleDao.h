@@ -0,0 +1,47 @@
+#ifndef CSVEXAMSCHEDULEDAO_H
+#define CSVEXAMSCHEDULEDAO_H
+
+/**
+ * @file CsvExamScheduleDao.h
+ * @brief CSV implementation of the exam schedule data access object
+ */
+
+#include "../interface/IExamScheduleDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvExamScheduleDao
+ * @brief CSV implementation of IExamScheduleDao on top of a shared CsvTable keyed by courseId
+ *
+ * replaceAll() upserts the new slots in one journal append and then erases courses that are no
+ * longer scheduled.
+ */
+class CsvExamScheduleDao : public IExamScheduleDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per scheduled course
+
+public:
+    static constexpr std::size_t COURSE_ID = 0; ///< Column of the course ID (key)
+    static constexpr std::size_t EXAM_DAY = 1;  ///< Column of the exam day (1-based)
+    static constexpr std::size_t PERIOD = 2;    ///< Column of the period within the day (1-based)
+
+    /**
+     * @brief Column layout of the exam schedule file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvExamScheduleDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvExamScheduleDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvExamScheduleDao() override = default;
+
+    std::expected<bool, Error> replaceAll(const std::vector<ExamSlot>& slots) override;
+    std::expected<std::vector<ExamSlot>, Error> getAll() const override;
+};
+
+#endif // CSVEXAMSCHEDULEDAO_H
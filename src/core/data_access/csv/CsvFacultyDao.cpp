@@ -0,0 +1,70 @@
+#include "CsvFacultyDao.h"
+#include "CsvDaoUtils.h"
+#include "../../parsing/impl_csv_parser/FacultyCsvParser.h"
+
+CsvFacultyDao::CsvFacultyDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Faculty, CsvRow>> parser)
+    : _table(std::move(table)), _parser(std::move(parser)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvFacultyDao");
+}
+
+std::expected<Faculty, Error> CsvFacultyDao::getById(const std::string& id) const {
+    auto row = _table->find(id);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Faculty with ID " + id + " not found."});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<std::vector<Faculty>, Error> CsvFacultyDao::getAll() const {
+    return CsvDaoUtils::parseRows(_table->all(), *_parser);
+}
+
+std::expected<std::size_t, Error> CsvFacultyDao::forEach(const std::function<bool(const Faculty&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
+
+std::expected<Faculty, Error> CsvFacultyDao::add(const Faculty& faculty) {
+    ValidationResult vr = faculty.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Faculty data for add: " + vr.getErrorMessagesCombined()});
+    }
+    if (!_table->findBy(FacultyCsvParser::NAME, faculty.getName()).empty()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Faculty with name '" + faculty.getName() + "' already exists."});
+    }
+    auto row = _parser->serialize(faculty);
+    if (!row) return std::unexpected(row.error());
+    auto inserted = _table->insert(std::move(*row));
+    if (!inserted) return std::unexpected(inserted.error());
+    return faculty;
+}
+
+std::expected<bool, Error> CsvFacultyDao::update(const Faculty& faculty) {
+    ValidationResult vr = faculty.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Faculty data for update: " + vr.getErrorMessagesCombined()});
+    }
+    for (const auto& other : _table->findBy(FacultyCsvParser::NAME, faculty.getName())) {
+        if (other[FacultyCsvParser::ID] != faculty.getId()) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Faculty name '" + faculty.getName() + "' conflicts with another faculty."});
+        }
+    }
+    auto row = _parser->serialize(faculty);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<bool, Error> CsvFacultyDao::remove(const std::string& id) {
+    return _table->erase(id);
+}
+
+std::expected<bool, Error> CsvFacultyDao::exists(const std::string& id) const {
+    return _table->contains(id);
+}
+
+std::expected<Faculty, Error> CsvFacultyDao::findByName(const std::string& name) const {
+    auto rows = _table->findBy(FacultyCsvParser::NAME, name);
+    if (rows.empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Faculty with name '" + name + "' not found."});
+    }
+    return _parser->parse(rows.front());
+}
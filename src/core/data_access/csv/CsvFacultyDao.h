@@ -0,0 +1,50 @@
+#ifndef CSVFACULTYDAO_H
+#define CSVFACULTYDAO_H
+
+/**
+ * @file CsvFacultyDao.h
+ * @brief CSV implementation of the faculty data access object
+ */
+
+#include "../interface/IFacultyDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvFacultyDao
+ * @brief CSV implementation of IFacultyDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvFacultyDao : public IFacultyDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the faculty rows
+    std::shared_ptr<IEntityParser<Faculty, CsvRow>> _parser; ///< Parser converting rows to Faculty objects
+
+public:
+    /**
+     * @brief Constructor for CsvFacultyDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to Faculty objects
+     * @throws std::invalid_argument if table or parser is null
+     */
+    CsvFacultyDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Faculty, CsvRow>> parser);
+
+    ~CsvFacultyDao() override = default;
+
+    std::expected<Faculty, Error> getById(const std::string& id) const override;
+    std::expected<std::vector<Faculty>, Error> getAll() const override;
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Faculty&)>& visitor) const override;
+    std::expected<Faculty, Error> add(const Faculty& faculty) override;
+    std::expected<bool, Error> update(const Faculty& faculty) override;
+    std::expected<bool, Error> remove(const std::string& id) override;
+    std::expected<bool, Error> exists(const std::string& id) const override;
+
+    /**
+     * @brief Finds a faculty through the name index
+     */
+    std::expected<Faculty, Error> findByName(const std::string& name) const override;
+};
+
+#endif // CSVFACULTYDAO_H
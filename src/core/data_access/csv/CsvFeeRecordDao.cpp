@@ -0,0 +1,183 @@
+#include "CsvFeeRecordDao.h"
+#include "CsvDaoUtils.h"
+#include <algorithm>
+#include <charconv>
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+    std::mutex paymentWriteMutex; // Tuần tự hóa kiểm tra-và-cộng của mọi CsvFeeRecordDao
+
+    template<typename TNumber>
+    std::expected<TNumber, Error> parseNumber(const std::string& text, const std::string& what) {
+        TNumber value = 0;
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid " + what + " '" + text + "' in fee payment ledger."});
+        }
+        return value;
+    }
+
+    std::expected<FeePayment, Error> parsePayment(const CsvTable::Row& row) {
+        FeePayment payment;
+        payment.idempotencyKey = row[CsvFeeRecordDao::PAYMENT_KEY];
+        payment.studentId = row[CsvFeeRecordDao::PAYMENT_STUDENT];
+        auto amount = parseNumber<long>(row[CsvFeeRecordDao::PAYMENT_AMOUNT], "amount");
+        if (!amount) return std::unexpected(amount.error());
+        auto paidAt = parseNumber<long long>(row[CsvFeeRecordDao::PAYMENT_PAID_AT], "payment time");
+        if (!paidAt) return std::unexpected(paidAt.error());
+        payment.amount = amount.value();
+        payment.paidAt = paidAt.value();
+        return payment;
+    }
+}
+
+CsvTableSchema CsvFeeRecordDao::paymentSchema() {
+    return {{"idempotencyKey", "studentId", "amount", "paidAt"}, {PAYMENT_KEY}, {PAYMENT_STUDENT}};
+}
+
+CsvFeeRecordDao::CsvFeeRecordDao(std::shared_ptr<CsvTable> table, std::shared_ptr<CsvTable> paymentTable,
+                                 std::shared_ptr<IEntityParser<FeeRecord, CsvRow>> parser)
+    : _table(std::move(table)), _paymentTable(std::move(paymentTable)), _parser(std::move(parser)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvFeeRecordDao");
+    if (!_paymentTable) {
+        throw std::invalid_argument("CsvFeeRecordDao: payment table cannot be null.");
+    }
+}
+
+std::expected<FeeRecord, Error> CsvFeeRecordDao::getById(const std::string& studentId) const {
+    auto row = _table->find(studentId);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "FeeRecord for Student ID " + studentId + " not found."});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<std::vector<FeeRecord>, Error> CsvFeeRecordDao::getAll() const {
+    return CsvDaoUtils::parseRows(_table->all(), *_parser);
+}
+
+std::expected<std::size_t, Error> CsvFeeRecordDao::forEach(const std::function<bool(const FeeRecord&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
+
+std::expected<FeeRecord, Error> CsvFeeRecordDao::add(const FeeRecord& feeRecord) {
+    ValidationResult vr = feeRecord.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data: " + vr.getErrorMessagesCombined()});
+    }
+    auto row = _parser->serialize(feeRecord);
+    if (!row) return std::unexpected(row.error());
+    auto inserted = _table->insert(std::move(*row));
+    if (!inserted) return std::unexpected(inserted.error());
+    return feeRecord;
+}
+
+std::expected<bool, Error> CsvFeeRecordDao::addBatch(const std::vector<FeeRecord>& feeRecords) {
+    std::vector<CsvRow> rows;
+    rows.reserve(feeRecords.size());
+    for (const auto& feeRecord : feeRecords) {
+        ValidationResult vr = feeRecord.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data: " + vr.getErrorMessagesCombined()});
+        }
+        auto row = _parser->serialize(feeRecord);
+        if (!row) return std::unexpected(row.error());
+        rows.push_back(std::move(*row));
+    }
+    return _table->insertMany(std::move(rows));
+}
+
+std::expected<bool, Error> CsvFeeRecordDao::setTotalFees(const std::vector<FeeRecord>& feeRecords) {
+    std::lock_guard<std::mutex> lock(paymentWriteMutex);
+    std::vector<CsvRow> rows;
+    rows.reserve(feeRecords.size());
+    for (const auto& feeRecord : feeRecords) {
+        ValidationResult vr = feeRecord.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data: " + vr.getErrorMessagesCombined()});
+        }
+        FeeRecord record = feeRecord;
+        auto current = getById(feeRecord.getStudentId());
+        if (!current && current.error().code != ErrorCode::NOT_FOUND) return std::unexpected(current.error());
+        if (current) {
+            if (current->getPaidFee() > feeRecord.getTotalFee()) {
+                return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "New total fee is less than the amount already paid by " +
+                                                                         feeRecord.getStudentId() + "."});
+            }
+            record = current.value();
+            record.setTotalFee(feeRecord.getTotalFee());
+        }
+        auto row = _parser->serialize(record);
+        if (!row) return std::unexpected(row.error());
+        rows.push_back(std::move(*row));
+    }
+    return _table->upsertMany(std::move(rows));
+}
+
+std::expected<bool, Error> CsvFeeRecordDao::update(const FeeRecord& feeRecord) {
+    ValidationResult vr = feeRecord.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data: " + vr.getErrorMessagesCombined()});
+    }
+    auto row = _parser->serialize(feeRecord);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<bool, Error> CsvFeeRecordDao::remove(const std::string& studentId) {
+    return _table->erase(studentId);
+}
+
+std::expected<bool, Error> CsvFeeRecordDao::exists(const std::string& studentId) const {
+    return _table->contains(studentId);
+}
+
+std::expected<bool, Error> CsvFeeRecordDao::recordPayment(const FeePayment& payment) {
+    if (payment.idempotencyKey.empty() || payment.amount <= 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Fee payment requires an idempotency key and a positive amount."});
+    }
+    std::lock_guard<std::mutex> lock(paymentWriteMutex);
+
+    if (auto existing = _paymentTable->find(payment.idempotencyKey)) {
+        auto recorded = parsePayment(*existing);
+        if (!recorded) return std::unexpected(recorded.error());
+        if (recorded->studentId != payment.studentId || recorded->amount != payment.amount) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Idempotency key '" + payment.idempotencyKey + "' was already used for a different payment."});
+        }
+        return false;
+    }
+
+    auto current = getById(payment.studentId);
+    if (!current) return std::unexpected(current.error());
+    FeeRecord record = current.value();
+    // Không dùng makePayment: nó coi khoản nộp vào hồ sơ đã đóng đủ là thành công
+    if (payment.amount > record.getDueFee() || !record.setPaidFee(record.getPaidFee() + payment.amount)) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Payment amount exceeds due fee."});
+    }
+    auto row = _parser->serialize(record);
+    if (!row) return std::unexpected(row.error());
+
+    auto appended = _paymentTable->insert({payment.idempotencyKey, payment.studentId,
+                                           std::to_string(payment.amount), std::to_string(payment.paidAt)});
+    if (!appended) return std::unexpected(appended.error());
+    auto updated = _table->update(std::move(*row));
+    if (!updated) {
+        _paymentTable->erase(payment.idempotencyKey);
+        return std::unexpected(updated.error());
+    }
+    return true;
+}
+
+std::expected<std::vector<FeePayment>, Error> CsvFeeRecordDao::getPayments(const std::string& studentId) const {
+    std::vector<FeePayment> payments;
+    for (const auto& row : _paymentTable->findBy(PAYMENT_STUDENT, studentId)) {
+        auto payment = parsePayment(row);
+        if (!payment) return std::unexpected(payment.error());
+        payments.push_back(std::move(payment.value()));
+    }
+    std::sort(payments.begin(), payments.end(), [](const FeePayment& a, const FeePayment& b) {
+        return a.paidAt != b.paidAt ? a.paidAt < b.paidAt : a.idempotencyKey < b.idempotencyKey;
+    });
+    return payments;
+}
@@ -0,0 +1,73 @@
+#ifndef CSVFEERECORDDAO_H
+#define CSVFEERECORDDAO_H
+
+/**
+ * @file CsvFeeRecordDao.h
+ * @brief CSV implementation of the fee record data access object
+ */
+
+#include "../interface/IFeeRecordDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvFeeRecordDao
+ * @brief CSV implementation of IFeeRecordDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvFeeRecordDao : public IFeeRecordDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the fee record rows
+    std::shared_ptr<CsvTable> _paymentTable; ///< Loaded table holding the fee payment ledger
+    std::shared_ptr<IEntityParser<FeeRecord, CsvRow>> _parser; ///< Parser converting rows to FeeRecord objects
+
+public:
+    static constexpr std::size_t PAYMENT_KEY = 0;     ///< Ledger column of the idempotency key (primary key)
+    static constexpr std::size_t PAYMENT_STUDENT = 1; ///< Ledger column of the student ID (indexed)
+    static constexpr std::size_t PAYMENT_AMOUNT = 2;  ///< Ledger column of the amount paid
+    static constexpr std::size_t PAYMENT_PAID_AT = 3; ///< Ledger column of the payment time (seconds since epoch)
+
+    /**
+     * @brief Column layout of the fee payment ledger file
+     */
+    static CsvTableSchema paymentSchema();
+
+    /**
+     * @brief Constructor for CsvFeeRecordDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param paymentTable Loaded CSV table of the payment ledger using paymentSchema()
+     * @param parser Entity parser for converting rows to FeeRecord objects
+     * @throws std::invalid_argument if a table or the parser is null
+     */
+    CsvFeeRecordDao(std::shared_ptr<CsvTable> table, std::shared_ptr<CsvTable> paymentTable,
+                    std::shared_ptr<IEntityParser<FeeRecord, CsvRow>> parser);
+
+    ~CsvFeeRecordDao() override = default;
+
+    std::expected<FeeRecord, Error> getById(const std::string& studentId) const override;
+    std::expected<std::vector<FeeRecord>, Error> getAll() const override;
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const FeeRecord&)>& visitor) const override;
+    std::expected<FeeRecord, Error> add(const FeeRecord& feeRecord) override;
+    std::expected<bool, Error> addBatch(const std::vector<FeeRecord>& feeRecords) override;
+
+    /**
+     * @brief Rewrites the totals with one journal append, holding the payment mutex so no payment interleaves
+     */
+    std::expected<bool, Error> setTotalFees(const std::vector<FeeRecord>& feeRecords) override;
+    std::expected<bool, Error> update(const FeeRecord& feeRecord) override;
+    std::expected<bool, Error> remove(const std::string& studentId) override;
+    std::expected<bool, Error> exists(const std::string& studentId) const override;
+
+    /**
+     * @brief Appends the payment to the ledger, then applies it to the fee record
+     *
+     * CSV files have no transactions: the check-and-add is serialized by a mutex shared by every
+     * CsvFeeRecordDao, and the ledger row is erased again if the fee record cannot be updated.
+     */
+    std::expected<bool, Error> recordPayment(const FeePayment& payment) override;
+    std::expected<std::vector<FeePayment>, Error> getPayments(const std::string& studentId) const override;
+};
+
+#endif // CSVFEERECORDDAO_H
@@ -0,0 +1,171 @@
+#include "CsvInstallmentDao.h"
+#include <algorithm>
+#include <charconv>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stdexcept>
+
+namespace {
+    std::mutex installmentWriteMutex; // Tuần tự hóa đọc-sửa-ghi của mọi CsvInstallmentDao
+
+    template<typename TNumber>
+    std::expected<TNumber, Error> parseNumber(const CsvTable::Row& row, std::size_t column) {
+        TNumber value = 0;
+        const std::string& text = row[column];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid number '" + text + "' in installment of student '" +
+                                                                   row[CsvInstallmentDao::STUDENT_ID] + "'."});
+        }
+        return value;
+    }
+
+    std::expected<FeeInstallment, Error> parseInstallment(const CsvTable::Row& row) {
+        auto sequence = parseNumber<int>(row, CsvInstallmentDao::SEQUENCE);
+        if (!sequence) return std::unexpected(sequence.error());
+        auto amount = parseNumber<long>(row, CsvInstallmentDao::AMOUNT);
+        if (!amount) return std::unexpected(amount.error());
+        auto paidAmount = parseNumber<long>(row, CsvInstallmentDao::PAID_AMOUNT);
+        if (!paidAmount) return std::unexpected(paidAmount.error());
+        return FeeInstallment{row[CsvInstallmentDao::STUDENT_ID], sequence.value(), row[CsvInstallmentDao::DUE_DATE],
+                              amount.value(), paidAmount.value(), row[CsvInstallmentDao::IS_LATE] == "1"};
+    }
+
+    CsvTable::Row toRow(const FeeInstallment& installment) {
+        return {installment.studentId, std::to_string(installment.sequence), installment.dueDate,
+                std::to_string(installment.amount), std::to_string(installment.paidAmount), installment.late ? "1" : "0"};
+    }
+
+    bool dueBefore(const FeeInstallment& a, const FeeInstallment& b) {
+        return a.dueDate != b.dueDate ? a.dueDate < b.dueDate : a.sequence < b.sequence;
+    }
+
+    // Duyệt toàn bảng và trả về các đợt chưa đóng đủ thỏa điều kiện ngày
+    template<typename TPredicate>
+    std::expected<std::vector<FeeInstallment>, Error> scanOpen(const CsvTable& table, TPredicate matchesDueDate) {
+        std::vector<FeeInstallment> installments;
+        std::optional<Error> parseError;
+        table.forEachRow([&](const CsvTable::Row& row) {
+            if (!matchesDueDate(row[CsvInstallmentDao::DUE_DATE])) return true;
+            auto installment = parseInstallment(row);
+            if (!installment) {
+                parseError = installment.error();
+                return false;
+            }
+            if (installment->outstanding() > 0) installments.push_back(std::move(installment.value()));
+            return true;
+        });
+        if (parseError) return std::unexpected(*parseError);
+        return installments;
+    }
+}
+
+CsvTableSchema CsvInstallmentDao::schema() {
+    return {{"studentId", "sequence", "dueDate", "amount", "paidAmount", "isLate"}, {STUDENT_ID, SEQUENCE}, {STUDENT_ID}};
+}
+
+CsvInstallmentDao::CsvInstallmentDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvInstallmentDao: table cannot be null.");
+    }
+}
+
+std::expected<std::vector<FeeInstallment>, Error> CsvInstallmentDao::getByStudent(const std::string& studentId) const {
+    std::vector<FeeInstallment> installments;
+    for (const auto& row : _table->findBy(STUDENT_ID, studentId)) {
+        auto installment = parseInstallment(row);
+        if (!installment) return std::unexpected(installment.error());
+        installments.push_back(std::move(installment.value()));
+    }
+    std::sort(installments.begin(), installments.end(), dueBefore);
+    return installments;
+}
+
+std::expected<bool, Error> CsvInstallmentDao::replaceSchedule(const std::string& studentId, const std::vector<FeeInstallment>& installments) {
+    std::vector<CsvTable::Row> rows;
+    rows.reserve(installments.size());
+    std::set<int> sequences;
+    for (const auto& installment : installments) {
+        if (installment.studentId != studentId || installment.amount <= 0 || installment.paidAmount < 0 ||
+            installment.paidAmount > installment.amount || !sequences.insert(installment.sequence).second) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid installment " + std::to_string(installment.sequence) +
+                                                                     " for student " + studentId + "."});
+        }
+        rows.push_back(toRow(installment));
+    }
+
+    std::lock_guard<std::mutex> lock(installmentWriteMutex);
+    auto existing = getByStudent(studentId);
+    if (!existing) return std::unexpected(existing.error());
+    auto written = _table->upsertMany(std::move(rows));
+    if (!written) return written;
+    for (const auto& installment : existing.value()) {
+        if (sequences.contains(installment.sequence)) continue;
+        auto erased = _table->erase(CsvTable::compositeKey({studentId, std::to_string(installment.sequence)}));
+        if (!erased) return erased;
+    }
+    return true;
+}
+
+std::expected<bool, Error> CsvInstallmentDao::allocatePaid(const std::string& studentId, long paidTotal) {
+    std::lock_guard<std::mutex> lock(installmentWriteMutex);
+    auto installments = getByStudent(studentId);
+    if (!installments) return std::unexpected(installments.error());
+
+    std::vector<CsvTable::Row> changed;
+    long remaining = std::max(0L, paidTotal);
+    for (auto& installment : installments.value()) {
+        long allocated = std::min(installment.amount, remaining);
+        remaining -= allocated;
+        if (allocated == installment.paidAmount) continue;
+        installment.paidAmount = allocated;
+        changed.push_back(toRow(installment));
+    }
+    return _table->upsertMany(std::move(changed));
+}
+
+std::expected<std::size_t, Error> CsvInstallmentDao::markLate(const std::string& asOfDate) {
+    std::lock_guard<std::mutex> lock(installmentWriteMutex);
+    auto overdue = scanOpen(*_table, [&asOfDate](const std::string& dueDate) { return dueDate < asOfDate; });
+    if (!overdue) return std::unexpected(overdue.error());
+
+    std::vector<CsvTable::Row> changed;
+    for (auto& installment : overdue.value()) {
+        if (installment.late) continue;
+        installment.late = true;
+        changed.push_back(toRow(installment));
+    }
+    std::size_t flagged = changed.size();
+    auto written = _table->upsertMany(std::move(changed));
+    if (!written) return std::unexpected(written.error());
+    return flagged;
+}
+
+std::expected<std::vector<OverdueBalance>, Error> CsvInstallmentDao::sumOverdue(const std::string& asOfDate) const {
+    auto overdue = scanOpen(*_table, [&asOfDate](const std::string& dueDate) { return dueDate < asOfDate; });
+    if (!overdue) return std::unexpected(overdue.error());
+
+    std::map<std::string, OverdueBalance> balances;
+    for (const auto& installment : overdue.value()) {
+        OverdueBalance& balance = balances[installment.studentId];
+        if (balance.installmentCount == 0 || installment.dueDate < balance.oldestDueDate) balance.oldestDueDate = installment.dueDate;
+        balance.studentId = installment.studentId;
+        ++balance.installmentCount;
+        balance.overdueAmount += installment.outstanding();
+    }
+    std::vector<OverdueBalance> result;
+    result.reserve(balances.size());
+    for (auto& [studentId, balance] : balances) result.push_back(std::move(balance));
+    return result;
+}
+
+std::expected<std::vector<FeeInstallment>, Error> CsvInstallmentDao::getOpenDueBetween(const std::string& fromDate, const std::string& toDate) const {
+    auto open = scanOpen(*_table, [&](const std::string& dueDate) { return dueDate >= fromDate && dueDate <= toDate; });
+    if (!open) return open;
+    std::sort(open->begin(), open->end(), [](const FeeInstallment& a, const FeeInstallment& b) {
+        return a.dueDate != b.dueDate ? a.dueDate < b.dueDate : (a.studentId != b.studentId ? a.studentId < b.studentId : a.sequence < b.sequence);
+    });
+    return open;
+}
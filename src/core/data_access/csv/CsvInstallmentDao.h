@@ -0,0 +1,59 @@
+#ifndef CSVINSTALLMENTDAO_H
+#define CSVINSTALLMENTDAO_H
+
+/**
+ * @file CsvInstallmentDao.h
+ * @brief CSV implementation of the fee installment schedule data access object
+ */
+
+#include "../interface/IInstallmentDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvInstallmentDao
+ * @brief CSV implementation of IInstallmentDao on top of a shared CsvTable keyed by (studentId, sequence)
+ *
+ * CsvTable only has hash indexes, so due-date queries scan the table once; per-student reads use the
+ * studentId index.
+ */
+class CsvInstallmentDao : public IInstallmentDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per installment
+
+public:
+    static constexpr std::size_t STUDENT_ID = 0;  ///< Column of the student ID (key, indexed)
+    static constexpr std::size_t SEQUENCE = 1;    ///< Column of the installment number (key)
+    static constexpr std::size_t DUE_DATE = 2;    ///< Column of the due date "YYYY-MM-DD"
+    static constexpr std::size_t AMOUNT = 3;      ///< Column of the installment amount
+    static constexpr std::size_t PAID_AMOUNT = 4; ///< Column of the amount allocated so far
+    static constexpr std::size_t IS_LATE = 5;     ///< Column of the late flag ("0" or "1")
+
+    /**
+     * @brief Column layout of the fee installments file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvInstallmentDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvInstallmentDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvInstallmentDao() override = default;
+
+    std::expected<std::vector<FeeInstallment>, Error> getByStudent(const std::string& studentId) const override;
+
+    /**
+     * @brief Upserts the new rows with one journal append, then erases sequences the new schedule no longer has
+     */
+    std::expected<bool, Error> replaceSchedule(const std::string& studentId, const std::vector<FeeInstallment>& installments) override;
+
+    std::expected<bool, Error> allocatePaid(const std::string& studentId, long paidTotal) override;
+    std::expected<std::size_t, Error> markLate(const std::string& asOfDate) override;
+    std::expected<std::vector<OverdueBalance>, Error> sumOverdue(const std::string& asOfDate) const override;
+    std::expected<std::vector<FeeInstallment>, Error> getOpenDueBetween(const std::string& fromDate, const std::string& toDate) const override;
+};
+
+#endif // CSVINSTALLMENTDAO_H
@@ -0,0 +1,77 @@
+#include "CsvLoginDao.h"
+#include "CsvDaoUtils.h"
+#include "../../parsing/impl_csv_parser/LoginCredentialsCsvParser.h"
+
+CsvLoginDao::CsvLoginDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<LoginCredentials, CsvRow>> parser)
+    : _table(std::move(table)), _parser(std::move(parser)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvLoginDao");
+}
+
+std::expected<LoginCredentials, Error> CsvLoginDao::findCredentialsByUserId(const std::string& userId) const {
+    auto row = _table->find(userId);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Login credentials for User ID " + userId + " not found."});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<bool, Error> CsvLoginDao::addUserCredentials(const std::string& userId, const std::string& passwordHash, const std::string& salt, UserRole role, LoginStatus status) {
+    auto row = _parser->serialize(LoginCredentials{userId, passwordHash, salt, role, status});
+    if (!row) return std::unexpected(row.error());
+    return _table->insert(std::move(*row));
+}
+
+std::expected<bool, Error> CsvLoginDao::addUserCredentialsBatch(const std::vector<LoginCredentials>& credentials) {
+    std::vector<CsvRow> rows;
+    rows.reserve(credentials.size());
+    for (const auto& creds : credentials) {
+        auto row = _parser->serialize(creds);
+        if (!row) return std::unexpected(row.error());
+        rows.push_back(std::move(*row));
+    }
+    return _table->insertMany(std::move(rows));
+}
+
+std::expected<bool, Error> CsvLoginDao::updatePassword(const std::string& userId, const std::string& newPasswordHash, const std::string& newSalt) {
+    auto credentials = findCredentialsByUserId(userId);
+    if (!credentials) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "User ID " + userId + " not found for password update."});
+    }
+    credentials->passwordHash = newPasswordHash;
+    credentials->salt = newSalt;
+    auto row = _parser->serialize(*credentials);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<bool, Error> CsvLoginDao::removeUserCredentials(const std::string& userId) {
+    return _table->erase(userId);
+}
+
+std::expected<UserRole, Error> CsvLoginDao::getUserRole(const std::string& userId) const {
+    auto credentials = findCredentialsByUserId(userId);
+    if (!credentials) return std::unexpected(credentials.error());
+    return credentials->role;
+}
+
+std::expected<LoginStatus, Error> CsvLoginDao::getUserStatus(const std::string& userId) const {
+    auto credentials = findCredentialsByUserId(userId);
+    if (!credentials) return std::unexpected(credentials.error());
+    return credentials->status;
+}
+
+std::expected<bool, Error> CsvLoginDao::updateUserRoleAndStatus(const std::string& userId, UserRole newRole, LoginStatus newStatus) {
+    auto credentials = findCredentialsByUserId(userId);
+    if (!credentials) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "User ID " + userId + " not found for role/status update."});
+    }
+    credentials->role = newRole;
+    credentials->status = newStatus;
+    auto row = _parser->serialize(*credentials);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<std::vector<LoginCredentials>, Error> CsvLoginDao::findByStatus(LoginStatus status) const {
+    return CsvDaoUtils::parseRows(_table->findBy(LoginCredentialsCsvParser::STATUS, std::to_string(static_cast<int>(status))), *_parser);
+}
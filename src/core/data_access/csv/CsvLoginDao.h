@@ -0,0 +1,47 @@
+#ifndef CSVLOGINDAO_H
+#define CSVLOGINDAO_H
+
+/**
+ * @file CsvLoginDao.h
+ * @brief CSV implementation of the login credentials data access object
+ */
+
+#include "../interface/ILoginDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvLoginDao
+ * @brief CSV implementation of ILoginDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvLoginDao : public ILoginDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the login credentials rows
+    std::shared_ptr<IEntityParser<LoginCredentials, CsvRow>> _parser; ///< Parser converting rows to LoginCredentials objects
+
+public:
+    /**
+     * @brief Constructor for CsvLoginDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to LoginCredentials objects
+     * @throws std::invalid_argument if table or parser is null
+     */
+    CsvLoginDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<LoginCredentials, CsvRow>> parser);
+
+    ~CsvLoginDao() override = default;
+
+    std::expected<LoginCredentials, Error> findCredentialsByUserId(const std::string& userId) const override;
+    std::expected<bool, Error> addUserCredentials(const std::string& userId, const std::string& passwordHash, const std::string& salt, UserRole role, LoginStatus status) override;
+    std::expected<bool, Error> addUserCredentialsBatch(const std::vector<LoginCredentials>& credentials) override;
+    std::expected<bool, Error> updatePassword(const std::string& userId, const std::string& newPasswordHash, const std::string& newSalt) override;
+    std::expected<bool, Error> removeUserCredentials(const std::string& userId) override;
+    std::expected<UserRole, Error> getUserRole(const std::string& userId) const override;
+    std::expected<LoginStatus, Error> getUserStatus(const std::string& userId) const override;
+    std::expected<bool, Error> updateUserRoleAndStatus(const std::string& userId, UserRole newRole, LoginStatus newStatus) override;
+    std::expected<std::vector<LoginCredentials>, Error> findByStatus(LoginStatus status) const override;
+};
+
+#endif // CSVLOGINDAO_H
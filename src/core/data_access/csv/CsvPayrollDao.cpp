@@ -0,0 +1,101 @@
+#include "CsvPayrollDao.h"
+#include <algorithm>
+#include <charconv>
+#include <map>
+#include <stdexcept>
+
+namespace {
+    std::expected<long, Error> parseAmount(const CsvTable::Row& row, std::size_t column) {
+        long value = 0;
+        const std::string& text = row[column];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid amount '" + text + "' in salary payment of teacher '" +
+                                                                   row[CsvPayrollDao::TEACHER_ID] + "'."});
+        }
+        return value;
+    }
+
+    std::expected<SalaryPayment, Error> parsePayment(const CsvTable::Row& row) {
+        auto basicPay = parseAmount(row, CsvPayrollDao::BASIC_PAY);
+        if (!basicPay) return std::unexpected(basicPay.error());
+        auto allowance = parseAmount(row, CsvPayrollDao::ALLOWANCE);
+        if (!allowance) return std::unexpected(allowance.error());
+        return SalaryPayment{row[CsvPayrollDao::TEACHER_ID], row[CsvPayrollDao::PERIOD], basicPay.value(), allowance.value()};
+    }
+
+    std::expected<std::vector<SalaryPayment>, Error> parsePayments(const std::vector<CsvTable::Row>& rows) {
+        std::vector<SalaryPayment> payments;
+        payments.reserve(rows.size());
+        for (const auto& row : rows) {
+            auto payment = parsePayment(row);
+            if (!payment) return std::unexpected(payment.error());
+            payments.push_back(std::move(payment.value()));
+        }
+        return payments;
+    }
+}
+
+CsvTableSchema CsvPayrollDao::schema() {
+    return {{"period", "teacherId", "basicPay", "allowance"}, {PERIOD, TEACHER_ID}, {PERIOD, TEACHER_ID}};
+}
+
+CsvPayrollDao::CsvPayrollDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvPayrollDao: table cannot be null.");
+    }
+}
+
+std::expected<std::vector<SalaryPayment>, Error> CsvPayrollDao::getByPeriod(const std::string& period) const {
+    auto payments = parsePayments(_table->findBy(PERIOD, period));
+    if (!payments) return payments;
+    std::sort(payments->begin(), payments->end(), [](const SalaryPayment& a, const SalaryPayment& b) {
+        return a.teacherId < b.teacherId;
+    });
+    return payments;
+}
+
+std::expected<std::vector<SalaryPayment>, Error> CsvPayrollDao::getByTeacher(const std::string& teacherId) const {
+    auto payments = parsePayments(_table->findBy(TEACHER_ID, teacherId));
+    if (!payments) return payments;
+    std::sort(payments->begin(), payments->end(), [](const SalaryPayment& a, const SalaryPayment& b) {
+        return a.period < b.period;
+    });
+    return payments;
+}
+
+std::expected<bool, Error> CsvPayrollDao::upsertBatch(const std::vector<SalaryPayment>& payments) {
+    std::vector<CsvTable::Row> rows;
+    rows.reserve(payments.size());
+    for (const auto& payment : payments) {
+        if (payment.teacherId.empty() || payment.period.size() != 7 || payment.basicPay < 0 || payment.allowance < 0) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid salary payment for teacher '" + payment.teacherId + "'."});
+        }
+        rows.push_back({payment.period, payment.teacherId, std::to_string(payment.basicPay), std::to_string(payment.allowance)});
+    }
+    return _table->upsertMany(std::move(rows));
+}
+
+std::expected<std::vector<PayrollYearToDate>, Error> CsvPayrollDao::sumYearToDate(int year, int throughMonth) const {
+    if (throughMonth < 1 || throughMonth > 12) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Month must be between 1 and 12."});
+    }
+    std::map<std::string, PayrollYearToDate> totals;
+    // One period-index lookup per month instead of scanning every year in the file
+    for (int month = 1; month <= throughMonth; ++month) {
+        for (const auto& row : _table->findBy(PERIOD, payrollPeriod(year, month))) {
+            auto payment = parsePayment(row);
+            if (!payment) return std::unexpected(payment.error());
+            PayrollYearToDate& total = totals[payment->teacherId];
+            total.teacherId = payment->teacherId;
+            ++total.months;
+            total.totalBasic += payment->basicPay;
+            total.totalAllowance += payment->allowance;
+        }
+    }
+
+    std::vector<PayrollYearToDate> result;
+    result.reserve(totals.size());
+    for (auto& [teacherId, total] : totals) result.push_back(std::move(total));
+    return result;
+}
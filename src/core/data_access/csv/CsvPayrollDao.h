@@ -0,0 +1,50 @@
+#ifndef CSVPAYROLLDAO_H
+#define CSVPAYROLLDAO_H
+
+/**
+ * @file CsvPayrollDao.h
+ * @brief CSV implementation of the monthly payroll history data access object
+ */
+
+#include "../interface/IPayrollDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvPayrollDao
+ * @brief CSV implementation of IPayrollDao on top of a shared CsvTable keyed by (period, teacherId)
+ *
+ * Period and teacher lookups go through the table's hash indexes; a batch is written with a single
+ * journal append, so it is applied entirely or not at all.
+ */
+class CsvPayrollDao : public IPayrollDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per teacher and period
+
+public:
+    static constexpr std::size_t PERIOD = 0;     ///< Column of the payroll period "YYYY-MM" (key, indexed)
+    static constexpr std::size_t TEACHER_ID = 1; ///< Column of the teacher ID (key, indexed)
+    static constexpr std::size_t BASIC_PAY = 2;  ///< Column of the basic pay of the month
+    static constexpr std::size_t ALLOWANCE = 3;  ///< Column of the allowance of the month
+
+    /**
+     * @brief Column layout of the salary payments file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvPayrollDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvPayrollDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvPayrollDao() override = default;
+
+    std::expected<std::vector<SalaryPayment>, Error> getByPeriod(const std::string& period) const override;
+    std::expected<std::vector<SalaryPayment>, Error> getByTeacher(const std::string& teacherId) const override;
+    std::expected<bool, Error> upsertBatch(const std::vector<SalaryPayment>& payments) override;
+    std::expected<std::vector<PayrollYearToDate>, Error> sumYearToDate(int year, int throughMonth) const override;
+};
+
+#endif // CSVPAYROLLDAO_H
@@ -0,0 +1,41 @@
+#include "CsvPrerequisiteDao.h"
+#include <stdexcept>
+
+CsvTableSchema CsvPrerequisiteDao::schema() {
+    return {{"courseId", "prerequisiteId"}, {COURSE_ID, PREREQUISITE_ID}, {COURSE_ID}};
+}
+
+CsvPrerequisiteDao::CsvPrerequisiteDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvPrerequisiteDao: table cannot be null.");
+    }
+}
+
+std::expected<bool, Error> CsvPrerequisiteDao::add(const CoursePrerequisite& prerequisite) {
+    if (prerequisite.courseId.empty() || prerequisite.prerequisiteId.empty() || prerequisite.courseId == prerequisite.prerequisiteId) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid prerequisite '" + prerequisite.prerequisiteId + "' for course '" + prerequisite.courseId + "'."});
+    }
+    auto inserted = _table->insert({prerequisite.courseId, prerequisite.prerequisiteId});
+    if (!inserted && inserted.error().code == ErrorCode::ALREADY_EXISTS) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Course " + prerequisite.prerequisiteId + " is already a prerequisite of course " + prerequisite.courseId + "."});
+    }
+    return inserted;
+}
+
+std::expected<bool, Error> CsvPrerequisiteDao::remove(const std::string& courseId, const std::string& prerequisiteId) {
+    auto erased = _table->erase(CsvTable::compositeKey({courseId, prerequisiteId}));
+    if (!erased && erased.error().code == ErrorCode::NOT_FOUND) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course " + prerequisiteId + " is not a prerequisite of course " + courseId + "."});
+    }
+    return erased;
+}
+
+std::expected<std::vector<CoursePrerequisite>, Error> CsvPrerequisiteDao::getAll() const {
+    std::vector<CoursePrerequisite> prerequisites;
+    prerequisites.reserve(_table->size());
+    _table->forEachRow([&prerequisites](const CsvTable::Row& row) {
+        prerequisites.push_back(CoursePrerequisite{row[COURSE_ID], row[PREREQUISITE_ID]});
+        return true;
+    });
+    return prerequisites;
+}
@@ -0,0 +1,44 @@
+#ifndef CSVPREREQUISITEDAO_H
+#define CSVPREREQUISITEDAO_H
+
+/**
+ * @file CsvPrerequisiteDao.h
+ * @brief CSV implementation of the course prerequisite data access object
+ */
+
+#include "../interface/IPrerequisiteDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvPrerequisiteDao
+ * @brief CSV implementation of IPrerequisiteDao on top of a shared CsvTable keyed by (courseId, prerequisiteId)
+ */
+class CsvPrerequisiteDao : public IPrerequisiteDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per direct prerequisite
+
+public:
+    static constexpr std::size_t COURSE_ID = 0;       ///< Column of the course ID (key, indexed)
+    static constexpr std::size_t PREREQUISITE_ID = 1; ///< Column of the prerequisite course ID (key)
+
+    /**
+     * @brief Column layout of the prerequisite file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvPrerequisiteDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvPrerequisiteDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvPrerequisiteDao() override = default;
+
+    std::expected<bool, Error> add(const CoursePrerequisite& prerequisite) override;
+    std::expected<bool, Error> remove(const std::string& courseId, const std::string& prerequisiteId) override;
+    std::expected<std::vector<CoursePrerequisite>, Error> getAll() const override;
+};
+
+#endif // CSVPREREQUISITEDAO_H
@@ -0,0 +1,53 @@
+#include "CsvSalaryRecordDao.h"
+#include "CsvDaoUtils.h"
+
+CsvSalaryRecordDao::CsvSalaryRecordDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<SalaryRecord, CsvRow>> parser)
+    : _table(std::move(table)), _parser(std::move(parser)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvSalaryRecordDao");
+}
+
+std::expected<SalaryRecord, Error> CsvSalaryRecordDao::getById(const std::string& teacherId) const {
+    auto row = _table->find(teacherId);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "SalaryRecord for Teacher ID " + teacherId + " not found."});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<std::vector<SalaryRecord>, Error> CsvSalaryRecordDao::getAll() const {
+    return CsvDaoUtils::parseRows(_table->all(), *_parser);
+}
+
+std::expected<std::size_t, Error> CsvSalaryRecordDao::forEach(const std::function<bool(const SalaryRecord&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
+
+std::expected<SalaryRecord, Error> CsvSalaryRecordDao::add(const SalaryRecord& salaryRecord) {
+    ValidationResult vr = salaryRecord.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid SalaryRecord data: " + vr.getErrorMessagesCombined()});
+    }
+    auto row = _parser->serialize(salaryRecord);
+    if (!row) return std::unexpected(row.error());
+    auto inserted = _table->insert(std::move(*row));
+    if (!inserted) return std::unexpected(inserted.error());
+    return salaryRecord;
+}
+
+std::expected<bool, Error> CsvSalaryRecordDao::update(const SalaryRecord& salaryRecord) {
+    ValidationResult vr = salaryRecord.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid SalaryRecord data: " + vr.getErrorMessagesCombined()});
+    }
+    auto row = _parser->serialize(salaryRecord);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<bool, Error> CsvSalaryRecordDao::remove(const std::string& teacherId) {
+    return _table->erase(teacherId);
+}
+
+std::expected<bool, Error> CsvSalaryRecordDao::exists(const std::string& teacherId) const {
+    return _table->contains(teacherId);
+}
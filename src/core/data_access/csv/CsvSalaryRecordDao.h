@@ -0,0 +1,45 @@
+#ifndef CSVSALARYRECORDDAO_H
+#define CSVSALARYRECORDDAO_H
+
+/**
+ * @file CsvSalaryRecordDao.h
+ * @brief CSV implementation of the salary record data access object
+ */
+
+#include "../interface/ISalaryRecordDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvSalaryRecordDao
+ * @brief CSV implementation of ISalaryRecordDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvSalaryRecordDao : public ISalaryRecordDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the salary record rows
+    std::shared_ptr<IEntityParser<SalaryRecord, CsvRow>> _parser; ///< Parser converting rows to SalaryRecord objects
+
+public:
+    /**
+     * @brief Constructor for CsvSalaryRecordDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to SalaryRecord objects
+     * @throws std::invalid_argument if table or parser is null
+     */
+    CsvSalaryRecordDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<SalaryRecord, CsvRow>> parser);
+
+    ~CsvSalaryRecordDao() override = default;
+
+    std::expected<SalaryRecord, Error> getById(const std::string& teacherId) const override;
+    std::expected<std::vector<SalaryRecord>, Error> getAll() const override;
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const SalaryRecord&)>& visitor) const override;
+    std::expected<SalaryRecord, Error> add(const SalaryRecord& salaryRecord) override;
+    std::expected<bool, Error> update(const SalaryRecord& salaryRecord) override;
+    std::expected<bool, Error> remove(const std::string& teacherId) override;
+    std::expected<bool, Error> exists(const std::string& teacherId) const override;
+};
+
+#endif // CSVSALARYRECORDDAO_H
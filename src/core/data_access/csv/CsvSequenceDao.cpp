@@ -0,0 +1,57 @@
+#include "CsvSequenceDao.h"
+#include <charconv>
+#include <stdexcept>
+
+namespace {
+    std::mutex sequenceWriteMutex; // Tuần tự hóa đọc-sửa-ghi của mọi CsvSequenceDao
+
+    std::expected<long long, Error> parseValue(const CsvTable::Row& row) {
+        long long value = 0;
+        const std::string& text = row[CsvSequenceDao::VALUE];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid value '" + text + "' for sequence '" + row[CsvSequenceDao::NAME] + "'."});
+        }
+        return value;
+    }
+}
+
+CsvTableSchema CsvSequenceDao::schema() {
+    return {{"name", "value"}, {NAME}, {}};
+}
+
+CsvSequenceDao::CsvSequenceDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvSequenceDao: table cannot be null.");
+    }
+}
+
+std::expected<long long, Error> CsvSequenceDao::getValue(const std::string& name) const {
+    auto row = _table->find(name);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Sequence '" + name + "' not found."});
+    }
+    return parseValue(*row);
+}
+
+std::expected<long long, Error> CsvSequenceDao::advance(const std::string& name, long long count) {
+    std::lock_guard<std::mutex> lock(sequenceWriteMutex);
+    auto current = getValue(name);
+    if (!current) return std::unexpected(current.error());
+    long long next = current.value() + count;
+    auto updated = _table->update({name, std::to_string(next)});
+    if (!updated) return std::unexpected(updated.error());
+    return next;
+}
+
+std::expected<bool, Error> CsvSequenceDao::raiseTo(const std::string& name, long long value) {
+    std::lock_guard<std::mutex> lock(sequenceWriteMutex);
+    auto current = getValue(name);
+    if (current.has_value() && current.value() >= value) return true;
+    if (!current.has_value() && current.error().code != ErrorCode::NOT_FOUND) return std::unexpected(current.error());
+    return _table->upsert({name, std::to_string(value)});
+}
+
+std::expected<std::size_t, Error> CsvSequenceDao::count() const {
+    return _table->size();
+}
@@ -0,0 +1,49 @@
+#ifndef CSVSEQUENCEDAO_H
+#define CSVSEQUENCEDAO_H
+
+/**
+ * @file CsvSequenceDao.h
+ * @brief CSV implementation of the sequence counter data access object
+ */
+
+#include "../interface/ISequenceDao.h"
+#include "CsvTable.h"
+#include <memory>
+#include <mutex>
+
+/**
+ * @class CsvSequenceDao
+ * @brief CSV implementation of ISequenceDao on top of a shared CsvTable with columns (name, value)
+ *
+ * CsvTable has no read-modify-write primitive, so advance() and raiseTo() are serialized by a mutex
+ * shared by every DAO created over the same table.
+ */
+class CsvSequenceDao : public ISequenceDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per sequence
+
+public:
+    static constexpr std::size_t NAME = 0;  ///< Column of the sequence name (primary key)
+    static constexpr std::size_t VALUE = 1; ///< Column of the last allocated value
+
+    /**
+     * @brief Column layout of the sequences file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvSequenceDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvSequenceDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvSequenceDao() override = default;
+
+    std::expected<long long, Error> getValue(const std::string& name) const override;
+    std::expected<long long, Error> advance(const std::string& name, long long count) override;
+    std::expected<bool, Error> raiseTo(const std::string& name, long long value) override;
+    std::expected<std::size_t, Error> count() const override;
+};
+
+#endif // CSVSEQUENCEDAO_H
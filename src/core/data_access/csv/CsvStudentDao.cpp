@@ -0,0 +1,115 @@
+#include "CsvStudentDao.h"
+#include "CsvDaoUtils.h"
+#include "../../parsing/impl_csv_parser/StudentCsvParser.h"
+
+CsvStudentDao::CsvStudentDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Student, CsvRow>> parser,
+                             std::vector<CsvCascade> cascades)
+    : _table(std::move(table)), _parser(std::move(parser)), _cascades(std::move(cascades)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvStudentDao");
+}
+
+std::expected<Student, Error> CsvStudentDao::getById(const std::string& id) const {
+    auto row = _table->find(id);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student with ID " + id + " not found."});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<std::vector<Student>, Error> CsvStudentDao::getAll() const {
+    return CsvDaoUtils::parseRows(_table->all(), *_parser);
+}
+
+std::expected<std::size_t, Error> CsvStudentDao::forEach(const std::function<bool(const Student&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
+
+std::expected<Student, Error> CsvStudentDao::add(const Student& student) {
+    ValidationResult vr = student.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Student data for add: " + vr.getErrorMessagesCombined()});
+    }
+    if (!student.getEmail().empty() && !_table->findBy(StudentCsvParser::EMAIL, student.getEmail()).empty()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Email " + student.getEmail() + " already exists for another user."});
+    }
+    auto row = _parser->serialize(student);
+    if (!row) return std::unexpected(row.error());
+    auto inserted = _table->insert(std::move(*row));
+    if (!inserted) return std::unexpected(inserted.error());
+    return student;
+}
+
+std::expected<bool, Error> CsvStudentDao::addBatch(const std::vector<Student>& students) {
+    std::vector<CsvRow> rows;
+    rows.reserve(students.size());
+    std::unordered_set<std::string> batchEmails;
+    for (const auto& student : students) {
+        ValidationResult vr = student.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Student data for " + student.getId() + ": " + vr.getErrorMessagesCombined()});
+        }
+        const std::string& email = student.getEmail();
+        if (!email.empty() && (!batchEmails.insert(email).second || !_table->findBy(StudentCsvParser::EMAIL, email).empty())) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Email " + email + " already exists for another user."});
+        }
+        auto row = _parser->serialize(student);
+        if (!row) return std::unexpected(row.error());
+        rows.push_back(std::move(*row));
+    }
+    return _table->insertMany(std::move(rows));
+}
+
+std::expected<bool, Error> CsvStudentDao::update(const Student& student) {
+    ValidationResult vr = student.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Student data for update: " + vr.getErrorMessagesCombined()});
+    }
+    if (!student.getEmail().empty()) {
+        for (const auto& other : _table->findBy(StudentCsvParser::EMAIL, student.getEmail())) {
+            if (other[StudentCsvParser::ID] != student.getId()) {
+                return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Email " + student.getEmail() + " conflicts with another student."});
+            }
+        }
+    }
+    auto row = _parser->serialize(student);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<bool, Error> CsvStudentDao::remove(const std::string& id) {
+    return CsvDaoUtils::eraseWithCascades(*_table, _cascades, id);
+}
+
+std::expected<bool, Error> CsvStudentDao::exists(const std::string& id) const {
+    return _table->contains(id);
+}
+
+std::expected<std::vector<Student>, Error> CsvStudentDao::findByFacultyId(const std::string& facultyId) const {
+    return CsvDaoUtils::parseRows(_table->findBy(StudentCsvParser::FACULTY_ID, facultyId), *_parser);
+}
+
+std::expected<Student, Error> CsvStudentDao::findByEmail(const std::string& email) const {
+    auto rows = _table->findBy(StudentCsvParser::EMAIL, email);
+    if (rows.empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student with email " + email + " not found."});
+    }
+    return _parser->parse(rows.front());
+}
+
+std::expected<std::vector<Student>, Error> CsvStudentDao::findByStatus(LoginStatus status) const {
+    return CsvDaoUtils::parseRows(_table->findBy(StudentCsvParser::STATUS, std::to_string(static_cast<int>(status))), *_parser);
+}
+
+std::expected<bool, Error> CsvStudentDao::updateStatus(const std::string& studentId, LoginStatus newStatus) {
+    auto student = getById(studentId);
+    if (!student) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student with ID " + studentId + " not found for status update."});
+    }
+    student->setStatus(newStatus);
+    if (student->getRole() == UserRole::PENDING_STUDENT && newStatus == LoginStatus::ACTIVE) {
+        student->setRole(UserRole::STUDENT);
+    }
+    auto row = _parser->serialize(*student);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
@@ -0,0 +1,67 @@
+#ifndef CSVSTUDENTDAO_H
+#define CSVSTUDENTDAO_H
+
+/**
+ * @file CsvStudentDao.h
+ * @brief CSV implementation of the student data access object
+ */
+
+#include "../interface/IStudentDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include "CsvDaoUtils.h"
+#include <memory>
+
+/**
+ * @class CsvStudentDao
+ * @brief CSV implementation of IStudentDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvStudentDao : public IStudentDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the student rows
+    std::shared_ptr<IEntityParser<Student, CsvRow>> _parser; ///< Parser converting rows to Student objects
+    std::vector<CsvCascade> _cascades; ///< Tables whose rows referencing a removed student are deleted with it
+
+public:
+    /**
+     * @brief Constructor for CsvStudentDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to Student objects
+     * @param cascades Dependent tables cleaned up by remove(), as the SQL foreign keys do
+     * @throws std::invalid_argument if table or parser is null
+     */
+    CsvStudentDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Student, CsvRow>> parser,
+                  std::vector<CsvCascade> cascades = {});
+
+    ~CsvStudentDao() override = default;
+
+    std::expected<Student, Error> getById(const std::string& id) const override;
+    std::expected<std::vector<Student>, Error> getAll() const override;
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Student&)>& visitor) const override;
+    std::expected<Student, Error> add(const Student& student) override;
+    std::expected<bool, Error> update(const Student& student) override;
+    std::expected<bool, Error> remove(const std::string& id) override;
+    std::expected<bool, Error> exists(const std::string& id) const override;
+
+    /**
+     * @brief Finds students of a faculty through the facultyId index
+     */
+    std::expected<std::vector<Student>, Error> findByFacultyId(const std::string& facultyId) const override;
+
+    /**
+     * @brief Finds a student through the email index
+     */
+    std::expected<Student, Error> findByEmail(const std::string& email) const override;
+
+    std::expected<std::vector<Student>, Error> findByStatus(LoginStatus status) const override;
+    std::expected<bool, Error> updateStatus(const std::string& studentId, LoginStatus newStatus) override;
+
+    /**
+     * @brief Inserts several students with one journal write, rejecting emails already in use
+     */
+    std::expected<bool, Error> addBatch(const std::vector<Student>& students) override;
+};
+
+#endif // CSVSTUDENTDAO_H
@@ -0,0 +1,591 @@
+#include "CsvTable.h"
+#include "../../../utils/MappedFile.h"
+#include "../../../utils/CsvTokenizer.h"
+#include "../../../utils/Logger.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+    constexpr char KEY_SEPARATOR = '\x1F'; // Unit separator: không xuất hiện trong dữ liệu nhập từ bàn phím
+    constexpr std::string_view OP_UPSERT = "U";
+    constexpr std::string_view OP_DELETE = "D";
+
+    bool isBlankRecord(const std::vector<std::string_view>& fields) {
+        return fields.size() == 1 && CsvTokenizer::trimView(fields[0]).empty();
+    }
+}
+
+CsvTable::CsvTable(std::filesystem::path filePath, CsvTableSchema schema, std::size_t compactionThreshold)
+    : _filePath(std::move(filePath)),
+      _schema(std::move(schema)),
+      _compactionThreshold(compactionThreshold == 0 ? 1 : compactionThreshold),
+      _indexes(_schema.indexedColumns.size()) {
+    _journalPath = _filePath;
+    _journalPath += ".journal";
+    _compactingJournalPath = _filePath;
+    _compactingJournalPath += ".journal.compacting";
+}
+
+CsvTable::~CsvTable() {
+    waitForCompaction();
+    std::unique_lock lock(_mutex);
+    if (_journal.is_open()) _journal.close();
+}
+
+std::string CsvTable::compositeKey(std::initializer_list<std::string_view> parts) {
+    std::string key;
+    bool first = true;
+    for (auto part : parts) {
+        if (!first) key.push_back(KEY_SEPARATOR);
+        key.append(part);
+        first = false;
+    }
+    return key;
+}
+
+std::string CsvTable::keyOf(const Row& row) const {
+    if (_schema.keyColumns.size() == 1) return row[_schema.keyColumns.front()];
+    std::string key;
+    for (std::size_t i = 0; i < _schema.keyColumns.size(); ++i) {
+        if (i > 0) key.push_back(KEY_SEPARATOR);
+        key += row[_schema.keyColumns[i]];
+    }
+    return key;
+}
+
+std::expected<bool, Error> CsvTable::checkRow(const Row& row) const {
+    if (row.size() != _schema.columns.size()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "CSV row for " + _filePath.filename().string() + " has " +
+            std::to_string(row.size()) + " fields, expected " + std::to_string(_schema.columns.size())});
+    }
+    for (auto column : _schema.keyColumns) {
+        if (row[column].empty()) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Key column '" + _schema.columns[column] + "' cannot be empty"});
+        }
+    }
+    return true;
+}
+
+std::optional<std::size_t> CsvTable::indexSlot(std::size_t column) const {
+    auto it = std::find(_schema.indexedColumns.begin(), _schema.indexedColumns.end(), column);
+    if (it == _schema.indexedColumns.end()) return std::nullopt;
+    return static_cast<std::size_t>(it - _schema.indexedColumns.begin());
+}
+
+void CsvTable::applyUpsert(Row row) {
+    std::string key = keyOf(row);
+    auto existing = _rows.find(key);
+    for (std::size_t slot = 0; slot < _indexes.size(); ++slot) {
+        std::size_t column = _schema.indexedColumns[slot];
+        if (existing != _rows.end()) {
+            if (existing->second[column] == row[column]) continue;
+            auto bucket = _indexes[slot].find(existing->second[column]);
+            if (bucket != _indexes[slot].end()) {
+                bucket->second.erase(key);
+                if (bucket->second.empty()) _indexes[slot].erase(bucket);
+            }
+        }
+        _indexes[slot][row[column]].insert(key);
+    }
+    if (existing != _rows.end()) {
+        existing->second = std::move(row);
+    } else {
+        _rows.emplace(std::move(key), std::move(row));
+    }
+}
+
+bool CsvTable::applyErase(const std::string& key) {
+    auto it = _rows.find(key);
+    if (it == _rows.end()) return false;
+    for (std::size_t slot = 0; slot < _indexes.size(); ++slot) {
+        auto bucket = _indexes[slot].find(it->second[_schema.indexedColumns[slot]]);
+        if (bucket != _indexes[slot].end()) {
+            bucket->second.erase(key);
+            if (bucket->second.empty()) _indexes[slot].erase(bucket);
+        }
+    }
+    _rows.erase(it);
+    return true;
+}
+
+std::vector<CsvTable::Row> CsvTable::copySorted(std::vector<std::pair<const std::string*, const Row*>>& entries) {
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return *a.first < *b.first; });
+    std::vector<Row> result;
+    result.reserve(entries.size());
+    for (const auto& entry : entries) result.push_back(*entry.second);
+    return result;
+}
+
+std::string CsvTable::formatRecord(const Row& fields) {
+    std::string line;
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        if (i > 0) line.push_back(',');
+        line += CsvTokenizer::escapeField(fields[i]);
+    }
+    line.push_back('\n');
+    return line;
+}
+
+std::string CsvTable::formatLine(std::string_view op, const Row& fields) const {
+    return std::string(op) + "," + formatRecord(fields);
+}
+
+// --- Đọc ---
+
+std::optional<CsvTable::Row> CsvTable::find(const std::string& key) const {
+    std::shared_lock lock(_mutex);
+    auto it = _rows.find(key);
+    if (it == _rows.end()) return std::nullopt;
+    return it->second;
+}
+
+bool CsvTable::contains(const std::string& key) const {
+    std::shared_lock lock(_mutex);
+    return _rows.contains(key);
+}
+
+std::vector<CsvTable::Row> CsvTable::findBy(std::size_t column, const std::string& value) const {
+    std::shared_lock lock(_mutex);
+    std::vector<std::pair<const std::string*, const Row*>> matches;
+    if (auto slot = indexSlot(column)) {
+        auto bucket = _indexes[*slot].find(value);
+        if (bucket == _indexes[*slot].end()) return {};
+        matches.reserve(bucket->second.size());
+        for (const auto& key : bucket->second) {
+            auto it = _rows.find(key);
+            if (it != _rows.end()) matches.emplace_back(&it->first, &it->second);
+        }
+    } else if (column < _schema.columns.size()) {
+        for (const auto& [key, row] : _rows) {
+            if (row[column] == value) matches.emplace_back(&key, &row);
+        }
+    }
+    return copySorted(matches);
+}
+
+std::vector<CsvTable::Row> CsvTable::all() const {
+    std::shared_lock lock(_mutex);
+    std::vector<std::pair<const std::string*, const Row*>> entries;
+    entries.reserve(_rows.size());
+    for (const auto& [key, row] : _rows) entries.emplace_back(&key, &row);
+    return copySorted(entries);
+}
+
+std::size_t CsvTable::forEachRow(const std::function<bool(const Row&)>& visitor) const {
+    std::shared_lock lock(_mutex);
+    std::size_t visited = 0;
+    for (const auto& [key, row] : _rows) {
+        ++visited;
+        if (!visitor(row)) break;
+    }
+    return visited;
+}
+
+std::size_t CsvTable::size() const {
+    std::shared_lock lock(_mutex);
+    return _rows.size();
+}
+
+std::size_t CsvTable::journalEntryCount() const {
+    std::shared_lock lock(_mutex);
+    return _journalEntries;
+}
+
+const std::filesystem::path& CsvTable::getFilePath() const { return _filePath; }
+const CsvTableSchema& CsvTable::getSchema() const { return _schema; }
+
+// --- Ghi ---
+
+std::expected<bool, Error> CsvTable::appendJournal(const std::string& lines, std::size_t entryCount) {
+    if (!_journal.is_open()) {
+        return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "CSV table " + _filePath.string() + " is not loaded"});
+    }
+    // Ghi và flush journal trước khi thay đổi dữ liệu trong bộ nhớ
+    _journal.write(lines.data(), static_cast<std::streamsize>(lines.size()));
+    _journal.flush();
+    if (!_journal.good()) {
+        _journal.clear();
+        return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Failed to append to journal " + _journalPath.string()});
+    }
+    _journalEntries += entryCount;
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::insert(Row row) {
+    if (auto check = checkRow(row); !check) return check;
+    std::unique_lock lock(_mutex);
+    if (_rows.contains(keyOf(row))) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Record with key " + keyOf(row) + " already exists in " + _filePath.filename().string()});
+    }
+    if (auto written = appendJournal(formatLine(OP_UPSERT, row), 1); !written) return written;
+    applyUpsert(std::move(row));
+    maybeStartCompactionLocked();
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::insertIfFewer(Row row, std::size_t column, std::size_t limit) {
+    if (auto check = checkRow(row); !check) return check;
+    std::unique_lock lock(_mutex);
+    if (_rows.contains(keyOf(row))) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Record with key " + keyOf(row) + " already exists in " + _filePath.filename().string()});
+    }
+    std::size_t count = 0;
+    if (auto slot = indexSlot(column)) {
+        auto bucket = _indexes[*slot].find(row[column]);
+        if (bucket != _indexes[*slot].end()) count = bucket->second.size();
+    } else {
+        for (const auto& [key, existing] : _rows) {
+            if (existing[column] == row[column]) ++count;
+        }
+    }
+    if (count >= limit) {
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Limit of " + std::to_string(limit) + " rows for '" + row[column] +
+                                                                 "' reached in " + _filePath.filename().string()});
+    }
+    if (auto written = appendJournal(formatLine(OP_UPSERT, row), 1); !written) return written;
+    applyUpsert(std::move(row));
+    maybeStartCompactionLocked();
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::update(Row row) {
+    if (auto check = checkRow(row); !check) return check;
+    std::unique_lock lock(_mutex);
+    if (!_rows.contains(keyOf(row))) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Record with key " + keyOf(row) + " not found in " + _filePath.filename().string()});
+    }
+    if (auto written = appendJournal(formatLine(OP_UPSERT, row), 1); !written) return written;
+    applyUpsert(std::move(row));
+    maybeStartCompactionLocked();
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::upsert(Row row) {
+    if (auto check = checkRow(row); !check) return check;
+    std::unique_lock lock(_mutex);
+    if (auto written = appendJournal(formatLine(OP_UPSERT, row), 1); !written) return written;
+    applyUpsert(std::move(row));
+    maybeStartCompactionLocked();
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::upsertMany(std::vector<Row> rows) {
+    std::string lines;
+    for (const auto& row : rows) {
+        if (auto check = checkRow(row); !check) return check;
+        lines += formatLine(OP_UPSERT, row);
+    }
+    if (rows.empty()) return true;
+    std::unique_lock lock(_mutex);
+    if (auto written = appendJournal(lines, rows.size()); !written) return written;
+    for (auto& row : rows) applyUpsert(std::move(row));
+    maybeStartCompactionLocked();
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::insertMany(std::vector<Row> rows) {
+    std::string lines;
+    for (const auto& row : rows) {
+        if (auto check = checkRow(row); !check) return check;
+        lines += formatLine(OP_UPSERT, row);
+    }
+    if (rows.empty()) return true;
+    std::unique_lock lock(_mutex);
+    std::unordered_set<std::string> batchKeys;
+    batchKeys.reserve(rows.size());
+    for (const auto& row : rows) {
+        std::string key = keyOf(row);
+        if (_rows.contains(key) || !batchKeys.insert(key).second) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Record with key " + key + " already exists in " + _filePath.filename().string()});
+        }
+    }
+    if (auto written = appendJournal(lines, rows.size()); !written) return written;
+    for (auto& row : rows) applyUpsert(std::move(row));
+    maybeStartCompactionLocked();
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::erase(const std::string& key) {
+    std::unique_lock lock(_mutex);
+    auto it = _rows.find(key);
+    if (it == _rows.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Record with key " + key + " not found in " + _filePath.filename().string()});
+    }
+    Row keyFields;
+    for (auto column : _schema.keyColumns) keyFields.push_back(it->second[column]);
+    if (auto written = appendJournal(formatLine(OP_DELETE, keyFields), 1); !written) return written;
+    applyErase(key);
+    maybeStartCompactionLocked();
+    return true;
+}
+
+std::expected<std::size_t, Error> CsvTable::eraseBy(std::size_t column, const std::string& value) {
+    std::unique_lock lock(_mutex);
+    std::vector<std::string> keys;
+    if (_schema.keyColumns.size() == 1 && _schema.keyColumns.front() == column) {
+        if (_rows.contains(value)) keys.push_back(value);
+    } else if (auto slot = indexSlot(column)) {
+        auto bucket = _indexes[*slot].find(value);
+        if (bucket != _indexes[*slot].end()) keys.assign(bucket->second.begin(), bucket->second.end());
+    } else if (column < _schema.columns.size()) {
+        for (const auto& [key, row] : _rows) {
+            if (row[column] == value) keys.push_back(key);
+        }
+    }
+    if (keys.empty()) return std::size_t{0};
+
+    std::string lines;
+    for (const auto& key : keys) {
+        const Row& row = _rows.at(key);
+        Row keyFields;
+        for (auto keyColumn : _schema.keyColumns) keyFields.push_back(row[keyColumn]);
+        lines += formatLine(OP_DELETE, keyFields);
+    }
+    if (auto written = appendJournal(lines, keys.size()); !written) return std::unexpected(written.error());
+    for (const auto& key : keys) applyErase(key);
+    maybeStartCompactionLocked();
+    return keys.size();
+}
+
+// --- Nạp dữ liệu ---
+
+std::expected<bool, Error> CsvTable::load() {
+    std::unique_lock lock(_mutex);
+    _rows.clear();
+    for (auto& index : _indexes) index.clear();
+
+    std::error_code ec;
+    if (_filePath.has_parent_path()) std::filesystem::create_directories(_filePath.parent_path(), ec);
+    if (!std::filesystem::exists(_filePath, ec)) {
+        // File mới: ghi header để người dùng có thể mở bằng Excel ngay
+        std::ofstream created(_filePath, std::ios::binary | std::ios::trunc);
+        if (!created) {
+            return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Cannot create CSV file " + _filePath.string()});
+        }
+        created << formatRecord(_schema.columns);
+        LOG_INFO("CsvTable: Created " + _filePath.string());
+    }
+
+    if (auto loaded = loadBaseFile(); !loaded) return loaded;
+
+    std::size_t ignored = 0;
+    bool recoveredCompaction = std::filesystem::exists(_compactingJournalPath, ec);
+    if (recoveredCompaction) {
+        if (auto replayed = replayJournal(_compactingJournalPath, ignored); !replayed) return replayed;
+    }
+    std::size_t journalEntries = 0;
+    if (auto replayed = replayJournal(_journalPath, journalEntries); !replayed) return replayed;
+
+    if (recoveredCompaction) {
+        // Lần compaction trước bị gián đoạn: ghi snapshot đầy đủ ngay để gộp cả hai journal
+        LOG_WARN("CsvTable: Recovering interrupted compaction of " + _filePath.string());
+        std::vector<std::pair<const std::string*, const Row*>> entries;
+        for (const auto& [key, row] : _rows) entries.emplace_back(&key, &row);
+        if (auto written = writeSnapshot(copySorted(entries)); !written) return written;
+        std::filesystem::remove(_journalPath, ec);
+        journalEntries = 0;
+    }
+
+    if (auto opened = openJournal(false); !opened) return opened;
+    _journalEntries = journalEntries;
+    LOG_INFO("CsvTable: Loaded " + std::to_string(_rows.size()) + " rows from " + _filePath.string() +
+             " (" + std::to_string(_journalEntries) + " journal entries)");
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::loadBaseFile() {
+    _fileColumnCount = _schema.columns.size();
+    auto mapped = MappedFile::open(_filePath.string());
+    if (!mapped) return std::unexpected(mapped.error());
+
+    CsvTokenizer tokenizer(mapped->view());
+    std::vector<std::string_view> fields;
+    if (!tokenizer.nextRecord(fields)) return true; // File rỗng
+
+    // Header ngắn hơn schema: file cũ trước khi schema được thêm cột ở cuối
+    if (fields.empty() || fields.size() > _schema.columns.size()) {
+        return std::unexpected(Error{ErrorCode::FILE_FORMAT_ERROR, "Header of " + _filePath.string() + " has " +
+            std::to_string(fields.size()) + " columns, expected " + std::to_string(_schema.columns.size())});
+    }
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+        if (CsvTokenizer::unescapeField(CsvTokenizer::trimView(fields[i])) != _schema.columns[i]) {
+            return std::unexpected(Error{ErrorCode::FILE_FORMAT_ERROR, "Unexpected column '" + std::string(fields[i]) +
+                "' in " + _filePath.string() + ", expected '" + _schema.columns[i] + "'"});
+        }
+    }
+
+    _fileColumnCount = fields.size();
+    if (_fileColumnCount < _schema.columns.size()) {
+        LOG_WARN("CsvTable: " + _filePath.string() + " has " + std::to_string(_fileColumnCount) + " of " +
+                 std::to_string(_schema.columns.size()) + " columns; missing columns read as empty until the next snapshot");
+    }
+
+    _rows.reserve(mapped->size() / 64);
+    while (tokenizer.nextRecord(fields)) {
+        if (isBlankRecord(fields)) continue;
+        if (tokenizer.isRecordMalformed() || fields.size() != _fileColumnCount) {
+            LOG_WARN("CsvTable: Skipping malformed record at " + _filePath.string() + ":" + std::to_string(tokenizer.recordLine()));
+            continue;
+        }
+        Row row;
+        row.reserve(fields.size());
+        for (auto field : fields) row.push_back(CsvTokenizer::unescapeField(field));
+        row.resize(_schema.columns.size());
+        if (!checkRow(row)) {
+            LOG_WARN("CsvTable: Skipping record without key at " + _filePath.string() + ":" + std::to_string(tokenizer.recordLine()));
+            continue;
+        }
+        applyUpsert(std::move(row));
+    }
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::replayJournal(const std::filesystem::path& path, std::size_t& entryCount) {
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) return true;
+    auto mapped = MappedFile::open(path.string());
+    if (!mapped) return std::unexpected(mapped.error());
+
+    CsvTokenizer tokenizer(mapped->view());
+    std::vector<std::string_view> fields;
+    while (tokenizer.nextRecord(fields)) {
+        if (isBlankRecord(fields)) continue;
+        std::string_view op = fields.front();
+        bool valid = !tokenizer.isRecordMalformed() &&
+            ((op == OP_UPSERT && (fields.size() == _schema.columns.size() + 1 || fields.size() == _fileColumnCount + 1)) ||
+             (op == OP_DELETE && fields.size() == _schema.keyColumns.size() + 1));
+        if (!valid) {
+            // Thường là dòng cuối bị ghi dở khi chương trình dừng đột ngột
+            LOG_WARN("CsvTable: Ignoring incomplete journal entry at " + path.string() + ":" + std::to_string(tokenizer.recordLine()));
+            continue;
+        }
+        Row values;
+        values.reserve(fields.size() - 1);
+        for (std::size_t i = 1; i < fields.size(); ++i) values.push_back(CsvTokenizer::unescapeField(fields[i]));
+
+        if (op == OP_UPSERT) {
+            values.resize(_schema.columns.size());
+            if (checkRow(values)) applyUpsert(std::move(values));
+        } else {
+            std::string key;
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                if (i > 0) key.push_back(KEY_SEPARATOR);
+                key += values[i];
+            }
+            applyErase(key);
+        }
+        ++entryCount;
+    }
+    return true;
+}
+
+std::expected<bool, Error> CsvTable::openJournal(bool truncate) {
+    if (_journal.is_open()) _journal.close();
+    _journal.clear();
+    _journal.open(_journalPath, std::ios::binary | std::ios::out | (truncate ? std::ios::trunc : std::ios::app));
+    if (!_journal.is_open()) {
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot open journal " + _journalPath.string()});
+    }
+    return true;
+}
+
+// --- Compaction ---
+
+std::expected<std::vector<CsvTable::Row>, Error> CsvTable::rotateJournalLocked() {
+    std::error_code ec;
+    if (std::filesystem::exists(_compactingJournalPath, ec)) {
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "A previous compaction of " + _filePath.string() + " did not complete"});
+    }
+    _journal.close();
+    if (std::filesystem::exists(_journalPath, ec)) {
+        std::filesystem::rename(_journalPath, _compactingJournalPath, ec);
+        if (ec) {
+            openJournal(false);
+            return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Cannot rotate journal " + _journalPath.string() + ": " + ec.message()});
+        }
+    }
+    if (auto opened = openJournal(true); !opened) return std::unexpected(opened.error());
+    _journalEntries = 0;
+
+    std::vector<std::pair<const std::string*, const Row*>> entries;
+    entries.reserve(_rows.size());
+    for (const auto& [key, row] : _rows) entries.emplace_back(&key, &row);
+    return copySorted(entries);
+}
+
+std::expected<bool, Error> CsvTable::writeSnapshot(const std::vector<Row>& rows) {
+    std::lock_guard writerLock(_compactionMutex);
+    std::filesystem::path tempPath = _filePath;
+    tempPath += ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Cannot create " + tempPath.string()});
+        }
+        std::string buffer = formatRecord(_schema.columns);
+        for (const auto& row : rows) {
+            buffer += formatRecord(row);
+            if (buffer.size() >= (1u << 16)) {
+                out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        out.flush();
+        if (!out.good()) {
+            return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Failed to write snapshot " + tempPath.string()});
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, _filePath, ec); // Thay thế nguyên tử file gốc
+    if (ec) {
+        return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Cannot replace " + _filePath.string() + ": " + ec.message()});
+    }
+    std::filesystem::remove(_compactingJournalPath, ec);
+    return true;
+}
+
+void CsvTable::maybeStartCompactionLocked() {
+    if (_compacting || _journalEntries < _compactionThreshold) return;
+    auto snapshot = rotateJournalLocked();
+    if (!snapshot) {
+        LOG_WARN("CsvTable: Skipping compaction: " + snapshot.error().message);
+        return;
+    }
+    // Luồng trước (nếu có) đã kết thúc vì _compacting == false
+    if (_compactionThread.joinable()) _compactionThread.join();
+    _compacting = true;
+    _compactionThread = std::thread([this, rows = std::move(*snapshot)]() {
+        auto written = writeSnapshot(rows);
+        if (!written) {
+            LOG_ERROR("CsvTable: Background compaction failed: " + written.error().message);
+        }
+        std::unique_lock lock(_mutex);
+        _compacting = false;
+    });
+}
+
+std::expected<bool, Error> CsvTable::compact() {
+    waitForCompaction();
+    std::vector<Row> snapshot;
+    {
+        std::unique_lock lock(_mutex);
+        auto rotated = rotateJournalLocked();
+        if (!rotated) return std::unexpected(rotated.error());
+        snapshot = std::move(*rotated);
+        _compacting = true;
+    }
+    auto written = writeSnapshot(snapshot);
+    std::unique_lock lock(_mutex);
+    _compacting = false;
+    return written;
+}
+
+void CsvTable::waitForCompaction() {
+    std::thread worker;
+    {
+        std::unique_lock lock(_mutex);
+        worker = std::move(_compactionThread);
+    }
+    if (worker.joinable()) worker.join();
+}
@@ -0,0 +1,240 @@
+#ifndef CSVTABLE_H
+#define CSVTABLE_H
+
+/**
+ * @file CsvTable.h
+ * @brief Storage engine for the CSV data source: an in-memory, hash-indexed table backed by a CSV file
+ *
+ * On load the base CSV file is memory-mapped and tokenized once; every row is then kept in a hash map
+ * keyed by its primary key, with additional hash indexes on the configured lookup (foreign-key) columns.
+ * Mutations never rewrite the base file: they are appended to a write-ahead journal (`<file>.journal`)
+ * and applied in memory. When the journal grows past a threshold it is rotated and a background thread
+ * writes a fresh snapshot of the table, atomically renames it over the base file and drops the rotated
+ * journal. A crash at any point leaves base + journals that replay to the latest committed state.
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <optional>
+#include <filesystem>
+#include <fstream>
+#include <shared_mutex>
+#include <mutex>
+#include <thread>
+#include <expected>
+#include <initializer_list>
+#include <functional>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct CsvTableSchema
+ * @brief Column layout of a CSV table
+ */
+struct CsvTableSchema {
+    std::vector<std::string> columns;        ///< Header names, in file order
+    std::vector<std::size_t> keyColumns;     ///< Columns forming the primary key
+    std::vector<std::size_t> indexedColumns; ///< Columns with a secondary hash index (foreign keys, unique lookups)
+};
+
+/**
+ * @class CsvTable
+ * @brief Thread-safe, hash-indexed CSV table with an append-only journal and background compaction
+ *
+ * Readers take a shared lock and never touch the disk. Writers take an exclusive lock, append the
+ * change to the journal (flushed before the in-memory state is modified) and update the indexes.
+ */
+class CsvTable {
+public:
+    using Row = std::vector<std::string>;
+
+    static constexpr std::size_t DEFAULT_COMPACTION_THRESHOLD = 1000; ///< Journal entries before a snapshot is written
+
+    /**
+     * @brief Constructs the table (does not touch the disk; call load())
+     * @param filePath Path of the base CSV file
+     * @param schema Column layout
+     * @param compactionThreshold Number of journal entries that triggers a background compaction
+     */
+    CsvTable(std::filesystem::path filePath, CsvTableSchema schema,
+             std::size_t compactionThreshold = DEFAULT_COMPACTION_THRESHOLD);
+
+    /**
+     * @brief Waits for any running compaction and closes the journal
+     */
+    ~CsvTable();
+
+    CsvTable(const CsvTable&) = delete;
+    CsvTable& operator=(const CsvTable&) = delete;
+
+    /**
+     * @brief Loads the base file and replays the journals
+     *
+     * Creates the file (with its header) and parent directories if they do not exist.
+     * A file written before columns were appended to the schema (its header is a prefix of the schema)
+     * still loads; the missing trailing fields read as empty and the next snapshot rewrites the file.
+     * @return True on success, or FILE_* error if the file cannot be read or its header does not match the schema
+     */
+    std::expected<bool, Error> load();
+
+    /**
+     * @brief Builds the lookup key of a composite primary key
+     */
+    static std::string compositeKey(std::initializer_list<std::string_view> parts);
+
+    /**
+     * @brief Finds a row by primary key (composite keys via compositeKey())
+     */
+    std::optional<Row> find(const std::string& key) const;
+
+    /**
+     * @brief Checks whether a primary key exists
+     */
+    bool contains(const std::string& key) const;
+
+    /**
+     * @brief Finds all rows whose column equals a value, ordered by primary key
+     *
+     * Uses the hash index when the column is indexed, otherwise scans the table.
+     */
+    std::vector<Row> findBy(std::size_t column, const std::string& value) const;
+
+    /**
+     * @brief All rows, ordered by primary key
+     */
+    std::vector<Row> all() const;
+
+    /**
+     * @brief Visits every row in place, without copying or sorting
+     *
+     * Holds the shared lock for the whole scan, so the visitor must not write to this table.
+     * @param visitor Called for each row; return false to stop early
+     * @return Number of rows passed to the visitor
+     */
+    std::size_t forEachRow(const std::function<bool(const Row&)>& visitor) const;
+
+    /**
+     * @brief Number of rows
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Inserts a new row
+     * @return True on success, ALREADY_EXISTS if the key is taken, VALIDATION_ERROR on a malformed row,
+     *         FILE_WRITE_ERROR if the journal cannot be written
+     */
+    std::expected<bool, Error> insert(Row row);
+
+    /**
+     * @brief Inserts a new row unless `limit` rows already hold the same value in a column
+     *
+     * The count and the insert happen under one exclusive lock (e.g. a seat limit per course).
+     * @return True on success, OPERATION_FAILED if the limit is reached, otherwise as insert()
+     */
+    std::expected<bool, Error> insertIfFewer(Row row, std::size_t column, std::size_t limit);
+
+    /**
+     * @brief Replaces an existing row
+     * @return True on success, NOT_FOUND if the key does not exist
+     */
+    std::expected<bool, Error> update(Row row);
+
+    /**
+     * @brief Inserts or replaces a row
+     */
+    std::expected<bool, Error> upsert(Row row);
+
+    /**
+     * @brief Inserts or replaces several rows with a single journal write
+     *
+     * All rows are validated before anything is written, so the batch is applied entirely or not at all.
+     */
+    std::expected<bool, Error> upsertMany(std::vector<Row> rows);
+
+    /**
+     * @brief Inserts several new rows with a single journal write
+     *
+     * Fails with ALREADY_EXISTS if any key is already taken or repeated within the batch;
+     * nothing is written in that case.
+     */
+    std::expected<bool, Error> insertMany(std::vector<Row> rows);
+
+    /**
+     * @brief Deletes a row by primary key
+     * @return True on success, NOT_FOUND if the key does not exist
+     */
+    std::expected<bool, Error> erase(const std::string& key);
+
+    /**
+     * @brief Deletes every row whose column equals a value
+     * @return Number of deleted rows
+     */
+    std::expected<std::size_t, Error> eraseBy(std::size_t column, const std::string& value);
+
+    /**
+     * @brief Writes a snapshot and truncates the journal synchronously
+     */
+    std::expected<bool, Error> compact();
+
+    /**
+     * @brief Blocks until a running background compaction has finished
+     */
+    void waitForCompaction();
+
+    /**
+     * @brief Number of entries in the active journal
+     */
+    std::size_t journalEntryCount() const;
+
+    /**
+     * @brief Path of the base CSV file
+     */
+    const std::filesystem::path& getFilePath() const;
+
+    /**
+     * @brief Column layout
+     */
+    const CsvTableSchema& getSchema() const;
+
+private:
+    using Index = std::unordered_map<std::string, std::unordered_set<std::string>>;
+
+    std::filesystem::path _filePath;
+    std::filesystem::path _journalPath;
+    std::filesystem::path _compactingJournalPath;
+    CsvTableSchema _schema;
+    std::size_t _compactionThreshold;
+
+    mutable std::shared_mutex _mutex;
+    std::unordered_map<std::string, Row> _rows; ///< Primary key -> row
+    std::vector<Index> _indexes;                ///< Parallel to _schema.indexedColumns: value -> primary keys
+    std::ofstream _journal;
+    std::size_t _journalEntries = 0;
+    std::size_t _fileColumnCount = 0;          ///< Columns in the base file header (fewer than the schema for older files)
+
+    std::mutex _compactionMutex;                ///< Serializes snapshot writers
+    std::thread _compactionThread;
+    bool _compacting = false;                   ///< Guarded by _mutex
+
+    std::string keyOf(const Row& row) const;
+    std::expected<bool, Error> checkRow(const Row& row) const;
+    std::optional<std::size_t> indexSlot(std::size_t column) const;
+    void applyUpsert(Row row);
+    bool applyErase(const std::string& key);
+    static std::vector<Row> copySorted(std::vector<std::pair<const std::string*, const Row*>>& entries);
+
+    static std::string formatRecord(const Row& fields);
+    std::string formatLine(std::string_view op, const Row& fields) const;
+    std::expected<bool, Error> appendJournal(const std::string& lines, std::size_t entryCount);
+    std::expected<bool, Error> loadBaseFile();
+    std::expected<bool, Error> replayJournal(const std::filesystem::path& path, std::size_t& entryCount);
+    std::expected<bool, Error> openJournal(bool truncate);
+
+    std::expected<std::vector<Row>, Error> rotateJournalLocked();
+    std::expected<bool, Error> writeSnapshot(const std::vector<Row>& rows);
+    void maybeStartCompactionLocked();
+};
+
+#endif // CSVTABLE_H
@@ -0,0 +1,87 @@
+#include "CsvTeacherDao.h"
+#include "CsvDaoUtils.h"
+#include "../../parsing/impl_csv_parser/TeacherCsvParser.h"
+
+CsvTeacherDao::CsvTeacherDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Teacher, CsvRow>> parser,
+                             std::vector<CsvCascade> cascades)
+    : _table(std::move(table)), _parser(std::move(parser)), _cascades(std::move(cascades)) {
+    CsvDaoUtils::requireDependencies(_table, _parser, "CsvTeacherDao");
+}
+
+std::expected<Teacher, Error> CsvTeacherDao::getById(const std::string& id) const {
+    auto row = _table->find(id);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Teacher with ID " + id + " not found."});
+    }
+    return _parser->parse(*row);
+}
+
+std::expected<std::vector<Teacher>, Error> CsvTeacherDao::getAll() const {
+    return CsvDaoUtils::parseRows(_table->all(), *_parser);
+}
+
+std::expected<std::size_t, Error> CsvTeacherDao::forEach(const std::function<bool(const Teacher&)>& visitor) const {
+    return CsvDaoUtils::streamRows(*_table, *_parser, visitor);
+}
+
+std::expected<Teacher, Error> CsvTeacherDao::add(const Teacher& teacher) {
+    ValidationResult vr = teacher.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Teacher data for add: " + vr.getErrorMessagesCombined()});
+    }
+    if (!teacher.getEmail().empty() && !_table->findBy(TeacherCsvParser::EMAIL, teacher.getEmail()).empty()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Email " + teacher.getEmail() + " already exists for another user."});
+    }
+    auto row = _parser->serialize(teacher);
+    if (!row) return std::unexpected(row.error());
+    auto inserted = _table->insert(std::move(*row));
+    if (!inserted) return std::unexpected(inserted.error());
+    return teacher;
+}
+
+std::expected<bool, Error> CsvTeacherDao::update(const Teacher& teacher) {
+    ValidationResult vr = teacher.validateBasic();
+    if (!vr.isValid) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Teacher data for update: " + vr.getErrorMessagesCombined()});
+    }
+    if (!teacher.getEmail().empty()) {
+        for (const auto& other : _table->findBy(TeacherCsvParser::EMAIL, teacher.getEmail())) {
+            if (other[TeacherCsvParser::ID] != teacher.getId()) {
+                return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Email " + teacher.getEmail() + " conflicts with another teacher."});
+            }
+        }
+    }
+    auto row = _parser->serialize(teacher);
+    if (!row) return std::unexpected(row.error());
+    return _table->update(std::move(*row));
+}
+
+std::expected<bool, Error> CsvTeacherDao::remove(const std::string& id) {
+    return CsvDaoUtils::eraseWithCascades(*_table, _cascades, id);
+}
+
+std::expected<bool, Error> CsvTeacherDao::exists(const std::string& id) const {
+    return _table->contains(id);
+}
+
+std::expected<std::vector<Teacher>, Error> CsvTeacherDao::findByFacultyId(const std::string& facultyId) const {
+    return CsvDaoUtils::parseRows(_table->findBy(TeacherCsvParser::FACULTY_ID, facultyId), *_parser);
+}
+
+std::expected<std::vector<Teacher>, Error> CsvTeacherDao::findByDesignation(const std::string& designation) const {
+    std::vector<CsvRow> matches;
+    for (auto& row : _table->all()) {
+        if (row[TeacherCsvParser::DESIGNATION].find(designation) != std::string::npos) {
+            matches.push_back(std::move(row));
+        }
+    }
+    return CsvDaoUtils::parseRows(matches, *_parser);
+}
+
+std::expected<Teacher, Error> CsvTeacherDao::findByEmail(const std::string& email) const {
+    auto rows = _table->findBy(TeacherCsvParser::EMAIL, email);
+    if (rows.empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Teacher with email " + email + " not found."});
+    }
+    return _parser->parse(rows.front());
+}
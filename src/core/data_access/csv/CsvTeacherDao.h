@@ -0,0 +1,64 @@
+#ifndef CSVTEACHERDAO_H
+#define CSVTEACHERDAO_H
+
+/**
+ * @file CsvTeacherDao.h
+ * @brief CSV implementation of the teacher data access object
+ */
+
+#include "../interface/ITeacherDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "CsvTable.h"
+#include "CsvDaoUtils.h"
+#include <memory>
+
+/**
+ * @class CsvTeacherDao
+ * @brief CSV implementation of ITeacherDao on top of a shared, indexed CsvTable
+ *
+ * The table is owned by DaoFactory so every DAO instance sees the same rows and indexes.
+ */
+class CsvTeacherDao : public ITeacherDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding the teacher rows
+    std::shared_ptr<IEntityParser<Teacher, CsvRow>> _parser; ///< Parser converting rows to Teacher objects
+    std::vector<CsvCascade> _cascades; ///< Tables whose rows referencing a removed teacher are deleted with it
+
+public:
+    /**
+     * @brief Constructor for CsvTeacherDao
+     * @param table Loaded CSV table (see CsvTable::load())
+     * @param parser Entity parser for converting rows to Teacher objects
+     * @param cascades Dependent tables cleaned up by remove(), as the SQL foreign keys do
+     * @throws std::invalid_argument if table or parser is null
+     */
+    CsvTeacherDao(std::shared_ptr<CsvTable> table, std::shared_ptr<IEntityParser<Teacher, CsvRow>> parser,
+                  std::vector<CsvCascade> cascades = {});
+
+    ~CsvTeacherDao() override = default;
+
+    std::expected<Teacher, Error> getById(const std::string& id) const override;
+    std::expected<std::vector<Teacher>, Error> getAll() const override;
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Teacher&)>& visitor) const override;
+    std::expected<Teacher, Error> add(const Teacher& teacher) override;
+    std::expected<bool, Error> update(const Teacher& teacher) override;
+    std::expected<bool, Error> remove(const std::string& id) override;
+    std::expected<bool, Error> exists(const std::string& id) const override;
+
+    /**
+     * @brief Finds teachers of a faculty through the facultyId index
+     */
+    std::expected<std::vector<Teacher>, Error> findByFacultyId(const std::string& facultyId) const override;
+
+    /**
+     * @brief Finds teachers whose designation contains the given text
+     */
+    std::expected<std::vector<Teacher>, Error> findByDesignation(const std::string& designation) const override;
+
+    /**
+     * @brief Finds a teacher through the email index
+     */
+    std::expected<Teacher, Error> findByEmail(const std::string& email) const override;
+};
+
+#endif // CSVTEACHERDAO_H
@@ -0,0 +1,73 @@
+#include "CsvTermDao.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    AcademicTerm toTerm(const CsvTable::Row& row) {
+        return AcademicTerm{row[CsvTermDao::ID], row[CsvTermDao::NAME], row[CsvTermDao::START_DATE], row[CsvTermDao::END_DATE],
+                            row[CsvTermDao::CLOSED] == "1"};
+    }
+}
+
+CsvTableSchema CsvTermDao::schema() {
+    return {{"id", "name", "startDate", "endDate", "closed"}, {ID}, {}};
+}
+
+CsvTermDao::CsvTermDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvTermDao: table cannot be null.");
+    }
+}
+
+std::expected<std::vector<AcademicTerm>, Error> CsvTermDao::getAll() const {
+    std::vector<AcademicTerm> terms;
+    for (const auto& row : _table->all()) terms.push_back(toTerm(row));
+    std::sort(terms.begin(), terms.end(), [](const AcademicTerm& a, const AcademicTerm& b) {
+        return a.startDate != b.startDate ? a.startDate < b.startDate : a.id < b.id;
+    });
+    return terms;
+}
+
+std::expected<AcademicTerm, Error> CsvTermDao::findById(const std::string& termId) const {
+    auto row = _table->find(termId);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Term " + termId + " not found."});
+    }
+    return toTerm(*row);
+}
+
+std::expected<AcademicTerm, Error> CsvTermDao::findCurrent(const std::string& today) const {
+    std::optional<AcademicTerm> current;
+    for (const auto& row : _table->all()) {
+        AcademicTerm term = toTerm(row);
+        if (term.closed || term.startDate > today) continue;
+        if (!current || term.startDate > current->startDate) current = std::move(term);
+    }
+    if (!current) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "No open term has started by " + today + "."});
+    }
+    return *current;
+}
+
+std::expected<bool, Error> CsvTermDao::add(const AcademicTerm& term) {
+    if (term.id.empty() || term.name.empty() || term.startDate > term.endDate) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid term '" + term.id + "'."});
+    }
+    auto inserted = _table->insert({term.id, term.name, term.startDate, term.endDate, "0"});
+    if (!inserted && inserted.error().code == ErrorCode::ALREADY_EXISTS) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Term " + term.id + " already exists."});
+    }
+    return inserted;
+}
+
+std::expected<bool, Error> CsvTermDao::close(const std::string& termId) {
+    auto row = _table->find(termId);
+    if (!row) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Term " + termId + " not found."});
+    }
+    if ((*row)[CLOSED] == "1") return false;
+    (*row)[CLOSED] = "1";
+    auto updated = _table->upsert(std::move(*row));
+    if (!updated) return std::unexpected(updated.error());
+    return true;
+}
@@ -0,0 +1,49 @@
+#ifndef CSVTERMDAO_H
+#define CSVTERMDAO_H
+
+/**
+ * @file CsvTermDao.h
+ * @brief CSV implementation of the academic term data access object
+ */
+
+#include "../interface/ITermDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvTermDao
+ * @brief CSV implementation of ITermDao on top of a shared CsvTable keyed by term ID
+ */
+class CsvTermDao : public ITermDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per term
+
+public:
+    static constexpr std::size_t ID = 0;         ///< Column of the term ID (key)
+    static constexpr std::size_t NAME = 1;       ///< Column of the display name
+    static constexpr std::size_t START_DATE = 2; ///< Column of the first day (YYYY-MM-DD)
+    static constexpr std::size_t END_DATE = 3;   ///< Column of the last day (YYYY-MM-DD)
+    static constexpr std::size_t CLOSED = 4;     ///< Column of the closed flag ("1" when closed)
+
+    /**
+     * @brief Column layout of the term file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvTermDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvTermDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvTermDao() override = default;
+
+    std::expected<std::vector<AcademicTerm>, Error> getAll() const override;
+    std::expected<AcademicTerm, Error> findById(const std::string& termId) const override;
+    std::expected<AcademicTerm, Error> findCurrent(const std::string& today) const override;
+    std::expected<bool, Error> add(const AcademicTerm& term) override;
+    std::expected<bool, Error> close(const std::string& termId) override;
+};
+
+#endif // CSVTERMDAO_H
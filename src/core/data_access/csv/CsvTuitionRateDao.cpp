@@ -0,0 +1,38 @@
+#include "CsvTuitionRateDao.h"
+#include <charconv>
+#include <stdexcept>
+
+CsvTableSchema CsvTuitionRateDao::schema() {
+    return {{"facultyId", "ratePerCredit"}, {FACULTY_ID}, {}};
+}
+
+CsvTuitionRateDao::CsvTuitionRateDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvTuitionRateDao: table cannot be null.");
+    }
+}
+
+std::expected<std::vector<TuitionRate>, Error> CsvTuitionRateDao::getAll() const {
+    std::vector<TuitionRate> rates;
+    for (const auto& row : _table->all()) {
+        long value = 0;
+        const std::string& text = row[RATE_PER_CREDIT];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid tuition rate '" + text + "' for faculty '" + row[FACULTY_ID] + "'."});
+        }
+        rates.push_back(TuitionRate{row[FACULTY_ID], value});
+    }
+    return rates;
+}
+
+std::expected<bool, Error> CsvTuitionRateDao::upsert(const TuitionRate& rate) {
+    if (rate.facultyId.empty() || rate.ratePerCredit < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Tuition rate requires a faculty ID and a non-negative rate."});
+    }
+    return _table->upsert({rate.facultyId, std::to_string(rate.ratePerCredit)});
+}
+
+std::expected<bool, Error> CsvTuitionRateDao::remove(const std::string& facultyId) {
+    return _table->erase(facultyId);
+}
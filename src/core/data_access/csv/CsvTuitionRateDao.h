@@ -0,0 +1,44 @@
+#ifndef CSVTUITIONRATEDAO_H
+#define CSVTUITIONRATEDAO_H
+
+/**
+ * @file CsvTuitionRateDao.h
+ * @brief CSV implementation of the per-faculty tuition rate data access object
+ */
+
+#include "../interface/ITuitionRateDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvTuitionRateDao
+ * @brief CSV implementation of ITuitionRateDao on top of a shared CsvTable with columns (facultyId, ratePerCredit)
+ */
+class CsvTuitionRateDao : public ITuitionRateDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per faculty
+
+public:
+    static constexpr std::size_t FACULTY_ID = 0;      ///< Column of the faculty ID (primary key)
+    static constexpr std::size_t RATE_PER_CREDIT = 1; ///< Column of the tuition per credit
+
+    /**
+     * @brief Column layout of the tuition rates file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvTuitionRateDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvTuitionRateDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvTuitionRateDao() override = default;
+
+    std::expected<std::vector<TuitionRate>, Error> getAll() const override;
+    std::expected<bool, Error> upsert(const TuitionRate& rate) override;
+    std::expected<bool, Error> remove(const std::string& facultyId) override;
+};
+
+#endif // CSVTUITIONRATEDAO_H
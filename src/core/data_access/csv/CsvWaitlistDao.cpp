@@ -0,0 +1,75 @@
+#include "CsvWaitlistDao.h"
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+namespace {
+    template<typename TNumber>
+    std::expected<TNumber, Error> parseNumber(const CsvTable::Row& row, std::size_t column) {
+        TNumber value = 0;
+        const std::string& text = row[column];
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Invalid number '" + text + "' in waitlist entry of student '" +
+                                                                   row[CsvWaitlistDao::STUDENT_ID] + "'."});
+        }
+        return value;
+    }
+
+    std::expected<std::vector<WaitlistEntry>, Error> parseEntries(const std::vector<CsvTable::Row>& rows) {
+        std::vector<WaitlistEntry> entries;
+        entries.reserve(rows.size());
+        for (const auto& row : rows) {
+            auto priorityClass = parseNumber<int>(row, CsvWaitlistDao::PRIORITY_CLASS);
+            if (!priorityClass) return std::unexpected(priorityClass.error());
+            auto requestedAt = parseNumber<long long>(row, CsvWaitlistDao::REQUESTED_AT);
+            if (!requestedAt) return std::unexpected(requestedAt.error());
+            entries.push_back(WaitlistEntry{row[CsvWaitlistDao::COURSE_ID], row[CsvWaitlistDao::STUDENT_ID],
+                                            priorityClass.value(), requestedAt.value()});
+        }
+        return entries;
+    }
+}
+
+CsvTableSchema CsvWaitlistDao::schema() {
+    return {{"courseId", "studentId", "priorityClass", "requestedAt"}, {COURSE_ID, STUDENT_ID}, {COURSE_ID, STUDENT_ID}};
+}
+
+CsvWaitlistDao::CsvWaitlistDao(std::shared_ptr<CsvTable> table) : _table(std::move(table)) {
+    if (!_table) {
+        throw std::invalid_argument("CsvWaitlistDao: table cannot be null.");
+    }
+}
+
+std::expected<bool, Error> CsvWaitlistDao::add(const WaitlistEntry& entry) {
+    if (entry.courseId.empty() || entry.studentId.empty() || entry.priorityClass < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid waitlist entry for student '" + entry.studentId + "'."});
+    }
+    auto inserted = _table->insert({entry.courseId, entry.studentId, std::to_string(entry.priorityClass), std::to_string(entry.requestedAt)});
+    if (!inserted && inserted.error().code == ErrorCode::ALREADY_EXISTS) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + entry.studentId + " is already waitlisted for course " + entry.courseId + "."});
+    }
+    return inserted;
+}
+
+std::expected<bool, Error> CsvWaitlistDao::remove(const std::string& courseId, const std::string& studentId) {
+    auto erased = _table->erase(CsvTable::compositeKey({courseId, studentId}));
+    if (!erased && erased.error().code == ErrorCode::NOT_FOUND) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " is not waitlisted for course " + courseId + "."});
+    }
+    return erased;
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> CsvWaitlistDao::getByCourse(const std::string& courseId) const {
+    auto entries = parseEntries(_table->findBy(COURSE_ID, courseId));
+    if (!entries) return entries;
+    std::sort(entries->begin(), entries->end(), [](const WaitlistEntry& a, const WaitlistEntry& b) { return a.queuedBefore(b); });
+    return entries;
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> CsvWaitlistDao::getByStudent(const std::string& studentId) const {
+    auto entries = parseEntries(_table->findBy(STUDENT_ID, studentId));
+    if (!entries) return entries;
+    std::sort(entries->begin(), entries->end(), [](const WaitlistEntry& a, const WaitlistEntry& b) { return a.courseId < b.courseId; });
+    return entries;
+}
@@ -0,0 +1,50 @@
+#ifndef CSVWAITLISTDAO_H
+#define CSVWAITLISTDAO_H
+
+/**
+ * @file CsvWaitlistDao.h
+ * @brief CSV implementation of the course waitlist data access object
+ */
+
+#include "../interface/IWaitlistDao.h"
+#include "CsvTable.h"
+#include <memory>
+
+/**
+ * @class CsvWaitlistDao
+ * @brief CSV implementation of IWaitlistDao on top of a shared CsvTable keyed by (courseId, studentId)
+ *
+ * Course and student lookups go through the table's hash indexes; a course's queue is sorted
+ * into waiting order after the lookup.
+ */
+class CsvWaitlistDao : public IWaitlistDao {
+private:
+    std::shared_ptr<CsvTable> _table; ///< Loaded table holding one row per waiting student and course
+
+public:
+    static constexpr std::size_t COURSE_ID = 0;      ///< Column of the course ID (key, indexed)
+    static constexpr std::size_t STUDENT_ID = 1;     ///< Column of the student ID (key, indexed)
+    static constexpr std::size_t PRIORITY_CLASS = 2; ///< Column of the priority class (0 is highest)
+    static constexpr std::size_t REQUESTED_AT = 3;   ///< Column of the request time in microseconds since epoch
+
+    /**
+     * @brief Column layout of the waitlist file
+     */
+    static CsvTableSchema schema();
+
+    /**
+     * @brief Constructor for CsvWaitlistDao
+     * @param table Loaded CSV table (see CsvTable::load()) using schema()
+     * @throws std::invalid_argument if table is null
+     */
+    explicit CsvWaitlistDao(std::shared_ptr<CsvTable> table);
+
+    ~CsvWaitlistDao() override = default;
+
+    std::expected<bool, Error> add(const WaitlistEntry& entry) override;
+    std::expected<bool, Error> remove(const std::string& courseId, const std::string& studentId) override;
+    std::expected<std::vector<WaitlistEntry>, Error> getByCourse(const std::string& courseId) const override;
+    std::expected<std::vector<WaitlistEntry>, Error> getByStudent(const std::string& studentId) const override;
+};
+
+#endif // CSVWAITLISTDAO_H
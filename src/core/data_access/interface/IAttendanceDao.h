@@ -0,0 +1,77 @@
+/**
+ * @file IAttendanceDao.h
+ * @brief Định nghĩa giao diện DAO cho điểm danh (bảng AttendanceRoster và AttendanceSessions)
+ *
+ * Mỗi sinh viên của một khóa học được gán một chỉ số dày đặc (slot) cố định trong danh sách điểm
+ * danh của khóa học đó. Mỗi buổi học lưu một bitmap đã mã hóa (xem AttendanceBitmap) thay vì một
+ * dòng cho mỗi sinh viên: bit thứ slot bật nghĩa là sinh viên đó có mặt.
+ */
+#ifndef IATTENDANCEDAO_H
+#define IATTENDANCEDAO_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct AttendanceSession
+ * @brief Điểm danh của một buổi học
+ */
+struct AttendanceSession {
+    std::string courseId;                ///< ID của khóa học
+    int sessionNo = 0;                   ///< Số thứ tự buổi học (bắt đầu từ 1)
+    std::vector<unsigned char> presence; ///< Bitmap các slot có mặt đã mã hóa
+};
+
+/**
+ * @class IAttendanceDao
+ * @brief Giao diện DAO cho điểm danh
+ */
+class IAttendanceDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IAttendanceDao() = default;
+
+    /**
+     * @brief Danh sách điểm danh của một khóa học theo slot
+     * @param courseId ID của khóa học
+     * @return studentId theo slot (phần tử i là slot i, có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<std::string>, Error> getRoster(const std::string& courseId) const = 0;
+
+    /**
+     * @brief Gán slot cho một sinh viên trong danh sách điểm danh của khóa học
+     * @param courseId ID của khóa học
+     * @param slot Slot mới, phải bằng số sinh viên hiện có trong danh sách
+     * @param studentId ID của sinh viên
+     * @return true nếu thành công, hoặc Error (ALREADY_EXISTS nếu slot hoặc sinh viên đã có trong danh sách)
+     */
+    virtual std::expected<bool, Error> addToRoster(const std::string& courseId, int slot, const std::string& studentId) = 0;
+
+    /**
+     * @brief Điểm danh mọi buổi học của một khóa học
+     * @param courseId ID của khóa học
+     * @return Danh sách theo sessionNo (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<AttendanceSession>, Error> getSessions(const std::string& courseId) const = 0;
+
+    /**
+     * @brief Điểm danh của một buổi học
+     * @param courseId ID của khóa học
+     * @param sessionNo Số thứ tự buổi học
+     * @return Buổi học, hoặc Error (NOT_FOUND nếu buổi học chưa được điểm danh)
+     */
+    virtual std::expected<AttendanceSession, Error> findSession(const std::string& courseId, int sessionNo) const = 0;
+
+    /**
+     * @brief Lưu (hoặc thay) điểm danh của một buổi học
+     * @param session Buổi học
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu khóa học không tồn tại)
+     */
+    virtual std::expected<bool, Error> saveSession(const AttendanceSession& session) = 0;
+};
+
+#endif // IATTENDANCEDAO_H
@@ -11,6 +11,8 @@
 #include "../../entities/CourseResult.h"
 #include <string>
 #include <vector>
+#include <functional>
+#include <cstddef>
 #include <expected> // (➕)
 #include "../../../common/ErrorType.h" // (➕)
 
@@ -49,13 +51,47 @@ public:
      * @return Danh sách các đối tượng CourseResult nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<std::vector<CourseResult>, Error> findByCourseId(const std::string& courseId) const = 0;
+
+    /**
+     * @brief Tìm tất cả kết quả của một học kỳ, chỉ đọc phân vùng của học kỳ đó
+     * @param termId Mã học kỳ
+     * @return Danh sách các đối tượng CourseResult nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<CourseResult>, Error> findByTerm(const std::string& termId) const = 0;
+
+    /**
+     * @brief Tìm kết quả của một khóa học trong một học kỳ
+     * @param termId Mã học kỳ
+     * @param courseId ID của khóa học
+     * @return Danh sách các đối tượng CourseResult nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<CourseResult>, Error> findByTermAndCourse(const std::string& termId, const std::string& courseId) const = 0;
     
     /**
      * @brief Thêm mới hoặc cập nhật kết quả khóa học
+     * 
+     * Nếu result không có mã học kỳ, kết quả giữ học kỳ đang lưu (DAO SQL lấy học kỳ của
+     * bản ghi đăng ký khi thêm mới).
      * @param result Đối tượng CourseResult cần thêm hoặc cập nhật
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<bool, Error> addOrUpdate(const CourseResult& result) = 0;
+
+    /**
+     * @brief Duyệt lần lượt tất cả kết quả khóa học mà không gom chúng vào một danh sách
+     * @param visitor Hàm xử lý từng kết quả; trả về false để dừng duyệt
+     * @return Số kết quả đã chuyển cho visitor, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::size_t, Error> forEachResult(const std::function<bool(const CourseResult&)>& visitor) const = 0;
+
+    /**
+     * @brief Thêm mới hoặc cập nhật nhiều kết quả khóa học trong một giao dịch
+     * 
+     * Tất cả bản ghi được ghi hoặc không bản ghi nào được ghi (nếu có lỗi).
+     * @param results Danh sách các đối tượng CourseResult cần thêm hoặc cập nhật
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> addOrUpdateBatch(const std::vector<CourseResult>& results) = 0;
     
     /**
      * @brief Xóa kết quả khóa học theo ID sinh viên và ID khóa học
@@ -11,6 +11,8 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <functional>
+#include <cstddef>
 #include <expected> // (➕) Thêm include này
 #include "../../../common/ErrorType.h" // Để dùng Error struct
 #include "../../entities/IEntity.h"
@@ -47,6 +49,26 @@ public:
     virtual std::expected<std::vector<TEntity>, Error> getAll() const = 0;
     // virtual std::expected<std::vector<TEntity>, Error> getAll(PagingParams paging, SortParams sorting) const = 0;
 
+    /**
+     * @brief Duyệt lần lượt tất cả thực thể mà không gom chúng vào một danh sách
+     * 
+     * Bản mặc định dựa trên getAll(); các DAO có nguồn dữ liệu lớn (SQL, CSV) ghi đè để đọc
+     * theo luồng với bộ nhớ không đổi. Thứ tự duyệt không được đảm bảo. Hàm visitor không được
+     * ghi vào chính DAO đang duyệt.
+     * @param visitor Hàm xử lý từng thực thể; trả về false để dừng duyệt
+     * @return Số thực thể đã chuyển cho visitor, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::size_t, Error> forEach(const std::function<bool(const TEntity&)>& visitor) const {
+        auto all = getAll();
+        if (!all.has_value()) return std::unexpected(all.error());
+        std::size_t visited = 0;
+        for (const auto& entity : all.value()) {
+            ++visited;
+            if (!visitor(entity)) break;
+        }
+        return visited;
+    }
+
     /**
      * @brief Thêm thực thể mới
      * @param entity Đối tượng thực thể cần thêm
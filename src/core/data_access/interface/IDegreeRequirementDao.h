@@ -0,0 +1,56 @@
+/**
+ * @file IDegreeRequirementDao.h
+ * @brief Định nghĩa giao diện DAO cho điều kiện tốt nghiệp của từng khoa (bảng DegreeRequirements)
+ */
+#ifndef IDEGREEREQUIREMENTDAO_H
+#define IDEGREEREQUIREMENTDAO_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct DegreeRequirement
+ * @brief Điều kiện tốt nghiệp của sinh viên một khoa
+ */
+struct DegreeRequirement {
+    std::string facultyId;                  ///< Mã khoa
+    int minTotalCredits = 0;                ///< Tổng số tín chỉ đã qua tối thiểu
+    double minCgpa = 0.0;                   ///< Điểm trung bình tích lũy hệ 4 tối thiểu
+    std::vector<std::string> requiredCourseIds; ///< Các khóa học bắt buộc phải qua
+};
+
+/**
+ * @class IDegreeRequirementDao
+ * @brief Giao diện DAO cho điều kiện tốt nghiệp
+ */
+class IDegreeRequirementDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IDegreeRequirementDao() = default;
+
+    /**
+     * @brief Lấy điều kiện tốt nghiệp của mọi khoa
+     * @return Danh sách theo facultyId (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<DegreeRequirement>, Error> getAll() const = 0;
+
+    /**
+     * @brief Thêm hoặc thay điều kiện tốt nghiệp của một khoa
+     * @param requirement Điều kiện mới
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> upsert(const DegreeRequirement& requirement) = 0;
+
+    /**
+     * @brief Xóa điều kiện tốt nghiệp của một khoa
+     * @param facultyId Mã khoa
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu khoa chưa có điều kiện)
+     */
+    virtual std::expected<bool, Error> remove(const std::string& facultyId) = 0;
+};
+
+#endif // IDEGREEREQUIREMENTDAO_H
@@ -10,6 +10,8 @@
 
 #include <string>
 #include <vector>
+#include <functional>
+#include <cstddef>
 #include <expected> // (➕)
 #include "../../../common/ErrorType.h" // (➕)
 
@@ -23,6 +25,7 @@
 struct EnrollmentRecord {
     std::string studentId; ///< ID của sinh viên
     std::string courseId;  ///< ID của khóa học
+    std::string termId{};  ///< Mã học kỳ (rỗng nếu chưa gán học kỳ)
 };
 
 /**
@@ -44,6 +47,18 @@ public:
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<bool, Error> addEnrollment(const std::string& studentId, const std::string& courseId) = 0;
+
+    /**
+     * @brief Đăng ký sinh viên vào khóa học nếu khóa học tồn tại và còn chỗ
+     *
+     * Kiểm tra khóa học, kiểm tra trùng và giữ chỗ được thực hiện như một thao tác nguyên tử, nên
+     * nhiều yêu cầu đồng thời không thể vượt quá Course::getCapacity().
+     * @param studentId ID của sinh viên (phải tồn tại)
+     * @param courseId ID của khóa học
+     * @return true nếu thành công; Error NOT_FOUND nếu không có khóa học, ALREADY_EXISTS nếu đã đăng ký,
+     *         COURSE_CAPACITY_REACHED nếu hết chỗ
+     */
+    virtual std::expected<bool, Error> enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) = 0;
     
     /**
      * @brief Xóa bản ghi đăng ký khóa học
@@ -94,6 +109,48 @@ public:
      * @return Danh sách các đối tượng EnrollmentRecord nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<std::vector<EnrollmentRecord>, Error> getAllEnrollments() const = 0;
+
+    /**
+     * @brief Lấy các bản ghi đăng ký của một học kỳ, chỉ đọc phân vùng của học kỳ đó
+     * @param termId Mã học kỳ
+     * @return Danh sách các bản ghi (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<EnrollmentRecord>, Error> findByTerm(const std::string& termId) const = 0;
+
+    /**
+     * @brief Tìm danh sách ID sinh viên đã đăng ký khóa học trong một học kỳ
+     * @param termId Mã học kỳ
+     * @param courseId ID của khóa học
+     * @return Danh sách ID sinh viên nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<std::string>, Error> findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const = 0;
+
+    /**
+     * @brief Gán bản ghi đăng ký vào một học kỳ
+     * @param studentId ID của sinh viên
+     * @param courseId ID của khóa học
+     * @param termId Mã học kỳ (rỗng để bỏ gán)
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu không có bản ghi đăng ký)
+     */
+    virtual std::expected<bool, Error> setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) = 0;
+
+    /**
+     * @brief Duyệt lần lượt tất cả bản ghi đăng ký mà không gom chúng vào một danh sách
+     * 
+     * Bản mặc định dựa trên getAllEnrollments(); DAO SQL và CSV ghi đè để đọc theo luồng.
+     * @param visitor Hàm xử lý từng bản ghi; trả về false để dừng duyệt
+     * @return Số bản ghi đã chuyển cho visitor, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::size_t, Error> forEachEnrollment(const std::function<bool(const EnrollmentRecord&)>& visitor) const {
+        auto all = getAllEnrollments();
+        if (!all.has_value()) return std::unexpected(all.error());
+        std::size_t visited = 0;
+        for (const auto& record : all.value()) {
+            ++visited;
+            if (!visitor(record)) break;
+        }
+        return visited;
+    }
 };
 
 #endif // IENROLLMENTDAO_H
\ No newline at end of file
@@ -0,0 +1,50 @@
+/**
+ * @file IExamScheduleDao.h
+ * @brief Định nghĩa giao diện DAO cho lịch thi cuối kỳ (bảng ExamSchedule)
+ */
+#ifndef IEXAMSCHEDULEDAO_H
+#define IEXAMSCHEDULEDAO_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct ExamSlot
+ * @brief Ca thi của một khóa học
+ */
+struct ExamSlot {
+    std::string courseId; ///< ID của khóa học
+    int day = 1;          ///< Ngày thi thứ mấy của đợt thi (bắt đầu từ 1)
+    int period = 1;       ///< Ca thi thứ mấy trong ngày (bắt đầu từ 1)
+};
+
+/**
+ * @class IExamScheduleDao
+ * @brief Giao diện DAO cho lịch thi
+ *
+ * Mỗi khóa học có tối đa một ca thi; lịch thi được thay toàn bộ mỗi lần xếp lại.
+ */
+class IExamScheduleDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IExamScheduleDao() = default;
+
+    /**
+     * @brief Thay toàn bộ lịch thi
+     * @param slots Lịch thi mới (mỗi khóa học một lần)
+     * @return true nếu thành công, hoặc Error nếu thất bại (lịch cũ được giữ nguyên)
+     */
+    virtual std::expected<bool, Error> replaceAll(const std::vector<ExamSlot>& slots) = 0;
+
+    /**
+     * @brief Lấy toàn bộ lịch thi
+     * @return Danh sách theo (day, period, courseId) (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<ExamSlot>, Error> getAll() const = 0;
+};
+
+#endif // IEXAMSCHEDULEDAO_H
@@ -12,6 +12,20 @@
 #include "../../entities/FeeRecord.h"
 // expected và ErrorType đã được IDao.h include
 
+/**
+ * @struct FeePayment
+ * @brief Một dòng trong sổ cái thanh toán học phí (chỉ thêm, không sửa/xóa)
+ *
+ * Mỗi lần nộp tiền được ghi kèm khóa idempotency do phía gửi tạo ra; gửi lại cùng một
+ * khóa (ví dụ khi thử lại sau lỗi mạng) không cộng tiền thêm lần nữa.
+ */
+struct FeePayment {
+    std::string idempotencyKey; ///< Khóa duy nhất của lần thanh toán
+    std::string studentId;      ///< ID của sinh viên
+    long amount = 0;            ///< Số tiền đã nộp
+    long long paidAt = 0;       ///< Thời điểm nộp (giây kể từ epoch)
+};
+
 /**
  * @class IFeeRecordDao
  * @brief Giao diện DAO cho truy cập dữ liệu học phí
@@ -26,6 +40,43 @@ public:
      * @brief Hàm hủy ảo mặc định
      */
     virtual ~IFeeRecordDao() override = default;
+
+    /**
+     * @brief Thêm nhiều hồ sơ học phí trong một lần ghi (tất cả hoặc không có gì)
+     * @param feeRecords Danh sách hồ sơ học phí cần thêm
+     * @return true nếu toàn bộ được thêm, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> addBatch(const std::vector<FeeRecord>& feeRecords) = 0;
+
+    /**
+     * @brief Đặt tổng học phí cho nhiều sinh viên trong một lần ghi (tất cả hoặc không có gì)
+     *
+     * Hồ sơ chưa có được thêm nguyên trạng; hồ sơ đã có chỉ thay tổng học phí, giữ nguyên số đã
+     * đóng (không ghi đè các thanh toán xen giữa lúc tính và lúc ghi).
+     * @param feeRecords Hồ sơ học phí mang tổng học phí mới
+     * @return true nếu toàn bộ được ghi, hoặc Error (VALIDATION_ERROR nếu tổng mới nhỏ hơn số đã đóng)
+     */
+    virtual std::expected<bool, Error> setTotalFees(const std::vector<FeeRecord>& feeRecords) = 0;
+
+    /**
+     * @brief Ghi một lần thanh toán vào sổ cái và cộng vào học phí đã đóng trong cùng một lần ghi
+     *
+     * Học phí đã đóng chỉ được cộng nếu không vượt quá tổng học phí (kiểm tra và cộng nguyên tử,
+     * không đọc-sửa-ghi cả bản ghi). Nếu khóa idempotency đã có trong sổ cái với cùng sinh viên
+     * và số tiền thì không ghi gì thêm.
+     * @param payment Lần thanh toán (amount > 0, idempotencyKey khác rỗng)
+     * @return true nếu đã ghi nhận, false nếu khóa đã được ghi nhận trước đó, hoặc Error
+     *         (NOT_FOUND nếu chưa có hồ sơ học phí, VALIDATION_ERROR nếu vượt quá số còn nợ,
+     *         ALREADY_EXISTS nếu khóa đã dùng cho một lần thanh toán khác)
+     */
+    virtual std::expected<bool, Error> recordPayment(const FeePayment& payment) = 0;
+
+    /**
+     * @brief Lấy các lần thanh toán của một sinh viên trong sổ cái, theo thời gian
+     * @param studentId ID của sinh viên
+     * @return Danh sách thanh toán (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FeePayment>, Error> getPayments(const std::string& studentId) const = 0;
 };
 
 #endif // IFEERECORDDAO_H
\ No newline at end of file
@@ -0,0 +1,68 @@
+/**
+ * @file IFinanceReportDao.h
+ * @brief Định nghĩa giao diện DAO cho các số liệu tổng hợp tài chính
+ *
+ * Các số liệu được tính theo tập (GROUP BY) ở tầng lưu trữ thay vì đọc từng hồ sơ
+ * học phí/lương qua các DAO riêng lẻ.
+ */
+#ifndef IFINANCEREPORTDAO_H
+#define IFINANCEREPORTDAO_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct FacultyFeeSummary
+ * @brief Tổng học phí của một khóa (cohort) trong một khoa
+ */
+struct FacultyFeeSummary {
+    std::string facultyId;       ///< Mã khoa (rỗng nếu sinh viên chưa thuộc khoa nào)
+    std::string cohort;          ///< Khóa: hai chữ số năm đầu mã sinh viên (rỗng nếu mã không theo định dạng này)
+    std::size_t studentCount = 0; ///< Số hồ sơ học phí
+    long long totalBilled = 0;   ///< Tổng học phí phải đóng
+    long long totalPaid = 0;     ///< Tổng học phí đã đóng
+
+    /**
+     * @brief Tổng học phí còn nợ
+     */
+    long long outstanding() const { return totalBilled - totalPaid; }
+};
+
+/**
+ * @struct FacultyPayrollSummary
+ * @brief Tổng lương cơ bản hàng tháng của giảng viên trong một khoa
+ */
+struct FacultyPayrollSummary {
+    std::string facultyId;        ///< Mã khoa (rỗng nếu giảng viên chưa thuộc khoa nào)
+    std::size_t teacherCount = 0; ///< Số hồ sơ lương
+    long long totalMonthlyPay = 0; ///< Tổng lương cơ bản hàng tháng
+};
+
+/**
+ * @class IFinanceReportDao
+ * @brief Giao diện DAO cho các số liệu tổng hợp tài chính theo khoa
+ */
+class IFinanceReportDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IFinanceReportDao() = default;
+
+    /**
+     * @brief Tổng học phí phải đóng/đã đóng theo khoa và khóa
+     * @return Danh sách sắp theo (facultyId, cohort), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FacultyFeeSummary>, Error> sumFeesByFacultyAndCohort() const = 0;
+
+    /**
+     * @brief Tổng lương cơ bản hàng tháng theo khoa
+     * @return Danh sách sắp theo facultyId, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FacultyPayrollSummary>, Error> sumPayrollByFaculty() const = 0;
+};
+
+#endif // IFINANCEREPORTDAO_H
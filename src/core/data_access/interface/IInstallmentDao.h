@@ -0,0 +1,105 @@
+/**
+ * @file IInstallmentDao.h
+ * @brief Định nghĩa giao diện DAO cho lịch trả góp học phí (bảng FeeInstallments)
+ *
+ * Ngày đến hạn lưu dạng "YYYY-MM-DD" nên so sánh chuỗi đúng thứ tự thời gian. Các truy vấn
+ * quá hạn/đến hạn chỉ đọc các đợt chưa trả đủ, theo thứ tự ngày đến hạn.
+ */
+#ifndef IINSTALLMENTDAO_H
+#define IINSTALLMENTDAO_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct FeeInstallment
+ * @brief Một đợt trả góp học phí
+ */
+struct FeeInstallment {
+    std::string studentId; ///< ID của sinh viên
+    int sequence = 0;      ///< Số thứ tự đợt (bắt đầu từ 1)
+    std::string dueDate;   ///< Ngày đến hạn "YYYY-MM-DD"
+    long amount = 0;       ///< Số tiền phải đóng của đợt
+    long paidAmount = 0;   ///< Số tiền đã phân bổ vào đợt
+    bool late = false;     ///< Đợt đã từng bị quá hạn khi chưa đóng đủ (giữ nguyên sau khi đóng)
+
+    /**
+     * @brief Số tiền còn thiếu của đợt
+     */
+    long outstanding() const { return amount - paidAmount; }
+};
+
+/**
+ * @struct OverdueBalance
+ * @brief Tổng nợ quá hạn của một sinh viên
+ */
+struct OverdueBalance {
+    std::string studentId;            ///< ID của sinh viên
+    std::size_t installmentCount = 0; ///< Số đợt quá hạn chưa đóng đủ
+    long long overdueAmount = 0;      ///< Tổng số tiền quá hạn còn thiếu
+    std::string oldestDueDate;        ///< Ngày đến hạn sớm nhất trong các đợt quá hạn
+};
+
+/**
+ * @class IInstallmentDao
+ * @brief Giao diện DAO cho lịch trả góp học phí
+ */
+class IInstallmentDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IInstallmentDao() = default;
+
+    /**
+     * @brief Lấy lịch trả góp của một sinh viên, theo ngày đến hạn rồi số thứ tự
+     * @param studentId ID của sinh viên
+     * @return Danh sách đợt (rỗng nếu chưa có lịch), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FeeInstallment>, Error> getByStudent(const std::string& studentId) const = 0;
+
+    /**
+     * @brief Thay toàn bộ lịch trả góp của một sinh viên (tất cả hoặc không có gì)
+     * @param studentId ID của sinh viên
+     * @param installments Các đợt mới (cùng studentId, số thứ tự không trùng)
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> replaceSchedule(const std::string& studentId, const std::vector<FeeInstallment>& installments) = 0;
+
+    /**
+     * @brief Phân bổ tổng số tiền đã đóng vào các đợt, đợt đến hạn sớm nhất trước
+     *
+     * Mỗi đợt nhận min(amount, phần còn lại sau các đợt trước); gọi lại với cùng tổng không thay đổi gì.
+     * @param studentId ID của sinh viên
+     * @param paidTotal Tổng học phí sinh viên đã đóng
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> allocatePaid(const std::string& studentId, long paidTotal) = 0;
+
+    /**
+     * @brief Đánh dấu trễ hạn mọi đợt chưa đóng đủ có ngày đến hạn trước asOfDate
+     * @param asOfDate Ngày chạy "YYYY-MM-DD"
+     * @return Số đợt mới bị đánh dấu, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::size_t, Error> markLate(const std::string& asOfDate) = 0;
+
+    /**
+     * @brief Tổng nợ quá hạn (đến hạn trước asOfDate, chưa đóng đủ) của từng sinh viên
+     * @param asOfDate Ngày tính "YYYY-MM-DD"
+     * @return Danh sách sắp theo studentId, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<OverdueBalance>, Error> sumOverdue(const std::string& asOfDate) const = 0;
+
+    /**
+     * @brief Các đợt chưa đóng đủ có ngày đến hạn trong khoảng [fromDate, toDate]
+     * @param fromDate Ngày bắt đầu "YYYY-MM-DD"
+     * @param toDate Ngày kết thúc "YYYY-MM-DD"
+     * @return Danh sách theo ngày đến hạn, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FeeInstallment>, Error> getOpenDueBetween(const std::string& fromDate, const std::string& toDate) const = 0;
+};
+
+#endif // IINSTALLMENTDAO_H
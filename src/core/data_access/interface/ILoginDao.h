@@ -60,6 +60,13 @@ public:
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<bool, Error> addUserCredentials(const std::string& userId, const std::string& passwordHash, const std::string& salt, UserRole role, LoginStatus status) = 0;
+
+    /**
+     * @brief Thêm thông tin đăng nhập cho nhiều người dùng trong một lần ghi (tất cả hoặc không có gì)
+     * @param credentials Danh sách thông tin đăng nhập cần thêm
+     * @return true nếu toàn bộ được thêm, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> addUserCredentialsBatch(const std::vector<LoginCredentials>& credentials) = 0;
     
     /**
      * @brief Cập nhật mật khẩu của người dùng
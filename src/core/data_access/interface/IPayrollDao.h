@@ -0,0 +1,99 @@
+/**
+ * @file IPayrollDao.h
+ * @brief Định nghĩa giao diện DAO cho lịch sử trả lương hàng tháng (bảng SalaryPayments)
+ */
+#ifndef IPAYROLLDAO_H
+#define IPAYROLLDAO_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdio>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @brief Tạo chuỗi kỳ lương dạng "YYYY-MM" (so sánh chuỗi đúng thứ tự thời gian)
+ */
+inline std::string payrollPeriod(int year, int month) {
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d", year, month);
+    return buffer;
+}
+
+/**
+ * @struct SalaryPayment
+ * @brief Bảng lương của một giảng viên trong một tháng
+ */
+struct SalaryPayment {
+    std::string teacherId; ///< ID của giảng viên
+    std::string period;    ///< Kỳ lương, dạng "YYYY-MM"
+    long basicPay = 0;     ///< Lương cơ bản của tháng (lấy từ SalaryRecord tại thời điểm tính)
+    long allowance = 0;    ///< Phụ cấp theo chức danh và thâm niên
+
+    /**
+     * @brief Tổng lương của tháng
+     */
+    long grossPay() const { return basicPay + allowance; }
+};
+
+/**
+ * @struct PayrollYearToDate
+ * @brief Tổng lương lũy kế từ đầu năm của một giảng viên
+ */
+struct PayrollYearToDate {
+    std::string teacherId;     ///< ID của giảng viên
+    std::size_t months = 0;    ///< Số tháng đã có bảng lương
+    long long totalBasic = 0;  ///< Tổng lương cơ bản
+    long long totalAllowance = 0; ///< Tổng phụ cấp
+
+    /**
+     * @brief Tổng lương lũy kế
+     */
+    long long totalGross() const { return totalBasic + totalAllowance; }
+};
+
+/**
+ * @class IPayrollDao
+ * @brief Giao diện DAO cho lịch sử trả lương
+ *
+ * Mỗi giảng viên có tối đa một bảng lương cho mỗi kỳ; ghi lại một kỳ sẽ thay thế bảng lương cũ.
+ */
+class IPayrollDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IPayrollDao() = default;
+
+    /**
+     * @brief Lấy các bảng lương của một kỳ
+     * @param period Kỳ lương dạng "YYYY-MM"
+     * @return Danh sách bảng lương (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<SalaryPayment>, Error> getByPeriod(const std::string& period) const = 0;
+
+    /**
+     * @brief Lấy lịch sử lương của một giảng viên, theo kỳ tăng dần
+     * @param teacherId ID của giảng viên
+     * @return Danh sách bảng lương (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<SalaryPayment>, Error> getByTeacher(const std::string& teacherId) const = 0;
+
+    /**
+     * @brief Thêm hoặc thay thế nhiều bảng lương trong một lần ghi (tất cả hoặc không có gì)
+     * @param payments Các bảng lương cần ghi
+     * @return true nếu toàn bộ được ghi, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> upsertBatch(const std::vector<SalaryPayment>& payments) = 0;
+
+    /**
+     * @brief Tổng lương lũy kế của từng giảng viên từ tháng 1 đến hết tháng chỉ định
+     * @param year Năm
+     * @param throughMonth Tháng cuối cùng được tính (1-12)
+     * @return Danh sách sắp theo teacherId, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<PayrollYearToDate>, Error> sumYearToDate(int year, int throughMonth) const = 0;
+};
+
+#endif // IPAYROLLDAO_H
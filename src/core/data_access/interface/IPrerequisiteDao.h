@@ -0,0 +1,58 @@
+/**
+ * @file IPrerequisiteDao.h
+ * @brief Định nghĩa giao diện DAO cho quan hệ môn tiên quyết giữa các khóa học (bảng CoursePrerequisites)
+ */
+#ifndef IPREREQUISITEDAO_H
+#define IPREREQUISITEDAO_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct CoursePrerequisite
+ * @brief Một cạnh của đồ thị môn tiên quyết: phải qua prerequisiteId trước khi học courseId
+ */
+struct CoursePrerequisite {
+    std::string courseId;       ///< ID của khóa học
+    std::string prerequisiteId; ///< ID của khóa học tiên quyết trực tiếp
+};
+
+/**
+ * @class IPrerequisiteDao
+ * @brief Giao diện DAO cho quan hệ môn tiên quyết
+ *
+ * DAO chỉ lưu các cạnh trực tiếp; việc kiểm tra chu trình và bao đóng bắc cầu do
+ * PrerequisiteGraph đảm nhận.
+ */
+class IPrerequisiteDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IPrerequisiteDao() = default;
+
+    /**
+     * @brief Thêm một môn tiên quyết trực tiếp
+     * @param prerequisite Cạnh cần thêm
+     * @return true nếu thành công, hoặc Error (ALREADY_EXISTS nếu cạnh đã có, NOT_FOUND nếu khóa học không tồn tại)
+     */
+    virtual std::expected<bool, Error> add(const CoursePrerequisite& prerequisite) = 0;
+
+    /**
+     * @brief Xóa một môn tiên quyết trực tiếp
+     * @param courseId ID của khóa học
+     * @param prerequisiteId ID của khóa học tiên quyết
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu cạnh không tồn tại)
+     */
+    virtual std::expected<bool, Error> remove(const std::string& courseId, const std::string& prerequisiteId) = 0;
+
+    /**
+     * @brief Lấy mọi cạnh của đồ thị môn tiên quyết
+     * @return Danh sách theo (courseId, prerequisiteId) (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<CoursePrerequisite>, Error> getAll() const = 0;
+};
+
+#endif // IPREREQUISITEDAO_H
@@ -0,0 +1,62 @@
+/**
+ * @file ISequenceDao.h
+ * @brief Định nghĩa giao diện DAO cho bộ đếm số thứ tự (bảng Sequences)
+ *
+ * Mỗi bộ đếm được định danh bằng tên (ví dụ tiền tố năm + khoa của mã sinh viên)
+ * và lưu giá trị lớn nhất đã được cấp phát.
+ */
+#ifndef ISEQUENCEDAO_H
+#define ISEQUENCEDAO_H
+
+#include <string>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @class ISequenceDao
+ * @brief Giao diện DAO cho bộ đếm số thứ tự
+ *
+ * Các phương thức tăng và nâng giá trị phải nguyên tử ở tầng lưu trữ, để hai lần cấp
+ * phát đồng thời không bao giờ nhận cùng một khoảng số.
+ */
+class ISequenceDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~ISequenceDao() = default;
+
+    /**
+     * @brief Lấy giá trị hiện tại của bộ đếm
+     * @param name Tên bộ đếm
+     * @return Giá trị lớn nhất đã cấp phát, hoặc Error (NOT_FOUND nếu bộ đếm chưa tồn tại)
+     */
+    virtual std::expected<long long, Error> getValue(const std::string& name) const = 0;
+
+    /**
+     * @brief Tăng bộ đếm một cách nguyên tử
+     * @param name Tên bộ đếm
+     * @param count Số lượng cần tăng
+     * @return Giá trị mới (số lớn nhất của khoảng vừa cấp phát), hoặc Error (NOT_FOUND nếu bộ đếm chưa tồn tại)
+     */
+    virtual std::expected<long long, Error> advance(const std::string& name, long long count) = 0;
+
+    /**
+     * @brief Tạo bộ đếm nếu chưa có, hoặc nâng giá trị lên ít nhất bằng value
+     *
+     * Không bao giờ làm giảm giá trị hiện có, nên có thể gọi lại an toàn khi dựng lại bộ đếm.
+     * @param name Tên bộ đếm
+     * @param value Giá trị tối thiểu
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> raiseTo(const std::string& name, long long value) = 0;
+
+    /**
+     * @brief Đếm số bộ đếm đang được lưu
+     * @return Số bộ đếm, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::size_t, Error> count() const = 0;
+};
+
+#endif // ISEQUENCEDAO_H
@@ -0,0 +1,58 @@
+/**
+ * @file IStudentArchiveDao.h
+ * @brief Định nghĩa giao diện DAO chuyển sinh viên không còn hoạt động sang kho lưu trữ
+ */
+#ifndef ISTUDENTARCHIVEDAO_H
+#define ISTUDENTARCHIVEDAO_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @class IStudentArchiveDao
+ * @brief Giao diện DAO cho kho lưu trữ sinh viên
+ *
+ * Sinh viên được chuyển cùng mọi dữ liệu phụ thuộc (đăng nhập, đăng ký, kết quả, học phí);
+ * sau khi chuyển, các DAO đọc theo sinh viên tự tìm trong kho lưu trữ khi không thấy ở dữ liệu chính.
+ */
+class IStudentArchiveDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IStudentArchiveDao() = default;
+
+    /**
+     * @brief Kho lưu trữ có sẵn sàng hay không
+     * @return true nếu có thể chuyển sinh viên sang kho lưu trữ
+     */
+    virtual bool isAvailable() const = 0;
+
+    /**
+     * @brief Tìm sinh viên bị vô hiệu hóa và giữ nguyên trạng thái đó từ trước một ngày cho trước
+     * @param disabledOnOrBefore Ngày đổi trạng thái muộn nhất, dạng YYYY-MM-DD
+     * @param limit Số sinh viên tối đa trả về
+     * @return Danh sách ID theo thứ tự tăng dần, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<std::string>, Error> findDisabledStudentIds(const std::string& disabledOnOrBefore,
+                                                                                  std::size_t limit) const = 0;
+
+    /**
+     * @brief Chuyển một nhóm sinh viên sang kho lưu trữ trong một transaction
+     * @param studentIds ID các sinh viên; ID không phải sinh viên trong dữ liệu chính bị bỏ qua
+     * @return Số sinh viên đã chuyển, hoặc Error nếu thất bại (không sinh viên nào bị chuyển)
+     */
+    virtual std::expected<std::size_t, Error> archiveStudents(const std::vector<std::string>& studentIds) = 0;
+
+    /**
+     * @brief Kiểm tra sinh viên đã nằm trong kho lưu trữ hay chưa
+     * @param studentId ID của sinh viên
+     * @return true nếu đã lưu trữ, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> isArchived(const std::string& studentId) const = 0;
+};
+
+#endif // ISTUDENTARCHIVEDAO_H
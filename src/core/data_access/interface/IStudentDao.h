@@ -58,6 +58,16 @@ public:
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<bool, Error> updateStatus(const std::string& studentId, LoginStatus newStatus) = 0;
+
+    /**
+     * @brief Thêm nhiều sinh viên trong một lần ghi (tất cả hoặc không có gì)
+     *
+     * Dùng cho nhập hồ sơ tuyển sinh hàng loạt: nơi gọi đã kiểm tra dữ liệu và trùng lặp,
+     * nên hàm không tra cứu email từng sinh viên như add().
+     * @param students Danh sách sinh viên cần thêm
+     * @return true nếu toàn bộ được thêm, hoặc Error nếu thất bại (khi đó không sinh viên nào được thêm)
+     */
+    virtual std::expected<bool, Error> addBatch(const std::vector<Student>& students) = 0;
 };
 
 #endif // ISTUDENTDAO_H
\ No newline at end of file
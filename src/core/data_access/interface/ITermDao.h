@@ -0,0 +1,71 @@
+/**
+ * @file ITermDao.h
+ * @brief Định nghĩa giao diện DAO cho học kỳ (bảng Terms)
+ */
+#ifndef ITERMDAO_H
+#define ITERMDAO_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct AcademicTerm
+ * @brief Một học kỳ; đăng ký và kết quả của học kỳ đã đóng chỉ được đọc
+ */
+struct AcademicTerm {
+    std::string id;        ///< Mã học kỳ, ví dụ "2025-1"
+    std::string name;      ///< Tên hiển thị
+    std::string startDate; ///< Ngày bắt đầu, dạng YYYY-MM-DD
+    std::string endDate;   ///< Ngày kết thúc, dạng YYYY-MM-DD
+    bool closed = false;   ///< Đã đóng (chỉ đọc)
+};
+
+/**
+ * @class ITermDao
+ * @brief Giao diện DAO cho học kỳ
+ */
+class ITermDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~ITermDao() = default;
+
+    /**
+     * @brief Lấy mọi học kỳ
+     * @return Danh sách theo ngày bắt đầu (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<AcademicTerm>, Error> getAll() const = 0;
+
+    /**
+     * @brief Tìm học kỳ theo mã
+     * @param termId Mã học kỳ
+     * @return Học kỳ, hoặc Error (NOT_FOUND nếu không có)
+     */
+    virtual std::expected<AcademicTerm, Error> findById(const std::string& termId) const = 0;
+
+    /**
+     * @brief Tìm học kỳ hiện tại: học kỳ đang mở có ngày bắt đầu gần nhất không sau ngày cho trước
+     * @param today Ngày tham chiếu, dạng YYYY-MM-DD
+     * @return Học kỳ hiện tại, hoặc Error (NOT_FOUND nếu không có)
+     */
+    virtual std::expected<AcademicTerm, Error> findCurrent(const std::string& today) const = 0;
+
+    /**
+     * @brief Thêm học kỳ mới (luôn ở trạng thái mở)
+     * @param term Học kỳ mới
+     * @return true nếu thành công, hoặc Error (ALREADY_EXISTS nếu trùng mã, VALIDATION_ERROR nếu ngày không hợp lệ)
+     */
+    virtual std::expected<bool, Error> add(const AcademicTerm& term) = 0;
+
+    /**
+     * @brief Đóng học kỳ; không thể mở lại
+     * @param termId Mã học kỳ
+     * @return true nếu vừa đóng, false nếu đã đóng từ trước, hoặc Error (NOT_FOUND nếu không có)
+     */
+    virtual std::expected<bool, Error> close(const std::string& termId) = 0;
+};
+
+#endif // ITERMDAO_H
@@ -0,0 +1,55 @@
+/**
+ * @file ITransactionManager.h
+ * @brief Định nghĩa giao diện quản lý transaction dùng chung cho nhiều DAO
+ *
+ * Các DAO của cùng một nguồn dữ liệu dùng chung một kết nối, nên một transaction mở
+ * qua giao diện này bao trùm mọi lời gọi DAO cho đến khi commit hoặc rollback.
+ */
+#ifndef ITRANSACTIONMANAGER_H
+#define ITRANSACTIONMANAGER_H
+
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @class ITransactionManager
+ * @brief Giao diện mở, xác nhận và hủy transaction trên nguồn dữ liệu dùng chung
+ *
+ * Transaction có thể lồng nhau: lần mở bên trong (ví dụ transaction riêng của một DAO)
+ * trở thành savepoint, và chỉ lần commit ngoài cùng mới ghi xuống đĩa.
+ */
+class ITransactionManager {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~ITransactionManager() = default;
+
+    /**
+     * @brief Mở transaction (hoặc savepoint nếu đang ở trong transaction)
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> begin() = 0;
+
+    /**
+     * @brief Xác nhận transaction (hoặc giải phóng savepoint) gần nhất
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> commit() = 0;
+
+    /**
+     * @brief Hủy transaction (hoặc quay về savepoint) gần nhất
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> rollback() = 0;
+
+    /**
+     * @brief Nguồn dữ liệu có hỗ trợ transaction thật sự hay không
+     *
+     * Nếu không (CSV, Mock), mỗi lời gọi DAO được ghi ngay và UnitOfWork phải chạy
+     * các thao tác bù trừ đã đăng ký khi rollback.
+     */
+    virtual bool isTransactional() const = 0;
+};
+
+#endif // ITRANSACTIONMANAGER_H
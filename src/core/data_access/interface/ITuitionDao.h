@@ -0,0 +1,63 @@
+/**
+ * @file ITuitionDao.h
+ * @brief Định nghĩa giao diện DAO tính học phí theo số tín chỉ đã đăng ký
+ *
+ * Học phí của sinh viên = tổng tín chỉ các môn đã đăng ký x đơn giá tín chỉ của khoa. Việc tính
+ * được làm theo tập cho toàn trường và chỉ trả về các hồ sơ học phí cần thay đổi.
+ */
+#ifndef ITUITIONDAO_H
+#define ITUITIONDAO_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct TuitionChange
+ * @brief Một hồ sơ học phí có tổng học phí tính được khác với giá trị đang lưu
+ */
+struct TuitionChange {
+    std::string studentId;                ///< ID của sinh viên
+    std::string facultyId;                ///< Mã khoa của sinh viên
+    long credits = 0;                     ///< Tổng tín chỉ đã đăng ký
+    long newTotalFee = 0;                 ///< Tổng học phí tính được
+    std::optional<long> previousTotalFee; ///< Tổng học phí đang lưu (rỗng nếu chưa có hồ sơ)
+    long paidFee = 0;                     ///< Số đã đóng hiện tại
+};
+
+/**
+ * @struct TuitionAssessment
+ * @brief Kết quả tính học phí toàn trường
+ */
+struct TuitionAssessment {
+    std::size_t studentCount = 0;       ///< Tổng số sinh viên
+    std::size_t unratedCount = 0;       ///< Số sinh viên thuộc khoa chưa có đơn giá (không tính)
+    std::vector<TuitionChange> changes; ///< Các hồ sơ cần thay đổi, sắp theo studentId
+};
+
+/**
+ * @class ITuitionDao
+ * @brief Giao diện DAO tính học phí theo tín chỉ
+ */
+class ITuitionDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~ITuitionDao() = default;
+
+    /**
+     * @brief Tính học phí của mọi sinh viên thuộc khoa có đơn giá
+     *
+     * Sinh viên chưa có hồ sơ học phí chỉ xuất hiện trong kết quả khi học phí tính được lớn hơn 0.
+     * @param termId Học kỳ tính học phí: chỉ cộng tín chỉ của các đăng ký thuộc học kỳ này hoặc chưa gán
+     *               học kỳ; rỗng để cộng mọi đăng ký
+     * @return Kết quả tính, hoặc Error nếu thất bại
+     */
+    virtual std::expected<TuitionAssessment, Error> assessTuition(const std::string& termId) const = 0;
+};
+
+#endif // ITUITIONDAO_H
@@ -0,0 +1,54 @@
+/**
+ * @file ITuitionRateDao.h
+ * @brief Định nghĩa giao diện DAO cho bảng đơn giá học phí theo tín chỉ của từng khoa
+ */
+#ifndef ITUITIONRATEDAO_H
+#define ITUITIONRATEDAO_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct TuitionRate
+ * @brief Đơn giá học phí một tín chỉ của một khoa
+ */
+struct TuitionRate {
+    std::string facultyId;  ///< Mã khoa
+    long ratePerCredit = 0; ///< Học phí cho mỗi tín chỉ
+};
+
+/**
+ * @class ITuitionRateDao
+ * @brief Giao diện DAO cho bảng đơn giá học phí
+ */
+class ITuitionRateDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~ITuitionRateDao() = default;
+
+    /**
+     * @brief Lấy toàn bộ đơn giá, sắp theo mã khoa
+     * @return Danh sách đơn giá, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<TuitionRate>, Error> getAll() const = 0;
+
+    /**
+     * @brief Thêm hoặc thay đơn giá của một khoa
+     * @param rate Đơn giá (ratePerCredit >= 0)
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> upsert(const TuitionRate& rate) = 0;
+
+    /**
+     * @brief Xóa đơn giá của một khoa
+     * @param facultyId Mã khoa
+     * @return true nếu đã xóa, hoặc Error (NOT_FOUND nếu khoa chưa có đơn giá)
+     */
+    virtual std::expected<bool, Error> remove(const std::string& facultyId) = 0;
+};
+
+#endif // ITUITIONRATEDAO_H
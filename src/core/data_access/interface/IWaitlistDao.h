@@ -0,0 +1,79 @@
+/**
+ * @file IWaitlistDao.h
+ * @brief Định nghĩa giao diện DAO cho danh sách chờ của các khóa học đã đầy (bảng Waitlist)
+ *
+ * Thứ tự chờ trong một khóa học là (priorityClass, requestedAt, studentId): nhóm ưu tiên nhỏ hơn
+ * đứng trước, trong cùng nhóm thì ai đăng ký chờ sớm hơn đứng trước.
+ */
+#ifndef IWAITLISTDAO_H
+#define IWAITLISTDAO_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct WaitlistEntry
+ * @brief Một sinh viên đang chờ chỗ trong một khóa học
+ */
+struct WaitlistEntry {
+    std::string courseId;      ///< ID của khóa học
+    std::string studentId;     ///< ID của sinh viên
+    int priorityClass = 0;     ///< Nhóm ưu tiên (0 là cao nhất)
+    long long requestedAt = 0; ///< Thời điểm đăng ký chờ (micro giây kể từ epoch)
+
+    /**
+     * @brief So sánh theo thứ tự chờ trong cùng một khóa học
+     */
+    bool queuedBefore(const WaitlistEntry& other) const {
+        if (priorityClass != other.priorityClass) return priorityClass < other.priorityClass;
+        if (requestedAt != other.requestedAt) return requestedAt < other.requestedAt;
+        return studentId < other.studentId;
+    }
+};
+
+/**
+ * @class IWaitlistDao
+ * @brief Giao diện DAO cho danh sách chờ
+ *
+ * Mỗi sinh viên có tối đa một vị trí chờ trong mỗi khóa học.
+ */
+class IWaitlistDao {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IWaitlistDao() = default;
+
+    /**
+     * @brief Thêm một sinh viên vào danh sách chờ
+     * @param entry Vị trí chờ cần thêm
+     * @return true nếu thành công, hoặc Error (ALREADY_EXISTS nếu sinh viên đã chờ khóa học này)
+     */
+    virtual std::expected<bool, Error> add(const WaitlistEntry& entry) = 0;
+
+    /**
+     * @brief Xóa một sinh viên khỏi danh sách chờ
+     * @param courseId ID của khóa học
+     * @param studentId ID của sinh viên
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu sinh viên không chờ khóa học này)
+     */
+    virtual std::expected<bool, Error> remove(const std::string& courseId, const std::string& studentId) = 0;
+
+    /**
+     * @brief Lấy danh sách chờ của một khóa học theo thứ tự chờ
+     * @param courseId ID của khóa học
+     * @return Danh sách (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<WaitlistEntry>, Error> getByCourse(const std::string& courseId) const = 0;
+
+    /**
+     * @brief Lấy các khóa học mà một sinh viên đang chờ
+     * @param studentId ID của sinh viên
+     * @return Danh sách theo courseId (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<WaitlistEntry>, Error> getByStudent(const std::string& studentId) const = 0;
+};
+
+#endif // IWAITLISTDAO_H
@@ -0,0 +1,65 @@
+#include "MockAttendanceDao.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace {
+    std::map<std::string, std::vector<std::string>> mock_attendance_rosters;
+    std::map<std::pair<std::string, int>, AttendanceSession> mock_attendance_sessions;
+    std::mutex mock_attendance_mutex;
+}
+
+void MockAttendanceDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_attendance_mutex);
+    mock_attendance_rosters.clear();
+    mock_attendance_sessions.clear();
+}
+
+std::expected<std::vector<std::string>, Error> MockAttendanceDao::getRoster(const std::string& courseId) const {
+    std::lock_guard<std::mutex> lock(mock_attendance_mutex);
+    auto it = mock_attendance_rosters.find(courseId);
+    if (it == mock_attendance_rosters.end()) return std::vector<std::string>{};
+    return it->second;
+}
+
+std::expected<bool, Error> MockAttendanceDao::addToRoster(const std::string& courseId, int slot, const std::string& studentId) {
+    std::lock_guard<std::mutex> lock(mock_attendance_mutex);
+    auto& roster = mock_attendance_rosters[courseId];
+    if (slot < 0 || static_cast<std::size_t>(slot) != roster.size()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Mock attendance slot " + std::to_string(slot) + " is not the next free slot."});
+    }
+    if (std::find(roster.begin(), roster.end(), studentId) != roster.end()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " is already on the mock attendance roster."});
+    }
+    roster.push_back(studentId);
+    return true;
+}
+
+std::expected<std::vector<AttendanceSession>, Error> MockAttendanceDao::getSessions(const std::string& courseId) const {
+    std::lock_guard<std::mutex> lock(mock_attendance_mutex);
+    std::vector<AttendanceSession> sessions;
+    for (auto it = mock_attendance_sessions.lower_bound({courseId, 0});
+         it != mock_attendance_sessions.end() && it->first.first == courseId; ++it) {
+        sessions.push_back(it->second);
+    }
+    return sessions;
+}
+
+std::expected<AttendanceSession, Error> MockAttendanceDao::findSession(const std::string& courseId, int sessionNo) const {
+    std::lock_guard<std::mutex> lock(mock_attendance_mutex);
+    auto it = mock_attendance_sessions.find({courseId, sessionNo});
+    if (it == mock_attendance_sessions.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock attendance session not found."});
+    }
+    return it->second;
+}
+
+std::expected<bool, Error> MockAttendanceDao::saveSession(const AttendanceSession& session) {
+    if (session.sessionNo < 1) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Mock attendance session number must be at least 1."});
+    }
+    std::lock_guard<std::mutex> lock(mock_attendance_mutex);
+    mock_attendance_sessions[{session.courseId, session.sessionNo}] = session;
+    return true;
+}
@@ -0,0 +1,21 @@
+#ifndef MOCKATTENDANCEDAO_H
+#define MOCKATTENDANCEDAO_H
+
+#include "../interface/IAttendanceDao.h"
+#include <string>
+
+class MockAttendanceDao : public IAttendanceDao {
+public:
+    MockAttendanceDao() = default;
+    ~MockAttendanceDao() override = default;
+
+    std::expected<std::vector<std::string>, Error> getRoster(const std::string& courseId) const override;
+    std::expected<bool, Error> addToRoster(const std::string& courseId, int slot, const std::string& studentId) override;
+    std::expected<std::vector<AttendanceSession>, Error> getSessions(const std::string& courseId) const override;
+    std::expected<AttendanceSession, Error> findSession(const std::string& courseId, int sessionNo) const override;
+    std::expected<bool, Error> saveSession(const AttendanceSession& session) override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKATTENDANCEDAO_H
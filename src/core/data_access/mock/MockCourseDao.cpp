@@ -36,6 +36,10 @@ MockCourseDao::MockCourseDao() {
 }
 
 std::expected<Course, Error> MockCourseDao::getById(const std::string& id) const {
+    return findMockCourse(id);
+}
+
+std::expected<Course, Error> MockCourseDao::findMockCourse(const std::string& id) {
     auto it = mock_courses_data.find(id);
     if (it != mock_courses_data.end()) {
         return it->second;
@@ -20,6 +20,7 @@ public:
 
     static void initializeDefaultMockData();
     static void clearMockData();
+    static std::expected<Course, Error> findMockCourse(const std::string& id);
 };
 
 #endif // MOCKCOURSEDAO_H
@@ -1,5 +1,6 @@
 // --- START OF MODIFIED FILE src/core/data_access/mock/MockCourseResultDao.cpp ---
 #include "MockCourseResultDao.h"
+#include "MockEnrollmentDao.h"
 #include "../../entities/CourseResult.h"
 #include "../../../common/ErrorType.h"
 #include <algorithm>
@@ -15,6 +16,24 @@ namespace {
     std::string makeCourseResultKey(const std::string& studentId, const std::string& courseId) {
         return studentId + "_" + courseId;
     }
+
+    // Giống DAO SQL: kết quả không có học kỳ giữ học kỳ đang lưu, bản ghi mới lấy học kỳ của bản ghi đăng ký
+    void storeResult(const std::string& key, CourseResult result) {
+        if (result.getTermId().empty()) {
+            auto stored = mock_course_results_data.find(key);
+            if (stored != mock_course_results_data.end()) {
+                result.setTermId(stored->second.getTermId());
+            } else if (auto enrollments = MockEnrollmentDao().getAllEnrollments(); enrollments.has_value()) {
+                for (const auto& er : enrollments.value()) {
+                    if (er.studentId == result.getStudentId() && er.courseId == result.getCourseId()) {
+                        result.setTermId(er.termId);
+                        break;
+                    }
+                }
+            }
+        }
+        mock_course_results_data.insert_or_assign(key, std::move(result));
+    }
 }
 
 void MockCourseResultDao::initializeDefaultMockData() {
@@ -67,6 +86,35 @@ std::expected<std::vector<CourseResult>, Error> MockCourseResultDao::findByCours
     return results;
 }
 
+std::expected<std::vector<CourseResult>, Error> MockCourseResultDao::findByTerm(const std::string& termId) const {
+    std::vector<CourseResult> results;
+    for (const auto& pair : mock_course_results_data) {
+        if (pair.second.getTermId() == termId) {
+            results.push_back(pair.second);
+        }
+    }
+    return results;
+}
+
+std::expected<std::vector<CourseResult>, Error> MockCourseResultDao::findByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    std::vector<CourseResult> results;
+    for (const auto& pair : mock_course_results_data) {
+        if (pair.second.getTermId() == termId && pair.second.getCourseId() == courseId) {
+            results.push_back(pair.second);
+        }
+    }
+    return results;
+}
+
+std::expected<std::size_t, Error> MockCourseResultDao::forEachResult(const std::function<bool(const CourseResult&)>& visitor) const {
+    std::size_t visited = 0;
+    for (const auto& pair : mock_course_results_data) {
+        ++visited;
+        if (!visitor(pair.second)) break;
+    }
+    return visited;
+}
+
 std::expected<bool, Error> MockCourseResultDao::addOrUpdate(const CourseResult& result) {
     ValidationResult vr = result.validate(); 
     if (!vr.isValid) {
@@ -74,7 +122,21 @@ std::expected<bool, Error> MockCourseResultDao::addOrUpdate(const CourseResult&
         return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid CourseResult data: " + vr.errors[0].message});
     }
     auto key = makeCourseResultKey(result.getStudentId(), result.getCourseId());
-    mock_course_results_data.insert_or_assign(key, result); // Thêm hoặc ghi đè
+    storeResult(key, result); // Thêm hoặc ghi đè
+    return true;
+}
+
+std::expected<bool, Error> MockCourseResultDao::addOrUpdateBatch(const std::vector<CourseResult>& results) {
+    // Validate toàn bộ trước khi ghi để mô phỏng "tất cả hoặc không có gì" như transaction
+    for (const auto& result : results) {
+        ValidationResult vr = result.validate();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid CourseResult data: " + vr.errors[0].message});
+        }
+    }
+    for (const auto& result : results) {
+        storeResult(makeCourseResultKey(result.getStudentId(), result.getCourseId()), result);
+    }
     return true;
 }
 
@@ -15,7 +15,11 @@ public:
     std::expected<CourseResult, Error> find(const std::string& studentId, const std::string& courseId) const override;
     std::expected<std::vector<CourseResult>, Error> findByStudentId(const std::string& studentId) const override;
     std::expected<std::vector<CourseResult>, Error> findByCourseId(const std::string& courseId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByTerm(const std::string& termId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
+    std::expected<std::size_t, Error> forEachResult(const std::function<bool(const CourseResult&)>& visitor) const override;
     std::expected<bool, Error> addOrUpdate(const CourseResult& result) override;
+    std::expected<bool, Error> addOrUpdateBatch(const std::vector<CourseResult>& results) override;
     std::expected<bool, Error> remove(const std::string& studentId, const std::string& courseId) override;
     std::expected<bool, Error> removeAllForStudent(const std::string& studentId) override;
     std::expected<bool, Error> removeAllForCourse(const std::string& courseId) override;
@@ -0,0 +1,37 @@
+#include "MockDegreeRequirementDao.h"
+#include <map>
+#include <mutex>
+
+namespace {
+    std::map<std::string, DegreeRequirement> mock_degree_requirement_data;
+    std::mutex mock_degree_requirement_mutex;
+}
+
+void MockDegreeRequirementDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_degree_requirement_mutex);
+    mock_degree_requirement_data.clear();
+}
+
+std::expected<std::vector<DegreeRequirement>, Error> MockDegreeRequirementDao::getAll() const {
+    std::lock_guard<std::mutex> lock(mock_degree_requirement_mutex);
+    std::vector<DegreeRequirement> requirements;
+    for (const auto& [facultyId, requirement] : mock_degree_requirement_data) requirements.push_back(requirement);
+    return requirements;
+}
+
+std::expected<bool, Error> MockDegreeRequirementDao::upsert(const DegreeRequirement& requirement) {
+    if (requirement.facultyId.empty() || requirement.minTotalCredits < 0 || requirement.minCgpa < 0.0 || requirement.minCgpa > 4.0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid mock degree requirement for faculty '" + requirement.facultyId + "'."});
+    }
+    std::lock_guard<std::mutex> lock(mock_degree_requirement_mutex);
+    mock_degree_requirement_data[requirement.facultyId] = requirement;
+    return true;
+}
+
+std::expected<bool, Error> MockDegreeRequirementDao::remove(const std::string& facultyId) {
+    std::lock_guard<std::mutex> lock(mock_degree_requirement_mutex);
+    if (mock_degree_requirement_data.erase(facultyId) == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock degree requirement for faculty " + facultyId + " not found."});
+    }
+    return true;
+}
@@ -0,0 +1,19 @@
+#ifndef MOCKDEGREEREQUIREMENTDAO_H
+#define MOCKDEGREEREQUIREMENTDAO_H
+
+#include "../interface/IDegreeRequirementDao.h"
+#include <string>
+
+class MockDegreeRequirementDao : public IDegreeRequirementDao {
+public:
+    MockDegreeRequirementDao() = default;
+    ~MockDegreeRequirementDao() override = default;
+
+    std::expected<std::vector<DegreeRequirement>, Error> getAll() const override;
+    std::expected<bool, Error> upsert(const DegreeRequirement& requirement) override;
+    std::expected<bool, Error> remove(const std::string& facultyId) override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKDEGREEREQUIREMENTDAO_H
@@ -1,9 +1,11 @@
 // --- START OF MODIFIED FILE src/core/data_access/mock/MockEnrollmentDao.cpp ---
 #include "MockEnrollmentDao.h"
+#include "MockCourseDao.h"
 #include "../../../common/ErrorType.h"
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <iterator>
 #include <expected>
 
 namespace { 
@@ -50,6 +52,28 @@ std::expected<bool, Error> MockEnrollmentDao::addEnrollment(const std::string& s
     return true;
 }
 
+std::expected<bool, Error> MockEnrollmentDao::enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) {
+    // Dữ liệu mock của khóa học là dữ liệu tĩnh dùng chung với MockCourseDao
+    auto course = MockCourseDao::findMockCourse(courseId);
+    if (!course.has_value()) return std::unexpected(course.error());
+
+    auto enrolledCheck = isEnrolled(studentId, courseId);
+    if (!enrolledCheck.has_value()) return std::unexpected(enrolledCheck.error());
+    if (enrolledCheck.value()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " already enrolled in course " + courseId});
+    }
+
+    if (course->getCapacity() > 0) {
+        auto taken = std::count_if(mock_enrollments_data.begin(), mock_enrollments_data.end(),
+                                   [&](const EnrollmentRecord& er){ return er.courseId == courseId; });
+        if (taken >= course->getCapacity()) {
+            return std::unexpected(Error{ErrorCode::COURSE_CAPACITY_REACHED, "Course " + courseId + " has no seats left."});
+        }
+    }
+    mock_enrollments_data.push_back({studentId, courseId});
+    return true;
+}
+
 std::expected<bool, Error> MockEnrollmentDao::removeEnrollment(const std::string& studentId, const std::string& courseId) {
     auto it = std::remove_if(mock_enrollments_data.begin(), mock_enrollments_data.end(),
                              [&](const EnrollmentRecord& er){
@@ -113,4 +137,31 @@ std::expected<std::vector<std::string>, Error> MockEnrollmentDao::findStudentIds
 std::expected<std::vector<EnrollmentRecord>, Error> MockEnrollmentDao::getAllEnrollments() const {
     return mock_enrollments_data;
 }
+
+std::expected<std::vector<EnrollmentRecord>, Error> MockEnrollmentDao::findByTerm(const std::string& termId) const {
+    std::vector<EnrollmentRecord> records;
+    std::copy_if(mock_enrollments_data.begin(), mock_enrollments_data.end(), std::back_inserter(records),
+                 [&](const EnrollmentRecord& er){ return er.termId == termId; });
+    return records;
+}
+
+std::expected<std::vector<std::string>, Error> MockEnrollmentDao::findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    std::vector<std::string> studentIds;
+    for (const auto& er : mock_enrollments_data) {
+        if (er.termId == termId && er.courseId == courseId) {
+            studentIds.push_back(er.studentId);
+        }
+    }
+    return studentIds;
+}
+
+std::expected<bool, Error> MockEnrollmentDao::setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) {
+    auto it = std::find_if(mock_enrollments_data.begin(), mock_enrollments_data.end(),
+                           [&](const EnrollmentRecord& er){ return er.studentId == studentId && er.courseId == courseId; });
+    if (it == mock_enrollments_data.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Enrollment not found for Student " + studentId + " in Course " + courseId + "."});
+    }
+    it->termId = termId;
+    return true;
+}
 // --- END OF MODIFIED FILE src/core/data_access/mock/MockEnrollmentDao.cpp ---
\ No newline at end of file
@@ -13,6 +13,7 @@ public:
     ~MockEnrollmentDao() override = default;
     
     std::expected<bool, Error> addEnrollment(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) override;
     std::expected<bool, Error> removeEnrollment(const std::string& studentId, const std::string& courseId) override;
     std::expected<bool, Error> removeEnrollmentsByStudent(const std::string& studentId) override;
     std::expected<bool, Error> removeEnrollmentsByCourse(const std::string& courseId) override;
@@ -20,6 +21,9 @@ public:
     std::expected<std::vector<std::string>, Error> findCourseIdsByStudentId(const std::string& studentId) const override;
     std::expected<std::vector<std::string>, Error> findStudentIdsByCourseId(const std::string& courseId) const override;
     std::expected<std::vector<EnrollmentRecord>, Error> getAllEnrollments() const  override;
+    std::expected<std::vector<EnrollmentRecord>, Error> findByTerm(const std::string& termId) const override;
+    std::expected<std::vector<std::string>, Error> findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
+    std::expected<bool, Error> setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) override;
 
     static void initializeDefaultMockData();
     static void clearMockData();
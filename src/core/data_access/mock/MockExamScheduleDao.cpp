@@ -0,0 +1,34 @@
+#include "MockExamScheduleDao.h"
+#include <algorithm>
+#include <mutex>
+#include <tuple>
+
+namespace {
+    std::vector<ExamSlot> mock_exam_schedule_data;
+    std::mutex mock_exam_schedule_mutex;
+}
+
+void MockExamScheduleDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_exam_schedule_mutex);
+    mock_exam_schedule_data.clear();
+}
+
+std::expected<bool, Error> MockExamScheduleDao::replaceAll(const std::vector<ExamSlot>& slots) {
+    for (const auto& slot : slots) {
+        if (slot.courseId.empty() || slot.day < 1 || slot.period < 1) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid mock exam slot for course '" + slot.courseId + "'."});
+        }
+    }
+    std::vector<ExamSlot> sorted = slots;
+    std::sort(sorted.begin(), sorted.end(), [](const ExamSlot& a, const ExamSlot& b) {
+        return std::tie(a.day, a.period, a.courseId) < std::tie(b.day, b.period, b.courseId);
+    });
+    std::lock_guard<std::mutex> lock(mock_exam_schedule_mutex);
+    mock_exam_schedule_data = std::move(sorted);
+    return true;
+}
+
+std::expected<std::vector<ExamSlot>, Error> MockExamScheduleDao::getAll() const {
+    std::lock_guard<std::mutex> lock(mock_exam_schedule_mutex);
+    return mock_exam_schedule_data;
+}
@@ -0,0 +1,18 @@
+#ifndef MOCKEXAMSCHEDULEDAO_H
+#define MOCKEXAMSCHEDULEDAO_H
+
+#include "../interface/IExamScheduleDao.h"
+#include <string>
+
+class MockExamScheduleDao : public IExamScheduleDao {
+public:
+    MockExamScheduleDao() = default;
+    ~MockExamScheduleDao() override = default;
+
+    std::expected<bool, Error> replaceAll(const std::vector<ExamSlot>& slots) override;
+    std::expected<std::vector<ExamSlot>, Error> getAll() const override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKEXAMSCHEDULEDAO_H
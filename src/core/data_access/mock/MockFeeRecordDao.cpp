@@ -3,12 +3,14 @@
 #include "../../entities/FeeRecord.h" 
 #include "../../../common/ErrorType.h"
 #include <map>
+#include <set>
 #include <vector>
 #include <algorithm>
 #include <expected>
 
 namespace {
     std::map<std::string, FeeRecord> mock_fee_records_data;
+    std::map<std::string, FeePayment> mock_fee_payments_data; // Sổ cái, theo khóa idempotency
     bool mock_fee_record_data_initialized_flag = false;
 }
 
@@ -24,6 +26,7 @@ void MockFeeRecordDao::initializeDefaultMockData() {
 
 void MockFeeRecordDao::clearMockData() {
     mock_fee_records_data.clear();
+    mock_fee_payments_data.clear();
     mock_fee_record_data_initialized_flag = false;
 }
 
@@ -63,6 +66,42 @@ std::expected<FeeRecord, Error> MockFeeRecordDao::add(const FeeRecord& feeRecord
     return feeRecord;
 }
 
+std::expected<bool, Error> MockFeeRecordDao::addBatch(const std::vector<FeeRecord>& feeRecords) {
+    // Kiểm tra toàn bộ trước khi ghi để mô phỏng "tất cả hoặc không có gì" như transaction
+    std::set<std::string> batchIds;
+    for (const auto& feeRecord : feeRecords) {
+        ValidationResult vr = feeRecord.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data: " + vr.errors[0].message});
+        }
+        if (mock_fee_records_data.count(feeRecord.getStudentId()) || !batchIds.insert(feeRecord.getStudentId()).second) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Mock FeeRecord for Student ID " + feeRecord.getStudentId() + " already exists."});
+        }
+    }
+    for (const auto& feeRecord : feeRecords) {
+        mock_fee_records_data.emplace(feeRecord.getStudentId(), feeRecord);
+    }
+    return true;
+}
+
+std::expected<bool, Error> MockFeeRecordDao::setTotalFees(const std::vector<FeeRecord>& feeRecords) {
+    for (const auto& feeRecord : feeRecords) {
+        ValidationResult vr = feeRecord.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data: " + vr.errors[0].message});
+        }
+        auto it = mock_fee_records_data.find(feeRecord.getStudentId());
+        if (it != mock_fee_records_data.end() && it->second.getPaidFee() > feeRecord.getTotalFee()) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "New total fee is less than the amount already paid by " + feeRecord.getStudentId() + "."});
+        }
+    }
+    for (const auto& feeRecord : feeRecords) {
+        auto [it, inserted] = mock_fee_records_data.emplace(feeRecord.getStudentId(), feeRecord);
+        if (!inserted) it->second.setTotalFee(feeRecord.getTotalFee());
+    }
+    return true;
+}
+
 std::expected<bool, Error> MockFeeRecordDao::update(const FeeRecord& feeRecord) {
     ValidationResult vr = feeRecord.validateBasic();
     if (!vr.isValid) {
@@ -86,4 +125,35 @@ std::expected<bool, Error> MockFeeRecordDao::remove(const std::string& studentId
 std::expected<bool, Error> MockFeeRecordDao::exists(const std::string& studentId) const {
     return mock_fee_records_data.count(studentId) > 0;
 }
+
+std::expected<bool, Error> MockFeeRecordDao::recordPayment(const FeePayment& payment) {
+    if (payment.idempotencyKey.empty() || payment.amount <= 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Fee payment requires an idempotency key and a positive amount."});
+    }
+    auto recorded = mock_fee_payments_data.find(payment.idempotencyKey);
+    if (recorded != mock_fee_payments_data.end()) {
+        if (recorded->second.studentId != payment.studentId || recorded->second.amount != payment.amount) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Idempotency key '" + payment.idempotencyKey + "' was already used for a different payment."});
+        }
+        return false;
+    }
+    auto it = mock_fee_records_data.find(payment.studentId);
+    if (it == mock_fee_records_data.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock FeeRecord for Student ID " + payment.studentId + " not found."});
+    }
+    if (payment.amount > it->second.getDueFee() || !it->second.setPaidFee(it->second.getPaidFee() + payment.amount)) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Payment amount exceeds due fee."});
+    }
+    mock_fee_payments_data.emplace(payment.idempotencyKey, payment);
+    return true;
+}
+
+std::expected<std::vector<FeePayment>, Error> MockFeeRecordDao::getPayments(const std::string& studentId) const {
+    std::vector<FeePayment> payments;
+    for (const auto& pair : mock_fee_payments_data) {
+        if (pair.second.studentId == studentId) payments.push_back(pair.second);
+    }
+    std::stable_sort(payments.begin(), payments.end(), [](const FeePayment& a, const FeePayment& b) { return a.paidAt < b.paidAt; });
+    return payments;
+}
 // --- END OF MODIFIED FILE src/core/data_access/mock/MockFeeRecordDao.cpp ---
\ No newline at end of file
@@ -14,9 +14,13 @@ public:
     std::expected<FeeRecord, Error> getById(const std::string& studentId) const override;
     std::expected<std::vector<FeeRecord>, Error> getAll() const override;
     std::expected<FeeRecord, Error> add(const FeeRecord& feeRecord) override;
+    std::expected<bool, Error> addBatch(const std::vector<FeeRecord>& feeRecords) override;
+    std::expected<bool, Error> setTotalFees(const std::vector<FeeRecord>& feeRecords) override;
     std::expected<bool, Error> update(const FeeRecord& feeRecord) override;
     std::expected<bool, Error> remove(const std::string& studentId) override;
     std::expected<bool, Error> exists(const std::string& studentId) const override;
+    std::expected<bool, Error> recordPayment(const FeePayment& payment) override;
+    std::expected<std::vector<FeePayment>, Error> getPayments(const std::string& studentId) const override;
 
     static void initializeDefaultMockData();
     static void clearMockData();
@@ -0,0 +1,103 @@
+#include "MockInstallmentDao.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace {
+    // Khóa (dueDate, studentId, sequence): duyệt theo ngày đến hạn giống chỉ mục của bảng SQL
+    using InstallmentKey = std::tuple<std::string, std::string, int>;
+    std::map<InstallmentKey, FeeInstallment> mock_installments_data;
+    std::mutex mock_installments_mutex;
+
+    InstallmentKey keyOf(const FeeInstallment& installment) {
+        return {installment.dueDate, installment.studentId, installment.sequence};
+    }
+
+    std::vector<FeeInstallment> studentInstallments(const std::string& studentId) {
+        std::vector<FeeInstallment> installments;
+        for (const auto& [key, installment] : mock_installments_data) {
+            if (installment.studentId == studentId) installments.push_back(installment);
+        }
+        return installments; // Đã theo thứ tự dueDate, sequence
+    }
+}
+
+void MockInstallmentDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_installments_mutex);
+    mock_installments_data.clear();
+}
+
+std::expected<std::vector<FeeInstallment>, Error> MockInstallmentDao::getByStudent(const std::string& studentId) const {
+    std::lock_guard<std::mutex> lock(mock_installments_mutex);
+    return studentInstallments(studentId);
+}
+
+std::expected<bool, Error> MockInstallmentDao::replaceSchedule(const std::string& studentId, const std::vector<FeeInstallment>& installments) {
+    for (const auto& installment : installments) {
+        if (installment.studentId != studentId || installment.amount <= 0 ||
+            installment.paidAmount < 0 || installment.paidAmount > installment.amount) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid mock installment " + std::to_string(installment.sequence) +
+                                                                     " for student " + studentId + "."});
+        }
+    }
+    std::lock_guard<std::mutex> lock(mock_installments_mutex);
+    std::erase_if(mock_installments_data, [&studentId](const auto& entry) { return entry.second.studentId == studentId; });
+    for (const auto& installment : installments) {
+        mock_installments_data[keyOf(installment)] = installment;
+    }
+    return true;
+}
+
+std::expected<bool, Error> MockInstallmentDao::allocatePaid(const std::string& studentId, long paidTotal) {
+    std::lock_guard<std::mutex> lock(mock_installments_mutex);
+    long remaining = std::max(0L, paidTotal);
+    for (const auto& installment : studentInstallments(studentId)) {
+        long allocated = std::min(installment.amount, remaining);
+        remaining -= allocated;
+        mock_installments_data[keyOf(installment)].paidAmount = allocated;
+    }
+    return true;
+}
+
+std::expected<std::size_t, Error> MockInstallmentDao::markLate(const std::string& asOfDate) {
+    std::lock_guard<std::mutex> lock(mock_installments_mutex);
+    std::size_t flagged = 0;
+    auto last = mock_installments_data.lower_bound({asOfDate, "", 0});
+    for (auto it = mock_installments_data.begin(); it != last; ++it) {
+        if (it->second.outstanding() > 0 && !it->second.late) {
+            it->second.late = true;
+            ++flagged;
+        }
+    }
+    return flagged;
+}
+
+std::expected<std::vector<OverdueBalance>, Error> MockInstallmentDao::sumOverdue(const std::string& asOfDate) const {
+    std::lock_guard<std::mutex> lock(mock_installments_mutex);
+    std::map<std::string, OverdueBalance> balances;
+    auto last = mock_installments_data.lower_bound({asOfDate, "", 0});
+    for (auto it = mock_installments_data.begin(); it != last; ++it) {
+        const FeeInstallment& installment = it->second;
+        if (installment.outstanding() <= 0) continue;
+        OverdueBalance& balance = balances[installment.studentId];
+        if (balance.installmentCount == 0) balance.oldestDueDate = installment.dueDate; // Duyệt theo ngày tăng dần
+        balance.studentId = installment.studentId;
+        ++balance.installmentCount;
+        balance.overdueAmount += installment.outstanding();
+    }
+    std::vector<OverdueBalance> result;
+    result.reserve(balances.size());
+    for (auto& [studentId, balance] : balances) result.push_back(std::move(balance));
+    return result;
+}
+
+std::expected<std::vector<FeeInstallment>, Error> MockInstallmentDao::getOpenDueBetween(const std::string& fromDate, const std::string& toDate) const {
+    std::lock_guard<std::mutex> lock(mock_installments_mutex);
+    std::vector<FeeInstallment> installments;
+    for (auto it = mock_installments_data.lower_bound({fromDate, "", 0});
+         it != mock_installments_data.end() && std::get<0>(it->first) <= toDate; ++it) {
+        if (it->second.outstanding() > 0) installments.push_back(it->second);
+    }
+    return installments;
+}
@@ -0,0 +1,22 @@
+#ifndef MOCKINSTALLMENTDAO_H
+#define MOCKINSTALLMENTDAO_H
+
+#include "../interface/IInstallmentDao.h"
+#include <string>
+
+class MockInstallmentDao : public IInstallmentDao {
+public:
+    MockInstallmentDao() = default;
+    ~MockInstallmentDao() override = default;
+
+    std::expected<std::vector<FeeInstallment>, Error> getByStudent(const std::string& studentId) const override;
+    std::expected<bool, Error> replaceSchedule(const std::string& studentId, const std::vector<FeeInstallment>& installments) override;
+    std::expected<bool, Error> allocatePaid(const std::string& studentId, long paidTotal) override;
+    std::expected<std::size_t, Error> markLate(const std::string& asOfDate) override;
+    std::expected<std::vector<OverdueBalance>, Error> sumOverdue(const std::string& asOfDate) const override;
+    std::expected<std::vector<FeeInstallment>, Error> getOpenDueBetween(const std::string& fromDate, const std::string& toDate) const override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKINSTALLMENTDAO_H
@@ -3,6 +3,7 @@
 #include "../../../utils/PasswordInput.h"
 #include "../../../common/ErrorType.h"
 #include <map>
+#include <set>
 #include <vector>
 #include <algorithm>
 #include <expected>
@@ -57,6 +58,20 @@ std::expected<bool, Error> MockLoginDao::addUserCredentials(const std::string& u
     return true;
 }
 
+std::expected<bool, Error> MockLoginDao::addUserCredentialsBatch(const std::vector<LoginCredentials>& credentials) {
+    // Kiểm tra toàn bộ trước khi ghi để mô phỏng "tất cả hoặc không có gì" như transaction
+    std::set<std::string> batchIds;
+    for (const auto& creds : credentials) {
+        if (mock_login_credentials_data.count(creds.userId) || !batchIds.insert(creds.userId).second) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Mock User ID " + creds.userId + " already exists in login data."});
+        }
+    }
+    for (const auto& creds : credentials) {
+        mock_login_credentials_data.emplace(creds.userId, creds);
+    }
+    return true;
+}
+
 std::expected<bool, Error> MockLoginDao::updatePassword(const std::string& userId, const std::string& newPasswordHash, const std::string& newSalt) {
     auto it = mock_login_credentials_data.find(userId);
     if (it != mock_login_credentials_data.end()) {
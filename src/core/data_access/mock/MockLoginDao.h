@@ -14,6 +14,7 @@ public:
 
     std::expected<LoginCredentials, Error> findCredentialsByUserId(const std::string& userId) const override;
     std::expected<bool, Error> addUserCredentials(const std::string& userId, const std::string& passwordHash, const std::string& salt, UserRole role, LoginStatus status) override;
+    std::expected<bool, Error> addUserCredentialsBatch(const std::vector<LoginCredentials>& credentials) override;
     std::expected<bool, Error> updatePassword(const std::string& userId, const std::string& newPasswordHash, const std::string& newSalt) override;
     std::expected<bool, Error> removeUserCredentials(const std::string& userId) override;
     std::expected<UserRole, Error> getUserRole(const std::string& userId) const override;
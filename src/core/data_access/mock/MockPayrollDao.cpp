@@ -0,0 +1,69 @@
+#include "MockPayrollDao.h"
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace {
+    // Khóa (period, teacherId): duyệt theo thứ tự kỳ rồi đến giảng viên
+    std::map<std::pair<std::string, std::string>, SalaryPayment> mock_salary_payments_data;
+    std::mutex mock_salary_payments_mutex;
+}
+
+void MockPayrollDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_salary_payments_mutex);
+    mock_salary_payments_data.clear();
+}
+
+std::expected<std::vector<SalaryPayment>, Error> MockPayrollDao::getByPeriod(const std::string& period) const {
+    std::lock_guard<std::mutex> lock(mock_salary_payments_mutex);
+    std::vector<SalaryPayment> payments;
+    for (auto it = mock_salary_payments_data.lower_bound({period, ""});
+         it != mock_salary_payments_data.end() && it->first.first == period; ++it) {
+        payments.push_back(it->second);
+    }
+    return payments;
+}
+
+std::expected<std::vector<SalaryPayment>, Error> MockPayrollDao::getByTeacher(const std::string& teacherId) const {
+    std::lock_guard<std::mutex> lock(mock_salary_payments_mutex);
+    std::vector<SalaryPayment> payments;
+    for (const auto& [key, payment] : mock_salary_payments_data) {
+        if (key.second == teacherId) payments.push_back(payment);
+    }
+    return payments;
+}
+
+std::expected<bool, Error> MockPayrollDao::upsertBatch(const std::vector<SalaryPayment>& payments) {
+    for (const auto& payment : payments) {
+        if (payment.teacherId.empty() || payment.period.size() != 7 || payment.basicPay < 0 || payment.allowance < 0) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid mock salary payment for teacher '" + payment.teacherId + "'."});
+        }
+    }
+    std::lock_guard<std::mutex> lock(mock_salary_payments_mutex);
+    for (const auto& payment : payments) {
+        mock_salary_payments_data[{payment.period, payment.teacherId}] = payment;
+    }
+    return true;
+}
+
+std::expected<std::vector<PayrollYearToDate>, Error> MockPayrollDao::sumYearToDate(int year, int throughMonth) const {
+    if (throughMonth < 1 || throughMonth > 12) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Month must be between 1 and 12."});
+    }
+    std::lock_guard<std::mutex> lock(mock_salary_payments_mutex);
+    std::map<std::string, PayrollYearToDate> totals;
+    // "YYYY-13" vẫn nhỏ hơn mọi kỳ của năm sau nên dùng được làm cận trên
+    auto last = mock_salary_payments_data.lower_bound({payrollPeriod(year, throughMonth + 1), ""});
+    for (auto it = mock_salary_payments_data.lower_bound({payrollPeriod(year, 1), ""}); it != last; ++it) {
+        PayrollYearToDate& total = totals[it->second.teacherId];
+        total.teacherId = it->second.teacherId;
+        ++total.months;
+        total.totalBasic += it->second.basicPay;
+        total.totalAllowance += it->second.allowance;
+    }
+
+    std::vector<PayrollYearToDate> result;
+    result.reserve(totals.size());
+    for (auto& [teacherId, total] : totals) result.push_back(std::move(total));
+    return result;
+}
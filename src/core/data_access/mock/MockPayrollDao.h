@@ -0,0 +1,20 @@
+#ifndef MOCKPAYROLLDAO_H
+#define MOCKPAYROLLDAO_H
+
+#include "../interface/IPayrollDao.h"
+#include <string>
+
+class MockPayrollDao : public IPayrollDao {
+public:
+    MockPayrollDao() = default;
+    ~MockPayrollDao() override = default;
+
+    std::expected<std::vector<SalaryPayment>, Error> getByPeriod(const std::string& period) const override;
+    std::expected<std::vector<SalaryPayment>, Error> getByTeacher(const std::string& teacherId) const override;
+    std::expected<bool, Error> upsertBatch(const std::vector<SalaryPayment>& payments) override;
+    std::expected<std::vector<PayrollYearToDate>, Error> sumYearToDate(int year, int throughMonth) const override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKPAYROLLDAO_H
@@ -0,0 +1,43 @@
+#include "MockPrerequisiteDao.h"
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace {
+    // Khóa (courseId, prerequisiteId) giống khóa chính của bảng SQL
+    std::set<std::pair<std::string, std::string>> mock_prerequisite_data;
+    std::mutex mock_prerequisite_mutex;
+}
+
+void MockPrerequisiteDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_prerequisite_mutex);
+    mock_prerequisite_data.clear();
+}
+
+std::expected<bool, Error> MockPrerequisiteDao::add(const CoursePrerequisite& prerequisite) {
+    if (prerequisite.courseId == prerequisite.prerequisiteId) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Mock course " + prerequisite.courseId + " cannot be its own prerequisite."});
+    }
+    std::lock_guard<std::mutex> lock(mock_prerequisite_mutex);
+    if (!mock_prerequisite_data.emplace(prerequisite.courseId, prerequisite.prerequisiteId).second) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Mock course " + prerequisite.prerequisiteId + " is already a prerequisite of " + prerequisite.courseId + "."});
+    }
+    return true;
+}
+
+std::expected<bool, Error> MockPrerequisiteDao::remove(const std::string& courseId, const std::string& prerequisiteId) {
+    std::lock_guard<std::mutex> lock(mock_prerequisite_mutex);
+    if (mock_prerequisite_data.erase({courseId, prerequisiteId}) == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock course " + prerequisiteId + " is not a prerequisite of " + courseId + "."});
+    }
+    return true;
+}
+
+std::expected<std::vector<CoursePrerequisite>, Error> MockPrerequisiteDao::getAll() const {
+    std::lock_guard<std::mutex> lock(mock_prerequisite_mutex);
+    std::vector<CoursePrerequisite> prerequisites;
+    for (const auto& [courseId, prerequisiteId] : mock_prerequisite_data) {
+        prerequisites.push_back(CoursePrerequisite{courseId, prerequisiteId});
+    }
+    return prerequisites;
+}
@@ -0,0 +1,19 @@
+#ifndef MOCKPREREQUISITEDAO_H
+#define MOCKPREREQUISITEDAO_H
+
+#include "../interface/IPrerequisiteDao.h"
+#include <string>
+
+class MockPrerequisiteDao : public IPrerequisiteDao {
+public:
+    MockPrerequisiteDao() = default;
+    ~MockPrerequisiteDao() override = default;
+
+    std::expected<bool, Error> add(const CoursePrerequisite& prerequisite) override;
+    std::expected<bool, Error> remove(const std::string& courseId, const std::string& prerequisiteId) override;
+    std::expected<std::vector<CoursePrerequisite>, Error> getAll() const override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKPREREQUISITEDAO_H
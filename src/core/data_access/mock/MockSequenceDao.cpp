@@ -0,0 +1,45 @@
+#include "MockSequenceDao.h"
+#include <map>
+#include <mutex>
+#include <algorithm>
+
+namespace {
+    std::map<std::string, long long> mock_sequences_data;
+    std::mutex mock_sequences_mutex;
+}
+
+void MockSequenceDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_sequences_mutex);
+    mock_sequences_data.clear();
+}
+
+std::expected<long long, Error> MockSequenceDao::getValue(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mock_sequences_mutex);
+    auto it = mock_sequences_data.find(name);
+    if (it != mock_sequences_data.end()) {
+        return it->second;
+    }
+    return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock sequence '" + name + "' not found."});
+}
+
+std::expected<long long, Error> MockSequenceDao::advance(const std::string& name, long long count) {
+    std::lock_guard<std::mutex> lock(mock_sequences_mutex);
+    auto it = mock_sequences_data.find(name);
+    if (it == mock_sequences_data.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock sequence '" + name + "' not found."});
+    }
+    it->second += count;
+    return it->second;
+}
+
+std::expected<bool, Error> MockSequenceDao::raiseTo(const std::string& name, long long value) {
+    std::lock_guard<std::mutex> lock(mock_sequences_mutex);
+    auto [it, inserted] = mock_sequences_data.emplace(name, value);
+    if (!inserted) it->second = std::max(it->second, value);
+    return true;
+}
+
+std::expected<std::size_t, Error> MockSequenceDao::count() const {
+    std::lock_guard<std::mutex> lock(mock_sequences_mutex);
+    return mock_sequences_data.size();
+}
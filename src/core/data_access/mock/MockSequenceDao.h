@@ -0,0 +1,20 @@
+#ifndef MOCKSEQUENCEDAO_H
+#define MOCKSEQUENCEDAO_H
+
+#include "../interface/ISequenceDao.h"
+#include <string>
+
+class MockSequenceDao : public ISequenceDao {
+public:
+    MockSequenceDao() = default;
+    ~MockSequenceDao() override = default;
+
+    std::expected<long long, Error> getValue(const std::string& name) const override;
+    std::expected<long long, Error> advance(const std::string& name, long long count) override;
+    std::expected<bool, Error> raiseTo(const std::string& name, long long value) override;
+    std::expected<std::size_t, Error> count() const override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKSEQUENCEDAO_H
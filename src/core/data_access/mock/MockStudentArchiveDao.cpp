@@ -0,0 +1,57 @@
+#include "MockStudentArchiveDao.h"
+#include "MockStudentDao.h"
+#include "MockEnrollmentDao.h"
+#include "MockCourseResultDao.h"
+#include "MockFeeRecordDao.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+namespace {
+    std::map<std::string, Student> mock_archived_students;
+    std::mutex mock_archive_mutex;
+}
+
+void MockStudentArchiveDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_archive_mutex);
+    mock_archived_students.clear();
+}
+
+bool MockStudentArchiveDao::isAvailable() const {
+    return true;
+}
+
+std::expected<std::vector<std::string>, Error> MockStudentArchiveDao::findDisabledStudentIds(const std::string& /*disabledOnOrBefore*/,
+                                                                                           std::size_t limit) const {
+    // Mock không lưu ngày đổi trạng thái: mọi sinh viên DISABLED đều được coi là đã đủ lâu
+    auto students = MockStudentDao().getAll();
+    if (!students.has_value()) return std::unexpected(students.error());
+    std::vector<std::string> studentIds;
+    for (const auto& student : students.value()) {
+        if (student.getStatus() == LoginStatus::DISABLED) studentIds.push_back(student.getId());
+    }
+    std::sort(studentIds.begin(), studentIds.end());
+    if (studentIds.size() > limit) studentIds.resize(limit);
+    return studentIds;
+}
+
+std::expected<std::size_t, Error> MockStudentArchiveDao::archiveStudents(const std::vector<std::string>& studentIds) {
+    std::lock_guard<std::mutex> lock(mock_archive_mutex);
+    std::size_t archived = 0;
+    for (const auto& studentId : studentIds) {
+        auto student = MockStudentDao().getById(studentId);
+        if (!student.has_value()) continue; // Không phải sinh viên trong dữ liệu chính, hoặc đã chuyển
+        mock_archived_students.insert_or_assign(studentId, student.value());
+        MockEnrollmentDao().removeEnrollmentsByStudent(studentId);
+        MockCourseResultDao().removeAllForStudent(studentId);
+        MockFeeRecordDao().remove(studentId);
+        MockStudentDao().remove(studentId);
+        ++archived;
+    }
+    return archived;
+}
+
+std::expected<bool, Error> MockStudentArchiveDao::isArchived(const std::string& studentId) const {
+    std::lock_guard<std::mutex> lock(mock_archive_mutex);
+    return mock_archived_students.contains(studentId);
+}
@@ -0,0 +1,21 @@
+#ifndef MOCKSTUDENTARCHIVEDAO_H
+#define MOCKSTUDENTARCHIVEDAO_H
+
+#include "../interface/IStudentArchiveDao.h"
+#include <string>
+
+class MockStudentArchiveDao : public IStudentArchiveDao {
+public:
+    MockStudentArchiveDao() = default;
+    ~MockStudentArchiveDao() override = default;
+
+    bool isAvailable() const override;
+    std::expected<std::vector<std::string>, Error> findDisabledStudentIds(const std::string& disabledOnOrBefore,
+                                                                          std::size_t limit) const override;
+    std::expected<std::size_t, Error> archiveStudents(const std::vector<std::string>& studentIds) override;
+    std::expected<bool, Error> isArchived(const std::string& studentId) const override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKSTUDENTARCHIVEDAO_H
@@ -6,6 +6,7 @@
 #include <string>
 #include <algorithm>
 #include <map>
+#include <set>
 #include <expected> 
 
 namespace { 
@@ -79,6 +80,25 @@ std::expected<Student, Error> MockStudentDao::add(const Student& student) {
     return student;
 }
 
+std::expected<bool, Error> MockStudentDao::addBatch(const std::vector<Student>& students) {
+    // Kiểm tra toàn bộ trước khi ghi để mô phỏng "tất cả hoặc không có gì" như transaction
+    std::set<std::string> batchIds;
+    std::set<std::string> batchEmails;
+    for (const auto& pair : mock_students_data) batchEmails.insert(pair.second.getEmail());
+    for (const auto& student : students) {
+        if (mock_students_data.count(student.getId()) || !batchIds.insert(student.getId()).second) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Mock Student with ID " + student.getId() + " already exists"});
+        }
+        if (!batchEmails.insert(student.getEmail()).second) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Mock Student with email " + student.getEmail() + " already exists"});
+        }
+    }
+    for (const auto& student : students) {
+        mock_students_data.emplace(student.getId(), student);
+    }
+    return true;
+}
+
 std::expected<bool, Error> MockStudentDao::update(const Student& student) {
     auto it = mock_students_data.find(student.getId());
     if (it != mock_students_data.end()) {
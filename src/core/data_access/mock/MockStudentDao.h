@@ -22,6 +22,7 @@ public:
     std::expected<Student, Error> findByEmail(const std::string& email) const override;
     std::expected<std::vector<Student>, Error> findByStatus(LoginStatus status) const override;
     std::expected<bool, Error> updateStatus(const std::string& studentId, LoginStatus newStatus) override;
+    std::expected<bool, Error> addBatch(const std::vector<Student>& students) override;
 
     static void initializeDefaultMockData();
     static void clearMockData();
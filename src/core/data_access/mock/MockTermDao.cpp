@@ -0,0 +1,68 @@
+#include "MockTermDao.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+namespace {
+    std::map<std::string, AcademicTerm> mock_term_data;
+    std::mutex mock_term_mutex;
+}
+
+void MockTermDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_term_mutex);
+    mock_term_data.clear();
+}
+
+std::expected<std::vector<AcademicTerm>, Error> MockTermDao::getAll() const {
+    std::lock_guard<std::mutex> lock(mock_term_mutex);
+    std::vector<AcademicTerm> terms;
+    for (const auto& [termId, term] : mock_term_data) terms.push_back(term);
+    std::stable_sort(terms.begin(), terms.end(), [](const AcademicTerm& a, const AcademicTerm& b) { return a.startDate < b.startDate; });
+    return terms;
+}
+
+std::expected<AcademicTerm, Error> MockTermDao::findById(const std::string& termId) const {
+    std::lock_guard<std::mutex> lock(mock_term_mutex);
+    auto it = mock_term_data.find(termId);
+    if (it == mock_term_data.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock term " + termId + " not found."});
+    }
+    return it->second;
+}
+
+std::expected<AcademicTerm, Error> MockTermDao::findCurrent(const std::string& today) const {
+    std::lock_guard<std::mutex> lock(mock_term_mutex);
+    const AcademicTerm* current = nullptr;
+    for (const auto& [termId, term] : mock_term_data) {
+        if (term.closed || term.startDate > today) continue;
+        if (!current || term.startDate > current->startDate) current = &term;
+    }
+    if (!current) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "No open mock term has started by " + today + "."});
+    }
+    return *current;
+}
+
+std::expected<bool, Error> MockTermDao::add(const AcademicTerm& term) {
+    if (term.id.empty() || term.name.empty() || term.startDate > term.endDate) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid mock term '" + term.id + "'."});
+    }
+    std::lock_guard<std::mutex> lock(mock_term_mutex);
+    AcademicTerm stored = term;
+    stored.closed = false;
+    if (!mock_term_data.emplace(term.id, std::move(stored)).second) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Mock term " + term.id + " already exists."});
+    }
+    return true;
+}
+
+std::expected<bool, Error> MockTermDao::close(const std::string& termId) {
+    std::lock_guard<std::mutex> lock(mock_term_mutex);
+    auto it = mock_term_data.find(termId);
+    if (it == mock_term_data.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock term " + termId + " not found."});
+    }
+    if (it->second.closed) return false;
+    it->second.closed = true;
+    return true;
+}
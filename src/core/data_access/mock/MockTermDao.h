@@ -0,0 +1,21 @@
+#ifndef MOCKTERMDAO_H
+#define MOCKTERMDAO_H
+
+#include "../interface/ITermDao.h"
+#include <string>
+
+class MockTermDao : public ITermDao {
+public:
+    MockTermDao() = default;
+    ~MockTermDao() override = default;
+
+    std::expected<std::vector<AcademicTerm>, Error> getAll() const override;
+    std::expected<AcademicTerm, Error> findById(const std::string& termId) const override;
+    std::expected<AcademicTerm, Error> findCurrent(const std::string& today) const override;
+    std::expected<bool, Error> add(const AcademicTerm& term) override;
+    std::expected<bool, Error> close(const std::string& termId) override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKTERMDAO_H
@@ -0,0 +1,40 @@
+#include "MockTuitionRateDao.h"
+#include <map>
+#include <mutex>
+
+namespace {
+    std::map<std::string, long> mock_tuition_rates_data;
+    std::mutex mock_tuition_rates_mutex;
+}
+
+void MockTuitionRateDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_tuition_rates_mutex);
+    mock_tuition_rates_data.clear();
+}
+
+std::expected<std::vector<TuitionRate>, Error> MockTuitionRateDao::getAll() const {
+    std::lock_guard<std::mutex> lock(mock_tuition_rates_mutex);
+    std::vector<TuitionRate> rates;
+    rates.reserve(mock_tuition_rates_data.size());
+    for (const auto& [facultyId, rate] : mock_tuition_rates_data) {
+        rates.push_back(TuitionRate{facultyId, rate});
+    }
+    return rates;
+}
+
+std::expected<bool, Error> MockTuitionRateDao::upsert(const TuitionRate& rate) {
+    if (rate.facultyId.empty() || rate.ratePerCredit < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Mock tuition rate requires a faculty ID and a non-negative rate."});
+    }
+    std::lock_guard<std::mutex> lock(mock_tuition_rates_mutex);
+    mock_tuition_rates_data[rate.facultyId] = rate.ratePerCredit;
+    return true;
+}
+
+std::expected<bool, Error> MockTuitionRateDao::remove(const std::string& facultyId) {
+    std::lock_guard<std::mutex> lock(mock_tuition_rates_mutex);
+    if (mock_tuition_rates_data.erase(facultyId) == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Mock tuition rate for faculty " + facultyId + " not found."});
+    }
+    return true;
+}
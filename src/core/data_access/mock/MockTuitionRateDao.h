@@ -0,0 +1,19 @@
+#ifndef MOCKTUITIONRATEDAO_H
+#define MOCKTUITIONRATEDAO_H
+
+#include "../interface/ITuitionRateDao.h"
+#include <string>
+
+class MockTuitionRateDao : public ITuitionRateDao {
+public:
+    MockTuitionRateDao() = default;
+    ~MockTuitionRateDao() override = default;
+
+    std::expected<std::vector<TuitionRate>, Error> getAll() const override;
+    std::expected<bool, Error> upsert(const TuitionRate& rate) override;
+    std::expected<bool, Error> remove(const std::string& facultyId) override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKTUITIONRATEDAO_H
@@ -0,0 +1,54 @@
+#include "MockWaitlistDao.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace {
+    // Khóa (courseId, studentId) giống khóa chính của bảng SQL
+    std::map<std::pair<std::string, std::string>, WaitlistEntry> mock_waitlist_data;
+    std::mutex mock_waitlist_mutex;
+}
+
+void MockWaitlistDao::clearMockData() {
+    std::lock_guard<std::mutex> lock(mock_waitlist_mutex);
+    mock_waitlist_data.clear();
+}
+
+std::expected<bool, Error> MockWaitlistDao::add(const WaitlistEntry& entry) {
+    if (entry.priorityClass < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Mock waitlist priority class cannot be negative."});
+    }
+    std::lock_guard<std::mutex> lock(mock_waitlist_mutex);
+    if (!mock_waitlist_data.try_emplace({entry.courseId, entry.studentId}, entry).second) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + entry.studentId + " is already waitlisted for mock course " + entry.courseId + "."});
+    }
+    return true;
+}
+
+std::expected<bool, Error> MockWaitlistDao::remove(const std::string& courseId, const std::string& studentId) {
+    std::lock_guard<std::mutex> lock(mock_waitlist_mutex);
+    if (mock_waitlist_data.erase({courseId, studentId}) == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " is not waitlisted for mock course " + courseId + "."});
+    }
+    return true;
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> MockWaitlistDao::getByCourse(const std::string& courseId) const {
+    std::lock_guard<std::mutex> lock(mock_waitlist_mutex);
+    std::vector<WaitlistEntry> entries;
+    for (auto it = mock_waitlist_data.lower_bound({courseId, ""}); it != mock_waitlist_data.end() && it->first.first == courseId; ++it) {
+        entries.push_back(it->second);
+    }
+    std::sort(entries.begin(), entries.end(), [](const WaitlistEntry& a, const WaitlistEntry& b) { return a.queuedBefore(b); });
+    return entries;
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> MockWaitlistDao::getByStudent(const std::string& studentId) const {
+    std::lock_guard<std::mutex> lock(mock_waitlist_mutex);
+    std::vector<WaitlistEntry> entries;
+    for (const auto& [key, entry] : mock_waitlist_data) {
+        if (entry.studentId == studentId) entries.push_back(entry); // Đã theo thứ tự courseId
+    }
+    return entries;
+}
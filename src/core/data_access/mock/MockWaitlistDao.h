@@ -0,0 +1,20 @@
+#ifndef MOCKWAITLISTDAO_H
+#define MOCKWAITLISTDAO_H
+
+#include "../interface/IWaitlistDao.h"
+#include <string>
+
+class MockWaitlistDao : public IWaitlistDao {
+public:
+    MockWaitlistDao() = default;
+    ~MockWaitlistDao() override = default;
+
+    std::expected<bool, Error> add(const WaitlistEntry& entry) override;
+    std::expected<bool, Error> remove(const std::string& courseId, const std::string& studentId) override;
+    std::expected<std::vector<WaitlistEntry>, Error> getByCourse(const std::string& courseId) const override;
+    std::expected<std::vector<WaitlistEntry>, Error> getByStudent(const std::string& studentId) const override;
+
+    static void clearMockData();
+};
+
+#endif // MOCKWAITLISTDAO_H
@@ -0,0 +1,106 @@
+#include "SqlAttendanceDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string SELECT_SESSION_COLUMNS = "SELECT courseId, sessionNo, presence FROM AttendanceSessions ";
+
+    std::expected<std::vector<AttendanceSession>, Error> parseSessions(const DbQueryResultTable& rows) {
+        std::vector<AttendanceSession> sessions;
+        sessions.reserve(rows.size());
+        try {
+            for (const auto& row : rows) {
+                AttendanceSession session;
+                session.courseId = std::any_cast<std::string>(row.at("courseId"));
+                session.sessionNo = static_cast<int>(std::any_cast<long long>(row.at("sessionNo")));
+                session.presence = std::any_cast<std::vector<unsigned char>>(row.at("presence"));
+                sessions.push_back(std::move(session));
+            }
+        } catch (const std::exception& e) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse attendance session: ") + e.what()});
+        }
+        return sessions;
+    }
+}
+
+SqlAttendanceDao::SqlAttendanceDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlAttendanceDao.");
+    }
+}
+
+std::expected<std::vector<std::string>, Error> SqlAttendanceDao::getRoster(const std::string& courseId) const {
+    auto queryResult = _dbAdapter->executeQuery("SELECT slot, studentId FROM AttendanceRoster WHERE courseId = ? ORDER BY slot;", {courseId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<std::string> roster;
+    roster.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            auto slot = static_cast<std::size_t>(std::any_cast<long long>(row.at("slot")));
+            if (slot >= roster.size()) roster.resize(slot + 1);
+            roster[slot] = std::any_cast<std::string>(row.at("studentId"));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse attendance roster: ") + e.what()});
+    }
+    return roster;
+}
+
+std::expected<bool, Error> SqlAttendanceDao::addToRoster(const std::string& courseId, int slot, const std::string& studentId) {
+    if (slot < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Attendance slot cannot be negative."});
+    }
+    auto result = _dbAdapter->executeUpdate("INSERT INTO AttendanceRoster (courseId, slot, studentId) VALUES (?, ?, ?);",
+                                            {courseId, slot, studentId});
+    if (!result.has_value()) {
+        if (result.error().code == ErrorCode::ALREADY_EXISTS) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " or slot " + std::to_string(slot) +
+                                                                    " is already on the attendance roster of course " + courseId + "."});
+        }
+        if (result.error().code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course " + courseId + " not found."});
+        }
+        return std::unexpected(result.error());
+    }
+    return true;
+}
+
+std::expected<std::vector<AttendanceSession>, Error> SqlAttendanceDao::getSessions(const std::string& courseId) const {
+    auto queryResult = _dbAdapter->executeQuery(SELECT_SESSION_COLUMNS + "WHERE courseId = ? ORDER BY sessionNo;", {courseId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return parseSessions(queryResult.value());
+}
+
+std::expected<AttendanceSession, Error> SqlAttendanceDao::findSession(const std::string& courseId, int sessionNo) const {
+    auto queryResult = _dbAdapter->executeQuery(SELECT_SESSION_COLUMNS + "WHERE courseId = ? AND sessionNo = ?;", {courseId, sessionNo});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    auto sessions = parseSessions(queryResult.value());
+    if (!sessions.has_value()) return std::unexpected(sessions.error());
+    if (sessions->empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Attendance for session " + std::to_string(sessionNo) + " of course " + courseId + " not found."});
+    }
+    return std::move(sessions->front());
+}
+
+std::expected<bool, Error> SqlAttendanceDao::saveSession(const AttendanceSession& session) {
+    if (session.sessionNo < 1) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Attendance session number must be at least 1."});
+    }
+    auto result = _dbAdapter->executeUpdate(
+        "INSERT INTO AttendanceSessions (courseId, sessionNo, presence) VALUES (?, ?, ?) "
+        "ON CONFLICT(courseId, sessionNo) DO UPDATE SET presence = excluded.presence;",
+        {session.courseId, session.sessionNo, session.presence});
+    if (!result.has_value()) {
+        if (result.error().code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course " + session.courseId + " not found."});
+        }
+        return std::unexpected(result.error());
+    }
+    return true;
+}
@@ -0,0 +1,40 @@
+#ifndef SQLATTENDANCEDAO_H
+#define SQLATTENDANCEDAO_H
+
+/**
+ * @file SqlAttendanceDao.h
+ * @brief SQL implementation of the attendance data access object
+ */
+
+#include "../interface/IAttendanceDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlAttendanceDao
+ * @brief SQL implementation of IAttendanceDao over the AttendanceRoster and AttendanceSessions tables
+ *
+ * Each session is a single row whose presence bitmap is stored as a BLOB.
+ */
+class SqlAttendanceDao : public IAttendanceDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlAttendanceDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlAttendanceDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlAttendanceDao() override = default;
+
+    std::expected<std::vector<std::string>, Error> getRoster(const std::string& courseId) const override;
+    std::expected<bool, Error> addToRoster(const std::string& courseId, int slot, const std::string& studentId) override;
+    std::expected<std::vector<AttendanceSession>, Error> getSessions(const std::string& courseId) const override;
+    std::expected<AttendanceSession, Error> findSession(const std::string& courseId, int sessionNo) const override;
+    std::expected<bool, Error> saveSession(const AttendanceSession& session) override;
+};
+
+#endif // SQLATTENDANCEDAO_H
@@ -1,5 +1,10 @@
 #include "SqlCourseDao.h"
 #include <vector>
+#include "SqlDaoUtils.h"
+
+namespace {
+    const std::string SELECT_ALL_SQL = "SELECT id, name, credits, facultyId, capacity, schedule FROM Courses;";
+}
 
 SqlCourseDao::SqlCourseDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                            std::shared_ptr<IEntityParser<Course, DbQueryResultRow>> parser)
@@ -13,7 +18,7 @@ SqlCourseDao::SqlCourseDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
 }
 
 std::expected<Course, Error> SqlCourseDao::getById(const std::string& id) const {
-    std::string sql = "SELECT id, name, credits, facultyId FROM Courses WHERE id = ?;";
+    std::string sql = "SELECT id, name, credits, facultyId, capacity, schedule FROM Courses WHERE id = ?;";
     std::vector<DbQueryParam> params = {id};
 
     auto queryResult = _dbAdapter->executeQuery(sql, params);
@@ -29,7 +34,7 @@ std::expected<Course, Error> SqlCourseDao::getById(const std::string& id) const
 }
 
 std::expected<std::vector<Course>, Error> SqlCourseDao::getAll() const {
-    std::string sql = "SELECT id, name, credits, facultyId FROM Courses;";
+    const std::string& sql = SELECT_ALL_SQL;
     auto queryResult = _dbAdapter->executeQuery(sql);
 
     if (!queryResult.has_value()) {
@@ -49,6 +54,10 @@ std::expected<std::vector<Course>, Error> SqlCourseDao::getAll() const {
     return courses;
 }
 
+std::expected<std::size_t, Error> SqlCourseDao::forEach(const std::function<bool(const Course&)>& visitor) const {
+    return SqlDaoUtils::streamEntities<Course>(*_dbAdapter, SELECT_ALL_SQL, {}, *_parser, visitor, "courses");
+}
+
 std::expected<Course, Error> SqlCourseDao::add(const Course& course) {
     ValidationResult vr = course.validateBasic();
     if (!vr.isValid) {
@@ -63,7 +72,7 @@ std::expected<Course, Error> SqlCourseDao::add(const Course& course) {
         return std::unexpected(existIdCheck.error());
     }
 
-    std::string sql = "INSERT INTO Courses (id, name, credits, facultyId) VALUES (?, ?, ?, ?);";
+    std::string sql = "INSERT INTO Courses (id, name, credits, facultyId, capacity, schedule) VALUES (?, ?, ?, ?, ?, ?);";
     auto paramsResult = _parser->toQueryInsertParams(course);
     if (!paramsResult.has_value()) {
         return std::unexpected(paramsResult.error());
@@ -85,7 +94,7 @@ std::expected<bool, Error> SqlCourseDao::update(const Course& course) {
         return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Course data for update: " + vr.getErrorMessagesCombined()});
     }
 
-    std::string sql = "UPDATE Courses SET name = ?, credits = ?, facultyId = ? WHERE id = ?;";
+    std::string sql = "UPDATE Courses SET name = ?, credits = ?, facultyId = ?, capacity = ?, schedule = ? WHERE id = ?;";
     auto paramsResult = _parser->toQueryUpdateParams(course);
      if (!paramsResult.has_value()) {
         return std::unexpected(paramsResult.error());
@@ -108,7 +117,9 @@ std::expected<bool, Error> SqlCourseDao::remove(const std::string& id) {
 
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        // Trigger học kỳ đã đóng của Enrollments/CourseResults chặn cascade
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                                               "A record of Course " + id));
     }
     if (execResult.value() == 0) {
         return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course with ID " + id + " not found for removal."});
@@ -127,7 +138,7 @@ std::expected<bool, Error> SqlCourseDao::exists(const std::string& id) const {
 }
 
 std::expected<std::vector<Course>, Error> SqlCourseDao::findByFacultyId(const std::string& facultyId) const {
-    std::string sql = "SELECT id, name, credits, facultyId FROM Courses WHERE facultyId = ?;";
+    std::string sql = "SELECT id, name, credits, facultyId, capacity, schedule FROM Courses WHERE facultyId = ?;";
     std::vector<DbQueryParam> params = {facultyId};
     auto queryResult = _dbAdapter->executeQuery(sql, params);
 
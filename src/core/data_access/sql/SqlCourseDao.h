@@ -48,6 +48,13 @@ public:
      * @return Danh sách các đối tượng Course nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<std::vector<Course>, Error> getAll() const override;
+
+    /**
+     * @brief Duyệt tất cả khóa học theo luồng, không gom toàn bộ bảng vào bộ nhớ
+     * @param visitor Hàm xử lý từng khóa học; trả về false để dừng duyệt
+     * @return Số khóa học đã chuyển cho visitor, hoặc Error nếu truy vấn/phân tích thất bại
+     */
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Course&)>& visitor) const override;
     
     /**
      * @brief Thêm khóa học mới
@@ -66,7 +73,8 @@ public:
     /**
      * @brief Xóa khóa học theo ID
      * @param id ID của khóa học cần xóa
-     * @return true nếu thành công, hoặc Error nếu thất bại
+     * @return true nếu thành công, hoặc Error nếu thất bại (COURSE_ENROLLMENT_CLOSED nếu khóa học có
+     *         đăng ký hoặc kết quả thuộc học kỳ đã đóng)
      */
     std::expected<bool, Error> remove(const std::string& id) override;
     
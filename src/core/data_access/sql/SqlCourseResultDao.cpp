@@ -1,6 +1,19 @@
 #include "SqlCourseResultDao.h"
 #include <vector>
 #include <stdexcept> // For std::invalid_argument
+#include "SqlDaoUtils.h"
+
+namespace {
+    // Mã học kỳ rỗng được ghi là NULL: bản ghi mới lấy học kỳ của bản ghi đăng ký (trg_CourseResults_term_default),
+    // bản ghi đã có giữ học kỳ đang lưu
+    const std::string UPSERT_SQL = "INSERT INTO CourseResults (studentId, courseId, marks, termId) VALUES (?, ?, ?, ?) "
+                                   "ON CONFLICT(studentId, courseId) DO UPDATE SET marks = excluded.marks, "
+                                   "termId = COALESCE(excluded.termId, CourseResults.termId);";
+
+    DbQueryParam termParam(const CourseResult& result) {
+        return result.getTermId().empty() ? DbQueryParam{} : DbQueryParam{result.getTermId()};
+    }
+}
 
 SqlCourseResultDao::SqlCourseResultDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                                        std::shared_ptr<IEntityParser<CourseResult, DbQueryResultRow>> parser)
@@ -14,10 +27,11 @@ SqlCourseResultDao::SqlCourseResultDao(std::shared_ptr<IDatabaseAdapter> dbAdapt
 }
 
 std::expected<CourseResult, Error> SqlCourseResultDao::find(const std::string& studentId, const std::string& courseId) const {
-    std::string sql = "SELECT studentId, courseId, marks, grade FROM CourseResults WHERE studentId = ? AND courseId = ?;";
     std::vector<DbQueryParam> params = {studentId, courseId};
 
-    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    auto queryResult = SqlDaoUtils::queryWithArchiveFallback(*_dbAdapter, [](const std::string& schema) {
+        return "SELECT studentId, courseId, marks, grade, termId FROM " + schema + ".CourseResults WHERE studentId = ? AND courseId = ?;";
+    }, params);
     if (!queryResult.has_value()) {
         return std::unexpected(queryResult.error());
     }
@@ -30,9 +44,10 @@ std::expected<CourseResult, Error> SqlCourseResultDao::find(const std::string& s
 }
 
 std::expected<std::vector<CourseResult>, Error> SqlCourseResultDao::findByStudentId(const std::string& studentId) const {
-    std::string sql = "SELECT studentId, courseId, marks, grade FROM CourseResults WHERE studentId = ?;";
     std::vector<DbQueryParam> params = {studentId};
-    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    auto queryResult = SqlDaoUtils::queryWithArchiveFallback(*_dbAdapter, [](const std::string& schema) {
+        return "SELECT studentId, courseId, marks, grade, termId FROM " + schema + ".CourseResults WHERE studentId = ?;";
+    }, params);
 
     if (!queryResult.has_value()) {
         return std::unexpected(queryResult.error());
@@ -51,7 +66,7 @@ std::expected<std::vector<CourseResult>, Error> SqlCourseResultDao::findByStuden
 }
 
 std::expected<std::vector<CourseResult>, Error> SqlCourseResultDao::findByCourseId(const std::string& courseId) const {
-    std::string sql = "SELECT studentId, courseId, marks, grade FROM CourseResults WHERE courseId = ?;";
+    std::string sql = "SELECT studentId, courseId, marks, grade, termId FROM CourseResults WHERE courseId = ?;";
     std::vector<DbQueryParam> params = {courseId};
     auto queryResult = _dbAdapter->executeQuery(sql, params);
 
@@ -71,6 +86,40 @@ std::expected<std::vector<CourseResult>, Error> SqlCourseResultDao::findByCourse
     return results;
 }
 
+std::expected<std::vector<CourseResult>, Error> SqlCourseResultDao::findByTerm(const std::string& termId) const {
+    // idx_CourseResults_term bắt đầu bằng termId nên chỉ đọc các dòng của học kỳ này
+    std::string sql = "SELECT studentId, courseId, marks, grade, termId FROM CourseResults WHERE termId = ?;";
+    return queryResults(sql, {termId}, "term " + termId);
+}
+
+std::expected<std::vector<CourseResult>, Error> SqlCourseResultDao::findByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    std::string sql = "SELECT studentId, courseId, marks, grade, termId FROM CourseResults WHERE termId = ? AND courseId = ?;";
+    return queryResults(sql, {termId, courseId}, "course " + courseId + " in term " + termId);
+}
+
+std::expected<std::vector<CourseResult>, Error> SqlCourseResultDao::queryResults(const std::string& sql, const std::vector<DbQueryParam>& params,
+                                                                                  const std::string& scope) const {
+    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<CourseResult> results;
+    results.reserve(queryResult->size());
+    for (const auto& row : queryResult.value()) {
+        auto parseResult = _parser->parse(row);
+        if (!parseResult.has_value()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Failed to parse one or more course results for " + scope});
+        }
+        results.push_back(std::move(parseResult.value()));
+    }
+    return results;
+}
+
+std::expected<std::size_t, Error> SqlCourseResultDao::forEachResult(const std::function<bool(const CourseResult&)>& visitor) const {
+    std::string sql = "SELECT studentId, courseId, marks, grade, termId FROM CourseResults;";
+    return SqlDaoUtils::streamEntities<CourseResult>(*_dbAdapter, sql, {}, *_parser, visitor, "course results");
+}
+
 std::expected<bool, Error> SqlCourseResultDao::addOrUpdate(const CourseResult& result) {
     ValidationResult vr = result.validate();
     if(!vr.isValid){
@@ -85,18 +134,19 @@ std::expected<bool, Error> SqlCourseResultDao::addOrUpdate(const CourseResult& r
     // Sử dụng INSERT OR REPLACE cho đơn giản, hoặc INSERT ON CONFLICT nếu chỉ muốn update marks.
     // "INSERT OR REPLACE INTO CourseResults (studentId, courseId, marks) VALUES (?, ?, ?);"
     // Hoặc:
-    std::string sql = "INSERT INTO CourseResults (studentId, courseId, marks) VALUES (?, ?, ?) "
-                      "ON CONFLICT(studentId, courseId) DO UPDATE SET marks = excluded.marks;";
-                      // excluded.marks (SQLite) hoặc VALUES(marks) (MySQL) để lấy giá trị mới
+    const std::string& sql = UPSERT_SQL;
+    // excluded.marks (SQLite) hoặc VALUES(marks) (MySQL) để lấy giá trị mới
 
     auto paramsResult = _parser->toQueryInsertParams(result); // studentId, courseId, marks
     if(!paramsResult.has_value()){
         return std::unexpected(paramsResult.error());
     }
+    paramsResult->push_back(termParam(result));
 
     auto execResult = _dbAdapter->executeUpdate(sql, paramsResult.value());
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::GRADING_PERIOD_CLOSED,
+                                                               "Result of Student " + result.getStudentId() + " in Course " + result.getCourseId()));
     }
     // executeUpdate trả về số dòng bị ảnh hưởng. Với INSERT OR REPLACE, có thể là 1 (nếu insert) hoặc 2 (nếu replace = delete+insert).
     // Với INSERT ON CONFLICT DO UPDATE, là 1.
@@ -107,12 +157,56 @@ std::expected<bool, Error> SqlCourseResultDao::addOrUpdate(const CourseResult& r
     return true;
 }
 
+std::expected<bool, Error> SqlCourseResultDao::addOrUpdateBatch(const std::vector<CourseResult>& results) {
+    if (results.empty()) return true;
+
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(results.size());
+    for (const auto& result : results) {
+        ValidationResult vr = result.validate();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid CourseResult data for Student " + result.getStudentId() +
+                                                                     ": " + vr.getErrorMessagesCombined()});
+        }
+        auto paramsResult = _parser->toQueryInsertParams(result); // studentId, courseId, marks
+        if (!paramsResult.has_value()) {
+            return std::unexpected(paramsResult.error());
+        }
+        paramsResult->push_back(termParam(result));
+        paramSets.push_back(std::move(paramsResult.value()));
+    }
+
+    const std::string& sql = UPSERT_SQL;
+
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto execResult = _dbAdapter->executeBatchUpdate(sql, paramSets);
+    if (!execResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::GRADING_PERIOD_CLOSED, "A result in the batch"));
+    }
+    if (execResult.value() != static_cast<long>(results.size())) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Failed to add or update course results, expected " +
+                                     std::to_string(results.size()) + " rows but " + std::to_string(execResult.value()) + " were affected."});
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
+
 std::expected<bool, Error> SqlCourseResultDao::remove(const std::string& studentId, const std::string& courseId) {
     std::string sql = "DELETE FROM CourseResults WHERE studentId = ? AND courseId = ?;";
     std::vector<DbQueryParam> params = {studentId, courseId};
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::GRADING_PERIOD_CLOSED,
+                                                               "Result of Student " + studentId + " in Course " + courseId));
     }
     if (execResult.value() == 0) {
         return std::unexpected(Error{ErrorCode::NOT_FOUND, "CourseResult not found for removal (Student: " + studentId + ", Course: " + courseId + ")."});
@@ -125,7 +219,8 @@ std::expected<bool, Error> SqlCourseResultDao::removeAllForStudent(const std::st
     std::vector<DbQueryParam> params = {studentId};
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::GRADING_PERIOD_CLOSED,
+                                                               "A result of Student " + studentId));
     }
     return true; // Không coi là lỗi nếu không có gì để xóa
 }
@@ -135,7 +230,8 @@ std::expected<bool, Error> SqlCourseResultDao::removeAllForCourse(const std::str
     std::vector<DbQueryParam> params = {courseId};
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::GRADING_PERIOD_CLOSED,
+                                                               "A result of Course " + courseId));
     }
     return true; // Không coi là lỗi nếu không có gì để xóa
 }
\ No newline at end of file
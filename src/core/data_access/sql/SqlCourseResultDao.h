@@ -24,6 +24,13 @@ private:
     std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
     std::shared_ptr<IEntityParser<CourseResult, DbQueryResultRow>> _parser; ///< Parser for converting DB results to CourseResult objects
 
+    /**
+     * @brief Runs a SELECT over CourseResults and parses every row
+     * @param scope Description of the filter, used in the parse error message
+     */
+    std::expected<std::vector<CourseResult>, Error> queryResults(const std::string& sql, const std::vector<DbQueryParam>& params,
+                                                                 const std::string& scope) const;
+
 public:
     /**
      * @brief Constructor for SqlCourseResultDao
@@ -59,6 +66,21 @@ public:
      * @return A vector of course results or an error on database failure
      */
     std::expected<std::vector<CourseResult>, Error> findByCourseId(const std::string& courseId) const override;
+
+    /**
+     * @brief Finds all results of one term through idx_CourseResults_term
+     * @param termId The term ID
+     * @return A vector of course results or an error
+     */
+    std::expected<std::vector<CourseResult>, Error> findByTerm(const std::string& termId) const override;
+
+    /**
+     * @brief Finds the results of a course during one term
+     * @param termId The term ID
+     * @param courseId The course ID
+     * @return A vector of course results or an error
+     */
+    std::expected<std::vector<CourseResult>, Error> findByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
     
     /**
      * @brief Adds a new course result or updates an existing one
@@ -66,6 +88,23 @@ public:
      * @return True if the operation succeeded, or an error on failure
      */
     std::expected<bool, Error> addOrUpdate(const CourseResult& result) override;
+
+    /**
+     * @brief Streams every course result through the visitor without materializing the table
+     * @param visitor Called for each row; return false to stop early
+     * @return Number of rows passed to the visitor or an error on database/parsing failure
+     */
+    std::expected<std::size_t, Error> forEachResult(const std::function<bool(const CourseResult&)>& visitor) const override;
+
+    /**
+     * @brief Adds or updates many course results in a single transaction
+     *
+     * The upsert statement is prepared once and re-bound for each row; any failure
+     * rolls back the whole batch.
+     * @param results The course results to add or update
+     * @return True if every row was written, or an error on failure
+     */
+    std::expected<bool, Error> addOrUpdateBatch(const std::vector<CourseResult>& results) override;
     
     /**
      * @brief Removes a specific course result
@@ -0,0 +1,84 @@
+#ifndef SQLDAOUTILS_H
+#define SQLDAOUTILS_H
+
+/**
+ * @file SqlDaoUtils.h
+ * @brief Helpers shared by the SQL data access objects
+ */
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <expected>
+#include <cstddef>
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "../../../common/ErrorType.h"
+
+namespace SqlDaoUtils {
+
+    /**
+     * @brief Runs a SELECT through the adapter's streaming cursor and hands each parsed entity to the visitor
+     *
+     * Rows are parsed one at a time, so memory stays flat regardless of the table size. A row that fails
+     * to parse aborts the scan with PARSING_ERROR (same contract as the getAll() implementations).
+     * @return Number of entities passed to the visitor
+     */
+    template <typename TEntity>
+    std::expected<std::size_t, Error> streamEntities(IDatabaseAdapter& adapter, const std::string& sql,
+                                                     const std::vector<DbQueryParam>& params,
+                                                     const IEntityParser<TEntity, DbQueryResultRow>& parser,
+                                                     const std::function<bool(const TEntity&)>& visitor,
+                                                     const std::string& entityName) {
+        std::optional<Error> parseError;
+        std::size_t visited = 0;
+        auto scan = adapter.executeQueryStreaming(sql, params, [&](const DbQueryResultRow& row) {
+            auto entity = parser.parse(row);
+            if (!entity.has_value()) {
+                parseError = Error{ErrorCode::PARSING_ERROR, "Failed to parse one or more " + entityName + ": " + entity.error().message};
+                return false;
+            }
+            ++visited;
+            return visitor(entity.value());
+        });
+        if (!scan.has_value()) return std::unexpected(scan.error());
+        if (parseError) return std::unexpected(*parseError);
+        return visited;
+    }
+
+    /**
+     * @brief Message raised by the Terms read-only triggers (see the Terms schema in SQLiteAdapter)
+     */
+    inline constexpr const char* TERM_CLOSED_MESSAGE = "Term is closed";
+
+    /**
+     * @brief Rewrites a write rejected by a closed-term trigger into the given domain error code
+     * @param error Error returned by the adapter
+     * @param closedCode Error code to report when the row belongs to a closed term
+     * @param what Description of the rejected write, used in the message
+     */
+    inline Error mapClosedTermError(Error error, int closedCode, const std::string& what) {
+        if (error.code == ErrorCode::DB_CONSTRAINT_ERROR && error.message.find(TERM_CLOSED_MESSAGE) != std::string::npos) {
+            return Error{closedCode, what + " belongs to a closed term and is read-only."};
+        }
+        return error;
+    }
+
+    /**
+     * @brief Runs a per-student SELECT on the main tables and, on an empty result, on the attached archive
+     *
+     * Archived students keep their rows under IDatabaseAdapter::ARCHIVE_SCHEMA with the same table and
+     * column names, so the same statement is built twice with a different schema prefix.
+     * @param sqlFor Builds the statement for a schema name ("main" or the archive schema)
+     */
+    inline std::expected<DbQueryResultTable, Error> queryWithArchiveFallback(IDatabaseAdapter& adapter,
+                                                                             const std::function<std::string(const std::string&)>& sqlFor,
+                                                                             const std::vector<DbQueryParam>& params) {
+        auto hot = adapter.executeQuery(sqlFor("main"), params);
+        if (!hot.has_value() || !hot->empty() || !adapter.hasArchive()) return hot;
+        return adapter.executeQuery(sqlFor(IDatabaseAdapter::ARCHIVE_SCHEMA), params);
+    }
+}
+
+#endif // SQLDAOUTILS_H
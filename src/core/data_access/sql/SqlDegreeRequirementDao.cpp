@@ -0,0 +1,66 @@
+#include "SqlDegreeRequirementDao.h"
+#include "../../../utils/StringUtils.h"
+#include <stdexcept> // For std::invalid_argument
+
+SqlDegreeRequirementDao::SqlDegreeRequirementDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlDegreeRequirementDao.");
+    }
+}
+
+std::expected<std::vector<DegreeRequirement>, Error> SqlDegreeRequirementDao::getAll() const {
+    auto queryResult = _dbAdapter->executeQuery(
+        "SELECT facultyId, minTotalCredits, minCgpa, requiredCourses FROM DegreeRequirements ORDER BY facultyId;");
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+
+    std::vector<DegreeRequirement> requirements;
+    requirements.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            DegreeRequirement requirement;
+            requirement.facultyId = std::any_cast<std::string>(row.at("facultyId"));
+            requirement.minTotalCredits = static_cast<int>(std::any_cast<long long>(row.at("minTotalCredits")));
+            // SQLite trả về số nguyên nếu giá trị REAL không có phần lẻ được lưu dưới dạng INTEGER
+            const std::any& minCgpa = row.at("minCgpa");
+            requirement.minCgpa = minCgpa.type() == typeid(double) ? std::any_cast<double>(minCgpa)
+                                                                   : static_cast<double>(std::any_cast<long long>(minCgpa));
+            requirement.requiredCourseIds = StringUtils::split(std::any_cast<std::string>(row.at("requiredCourses")), ';');
+            requirements.push_back(std::move(requirement));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse degree requirement: ") + e.what()});
+    }
+    return requirements;
+}
+
+std::expected<bool, Error> SqlDegreeRequirementDao::upsert(const DegreeRequirement& requirement) {
+    if (requirement.facultyId.empty() || requirement.minTotalCredits < 0 || requirement.minCgpa < 0.0 || requirement.minCgpa > 4.0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid degree requirement for faculty '" + requirement.facultyId + "'."});
+    }
+    std::string sql = "INSERT INTO DegreeRequirements (facultyId, minTotalCredits, minCgpa, requiredCourses) VALUES (?, ?, ?, ?) "
+                      "ON CONFLICT(facultyId) DO UPDATE SET minTotalCredits = excluded.minTotalCredits, "
+                      "minCgpa = excluded.minCgpa, requiredCourses = excluded.requiredCourses;";
+    auto result = _dbAdapter->executeUpdate(sql, {requirement.facultyId, requirement.minTotalCredits, requirement.minCgpa,
+                                                  StringUtils::join(requirement.requiredCourseIds, ';')});
+    if (!result.has_value()) {
+        if (result.error().code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Faculty " + requirement.facultyId + " not found."});
+        }
+        return std::unexpected(result.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlDegreeRequirementDao::remove(const std::string& facultyId) {
+    auto result = _dbAdapter->executeUpdate("DELETE FROM DegreeRequirements WHERE facultyId = ?;", {facultyId});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    if (result.value() == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Degree requirement for faculty " + facultyId + " not found."});
+    }
+    return true;
+}
@@ -0,0 +1,39 @@
+#ifndef SQLDEGREEREQUIREMENTDAO_H
+#define SQLDEGREEREQUIREMENTDAO_H
+
+/**
+ * @file SqlDegreeRequirementDao.h
+ * @brief SQL implementation of the per-faculty degree requirement data access object
+ */
+
+#include "../interface/IDegreeRequirementDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlDegreeRequirementDao
+ * @brief SQL implementation of IDegreeRequirementDao over the DegreeRequirements table
+ *
+ * Required courses are stored as one ';'-separated column since they are always read and
+ * replaced together with the rest of the rule.
+ */
+class SqlDegreeRequirementDao : public IDegreeRequirementDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlDegreeRequirementDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlDegreeRequirementDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlDegreeRequirementDao() override = default;
+
+    std::expected<std::vector<DegreeRequirement>, Error> getAll() const override;
+    std::expected<bool, Error> upsert(const DegreeRequirement& requirement) override;
+    std::expected<bool, Error> remove(const std::string& facultyId) override;
+};
+
+#endif // SQLDEGREEREQUIREMENTDAO_H
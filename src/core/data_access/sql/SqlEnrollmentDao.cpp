@@ -3,6 +3,11 @@
 #include <stdexcept> // For std::invalid_argument
 #include "../../database_adapter/sql/sqlite3.h"
 #include "../../parsing/impl_sql_parser/SqlParserUtils.h"
+#include "SqlDaoUtils.h"
+
+namespace {
+    const std::string SELECT_ALL_SQL = "SELECT studentId, courseId, enrollmentDate, termId FROM Enrollments;"; // Lấy cả enrollmentDate
+}
 
 SqlEnrollmentDao::SqlEnrollmentDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                                    std::shared_ptr<IEntityParser<EnrollmentRecord, DbQueryResultRow>> parser)
@@ -41,13 +46,40 @@ std::expected<bool, Error> SqlEnrollmentDao::addEnrollment(const std::string& st
     return true;
 }
 
+std::expected<bool, Error> SqlEnrollmentDao::enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) {
+    std::string sql = "INSERT INTO Enrollments (studentId, courseId) SELECT ?, id FROM Courses WHERE id = ?;";
+    std::vector<DbQueryParam> params = {studentId, courseId};
+
+    auto execResult = _dbAdapter->executeUpdate(sql, params);
+    if (!execResult.has_value()) {
+        const Error& error = execResult.error();
+        if (error.code == ErrorCode::ALREADY_EXISTS) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " already enrolled in course " + courseId + "."});
+        }
+        // Khóa chính trả về ALREADY_EXISTS, khóa ngoại trả về DB_FOREIGN_KEY_ERROR; ràng buộc còn lại
+        // của lệnh này chỉ có RAISE trong trg_Enrollments_seat_check
+        if (error.code == ErrorCode::DB_CONSTRAINT_ERROR) {
+            return std::unexpected(Error{ErrorCode::COURSE_CAPACITY_REACHED, "Course " + courseId + " has no seats left."});
+        }
+        if (error.code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " not found."});
+        }
+        return std::unexpected(error);
+    }
+    if (execResult.value() == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course with ID '" + courseId + "' not found."});
+    }
+    return true;
+}
+
 std::expected<bool, Error> SqlEnrollmentDao::removeEnrollment(const std::string& studentId, const std::string& courseId) {
     std::string sql = "DELETE FROM Enrollments WHERE studentId = ? AND courseId = ?;";
     std::vector<DbQueryParam> params = {studentId, courseId};
 
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                                               "Enrollment of Student " + studentId + " in Course " + courseId));
     }
     if (execResult.value() == 0) {
         return std::unexpected(Error{ErrorCode::NOT_FOUND, "Enrollment not found for Student " + studentId + " in Course " + courseId + "."});
@@ -60,7 +92,8 @@ std::expected<bool, Error> SqlEnrollmentDao::removeEnrollmentsByStudent(const st
     std::vector<DbQueryParam> params = {studentId};
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                                               "An enrollment of Student " + studentId));
     }
     // Việc không xóa dòng nào (vì SV không đăng ký môn nào) không phải là lỗi.
     return true;
@@ -71,7 +104,8 @@ std::expected<bool, Error> SqlEnrollmentDao::removeEnrollmentsByCourse(const std
     std::vector<DbQueryParam> params = {courseId};
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                                               "An enrollment of Course " + courseId));
     }
     // Tương tự, không xóa dòng nào không phải là lỗi.
     return true;
@@ -88,9 +122,10 @@ std::expected<bool, Error> SqlEnrollmentDao::isEnrolled(const std::string& stude
 }
 
 std::expected<std::vector<std::string>, Error> SqlEnrollmentDao::findCourseIdsByStudentId(const std::string& studentId) const {
-    std::string sql = "SELECT courseId FROM Enrollments WHERE studentId = ?;";
     std::vector<DbQueryParam> params = {studentId};
-    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    auto queryResult = SqlDaoUtils::queryWithArchiveFallback(*_dbAdapter, [](const std::string& schema) {
+        return "SELECT courseId FROM " + schema + ".Enrollments WHERE studentId = ?;";
+    }, params);
 
     if (!queryResult.has_value()) {
         return std::unexpected(queryResult.error());
@@ -126,7 +161,7 @@ std::expected<std::vector<std::string>, Error> SqlEnrollmentDao::findStudentIdsB
 }
 
 std::expected<std::vector<EnrollmentRecord>, Error> SqlEnrollmentDao::getAllEnrollments() const {
-    std::string sql = "SELECT studentId, courseId, enrollmentDate FROM Enrollments;"; // Lấy cả enrollmentDate
+    const std::string& sql = SELECT_ALL_SQL;
     auto queryResult = _dbAdapter->executeQuery(sql);
 
     if (!queryResult.has_value()) {
@@ -142,4 +177,57 @@ std::expected<std::vector<EnrollmentRecord>, Error> SqlEnrollmentDao::getAllEnro
         }
     }
     return records;
-}
\ No newline at end of file
+}
+
+std::expected<std::vector<EnrollmentRecord>, Error> SqlEnrollmentDao::findByTerm(const std::string& termId) const {
+    // idx_Enrollments_term bắt đầu bằng termId nên chỉ đọc các dòng của học kỳ này
+    std::string sql = "SELECT studentId, courseId, enrollmentDate, termId FROM Enrollments WHERE termId = ?;";
+    auto queryResult = _dbAdapter->executeQuery(sql, {termId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<EnrollmentRecord> records;
+    records.reserve(queryResult->size());
+    for (const auto& row : queryResult.value()) {
+        auto parseResult = _parser->parse(row);
+        if (!parseResult.has_value()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Failed to parse one or more enrollment records of term " + termId + "."});
+        }
+        records.push_back(std::move(parseResult.value()));
+    }
+    return records;
+}
+
+std::expected<std::vector<std::string>, Error> SqlEnrollmentDao::findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    std::string sql = "SELECT studentId FROM Enrollments WHERE termId = ? AND courseId = ?;";
+    auto queryResult = _dbAdapter->executeQuery(sql, {termId, courseId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<std::string> studentIds;
+    studentIds.reserve(queryResult->size());
+    for (const auto& row : queryResult.value()) {
+        studentIds.push_back(SqlParserUtils::getOptional<std::string>(row, "studentId"));
+    }
+    return studentIds;
+}
+
+std::expected<bool, Error> SqlEnrollmentDao::setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) {
+    std::string sql = "UPDATE Enrollments SET termId = ? WHERE studentId = ? AND courseId = ?;";
+    auto execResult = _dbAdapter->executeUpdate(sql, {termId.empty() ? DbQueryParam{} : DbQueryParam{termId}, studentId, courseId});
+    if (!execResult.has_value()) {
+        if (execResult.error().code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Term " + termId + " not found."});
+        }
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                                               "Enrollment of Student " + studentId + " in Course " + courseId));
+    }
+    if (execResult.value() == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Enrollment not found for Student " + studentId + " in Course " + courseId + "."});
+    }
+    return true;
+}
+
+std::expected<std::size_t, Error> SqlEnrollmentDao::forEachEnrollment(const std::function<bool(const EnrollmentRecord&)>& visitor) const {
+    return SqlDaoUtils::streamEntities<EnrollmentRecord>(*_dbAdapter, SELECT_ALL_SQL, {}, *_parser, visitor, "enrollment records");
+}
@@ -45,6 +45,18 @@ public:
      * @return True if enrollment succeeded, or an error on failure
      */
     std::expected<bool, Error> addEnrollment(const std::string& studentId, const std::string& courseId) override;
+
+    /**
+     * @brief Enrolls the student in one INSERT ... SELECT statement
+     *
+     * The SELECT over Courses skips unknown courses, and the Enrollments_seat_* triggers check and
+     * bump Courses.enrolledCount inside the same statement, so a full course is rejected without
+     * any extra round trip.
+     * @param studentId The ID of the student
+     * @param courseId The ID of the course
+     * @return True if enrolled; NOT_FOUND, ALREADY_EXISTS or COURSE_CAPACITY_REACHED otherwise
+     */
+    std::expected<bool, Error> enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) override;
     
     /**
      * @brief Removes a specific enrollment
@@ -95,6 +107,37 @@ public:
      * @return A vector of all enrollment records or an error on database failure
      */
     std::expected<std::vector<EnrollmentRecord>, Error> getAllEnrollments() const override;
+
+    /**
+     * @brief Retrieves the enrollments of one term through idx_Enrollments_term
+     * @param termId The term ID
+     * @return The term's enrollment records or an error on database failure
+     */
+    std::expected<std::vector<EnrollmentRecord>, Error> findByTerm(const std::string& termId) const override;
+
+    /**
+     * @brief Finds the students enrolled in a course during one term
+     * @param termId The term ID
+     * @param courseId The course ID
+     * @return A vector of student IDs or an error on database failure
+     */
+    std::expected<std::vector<std::string>, Error> findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
+
+    /**
+     * @brief Moves an enrollment to another term (or clears its term)
+     * @param studentId The student ID
+     * @param courseId The course ID
+     * @param termId The term ID, empty to clear
+     * @return true on success; NOT_FOUND for an unknown enrollment or term, COURSE_ENROLLMENT_CLOSED if either term is closed
+     */
+    std::expected<bool, Error> setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) override;
+
+    /**
+     * @brief Streams every enrollment record through the visitor without materializing the table
+     * @param visitor Called for each row; return false to stop early
+     * @return Number of rows passed to the visitor or an error on database/parsing failure
+     */
+    std::expected<std::size_t, Error> forEachEnrollment(const std::function<bool(const EnrollmentRecord&)>& visitor) const override;
 };
 
 #endif // SQLENROLLMENTDAO_H
\ No newline at end of file
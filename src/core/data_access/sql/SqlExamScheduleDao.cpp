@@ -0,0 +1,65 @@
+#include "SqlExamScheduleDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+SqlExamScheduleDao::SqlExamScheduleDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlExamScheduleDao.");
+    }
+}
+
+std::expected<bool, Error> SqlExamScheduleDao::replaceAll(const std::vector<ExamSlot>& slots) {
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(slots.size());
+    for (const auto& slot : slots) {
+        if (slot.courseId.empty() || slot.day < 1 || slot.period < 1) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid exam slot for course '" + slot.courseId + "'."});
+        }
+        paramSets.push_back({slot.courseId, slot.day, slot.period});
+    }
+
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto deleteResult = _dbAdapter->executeUpdate("DELETE FROM ExamSchedule;");
+    if (!deleteResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(deleteResult.error());
+    }
+    if (!paramSets.empty()) {
+        auto batchResult = _dbAdapter->executeBatchUpdate("INSERT INTO ExamSchedule (courseId, examDay, period) VALUES (?, ?, ?);", paramSets);
+        if (!batchResult.has_value()) {
+            _dbAdapter->rollbackTransaction();
+            if (batchResult.error().code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+                return std::unexpected(Error{ErrorCode::NOT_FOUND, "Exam schedule refers to a course that does not exist."});
+            }
+            return std::unexpected(batchResult.error());
+        }
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
+
+std::expected<std::vector<ExamSlot>, Error> SqlExamScheduleDao::getAll() const {
+    auto queryResult = _dbAdapter->executeQuery("SELECT courseId, examDay, period FROM ExamSchedule ORDER BY examDay, period, courseId;");
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<ExamSlot> slots;
+    slots.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            slots.push_back(ExamSlot{std::any_cast<std::string>(row.at("courseId")),
+                                     static_cast<int>(std::any_cast<long long>(row.at("examDay"))),
+                                     static_cast<int>(std::any_cast<long long>(row.at("period")))});
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse exam slot: ") + e.what()});
+    }
+    return slots;
+}
@@ -0,0 +1,38 @@
+#ifndef SQLEXAMSCHEDULEDAO_H
+#define SQLEXAMSCHEDULEDAO_H
+
+/**
+ * @file SqlExamScheduleDao.h
+ * @brief SQL implementation of the exam schedule data access object
+ */
+
+#include "../interface/IExamScheduleDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlExamScheduleDao
+ * @brief SQL implementation of IExamScheduleDao over the ExamSchedule table
+ *
+ * replaceAll() deletes and re-inserts the schedule inside one transaction with a single prepared
+ * batch insert, so readers never see a half-written schedule.
+ */
+class SqlExamScheduleDao : public IExamScheduleDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlExamScheduleDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlExamScheduleDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlExamScheduleDao() override = default;
+
+    std::expected<bool, Error> replaceAll(const std::vector<ExamSlot>& slots) override;
+    std::expected<std::vector<ExamSlot>, Error> getAll() const override;
+};
+
+#endif // SQLEXAMSCHEDULEDAO_H
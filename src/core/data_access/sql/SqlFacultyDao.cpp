@@ -1,5 +1,10 @@
 #include "SqlFacultyDao.h"
 #include <vector>
+#include "SqlDaoUtils.h"
+
+namespace {
+    const std::string SELECT_ALL_SQL = "SELECT id, name FROM Faculties;";
+}
 
 SqlFacultyDao::SqlFacultyDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                              std::shared_ptr<IEntityParser<Faculty, DbQueryResultRow>> parser)
@@ -29,7 +34,7 @@ std::expected<Faculty, Error> SqlFacultyDao::getById(const std::string& id) cons
 }
 
 std::expected<std::vector<Faculty>, Error> SqlFacultyDao::getAll() const {
-    std::string sql = "SELECT id, name FROM Faculties;";
+    const std::string& sql = SELECT_ALL_SQL;
     auto queryResult = _dbAdapter->executeQuery(sql);
 
     if (!queryResult.has_value()) {
@@ -51,6 +56,10 @@ std::expected<std::vector<Faculty>, Error> SqlFacultyDao::getAll() const {
     return faculties;
 }
 
+std::expected<std::size_t, Error> SqlFacultyDao::forEach(const std::function<bool(const Faculty&)>& visitor) const {
+    return SqlDaoUtils::streamEntities<Faculty>(*_dbAdapter, SELECT_ALL_SQL, {}, *_parser, visitor, "faculties");
+}
+
 std::expected<Faculty, Error> SqlFacultyDao::add(const Faculty& faculty) {
     ValidationResult vr = faculty.validateBasic();
     if (!vr.isValid) {
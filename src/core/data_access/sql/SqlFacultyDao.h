@@ -49,6 +49,13 @@ public:
      * @return A vector of all faculties or an error on database failure
      */
     std::expected<std::vector<Faculty>, Error> getAll() const override;
+
+    /**
+     * @brief Streams every facultie through the visitor without materializing the table
+     * @param visitor Called for each row; return false to stop early
+     * @return Number of rows passed to the visitor or an error on database/parsing failure
+     */
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Faculty&)>& visitor) const override;
     
     /**
      * @brief Adds a new faculty to the database
@@ -1,6 +1,24 @@
 #include "SqlFeeRecordDao.h"
 #include <vector>
 #include <stdexcept> // For std::invalid_argument
+#include "SqlDaoUtils.h"
+
+namespace {
+    const std::string SELECT_ALL_SQL = "SELECT studentId, totalFee, paidFee FROM FeeRecords;";
+
+    std::expected<FeePayment, Error> parsePayment(const DbQueryResultRow& row) {
+        try {
+            FeePayment payment;
+            payment.idempotencyKey = std::any_cast<std::string>(row.at("idempotencyKey"));
+            payment.studentId = std::any_cast<std::string>(row.at("studentId"));
+            payment.amount = static_cast<long>(std::any_cast<long long>(row.at("amount")));
+            payment.paidAt = std::any_cast<long long>(row.at("paidAt"));
+            return payment;
+        } catch (const std::exception& e) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse fee payment: ") + e.what()});
+        }
+    }
+}
 
 SqlFeeRecordDao::SqlFeeRecordDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                                  std::shared_ptr<IEntityParser<FeeRecord, DbQueryResultRow>> parser)
@@ -14,10 +32,11 @@ SqlFeeRecordDao::SqlFeeRecordDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
 }
 
 std::expected<FeeRecord, Error> SqlFeeRecordDao::getById(const std::string& studentId) const {
-    std::string sql = "SELECT studentId, totalFee, paidFee FROM FeeRecords WHERE studentId = ?;";
     std::vector<DbQueryParam> params = {studentId};
 
-    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    auto queryResult = SqlDaoUtils::queryWithArchiveFallback(*_dbAdapter, [](const std::string& schema) {
+        return "SELECT studentId, totalFee, paidFee FROM " + schema + ".FeeRecords WHERE studentId = ?;";
+    }, params);
     if (!queryResult.has_value()) {
         return std::unexpected(queryResult.error());
     }
@@ -30,7 +49,7 @@ std::expected<FeeRecord, Error> SqlFeeRecordDao::getById(const std::string& stud
 }
 
 std::expected<std::vector<FeeRecord>, Error> SqlFeeRecordDao::getAll() const {
-    std::string sql = "SELECT studentId, totalFee, paidFee FROM FeeRecords;";
+    const std::string& sql = SELECT_ALL_SQL;
     auto queryResult = _dbAdapter->executeQuery(sql);
 
     if (!queryResult.has_value()) {
@@ -49,6 +68,10 @@ std::expected<std::vector<FeeRecord>, Error> SqlFeeRecordDao::getAll() const {
     return records;
 }
 
+std::expected<std::size_t, Error> SqlFeeRecordDao::forEach(const std::function<bool(const FeeRecord&)>& visitor) const {
+    return SqlDaoUtils::streamEntities<FeeRecord>(*_dbAdapter, SELECT_ALL_SQL, {}, *_parser, visitor, "fee records");
+}
+
 std::expected<FeeRecord, Error> SqlFeeRecordDao::add(const FeeRecord& feeRecord) {
     ValidationResult vr = feeRecord.validateBasic();
     if(!vr.isValid){
@@ -80,6 +103,86 @@ std::expected<FeeRecord, Error> SqlFeeRecordDao::add(const FeeRecord& feeRecord)
     return feeRecord;
 }
 
+std::expected<bool, Error> SqlFeeRecordDao::addBatch(const std::vector<FeeRecord>& feeRecords) {
+    if (feeRecords.empty()) return true;
+
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(feeRecords.size());
+    for (const auto& feeRecord : feeRecords) {
+        ValidationResult vr = feeRecord.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data for Student " + feeRecord.getStudentId() +
+                                                                     ": " + vr.getErrorMessagesCombined()});
+        }
+        auto paramsResult = _parser->toQueryInsertParams(feeRecord);
+        if (!paramsResult.has_value()) {
+            return std::unexpected(paramsResult.error());
+        }
+        paramSets.push_back(std::move(paramsResult.value()));
+    }
+
+    std::string sql = "INSERT INTO FeeRecords (studentId, totalFee, paidFee) VALUES (?, ?, ?);";
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto execResult = _dbAdapter->executeBatchUpdate(sql, paramSets);
+    if (!execResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(execResult.error());
+    }
+    if (execResult.value() != static_cast<long>(feeRecords.size())) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Failed to add fee records, expected " +
+                                     std::to_string(feeRecords.size()) + " rows but " + std::to_string(execResult.value()) + " were affected."});
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlFeeRecordDao::setTotalFees(const std::vector<FeeRecord>& feeRecords) {
+    if (feeRecords.empty()) return true;
+
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(feeRecords.size());
+    for (const auto& feeRecord : feeRecords) {
+        ValidationResult vr = feeRecord.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid FeeRecord data for Student " + feeRecord.getStudentId() +
+                                                                     ": " + vr.getErrorMessagesCombined()});
+        }
+        paramSets.push_back({feeRecord.getStudentId(), feeRecord.getTotalFee(), feeRecord.getPaidFee()});
+    }
+
+    // Nhánh UPDATE chỉ áp dụng khi tổng mới không nhỏ hơn số đã đóng; hàng bị bỏ qua không được đếm
+    std::string sql = "INSERT INTO FeeRecords (studentId, totalFee, paidFee) VALUES (?, ?, ?) "
+                      "ON CONFLICT(studentId) DO UPDATE SET totalFee = excluded.totalFee WHERE FeeRecords.paidFee <= excluded.totalFee;";
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto execResult = _dbAdapter->executeBatchUpdate(sql, paramSets);
+    if (!execResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(execResult.error());
+    }
+    if (execResult.value() != static_cast<long>(feeRecords.size())) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "New total fee is less than the amount already paid for " +
+                                     std::to_string(feeRecords.size() - execResult.value()) + " student(s); nothing was written."});
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
+
 std::expected<bool, Error> SqlFeeRecordDao::update(const FeeRecord& feeRecord) {
     ValidationResult vr = feeRecord.validateBasic();
     if(!vr.isValid){
@@ -126,4 +229,73 @@ std::expected<bool, Error> SqlFeeRecordDao::exists(const std::string& studentId)
         return std::unexpected(queryResult.error());
     }
     return !queryResult.value().empty();
-}
\ No newline at end of file
+}
+std::expected<bool, Error> SqlFeeRecordDao::recordPayment(const FeePayment& payment) {
+    if (payment.idempotencyKey.empty() || payment.amount <= 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Fee payment requires an idempotency key and a positive amount."});
+    }
+
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto fail = [this](Error error) -> std::expected<bool, Error> {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(std::move(error));
+    };
+
+    // Ghi sổ cái trước: khóa trùng thì không cộng tiền lần nữa
+    std::string insertSql = "INSERT INTO FeePayments (idempotencyKey, studentId, amount, paidAt) VALUES (?, ?, ?, ?) "
+                            "ON CONFLICT(idempotencyKey) DO NOTHING;";
+    auto inserted = _dbAdapter->executeUpdate(insertSql, {payment.idempotencyKey, payment.studentId, payment.amount, payment.paidAt});
+    if (!inserted.has_value()) return fail(inserted.error());
+    if (inserted.value() == 0) {
+        auto existing = _dbAdapter->executeQuery("SELECT idempotencyKey, studentId, amount, paidAt FROM FeePayments WHERE idempotencyKey = ?;",
+                                                 {payment.idempotencyKey});
+        if (!existing.has_value()) return fail(existing.error());
+        if (existing->empty()) return fail(Error{ErrorCode::OPERATION_FAILED, "Fee payment was neither recorded nor found in the ledger."});
+        auto recorded = parsePayment(existing->front());
+        if (!recorded.has_value()) return fail(recorded.error());
+        if (recorded->studentId != payment.studentId || recorded->amount != payment.amount) {
+            return fail(Error{ErrorCode::ALREADY_EXISTS, "Idempotency key '" + payment.idempotencyKey + "' was already used for a different payment."});
+        }
+        auto commitResult = _dbAdapter->commitTransaction();
+        if (!commitResult.has_value()) return fail(commitResult.error());
+        return false;
+    }
+
+    // Kiểm tra và cộng trong cùng một câu lệnh, không đọc-sửa-ghi cả bản ghi
+    std::string updateSql = "UPDATE FeeRecords SET paidFee = paidFee + ? WHERE studentId = ? AND paidFee + ? <= totalFee;";
+    auto updated = _dbAdapter->executeUpdate(updateSql, {payment.amount, payment.studentId, payment.amount});
+    if (!updated.has_value()) return fail(updated.error());
+    if (updated.value() == 0) {
+        auto recordExists = exists(payment.studentId);
+        if (!recordExists.has_value()) return fail(recordExists.error());
+        if (!recordExists.value()) {
+            return fail(Error{ErrorCode::NOT_FOUND, "FeeRecord for Student ID " + payment.studentId + " not found."});
+        }
+        return fail(Error{ErrorCode::VALIDATION_ERROR, "Payment amount exceeds due fee."});
+    }
+
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) return fail(commitResult.error());
+    return true;
+}
+
+std::expected<std::vector<FeePayment>, Error> SqlFeeRecordDao::getPayments(const std::string& studentId) const {
+    auto queryResult = SqlDaoUtils::queryWithArchiveFallback(*_dbAdapter, [](const std::string& schema) {
+        return "SELECT idempotencyKey, studentId, amount, paidAt FROM " + schema + ".FeePayments WHERE studentId = ? ORDER BY paidAt, idempotencyKey;";
+    }, {studentId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+
+    std::vector<FeePayment> payments;
+    payments.reserve(queryResult->size());
+    for (const auto& row : queryResult.value()) {
+        auto payment = parsePayment(row);
+        if (!payment.has_value()) return std::unexpected(payment.error());
+        payments.push_back(std::move(payment.value()));
+    }
+    return payments;
+}
@@ -49,6 +49,13 @@ public:
      * @return A vector of all fee records or an error on database failure
      */
     std::expected<std::vector<FeeRecord>, Error> getAll() const override;
+
+    /**
+     * @brief Streams every fee record through the visitor without materializing the table
+     * @param visitor Called for each row; return false to stop early
+     * @return Number of rows passed to the visitor or an error on database/parsing failure
+     */
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const FeeRecord&)>& visitor) const override;
     
     /**
      * @brief Adds a new fee record to the database
@@ -56,6 +63,20 @@ public:
      * @return The added fee record with any database-generated fields or an error on failure
      */
     std::expected<FeeRecord, Error> add(const FeeRecord& feeRecord) override;
+
+    /**
+     * @brief Adds several fee records in one transaction
+     * @param feeRecords The fee records to add
+     * @return True if every record was inserted, or an error (the transaction is rolled back)
+     */
+    std::expected<bool, Error> addBatch(const std::vector<FeeRecord>& feeRecords) override;
+
+    /**
+     * @brief Upserts the total fees in one transaction; the UPDATE branch never touches paidFee
+     * @param feeRecords The fee records carrying the new totals
+     * @return True if every row was written, or an error (the transaction is rolled back)
+     */
+    std::expected<bool, Error> setTotalFees(const std::vector<FeeRecord>& feeRecords) override;
     
     /**
      * @brief Updates an existing fee record in the database
@@ -77,6 +98,20 @@ public:
      * @return True if the fee record exists, false if not, or an error on database failure
      */
     std::expected<bool, Error> exists(const std::string& studentId) const override;
+
+    /**
+     * @brief Appends the payment to FeePayments and applies it with a conditional UPDATE, in one transaction
+     * @param payment The payment to record
+     * @return True if recorded, false if the idempotency key was already recorded, or an error
+     */
+    std::expected<bool, Error> recordPayment(const FeePayment& payment) override;
+
+    /**
+     * @brief Retrieves the ledger entries of a student, oldest first
+     * @param studentId The ID of the student
+     * @return The payments (possibly empty) or an error on database failure
+     */
+    std::expected<std::vector<FeePayment>, Error> getPayments(const std::string& studentId) const override;
 };
 
 #endif // SQLFEERECORDDAO_H
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "SqlFinanceReportDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string FEES_BY_FACULTY_AND_COHORT_SQL = R"SQL(
+        SELECT COALESCE(S.facultyId, '') AS facultyId,
+               CASE WHEN substr(F.studentId, 1, 2) GLOB '[0-9][0-9]' THEN substr(F.studentId, 1, 2) ELSE '' END AS cohort,
+               COUNT(*) AS studentCount,
+               SUM(F.totalFee) AS totalBilled,
+               SUM(F.paidFee) AS totalPaid
+        FROM FeeRecords F
+        LEFT JOIN Students S ON S.userId = F.studentId
+        GROUP BY 1, 2
+        ORDER BY 1, 2;
+    )SQL";
+
+    const std::string PAYROLL_BY_FACULTY_SQL = R"SQL(
+        SELECT COALESCE(T.facultyId, '') AS facultyId,
+               COUNT(*) AS teacherCount,
+               SUM(R.basicMonthlyPay) AS totalMonthlyPay
+        FROM SalaryRecords R
+        LEFT JOIN Teachers T ON T.userId = R.teacherId
+        GROUP BY 1
+        ORDER BY 1;
+    )SQL";
+}
+
+SqlFinanceReportDao::SqlFinanceReportDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlFinanceReportDao.");
+    }
+}
+
+std::expected<std::vector<FacultyFeeSummary>, Error> SqlFinanceReportDao::sumFeesByFacultyAndCohort() const {
+    auto queryResult = _dbAdapter->executeQuery(FEES_BY_FACULTY_AND_COHORT_SQL);
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+
+    std::vector<FacultyFeeSummary> summaries;
+    summaries.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            FacultyFeeSummary summary;
+            summary.facultyId = std::any_cast<std::string>(row.at("facultyId"));
+            summary.cohort = std::any_cast<std::string>(row.at("cohort"));
+            summary.studentCount = static_cast<std::size_t>(std::any_cast<long long>(row.at("studentCount")));
+            summary.totalBilled = std::any_cast<long long>(row.at("totalBilled"));
+            summary.totalPaid = std::any_cast<long long>(row.at("totalPaid"));
+            summaries.push_back(std::move(summary));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse fee totals: ") + e.what()});
+    }
+    return summaries;
+}
+
+std::expected<std::vector<FacultyPayrollSummary>, Error> SqlFinanceReportDao::sumPayrollByFaculty() const {
+    auto queryResult = _dbAdapter->executeQuery(PAYROLL_BY_FACULTY_SQL);
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+
+    std::vector<FacultyPayrollSummary> summaries;
+    summaries.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            FacultyPayrollSummary summary;
+            summary.facultyId = std::any_cast<std::string>(row.at("facultyId"));
+            summary.teacherCount = static_cast<std::size_t>(std::any_cast<long long>(row.at("teacherCount")));
+            summary.totalMonthlyPay = std::any_cast<long long>(row.at("totalMonthlyPay"));
+            summaries.push_back(std::move(summary));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse payroll totals: ") + e.what()});
+    }
+    return summaries;
+}
@@ -0,0 +1,42 @@
+#ifndef SQLFINANCEREPORTDAO_H
+#define SQLFINANCEREPORTDAO_H
+
+/**
+ * @file SqlFinanceReportDao.h
+ * @brief SQL implementation of the finance aggregate data access object
+ */
+
+#include "../interface/IFinanceReportDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlFinanceReportDao
+ * @brief Computes faculty-level fee and payroll totals with one GROUP BY join per report
+ */
+class SqlFinanceReportDao : public IFinanceReportDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlFinanceReportDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlFinanceReportDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlFinanceReportDao() override = default;
+
+    /**
+     * @brief Joins FeeRecords with Students and groups by faculty and the two-digit year prefix of the student ID
+     */
+    std::expected<std::vector<FacultyFeeSummary>, Error> sumFeesByFacultyAndCohort() const override;
+
+    /**
+     * @brief Joins SalaryRecords with Teachers and groups by faculty
+     */
+    std::expected<std::vector<FacultyPayrollSummary>, Error> sumPayrollByFaculty() const override;
+};
+
+#endif // SQLFINANCEREPORTDAO_H
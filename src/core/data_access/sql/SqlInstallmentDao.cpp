@@ -0,0 +1,137 @@
+#include "SqlInstallmentDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string SELECT_COLUMNS = "SELECT studentId, sequence, dueDate, amount, paidAmount, isLate FROM FeeInstallments ";
+
+    const std::string ALLOCATE_SQL = R"SQL(
+        UPDATE FeeInstallments
+        SET paidAmount = MIN(amount, MAX(0, ? - (
+            SELECT COALESCE(SUM(P.amount), 0) FROM FeeInstallments P
+            WHERE P.studentId = FeeInstallments.studentId
+              AND (P.dueDate < FeeInstallments.dueDate
+                   OR (P.dueDate = FeeInstallments.dueDate AND P.sequence < FeeInstallments.sequence)))))
+        WHERE studentId = ?;
+    )SQL";
+
+    std::expected<std::vector<FeeInstallment>, Error> parseInstallments(const DbQueryResultTable& rows) {
+        std::vector<FeeInstallment> installments;
+        installments.reserve(rows.size());
+        try {
+            for (const auto& row : rows) {
+                FeeInstallment installment;
+                installment.studentId = std::any_cast<std::string>(row.at("studentId"));
+                installment.sequence = static_cast<int>(std::any_cast<long long>(row.at("sequence")));
+                installment.dueDate = std::any_cast<std::string>(row.at("dueDate"));
+                installment.amount = static_cast<long>(std::any_cast<long long>(row.at("amount")));
+                installment.paidAmount = static_cast<long>(std::any_cast<long long>(row.at("paidAmount")));
+                installment.late = std::any_cast<long long>(row.at("isLate")) != 0;
+                installments.push_back(std::move(installment));
+            }
+        } catch (const std::exception& e) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse fee installment: ") + e.what()});
+        }
+        return installments;
+    }
+}
+
+SqlInstallmentDao::SqlInstallmentDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlInstallmentDao.");
+    }
+}
+
+std::expected<std::vector<FeeInstallment>, Error> SqlInstallmentDao::getByStudent(const std::string& studentId) const {
+    auto queryResult = _dbAdapter->executeQuery(SELECT_COLUMNS + "WHERE studentId = ? ORDER BY dueDate, sequence;", {studentId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return parseInstallments(queryResult.value());
+}
+
+std::expected<bool, Error> SqlInstallmentDao::replaceSchedule(const std::string& studentId, const std::vector<FeeInstallment>& installments) {
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(installments.size());
+    for (const auto& installment : installments) {
+        if (installment.studentId != studentId || installment.amount <= 0 ||
+            installment.paidAmount < 0 || installment.paidAmount > installment.amount) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid installment " + std::to_string(installment.sequence) +
+                                                                     " for student " + studentId + "."});
+        }
+        paramSets.push_back({studentId, installment.sequence, installment.dueDate, installment.amount,
+                             installment.paidAmount, installment.late});
+    }
+
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto fail = [this](Error error) -> std::expected<bool, Error> {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(std::move(error));
+    };
+
+    auto deleted = _dbAdapter->executeUpdate("DELETE FROM FeeInstallments WHERE studentId = ?;", {studentId});
+    if (!deleted.has_value()) return fail(deleted.error());
+    auto inserted = _dbAdapter->executeBatchUpdate(
+        "INSERT INTO FeeInstallments (studentId, sequence, dueDate, amount, paidAmount, isLate) VALUES (?, ?, ?, ?, ?, ?);", paramSets);
+    if (!inserted.has_value()) return fail(inserted.error());
+
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) return fail(commitResult.error());
+    return true;
+}
+
+std::expected<bool, Error> SqlInstallmentDao::allocatePaid(const std::string& studentId, long paidTotal) {
+    auto result = _dbAdapter->executeUpdate(ALLOCATE_SQL, {paidTotal, studentId});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    return true;
+}
+
+std::expected<std::size_t, Error> SqlInstallmentDao::markLate(const std::string& asOfDate) {
+    auto result = _dbAdapter->executeUpdate(
+        "UPDATE FeeInstallments SET isLate = 1 WHERE paidAmount < amount AND dueDate < ? AND isLate = 0;", {asOfDate});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    return static_cast<std::size_t>(result.value());
+}
+
+std::expected<std::vector<OverdueBalance>, Error> SqlInstallmentDao::sumOverdue(const std::string& asOfDate) const {
+    std::string sql = "SELECT studentId, COUNT(*) AS installmentCount, SUM(amount - paidAmount) AS overdueAmount, "
+                      "MIN(dueDate) AS oldestDueDate FROM FeeInstallments "
+                      "WHERE paidAmount < amount AND dueDate < ? GROUP BY studentId ORDER BY studentId;";
+    auto queryResult = _dbAdapter->executeQuery(sql, {asOfDate});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+
+    std::vector<OverdueBalance> balances;
+    balances.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            OverdueBalance balance;
+            balance.studentId = std::any_cast<std::string>(row.at("studentId"));
+            balance.installmentCount = static_cast<std::size_t>(std::any_cast<long long>(row.at("installmentCount")));
+            balance.overdueAmount = std::any_cast<long long>(row.at("overdueAmount"));
+            balance.oldestDueDate = std::any_cast<std::string>(row.at("oldestDueDate"));
+            balances.push_back(std::move(balance));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse overdue balances: ") + e.what()});
+    }
+    return balances;
+}
+
+std::expected<std::vector<FeeInstallment>, Error> SqlInstallmentDao::getOpenDueBetween(const std::string& fromDate, const std::string& toDate) const {
+    auto queryResult = _dbAdapter->executeQuery(
+        SELECT_COLUMNS + "WHERE paidAmount < amount AND dueDate BETWEEN ? AND ? ORDER BY dueDate, studentId, sequence;",
+        {fromDate, toDate});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return parseInstallments(queryResult.value());
+}
@@ -0,0 +1,51 @@
+#ifndef SQLINSTALLMENTDAO_H
+#define SQLINSTALLMENTDAO_H
+
+/**
+ * @file SqlInstallmentDao.h
+ * @brief SQL implementation of the fee installment schedule data access object
+ */
+
+#include "../interface/IInstallmentDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlInstallmentDao
+ * @brief SQL implementation of IInstallmentDao over the FeeInstallments table
+ *
+ * Overdue and due-date queries repeat the predicate "paidAmount < amount" of the partial index
+ * idx_FeeInstallments_open (dueDate, studentId), so each is a single range scan over open installments.
+ */
+class SqlInstallmentDao : public IInstallmentDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlInstallmentDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlInstallmentDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlInstallmentDao() override = default;
+
+    std::expected<std::vector<FeeInstallment>, Error> getByStudent(const std::string& studentId) const override;
+
+    /**
+     * @brief Deletes and re-inserts the student's rows inside one transaction
+     */
+    std::expected<bool, Error> replaceSchedule(const std::string& studentId, const std::vector<FeeInstallment>& installments) override;
+
+    /**
+     * @brief Allocates with one UPDATE; each row subtracts the amounts of the installments due before it
+     */
+    std::expected<bool, Error> allocatePaid(const std::string& studentId, long paidTotal) override;
+
+    std::expected<std::size_t, Error> markLate(const std::string& asOfDate) override;
+    std::expected<std::vector<OverdueBalance>, Error> sumOverdue(const std::string& asOfDate) const override;
+    std::expected<std::vector<FeeInstallment>, Error> getOpenDueBetween(const std::string& fromDate, const std::string& toDate) const override;
+};
+
+#endif // SQLINSTALLMENTDAO_H
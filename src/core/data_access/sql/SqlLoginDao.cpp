@@ -58,6 +58,42 @@ std::expected<bool, Error> SqlLoginDao::addUserCredentials(const std::string& us
     return true;
 }
 
+std::expected<bool, Error> SqlLoginDao::addUserCredentialsBatch(const std::vector<LoginCredentials>& credentials) {
+    if (credentials.empty()) return true;
+
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(credentials.size());
+    for (const auto& creds : credentials) {
+        auto paramsResult = _parser->toQueryInsertParams(creds);
+        if (!paramsResult.has_value()) {
+            return std::unexpected(paramsResult.error());
+        }
+        paramSets.push_back(std::move(paramsResult.value()));
+    }
+
+    std::string sql = "INSERT INTO Logins (userId, passwordHash, salt) VALUES (?, ?, ?);";
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto execResult = _dbAdapter->executeBatchUpdate(sql, paramSets);
+    if (!execResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(execResult.error());
+    }
+    if (execResult.value() != static_cast<long>(credentials.size())) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Failed to add user credentials, expected " +
+                                     std::to_string(credentials.size()) + " rows but " + std::to_string(execResult.value()) + " were affected."});
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
+
 std::expected<bool, Error> SqlLoginDao::updatePassword(const std::string& userId, const std::string& newPasswordHash, const std::string& newSalt) {
     std::string sql = "UPDATE Logins SET passwordHash = ?, salt = ? WHERE userId = ?;";
     LoginCredentials creds = {userId, newPasswordHash, newSalt, UserRole::UNKNOWN, LoginStatus::DISABLED};
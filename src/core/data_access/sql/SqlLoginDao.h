@@ -56,6 +56,13 @@ public:
      * @return True if adding succeeded, or an error on failure
      */
     std::expected<bool, Error> addUserCredentials(const std::string& userId, const std::string& passwordHash, const std::string& salt, UserRole role, LoginStatus status) override;
+
+    /**
+     * @brief Adds credentials for several users in one transaction
+     * @param credentials The credentials to add; role and status live in Users and are ignored here
+     * @return True if every row was inserted, or an error (the transaction is rolled back)
+     */
+    std::expected<bool, Error> addUserCredentialsBatch(const std::vector<LoginCredentials>& credentials) override;
     
     /**
      * @brief Updates a user's password
@@ -0,0 +1,107 @@
+#include "SqlPayrollDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string SELECT_COLUMNS = "SELECT teacherId, period, basicPay, allowance FROM SalaryPayments ";
+
+    std::expected<std::vector<SalaryPayment>, Error> parsePayments(const DbQueryResultTable& rows) {
+        std::vector<SalaryPayment> payments;
+        payments.reserve(rows.size());
+        try {
+            for (const auto& row : rows) {
+                SalaryPayment payment;
+                payment.teacherId = std::any_cast<std::string>(row.at("teacherId"));
+                payment.period = std::any_cast<std::string>(row.at("period"));
+                payment.basicPay = static_cast<long>(std::any_cast<long long>(row.at("basicPay")));
+                payment.allowance = static_cast<long>(std::any_cast<long long>(row.at("allowance")));
+                payments.push_back(std::move(payment));
+            }
+        } catch (const std::exception& e) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse salary payment: ") + e.what()});
+        }
+        return payments;
+    }
+}
+
+SqlPayrollDao::SqlPayrollDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlPayrollDao.");
+    }
+}
+
+std::expected<std::vector<SalaryPayment>, Error> SqlPayrollDao::getByPeriod(const std::string& period) const {
+    auto queryResult = _dbAdapter->executeQuery(SELECT_COLUMNS + "WHERE period = ? ORDER BY teacherId;", {period});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return parsePayments(queryResult.value());
+}
+
+std::expected<std::vector<SalaryPayment>, Error> SqlPayrollDao::getByTeacher(const std::string& teacherId) const {
+    auto queryResult = _dbAdapter->executeQuery(SELECT_COLUMNS + "WHERE teacherId = ? ORDER BY period;", {teacherId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return parsePayments(queryResult.value());
+}
+
+std::expected<bool, Error> SqlPayrollDao::upsertBatch(const std::vector<SalaryPayment>& payments) {
+    if (payments.empty()) return true;
+
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(payments.size());
+    for (const auto& payment : payments) {
+        if (payment.teacherId.empty() || payment.period.size() != 7 || payment.basicPay < 0 || payment.allowance < 0) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid salary payment for teacher '" + payment.teacherId + "'."});
+        }
+        paramSets.push_back({payment.teacherId, payment.period, payment.basicPay, payment.allowance});
+    }
+
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    std::string sql = "INSERT INTO SalaryPayments (teacherId, period, basicPay, allowance) VALUES (?, ?, ?, ?) "
+                      "ON CONFLICT(period, teacherId) DO UPDATE SET basicPay = excluded.basicPay, allowance = excluded.allowance;";
+    auto batchResult = _dbAdapter->executeBatchUpdate(sql, paramSets);
+    if (!batchResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(batchResult.error());
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
+
+std::expected<std::vector<PayrollYearToDate>, Error> SqlPayrollDao::sumYearToDate(int year, int throughMonth) const {
+    if (throughMonth < 1 || throughMonth > 12) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Month must be between 1 and 12."});
+    }
+    // Range on the leading primary-key column, so only the requested months are scanned
+    std::string sql = "SELECT teacherId, COUNT(*) AS months, SUM(basicPay) AS totalBasic, SUM(allowance) AS totalAllowance "
+                      "FROM SalaryPayments WHERE period BETWEEN ? AND ? GROUP BY teacherId ORDER BY teacherId;";
+    auto queryResult = _dbAdapter->executeQuery(sql, {payrollPeriod(year, 1), payrollPeriod(year, throughMonth)});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+
+    std::vector<PayrollYearToDate> totals;
+    totals.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            PayrollYearToDate total;
+            total.teacherId = std::any_cast<std::string>(row.at("teacherId"));
+            total.months = static_cast<std::size_t>(std::any_cast<long long>(row.at("months")));
+            total.totalBasic = std::any_cast<long long>(row.at("totalBasic"));
+            total.totalAllowance = std::any_cast<long long>(row.at("totalAllowance"));
+            totals.push_back(std::move(total));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse year-to-date payroll: ") + e.what()});
+    }
+    return totals;
+}
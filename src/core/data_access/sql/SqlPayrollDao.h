@@ -0,0 +1,48 @@
+#ifndef SQLPAYROLLDAO_H
+#define SQLPAYROLLDAO_H
+
+/**
+ * @file SqlPayrollDao.h
+ * @brief SQL implementation of the monthly payroll history data access object
+ */
+
+#include "../interface/IPayrollDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlPayrollDao
+ * @brief SQL implementation of IPayrollDao over the SalaryPayments table
+ *
+ * The primary key (period, teacherId) serves period lookups and year-to-date range scans;
+ * the (teacherId, period) index serves per-teacher history.
+ */
+class SqlPayrollDao : public IPayrollDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlPayrollDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlPayrollDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlPayrollDao() override = default;
+
+    std::expected<std::vector<SalaryPayment>, Error> getByPeriod(const std::string& period) const override;
+    std::expected<std::vector<SalaryPayment>, Error> getByTeacher(const std::string& teacherId) const override;
+
+    /**
+     * @brief Upserts every payment with one prepared statement inside a single transaction
+     */
+    std::expected<bool, Error> upsertBatch(const std::vector<SalaryPayment>& payments) override;
+
+    /**
+     * @brief Groups the payments of periods "YYYY-01" through "YYYY-MM" by teacher
+     */
+    std::expected<std::vector<PayrollYearToDate>, Error> sumYearToDate(int year, int throughMonth) const override;
+};
+
+#endif // SQLPAYROLLDAO_H
@@ -0,0 +1,57 @@
+#include "SqlPrerequisiteDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+SqlPrerequisiteDao::SqlPrerequisiteDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlPrerequisiteDao.");
+    }
+}
+
+std::expected<bool, Error> SqlPrerequisiteDao::add(const CoursePrerequisite& prerequisite) {
+    if (prerequisite.courseId == prerequisite.prerequisiteId) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Course " + prerequisite.courseId + " cannot be its own prerequisite."});
+    }
+    auto result = _dbAdapter->executeUpdate(
+        "INSERT INTO CoursePrerequisites (courseId, prerequisiteId) VALUES (?, ?);",
+        {prerequisite.courseId, prerequisite.prerequisiteId});
+    if (!result.has_value()) {
+        if (result.error().code == ErrorCode::ALREADY_EXISTS) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Course " + prerequisite.prerequisiteId + " is already a prerequisite of course " + prerequisite.courseId + "."});
+        }
+        if (result.error().code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course " + prerequisite.courseId + " or " + prerequisite.prerequisiteId + " not found."});
+        }
+        return std::unexpected(result.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlPrerequisiteDao::remove(const std::string& courseId, const std::string& prerequisiteId) {
+    auto result = _dbAdapter->executeUpdate("DELETE FROM CoursePrerequisites WHERE courseId = ? AND prerequisiteId = ?;", {courseId, prerequisiteId});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    if (result.value() == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course " + prerequisiteId + " is not a prerequisite of course " + courseId + "."});
+    }
+    return true;
+}
+
+std::expected<std::vector<CoursePrerequisite>, Error> SqlPrerequisiteDao::getAll() const {
+    auto queryResult = _dbAdapter->executeQuery("SELECT courseId, prerequisiteId FROM CoursePrerequisites ORDER BY courseId, prerequisiteId;");
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<CoursePrerequisite> prerequisites;
+    prerequisites.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            prerequisites.push_back(CoursePrerequisite{std::any_cast<std::string>(row.at("courseId")),
+                                                       std::any_cast<std::string>(row.at("prerequisiteId"))});
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse course prerequisite: ") + e.what()});
+    }
+    return prerequisites;
+}
@@ -0,0 +1,39 @@
+#ifndef SQLPREREQUISITEDAO_H
+#define SQLPREREQUISITEDAO_H
+
+/**
+ * @file SqlPrerequisiteDao.h
+ * @brief SQL implementation of the course prerequisite data access object
+ */
+
+#include "../interface/IPrerequisiteDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlPrerequisiteDao
+ * @brief SQL implementation of IPrerequisiteDao over the CoursePrerequisites table
+ *
+ * The primary key (courseId, prerequisiteId) returns the whole edge list in order; rows are
+ * removed together with either course by ON DELETE CASCADE.
+ */
+class SqlPrerequisiteDao : public IPrerequisiteDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlPrerequisiteDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlPrerequisiteDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlPrerequisiteDao() override = default;
+
+    std::expected<bool, Error> add(const CoursePrerequisite& prerequisite) override;
+    std::expected<bool, Error> remove(const std::string& courseId, const std::string& prerequisiteId) override;
+    std::expected<std::vector<CoursePrerequisite>, Error> getAll() const override;
+};
+
+#endif // SQLPREREQUISITEDAO_H
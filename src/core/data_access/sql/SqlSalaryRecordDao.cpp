@@ -1,6 +1,11 @@
 #include "SqlSalaryRecordDao.h"
 #include <vector>
 #include <stdexcept> // For std::invalid_argument
+#include "SqlDaoUtils.h"
+
+namespace {
+    const std::string SELECT_ALL_SQL = "SELECT teacherId, basicMonthlyPay FROM SalaryRecords;";
+}
 
 SqlSalaryRecordDao::SqlSalaryRecordDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                                      std::shared_ptr<IEntityParser<SalaryRecord, DbQueryResultRow>> parser)
@@ -30,7 +35,7 @@ std::expected<SalaryRecord, Error> SqlSalaryRecordDao::getById(const std::string
 }
 
 std::expected<std::vector<SalaryRecord>, Error> SqlSalaryRecordDao::getAll() const {
-    std::string sql = "SELECT teacherId, basicMonthlyPay FROM SalaryRecords;";
+    const std::string& sql = SELECT_ALL_SQL;
     auto queryResult = _dbAdapter->executeQuery(sql);
 
     if (!queryResult.has_value()) {
@@ -49,6 +54,10 @@ std::expected<std::vector<SalaryRecord>, Error> SqlSalaryRecordDao::getAll() con
     return records;
 }
 
+std::expected<std::size_t, Error> SqlSalaryRecordDao::forEach(const std::function<bool(const SalaryRecord&)>& visitor) const {
+    return SqlDaoUtils::streamEntities<SalaryRecord>(*_dbAdapter, SELECT_ALL_SQL, {}, *_parser, visitor, "salary records");
+}
+
 std::expected<SalaryRecord, Error> SqlSalaryRecordDao::add(const SalaryRecord& salaryRecord) {
     ValidationResult vr = salaryRecord.validateBasic();
     if(!vr.isValid){
@@ -50,6 +50,13 @@ public:
      * @return Danh sách các đối tượng SalaryRecord nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<std::vector<SalaryRecord>, Error> getAll() const override;
+
+    /**
+     * @brief Duyệt tất cả bản ghi lương theo luồng, không gom toàn bộ bảng vào bộ nhớ
+     * @param visitor Hàm xử lý từng bản ghi lương; trả về false để dừng duyệt
+     * @return Số bản ghi lương đã chuyển cho visitor, hoặc Error nếu truy vấn/phân tích thất bại
+     */
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const SalaryRecord&)>& visitor) const override;
     
     /**
      * @brief Thêm bản ghi lương mới
@@ -0,0 +1,53 @@
+#include "SqlSequenceDao.h"
+#include <vector>
+#include <stdexcept> // For std::invalid_argument
+
+SqlSequenceDao::SqlSequenceDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlSequenceDao.");
+    }
+}
+
+std::expected<long long, Error> SqlSequenceDao::getValue(const std::string& name) const {
+    auto queryResult = _dbAdapter->executeQuery("SELECT value FROM Sequences WHERE name = ?;", {name});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    if (queryResult.value().empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Sequence '" + name + "' not found."});
+    }
+    return std::any_cast<long long>(queryResult.value()[0].at("value"));
+}
+
+std::expected<long long, Error> SqlSequenceDao::advance(const std::string& name, long long count) {
+    // Đọc và ghi trong cùng một câu lệnh: hai lần cấp phát đồng thời không thể nhận cùng giá trị
+    std::vector<DbQueryParam> params = {count, name};
+    auto queryResult = _dbAdapter->executeQuery("UPDATE Sequences SET value = value + ? WHERE name = ? RETURNING value;", params);
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    if (queryResult.value().empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Sequence '" + name + "' not found."});
+    }
+    return std::any_cast<long long>(queryResult.value()[0].at("value"));
+}
+
+std::expected<bool, Error> SqlSequenceDao::raiseTo(const std::string& name, long long value) {
+    std::vector<DbQueryParam> params = {name, value};
+    auto updateResult = _dbAdapter->executeUpdate(
+        "INSERT INTO Sequences (name, value) VALUES (?, ?) "
+        "ON CONFLICT(name) DO UPDATE SET value = MAX(value, excluded.value);", params);
+    if (!updateResult.has_value()) {
+        return std::unexpected(updateResult.error());
+    }
+    return true;
+}
+
+std::expected<std::size_t, Error> SqlSequenceDao::count() const {
+    auto queryResult = _dbAdapter->executeQuery("SELECT COUNT(*) AS total FROM Sequences;");
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return static_cast<std::size_t>(std::any_cast<long long>(queryResult.value()[0].at("total")));
+}
@@ -0,0 +1,67 @@
+#ifndef SQLSEQUENCEDAO_H
+#define SQLSEQUENCEDAO_H
+
+/**
+ * @file SqlSequenceDao.h
+ * @brief SQL implementation of the sequence counter data access object
+ */
+
+#include "../interface/ISequenceDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlSequenceDao
+ * @brief SQL implementation of ISequenceDao on top of the Sequences table
+ *
+ * Every mutation is a single statement (UPDATE ... RETURNING, INSERT ... ON CONFLICT),
+ * so it is atomic without an explicit transaction.
+ */
+class SqlSequenceDao : public ISequenceDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlSequenceDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlSequenceDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    /**
+     * @brief Virtual destructor
+     */
+    ~SqlSequenceDao() override = default;
+
+    /**
+     * @brief Reads the current value of a sequence
+     * @param name Sequence name
+     * @return The last allocated value, or NOT_FOUND if the sequence does not exist
+     */
+    std::expected<long long, Error> getValue(const std::string& name) const override;
+
+    /**
+     * @brief Atomically adds count to a sequence
+     * @param name Sequence name
+     * @param count Amount to add
+     * @return The new value, or NOT_FOUND if the sequence does not exist
+     */
+    std::expected<long long, Error> advance(const std::string& name, long long count) override;
+
+    /**
+     * @brief Creates a sequence or raises it to at least value
+     * @param name Sequence name
+     * @param value Minimum value
+     * @return True on success, or an error on database failure
+     */
+    std::expected<bool, Error> raiseTo(const std::string& name, long long value) override;
+
+    /**
+     * @brief Counts the stored sequences
+     * @return Number of rows in Sequences, or an error on database failure
+     */
+    std::expected<std::size_t, Error> count() const override;
+};
+
+#endif // SQLSEQUENCEDAO_H
@@ -0,0 +1,253 @@
+#include "SqlShardRouter.h"
+#include "../../database_adapter/sql/SQLiteAdapter.h"
+#include "../../parsing/impl_sql_parser/SqlParserUtils.h"
+#include "../../../utils/Logger.h"
+#include <algorithm>
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string SOURCE_SCHEMA = "shard_source";
+    const std::string DIRECTORY_SCHEMA = "shard_directory";
+
+    // Bảng theo sinh viên nằm trong shard, theo thứ tự chép khi chuyển shard (đăng ký trước kết quả)
+    struct ShardedTable {
+        const char* name;
+        const char* columns;
+    };
+    const ShardedTable SHARDED_TABLES[] = {
+        {"Enrollments", "studentId, courseId, enrollmentDate, termId"},
+        {"CourseResults", "studentId, courseId, marks, grade, termId"},
+        {"FeeRecords", "studentId, totalFee, paidFee"},
+        {"FeePayments", "idempotencyKey, studentId, amount, paidAt"},
+    };
+}
+
+SqlShardRouter::SqlShardRouter(std::shared_ptr<IDatabaseAdapter> mainAdapter, std::string mainDatabasePath, std::filesystem::path shardDirectory)
+    : _mainAdapter(std::move(mainAdapter)), _mainDatabasePath(std::move(mainDatabasePath)), _shardDirectory(std::move(shardDirectory)) {
+    if (!_mainAdapter) {
+        throw std::invalid_argument("Main database adapter cannot be null for SqlShardRouter.");
+    }
+    if (_shardDirectory.empty()) {
+        throw std::invalid_argument("Shard directory cannot be empty for SqlShardRouter.");
+    }
+}
+
+IDatabaseAdapter& SqlShardRouter::mainAdapter() const {
+    return *_mainAdapter;
+}
+
+std::filesystem::path SqlShardRouter::shardPath(const std::string& shardKey) const {
+    return _shardDirectory / (shardKey.empty() ? std::string("unassigned.db") : "faculty_" + shardKey + ".db");
+}
+
+std::expected<std::shared_ptr<IDatabaseAdapter>, Error> SqlShardRouter::shardFor(const std::string& shardKey) {
+    std::lock_guard<std::mutex> lock(_shardsMutex);
+    auto it = _shards.find(shardKey);
+    if (it != _shards.end()) return it->second;
+
+    std::error_code ec;
+    std::filesystem::create_directories(_shardDirectory, ec);
+    if (ec) {
+        return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, "Cannot create shard directory " + _shardDirectory.string() + ": " + ec.message()});
+    }
+    auto shard = std::make_shared<SQLiteAdapter>();
+    auto connected = shard->connect(shardPath(shardKey).string());
+    if (!connected.has_value()) return std::unexpected(connected.error());
+    auto schema = shard->ensureShardTablesExist();
+    if (!schema.has_value()) return std::unexpected(schema.error());
+
+    LOG_INFO("SqlShardRouter: Opened shard '" + shardKey + "' at " + shardPath(shardKey).string());
+    _shards.emplace(shardKey, shard);
+    return shard;
+}
+
+std::expected<std::string, Error> SqlShardRouter::shardKeyOfStudent(const std::string& studentId) {
+    const std::string lookupSql = "SELECT shardKey FROM StudentShards WHERE studentId = ?;";
+    auto assigned = _mainAdapter->executeQuery(lookupSql, {studentId});
+    if (!assigned.has_value()) return std::unexpected(assigned.error());
+    if (!assigned->empty()) return SqlParserUtils::getOptional<std::string>(assigned->front(), "shardKey");
+
+    // Lần đầu định tuyến: gán shard theo khoa hiện tại; OR IGNORE giữ kết quả của luồng gán trước
+    auto student = _mainAdapter->executeQuery("SELECT facultyId FROM Students WHERE userId = ?;", {studentId});
+    if (!student.has_value()) return std::unexpected(student.error());
+    if (student->empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " not found."});
+    }
+    const std::string facultyId = SqlParserUtils::getOptional<std::string>(student->front(), "facultyId");
+    auto inserted = _mainAdapter->executeUpdate("INSERT OR IGNORE INTO StudentShards (studentId, shardKey) VALUES (?, ?);", {studentId, facultyId});
+    if (!inserted.has_value()) return std::unexpected(inserted.error());
+
+    assigned = _mainAdapter->executeQuery(lookupSql, {studentId});
+    if (!assigned.has_value()) return std::unexpected(assigned.error());
+    if (assigned->empty()) return facultyId;
+    return SqlParserUtils::getOptional<std::string>(assigned->front(), "shardKey");
+}
+
+std::expected<std::shared_ptr<IDatabaseAdapter>, Error> SqlShardRouter::shardForStudent(const std::string& studentId) {
+    auto shardKey = shardKeyOfStudent(studentId);
+    if (!shardKey.has_value()) return std::unexpected(shardKey.error());
+    return shardFor(shardKey.value());
+}
+
+std::expected<std::vector<std::shared_ptr<IDatabaseAdapter>>, Error> SqlShardRouter::allShards() {
+    auto keysResult = _mainAdapter->executeQuery("SELECT DISTINCT shardKey FROM StudentShards;");
+    if (!keysResult.has_value()) return std::unexpected(keysResult.error());
+
+    std::vector<std::string> shardKeys;
+    {
+        std::lock_guard<std::mutex> lock(_shardsMutex);
+        for (const auto& [shardKey, shard] : _shards) shardKeys.push_back(shardKey);
+    }
+    for (const auto& row : keysResult.value()) {
+        std::string shardKey = SqlParserUtils::getOptional<std::string>(row, "shardKey");
+        if (std::find(shardKeys.begin(), shardKeys.end(), shardKey) == shardKeys.end()) shardKeys.push_back(std::move(shardKey));
+    }
+
+    std::vector<std::shared_ptr<IDatabaseAdapter>> shards;
+    shards.reserve(shardKeys.size());
+    for (const auto& shardKey : shardKeys) {
+        auto shard = shardFor(shardKey);
+        if (!shard.has_value()) return std::unexpected(shard.error());
+        shards.push_back(shard.value());
+    }
+    return shards;
+}
+
+std::expected<bool, Error> SqlShardRouter::moveStudent(const std::string& studentId, const std::string& newShardKey) {
+    auto oldShardKey = shardKeyOfStudent(studentId);
+    if (!oldShardKey.has_value()) return std::unexpected(oldShardKey.error());
+    if (oldShardKey.value() == newShardKey) return true;
+    // Mở cả hai shard trước để file nguồn có bảng và đích đã sẵn sàng
+    auto source = shardFor(oldShardKey.value());
+    if (!source.has_value()) return std::unexpected(source.error());
+    auto target = shardFor(newShardKey);
+    if (!target.has_value()) return std::unexpected(target.error());
+    IDatabaseAdapter& shard = *target.value();
+
+    auto attachedSource = shard.executeUpdate("ATTACH DATABASE ? AS " + SOURCE_SCHEMA + ";", {shardPath(oldShardKey.value()).string()});
+    if (!attachedSource.has_value()) return std::unexpected(attachedSource.error());
+    auto attachedDirectory = shard.executeUpdate("ATTACH DATABASE ? AS " + DIRECTORY_SCHEMA + ";", {_mainDatabasePath});
+    if (!attachedDirectory.has_value()) {
+        shard.executeUpdate("DETACH DATABASE " + SOURCE_SCHEMA + ";");
+        return std::unexpected(attachedDirectory.error());
+    }
+
+    auto move = [&]() -> std::expected<bool, Error> {
+        auto begun = shard.beginTransaction();
+        if (!begun.has_value()) return std::unexpected(begun.error());
+        for (const auto& table : SHARDED_TABLES) {
+            const std::string name = table.name;
+            const std::string columns = table.columns;
+            auto copied = shard.executeUpdate("INSERT INTO main." + name + " (" + columns + ") SELECT " + columns +
+                                              " FROM " + SOURCE_SCHEMA + "." + name + " WHERE studentId = ?;", {studentId});
+            if (!copied.has_value()) {
+                shard.rollbackTransaction();
+                return std::unexpected(copied.error());
+            }
+            auto deleted = shard.executeUpdate("DELETE FROM " + SOURCE_SCHEMA + "." + name + " WHERE studentId = ?;", {studentId});
+            if (!deleted.has_value()) {
+                shard.rollbackTransaction();
+                return std::unexpected(deleted.error());
+            }
+        }
+        auto directory = shard.executeUpdate("UPDATE " + DIRECTORY_SCHEMA + ".StudentShards SET shardKey = ? WHERE studentId = ?;",
+                                             {newShardKey, studentId});
+        if (!directory.has_value()) {
+            shard.rollbackTransaction();
+            return std::unexpected(directory.error());
+        }
+        auto committed = shard.commitTransaction();
+        if (!committed.has_value()) {
+            shard.rollbackTransaction();
+            return std::unexpected(committed.error());
+        }
+        return true;
+    };
+    auto moved = move();
+    shard.executeUpdate("DETACH DATABASE " + DIRECTORY_SCHEMA + ";");
+    shard.executeUpdate("DETACH DATABASE " + SOURCE_SCHEMA + ";");
+    if (!moved.has_value()) {
+        LOG_ERROR("SqlShardRouter: Failed to move student " + studentId + " to shard '" + newShardKey + "': " + moved.error().message);
+        return moved;
+    }
+    LOG_INFO("SqlShardRouter: Moved student " + studentId + " from shard '" + oldShardKey.value() + "' to '" + newShardKey + "'.");
+    return true;
+}
+
+std::expected<bool, Error> SqlShardRouter::purgeStudent(const std::string& studentId, const std::string& shardKey) {
+    auto shardResult = shardFor(shardKey);
+    if (!shardResult.has_value()) return std::unexpected(shardResult.error());
+    IDatabaseAdapter& shard = *shardResult.value();
+    auto begun = shard.beginTransaction();
+    if (!begun.has_value()) return std::unexpected(begun.error());
+    for (const auto& table : SHARDED_TABLES) {
+        auto deleted = shard.executeUpdate("DELETE FROM " + std::string(table.name) + " WHERE studentId = ?;", {studentId});
+        if (!deleted.has_value()) {
+            shard.rollbackTransaction();
+            return std::unexpected(deleted.error());
+        }
+    }
+    auto committed = shard.commitTransaction();
+    if (!committed.has_value()) {
+        shard.rollbackTransaction();
+        return std::unexpected(committed.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlShardRouter::purgeCourse(const std::string& courseId) {
+    auto purged = fanOut<bool>([&courseId](const std::shared_ptr<IDatabaseAdapter>& shard) -> std::expected<std::vector<bool>, Error> {
+        auto begun = shard->beginTransaction();
+        if (!begun.has_value()) return std::unexpected(begun.error());
+        for (const char* table : {"Enrollments", "CourseResults"}) {
+            auto deleted = shard->executeUpdate("DELETE FROM " + std::string(table) + " WHERE courseId = ?;", {courseId});
+            if (!deleted.has_value()) {
+                shard->rollbackTransaction();
+                return std::unexpected(deleted.error());
+            }
+        }
+        auto committed = shard->commitTransaction();
+        if (!committed.has_value()) {
+            shard->rollbackTransaction();
+            return std::unexpected(committed.error());
+        }
+        return std::vector<bool>{true};
+    });
+    if (!purged.has_value()) return std::unexpected(purged.error());
+    return true;
+}
+
+std::expected<bool, Error> SqlShardRouter::isTermClosed(const std::string& termId) const {
+    if (termId.empty()) return false;
+    auto term = _mainAdapter->executeQuery("SELECT closed FROM Terms WHERE id = ?;", {termId});
+    if (!term.has_value()) return std::unexpected(term.error());
+    if (term->empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Term " + termId + " not found."});
+    }
+    return SqlParserUtils::getOptional<long long>(term->front(), "closed") != 0;
+}
+
+std::expected<bool, Error> SqlShardRouter::ensureTermsOpen(const std::vector<std::string>& termIds, int closedCode, const std::string& what) const {
+    std::vector<std::string> checked;
+    for (const auto& termId : termIds) {
+        if (termId.empty() || std::find(checked.begin(), checked.end(), termId) != checked.end()) continue;
+        checked.push_back(termId);
+        auto closed = isTermClosed(termId);
+        if (!closed.has_value()) {
+            // Học kỳ đã bị xóa khỏi cơ sở dữ liệu chính thì không còn bị khóa
+            if (closed.error().code == ErrorCode::NOT_FOUND) continue;
+            return std::unexpected(closed.error());
+        }
+        if (closed.value()) {
+            return std::unexpected(Error{closedCode, what + " belongs to a closed term and is read-only."});
+        }
+    }
+    return true;
+}
+
+std::expected<std::string, Error> SqlShardRouter::currentTermId() const {
+    auto term = _mainAdapter->executeQuery("SELECT id FROM Terms WHERE closed = 0 AND startDate <= date('now') ORDER BY startDate DESC LIMIT 1;");
+    if (!term.has_value()) return std::unexpected(term.error());
+    if (term->empty()) return std::string{};
+    return SqlParserUtils::getOptional<std::string>(term->front(), "id");
+}
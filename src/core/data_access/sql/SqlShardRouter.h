@@ -0,0 +1,181 @@
+#ifndef SQLSHARDROUTER_H
+#define SQLSHARDROUTER_H
+
+/**
+ * @file SqlShardRouter.h
+ * @brief Routes per-student SQL tables to one SQLite file per faculty
+ */
+
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include "../../../common/ErrorType.h"
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @class SqlShardRouter
+ * @brief Owns the faculty shard connections and decides which shard holds a student's rows
+ *
+ * Enrollments, CourseResults, FeeRecords and FeePayments live in one file per faculty, so writes for
+ * different faculties take different SQLite write locks. Users, Students, Courses and Terms stay in the
+ * main database; its StudentShards table records the shard of each student and is filled from
+ * Students.facultyId the first time the student is routed. The directory, not the current facultyId, is
+ * authoritative: a student's rows only change shard through moveStudent().
+ */
+class SqlShardRouter {
+private:
+    std::shared_ptr<IDatabaseAdapter> _mainAdapter; ///< Main database (directory, courses, terms)
+    std::string _mainDatabasePath;                  ///< File of the main database
+    std::filesystem::path _shardDirectory;          ///< Directory holding the shard files
+    std::map<std::string, std::shared_ptr<IDatabaseAdapter>> _shards; ///< Open shard connections by shard key
+    std::mutex _shardsMutex;                        ///< Guards _shards
+
+public:
+    template <typename T>
+    using ShardQuery = std::function<std::expected<std::vector<T>, Error>(const std::shared_ptr<IDatabaseAdapter>&)>;
+
+    /**
+     * @brief Constructor for SqlShardRouter
+     * @param mainAdapter Connection to the main database (directory, courses, terms)
+     * @param mainDatabasePath File of the main database, attached while moving a student between shards
+     * @param shardDirectory Directory holding the shard files, created on first use
+     * @throws std::invalid_argument if mainAdapter is null or shardDirectory is empty
+     */
+    SqlShardRouter(std::shared_ptr<IDatabaseAdapter> mainAdapter, std::string mainDatabasePath, std::filesystem::path shardDirectory);
+
+    IDatabaseAdapter& mainAdapter() const;
+
+    /**
+     * @brief File of the shard for a faculty ("" is the shard of students without a faculty)
+     */
+    std::filesystem::path shardPath(const std::string& shardKey) const;
+
+    /**
+     * @brief Opens (once) the shard of a faculty, creating the file and its tables if needed
+     */
+    std::expected<std::shared_ptr<IDatabaseAdapter>, Error> shardFor(const std::string& shardKey);
+
+    /**
+     * @brief Shard key of a student, assigning it from Students.facultyId on first use
+     * @return The shard key, or NOT_FOUND if the student does not exist
+     */
+    std::expected<std::string, Error> shardKeyOfStudent(const std::string& studentId);
+
+    std::expected<std::shared_ptr<IDatabaseAdapter>, Error> shardForStudent(const std::string& studentId);
+
+    /**
+     * @brief Every shard that may hold rows: the shards in the directory plus the ones already open
+     */
+    std::expected<std::vector<std::shared_ptr<IDatabaseAdapter>>, Error> allShards();
+
+    /**
+     * @brief Runs the query on every shard in parallel and concatenates the results
+     *
+     * Each shard has its own connection, so the queries do not contend with each other. Results are
+     * merged in shard order; callers needing a global order sort afterwards.
+     */
+    template <typename T>
+    std::expected<std::vector<T>, Error> fanOut(const ShardQuery<T>& query) {
+        auto shards = allShards();
+        if (!shards.has_value()) return std::unexpected(shards.error());
+
+        std::vector<std::future<std::expected<std::vector<T>, Error>>> pending;
+        pending.reserve(shards->size());
+        for (const auto& shard : shards.value()) {
+            pending.push_back(std::async(std::launch::async, [&query, shard]() { return query(shard); }));
+        }
+        std::vector<T> merged;
+        std::optional<Error> firstError;
+        for (auto& part : pending) {
+            auto rows = part.get(); // Wait for every shard before returning, the tasks reference query
+            if (!rows.has_value()) {
+                if (!firstError) firstError = rows.error();
+                continue;
+            }
+            merged.insert(merged.end(), std::make_move_iterator(rows->begin()), std::make_move_iterator(rows->end()));
+        }
+        if (firstError) return std::unexpected(*firstError);
+        return merged;
+    }
+
+    /**
+     * @brief Splits items by the shard of their student and runs one write per shard concurrently
+     *
+     * Each shard's write is atomic on its own; a failure in one shard does not undo the others.
+     * @return true if every shard succeeded, otherwise the first error
+     */
+    template <typename T>
+    std::expected<bool, Error> writePartitioned(const std::vector<T>& items,
+                                                const std::function<std::string(const T&)>& studentIdOf,
+                                                const std::function<std::expected<bool, Error>(const std::shared_ptr<IDatabaseAdapter>&, const std::vector<T>&)>& write) {
+        std::map<std::string, std::vector<T>> groups;
+        for (const auto& item : items) {
+            auto shardKey = shardKeyOfStudent(studentIdOf(item));
+            if (!shardKey.has_value()) return std::unexpected(shardKey.error());
+            groups[shardKey.value()].push_back(item);
+        }
+
+        std::vector<std::future<std::expected<bool, Error>>> pending;
+        pending.reserve(groups.size());
+        for (const auto& [shardKey, group] : groups) {
+            auto shard = shardFor(shardKey);
+            if (!shard.has_value()) return std::unexpected(shard.error());
+            pending.push_back(std::async(std::launch::async, [&write, &group, shard = shard.value()]() { return write(shard, group); }));
+        }
+        std::optional<Error> firstError;
+        for (auto& part : pending) {
+            auto written = part.get();
+            if (!written.has_value() && !firstError) firstError = written.error();
+        }
+        if (firstError) return std::unexpected(*firstError);
+        return true;
+    }
+
+    /**
+     * @brief Moves a student's rows to another shard and updates the directory
+     *
+     * The source shard and the main database are attached to the destination connection, so the copy,
+     * the delete and the directory update commit together. Must be called outside a main-database transaction.
+     */
+    std::expected<bool, Error> moveStudent(const std::string& studentId, const std::string& newShardKey);
+
+    /**
+     * @brief Deletes every row of a student from a shard (the main-database cascade does not reach the shards)
+     * @param shardKey Shard read before the student was deleted, since the directory row cascades with the student
+     */
+    std::expected<bool, Error> purgeStudent(const std::string& studentId, const std::string& shardKey);
+
+    /**
+     * @brief Deletes the enrollments and results of a course from every shard
+     */
+    std::expected<bool, Error> purgeCourse(const std::string& courseId);
+
+    /**
+     * @brief Whether a term is closed in the main database
+     * @return false for an empty term id, NOT_FOUND if the term does not exist
+     */
+    std::expected<bool, Error> isTermClosed(const std::string& termId) const;
+
+    /**
+     * @brief Rejects a write touching rows of a closed term, replacing the closed-term triggers of the main schema
+     * @param termIds Terms of the rows being written (empty ids and unknown terms count as open)
+     * @param closedCode Error code to report, as in SqlDaoUtils::mapClosedTermError
+     * @param what Description of the rejected write, used in the message
+     */
+    std::expected<bool, Error> ensureTermsOpen(const std::vector<std::string>& termIds, int closedCode, const std::string& what) const;
+
+    /**
+     * @brief Open term that started most recently, or "" if none (same rule as trg_Enrollments_term_default)
+     */
+    std::expected<std::string, Error> currentTermId() const;
+};
+
+#endif // SQLSHARDROUTER_H
@@ -0,0 +1,44 @@
+#include "SqlShardedCourseDao.h"
+#include "../../parsing/impl_sql_parser/SqlParserUtils.h"
+#include "../../../utils/Logger.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    std::shared_ptr<IDatabaseAdapter> requireMainAdapter(const std::shared_ptr<SqlShardRouter>& router) {
+        if (!router) {
+            throw std::invalid_argument("Shard router cannot be null for SqlShardedCourseDao.");
+        }
+        // Con trỏ bí danh: adapter chính sống ít nhất bằng router
+        return std::shared_ptr<IDatabaseAdapter>(router, &router->mainAdapter());
+    }
+}
+
+SqlShardedCourseDao::SqlShardedCourseDao(std::shared_ptr<SqlShardRouter> router,
+                                         std::shared_ptr<IEntityParser<Course, DbQueryResultRow>> parser)
+    : SqlCourseDao(requireMainAdapter(router), std::move(parser)), _router(std::move(router)) {}
+
+std::expected<bool, Error> SqlShardedCourseDao::remove(const std::string& id) {
+    auto termIds = _router->fanOut<std::string>([&id](const std::shared_ptr<IDatabaseAdapter>& shard) -> std::expected<std::vector<std::string>, Error> {
+        auto rows = shard->executeQuery(
+            "SELECT termId FROM Enrollments WHERE courseId = ? UNION SELECT termId FROM CourseResults WHERE courseId = ?;", {id, id});
+        if (!rows.has_value()) return std::unexpected(rows.error());
+        std::vector<std::string> shardTermIds;
+        shardTermIds.reserve(rows->size());
+        for (const auto& row : rows.value()) {
+            shardTermIds.push_back(SqlParserUtils::getOptional<std::string>(row, "termId"));
+        }
+        return shardTermIds;
+    });
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::COURSE_ENROLLMENT_CLOSED, "A record of Course " + id);
+    if (!open.has_value()) return open;
+
+    auto removed = SqlCourseDao::remove(id);
+    if (!removed.has_value()) return removed;
+    auto purged = _router->purgeCourse(id);
+    if (!purged.has_value()) {
+        LOG_ERROR("SqlShardedCourseDao: Course " + id + " was removed but its shard rows remain: " + purged.error().message);
+        return std::unexpected(purged.error());
+    }
+    return removed;
+}
@@ -0,0 +1,39 @@
+#ifndef SQLSHARDEDCOURSEDAO_H
+#define SQLSHARDEDCOURSEDAO_H
+
+/**
+ * @file SqlShardedCourseDao.h
+ * @brief Course data access object that removes a course's rows from the faculty shards
+ */
+
+#include "SqlCourseDao.h"
+#include "SqlShardRouter.h"
+#include <memory>
+
+/**
+ * @class SqlShardedCourseDao
+ * @brief Keeps courses in the main database and replaces the enrollment/result cascade on removal
+ */
+class SqlShardedCourseDao : public SqlCourseDao {
+private:
+    std::shared_ptr<SqlShardRouter> _router; ///< Router to the faculty shards
+
+public:
+    /**
+     * @brief Constructor for SqlShardedCourseDao
+     * @param router Router to the faculty shards
+     * @param parser Entity parser for converting database results to Course objects
+     * @throws std::invalid_argument if router or parser is null
+     */
+    SqlShardedCourseDao(std::shared_ptr<SqlShardRouter> router,
+                        std::shared_ptr<IEntityParser<Course, DbQueryResultRow>> parser);
+
+    ~SqlShardedCourseDao() override = default;
+
+    /**
+     * @brief Removes the course and its shard rows; rejected while any of those rows is in a closed term
+     */
+    std::expected<bool, Error> remove(const std::string& id) override;
+};
+
+#endif // SQLSHARDEDCOURSEDAO_H
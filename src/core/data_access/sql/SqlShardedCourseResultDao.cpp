@@ -0,0 +1,177 @@
+#include "SqlShardedCourseResultDao.h"
+#include "SqlCourseResultDao.h"
+#include "../../parsing/impl_sql_parser/SqlParserUtils.h"
+#include <set>
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    std::expected<std::vector<std::string>, Error> resultTermIds(IDatabaseAdapter& shard, const std::string& where, const std::vector<DbQueryParam>& params) {
+        auto rows = shard.executeQuery("SELECT termId FROM CourseResults WHERE " + where + ";", params);
+        if (!rows.has_value()) return std::unexpected(rows.error());
+        std::vector<std::string> termIds;
+        termIds.reserve(rows->size());
+        for (const auto& row : rows.value()) {
+            termIds.push_back(SqlParserUtils::getOptional<std::string>(row, "termId"));
+        }
+        return termIds;
+    }
+}
+
+SqlShardedCourseResultDao::SqlShardedCourseResultDao(std::shared_ptr<SqlShardRouter> router,
+                                                     std::shared_ptr<IEntityParser<CourseResult, DbQueryResultRow>> parser)
+    : _router(std::move(router)), _parser(std::move(parser)) {
+    if (!_router) {
+        throw std::invalid_argument("Shard router cannot be null for SqlShardedCourseResultDao.");
+    }
+    if (!_parser) {
+        throw std::invalid_argument("CourseResult parser cannot be null for SqlShardedCourseResultDao.");
+    }
+}
+
+std::expected<bool, Error> SqlShardedCourseResultDao::checkWritable(IDatabaseAdapter& shard, const std::vector<CourseResult>& results) const {
+    std::set<std::string> courseIds;
+    for (const auto& result : results) courseIds.insert(result.getCourseId());
+    for (const auto& courseId : courseIds) {
+        auto course = _router->mainAdapter().executeQuery("SELECT 1 FROM Courses WHERE id = ?;", {courseId});
+        if (!course.has_value()) return std::unexpected(course.error());
+        if (course->empty()) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course with ID '" + courseId + "' not found."});
+        }
+    }
+
+    for (const auto& result : results) {
+        // Học kỳ của kết quả: học kỳ ghi rõ, nếu không thì học kỳ của bản ghi đăng ký (như trg_CourseResults_term_default),
+        // cùng với học kỳ của kết quả đang có sẽ bị ghi đè
+        std::vector<std::string> termIds;
+        if (!result.getTermId().empty()) {
+            termIds.push_back(result.getTermId());
+        } else {
+            auto enrollment = shard.executeQuery("SELECT termId FROM Enrollments WHERE studentId = ? AND courseId = ?;",
+                                                 {result.getStudentId(), result.getCourseId()});
+            if (!enrollment.has_value()) return std::unexpected(enrollment.error());
+            if (!enrollment->empty()) termIds.push_back(SqlParserUtils::getOptional<std::string>(enrollment->front(), "termId"));
+        }
+        auto existing = resultTermIds(shard, "studentId = ? AND courseId = ?", {result.getStudentId(), result.getCourseId()});
+        if (!existing.has_value()) return std::unexpected(existing.error());
+        termIds.insert(termIds.end(), existing->begin(), existing->end());
+
+        auto open = _router->ensureTermsOpen(termIds, ErrorCode::GRADING_PERIOD_CLOSED,
+                                             "Result of Student " + result.getStudentId() + " in Course " + result.getCourseId());
+        if (!open.has_value()) return std::unexpected(open.error());
+    }
+    return true;
+}
+
+std::expected<CourseResult, Error> SqlShardedCourseResultDao::find(const std::string& studentId, const std::string& courseId) const {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    return SqlCourseResultDao(shard.value(), _parser).find(studentId, courseId);
+}
+
+std::expected<std::vector<CourseResult>, Error> SqlShardedCourseResultDao::findByStudentId(const std::string& studentId) const {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return std::vector<CourseResult>{};
+        return std::unexpected(shard.error());
+    }
+    return SqlCourseResultDao(shard.value(), _parser).findByStudentId(studentId);
+}
+
+std::expected<std::vector<CourseResult>, Error> SqlShardedCourseResultDao::findByCourseId(const std::string& courseId) const {
+    return _router->fanOut<CourseResult>([this, &courseId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlCourseResultDao(shard, _parser).findByCourseId(courseId);
+    });
+}
+
+std::expected<std::vector<CourseResult>, Error> SqlShardedCourseResultDao::findByTerm(const std::string& termId) const {
+    return _router->fanOut<CourseResult>([this, &termId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlCourseResultDao(shard, _parser).findByTerm(termId);
+    });
+}
+
+std::expected<std::vector<CourseResult>, Error> SqlShardedCourseResultDao::findByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    return _router->fanOut<CourseResult>([this, &termId, &courseId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlCourseResultDao(shard, _parser).findByTermAndCourse(termId, courseId);
+    });
+}
+
+std::expected<bool, Error> SqlShardedCourseResultDao::addOrUpdate(const CourseResult& result) {
+    auto shard = _router->shardForStudent(result.getStudentId());
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    auto writable = checkWritable(*shard.value(), {result});
+    if (!writable.has_value()) return writable;
+    return SqlCourseResultDao(shard.value(), _parser).addOrUpdate(result);
+}
+
+std::expected<std::size_t, Error> SqlShardedCourseResultDao::forEachResult(const std::function<bool(const CourseResult&)>& visitor) const {
+    auto shards = _router->allShards();
+    if (!shards.has_value()) return std::unexpected(shards.error());
+    std::size_t visited = 0;
+    bool stopped = false;
+    for (const auto& shard : shards.value()) {
+        auto scanned = SqlCourseResultDao(shard, _parser).forEachResult([&](const CourseResult& result) {
+            ++visited;
+            stopped = !visitor(result);
+            return !stopped;
+        });
+        if (!scanned.has_value()) return std::unexpected(scanned.error());
+        if (stopped) break;
+    }
+    return visited;
+}
+
+std::expected<bool, Error> SqlShardedCourseResultDao::addOrUpdateBatch(const std::vector<CourseResult>& results) {
+    if (results.empty()) return true;
+    return _router->writePartitioned<CourseResult>(
+        results, [](const CourseResult& result) { return result.getStudentId(); },
+        [this](const std::shared_ptr<IDatabaseAdapter>& shard, const std::vector<CourseResult>& group) -> std::expected<bool, Error> {
+            auto writable = checkWritable(*shard, group);
+            if (!writable.has_value()) return writable;
+            return SqlCourseResultDao(shard, _parser).addOrUpdateBatch(group);
+        });
+}
+
+std::expected<bool, Error> SqlShardedCourseResultDao::remove(const std::string& studentId, const std::string& courseId) {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "CourseResult not found for removal (Student: " + studentId + ", Course: " + courseId + ")."});
+        }
+        return std::unexpected(shard.error());
+    }
+    auto termIds = resultTermIds(*shard.value(), "studentId = ? AND courseId = ?", {studentId, courseId});
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::GRADING_PERIOD_CLOSED, "Result of Student " + studentId + " in Course " + courseId);
+    if (!open.has_value()) return open;
+    return SqlCourseResultDao(shard.value(), _parser).remove(studentId, courseId);
+}
+
+std::expected<bool, Error> SqlShardedCourseResultDao::removeAllForStudent(const std::string& studentId) {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return true;
+        return std::unexpected(shard.error());
+    }
+    auto termIds = resultTermIds(*shard.value(), "studentId = ?", {studentId});
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::GRADING_PERIOD_CLOSED, "A result of Student " + studentId);
+    if (!open.has_value()) return open;
+    return SqlCourseResultDao(shard.value(), _parser).removeAllForStudent(studentId);
+}
+
+std::expected<bool, Error> SqlShardedCourseResultDao::removeAllForCourse(const std::string& courseId) {
+    auto termIds = _router->fanOut<std::string>([&courseId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return resultTermIds(*shard, "courseId = ?", {courseId});
+    });
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::GRADING_PERIOD_CLOSED, "A result of Course " + courseId);
+    if (!open.has_value()) return open;
+
+    auto removed = _router->fanOut<bool>([this, &courseId](const std::shared_ptr<IDatabaseAdapter>& shard) -> std::expected<std::vector<bool>, Error> {
+        auto shardRemoved = SqlCourseResultDao(shard, _parser).removeAllForCourse(courseId);
+        if (!shardRemoved.has_value()) return std::unexpected(shardRemoved.error());
+        return std::vector<bool>{shardRemoved.value()};
+    });
+    if (!removed.has_value()) return std::unexpected(removed.error());
+    return true;
+}
@@ -0,0 +1,64 @@
+#ifndef SQLSHARDEDCOURSERESULTDAO_H
+#define SQLSHARDEDCOURSERESULTDAO_H
+
+/**
+ * @file SqlShardedCourseResultDao.h
+ * @brief Course result data access object over the faculty shards
+ */
+
+#include "../interface/ICourseResultDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "SqlShardRouter.h"
+#include <memory>
+
+/**
+ * @class SqlShardedCourseResultDao
+ * @brief Stores each result in the shard of its student and fans course/term reads out to every shard
+ *
+ * Batches are split by shard and each shard's part is written concurrently in its own transaction.
+ * Closed-term checks use the main Terms table through the router instead of the CourseResults triggers.
+ */
+class SqlShardedCourseResultDao : public ICourseResultDao {
+private:
+    std::shared_ptr<SqlShardRouter> _router; ///< Router to the shard of each student
+    std::shared_ptr<IEntityParser<CourseResult, DbQueryResultRow>> _parser; ///< Parser for converting DB results to CourseResult objects
+
+    /**
+     * @brief Rejects results whose course is missing from the main database or whose term is closed
+     */
+    std::expected<bool, Error> checkWritable(IDatabaseAdapter& shard, const std::vector<CourseResult>& results) const;
+
+public:
+    /**
+     * @brief Constructor for SqlShardedCourseResultDao
+     * @param router Router to the faculty shards
+     * @param parser Entity parser for converting database results to CourseResult objects
+     * @throws std::invalid_argument if router or parser is null
+     */
+    SqlShardedCourseResultDao(std::shared_ptr<SqlShardRouter> router,
+                              std::shared_ptr<IEntityParser<CourseResult, DbQueryResultRow>> parser);
+
+    ~SqlShardedCourseResultDao() override = default;
+
+    std::expected<CourseResult, Error> find(const std::string& studentId, const std::string& courseId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByStudentId(const std::string& studentId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByCourseId(const std::string& courseId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByTerm(const std::string& termId) const override;
+    std::expected<std::vector<CourseResult>, Error> findByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
+    std::expected<bool, Error> addOrUpdate(const CourseResult& result) override;
+
+    /**
+     * @brief Streams the shards one after another (the visitor is not required to be thread-safe)
+     */
+    std::expected<std::size_t, Error> forEachResult(const std::function<bool(const CourseResult&)>& visitor) const override;
+
+    /**
+     * @brief Atomic per shard only: a failure in one faculty's shard does not undo the other shards
+     */
+    std::expected<bool, Error> addOrUpdateBatch(const std::vector<CourseResult>& results) override;
+    std::expected<bool, Error> remove(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> removeAllForStudent(const std::string& studentId) override;
+    std::expected<bool, Error> removeAllForCourse(const std::string& courseId) override;
+};
+
+#endif // SQLSHARDEDCOURSERESULTDAO_H
@@ -0,0 +1,230 @@
+#include "SqlShardedEnrollmentDao.h"
+#include "SqlEnrollmentDao.h"
+#include "../../parsing/impl_sql_parser/SqlParserUtils.h"
+#include "../../../utils/Logger.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    // Học kỳ của các dòng đăng ký thỏa điều kiện, dùng để kiểm tra học kỳ đã đóng trước khi ghi
+    std::expected<std::vector<std::string>, Error> termIdsOf(IDatabaseAdapter& shard, const std::string& where, const std::vector<DbQueryParam>& params) {
+        auto rows = shard.executeQuery("SELECT termId FROM Enrollments WHERE " + where + ";", params);
+        if (!rows.has_value()) return std::unexpected(rows.error());
+        std::vector<std::string> termIds;
+        termIds.reserve(rows->size());
+        for (const auto& row : rows.value()) {
+            termIds.push_back(SqlParserUtils::getOptional<std::string>(row, "termId"));
+        }
+        return termIds;
+    }
+
+    Error enrollmentNotFound(const std::string& studentId, const std::string& courseId) {
+        return Error{ErrorCode::NOT_FOUND, "Enrollment not found for Student " + studentId + " in Course " + courseId + "."};
+    }
+}
+
+SqlShardedEnrollmentDao::SqlShardedEnrollmentDao(std::shared_ptr<SqlShardRouter> router,
+                                                 std::shared_ptr<IEntityParser<EnrollmentRecord, DbQueryResultRow>> parser)
+    : _router(std::move(router)), _parser(std::move(parser)) {
+    if (!_router) {
+        throw std::invalid_argument("Shard router cannot be null for SqlShardedEnrollmentDao.");
+    }
+    if (!_parser) {
+        throw std::invalid_argument("EnrollmentRecord parser cannot be null for SqlShardedEnrollmentDao.");
+    }
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::releaseSeats(const std::string& courseId, long count) {
+    if (count <= 0) return true;
+    auto released = _router->mainAdapter().executeUpdate("UPDATE Courses SET enrolledCount = MAX(enrolledCount - ?, 0) WHERE id = ?;",
+                                                         {count, courseId});
+    if (!released.has_value()) return std::unexpected(released.error());
+    return true;
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::enroll(const std::string& studentId, const std::string& courseId) {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    SqlEnrollmentDao shardDao(shard.value(), _parser);
+    auto enrolled = shardDao.isEnrolled(studentId, courseId);
+    if (!enrolled.has_value()) return std::unexpected(enrolled.error());
+    if (enrolled.value()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " already enrolled in course " + courseId + "."});
+    }
+    auto termId = _router->currentTermId();
+    if (!termId.has_value()) return std::unexpected(termId.error());
+
+    // Kiểm tra và giữ chỗ trong cùng một câu lệnh như trg_Enrollments_seat_check/seat_take
+    IDatabaseAdapter& mainDb = _router->mainAdapter();
+    auto seat = mainDb.executeUpdate("UPDATE Courses SET enrolledCount = enrolledCount + 1 WHERE id = ? AND (capacity = 0 OR enrolledCount < capacity);",
+                                     {courseId});
+    if (!seat.has_value()) return std::unexpected(seat.error());
+    if (seat.value() == 0) {
+        auto course = mainDb.executeQuery("SELECT 1 FROM Courses WHERE id = ?;", {courseId});
+        if (!course.has_value()) return std::unexpected(course.error());
+        if (course->empty()) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course with ID '" + courseId + "' not found."});
+        }
+        return std::unexpected(Error{ErrorCode::COURSE_CAPACITY_REACHED, "Course " + courseId + " has no seats left."});
+    }
+
+    auto inserted = shard.value()->executeUpdate("INSERT INTO Enrollments (studentId, courseId, termId) VALUES (?, ?, ?);",
+                                                 {studentId, courseId, termId->empty() ? DbQueryParam{} : DbQueryParam{termId.value()}});
+    if (!inserted.has_value()) {
+        auto released = releaseSeats(courseId, 1);
+        if (!released.has_value()) {
+            LOG_ERROR("SqlShardedEnrollmentDao: Seat of Course " + courseId + " stays taken after a failed enrollment of Student " +
+                      studentId + ": " + released.error().message);
+        }
+        if (inserted.error().code == ErrorCode::ALREADY_EXISTS) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " already enrolled in course " + courseId + "."});
+        }
+        return std::unexpected(inserted.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::addEnrollment(const std::string& studentId, const std::string& courseId) {
+    return enroll(studentId, courseId);
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) {
+    return enroll(studentId, courseId);
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::removeEnrollment(const std::string& studentId, const std::string& courseId) {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return std::unexpected(enrollmentNotFound(studentId, courseId));
+        return std::unexpected(shard.error());
+    }
+    auto termIds = termIdsOf(*shard.value(), "studentId = ? AND courseId = ?", {studentId, courseId});
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    if (termIds->empty()) return std::unexpected(enrollmentNotFound(studentId, courseId));
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                         "Enrollment of Student " + studentId + " in Course " + courseId);
+    if (!open.has_value()) return std::unexpected(open.error());
+
+    auto removed = SqlEnrollmentDao(shard.value(), _parser).removeEnrollment(studentId, courseId);
+    if (!removed.has_value()) return removed;
+    return releaseSeats(courseId, 1);
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::removeEnrollmentsByStudent(const std::string& studentId) {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return true;
+        return std::unexpected(shard.error());
+    }
+    SqlEnrollmentDao shardDao(shard.value(), _parser);
+    auto courseIds = shardDao.findCourseIdsByStudentId(studentId);
+    if (!courseIds.has_value()) return std::unexpected(courseIds.error());
+    auto termIds = termIdsOf(*shard.value(), "studentId = ?", {studentId});
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::COURSE_ENROLLMENT_CLOSED, "An enrollment of Student " + studentId);
+    if (!open.has_value()) return std::unexpected(open.error());
+
+    auto removed = shardDao.removeEnrollmentsByStudent(studentId);
+    if (!removed.has_value()) return removed;
+    for (const auto& courseId : courseIds.value()) {
+        auto released = releaseSeats(courseId, 1);
+        if (!released.has_value()) return released;
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::removeEnrollmentsByCourse(const std::string& courseId) {
+    auto termIds = _router->fanOut<std::string>([&courseId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return termIdsOf(*shard, "courseId = ?", {courseId});
+    });
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::COURSE_ENROLLMENT_CLOSED, "An enrollment of Course " + courseId);
+    if (!open.has_value()) return std::unexpected(open.error());
+
+    auto removedCounts = _router->fanOut<long>([&courseId](const std::shared_ptr<IDatabaseAdapter>& shard) -> std::expected<std::vector<long>, Error> {
+        auto removed = shard->executeUpdate("DELETE FROM Enrollments WHERE courseId = ?;", {courseId});
+        if (!removed.has_value()) return std::unexpected(removed.error());
+        return std::vector<long>{removed.value()};
+    });
+    if (!removedCounts.has_value()) return std::unexpected(removedCounts.error());
+    long removed = 0;
+    for (long count : removedCounts.value()) removed += count;
+    return releaseSeats(courseId, removed);
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::isEnrolled(const std::string& studentId, const std::string& courseId) const {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return false;
+        return std::unexpected(shard.error());
+    }
+    return SqlEnrollmentDao(shard.value(), _parser).isEnrolled(studentId, courseId);
+}
+
+std::expected<std::vector<std::string>, Error> SqlShardedEnrollmentDao::findCourseIdsByStudentId(const std::string& studentId) const {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return std::vector<std::string>{};
+        return std::unexpected(shard.error());
+    }
+    return SqlEnrollmentDao(shard.value(), _parser).findCourseIdsByStudentId(studentId);
+}
+
+std::expected<std::vector<std::string>, Error> SqlShardedEnrollmentDao::findStudentIdsByCourseId(const std::string& courseId) const {
+    return _router->fanOut<std::string>([this, &courseId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlEnrollmentDao(shard, _parser).findStudentIdsByCourseId(courseId);
+    });
+}
+
+std::expected<std::vector<EnrollmentRecord>, Error> SqlShardedEnrollmentDao::getAllEnrollments() const {
+    return _router->fanOut<EnrollmentRecord>([this](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlEnrollmentDao(shard, _parser).getAllEnrollments();
+    });
+}
+
+std::expected<std::vector<EnrollmentRecord>, Error> SqlShardedEnrollmentDao::findByTerm(const std::string& termId) const {
+    return _router->fanOut<EnrollmentRecord>([this, &termId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlEnrollmentDao(shard, _parser).findByTerm(termId);
+    });
+}
+
+std::expected<std::vector<std::string>, Error> SqlShardedEnrollmentDao::findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const {
+    return _router->fanOut<std::string>([this, &termId, &courseId](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlEnrollmentDao(shard, _parser).findStudentIdsByTermAndCourse(termId, courseId);
+    });
+}
+
+std::expected<bool, Error> SqlShardedEnrollmentDao::setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return std::unexpected(enrollmentNotFound(studentId, courseId));
+        return std::unexpected(shard.error());
+    }
+    // Khóa ngoại termId -> Terms nằm ở cơ sở dữ liệu chính nên kiểm tra học kỳ mới tồn tại tại đây
+    auto newTermClosed = _router->isTermClosed(termId);
+    if (!newTermClosed.has_value()) return std::unexpected(newTermClosed.error());
+    auto termIds = termIdsOf(*shard.value(), "studentId = ? AND courseId = ?", {studentId, courseId});
+    if (!termIds.has_value()) return std::unexpected(termIds.error());
+    if (termIds->empty()) return std::unexpected(enrollmentNotFound(studentId, courseId));
+    termIds->push_back(termId);
+    auto open = _router->ensureTermsOpen(termIds.value(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                         "Enrollment of Student " + studentId + " in Course " + courseId);
+    if (!open.has_value()) return std::unexpected(open.error());
+    return SqlEnrollmentDao(shard.value(), _parser).setEnrollmentTerm(studentId, courseId, termId);
+}
+
+std::expected<std::size_t, Error> SqlShardedEnrollmentDao::forEachEnrollment(const std::function<bool(const EnrollmentRecord&)>& visitor) const {
+    auto shards = _router->allShards();
+    if (!shards.has_value()) return std::unexpected(shards.error());
+    std::size_t visited = 0;
+    bool stopped = false;
+    for (const auto& shard : shards.value()) {
+        auto scanned = SqlEnrollmentDao(shard, _parser).forEachEnrollment([&](const EnrollmentRecord& record) {
+            ++visited;
+            stopped = !visitor(record);
+            return !stopped;
+        });
+        if (!scanned.has_value()) return std::unexpected(scanned.error());
+        if (stopped) break;
+    }
+    return visited;
+}
@@ -0,0 +1,72 @@
+#ifndef SQLSHARDEDENROLLMENTDAO_H
+#define SQLSHARDEDENROLLMENTDAO_H
+
+/**
+ * @file SqlShardedEnrollmentDao.h
+ * @brief Enrollment data access object over the faculty shards
+ */
+
+#include "../interface/IEnrollmentDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "SqlShardRouter.h"
+#include <memory>
+
+/**
+ * @class SqlShardedEnrollmentDao
+ * @brief Stores each enrollment in the shard of its student and fans university-wide reads out to every shard
+ *
+ * Per-shard reads and writes go through SqlEnrollmentDao on the shard connection. The seat counter stays in
+ * Courses on the main database: a seat is taken there with a conditional UPDATE before the shard insert and
+ * given back if the insert fails, replacing the Enrollments_seat_* triggers. Closed-term checks and the
+ * default term use the main Terms table through the router.
+ */
+class SqlShardedEnrollmentDao : public IEnrollmentDao {
+private:
+    std::shared_ptr<SqlShardRouter> _router; ///< Router to the shard of each student
+    std::shared_ptr<IEntityParser<EnrollmentRecord, DbQueryResultRow>> _parser; ///< Parser for converting DB results to EnrollmentRecord objects
+
+    /**
+     * @brief Takes a seat on the main database, inserts into the student's shard, and returns the seat on failure
+     */
+    std::expected<bool, Error> enroll(const std::string& studentId, const std::string& courseId);
+
+    /**
+     * @brief Gives seats of a course back on the main database
+     */
+    std::expected<bool, Error> releaseSeats(const std::string& courseId, long count);
+
+public:
+    /**
+     * @brief Constructor for SqlShardedEnrollmentDao
+     * @param router Router to the faculty shards
+     * @param parser Entity parser for converting database results to EnrollmentRecord objects
+     * @throws std::invalid_argument if router or parser is null
+     */
+    SqlShardedEnrollmentDao(std::shared_ptr<SqlShardRouter> router,
+                            std::shared_ptr<IEntityParser<EnrollmentRecord, DbQueryResultRow>> parser);
+
+    ~SqlShardedEnrollmentDao() override = default;
+
+    /**
+     * @brief Same as enrollIfSeatAvailable: the capacity check no longer comes from a trigger on every insert
+     */
+    std::expected<bool, Error> addEnrollment(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> enrollIfSeatAvailable(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> removeEnrollment(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> removeEnrollmentsByStudent(const std::string& studentId) override;
+    std::expected<bool, Error> removeEnrollmentsByCourse(const std::string& courseId) override;
+    std::expected<bool, Error> isEnrolled(const std::string& studentId, const std::string& courseId) const override;
+    std::expected<std::vector<std::string>, Error> findCourseIdsByStudentId(const std::string& studentId) const override;
+    std::expected<std::vector<std::string>, Error> findStudentIdsByCourseId(const std::string& courseId) const override;
+    std::expected<std::vector<EnrollmentRecord>, Error> getAllEnrollments() const override;
+    std::expected<std::vector<EnrollmentRecord>, Error> findByTerm(const std::string& termId) const override;
+    std::expected<std::vector<std::string>, Error> findStudentIdsByTermAndCourse(const std::string& termId, const std::string& courseId) const override;
+    std::expected<bool, Error> setEnrollmentTerm(const std::string& studentId, const std::string& courseId, const std::string& termId) override;
+
+    /**
+     * @brief Streams the shards one after another (the visitor is not required to be thread-safe)
+     */
+    std::expected<std::size_t, Error> forEachEnrollment(const std::function<bool(const EnrollmentRecord&)>& visitor) const override;
+};
+
+#endif // SQLSHARDEDENROLLMENTDAO_H
@@ -0,0 +1,103 @@
+#include "SqlShardedFeeRecordDao.h"
+#include "SqlFeeRecordDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+SqlShardedFeeRecordDao::SqlShardedFeeRecordDao(std::shared_ptr<SqlShardRouter> router,
+                                               std::shared_ptr<IEntityParser<FeeRecord, DbQueryResultRow>> parser)
+    : _router(std::move(router)), _parser(std::move(parser)) {
+    if (!_router) {
+        throw std::invalid_argument("Shard router cannot be null for SqlShardedFeeRecordDao.");
+    }
+    if (!_parser) {
+        throw std::invalid_argument("FeeRecord parser cannot be null for SqlShardedFeeRecordDao.");
+    }
+}
+
+std::expected<FeeRecord, Error> SqlShardedFeeRecordDao::getById(const std::string& studentId) const {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    return SqlFeeRecordDao(shard.value(), _parser).getById(studentId);
+}
+
+std::expected<std::vector<FeeRecord>, Error> SqlShardedFeeRecordDao::getAll() const {
+    return _router->fanOut<FeeRecord>([this](const std::shared_ptr<IDatabaseAdapter>& shard) {
+        return SqlFeeRecordDao(shard, _parser).getAll();
+    });
+}
+
+std::expected<std::size_t, Error> SqlShardedFeeRecordDao::forEach(const std::function<bool(const FeeRecord&)>& visitor) const {
+    auto shards = _router->allShards();
+    if (!shards.has_value()) return std::unexpected(shards.error());
+    std::size_t visited = 0;
+    bool stopped = false;
+    for (const auto& shard : shards.value()) {
+        auto scanned = SqlFeeRecordDao(shard, _parser).forEach([&](const FeeRecord& feeRecord) {
+            ++visited;
+            stopped = !visitor(feeRecord);
+            return !stopped;
+        });
+        if (!scanned.has_value()) return std::unexpected(scanned.error());
+        if (stopped) break;
+    }
+    return visited;
+}
+
+std::expected<FeeRecord, Error> SqlShardedFeeRecordDao::add(const FeeRecord& feeRecord) {
+    auto shard = _router->shardForStudent(feeRecord.getStudentId());
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    return SqlFeeRecordDao(shard.value(), _parser).add(feeRecord);
+}
+
+std::expected<bool, Error> SqlShardedFeeRecordDao::addBatch(const std::vector<FeeRecord>& feeRecords) {
+    if (feeRecords.empty()) return true;
+    return _router->writePartitioned<FeeRecord>(
+        feeRecords, [](const FeeRecord& feeRecord) { return feeRecord.getStudentId(); },
+        [this](const std::shared_ptr<IDatabaseAdapter>& shard, const std::vector<FeeRecord>& group) {
+            return SqlFeeRecordDao(shard, _parser).addBatch(group);
+        });
+}
+
+std::expected<bool, Error> SqlShardedFeeRecordDao::setTotalFees(const std::vector<FeeRecord>& feeRecords) {
+    if (feeRecords.empty()) return true;
+    return _router->writePartitioned<FeeRecord>(
+        feeRecords, [](const FeeRecord& feeRecord) { return feeRecord.getStudentId(); },
+        [this](const std::shared_ptr<IDatabaseAdapter>& shard, const std::vector<FeeRecord>& group) {
+            return SqlFeeRecordDao(shard, _parser).setTotalFees(group);
+        });
+}
+
+std::expected<bool, Error> SqlShardedFeeRecordDao::update(const FeeRecord& feeRecord) {
+    auto shard = _router->shardForStudent(feeRecord.getStudentId());
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    return SqlFeeRecordDao(shard.value(), _parser).update(feeRecord);
+}
+
+std::expected<bool, Error> SqlShardedFeeRecordDao::remove(const std::string& studentId) {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    return SqlFeeRecordDao(shard.value(), _parser).remove(studentId);
+}
+
+std::expected<bool, Error> SqlShardedFeeRecordDao::exists(const std::string& studentId) const {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return false;
+        return std::unexpected(shard.error());
+    }
+    return SqlFeeRecordDao(shard.value(), _parser).exists(studentId);
+}
+
+std::expected<bool, Error> SqlShardedFeeRecordDao::recordPayment(const FeePayment& payment) {
+    auto shard = _router->shardForStudent(payment.studentId);
+    if (!shard.has_value()) return std::unexpected(shard.error());
+    return SqlFeeRecordDao(shard.value(), _parser).recordPayment(payment);
+}
+
+std::expected<std::vector<FeePayment>, Error> SqlShardedFeeRecordDao::getPayments(const std::string& studentId) const {
+    auto shard = _router->shardForStudent(studentId);
+    if (!shard.has_value()) {
+        if (shard.error().code == ErrorCode::NOT_FOUND) return std::vector<FeePayment>{};
+        return std::unexpected(shard.error());
+    }
+    return SqlFeeRecordDao(shard.value(), _parser).getPayments(studentId);
+}
@@ -0,0 +1,55 @@
+#ifndef SQLSHARDEDFEERECORDDAO_H
+#define SQLSHARDEDFEERECORDDAO_H
+
+/**
+ * @file SqlShardedFeeRecordDao.h
+ * @brief Fee record data access object over the faculty shards
+ */
+
+#include "../interface/IFeeRecordDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "SqlShardRouter.h"
+#include <memory>
+
+/**
+ * @class SqlShardedFeeRecordDao
+ * @brief Stores each fee record and its payments in the shard of the student
+ *
+ * A record and its payments share a shard, so recordPayment stays one transaction. Batches are split
+ * by shard and written concurrently; each shard's part is atomic on its own.
+ */
+class SqlShardedFeeRecordDao : public IFeeRecordDao {
+private:
+    std::shared_ptr<SqlShardRouter> _router; ///< Router to the shard of each student
+    std::shared_ptr<IEntityParser<FeeRecord, DbQueryResultRow>> _parser; ///< Parser for converting DB results to FeeRecord objects
+
+public:
+    /**
+     * @brief Constructor for SqlShardedFeeRecordDao
+     * @param router Router to the faculty shards
+     * @param parser Entity parser for converting database results to FeeRecord objects
+     * @throws std::invalid_argument if router or parser is null
+     */
+    SqlShardedFeeRecordDao(std::shared_ptr<SqlShardRouter> router,
+                           std::shared_ptr<IEntityParser<FeeRecord, DbQueryResultRow>> parser);
+
+    ~SqlShardedFeeRecordDao() override = default;
+
+    std::expected<FeeRecord, Error> getById(const std::string& studentId) const override;
+    std::expected<std::vector<FeeRecord>, Error> getAll() const override;
+
+    /**
+     * @brief Streams the shards one after another (the visitor is not required to be thread-safe)
+     */
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const FeeRecord&)>& visitor) const override;
+    std::expected<FeeRecord, Error> add(const FeeRecord& feeRecord) override;
+    std::expected<bool, Error> addBatch(const std::vector<FeeRecord>& feeRecords) override;
+    std::expected<bool, Error> setTotalFees(const std::vector<FeeRecord>& feeRecords) override;
+    std::expected<bool, Error> update(const FeeRecord& feeRecord) override;
+    std::expected<bool, Error> remove(const std::string& studentId) override;
+    std::expected<bool, Error> exists(const std::string& studentId) const override;
+    std::expected<bool, Error> recordPayment(const FeePayment& payment) override;
+    std::expected<std::vector<FeePayment>, Error> getPayments(const std::string& studentId) const override;
+};
+
+#endif // SQLSHARDEDFEERECORDDAO_H
@@ -0,0 +1,104 @@
+#include "SqlShardedStudentDao.h"
+#include "../../parsing/impl_sql_parser/SqlParserUtils.h"
+#include "../../../utils/Logger.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    std::shared_ptr<IDatabaseAdapter> requireMainAdapter(const std::shared_ptr<SqlShardRouter>& router) {
+        if (!router) {
+            throw std::invalid_argument("Shard router cannot be null for SqlShardedStudentDao.");
+        }
+        // Con trỏ bí danh: adapter chính sống ít nhất bằng router
+        return std::shared_ptr<IDatabaseAdapter>(router, &router->mainAdapter());
+    }
+}
+
+SqlShardedStudentDao::SqlShardedStudentDao(std::shared_ptr<SqlShardRouter> router,
+                                           std::shared_ptr<IEntityParser<Student, DbQueryResultRow>> parser)
+    : _router(router), _mainDao(requireMainAdapter(router), std::move(parser)) {}
+
+std::expected<Student, Error> SqlShardedStudentDao::getById(const std::string& id) const {
+    return _mainDao.getById(id);
+}
+
+std::expected<std::vector<Student>, Error> SqlShardedStudentDao::getAll() const {
+    return _mainDao.getAll();
+}
+
+std::expected<std::size_t, Error> SqlShardedStudentDao::forEach(const std::function<bool(const Student&)>& visitor) const {
+    return _mainDao.forEach(visitor);
+}
+
+std::expected<Student, Error> SqlShardedStudentDao::add(const Student& student) {
+    return _mainDao.add(student);
+}
+
+std::expected<bool, Error> SqlShardedStudentDao::addBatch(const std::vector<Student>& students) {
+    return _mainDao.addBatch(students);
+}
+
+std::expected<bool, Error> SqlShardedStudentDao::update(const Student& student) {
+    auto existing = _mainDao.getById(student.getId());
+    if (!existing.has_value()) return std::unexpected(existing.error());
+    auto updated = _mainDao.update(student);
+    if (!updated.has_value() || existing->getFacultyId() == student.getFacultyId()) return updated;
+
+    auto moved = _router->moveStudent(student.getId(), student.getFacultyId());
+    if (!moved.has_value()) {
+        // Thư mục StudentShards vẫn trỏ về shard cũ nên dữ liệu vẫn đọc được, chỉ chưa nằm đúng khoa
+        LOG_WARN("SqlShardedStudentDao: Student " + student.getId() + " stays in its old shard: " + moved.error().message);
+    }
+    return updated;
+}
+
+std::expected<bool, Error> SqlShardedStudentDao::remove(const std::string& id) {
+    // Phải đọc shard trước khi xoá: dòng StudentShards bị xoá dây chuyền cùng sinh viên
+    auto shardKey = _router->shardKeyOfStudent(id);
+    if (!shardKey.has_value()) {
+        if (shardKey.error().code == ErrorCode::NOT_FOUND) return _mainDao.remove(id);
+        return std::unexpected(shardKey.error());
+    }
+    auto shard = _router->shardFor(shardKey.value());
+    if (!shard.has_value()) return std::unexpected(shard.error());
+
+    auto rows = shard.value()->executeQuery(
+        "SELECT termId FROM Enrollments WHERE studentId = ? UNION SELECT termId FROM CourseResults WHERE studentId = ?;", {id, id});
+    if (!rows.has_value()) return std::unexpected(rows.error());
+    std::vector<std::string> termIds;
+    termIds.reserve(rows->size());
+    for (const auto& row : rows.value()) {
+        termIds.push_back(SqlParserUtils::getOptional<std::string>(row, "termId"));
+    }
+    auto open = _router->ensureTermsOpen(termIds, ErrorCode::COURSE_ENROLLMENT_CLOSED, "A record of Student " + id);
+    if (!open.has_value()) return open;
+
+    // Xoá dữ liệu shard trước: nếu xoá trước dòng chính thì StudentShards mất theo và các dòng shard còn sót
+    // không còn đường nào tìm tới. Ngược lại, sinh viên còn lại mà không có dữ liệu shard vẫn xoá lại được.
+    auto purged = _router->purgeStudent(id, shardKey.value());
+    if (!purged.has_value()) return purged;
+    auto removed = _mainDao.remove(id);
+    if (!removed.has_value()) {
+        LOG_ERROR("SqlShardedStudentDao: Shard rows of Student " + id + " were purged but the student was not removed: " + removed.error().message);
+    }
+    return removed;
+}
+
+std::expected<bool, Error> SqlShardedStudentDao::exists(const std::string& id) const {
+    return _mainDao.exists(id);
+}
+
+std::expected<std::vector<Student>, Error> SqlShardedStudentDao::findByFacultyId(const std::string& facultyId) const {
+    return _mainDao.findByFacultyId(facultyId);
+}
+
+std::expected<Student, Error> SqlShardedStudentDao::findByEmail(const std::string& email) const {
+    return _mainDao.findByEmail(email);
+}
+
+std::expected<std::vector<Student>, Error> SqlShardedStudentDao::findByStatus(LoginStatus status) const {
+    return _mainDao.findByStatus(status);
+}
+
+std::expected<bool, Error> SqlShardedStudentDao::updateStatus(const std::string& studentId, LoginStatus newStatus) {
+    return _mainDao.updateStatus(studentId, newStatus);
+}
@@ -0,0 +1,66 @@
+#ifndef SQLSHARDEDSTUDENTDAO_H
+#define SQLSHARDEDSTUDENTDAO_H
+
+/**
+ * @file SqlShardedStudentDao.h
+ * @brief Student data access object that keeps the faculty shards in step with the main database
+ */
+
+#include "../interface/IStudentDao.h"
+#include "../../parsing/interface/IEntityParser.h"
+#include "SqlShardRouter.h"
+#include "SqlStudentDao.h"
+#include <memory>
+
+/**
+ * @class SqlShardedStudentDao
+ * @brief Keeps student rows in the main database and moves or purges their shard rows
+ *
+ * A faculty change moves the student's enrollments, results and fees to the new faculty's shard.
+ * A removal deletes the shard rows, which the main-database cascade cannot reach.
+ */
+class SqlShardedStudentDao : public IStudentDao {
+private:
+    std::shared_ptr<SqlShardRouter> _router; ///< Router to the shard of each student
+    SqlStudentDao _mainDao; ///< Student DAO over the main database
+
+public:
+    /**
+     * @brief Constructor for SqlShardedStudentDao
+     * @param router Router to the faculty shards
+     * @param parser Entity parser for converting database results to Student objects
+     * @throws std::invalid_argument if router or parser is null
+     */
+    SqlShardedStudentDao(std::shared_ptr<SqlShardRouter> router,
+                         std::shared_ptr<IEntityParser<Student, DbQueryResultRow>> parser);
+
+    ~SqlShardedStudentDao() override = default;
+
+    std::expected<Student, Error> getById(const std::string& id) const override;
+    std::expected<std::vector<Student>, Error> getAll() const override;
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Student&)>& visitor) const override;
+    std::expected<Student, Error> add(const Student& student) override;
+    std::expected<bool, Error> addBatch(const std::vector<Student>& students) override;
+
+    /**
+     * @brief Updates the student and moves their shard rows when the faculty changes
+     *
+     * A failed move is logged and left for later: the directory still routes to the old shard.
+     */
+    std::expected<bool, Error> update(const Student& student) override;
+
+    /**
+     * @brief Removes the student and their shard rows; rejected while any of those rows is in a closed term
+     *
+     * Shard rows are purged before the main row, whose deletion cascades to the StudentShards entry
+     * that locates them.
+     */
+    std::expected<bool, Error> remove(const std::string& id) override;
+    std::expected<bool, Error> exists(const std::string& id) const override;
+    std::expected<std::vector<Student>, Error> findByFacultyId(const std::string& facultyId) const override;
+    std::expected<Student, Error> findByEmail(const std::string& email) const override;
+    std::expected<std::vector<Student>, Error> findByStatus(LoginStatus status) const override;
+    std::expected<bool, Error> updateStatus(const std::string& studentId, LoginStatus newStatus) override;
+};
+
+#endif // SQLSHARDEDSTUDENTDAO_H
@@ -0,0 +1,112 @@
+#include "SqlStudentArchiveDao.h"
+#include "../../../common/LoginStatus.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string ARCHIVE = IDatabaseAdapter::ARCHIVE_SCHEMA;
+    const std::string STAGED = "(SELECT studentId FROM main.ArchiveQueue)";
+
+    // Bảng phụ thuộc được chép sang kho lưu trữ: tên bảng, cột khóa sinh viên, danh sách cột
+    struct ArchivedTable {
+        const char* name;
+        const char* studentColumn;
+        const char* columns;
+    };
+    const ArchivedTable ARCHIVED_TABLES[] = {
+        {"Users", "id", "id, firstName, lastName, birthDay, birthMonth, birthYear, address, citizenId, email, phoneNumber, role, status, statusChangedAt"},
+        {"Students", "userId", "userId, facultyId"},
+        {"Logins", "userId", "userId, passwordHash, salt"},
+        {"Enrollments", "studentId", "studentId, courseId, enrollmentDate, termId"},
+        {"CourseResults", "studentId", "studentId, courseId, marks, grade, termId"},
+        {"FeeRecords", "studentId", "studentId, totalFee, paidFee"},
+        {"FeePayments", "studentId", "idempotencyKey, studentId, amount, paidAt"},
+        {"FeeInstallments", "studentId", "studentId, sequence, dueDate, amount, paidAmount, isLate"},
+    };
+}
+
+SqlStudentArchiveDao::SqlStudentArchiveDao(std::shared_ptr<IDatabaseAdapter> dbAdapter) : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlStudentArchiveDao.");
+    }
+}
+
+bool SqlStudentArchiveDao::isAvailable() const {
+    return _dbAdapter->hasArchive();
+}
+
+std::expected<std::vector<std::string>, Error> SqlStudentArchiveDao::findDisabledStudentIds(const std::string& disabledOnOrBefore,
+                                                                                          std::size_t limit) const {
+    std::string sql = "SELECT U.id FROM Users U JOIN Students S ON S.userId = U.id "
+                      "WHERE U.status = ? AND U.statusChangedAt <= ? ORDER BY U.id LIMIT ?;";
+    auto queryResult = _dbAdapter->executeQuery(sql, {static_cast<int>(LoginStatus::DISABLED), disabledOnOrBefore,
+                                                      static_cast<long long>(limit)});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<std::string> studentIds;
+    studentIds.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            studentIds.push_back(std::any_cast<std::string>(row.at("id")));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse student id: ") + e.what()});
+    }
+    return studentIds;
+}
+
+std::expected<bool, Error> SqlStudentArchiveDao::moveStagedStudents() {
+    for (const auto& table : ARCHIVED_TABLES) {
+        std::string sql = "INSERT OR REPLACE INTO " + ARCHIVE + "." + table.name + " (" + table.columns + ") "
+                          "SELECT " + table.columns + " FROM main." + table.name + " WHERE " + table.studentColumn + " IN " + STAGED + ";";
+        auto copied = _dbAdapter->executeUpdate(sql);
+        if (!copied.has_value()) return std::unexpected(copied.error());
+    }
+    // Các bảng phụ thuộc được xóa theo ON DELETE CASCADE; ArchiveQueue cho phép xóa dữ liệu của học kỳ đã đóng
+    auto deleted = _dbAdapter->executeUpdate("DELETE FROM main.Users WHERE id IN " + STAGED + ";");
+    if (!deleted.has_value()) return std::unexpected(deleted.error());
+    auto unstaged = _dbAdapter->executeUpdate("DELETE FROM main.ArchiveQueue;");
+    if (!unstaged.has_value()) return std::unexpected(unstaged.error());
+    return true;
+}
+
+std::expected<std::size_t, Error> SqlStudentArchiveDao::archiveStudents(const std::vector<std::string>& studentIds) {
+    if (!_dbAdapter->hasArchive()) {
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "No archive database is attached."});
+    }
+    if (studentIds.empty()) return 0;
+
+    std::vector<std::vector<DbQueryParam>> paramSets;
+    paramSets.reserve(studentIds.size());
+    for (const auto& studentId : studentIds) paramSets.push_back({studentId});
+
+    auto beginResult = _dbAdapter->beginTransaction();
+    if (!beginResult.has_value()) {
+        return std::unexpected(beginResult.error());
+    }
+    auto fail = [this](const Error& error) -> std::expected<std::size_t, Error> {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(error);
+    };
+
+    // Chỉ nhận ID là sinh viên trong dữ liệu chính; ID trùng hoặc không tồn tại bị bỏ qua
+    auto staged = _dbAdapter->executeBatchUpdate("INSERT OR IGNORE INTO main.ArchiveQueue (studentId) SELECT userId FROM main.Students WHERE userId = ?;",
+                                                 paramSets);
+    if (!staged.has_value()) return fail(staged.error());
+    if (staged.value() > 0) {
+        auto moved = moveStagedStudents();
+        if (!moved.has_value()) return fail(moved.error());
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) return fail(commitResult.error());
+    return static_cast<std::size_t>(staged.value());
+}
+
+std::expected<bool, Error> SqlStudentArchiveDao::isArchived(const std::string& studentId) const {
+    if (!_dbAdapter->hasArchive()) return false;
+    auto queryResult = _dbAdapter->executeQuery("SELECT 1 FROM " + ARCHIVE + ".Students WHERE userId = ? LIMIT 1;", {studentId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return !queryResult.value().empty();
+}
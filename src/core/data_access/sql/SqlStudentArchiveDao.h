@@ -0,0 +1,51 @@
+#ifndef SQLSTUDENTARCHIVEDAO_H
+#define SQLSTUDENTARCHIVEDAO_H
+
+/**
+ * @file SqlStudentArchiveDao.h
+ * @brief SQL implementation of the student archive data access object
+ */
+
+#include "../interface/IStudentArchiveDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlStudentArchiveDao
+ * @brief Moves students and their dependent rows into the database attached as IDatabaseAdapter::ARCHIVE_SCHEMA
+ *
+ * Each batch is copied into the archive tables and then deleted from Users, letting the ON DELETE CASCADE
+ * foreign keys remove the dependent rows. The ids of the batch are staged in ArchiveQueue so the closed-term
+ * triggers let the cascade through; the whole batch runs in one transaction spanning both databases.
+ */
+class SqlStudentArchiveDao : public IStudentArchiveDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+    /**
+     * @brief Copies, deletes and unstages the students staged in ArchiveQueue (called inside the transaction)
+     */
+    std::expected<bool, Error> moveStagedStudents();
+
+public:
+    /**
+     * @brief Constructor for SqlStudentArchiveDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlStudentArchiveDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlStudentArchiveDao() override = default;
+
+    bool isAvailable() const override;
+
+    /**
+     * @brief Reads DISABLED students through idx_Users_status
+     */
+    std::expected<std::vector<std::string>, Error> findDisabledStudentIds(const std::string& disabledOnOrBefore,
+                                                                          std::size_t limit) const override;
+    std::expected<std::size_t, Error> archiveStudents(const std::vector<std::string>& studentIds) override;
+    std::expected<bool, Error> isArchived(const std::string& studentId) const override;
+};
+
+#endif // SQLSTUDENTARCHIVEDAO_H
@@ -1,6 +1,25 @@
 #include "SqlStudentDao.h"
 #include <vector> // For std::vector
 #include <stdexcept> // For std::invalid_argument
+#include "SqlDaoUtils.h"
+
+namespace {
+    const std::string SELECT_ALL_SQL = "SELECT U.id as userId, U.firstName, U.lastName, U.birthDay, U.birthMonth, U.birthYear, "
+                                       "U.address, U.citizenId, U.email, U.phoneNumber, U.role, U.status, S.facultyId "
+                                       "FROM Users U JOIN Students S ON U.id = S.userId;";
+    const std::string INSERT_USER_SQL = "INSERT INTO Users (id, firstName, lastName, birthDay, birthMonth, birthYear, address, citizenId, email, phoneNumber, role, status) "
+                                        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+    const std::string INSERT_STUDENT_SQL = "INSERT INTO Students (userId, facultyId) VALUES (?, ?);";
+    const std::size_t USER_PARAM_COUNT = 12; // Số tham số bảng Users ở đầu StudentSqlParser::toQueryInsertParams
+
+    // Sinh viên đã lưu trữ có cùng bảng Users/Students trong schema lưu trữ
+    std::string selectByIdSql(const std::string& schema) {
+        return "SELECT U.id as userId, U.firstName, U.lastName, U.birthDay, U.birthMonth, U.birthYear, "
+               "U.address, U.citizenId, U.email, U.phoneNumber, U.role, U.status, S.facultyId "
+               "FROM " + schema + ".Users U JOIN " + schema + ".Students S ON U.id = S.userId "
+               "WHERE U.id = ?;";
+    }
+}
 
 SqlStudentDao::SqlStudentDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                              std::shared_ptr<IEntityParser<Student, DbQueryResultRow>> parser)
@@ -14,14 +33,10 @@ SqlStudentDao::SqlStudentDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
 }
 
 std::expected<Student, Error> SqlStudentDao::getById(const std::string& id) const {
-    // JOIN Users và Students tables
-    std::string sql = "SELECT U.id as userId, U.firstName, U.lastName, U.birthDay, U.birthMonth, U.birthYear, "
-                      "U.address, U.citizenId, U.email, U.phoneNumber, U.role, U.status, S.facultyId "
-                      "FROM Users U JOIN Students S ON U.id = S.userId "
-                      "WHERE U.id = ?;";
+    // JOIN Users và Students tables; không thấy thì tìm trong kho lưu trữ
     std::vector<DbQueryParam> params = {id};
 
-    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    auto queryResult = SqlDaoUtils::queryWithArchiveFallback(*_dbAdapter, selectByIdSql, params);
     if (!queryResult.has_value()) {
         return std::unexpected(queryResult.error());
     }
@@ -34,9 +49,7 @@ std::expected<Student, Error> SqlStudentDao::getById(const std::string& id) cons
 }
 
 std::expected<std::vector<Student>, Error> SqlStudentDao::getAll() const {
-    std::string sql = "SELECT U.id as userId, U.firstName, U.lastName, U.birthDay, U.birthMonth, U.birthYear, "
-                      "U.address, U.citizenId, U.email, U.phoneNumber, U.role, U.status, S.facultyId "
-                      "FROM Users U JOIN Students S ON U.id = S.userId;";
+    const std::string& sql = SELECT_ALL_SQL;
     
     auto queryResult = _dbAdapter->executeQuery(sql);
     if (!queryResult.has_value()) {
@@ -55,6 +68,10 @@ std::expected<std::vector<Student>, Error> SqlStudentDao::getAll() const {
     return students;
 }
 
+std::expected<std::size_t, Error> SqlStudentDao::forEach(const std::function<bool(const Student&)>& visitor) const {
+    return SqlDaoUtils::streamEntities<Student>(*_dbAdapter, SELECT_ALL_SQL, {}, *_parser, visitor, "students");
+}
+
 std::expected<Student, Error> SqlStudentDao::add(const Student& student) {
     ValidationResult vr = student.validateBasic();
     if (!vr.isValid) {
@@ -73,9 +90,6 @@ std::expected<Student, Error> SqlStudentDao::add(const Student& student) {
     }
 
     // 1. Insert vào bảng Users
-    std::string userSql = "INSERT INTO Users (id, firstName, lastName, birthDay, birthMonth, birthYear, address, citizenId, email, phoneNumber, role, status) "
-                          "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
-    
     auto userParamsResult = _parser->toQueryInsertParams(student); // Parser sẽ trả về đủ params cho cả Users và Students
     if (!userParamsResult.has_value()) {
         _dbAdapter->rollbackTransaction();
@@ -83,10 +97,10 @@ std::expected<Student, Error> SqlStudentDao::add(const Student& student) {
     }
     const auto& allParams = userParamsResult.value();
     // Lấy các tham số cho bảng Users (12 tham số đầu tiên theo StudentSqlParser::toQueryInsertParams)
-    std::vector<DbQueryParam> userInsertParams(allParams.begin(), allParams.begin() + 12);
+    std::vector<DbQueryParam> userInsertParams(allParams.begin(), allParams.begin() + USER_PARAM_COUNT);
 
 
-    auto userExecResult = _dbAdapter->executeUpdate(userSql, userInsertParams);
+    auto userExecResult = _dbAdapter->executeUpdate(INSERT_USER_SQL, userInsertParams);
     if (!userExecResult.has_value()) {
         _dbAdapter->rollbackTransaction();
         return std::unexpected(userExecResult.error());
@@ -97,12 +111,11 @@ std::expected<Student, Error> SqlStudentDao::add(const Student& student) {
     }
 
     // 2. Insert vào bảng Students
-    std::string studentSql = "INSERT INTO Students (userId, facultyId) VALUES (?, ?);";
     // Lấy tham số cho bảng Students (tham số cuối từ allParams là facultyId, userId là student.getId())
     std::vector<DbQueryParam> studentInsertParams = {student.getId(), allParams.back()};
 
 
-    auto studentExecResult = _dbAdapter->executeUpdate(studentSql, studentInsertParams);
+    auto studentExecResult = _dbAdapter->executeUpdate(INSERT_STUDENT_SQL, studentInsertParams);
     if (!studentExecResult.has_value()) {
         _dbAdapter->rollbackTransaction();
         return std::unexpected(studentExecResult.error());
@@ -122,6 +135,56 @@ std::expected<Student, Error> SqlStudentDao::add(const Student& student) {
     return student;
 }
 
+std::expected<bool, Error> SqlStudentDao::addBatch(const std::vector<Student>& students) {
+    if (students.empty()) return true;
+
+    std::vector<std::vector<DbQueryParam>> userParamSets;
+    std::vector<std::vector<DbQueryParam>> studentParamSets;
+    userParamSets.reserve(students.size());
+    studentParamSets.reserve(students.size());
+    for (const auto& student : students) {
+        ValidationResult vr = student.validateBasic();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid Student data for " + student.getId() + ": " + vr.getErrorMessagesCombined()});
+        }
+        auto paramsResult = _parser->toQueryInsertParams(student);
+        if (!paramsResult.has_value()) {
+            return std::unexpected(paramsResult.error());
+        }
+        auto& allParams = paramsResult.value();
+        studentParamSets.push_back({student.getId(), allParams.back()});
+        allParams.resize(USER_PARAM_COUNT);
+        userParamSets.push_back(std::move(allParams));
+    }
+
+    // Email/CCCD trùng bị ràng buộc UNIQUE của bảng Users chặn lại và cả lô được rollback
+    auto transResult = _dbAdapter->beginTransaction();
+    if (!transResult.has_value()) {
+        return std::unexpected(transResult.error());
+    }
+    auto userExecResult = _dbAdapter->executeBatchUpdate(INSERT_USER_SQL, userParamSets);
+    if (!userExecResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(userExecResult.error());
+    }
+    auto studentExecResult = _dbAdapter->executeBatchUpdate(INSERT_STUDENT_SQL, studentParamSets);
+    if (!studentExecResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(studentExecResult.error());
+    }
+    if (userExecResult.value() != static_cast<long>(students.size()) || studentExecResult.value() != static_cast<long>(students.size())) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Failed to add students, expected " + std::to_string(students.size()) +
+                                     " rows but fewer were inserted."});
+    }
+    auto commitResult = _dbAdapter->commitTransaction();
+    if (!commitResult.has_value()) {
+        _dbAdapter->rollbackTransaction();
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
+
 std::expected<bool, Error> SqlStudentDao::update(const Student& student) {
     ValidationResult vr = student.validateBasic();
     if (!vr.isValid) {
@@ -198,7 +261,9 @@ std::expected<bool, Error> SqlStudentDao::remove(const std::string& id) {
 
     auto execResult = _dbAdapter->executeUpdate(sql, params);
     if (!execResult.has_value()) {
-        return std::unexpected(execResult.error());
+        // Trigger học kỳ đã đóng của Enrollments/CourseResults chặn cascade
+        return std::unexpected(SqlDaoUtils::mapClosedTermError(execResult.error(), ErrorCode::COURSE_ENROLLMENT_CLOSED,
+                                                               "A record of Student " + id));
     }
     if (execResult.value() == 0) {
         return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student with ID " + id + " not found for removal."});
@@ -207,9 +272,11 @@ std::expected<bool, Error> SqlStudentDao::remove(const std::string& id) {
 }
 
 std::expected<bool, Error> SqlStudentDao::exists(const std::string& id) const {
-    std::string sql = "SELECT 1 FROM Users U JOIN Students S ON U.id = S.userId WHERE U.id = ? LIMIT 1;";
+    // Mã của sinh viên đã lưu trữ vẫn được tính là đã dùng
     std::vector<DbQueryParam> params = {id};
-    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    auto queryResult = SqlDaoUtils::queryWithArchiveFallback(*_dbAdapter, [](const std::string& schema) {
+        return "SELECT 1 FROM " + schema + ".Users U JOIN " + schema + ".Students S ON U.id = S.userId WHERE U.id = ? LIMIT 1;";
+    }, params);
     if (!queryResult.has_value()) {
         return std::unexpected(queryResult.error());
     }
@@ -50,6 +50,13 @@ public:
      * @return Danh sách các đối tượng Student nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<std::vector<Student>, Error> getAll() const override;
+
+    /**
+     * @brief Duyệt tất cả sinh viên theo luồng, không gom toàn bộ bảng vào bộ nhớ
+     * @param visitor Hàm xử lý từng sinh viên; trả về false để dừng duyệt
+     * @return Số sinh viên đã chuyển cho visitor, hoặc Error nếu truy vấn/phân tích thất bại
+     */
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Student&)>& visitor) const override;
     
     /**
      * @brief Thêm sinh viên mới
@@ -57,6 +64,15 @@ public:
      * @return Đối tượng Student đã thêm nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<Student, Error> add(const Student& student) override;
+
+    /**
+     * @brief Thêm nhiều sinh viên trong một giao dịch
+     *
+     * Mỗi bảng (Users, Students) được ghi bằng một câu lệnh chuẩn bị sẵn dùng lại cho cả lô.
+     * @param students Danh sách sinh viên cần thêm
+     * @return true nếu toàn bộ được thêm, hoặc Error nếu thất bại (giao dịch bị hoàn tác)
+     */
+    std::expected<bool, Error> addBatch(const std::vector<Student>& students) override;
     
     /**
      * @brief Cập nhật thông tin sinh viên
@@ -68,7 +84,8 @@ public:
     /**
      * @brief Xóa sinh viên theo ID
      * @param id ID của sinh viên cần xóa
-     * @return true nếu thành công, hoặc Error nếu thất bại
+     * @return true nếu thành công, hoặc Error nếu thất bại (COURSE_ENROLLMENT_CLOSED nếu sinh viên có
+     *         đăng ký hoặc kết quả thuộc học kỳ đã đóng)
      */
     std::expected<bool, Error> remove(const std::string& id) override;
     
@@ -1,6 +1,14 @@
 #include "SqlTeacherDao.h"
 #include <vector>
 #include <stdexcept>
+#include "SqlDaoUtils.h"
+
+namespace {
+    const std::string SELECT_ALL_SQL = "SELECT U.id as userId, U.firstName, U.lastName, U.birthDay, U.birthMonth, U.birthYear, "
+                                       "U.address, U.citizenId, U.email, U.phoneNumber, U.role, U.status, "
+                                       "T.facultyId, T.qualification, T.specializationSubjects, T.designation, T.experienceYears "
+                                       "FROM Users U JOIN Teachers T ON U.id = T.userId;";
+}
 
 SqlTeacherDao::SqlTeacherDao(std::shared_ptr<IDatabaseAdapter> dbAdapter,
                              std::shared_ptr<IEntityParser<Teacher, DbQueryResultRow>> parser)
@@ -34,10 +42,7 @@ std::expected<Teacher, Error> SqlTeacherDao::getById(const std::string& id) cons
 }
 
 std::expected<std::vector<Teacher>, Error> SqlTeacherDao::getAll() const {
-    std::string sql = "SELECT U.id as userId, U.firstName, U.lastName, U.birthDay, U.birthMonth, U.birthYear, "
-                      "U.address, U.citizenId, U.email, U.phoneNumber, U.role, U.status, "
-                      "T.facultyId, T.qualification, T.specializationSubjects, T.designation, T.experienceYears "
-                      "FROM Users U JOIN Teachers T ON U.id = T.userId;";
+    const std::string& sql = SELECT_ALL_SQL;
     
     auto queryResult = _dbAdapter->executeQuery(sql);
     if (!queryResult.has_value()) {
@@ -56,6 +61,10 @@ std::expected<std::vector<Teacher>, Error> SqlTeacherDao::getAll() const {
     return teachers;
 }
 
+std::expected<std::size_t, Error> SqlTeacherDao::forEach(const std::function<bool(const Teacher&)>& visitor) const {
+    return SqlDaoUtils::streamEntities<Teacher>(*_dbAdapter, SELECT_ALL_SQL, {}, *_parser, visitor, "teachers");
+}
+
 std::expected<Teacher, Error> SqlTeacherDao::add(const Teacher& teacher) {
      ValidationResult vr = teacher.validateBasic();
     if (!vr.isValid) {
@@ -50,6 +50,13 @@ public:
      * @return Danh sách các đối tượng Teacher nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<std::vector<Teacher>, Error> getAll() const override;
+
+    /**
+     * @brief Duyệt tất cả giảng viên theo luồng, không gom toàn bộ bảng vào bộ nhớ
+     * @param visitor Hàm xử lý từng giảng viên; trả về false để dừng duyệt
+     * @return Số giảng viên đã chuyển cho visitor, hoặc Error nếu truy vấn/phân tích thất bại
+     */
+    std::expected<std::size_t, Error> forEach(const std::function<bool(const Teacher&)>& visitor) const override;
     
     /**
      * @brief Thêm giáo viên mới
@@ -0,0 +1,80 @@
+#include "SqlTermDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string SELECT_COLUMNS = "SELECT id, name, startDate, endDate, closed FROM Terms ";
+}
+
+SqlTermDao::SqlTermDao(std::shared_ptr<IDatabaseAdapter> dbAdapter) : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlTermDao.");
+    }
+}
+
+std::expected<std::vector<AcademicTerm>, Error> SqlTermDao::queryTerms(const std::string& sql, const std::vector<DbQueryParam>& params) const {
+    auto queryResult = _dbAdapter->executeQuery(sql, params);
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    std::vector<AcademicTerm> terms;
+    terms.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            terms.push_back(AcademicTerm{std::any_cast<std::string>(row.at("id")), std::any_cast<std::string>(row.at("name")),
+                                         std::any_cast<std::string>(row.at("startDate")), std::any_cast<std::string>(row.at("endDate")),
+                                         std::any_cast<long long>(row.at("closed")) != 0});
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse term: ") + e.what()});
+    }
+    return terms;
+}
+
+std::expected<std::vector<AcademicTerm>, Error> SqlTermDao::getAll() const {
+    return queryTerms(SELECT_COLUMNS + "ORDER BY startDate, id;", {});
+}
+
+std::expected<AcademicTerm, Error> SqlTermDao::findById(const std::string& termId) const {
+    auto terms = queryTerms(SELECT_COLUMNS + "WHERE id = ?;", {termId});
+    if (!terms.has_value()) return std::unexpected(terms.error());
+    if (terms->empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Term " + termId + " not found."});
+    }
+    return terms->front();
+}
+
+std::expected<AcademicTerm, Error> SqlTermDao::findCurrent(const std::string& today) const {
+    auto terms = queryTerms(SELECT_COLUMNS + "WHERE closed = 0 AND startDate <= ? ORDER BY startDate DESC LIMIT 1;", {today});
+    if (!terms.has_value()) return std::unexpected(terms.error());
+    if (terms->empty()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "No open term has started by " + today + "."});
+    }
+    return terms->front();
+}
+
+std::expected<bool, Error> SqlTermDao::add(const AcademicTerm& term) {
+    if (term.id.empty() || term.name.empty() || term.startDate > term.endDate) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid term '" + term.id + "'."});
+    }
+    auto result = _dbAdapter->executeUpdate("INSERT INTO Terms (id, name, startDate, endDate, closed) VALUES (?, ?, ?, ?, 0);",
+                                            {term.id, term.name, term.startDate, term.endDate});
+    if (!result.has_value()) {
+        if (result.error().code == ErrorCode::ALREADY_EXISTS) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Term " + term.id + " already exists."});
+        }
+        return std::unexpected(result.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlTermDao::close(const std::string& termId) {
+    // Điều kiện closed = 0 để học kỳ đã đóng không bị trg_Terms_frozen từ chối
+    auto result = _dbAdapter->executeUpdate("UPDATE Terms SET closed = 1 WHERE id = ? AND closed = 0;", {termId});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    if (result.value() > 0) return true;
+    auto existing = findById(termId);
+    if (!existing.has_value()) return std::unexpected(existing.error());
+    return false;
+}
@@ -0,0 +1,50 @@
+#ifndef SQLTERMDAO_H
+#define SQLTERMDAO_H
+
+/**
+ * @file SqlTermDao.h
+ * @brief SQL implementation of the academic term data access object
+ */
+
+#include "../interface/ITermDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlTermDao
+ * @brief SQL implementation of ITermDao over the Terms table
+ *
+ * Once a term is closed the schema triggers reject any further change to the term and to its
+ * Enrollments/CourseResults rows, so this DAO never has to re-check the flag before a write.
+ */
+class SqlTermDao : public ITermDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+    /**
+     * @brief Runs a SELECT over Terms and converts every row
+     */
+    std::expected<std::vector<AcademicTerm>, Error> queryTerms(const std::string& sql, const std::vector<DbQueryParam>& params) const;
+
+public:
+    /**
+     * @brief Constructor for SqlTermDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlTermDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlTermDao() override = default;
+
+    std::expected<std::vector<AcademicTerm>, Error> getAll() const override;
+    std::expected<AcademicTerm, Error> findById(const std::string& termId) const override;
+
+    /**
+     * @brief Reads the newest started open term through idx_Terms_open
+     */
+    std::expected<AcademicTerm, Error> findCurrent(const std::string& today) const override;
+    std::expected<bool, Error> add(const AcademicTerm& term) override;
+    std::expected<bool, Error> close(const std::string& termId) override;
+};
+
+#endif // SQLTERMDAO_H
@@ -0,0 +1,25 @@
+#include "SqlTransactionManager.h"
+#include <stdexcept> // For std::invalid_argument
+
+SqlTransactionManager::SqlTransactionManager(std::shared_ptr<IDatabaseAdapter> dbAdapter, bool coversAllWrites)
+    : _dbAdapter(std::move(dbAdapter)), _coversAllWrites(coversAllWrites) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlTransactionManager.");
+    }
+}
+
+std::expected<bool, Error> SqlTransactionManager::begin() {
+    return _dbAdapter->beginTransaction();
+}
+
+std::expected<bool, Error> SqlTransactionManager::commit() {
+    return _dbAdapter->commitTransaction();
+}
+
+std::expected<bool, Error> SqlTransactionManager::rollback() {
+    return _dbAdapter->rollbackTransaction();
+}
+
+bool SqlTransactionManager::isTransactional() const {
+    return _coversAllWrites;
+}
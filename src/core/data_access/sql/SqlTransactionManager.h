@@ -0,0 +1,43 @@
+#ifndef SQLTRANSACTIONMANAGER_H
+#define SQLTRANSACTIONMANAGER_H
+
+/**
+ * @file SqlTransactionManager.h
+ * @brief SQL implementation of the shared transaction manager
+ */
+
+#include "../interface/ITransactionManager.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlTransactionManager
+ * @brief Opens transactions on the database adapter shared by every SQL DAO
+ *
+ * The adapter tracks the nesting depth, so a DAO that opens its own transaction inside a
+ * unit of work gets a SAVEPOINT and only the outermost commit reaches the disk.
+ */
+class SqlTransactionManager : public ITransactionManager {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter shared with the DAOs
+    bool _coversAllWrites; ///< False when some DAOs write through other connections (faculty shards)
+
+public:
+    /**
+     * @brief Constructor for SqlTransactionManager
+     * @param dbAdapter Database adapter shared with the DAOs
+     * @param coversAllWrites False when some DAOs write to other database files, so units of work
+     *        also run their compensations on rollback
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlTransactionManager(std::shared_ptr<IDatabaseAdapter> dbAdapter, bool coversAllWrites = true);
+
+    ~SqlTransactionManager() override = default;
+
+    std::expected<bool, Error> begin() override;
+    std::expected<bool, Error> commit() override;
+    std::expected<bool, Error> rollback() override;
+    bool isTransactional() const override;
+};
+
+#endif // SQLTRANSACTIONMANAGER_H
@@ -0,0 +1,74 @@
+#include "SqlTuitionDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string STUDENT_COUNTS_SQL = R"SQL(
+        SELECT COUNT(*) AS studentCount,
+               COUNT(*) - COUNT(R.facultyId) AS unratedCount
+        FROM Students S
+        LEFT JOIN TuitionRates R ON R.facultyId = S.facultyId;
+    )SQL";
+
+    const std::string TUITION_CHANGES_SQL = R"SQL(
+        WITH Credits AS (
+            SELECT E.studentId, SUM(C.credits) AS credits
+            FROM Enrollments E
+            JOIN Courses C ON C.id = E.courseId
+            WHERE ? = '' OR E.termId IS NULL OR E.termId = ? -- Học kỳ đang tính và các đăng ký chưa gán học kỳ
+            GROUP BY E.studentId
+        ), Assessed AS (
+            SELECT S.userId AS studentId, S.facultyId,
+                   COALESCE(Cr.credits, 0) AS credits,
+                   COALESCE(Cr.credits, 0) * R.ratePerCredit AS newTotalFee
+            FROM Students S
+            JOIN TuitionRates R ON R.facultyId = S.facultyId
+            LEFT JOIN Credits Cr ON Cr.studentId = S.userId
+        )
+        SELECT A.studentId, A.facultyId, A.credits, A.newTotalFee,
+               F.totalFee AS previousTotalFee, COALESCE(F.paidFee, 0) AS paidFee
+        FROM Assessed A
+        LEFT JOIN FeeRecords F ON F.studentId = A.studentId
+        WHERE (F.studentId IS NULL AND A.newTotalFee > 0) OR F.totalFee <> A.newTotalFee
+        ORDER BY A.studentId;
+    )SQL";
+}
+
+SqlTuitionDao::SqlTuitionDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlTuitionDao.");
+    }
+}
+
+std::expected<TuitionAssessment, Error> SqlTuitionDao::assessTuition(const std::string& termId) const {
+    auto countResult = _dbAdapter->executeQuery(STUDENT_COUNTS_SQL);
+    if (!countResult.has_value()) {
+        return std::unexpected(countResult.error());
+    }
+    auto changeResult = _dbAdapter->executeQuery(TUITION_CHANGES_SQL, {termId, termId});
+    if (!changeResult.has_value()) {
+        return std::unexpected(changeResult.error());
+    }
+
+    TuitionAssessment assessment;
+    assessment.changes.reserve(changeResult->size());
+    try {
+        const auto& counts = countResult->front();
+        assessment.studentCount = static_cast<std::size_t>(std::any_cast<long long>(counts.at("studentCount")));
+        assessment.unratedCount = static_cast<std::size_t>(std::any_cast<long long>(counts.at("unratedCount")));
+        for (const auto& row : changeResult.value()) {
+            TuitionChange change;
+            change.studentId = std::any_cast<std::string>(row.at("studentId"));
+            change.facultyId = std::any_cast<std::string>(row.at("facultyId"));
+            change.credits = static_cast<long>(std::any_cast<long long>(row.at("credits")));
+            change.newTotalFee = static_cast<long>(std::any_cast<long long>(row.at("newTotalFee")));
+            const std::any& previous = row.at("previousTotalFee");
+            if (previous.has_value()) change.previousTotalFee = static_cast<long>(std::any_cast<long long>(previous));
+            change.paidFee = static_cast<long>(std::any_cast<long long>(row.at("paidFee")));
+            assessment.changes.push_back(std::move(change));
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse tuition assessment: ") + e.what()});
+    }
+    return assessment;
+}
@@ -0,0 +1,36 @@
+#ifndef SQLTUITIONDAO_H
+#define SQLTUITIONDAO_H
+
+/**
+ * @file SqlTuitionDao.h
+ * @brief SQL implementation of the credit-based tuition assessment
+ */
+
+#include "../interface/ITuitionDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlTuitionDao
+ * @brief Computes tuition with one query joining Enrollments, Courses, TuitionRates and FeeRecords
+ *
+ * Only rows whose computed total differs from the stored FeeRecords.totalFee leave the database.
+ */
+class SqlTuitionDao : public ITuitionDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlTuitionDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlTuitionDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlTuitionDao() override = default;
+
+    std::expected<TuitionAssessment, Error> assessTuition(const std::string& termId) const override;
+};
+
+#endif // SQLTUITIONDAO_H
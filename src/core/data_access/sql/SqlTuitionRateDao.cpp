@@ -0,0 +1,52 @@
+#include "SqlTuitionRateDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+SqlTuitionRateDao::SqlTuitionRateDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlTuitionRateDao.");
+    }
+}
+
+std::expected<std::vector<TuitionRate>, Error> SqlTuitionRateDao::getAll() const {
+    auto queryResult = _dbAdapter->executeQuery("SELECT facultyId, ratePerCredit FROM TuitionRates ORDER BY facultyId;");
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+
+    std::vector<TuitionRate> rates;
+    rates.reserve(queryResult->size());
+    try {
+        for (const auto& row : queryResult.value()) {
+            rates.push_back(TuitionRate{std::any_cast<std::string>(row.at("facultyId")),
+                                        static_cast<long>(std::any_cast<long long>(row.at("ratePerCredit")))});
+        }
+    } catch (const std::exception& e) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse tuition rate: ") + e.what()});
+    }
+    return rates;
+}
+
+std::expected<bool, Error> SqlTuitionRateDao::upsert(const TuitionRate& rate) {
+    if (rate.facultyId.empty() || rate.ratePerCredit < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Tuition rate requires a faculty ID and a non-negative rate."});
+    }
+    std::string sql = "INSERT INTO TuitionRates (facultyId, ratePerCredit) VALUES (?, ?) "
+                      "ON CONFLICT(facultyId) DO UPDATE SET ratePerCredit = excluded.ratePerCredit;";
+    auto result = _dbAdapter->executeUpdate(sql, {rate.facultyId, rate.ratePerCredit});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlTuitionRateDao::remove(const std::string& facultyId) {
+    auto result = _dbAdapter->executeUpdate("DELETE FROM TuitionRates WHERE facultyId = ?;", {facultyId});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    if (result.value() == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Tuition rate for faculty " + facultyId + " not found."});
+    }
+    return true;
+}
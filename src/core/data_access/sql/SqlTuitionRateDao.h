@@ -0,0 +1,36 @@
+#ifndef SQLTUITIONRATEDAO_H
+#define SQLTUITIONRATEDAO_H
+
+/**
+ * @file SqlTuitionRateDao.h
+ * @brief SQL implementation of the per-faculty tuition rate data access object
+ */
+
+#include "../interface/ITuitionRateDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlTuitionRateDao
+ * @brief SQL implementation of ITuitionRateDao over the TuitionRates table
+ */
+class SqlTuitionRateDao : public ITuitionRateDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlTuitionRateDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlTuitionRateDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlTuitionRateDao() override = default;
+
+    std::expected<std::vector<TuitionRate>, Error> getAll() const override;
+    std::expected<bool, Error> upsert(const TuitionRate& rate) override;
+    std::expected<bool, Error> remove(const std::string& facultyId) override;
+};
+
+#endif // SQLTUITIONRATEDAO_H
@@ -0,0 +1,78 @@
+#include "SqlWaitlistDao.h"
+#include <stdexcept> // For std::invalid_argument
+
+namespace {
+    const std::string SELECT_COLUMNS = "SELECT courseId, studentId, priorityClass, requestedAt FROM Waitlist ";
+
+    std::expected<std::vector<WaitlistEntry>, Error> parseEntries(const DbQueryResultTable& rows) {
+        std::vector<WaitlistEntry> entries;
+        entries.reserve(rows.size());
+        try {
+            for (const auto& row : rows) {
+                WaitlistEntry entry;
+                entry.courseId = std::any_cast<std::string>(row.at("courseId"));
+                entry.studentId = std::any_cast<std::string>(row.at("studentId"));
+                entry.priorityClass = static_cast<int>(std::any_cast<long long>(row.at("priorityClass")));
+                entry.requestedAt = std::any_cast<long long>(row.at("requestedAt"));
+                entries.push_back(std::move(entry));
+            }
+        } catch (const std::exception& e) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, std::string("Failed to parse waitlist entry: ") + e.what()});
+        }
+        return entries;
+    }
+}
+
+SqlWaitlistDao::SqlWaitlistDao(std::shared_ptr<IDatabaseAdapter> dbAdapter)
+    : _dbAdapter(std::move(dbAdapter)) {
+    if (!_dbAdapter) {
+        throw std::invalid_argument("Database adapter cannot be null for SqlWaitlistDao.");
+    }
+}
+
+std::expected<bool, Error> SqlWaitlistDao::add(const WaitlistEntry& entry) {
+    if (entry.priorityClass < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Waitlist priority class cannot be negative."});
+    }
+    auto result = _dbAdapter->executeUpdate(
+        "INSERT INTO Waitlist (courseId, studentId, priorityClass, requestedAt) VALUES (?, ?, ?, ?);",
+        {entry.courseId, entry.studentId, entry.priorityClass, entry.requestedAt});
+    if (!result.has_value()) {
+        if (result.error().code == ErrorCode::ALREADY_EXISTS) {
+            return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + entry.studentId + " is already waitlisted for course " + entry.courseId + "."});
+        }
+        if (result.error().code == ErrorCode::DB_FOREIGN_KEY_ERROR) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + entry.studentId + " or course " + entry.courseId + " not found."});
+        }
+        return std::unexpected(result.error());
+    }
+    return true;
+}
+
+std::expected<bool, Error> SqlWaitlistDao::remove(const std::string& courseId, const std::string& studentId) {
+    auto result = _dbAdapter->executeUpdate("DELETE FROM Waitlist WHERE courseId = ? AND studentId = ?;", {courseId, studentId});
+    if (!result.has_value()) {
+        return std::unexpected(result.error());
+    }
+    if (result.value() == 0) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " is not waitlisted for course " + courseId + "."});
+    }
+    return true;
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> SqlWaitlistDao::getByCourse(const std::string& courseId) const {
+    auto queryResult = _dbAdapter->executeQuery(
+        SELECT_COLUMNS + "WHERE courseId = ? ORDER BY priorityClass, requestedAt, studentId;", {courseId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return parseEntries(queryResult.value());
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> SqlWaitlistDao::getByStudent(const std::string& studentId) const {
+    auto queryResult = _dbAdapter->executeQuery(SELECT_COLUMNS + "WHERE studentId = ? ORDER BY courseId;", {studentId});
+    if (!queryResult.has_value()) {
+        return std::unexpected(queryResult.error());
+    }
+    return parseEntries(queryResult.value());
+}
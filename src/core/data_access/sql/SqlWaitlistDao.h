@@ -0,0 +1,40 @@
+#ifndef SQLWAITLISTDAO_H
+#define SQLWAITLISTDAO_H
+
+/**
+ * @file SqlWaitlistDao.h
+ * @brief SQL implementation of the course waitlist data access object
+ */
+
+#include "../interface/IWaitlistDao.h"
+#include "../../database_adapter/interface/IDatabaseAdapter.h"
+#include <memory>
+
+/**
+ * @class SqlWaitlistDao
+ * @brief SQL implementation of IWaitlistDao over the Waitlist table
+ *
+ * The (courseId, priorityClass, requestedAt, studentId) index returns a course's queue already
+ * in waiting order; the primary key (courseId, studentId) rejects duplicate requests.
+ */
+class SqlWaitlistDao : public IWaitlistDao {
+private:
+    std::shared_ptr<IDatabaseAdapter> _dbAdapter; ///< Database adapter for executing SQL queries
+
+public:
+    /**
+     * @brief Constructor for SqlWaitlistDao
+     * @param dbAdapter Database adapter for executing SQL queries
+     * @throws std::invalid_argument if dbAdapter is null
+     */
+    explicit SqlWaitlistDao(std::shared_ptr<IDatabaseAdapter> dbAdapter);
+
+    ~SqlWaitlistDao() override = default;
+
+    std::expected<bool, Error> add(const WaitlistEntry& entry) override;
+    std::expected<bool, Error> remove(const std::string& courseId, const std::string& studentId) override;
+    std::expected<std::vector<WaitlistEntry>, Error> getByCourse(const std::string& courseId) const override;
+    std::expected<std::vector<WaitlistEntry>, Error> getByStudent(const std::string& studentId) const override;
+};
+
+#endif // SQLWAITLISTDAO_H
@@ -15,6 +15,8 @@
 #include <vector>
 #include <map>
 #include <any>
+#include <functional>
+#include <cstddef>
 #include <expected> // Đã thống nhất dùng std::expected
 #include "../../../common/ErrorType.h"
 // AppConfig không cần ở đây nữa nếu connectionString truyền qua connect()
@@ -37,6 +39,12 @@ using DbQueryResultRow = std::map<std::string, std::any>;
  */
 using DbQueryResultTable = std::vector<DbQueryResultRow>;
 
+/**
+ * @typedef DbRowVisitor
+ * @brief Hàm nhận từng hàng kết quả khi truy vấn theo luồng; trả về false để dừng sớm
+ */
+using DbRowVisitor = std::function<bool(const DbQueryResultRow&)>;
+
 /**
  * @class IDatabaseAdapter
  * @brief Giao diện cơ sở cho bộ điều hợp cơ sở dữ liệu
@@ -47,6 +55,8 @@ using DbQueryResultTable = std::vector<DbQueryResultRow>;
  */
 class IDatabaseAdapter {
 public:
+    static constexpr const char* ARCHIVE_SCHEMA = "archive"; ///< Tên schema của cơ sở dữ liệu lưu trữ khi được gắn vào kết nối
+
     /**
      * @brief Hàm hủy ảo mặc định
      */
@@ -80,6 +90,20 @@ public:
      * @return Bảng kết quả hoặc lỗi
      */
     virtual std::expected<DbQueryResultTable, Error> executeQuery(const std::string& sqlQuery, const std::vector<DbQueryParam>& params = {}) = 0;
+
+    /**
+     * @brief Thực hiện truy vấn SELECT và chuyển từng hàng cho hàm xử lý ngay khi đọc được
+     * 
+     * Khác với executeQuery, kết quả không được gom vào bộ nhớ nên dùng được cho các bảng
+     * rất lớn (xuất dữ liệu, duyệt toàn bảng). Hàng truyền cho onRow chỉ hợp lệ trong lần gọi đó.
+     * 
+     * @param sqlQuery Câu lệnh SQL truy vấn
+     * @param params Danh sách tham số cho truy vấn
+     * @param onRow Hàm xử lý từng hàng; trả về false để dừng duyệt
+     * @return Số hàng đã chuyển cho onRow hoặc lỗi
+     */
+    virtual std::expected<std::size_t, Error> executeQueryStreaming(const std::string& sqlQuery, const std::vector<DbQueryParam>& params,
+                                                                    const DbRowVisitor& onRow) = 0;
     
     /**
      * @brief Thực hiện truy vấn cập nhật (INSERT, UPDATE, DELETE)
@@ -90,6 +114,19 @@ public:
      */
     virtual std::expected<long, Error> executeUpdate(const std::string& sqlQuery, const std::vector<DbQueryParam>& params = {}) = 0;
 
+    /**
+     * @brief Thực hiện cùng một câu lệnh cập nhật cho nhiều bộ tham số
+     * 
+     * Câu lệnh chỉ được chuẩn bị một lần rồi gắn lại tham số cho từng bộ.
+     * Phương thức không tự mở giao dịch; nếu cần "tất cả hoặc không có gì",
+     * nơi gọi phải bao quanh bằng beginTransaction/commitTransaction.
+     * 
+     * @param sqlQuery Câu lệnh SQL cập nhật
+     * @param paramSets Danh sách các bộ tham số, mỗi bộ ứng với một lần thực thi
+     * @return Tổng số hàng bị ảnh hưởng hoặc lỗi (dừng ở bộ tham số lỗi đầu tiên)
+     */
+    virtual std::expected<long, Error> executeBatchUpdate(const std::string& sqlQuery, const std::vector<std::vector<DbQueryParam>>& paramSets) = 0;
+
     /**
      * @brief Bắt đầu một giao dịch
      * @return Kết quả thành công hoặc lỗi
@@ -103,6 +140,14 @@ public:
     virtual std::expected<bool, Error> commitTransaction() = 0;
     virtual std::expected<bool, Error> rollbackTransaction() = 0;
     virtual bool isInTransaction() const = 0; // (➕) Kiểm tra xem có đang trong transaction không
+
+    /**
+     * @brief Kiểm tra cơ sở dữ liệu lưu trữ đã được gắn vào kết nối dưới tên ARCHIVE_SCHEMA hay chưa
+     * 
+     * DAO dùng giá trị này để đọc lại từ kho lưu trữ khi không tìm thấy dữ liệu trong cơ sở dữ liệu chính.
+     * @return true nếu đã gắn, false nếu không dùng kho lưu trữ
+     */
+    virtual bool hasArchive() const { return false; }
 };
 
 #endif
\ No newline at end of file
@@ -8,9 +8,34 @@
 #include "../../../common/UserRole.h"     // (QUAN TRỌNG)
 #include "../../../common/LoginStatus.h"  // (QUAN TRỌNG)
 
+namespace {
+    /**
+     * @brief Một cột được thêm vào bảng sau khi bảng đã có trong các cơ sở dữ liệu đang dùng
+     */
+    struct ColumnUpgrade {
+        const char* table;      ///< Bảng cần thêm cột
+        const char* column;     ///< Tên cột
+        const char* definition; ///< Định nghĩa cột cho ALTER TABLE ADD COLUMN (chỉ được dùng giá trị mặc định hằng)
+        const char* backfill;   ///< Câu lệnh điền dữ liệu cho hàng cũ, nullptr nếu giá trị mặc định là đủ
+    };
+
+    constexpr ColumnUpgrade COLUMN_UPGRADES[] = {
+        {"Courses", "capacity", "capacity INTEGER NOT NULL DEFAULT 0 CHECK(capacity >= 0)", nullptr},
+        {"Courses", "enrolledCount", "enrolledCount INTEGER NOT NULL DEFAULT 0 CHECK(enrolledCount >= 0)",
+         "UPDATE Courses SET enrolledCount = (SELECT COUNT(*) FROM Enrollments WHERE courseId = Courses.id);"},
+        {"Courses", "schedule", "schedule TEXT NOT NULL DEFAULT ''", nullptr},
+        // Hàng cũ giữ termId NULL (chưa gán học kỳ)
+        {"Enrollments", "termId", "termId TEXT REFERENCES Terms(id) ON DELETE RESTRICT ON UPDATE CASCADE", nullptr},
+        {"CourseResults", "termId", "termId TEXT REFERENCES Terms(id) ON DELETE RESTRICT ON UPDATE CASCADE", nullptr},
+        // ALTER TABLE không nhận giá trị mặc định date('now'): hàng cũ bắt đầu tính thời gian lưu trữ từ ngày nâng cấp
+        {"Users", "statusChangedAt", "statusChangedAt TEXT NOT NULL DEFAULT ''",
+         "UPDATE Users SET statusChangedAt = date('now') WHERE statusChangedAt = '';"},
+    };
+}
+
 
 // Constructor và Destructor (giữ nguyên như trước)
-SQLiteAdapter::SQLiteAdapter() : _connector(nullptr), _isConnected(false), _transactionDepth(0) {
+SQLiteAdapter::SQLiteAdapter() : _connector(nullptr), _isConnected(false), _transactionDepth(0), _archiveAttached(false) {
     LOG_DEBUG("SQLiteAdapter: Instance created.");
 }
 
@@ -93,6 +118,7 @@ std::expected<bool, Error> SQLiteAdapter::disconnect() {
     }
     _isConnected = false;
     _transactionDepth = 0; // Reset transaction depth
+    _archiveAttached = false;
     LOG_INFO("SQLiteAdapter: Disconnected from database: " + _dbPath);
     _dbPath.clear();
     return true;
@@ -128,6 +154,9 @@ Error SQLiteAdapter::bindParameters(sqlite3_stmt* stmt, const std::vector<DbQuer
             rc = sqlite3_bind_text(stmt, bind_idx, text_val.c_str(), -1, SQLITE_TRANSIENT);
         } else if (param_any.type() == typeid(bool)) { // (➕) Thêm case cho bool
             rc = sqlite3_bind_int(stmt, bind_idx, std::any_cast<bool>(param_any) ? 1 : 0);
+        } else if (param_any.type() == typeid(std::vector<unsigned char>)) {
+            const auto& blob_val = std::any_cast<const std::vector<unsigned char>&>(param_any);
+            rc = sqlite3_bind_blob(stmt, bind_idx, blob_val.data(), static_cast<int>(blob_val.size()), SQLITE_TRANSIENT);
         }
         else {
             std::string errMsg = "SQLiteAdapter::bindParameters - Unsupported parameter type at index " + std::to_string(i) + " (type: " + param_any.type().name() + ")";
@@ -146,6 +175,19 @@ Error SQLiteAdapter::bindParameters(sqlite3_stmt* stmt, const std::vector<DbQuer
 }
 
 std::expected<DbQueryResultTable, Error> SQLiteAdapter::executeQuery(const std::string& sqlQuery, const std::vector<DbQueryParam>& params) {
+    DbQueryResultTable results;
+    auto streamResult = executeQueryStreaming(sqlQuery, params, [&results](const DbQueryResultRow& row) {
+        results.push_back(row);
+        return true;
+    });
+    if (!streamResult.has_value()) {
+        return std::unexpected(streamResult.error());
+    }
+    return results;
+}
+
+std::expected<std::size_t, Error> SQLiteAdapter::executeQueryStreaming(const std::string& sqlQuery, const std::vector<DbQueryParam>& params,
+                                                                       const DbRowVisitor& onRow) {
     if (!isConnected()) {
         LOG_ERROR("SQLiteAdapter::executeQuery - Not connected to database.");
         return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, "Not connected to database."});
@@ -165,20 +207,31 @@ std::expected<DbQueryResultTable, Error> SQLiteAdapter::executeQuery(const std::
         sqlite3_finalize(stmt);
         return std::unexpected(bindErr);
     }
-    DbQueryResultTable results;
+
+    // Tên cột không đổi giữa các lần step: đọc một lần, và dùng lại cùng một map cho mọi hàng
+    // để các node của map chỉ được cấp phát ở hàng đầu tiên.
+    const int columnCount = sqlite3_column_count(stmt);
+    std::vector<std::string> columnNames(columnCount);
+    std::vector<bool> hasColumnName(columnCount, false);
+    for (int i = 0; i < columnCount; ++i) {
+        const char* columnName_cstr = sqlite3_column_name(stmt, i);
+        if (!columnName_cstr) {
+             LOG_WARN("SQLiteAdapter::executeQuery - NULL column name at index " + std::to_string(i) + " for query: " + sqlQuery);
+             // Có thể gán một tên placeholder hoặc bỏ qua cột này
+             continue; 
+        }
+        columnNames[i] = columnName_cstr;
+        hasColumnName[i] = true;
+    }
+
+    DbQueryResultRow currentRow;
+    std::size_t rowCount = 0;
     int rc_step;
     LOG_DEBUG("SQLiteAdapter::executeQuery - Stepping through results for query: " + sqlQuery);
     while ((rc_step = sqlite3_step(stmt)) == SQLITE_ROW) {
-        DbQueryResultRow currentRow;
-        int columnCount = sqlite3_column_count(stmt);
         for (int i = 0; i < columnCount; ++i) {
-            const char* columnName_cstr = sqlite3_column_name(stmt, i);
-            if (!columnName_cstr) {
-                 LOG_WARN("SQLiteAdapter::executeQuery - NULL column name at index " + std::to_string(i) + " for query: " + sqlQuery);
-                 // Có thể gán một tên placeholder hoặc bỏ qua cột này
-                 continue; 
-            }
-            std::string columnName(columnName_cstr);
+            if (!hasColumnName[i]) continue;
+            const std::string& columnName = columnNames[i];
             int columnType = sqlite3_column_type(stmt, i);
             std::any columnValue;
             switch (columnType) {
@@ -196,12 +249,12 @@ std::expected<DbQueryResultTable, Error> SQLiteAdapter::executeQuery(const std::
                     }
                     break;
                 case SQLITE_BLOB:
-                    // Xử lý BLOB phức tạp hơn, tạm thời có thể đọc thành vector<char> hoặc string
-                    LOG_WARN("SQLiteAdapter::executeQuery - BLOB data type encountered at column '" + columnName + "' but not fully handled (returning as string placeholder).");
-                    // const void* blob_data = sqlite3_column_blob(stmt, i);
-                    // int blob_size = sqlite3_column_bytes(stmt, i);
-                    // columnValue = std::vector<unsigned char>(static_cast<const unsigned char*>(blob_data), static_cast<const unsigned char*>(blob_data) + blob_size);
-                    columnValue = std::string("[BLOB_DATA_PLACEHOLDER]"); // Tạm thời
+                    {
+                        // BLOB được đọc thành vector<unsigned char>; BLOB rỗng có thể trả về con trỏ NULL
+                        const auto* blob_data = static_cast<const unsigned char*>(sqlite3_column_blob(stmt, i));
+                        int blob_size = sqlite3_column_bytes(stmt, i);
+                        columnValue = blob_data ? std::vector<unsigned char>(blob_data, blob_data + blob_size) : std::vector<unsigned char>();
+                    }
                     break;
                 case SQLITE_NULL:
                     columnValue = std::any{}; // std::any rỗng đại diện cho NULL
@@ -210,9 +263,13 @@ std::expected<DbQueryResultTable, Error> SQLiteAdapter::executeQuery(const std::
                     LOG_WARN("SQLiteAdapter::executeQuery - Unknown SQLite column type: " + std::to_string(columnType) + " for column: " + columnName);
                     columnValue = std::any{}; // Hoặc một giá trị báo lỗi
             }
-            currentRow[columnName] = columnValue;
+            currentRow[columnName] = std::move(columnValue);
+        }
+        ++rowCount;
+        if (!onRow(currentRow)) { // Nơi gọi yêu cầu dừng sớm
+            rc_step = SQLITE_DONE;
+            break;
         }
-        results.push_back(currentRow);
     }
     if (rc_step != SQLITE_DONE) { // Nếu vòng lặp kết thúc không phải vì DONE (ví dụ lỗi)
         std::string errMsg = "SQLiteAdapter::executeQuery - Failed to step through results (SQLite error code: " + std::to_string(rc_step) + "): " +
@@ -222,8 +279,8 @@ std::expected<DbQueryResultTable, Error> SQLiteAdapter::executeQuery(const std::
         return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, errMsg});
     }
     sqlite3_finalize(stmt); // Luôn finalize stmt
-    LOG_INFO("SQLiteAdapter::executeQuery - Query executed successfully. Rows: " + std::to_string(results.size()) + " | Query: " + sqlQuery);
-    return results;
+    LOG_INFO("SQLiteAdapter::executeQuery - Query executed successfully. Rows: " + std::to_string(rowCount) + " | Query: " + sqlQuery);
+    return rowCount;
 }
 
 std::expected<long, Error> SQLiteAdapter::executeUpdate(const std::string& sqlQuery, const std::vector<DbQueryParam>& params) {
@@ -246,40 +303,91 @@ std::expected<long, Error> SQLiteAdapter::executeUpdate(const std::string& sqlQu
         sqlite3_finalize(stmt);
         return std::unexpected(bindErr);
     }
+    // Giữ mutex của kết nối từ step đến khi đọc số dòng / mã lỗi: khi nhiều luồng dùng chung kết nối,
+    // sqlite3_changes() và mã lỗi mở rộng phải thuộc về đúng câu lệnh này
+    sqlite3_mutex* connectionMutex = sqlite3_db_mutex(_connector->getDbHandle());
+    sqlite3_mutex_enter(connectionMutex);
     int rc_step = sqlite3_step(stmt);
     if (rc_step != SQLITE_DONE) {
-        // Kiểm tra lỗi ràng buộc khóa ngoại cụ thể
-        int extended_err_code = sqlite3_extended_errcode(_connector->getDbHandle());
-        if (extended_err_code == SQLITE_CONSTRAINT_FOREIGNKEY) {
-            std::string errMsg = "SQLiteAdapter::executeUpdate - Foreign key constraint failed: " +
-                                 std::string(sqlite3_errmsg(_connector->getDbHandle()));
-            LOG_ERROR(errMsg + " | Query: " + sqlQuery);
+        Error stepErr = makeStepError(rc_step, sqlQuery, "SQLiteAdapter::executeUpdate");
+        sqlite3_mutex_leave(connectionMutex);
+        sqlite3_finalize(stmt);
+        return std::unexpected(stepErr);
+    }
+    long affectedRows = sqlite3_changes(_connector->getDbHandle());
+    sqlite3_mutex_leave(connectionMutex);
+    sqlite3_finalize(stmt);
+    LOG_INFO("SQLiteAdapter::executeUpdate - Update executed successfully. Rows affected: " + std::to_string(affectedRows) + " | Query: " + sqlQuery);
+    return affectedRows;
+}
+
+Error SQLiteAdapter::makeStepError(int rc_step, const std::string& sqlQuery, const std::string& context) {
+    // Kiểm tra lỗi ràng buộc khóa ngoại cụ thể
+    int extended_err_code = sqlite3_extended_errcode(_connector->getDbHandle());
+    if (extended_err_code == SQLITE_CONSTRAINT_FOREIGNKEY) {
+        std::string errMsg = context + " - Foreign key constraint failed: " +
+                             std::string(sqlite3_errmsg(_connector->getDbHandle()));
+        LOG_ERROR(errMsg + " | Query: " + sqlQuery);
+        return Error{ErrorCode::DB_FOREIGN_KEY_ERROR, errMsg}; // (➕) Mã lỗi cụ thể hơn
+    }
+    // Các lỗi ràng buộc khác (bao gồm cả primary key, unique)
+    if (rc_step == SQLITE_CONSTRAINT) { // Mã lỗi chung cho constraint
+        std::string errMsg = context + " - Constraint violation: " +
+                             std::string(sqlite3_errmsg(_connector->getDbHandle()));
+        LOG_ERROR(errMsg + " | Query: " + sqlQuery);
+        // Phân loại lỗi constraint dựa trên extended_err_code
+        if(extended_err_code == SQLITE_CONSTRAINT_PRIMARYKEY || extended_err_code == SQLITE_CONSTRAINT_UNIQUE){
+             return Error{ErrorCode::ALREADY_EXISTS, errMsg};
+        }
+        return Error{ErrorCode::DB_CONSTRAINT_ERROR, errMsg};
+    }
+
+    std::string errMsg = context + " - Failed to execute statement (SQLite code: " + std::to_string(rc_step) + "): " +
+                         std::string(sqlite3_errmsg(_connector->getDbHandle()));
+    LOG_ERROR(errMsg + " | Query: " + sqlQuery);
+    // Trả về mã lỗi SQLite gốc nếu không phải là lỗi ràng buộc đã xử lý ở trên
+    return Error{ErrorCode::DB_QUERY_ERROR, errMsg};
+}
+
+std::expected<long, Error> SQLiteAdapter::executeBatchUpdate(const std::string& sqlQuery, const std::vector<std::vector<DbQueryParam>>& paramSets) {
+    if (!isConnected()) {
+        LOG_ERROR("SQLiteAdapter::executeBatchUpdate - Not connected to database.");
+        return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, "Not connected to database."});
+    }
+    if (paramSets.empty()) return 0L;
+
+    sqlite3_stmt* stmt = nullptr;
+    LOG_DEBUG("SQLiteAdapter::executeBatchUpdate - Preparing query: " + sqlQuery);
+    int rc_prepare = sqlite3_prepare_v2(_connector->getDbHandle(), sqlQuery.c_str(), -1, &stmt, nullptr);
+    if (rc_prepare != SQLITE_OK) {
+        std::string errMsg = "SQLiteAdapter::executeBatchUpdate - Failed to prepare statement: " +
+                             std::string(sqlite3_errmsg(_connector->getDbHandle())) + " | Query: " + sqlQuery;
+        LOG_ERROR(errMsg);
+        if (stmt) sqlite3_finalize(stmt);
+        return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, errMsg});
+    }
+
+    // Chuẩn bị một lần, mỗi bộ tham số chỉ cần reset + bind + step
+    long affectedRows = 0;
+    for (std::size_t i = 0; i < paramSets.size(); ++i) {
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+        Error bindErr = bindParameters(stmt, paramSets[i]);
+        if (bindErr.code != SQLITE_OK) {
             sqlite3_finalize(stmt);
-            return std::unexpected(Error{ErrorCode::DB_FOREIGN_KEY_ERROR, errMsg}); // (➕) Mã lỗi cụ thể hơn
+            return std::unexpected(Error{bindErr.code, bindErr.message + " (batch row " + std::to_string(i) + ")"});
         }
-        // Các lỗi ràng buộc khác (bao gồm cả primary key, unique)
-        if (rc_step == SQLITE_CONSTRAINT) { // Mã lỗi chung cho constraint
-            std::string errMsg = "SQLiteAdapter::executeUpdate - Constraint violation: " +
-                                 std::string(sqlite3_errmsg(_connector->getDbHandle()));
-            LOG_ERROR(errMsg + " | Query: " + sqlQuery);
+        int rc_step = sqlite3_step(stmt);
+        if (rc_step != SQLITE_DONE) {
+            Error stepErr = makeStepError(rc_step, sqlQuery, "SQLiteAdapter::executeBatchUpdate");
             sqlite3_finalize(stmt);
-            // Phân loại lỗi constraint dựa trên extended_err_code
-            if(extended_err_code == SQLITE_CONSTRAINT_PRIMARYKEY || extended_err_code == SQLITE_CONSTRAINT_UNIQUE){
-                 return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, errMsg});
-            }
-            return std::unexpected(Error{ErrorCode::DB_CONSTRAINT_ERROR, errMsg});
+            return std::unexpected(Error{stepErr.code, stepErr.message + " (batch row " + std::to_string(i) + ")"});
         }
-
-        std::string errMsg = "SQLiteAdapter::executeUpdate - Failed to execute statement (SQLite code: " + std::to_string(rc_step) + "): " +
-                             std::string(sqlite3_errmsg(_connector->getDbHandle()));
-        LOG_ERROR(errMsg + " | Query: " + sqlQuery);
-        sqlite3_finalize(stmt);
-        // Trả về mã lỗi SQLite gốc nếu không phải là lỗi ràng buộc đã xử lý ở trên
-        return std::unexpected(Error{ErrorCode::DB_QUERY_ERROR, errMsg}); 
+        affectedRows += sqlite3_changes(_connector->getDbHandle());
     }
-    long affectedRows = sqlite3_changes(_connector->getDbHandle());
     sqlite3_finalize(stmt);
-    LOG_INFO("SQLiteAdapter::executeUpdate - Update executed successfully. Rows affected: " + std::to_string(affectedRows) + " | Query: " + sqlQuery);
+    LOG_INFO("SQLiteAdapter::executeBatchUpdate - Batch executed successfully. Sets: " + std::to_string(paramSets.size()) +
+             ", rows affected: " + std::to_string(affectedRows) + " | Query: " + sqlQuery);
     return affectedRows;
 }
 
@@ -362,15 +470,17 @@ std::expected<bool, Error> SQLiteAdapter::rollbackTransaction() {
     if (_transactionDepth == 1) {
         sql = "ROLLBACK TRANSACTION;";
     } else {
-        // Rollback TO savepoint sẽ hủy bỏ savepoint đó và các savepoint sau nó.
+        // Rollback TO savepoint hủy các thay đổi sau savepoint đó, nhưng savepoint vẫn còn
+        // trên ngăn xếp cho đến khi được RELEASE (xem bên dưới).
         sql = "ROLLBACK TRANSACTION TO SAVEPOINT LEVEL_" + std::to_string(_transactionDepth - 1) + ";";
-        // Sau đó, cần RELEASE savepoint đó để nó không còn "treo"
-        // Tuy nhiên, "ROLLBACK TO SAVEPOINT name;" cũng tương đương với "RELEASE name;" sau đó.
-        // Thực tế, chỉ cần "ROLLBACK TO SAVEPOINT" là đủ.
     }
 
     LOG_DEBUG("SQLiteAdapter::rollbackTransaction - Executing: " + sql);
     auto execRes = executeUpdate(sql);
+    if (execRes.has_value() && _transactionDepth > 1) {
+        // Giải phóng savepoint để mức lồng của SQLite khớp với _transactionDepth
+        execRes = executeUpdate("RELEASE SAVEPOINT LEVEL_" + std::to_string(_transactionDepth - 1) + ";");
+    }
     if (!execRes.has_value()) {
         std::string errMsg = "SQLiteAdapter::rollbackTransaction - Failed to rollback/rollback to savepoint: " + execRes.error().message;
         LOG_CRITICAL("SQLiteAdapter::rollbackTransaction - CRITICAL: " + errMsg + ". Database might be in an inconsistent state.");
@@ -388,6 +498,33 @@ bool SQLiteAdapter::isInTransaction() const {
     return _transactionDepth > 0;
 }
 
+bool SQLiteAdapter::hasArchive() const {
+    return _archiveAttached;
+}
+
+
+std::expected<bool, Error> SQLiteAdapter::addMissingColumns(std::vector<std::string>& backfills) {
+    for (const auto& upgrade : COLUMN_UPGRADES) {
+        auto columns = executeQuery("PRAGMA table_info(" + std::string(upgrade.table) + ");");
+        if (!columns.has_value()) return std::unexpected(columns.error());
+        // Bảng chưa có sẽ được tạo đủ cột bởi CREATE TABLE
+        if (columns->empty()) continue;
+        bool present = false;
+        for (const auto& column : columns.value()) {
+            if (std::any_cast<std::string>(column.at("name")) == upgrade.column) {
+                present = true;
+                break;
+            }
+        }
+        if (present) continue;
+
+        LOG_INFO("SQLiteAdapter::addMissingColumns - Adding column " + std::string(upgrade.table) + "." + upgrade.column);
+        auto altered = executeUpdate("ALTER TABLE " + std::string(upgrade.table) + " ADD COLUMN " + upgrade.definition + ";");
+        if (!altered.has_value()) return std::unexpected(altered.error());
+        if (upgrade.backfill) backfills.emplace_back(upgrade.backfill);
+    }
+    return true;
+}
 
 // ĐÂY LÀ PHIÊN BẢN ĐẦY ĐỦ CỦA ensureTablesExist
 std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
@@ -417,9 +554,27 @@ std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
                 email TEXT UNIQUE,     -- Nên là NOT NULL cho Student/Teacher
                 phoneNumber TEXT,
                 role INTEGER NOT NULL,
-                status INTEGER NOT NULL 
+                status INTEGER NOT NULL,
+                statusChangedAt TEXT NOT NULL DEFAULT (date('now')) -- Ngày đổi trạng thái gần nhất, dạng YYYY-MM-DD
             ) WITHOUT ROWID; 
         )SQL"},
+        // Bảng Users được nâng cấp có giá trị mặc định '' thay cho date('now')
+        {"Users_status_changed_default", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Users_status_changed_default AFTER INSERT ON Users WHEN NEW.statusChangedAt = ''
+            BEGIN
+                UPDATE Users SET statusChangedAt = date('now') WHERE id = NEW.id;
+            END;
+        )SQL"},
+        {"Users_status_changed", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Users_status_changed AFTER UPDATE OF status ON Users WHEN NEW.status <> OLD.status
+            BEGIN
+                UPDATE Users SET statusChangedAt = date('now') WHERE id = NEW.id;
+            END;
+        )SQL"},
+        // Tìm sinh viên bị vô hiệu hóa lâu ngày để chuyển sang kho lưu trữ
+        {"Users_status", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_Users_status ON Users (status, statusChangedAt);
+        )SQL"},
         {"Students", R"SQL(
             CREATE TABLE IF NOT EXISTS Students (
                 userId TEXT PRIMARY KEY,
@@ -446,6 +601,9 @@ std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
                 name TEXT NOT NULL,
                 credits INTEGER NOT NULL CHECK(credits > 0 AND credits <= 10),
                 facultyId TEXT,
+                capacity INTEGER NOT NULL DEFAULT 0 CHECK(capacity >= 0), -- 0 nghĩa là không giới hạn
+                enrolledCount INTEGER NOT NULL DEFAULT 0 CHECK(enrolledCount >= 0), -- Do các trigger Enrollments_seat_* duy trì
+                schedule TEXT NOT NULL DEFAULT '', -- Lịch học hằng tuần, ví dụ "Mon 07:30-09:30 E301; Wed 13:00-15:00 F201"
                 FOREIGN KEY (facultyId) REFERENCES Faculties(id) ON DELETE SET NULL ON UPDATE CASCADE
             ) WITHOUT ROWID;
         )SQL"},
@@ -457,28 +615,173 @@ std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
                 FOREIGN KEY (userId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE
             ) WITHOUT ROWID;
         )SQL"},
+        // Sinh viên đang được chuyển sang kho lưu trữ; chỉ có dữ liệu bên trong transaction lưu trữ
+        {"ArchiveQueue", R"SQL(
+            CREATE TABLE IF NOT EXISTS ArchiveQueue (
+                studentId TEXT PRIMARY KEY
+            ) WITHOUT ROWID;
+        )SQL"},
+        // Shard đang giữ đăng ký, kết quả và học phí của sinh viên khi phân vùng theo khoa (SqlShardRouter)
+        {"StudentShards", R"SQL(
+            CREATE TABLE IF NOT EXISTS StudentShards (
+                studentId TEXT PRIMARY KEY,
+                shardKey TEXT NOT NULL, -- facultyId lúc gán shard, rỗng nếu sinh viên chưa thuộc khoa nào
+                FOREIGN KEY (studentId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"StudentShards_shard", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_StudentShards_shard ON StudentShards (shardKey);
+        )SQL"},
+        {"Terms", R"SQL(
+            CREATE TABLE IF NOT EXISTS Terms (
+                id TEXT PRIMARY KEY,
+                name TEXT NOT NULL,
+                startDate TEXT NOT NULL, -- Dạng YYYY-MM-DD
+                endDate TEXT NOT NULL,   -- Dạng YYYY-MM-DD
+                closed INTEGER NOT NULL DEFAULT 0 CHECK(closed IN (0, 1)), -- Học kỳ đã đóng chỉ được đọc
+                CHECK(startDate <= endDate)
+            ) WITHOUT ROWID;
+        )SQL"},
+        // Học kỳ hiện tại: học kỳ đang mở bắt đầu gần nhất
+        {"Terms_open", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_Terms_open ON Terms (startDate) WHERE closed = 0;
+        )SQL"},
+        {"Terms_frozen", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Terms_frozen BEFORE UPDATE ON Terms WHEN OLD.closed = 1
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
+        {"Terms_frozen_delete", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Terms_frozen_delete BEFORE DELETE ON Terms WHEN OLD.closed = 1
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
         {"Enrollments", R"SQL(
             CREATE TABLE IF NOT EXISTS Enrollments (
                 studentId TEXT NOT NULL,
                 courseId TEXT NOT NULL,
                 enrollmentDate TEXT DEFAULT CURRENT_TIMESTAMP,
+                termId TEXT, -- NULL nếu chưa gán học kỳ
                 PRIMARY KEY (studentId, courseId),
                 FOREIGN KEY (studentId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE,
-                FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE
+                FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE,
+                FOREIGN KEY (termId) REFERENCES Terms(id) ON DELETE RESTRICT ON UPDATE CASCADE
             ) /* Không dùng WITHOUT ROWID cho bảng có PK không phải INTEGER */ ;
         )SQL"},
+        // Truy vấn theo học kỳ chỉ quét phân vùng của học kỳ đó
+        {"Enrollments_term", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_Enrollments_term ON Enrollments (termId, courseId, studentId);
+        )SQL"},
+        // Đăng ký không chỉ rõ học kỳ thuộc học kỳ hiện tại (nếu có)
+        {"Enrollments_term_default", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Enrollments_term_default AFTER INSERT ON Enrollments WHEN NEW.termId IS NULL
+            BEGIN
+                UPDATE Enrollments SET termId = (
+                    SELECT id FROM Terms WHERE closed = 0 AND startDate <= date('now') ORDER BY startDate DESC LIMIT 1)
+                WHERE studentId = NEW.studentId AND courseId = NEW.courseId;
+            END;
+        )SQL"},
+        {"Enrollments_term_closed_insert", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Enrollments_term_closed_insert BEFORE INSERT ON Enrollments
+            WHEN NEW.termId IN (SELECT id FROM Terms WHERE closed = 1)
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
+        {"Enrollments_term_closed_update", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Enrollments_term_closed_update BEFORE UPDATE ON Enrollments
+            WHEN OLD.termId IN (SELECT id FROM Terms WHERE closed = 1) OR NEW.termId IN (SELECT id FROM Terms WHERE closed = 1)
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
+        // Thân trigger đã đổi (bỏ qua sinh viên đang được lưu trữ); bỏ bản cũ để câu lệnh dưới tạo lại
+        {"Enrollments_term_closed_delete_drop", R"SQL(
+            DROP TRIGGER IF EXISTS trg_Enrollments_term_closed_delete;
+        )SQL"},
+        {"Enrollments_term_closed_delete", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Enrollments_term_closed_delete BEFORE DELETE ON Enrollments
+            WHEN OLD.termId IN (SELECT id FROM Terms WHERE closed = 1)
+                 AND OLD.studentId NOT IN (SELECT studentId FROM ArchiveQueue) -- Dữ liệu được chuyển nguyên vẹn sang kho lưu trữ
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
+        // Bộ đếm chỗ: kiểm tra và tăng cùng câu lệnh INSERT nên không thể vượt số chỗ khi đăng ký đồng thời
+        {"Enrollments_seat_check", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Enrollments_seat_check BEFORE INSERT ON Enrollments
+            BEGIN
+                SELECT RAISE(ABORT, 'Course capacity reached')
+                FROM Courses WHERE id = NEW.courseId AND capacity > 0 AND enrolledCount >= capacity
+                    -- Đăng ký trùng để khóa chính báo ALREADY_EXISTS
+                    AND NOT EXISTS (SELECT 1 FROM Enrollments WHERE studentId = NEW.studentId AND courseId = NEW.courseId);
+            END;
+        )SQL"},
+        {"Enrollments_seat_take", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Enrollments_seat_take AFTER INSERT ON Enrollments
+            BEGIN
+                UPDATE Courses SET enrolledCount = enrolledCount + 1 WHERE id = NEW.courseId;
+            END;
+        )SQL"},
+        {"Enrollments_seat_release", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_Enrollments_seat_release AFTER DELETE ON Enrollments
+            BEGIN
+                UPDATE Courses SET enrolledCount = enrolledCount - 1 WHERE id = OLD.courseId;
+            END;
+        )SQL"},
         {"CourseResults", R"SQL(
             CREATE TABLE IF NOT EXISTS CourseResults (
                 studentId TEXT NOT NULL,
                 courseId TEXT NOT NULL,
                 marks INTEGER, -- -1 nghĩa là chưa có điểm
                 grade TEXT,    -- Sẽ được tính bởi ứng dụng khi hiển thị hoặc Service khi cần
+                termId TEXT,   -- NULL nếu chưa gán học kỳ
                 PRIMARY KEY (studentId, courseId),
                 FOREIGN KEY (studentId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE,
                 FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE,
+                FOREIGN KEY (termId) REFERENCES Terms(id) ON DELETE RESTRICT ON UPDATE CASCADE,
                 CHECK (marks IS NULL OR (marks >= -1 AND marks <= 100))
             );
         )SQL"},
+        {"CourseResults_term", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_CourseResults_term ON CourseResults (termId, courseId, studentId);
+        )SQL"},
+        // Kết quả không chỉ rõ học kỳ thuộc học kỳ của bản ghi đăng ký tương ứng
+        {"CourseResults_term_default", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_CourseResults_term_default AFTER INSERT ON CourseResults WHEN NEW.termId IS NULL
+            BEGIN
+                UPDATE CourseResults SET termId = (
+                    SELECT termId FROM Enrollments WHERE studentId = NEW.studentId AND courseId = NEW.courseId)
+                WHERE studentId = NEW.studentId AND courseId = NEW.courseId;
+            END;
+        )SQL"},
+        {"CourseResults_term_closed_insert", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_CourseResults_term_closed_insert BEFORE INSERT ON CourseResults
+            WHEN NEW.termId IN (SELECT id FROM Terms WHERE closed = 1)
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
+        {"CourseResults_term_closed_update", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_CourseResults_term_closed_update BEFORE UPDATE ON CourseResults
+            WHEN OLD.termId IN (SELECT id FROM Terms WHERE closed = 1) OR NEW.termId IN (SELECT id FROM Terms WHERE closed = 1)
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
+        {"CourseResults_term_closed_delete_drop", R"SQL(
+            DROP TRIGGER IF EXISTS trg_CourseResults_term_closed_delete;
+        )SQL"},
+        {"CourseResults_term_closed_delete", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_CourseResults_term_closed_delete BEFORE DELETE ON CourseResults
+            WHEN OLD.termId IN (SELECT id FROM Terms WHERE closed = 1)
+                 AND OLD.studentId NOT IN (SELECT studentId FROM ArchiveQueue) -- Dữ liệu được chuyển nguyên vẹn sang kho lưu trữ
+            BEGIN
+                SELECT RAISE(ABORT, 'Term is closed');
+            END;
+        )SQL"},
         {"FeeRecords", R"SQL(
             CREATE TABLE IF NOT EXISTS FeeRecords (
                 studentId TEXT PRIMARY KEY,
@@ -494,6 +797,126 @@ std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
                 basicMonthlyPay INTEGER NOT NULL CHECK(basicMonthlyPay >= 0),
                 FOREIGN KEY (teacherId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE
             ) WITHOUT ROWID;
+        )SQL"},
+        {"Sequences", R"SQL(
+            CREATE TABLE IF NOT EXISTS Sequences (
+                name TEXT PRIMARY KEY, -- Ví dụ: tiền tố năm + khoa của mã sinh viên
+                value INTEGER NOT NULL CHECK(value >= 0)
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeePayments", R"SQL(
+            CREATE TABLE IF NOT EXISTS FeePayments (
+                idempotencyKey TEXT PRIMARY KEY,
+                studentId TEXT NOT NULL,
+                amount INTEGER NOT NULL CHECK(amount > 0),
+                paidAt INTEGER NOT NULL, -- Giây kể từ epoch
+                FOREIGN KEY (studentId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeePayments_studentId", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_FeePayments_studentId ON FeePayments (studentId, paidAt);
+        )SQL"},
+        {"SalaryPayments", R"SQL(
+            CREATE TABLE IF NOT EXISTS SalaryPayments (
+                teacherId TEXT NOT NULL,
+                period TEXT NOT NULL, -- Dạng YYYY-MM
+                basicPay INTEGER NOT NULL CHECK(basicPay >= 0),
+                allowance INTEGER NOT NULL CHECK(allowance >= 0),
+                PRIMARY KEY (period, teacherId),
+                FOREIGN KEY (teacherId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"SalaryPayments_teacherId", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_SalaryPayments_teacherId ON SalaryPayments (teacherId, period);
+        )SQL"},
+        {"TuitionRates", R"SQL(
+            CREATE TABLE IF NOT EXISTS TuitionRates (
+                facultyId TEXT PRIMARY KEY,
+                ratePerCredit INTEGER NOT NULL CHECK(ratePerCredit >= 0),
+                FOREIGN KEY (facultyId) REFERENCES Faculties(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeeInstallments", R"SQL(
+            CREATE TABLE IF NOT EXISTS FeeInstallments (
+                studentId TEXT NOT NULL,
+                sequence INTEGER NOT NULL,
+                dueDate TEXT NOT NULL, -- Dạng YYYY-MM-DD
+                amount INTEGER NOT NULL CHECK(amount > 0),
+                paidAmount INTEGER NOT NULL DEFAULT 0 CHECK(paidAmount >= 0 AND paidAmount <= amount),
+                isLate INTEGER NOT NULL DEFAULT 0,
+                PRIMARY KEY (studentId, sequence),
+                FOREIGN KEY (studentId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeeInstallments_open", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_FeeInstallments_open ON FeeInstallments (dueDate, studentId) WHERE paidAmount < amount;
+        )SQL"},
+        {"Waitlist", R"SQL(
+            CREATE TABLE IF NOT EXISTS Waitlist (
+                courseId TEXT NOT NULL,
+                studentId TEXT NOT NULL,
+                priorityClass INTEGER NOT NULL DEFAULT 0 CHECK(priorityClass >= 0), -- 0 là ưu tiên cao nhất
+                requestedAt INTEGER NOT NULL, -- Micro giây kể từ epoch
+                PRIMARY KEY (courseId, studentId),
+                FOREIGN KEY (studentId) REFERENCES Users(id) ON DELETE CASCADE ON UPDATE CASCADE,
+                FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        // Đọc danh sách chờ của một khóa học theo đúng thứ tự chờ, không cần sắp xếp
+        {"Waitlist_order", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_Waitlist_order ON Waitlist (courseId, priorityClass, requestedAt, studentId);
+        )SQL"},
+        {"Waitlist_student", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_Waitlist_student ON Waitlist (studentId);
+        )SQL"},
+        {"CoursePrerequisites", R"SQL(
+            CREATE TABLE IF NOT EXISTS CoursePrerequisites (
+                courseId TEXT NOT NULL,
+                prerequisiteId TEXT NOT NULL, -- Môn tiên quyết trực tiếp của courseId
+                PRIMARY KEY (courseId, prerequisiteId),
+                CHECK(courseId <> prerequisiteId),
+                FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE,
+                FOREIGN KEY (prerequisiteId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"ExamSchedule", R"SQL(
+            CREATE TABLE IF NOT EXISTS ExamSchedule (
+                courseId TEXT PRIMARY KEY,
+                examDay INTEGER NOT NULL CHECK(examDay >= 1), -- Ngày thứ mấy của đợt thi
+                period INTEGER NOT NULL CHECK(period >= 1),   -- Ca thi trong ngày
+                FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"ExamSchedule_slot", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_ExamSchedule_slot ON ExamSchedule (examDay, period);
+        )SQL"},
+        {"DegreeRequirements", R"SQL(
+            CREATE TABLE IF NOT EXISTS DegreeRequirements (
+                facultyId TEXT PRIMARY KEY,
+                minTotalCredits INTEGER NOT NULL DEFAULT 0 CHECK(minTotalCredits >= 0),
+                minCgpa REAL NOT NULL DEFAULT 0 CHECK(minCgpa >= 0 AND minCgpa <= 4),
+                requiredCourses TEXT NOT NULL DEFAULT '', -- Các courseId bắt buộc, phân cách bởi ';'
+                FOREIGN KEY (facultyId) REFERENCES Faculties(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"AttendanceRoster", R"SQL(
+            CREATE TABLE IF NOT EXISTS AttendanceRoster (
+                courseId TEXT NOT NULL,
+                slot INTEGER NOT NULL CHECK(slot >= 0 AND slot < 65536), -- Chỉ số bit trong bitmap điểm danh
+                studentId TEXT NOT NULL, -- Không ràng buộc khóa ngoại để slot không bị thủng khi xóa sinh viên
+                PRIMARY KEY (courseId, slot),
+                UNIQUE (courseId, studentId),
+                FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"AttendanceSessions", R"SQL(
+            CREATE TABLE IF NOT EXISTS AttendanceSessions (
+                courseId TEXT NOT NULL,
+                sessionNo INTEGER NOT NULL CHECK(sessionNo >= 1),
+                presence BLOB NOT NULL, -- AttendanceBitmap đã mã hóa
+                PRIMARY KEY (courseId, sessionNo),
+                FOREIGN KEY (courseId) REFERENCES Courses(id) ON DELETE CASCADE ON UPDATE CASCADE
+            ) WITHOUT ROWID;
         )SQL"}
     };
 
@@ -503,6 +926,17 @@ std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
         return std::unexpected(beginTransResult.error());
     }
 
+    // Cột mới phải có trước khi tạo chỉ mục và trigger dùng nó
+    std::vector<std::string> backfills;
+    auto upgraded = addMissingColumns(backfills);
+    if (!upgraded.has_value()) {
+        std::string errMsg = "SQLiteAdapter::ensureTablesExist - Failed to upgrade existing tables: " + upgraded.error().message;
+        LOG_ERROR(errMsg);
+        auto rbRes = rollbackTransaction();
+        if(!rbRes.has_value()) LOG_CRITICAL("SQLiteAdapter::ensureTablesExist - Rollback failed after schema upgrade error: " + rbRes.error().message);
+        return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, errMsg});
+    }
+
     for (const auto& tableDef : tablesToCreate) {
         LOG_DEBUG("SQLiteAdapter::ensureTablesExist - Creating table if not exists: " + tableDef.first);
         auto createTableRes = executeUpdate(tableDef.second); 
@@ -515,6 +949,17 @@ std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
         }
     }
 
+    for (const auto& backfillSql : backfills) {
+        auto backfillRes = executeUpdate(backfillSql);
+        if (!backfillRes.has_value()) {
+            std::string errMsg = "SQLiteAdapter::ensureTablesExist - Failed to backfill upgraded column: " + backfillRes.error().message;
+            LOG_ERROR(errMsg);
+            auto rbRes = rollbackTransaction();
+            if(!rbRes.has_value()) LOG_CRITICAL("SQLiteAdapter::ensureTablesExist - Rollback failed after backfill error: " + rbRes.error().message);
+            return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, errMsg});
+        }
+    }
+
     // (➕) Tạo Admin User mặc định
     std::string adminId = "admin";
     std::string adminDefaultPassword = "admin123"; 
@@ -580,4 +1025,218 @@ std::expected<bool, Error> SQLiteAdapter::ensureTablesExist() {
 
     LOG_INFO("SQLiteAdapter::ensureTablesExist - Database schema and default admin (if needed) ensured successfully.");
     return true;
-}
\ No newline at end of file
+}
+std::expected<bool, Error> SQLiteAdapter::attachArchive(const std::string& archivePath) {
+    if (!isConnected()) {
+        return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, "Database not connected. Cannot attach archive."});
+    }
+    if (_archiveAttached) return true;
+    if (isInTransaction()) {
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Cannot attach archive database inside a transaction."});
+    }
+
+    auto attachResult = executeUpdate("ATTACH DATABASE ? AS " + std::string(ARCHIVE_SCHEMA) + ";", {archivePath});
+    if (!attachResult.has_value()) {
+        LOG_ERROR("SQLiteAdapter::attachArchive - Failed to attach archive '" + archivePath + "': " + attachResult.error().message);
+        return std::unexpected(attachResult.error());
+    }
+
+    // Cùng cột với bảng chính, thêm archivedAt; không có khóa ngoại vì SQLite không hỗ trợ khóa ngoại giữa hai cơ sở dữ liệu
+    const std::vector<std::pair<std::string, std::string>> tablesToCreate = {
+        {"Users", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.Users (
+                id TEXT PRIMARY KEY,
+                firstName TEXT NOT NULL,
+                lastName TEXT NOT NULL,
+                birthDay INTEGER,
+                birthMonth INTEGER,
+                birthYear INTEGER,
+                address TEXT,
+                citizenId TEXT,
+                email TEXT,
+                phoneNumber TEXT,
+                role INTEGER NOT NULL,
+                status INTEGER NOT NULL,
+                statusChangedAt TEXT NOT NULL,
+                archivedAt TEXT NOT NULL DEFAULT CURRENT_TIMESTAMP
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"Students", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.Students (
+                userId TEXT PRIMARY KEY,
+                facultyId TEXT
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"Logins", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.Logins (
+                userId TEXT PRIMARY KEY,
+                passwordHash TEXT NOT NULL,
+                salt TEXT NOT NULL
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"Enrollments", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.Enrollments (
+                studentId TEXT NOT NULL,
+                courseId TEXT NOT NULL,
+                enrollmentDate TEXT,
+                termId TEXT,
+                PRIMARY KEY (studentId, courseId)
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"CourseResults", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.CourseResults (
+                studentId TEXT NOT NULL,
+                courseId TEXT NOT NULL,
+                marks INTEGER,
+                grade TEXT,
+                termId TEXT,
+                PRIMARY KEY (studentId, courseId)
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeeRecords", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.FeeRecords (
+                studentId TEXT PRIMARY KEY,
+                totalFee INTEGER NOT NULL,
+                paidFee INTEGER NOT NULL
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeePayments", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.FeePayments (
+                idempotencyKey TEXT PRIMARY KEY,
+                studentId TEXT NOT NULL,
+                amount INTEGER NOT NULL,
+                paidAt INTEGER NOT NULL
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeePayments_studentId", R"SQL(
+            CREATE INDEX IF NOT EXISTS archive.idx_FeePayments_studentId ON FeePayments (studentId, paidAt);
+        )SQL"},
+        {"FeeInstallments", R"SQL(
+            CREATE TABLE IF NOT EXISTS archive.FeeInstallments (
+                studentId TEXT NOT NULL,
+                sequence INTEGER NOT NULL,
+                dueDate TEXT NOT NULL,
+                amount INTEGER NOT NULL,
+                paidAmount INTEGER NOT NULL,
+                isLate INTEGER NOT NULL,
+                PRIMARY KEY (studentId, sequence)
+            ) WITHOUT ROWID;
+        )SQL"}
+    };
+
+    auto beginTransResult = beginTransaction();
+    if (!beginTransResult.has_value()) {
+        executeUpdate("DETACH DATABASE " + std::string(ARCHIVE_SCHEMA) + ";");
+        return std::unexpected(beginTransResult.error());
+    }
+    for (const auto& tableDef : tablesToCreate) {
+        auto createTableRes = executeUpdate(tableDef.second);
+        if (!createTableRes.has_value()) {
+            std::string errMsg = "SQLiteAdapter::attachArchive - Failed to create archive table '" + tableDef.first + "': " + createTableRes.error().message;
+            LOG_ERROR(errMsg);
+            rollbackTransaction();
+            executeUpdate("DETACH DATABASE " + std::string(ARCHIVE_SCHEMA) + ";");
+            return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, errMsg});
+        }
+    }
+    auto commitResult = commitTransaction();
+    if (!commitResult.has_value()) {
+        executeUpdate("DETACH DATABASE " + std::string(ARCHIVE_SCHEMA) + ";");
+        return std::unexpected(commitResult.error());
+    }
+
+    _archiveAttached = true;
+    LOG_INFO("SQLiteAdapter::attachArchive - Archive database attached: " + archivePath);
+    return true;
+}
+
+std::expected<bool, Error> SQLiteAdapter::ensureShardTablesExist() {
+    if (!isConnected()) {
+        return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, "Database not connected. Cannot ensure shard tables exist."});
+    }
+    LOG_INFO("SQLiteAdapter::ensureShardTablesExist - Ensuring shard schema exists in " + _dbPath);
+
+    // Cùng cột và ràng buộc CHECK với bảng chính; khóa ngoại và trigger tham chiếu bảng của cơ sở dữ liệu chính bị bỏ
+    const std::vector<std::pair<std::string, std::string>> tablesToCreate = {
+        {"Enrollments", R"SQL(
+            CREATE TABLE IF NOT EXISTS Enrollments (
+                studentId TEXT NOT NULL,
+                courseId TEXT NOT NULL,
+                enrollmentDate TEXT DEFAULT CURRENT_TIMESTAMP,
+                termId TEXT,
+                PRIMARY KEY (studentId, courseId)
+            );
+        )SQL"},
+        {"Enrollments_term", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_Enrollments_term ON Enrollments (termId, courseId, studentId);
+        )SQL"},
+        // Truy vấn theo khóa học được gửi tới mọi shard, nên mỗi shard cần chỉ mục riêng theo courseId
+        {"Enrollments_course", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_Enrollments_course ON Enrollments (courseId);
+        )SQL"},
+        {"CourseResults", R"SQL(
+            CREATE TABLE IF NOT EXISTS CourseResults (
+                studentId TEXT NOT NULL,
+                courseId TEXT NOT NULL,
+                marks INTEGER,
+                grade TEXT,
+                termId TEXT,
+                PRIMARY KEY (studentId, courseId),
+                CHECK (marks IS NULL OR (marks >= -1 AND marks <= 100))
+            );
+        )SQL"},
+        {"CourseResults_term", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_CourseResults_term ON CourseResults (termId, courseId, studentId);
+        )SQL"},
+        {"CourseResults_course", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_CourseResults_course ON CourseResults (courseId);
+        )SQL"},
+        // Đăng ký và kết quả của một sinh viên luôn cùng shard nên trigger này giữ nguyên được
+        {"CourseResults_term_default", R"SQL(
+            CREATE TRIGGER IF NOT EXISTS trg_CourseResults_term_default AFTER INSERT ON CourseResults WHEN NEW.termId IS NULL
+            BEGIN
+                UPDATE CourseResults SET termId = (
+                    SELECT termId FROM Enrollments WHERE studentId = NEW.studentId AND courseId = NEW.courseId)
+                WHERE studentId = NEW.studentId AND courseId = NEW.courseId;
+            END;
+        )SQL"},
+        {"FeeRecords", R"SQL(
+            CREATE TABLE IF NOT EXISTS FeeRecords (
+                studentId TEXT PRIMARY KEY,
+                totalFee INTEGER NOT NULL CHECK(totalFee >= 0),
+                paidFee INTEGER NOT NULL DEFAULT 0 CHECK(paidFee >= 0),
+                CHECK(paidFee <= totalFee)
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeePayments", R"SQL(
+            CREATE TABLE IF NOT EXISTS FeePayments (
+                idempotencyKey TEXT PRIMARY KEY,
+                studentId TEXT NOT NULL,
+                amount INTEGER NOT NULL CHECK(amount > 0),
+                paidAt INTEGER NOT NULL
+            ) WITHOUT ROWID;
+        )SQL"},
+        {"FeePayments_studentId", R"SQL(
+            CREATE INDEX IF NOT EXISTS idx_FeePayments_studentId ON FeePayments (studentId, paidAt);
+        )SQL"}
+    };
+
+    auto beginTransResult = beginTransaction();
+    if (!beginTransResult.has_value()) {
+        return std::unexpected(beginTransResult.error());
+    }
+    for (const auto& tableDef : tablesToCreate) {
+        auto createTableRes = executeUpdate(tableDef.second);
+        if (!createTableRes.has_value()) {
+            std::string errMsg = "SQLiteAdapter::ensureShardTablesExist - Failed to create shard table '" + tableDef.first + "': " + createTableRes.error().message;
+            LOG_ERROR(errMsg);
+            rollbackTransaction();
+            return std::unexpected(Error{ErrorCode::DATA_ACCESS_ERROR, errMsg});
+        }
+    }
+    auto commitResult = commitTransaction();
+    if (!commitResult.has_value()) {
+        return std::unexpected(commitResult.error());
+    }
+    return true;
+}
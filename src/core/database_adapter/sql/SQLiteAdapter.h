@@ -32,6 +32,7 @@ private:
     std::string _dbPath; ///< Đường dẫn đến file cơ sở dữ liệu
     bool _isConnected; ///< Trạng thái kết nối hiện tại
     int _transactionDepth; ///< Để theo dõi transaction lồng nhau (SQLite hỗ trợ qua SAVEPOINT)
+    bool _archiveAttached; ///< Đã ATTACH cơ sở dữ liệu lưu trữ dưới tên ARCHIVE_SCHEMA
 
     /**
      * @brief Gắn các tham số vào câu lệnh SQL đã chuẩn bị
@@ -42,6 +43,28 @@ private:
      */
     Error bindParameters(sqlite3_stmt* stmt, const std::vector<DbQueryParam>& params);
 
+    /**
+     * @brief Chuyển mã lỗi của sqlite3_step thành Error (phân loại lỗi ràng buộc)
+     * 
+     * @param rc_step Mã trả về của sqlite3_step
+     * @param sqlQuery Câu lệnh SQL (dùng khi ghi log)
+     * @param context Tên phương thức gọi (dùng trong thông điệp lỗi)
+     * @return Lỗi tương ứng
+     */
+    Error makeStepError(int rc_step, const std::string& sqlQuery, const std::string& context);
+
+    /**
+     * @brief Thêm các cột mới vào bảng đã tạo bởi phiên bản cũ
+     * 
+     * CREATE TABLE IF NOT EXISTS không thay đổi bảng đã có, nên mỗi cột thêm sau được kiểm tra bằng
+     * PRAGMA table_info và thêm bằng ALTER TABLE ADD COLUMN trước khi tạo chỉ mục, trigger dùng nó.
+     * Phải gọi trong transaction của ensureTablesExist.
+     * 
+     * @param backfills Nhận các câu lệnh điền dữ liệu cho cột vừa thêm, chạy khi đã đủ bảng
+     * @return Kết quả thành công hoặc lỗi
+     */
+    std::expected<bool, Error> addMissingColumns(std::vector<std::string>& backfills);
+
 public:
     /**
      * @brief Constructor mặc định
@@ -74,15 +97,41 @@ public:
     bool isConnected() const override;
 
     std::expected<DbQueryResultTable, Error> executeQuery(const std::string& sqlQuery, const std::vector<DbQueryParam>& params = {}) override;
+    std::expected<std::size_t, Error> executeQueryStreaming(const std::string& sqlQuery, const std::vector<DbQueryParam>& params,
+                                                            const DbRowVisitor& onRow) override;
     std::expected<long, Error> executeUpdate(const std::string& sqlQuery, const std::vector<DbQueryParam>& params = {}) override;
+    std::expected<long, Error> executeBatchUpdate(const std::string& sqlQuery, const std::vector<std::vector<DbQueryParam>>& paramSets) override;
 
     // (➕) Transaction Management
     std::expected<bool, Error> beginTransaction() override;
     std::expected<bool, Error> commitTransaction() override;
     std::expected<bool, Error> rollbackTransaction() override;
     bool isInTransaction() const override;
+    bool hasArchive() const override;
 
     std::expected<bool, Error> ensureTablesExist();
+
+    /**
+     * @brief Gắn (ATTACH) file lưu trữ vào kết nối hiện tại và tạo các bảng lưu trữ nếu chưa có
+     * 
+     * Các bảng lưu trữ có cùng cột với bảng chính nhưng không có khóa ngoại, vì SQLite không
+     * cho phép khóa ngoại giữa hai cơ sở dữ liệu. Phải gọi ngoài transaction.
+     * 
+     * @param archivePath Đường dẫn file lưu trữ (":memory:" để dùng bộ nhớ)
+     * @return Kết quả thành công hoặc lỗi
+     */
+    std::expected<bool, Error> attachArchive(const std::string& archivePath);
+
+    /**
+     * @brief Tạo các bảng của một phân vùng (shard) theo khoa nếu chưa có
+     * 
+     * Shard chỉ chứa các bảng ghi nhiều theo sinh viên (Enrollments, CourseResults, FeeRecords,
+     * FeePayments) với cùng cột như cơ sở dữ liệu chính. Khóa ngoại tới Users/Courses/Terms và các
+     * trigger đếm chỗ, khóa học kỳ nằm ở cơ sở dữ liệu chính nên do DAO phân vùng kiểm tra thay.
+     * 
+     * @return Kết quả thành công hoặc lỗi
+     */
+    std::expected<bool, Error> ensureShardTablesExist();
 };
 
 #endif 
\ No newline at end of file
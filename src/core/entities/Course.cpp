@@ -2,13 +2,15 @@
 #include <sstream>
 #include "../../utils/StringUtils.h"
 
-Course::Course(std::string id, std::string name, int credits, std::string facultyId)
-    : _id(std::move(id)), _name(std::move(name)), _credits(credits), _facultyId(std::move(facultyId)) {}
+Course::Course(std::string id, std::string name, int credits, std::string facultyId, int capacity)
+    : _id(std::move(id)), _name(std::move(name)), _credits(credits), _facultyId(std::move(facultyId)), _capacity(capacity) {}
 
 const std::string& Course::getId() const { return _id; }
 const std::string& Course::getName() const { return _name; }
 int Course::getCredits() const { return _credits; }
 const std::string& Course::getFacultyId() const { return _facultyId; }
+int Course::getCapacity() const { return _capacity; }
+const std::vector<MeetingSlot>& Course::getMeetingSlots() const { return _meetingSlots; }
 
 bool Course::setName(const std::string& name) {
     std::string trimmed = StringUtils::trim(name);
@@ -32,6 +34,23 @@ bool Course::setFacultyId(const std::string& facultyId) {
     return true;
 }
 
+bool Course::setCapacity(int capacity) {
+    if (capacity < 0 || capacity > MAX_CAPACITY) return false;
+    _capacity = capacity;
+    return true;
+}
+
+bool Course::setMeetingSlots(std::vector<MeetingSlot> meetingSlots) {
+    for (std::size_t i = 0; i < meetingSlots.size(); ++i) {
+        if (!meetingSlots[i].validate().isValid) return false;
+        for (std::size_t j = 0; j < i; ++j) {
+            if (meetingSlots[i].overlaps(meetingSlots[j])) return false;
+        }
+    }
+    _meetingSlots = std::move(meetingSlots);
+    return true;
+}
+
 std::string Course::getStringId() const { return _id; }
 
 std::string Course::display() const {
@@ -41,6 +60,8 @@ std::string Course::display() const {
         << "Name       : " << _name << "\n"
         << "Credits    : " << _credits << "\n"
         << "Faculty ID : " << _facultyId << "\n"
+        << "Capacity   : " << (_capacity > 0 ? std::to_string(_capacity) : std::string("Unlimited")) << "\n"
+        << "Schedule   : " << (_meetingSlots.empty() ? std::string("Not scheduled") : MeetingSlot::formatSchedule(_meetingSlots)) << "\n"
         << "------------------------";
     return oss.str();
 }
@@ -56,5 +77,17 @@ ValidationResult Course::validateBasic() const {
     if (_credits <= 0 || _credits > 10) vr.addError(ErrorCode::VALIDATION_ERROR, "Credits must be between 1 and 10.");
 
     if (StringUtils::trim(_facultyId).empty()) vr.addError(ErrorCode::VALIDATION_ERROR, "Faculty ID for course cannot be empty.");
+
+    if (_capacity < 0 || _capacity > MAX_CAPACITY) vr.addError(ErrorCode::VALIDATION_ERROR, "Capacity must be between 0 (unlimited) and " + std::to_string(MAX_CAPACITY) + ".");
+
+    for (std::size_t i = 0; i < _meetingSlots.size(); ++i) {
+        ValidationResult slotVr = _meetingSlots[i].validate();
+        if (!slotVr.isValid) vr.addError(ErrorCode::VALIDATION_ERROR, "Invalid meeting '" + _meetingSlots[i].toString() + "': " + slotVr.getErrorMessagesCombined(" "));
+        for (std::size_t j = 0; j < i; ++j) {
+            if (_meetingSlots[i].overlaps(_meetingSlots[j])) {
+                vr.addError(ErrorCode::VALIDATION_ERROR, "Meetings '" + _meetingSlots[j].toString() + "' and '" + _meetingSlots[i].toString() + "' overlap.");
+            }
+        }
+    }
     return vr;
 }
\ No newline at end of file
@@ -10,7 +10,9 @@
 #define COURSE_H
 
 #include "IEntity.h"
+#include "MeetingSlot.h"
 #include <string>
+#include <vector>
 
 /**
  * @class Course
@@ -25,6 +27,8 @@ private:
     std::string _name;       ///< Tên môn học (e.g., "Introduction to Programming")
     int _credits;            ///< Số tín chỉ
     std::string _facultyId;  ///< Khoa quản lý môn học
+    int _capacity;           ///< Số chỗ tối đa, 0 nghĩa là không giới hạn
+    std::vector<MeetingSlot> _meetingSlots; ///< Các buổi học hằng tuần (rỗng nếu chưa xếp lịch)
 
 public:
     /**
@@ -34,8 +38,9 @@ public:
      * @param name Tên môn học
      * @param credits Số tín chỉ
      * @param facultyId Mã khoa quản lý môn học
+     * @param capacity Số chỗ tối đa (0 = không giới hạn)
      */
-    Course(std::string id, std::string name, int credits, std::string facultyId);
+    Course(std::string id, std::string name, int credits, std::string facultyId, int capacity = 0);
 
     /**
      * @brief Lấy mã môn học
@@ -61,6 +66,18 @@ public:
      */
     const std::string& getFacultyId() const;
 
+    /**
+     * @brief Lấy số chỗ tối đa của môn học
+     * @return Số chỗ tối đa, 0 nếu không giới hạn
+     */
+    int getCapacity() const;
+
+    /**
+     * @brief Lấy lịch học hằng tuần của môn học
+     * @return Các buổi học, rỗng nếu chưa xếp lịch
+     */
+    const std::vector<MeetingSlot>& getMeetingSlots() const;
+
     /**
      * @brief Đặt tên cho môn học
      * @param name Tên mới
@@ -82,6 +99,22 @@ public:
      */
     bool setFacultyId(const std::string& facultyId);
 
+    /**
+     * @brief Đặt số chỗ tối đa cho môn học
+     * @param capacity Số chỗ mới (0 = không giới hạn, tối đa MAX_CAPACITY)
+     * @return true nếu thành công, false nếu thất bại
+     */
+    bool setCapacity(int capacity);
+
+    /**
+     * @brief Đặt lịch học hằng tuần cho môn học
+     * @param meetingSlots Các buổi học (mỗi buổi hợp lệ và không trùng giờ nhau)
+     * @return true nếu thành công, false nếu thất bại
+     */
+    bool setMeetingSlots(std::vector<MeetingSlot> meetingSlots);
+
+    static constexpr int MAX_CAPACITY = 10000; ///< Giới hạn trên hợp lý của số chỗ một môn học
+
     /**
      * @brief Lấy ID của môn học dưới dạng chuỗi
      * @return ID của môn học
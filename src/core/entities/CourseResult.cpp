@@ -2,6 +2,7 @@
 #include <stdexcept> // For std::to_string in toString
 #include <sstream>   // For toString
 #include "../../utils/StringUtils.h" 
+#include "../../common/GradeScale.h"
 
 CourseResult::CourseResult(std::string studentId, std::string courseId, int marks)
     : _studentId(std::move(studentId)), _courseId(std::move(courseId)), _marks(-1), _grade('-') {
@@ -9,19 +10,16 @@ CourseResult::CourseResult(std::string studentId, std::string courseId, int mark
 }
 
 void CourseResult::calculateGrade() {
-    if (_marks < 0) _grade = '-';
-    else if (_marks < 40) _grade = 'F';  // Dưới 40 là F
-    else if (_marks < 55) _grade = 'D';  // 40-54 là D
-    else if (_marks < 70) _grade = 'C';  // 55-69 là C
-    else if (_marks < 85) _grade = 'B';  // 70-84 là B
-    else if (_marks <= 100) _grade = 'A'; // 85-100 là A
-    else _grade = '?'; 
+    // F < 40 <= D < 55 <= C < 70 <= B < 85 <= A <= 100 (xem GradeScale.h)
+    _grade = GradeScale::gradeFromMarks(_marks);
 }
 
 const std::string& CourseResult::getStudentId() const { return _studentId; }
 const std::string& CourseResult::getCourseId() const { return _courseId; }
 int CourseResult::getMarks() const { return _marks; }
 char CourseResult::getGrade() const { return _grade; }
+const std::string& CourseResult::getTermId() const { return _termId; }
+void CourseResult::setTermId(std::string termId) { _termId = std::move(termId); }
 
 bool CourseResult::setMarks(int marks) {
     if (marks < -1 || marks > 100) { // -1 cho phép "chưa nhập điểm"
@@ -25,6 +25,7 @@ private:
     std::string _courseId; ///< Mã khóa học
     int _marks;   ///< Điểm số (từ -1 đến 100, -1 là chưa có điểm)
     char _grade;  ///< Xếp loại (A, B, C, D, F, - (chưa xếp loại))
+    std::string _termId; ///< Mã học kỳ (rỗng nếu chưa gán học kỳ)
 
     /**
      * @brief Tính toán xếp loại dựa trên điểm số
@@ -67,6 +68,18 @@ public:
      */
     char getGrade() const;
 
+    /**
+     * @brief Lấy mã học kỳ
+     * @return Mã học kỳ, rỗng nếu chưa gán học kỳ
+     */
+    const std::string& getTermId() const;
+
+    /**
+     * @brief Gán học kỳ cho kết quả
+     * @param termId Mã học kỳ (rỗng để giữ học kỳ đang lưu khi ghi)
+     */
+    void setTermId(std::string termId);
+
     /**
      * @brief Đặt điểm số
      * 
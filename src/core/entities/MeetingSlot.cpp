@@ -0,0 +1,82 @@
+#include "MeetingSlot.h"
+#include <array>
+#include <cstdio>
+#include <sstream>
+#include "../../utils/StringUtils.h"
+
+namespace {
+    const std::array<const char*, 7> WEEKDAY_NAMES = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+
+    int parseWeekday(const std::string& name) {
+        for (std::size_t i = 0; i < WEEKDAY_NAMES.size(); ++i) {
+            if (StringUtils::toLower(name) == StringUtils::toLower(WEEKDAY_NAMES[i])) return static_cast<int>(i) + 1;
+        }
+        return 0;
+    }
+
+    std::string formatTime(int minute) {
+        char buffer[16]; // Đủ cho mọi giá trị int, kể cả phút âm chưa qua validate()
+        std::snprintf(buffer, sizeof(buffer), "%02d:%02d", minute / 60, minute % 60);
+        return buffer;
+    }
+}
+
+bool MeetingSlot::overlaps(const MeetingSlot& other) const {
+    return weekday == other.weekday && startMinute < other.endMinute && other.startMinute < endMinute;
+}
+
+ValidationResult MeetingSlot::validate() const {
+    ValidationResult vr;
+    if (weekday < 1 || weekday > 7) vr.addError(ErrorCode::VALIDATION_ERROR, "Meeting weekday must be between 1 (Mon) and 7 (Sun).");
+    if (startMinute < 0 || endMinute > MINUTES_PER_DAY || startMinute >= endMinute) {
+        vr.addError(ErrorCode::VALIDATION_ERROR, "Meeting time must be a non-empty range within one day.");
+    }
+    if (startMinute % SLOT_MINUTES != 0 || endMinute % SLOT_MINUTES != 0) {
+        vr.addError(ErrorCode::VALIDATION_ERROR, "Meeting times must be multiples of " + std::to_string(SLOT_MINUTES) + " minutes.");
+    }
+    if (room.empty() || room.length() > 20 || room.find_first_of(" \t,;") != std::string::npos) {
+        vr.addError(ErrorCode::VALIDATION_ERROR, "Meeting room must be 1-20 characters without spaces, ',' or ';'.");
+    }
+    return vr;
+}
+
+std::string MeetingSlot::toString() const {
+    std::string day = (weekday >= 1 && weekday <= 7) ? WEEKDAY_NAMES[static_cast<std::size_t>(weekday - 1)] : "?";
+    return day + " " + formatTime(startMinute) + "-" + formatTime(endMinute) + " " + room;
+}
+
+std::expected<std::vector<MeetingSlot>, Error> MeetingSlot::parseSchedule(const std::string& text) {
+    std::vector<MeetingSlot> slots;
+    for (const auto& part : StringUtils::split(text, ';')) {
+        std::string item = StringUtils::trim(part);
+        if (item.empty()) continue;
+
+        std::istringstream iss(item);
+        std::string dayName, timeRange, room, extra;
+        iss >> dayName >> timeRange >> room;
+        int startHour = 0, startMin = 0, endHour = 0, endMin = 0;
+        char trailing = 0;
+        if (room.empty() || (iss >> extra) ||
+            std::sscanf(timeRange.c_str(), "%2d:%2d-%2d:%2d%c", &startHour, &startMin, &endHour, &endMin, &trailing) != 4 ||
+            startMin >= 60 || endMin >= 60) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid meeting '" + item + "'. Expected e.g. 'Mon 07:30-09:30 E301'."});
+        }
+
+        MeetingSlot slot{parseWeekday(dayName), startHour * 60 + startMin, endHour * 60 + endMin, room};
+        ValidationResult vr = slot.validate();
+        if (!vr.isValid) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid meeting '" + item + "': " + vr.getErrorMessagesCombined(" ")});
+        }
+        slots.push_back(std::move(slot));
+    }
+    return slots;
+}
+
+std::string MeetingSlot::formatSchedule(const std::vector<MeetingSlot>& slots) {
+    std::string text;
+    for (const auto& slot : slots) {
+        if (!text.empty()) text += "; ";
+        text += slot.toString();
+    }
+    return text;
+}
@@ -0,0 +1,62 @@
+#ifndef MEETINGSLOT_H
+#define MEETINGSLOT_H
+
+/**
+ * @file MeetingSlot.h
+ * @brief Định nghĩa MeetingSlot - một buổi học cố định hằng tuần của khóa học
+ *
+ * Lịch học của khóa học được lưu dạng một chuỗi (cột schedule), ví dụ
+ * "Mon 07:30-09:30 E301; Wed 13:00-15:00 F201". Giờ bắt đầu/kết thúc phải là bội số của
+ * SLOT_MINUTES để thời khóa biểu dạng bitset (xem TimetableIndex) biểu diễn chính xác.
+ */
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../common/ErrorType.h"
+#include "../../common/ValidationResult.h"
+
+/**
+ * @struct MeetingSlot
+ * @brief Một buổi học: thứ trong tuần, khoảng giờ [startMinute, endMinute) và phòng học
+ */
+struct MeetingSlot {
+    static constexpr int SLOT_MINUTES = 5;       ///< Độ phân giải của giờ học (phút)
+    static constexpr int MINUTES_PER_DAY = 1440; ///< Số phút trong một ngày
+
+    int weekday = 1;      ///< Thứ trong tuần: 1 = Thứ Hai ... 7 = Chủ Nhật
+    int startMinute = 0;  ///< Giờ bắt đầu, số phút kể từ 00:00
+    int endMinute = 0;    ///< Giờ kết thúc (không bao gồm), số phút kể từ 00:00
+    std::string room;     ///< Phòng học (không chứa khoảng trắng, ',' hoặc ';')
+
+    /**
+     * @brief Hai buổi học có trùng giờ hay không (cùng thứ và khoảng giờ giao nhau)
+     */
+    bool overlaps(const MeetingSlot& other) const;
+
+    /**
+     * @brief Kiểm tra tính hợp lệ của buổi học
+     */
+    ValidationResult validate() const;
+
+    /**
+     * @brief Chuỗi hiển thị, ví dụ "Mon 07:30-09:30 E301"
+     */
+    std::string toString() const;
+
+    bool operator==(const MeetingSlot& other) const = default;
+
+    /**
+     * @brief Đọc lịch học từ chuỗi các buổi phân cách bởi ';' (chuỗi rỗng là chưa có lịch)
+     * @param text Chuỗi lịch học, ví dụ "Mon 07:30-09:30 E301; Wed 13:00-15:00 F201"
+     * @return Danh sách buổi học theo thứ tự trong chuỗi, hoặc Error (VALIDATION_ERROR) nếu sai định dạng
+     */
+    static std::expected<std::vector<MeetingSlot>, Error> parseSchedule(const std::string& text);
+
+    /**
+     * @brief Ghi lịch học thành chuỗi mà parseSchedule() đọc lại được
+     */
+    static std::string formatSchedule(const std::vector<MeetingSlot>& slots);
+};
+
+#endif // MEETINGSLOT_H
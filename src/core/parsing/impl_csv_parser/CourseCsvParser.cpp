@@ -0,0 +1,43 @@
+#include "CourseCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& CourseCsvParser::columns() {
+    static const std::vector<std::string> cols = {"id", "name", "credits", "facultyId", "capacity", "schedule"};
+    return cols;
+}
+
+std::expected<Course, Error> CourseCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "Course"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Course ID is empty in CSV row."});
+    }
+    auto meetingSlots = MeetingSlot::parseSchedule(row[SCHEDULE]);
+    if (!meetingSlots) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Course schedule invalid in CSV row: " + meetingSlots.error().message});
+    }
+    Course course(row[ID], row[NAME], static_cast<int>(CsvParserUtils::toLongLong(row[CREDITS])), row[FACULTY_ID],
+                  static_cast<int>(CsvParserUtils::toLongLong(row[CAPACITY])));
+    if (!course.setMeetingSlots(std::move(meetingSlots.value()))) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Course schedule has overlapping meetings in CSV row."});
+    }
+    return course;
+}
+
+std::expected<CsvRow, Error> CourseCsvParser::serialize(const Course& course) const {
+    return CsvRow{course.getId(), course.getName(), std::to_string(course.getCredits()), course.getFacultyId(),
+                  std::to_string(course.getCapacity()), MeetingSlot::formatSchedule(course.getMeetingSlots())};
+}
+
+std::expected<std::vector<std::any>, Error> CourseCsvParser::toQueryInsertParams(const Course& course) const {
+    auto row = serialize(course);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> CourseCsvParser::toQueryUpdateParams(const Course& course) const {
+    auto row = serialize(course);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 1);
+}
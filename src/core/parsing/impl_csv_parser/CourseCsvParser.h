@@ -0,0 +1,38 @@
+#ifndef COURSECSVPARSER_H
+#define COURSECSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../entities/Course.h"
+#include <any>
+
+/**
+ * @class CourseCsvParser
+ * @brief Chuyển đổi giữa Course và một bản ghi CSV
+ *
+ * Thứ tự cột: id, name, credits, facultyId, capacity, schedule.
+ */
+class CourseCsvParser : public IEntityParser<Course, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { ID = 0, NAME = 1, CREDITS = 2, FACULTY_ID = 3, CAPACITY = 4, SCHEDULE = 5, COLUMN_COUNT = 6 };
+
+    CourseCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<Course, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const Course& course) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const Course& course) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const Course& course) const override;
+};
+
+#endif // COURSECSVPARSER_H
@@ -0,0 +1,36 @@
+#include "CourseResultCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& CourseResultCsvParser::columns() {
+    static const std::vector<std::string> cols = {"studentId", "courseId", "marks", "termId"};
+    return cols;
+}
+
+std::expected<CourseResult, Error> CourseResultCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "CourseResult"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[STUDENT_ID].empty() || row[COURSE_ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "StudentId or CourseId is empty in CourseResult CSV row."});
+    }
+    CourseResult result(row[STUDENT_ID], row[COURSE_ID], static_cast<int>(CsvParserUtils::toLongLong(row[MARKS], -1)));
+    result.setTermId(row[TERM_ID]);
+    return result;
+}
+
+std::expected<CsvRow, Error> CourseResultCsvParser::serialize(const CourseResult& result) const {
+    return CsvRow{result.getStudentId(), result.getCourseId(),
+                  result.getMarks() == -1 ? std::string{} : std::to_string(result.getMarks()), result.getTermId()};
+}
+
+std::expected<std::vector<std::any>, Error> CourseResultCsvParser::toQueryInsertParams(const CourseResult& result) const {
+    auto row = serialize(result);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> CourseResultCsvParser::toQueryUpdateParams(const CourseResult& result) const {
+    auto row = serialize(result);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 2);
+}
@@ -0,0 +1,38 @@
+#ifndef COURSERESULTCSVPARSER_H
+#define COURSERESULTCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../entities/CourseResult.h"
+#include <any>
+
+/**
+ * @class CourseResultCsvParser
+ * @brief Chuyển đổi giữa CourseResult và một bản ghi CSV
+ *
+ * Thứ tự cột: studentId, courseId, marks (để trống khi chưa có điểm). Điểm chữ luôn được tính lại nên không lưu.
+ */
+class CourseResultCsvParser : public IEntityParser<CourseResult, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { STUDENT_ID = 0, COURSE_ID = 1, MARKS = 2, TERM_ID = 3, COLUMN_COUNT = 4 };
+
+    CourseResultCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<CourseResult, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const CourseResult& result) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const CourseResult& result) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const CourseResult& result) const override;
+};
+
+#endif // COURSERESULTCSVPARSER_H
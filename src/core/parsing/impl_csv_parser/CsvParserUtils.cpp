@@ -0,0 +1,84 @@
+#include "CsvParserUtils.h"
+#include "../../entities/User.h"
+#include "../../../common/UserRole.h"
+#include "../../../common/LoginStatus.h"
+#include <charconv>
+
+namespace CsvParserUtils {
+
+const std::vector<std::string>& userColumns() {
+    static const std::vector<std::string> columns = {
+        "id", "firstName", "lastName", "birthDay", "birthMonth", "birthYear",
+        "address", "citizenId", "email", "phoneNumber", "role", "status"
+    };
+    return columns;
+}
+
+long long toLongLong(const std::string& field, long long defaultValue) {
+    long long value = 0;
+    const char* begin = field.data();
+    const char* end = begin + field.size();
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    if (ec != std::errc() || ptr != end) return defaultValue;
+    return value;
+}
+
+std::expected<bool, Error> checkFieldCount(const CsvRow& row, std::size_t expected, const std::string& entityName) {
+    if (row.size() != expected) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, entityName + " CSV row has " + std::to_string(row.size()) +
+                                     " fields, expected " + std::to_string(expected) + "."});
+    }
+    return true;
+}
+
+void readUserFields(const CsvRow& row, User& user) {
+    user.setRole(static_cast<UserRole>(toLongLong(row[10], static_cast<long long>(UserRole::UNKNOWN))));
+    user.setStatus(static_cast<LoginStatus>(toLongLong(row[11], static_cast<long long>(LoginStatus::DISABLED))));
+    user.setAddress(row[6]);
+    user.setCitizenId(row[7]);
+    user.setEmail(row[8]);
+    user.setPhoneNumber(row[9]);
+
+    int day = static_cast<int>(toLongLong(row[3]));
+    int month = static_cast<int>(toLongLong(row[4]));
+    int year = static_cast<int>(toLongLong(row[5]));
+    if (day != 0 && month != 0 && year != 0) {
+        user.setBirthday(day, month, year);
+    }
+}
+
+void appendUserFields(CsvRow& row, const User& user) {
+    row.push_back(user.getId());
+    row.push_back(user.getFirstName());
+    row.push_back(user.getLastName());
+    if (user.getBirthday().isSet()) {
+        row.push_back(std::to_string(user.getBirthday().getDay()));
+        row.push_back(std::to_string(user.getBirthday().getMonth()));
+        row.push_back(std::to_string(user.getBirthday().getYear()));
+    } else {
+        row.insert(row.end(), 3, std::string{}); // Để trống như NULL trong SQL
+    }
+    row.push_back(user.getAddress());
+    row.push_back(user.getCitizenId());
+    row.push_back(user.getEmail());
+    row.push_back(user.getPhoneNumber());
+    row.push_back(std::to_string(static_cast<int>(user.getRole())));
+    row.push_back(std::to_string(static_cast<int>(user.getStatus())));
+}
+
+std::vector<std::any> toAnyParams(const CsvRow& row) {
+    std::vector<std::any> params;
+    params.reserve(row.size());
+    for (const auto& field : row) params.emplace_back(field);
+    return params;
+}
+
+std::vector<std::any> toAnyUpdateParams(const CsvRow& row, std::size_t keyColumnCount) {
+    std::vector<std::any> params;
+    params.reserve(row.size());
+    for (std::size_t i = keyColumnCount; i < row.size(); ++i) params.emplace_back(row[i]);
+    for (std::size_t i = 0; i < keyColumnCount && i < row.size(); ++i) params.emplace_back(row[i]);
+    return params;
+}
+
+} // namespace CsvParserUtils
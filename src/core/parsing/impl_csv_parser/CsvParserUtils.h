@@ -0,0 +1,73 @@
+/**
+ * @file CsvParserUtils.h
+ * @brief Định nghĩa các hàm tiện ích cho việc phân tích dữ liệu CSV
+ *
+ * Namespace CsvParserUtils cung cấp các hàm chuyển đổi kiểu an toàn cho trường CSV
+ * và phần đọc/ghi chung các cột của User mà StudentCsvParser và TeacherCsvParser dùng chung.
+ */
+#ifndef CSVPARSERUTILS_H
+#define CSVPARSERUTILS_H
+
+#include <string>
+#include <vector>
+#include <any>
+#include <expected>
+#include "../interface/IEntityParser.h"
+#include "../../../common/ErrorType.h"
+
+class User;
+
+/**
+ * @namespace CsvParserUtils
+ * @brief Namespace chứa các hàm tiện ích xử lý dữ liệu CSV
+ */
+namespace CsvParserUtils {
+
+    /**
+     * @brief Số cột chung của User ở đầu mỗi bản ghi Student/Teacher
+     *
+     * Thứ tự: id, firstName, lastName, birthDay, birthMonth, birthYear,
+     * address, citizenId, email, phoneNumber, role, status
+     */
+    constexpr std::size_t USER_COLUMN_COUNT = 12;
+
+    /**
+     * @brief Tên các cột chung của User theo đúng thứ tự lưu
+     */
+    const std::vector<std::string>& userColumns();
+
+    /**
+     * @brief Chuyển trường thành số nguyên
+     * @param field Giá trị trường
+     * @param defaultValue Giá trị trả về nếu trường rỗng hoặc không phải số
+     */
+    long long toLongLong(const std::string& field, long long defaultValue = 0);
+
+    /**
+     * @brief Kiểm tra số trường của bản ghi
+     * @return true nếu đúng số trường, hoặc Error PARSING_ERROR
+     */
+    std::expected<bool, Error> checkFieldCount(const CsvRow& row, std::size_t expected, const std::string& entityName);
+
+    /**
+     * @brief Đọc các cột chung của User (bắt đầu từ cột 0) vào đối tượng
+     */
+    void readUserFields(const CsvRow& row, User& user);
+
+    /**
+     * @brief Ghi các cột chung của User vào cuối bản ghi
+     */
+    void appendUserFields(CsvRow& row, const User& user);
+
+    /**
+     * @brief Bọc các trường thành tham số std::any
+     */
+    std::vector<std::any> toAnyParams(const CsvRow& row);
+
+    /**
+     * @brief Bọc các trường thành tham số std::any, chuyển các cột khóa xuống cuối (giống quy ước UPDATE ... WHERE của SQL parser)
+     */
+    std::vector<std::any> toAnyUpdateParams(const CsvRow& row, std::size_t keyColumnCount);
+}
+
+#endif // CSVPARSERUTILS_H
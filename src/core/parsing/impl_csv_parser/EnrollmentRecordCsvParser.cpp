@@ -0,0 +1,33 @@
+#include "EnrollmentRecordCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& EnrollmentRecordCsvParser::columns() {
+    static const std::vector<std::string> cols = {"studentId", "courseId", "termId"};
+    return cols;
+}
+
+std::expected<EnrollmentRecord, Error> EnrollmentRecordCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "EnrollmentRecord"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[STUDENT_ID].empty() || row[COURSE_ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "StudentId or CourseId is empty in enrollment CSV row."});
+    }
+    return EnrollmentRecord{row[STUDENT_ID], row[COURSE_ID], row[TERM_ID]};
+}
+
+std::expected<CsvRow, Error> EnrollmentRecordCsvParser::serialize(const EnrollmentRecord& record) const {
+    return CsvRow{record.studentId, record.courseId, record.termId};
+}
+
+std::expected<std::vector<std::any>, Error> EnrollmentRecordCsvParser::toQueryInsertParams(const EnrollmentRecord& record) const {
+    auto row = serialize(record);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> EnrollmentRecordCsvParser::toQueryUpdateParams(const EnrollmentRecord& record) const {
+    auto row = serialize(record);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 2);
+}
@@ -0,0 +1,38 @@
+#ifndef ENROLLMENTRECORDCSVPARSER_H
+#define ENROLLMENTRECORDCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../data_access/interface/IEnrollmentDao.h"
+#include <any>
+
+/**
+ * @class EnrollmentRecordCsvParser
+ * @brief Chuyển đổi giữa EnrollmentRecord và một bản ghi CSV
+ *
+ * Thứ tự cột: studentId, courseId.
+ */
+class EnrollmentRecordCsvParser : public IEntityParser<EnrollmentRecord, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { STUDENT_ID = 0, COURSE_ID = 1, TERM_ID = 2, COLUMN_COUNT = 3 };
+
+    EnrollmentRecordCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<EnrollmentRecord, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const EnrollmentRecord& record) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const EnrollmentRecord& record) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const EnrollmentRecord& record) const override;
+};
+
+#endif // ENROLLMENTRECORDCSVPARSER_H
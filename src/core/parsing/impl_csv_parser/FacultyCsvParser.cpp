@@ -0,0 +1,33 @@
+#include "FacultyCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& FacultyCsvParser::columns() {
+    static const std::vector<std::string> cols = {"id", "name"};
+    return cols;
+}
+
+std::expected<Faculty, Error> FacultyCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "Faculty"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Faculty ID is empty in CSV row."});
+    }
+    return Faculty(row[ID], row[NAME]);
+}
+
+std::expected<CsvRow, Error> FacultyCsvParser::serialize(const Faculty& faculty) const {
+    return CsvRow{faculty.getId(), faculty.getName()};
+}
+
+std::expected<std::vector<std::any>, Error> FacultyCsvParser::toQueryInsertParams(const Faculty& faculty) const {
+    auto row = serialize(faculty);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> FacultyCsvParser::toQueryUpdateParams(const Faculty& faculty) const {
+    auto row = serialize(faculty);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 1);
+}
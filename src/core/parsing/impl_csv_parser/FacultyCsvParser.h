@@ -0,0 +1,38 @@
+#ifndef FACULTYCSVPARSER_H
+#define FACULTYCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../entities/Faculty.h"
+#include <any>
+
+/**
+ * @class FacultyCsvParser
+ * @brief Chuyển đổi giữa Faculty và một bản ghi CSV
+ *
+ * Thứ tự cột: id, name.
+ */
+class FacultyCsvParser : public IEntityParser<Faculty, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { ID = 0, NAME = 1, COLUMN_COUNT = 2 };
+
+    FacultyCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<Faculty, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const Faculty& faculty) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const Faculty& faculty) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const Faculty& faculty) const override;
+};
+
+#endif // FACULTYCSVPARSER_H
@@ -0,0 +1,34 @@
+#include "FeeRecordCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& FeeRecordCsvParser::columns() {
+    static const std::vector<std::string> cols = {"studentId", "totalFee", "paidFee"};
+    return cols;
+}
+
+std::expected<FeeRecord, Error> FeeRecordCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "FeeRecord"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[STUDENT_ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Student ID is empty in FeeRecord CSV row."});
+    }
+    return FeeRecord(row[STUDENT_ID], static_cast<long>(CsvParserUtils::toLongLong(row[TOTAL_FEE])),
+                     static_cast<long>(CsvParserUtils::toLongLong(row[PAID_FEE])));
+}
+
+std::expected<CsvRow, Error> FeeRecordCsvParser::serialize(const FeeRecord& feeRecord) const {
+    return CsvRow{feeRecord.getStudentId(), std::to_string(feeRecord.getTotalFee()), std::to_string(feeRecord.getPaidFee())};
+}
+
+std::expected<std::vector<std::any>, Error> FeeRecordCsvParser::toQueryInsertParams(const FeeRecord& feeRecord) const {
+    auto row = serialize(feeRecord);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> FeeRecordCsvParser::toQueryUpdateParams(const FeeRecord& feeRecord) const {
+    auto row = serialize(feeRecord);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 1);
+}
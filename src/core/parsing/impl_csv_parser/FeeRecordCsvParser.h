@@ -0,0 +1,38 @@
+#ifndef FEERECORDCSVPARSER_H
+#define FEERECORDCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../entities/FeeRecord.h"
+#include <any>
+
+/**
+ * @class FeeRecordCsvParser
+ * @brief Chuyển đổi giữa FeeRecord và một bản ghi CSV
+ *
+ * Thứ tự cột: studentId, totalFee, paidFee.
+ */
+class FeeRecordCsvParser : public IEntityParser<FeeRecord, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { STUDENT_ID = 0, TOTAL_FEE = 1, PAID_FEE = 2, COLUMN_COUNT = 3 };
+
+    FeeRecordCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<FeeRecord, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const FeeRecord& feeRecord) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const FeeRecord& feeRecord) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const FeeRecord& feeRecord) const override;
+};
+
+#endif // FEERECORDCSVPARSER_H
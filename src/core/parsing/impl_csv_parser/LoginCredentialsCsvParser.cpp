@@ -0,0 +1,42 @@
+#include "LoginCredentialsCsvParser.h"
+#include "CsvParserUtils.h"
+#include "../../../common/UserRole.h"
+#include "../../../common/LoginStatus.h"
+
+const std::vector<std::string>& LoginCredentialsCsvParser::columns() {
+    static const std::vector<std::string> cols = {"userId", "passwordHash", "salt", "role", "status"};
+    return cols;
+}
+
+std::expected<LoginCredentials, Error> LoginCredentialsCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "LoginCredentials"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[USER_ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "User ID is empty in login CSV row."});
+    }
+    LoginCredentials credentials;
+    credentials.userId = row[USER_ID];
+    credentials.passwordHash = row[PASSWORD_HASH];
+    credentials.salt = row[SALT];
+    credentials.role = static_cast<UserRole>(CsvParserUtils::toLongLong(row[ROLE], static_cast<long long>(UserRole::UNKNOWN)));
+    credentials.status = static_cast<LoginStatus>(CsvParserUtils::toLongLong(row[STATUS], static_cast<long long>(LoginStatus::DISABLED)));
+    return credentials;
+}
+
+std::expected<CsvRow, Error> LoginCredentialsCsvParser::serialize(const LoginCredentials& credentials) const {
+    return CsvRow{credentials.userId, credentials.passwordHash, credentials.salt,
+                  std::to_string(static_cast<int>(credentials.role)), std::to_string(static_cast<int>(credentials.status))};
+}
+
+std::expected<std::vector<std::any>, Error> LoginCredentialsCsvParser::toQueryInsertParams(const LoginCredentials& credentials) const {
+    auto row = serialize(credentials);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> LoginCredentialsCsvParser::toQueryUpdateParams(const LoginCredentials& credentials) const {
+    auto row = serialize(credentials);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 1);
+}
@@ -0,0 +1,38 @@
+#ifndef LOGINCREDENTIALSCSVPARSER_H
+#define LOGINCREDENTIALSCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../data_access/interface/ILoginDao.h"
+#include <any>
+
+/**
+ * @class LoginCredentialsCsvParser
+ * @brief Chuyển đổi giữa LoginCredentials và một bản ghi CSV
+ *
+ * Thứ tự cột: userId, passwordHash, salt, role, status (role và status lưu dạng số như bảng Logins).
+ */
+class LoginCredentialsCsvParser : public IEntityParser<LoginCredentials, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { USER_ID = 0, PASSWORD_HASH = 1, SALT = 2, ROLE = 3, STATUS = 4, COLUMN_COUNT = 5 };
+
+    LoginCredentialsCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<LoginCredentials, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const LoginCredentials& credentials) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const LoginCredentials& credentials) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const LoginCredentials& credentials) const override;
+};
+
+#endif // LOGINCREDENTIALSCSVPARSER_H
@@ -0,0 +1,33 @@
+#include "SalaryRecordCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& SalaryRecordCsvParser::columns() {
+    static const std::vector<std::string> cols = {"teacherId", "basicMonthlyPay"};
+    return cols;
+}
+
+std::expected<SalaryRecord, Error> SalaryRecordCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "SalaryRecord"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[TEACHER_ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Teacher ID is empty in SalaryRecord CSV row."});
+    }
+    return SalaryRecord(row[TEACHER_ID], static_cast<long>(CsvParserUtils::toLongLong(row[BASIC_MONTHLY_PAY])));
+}
+
+std::expected<CsvRow, Error> SalaryRecordCsvParser::serialize(const SalaryRecord& salaryRecord) const {
+    return CsvRow{salaryRecord.getTeacherId(), std::to_string(salaryRecord.getBasicMonthlyPay())};
+}
+
+std::expected<std::vector<std::any>, Error> SalaryRecordCsvParser::toQueryInsertParams(const SalaryRecord& salaryRecord) const {
+    auto row = serialize(salaryRecord);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> SalaryRecordCsvParser::toQueryUpdateParams(const SalaryRecord& salaryRecord) const {
+    auto row = serialize(salaryRecord);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 1);
+}
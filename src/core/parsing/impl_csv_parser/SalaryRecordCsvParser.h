@@ -0,0 +1,38 @@
+#ifndef SALARYRECORDCSVPARSER_H
+#define SALARYRECORDCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../entities/SalaryRecord.h"
+#include <any>
+
+/**
+ * @class SalaryRecordCsvParser
+ * @brief Chuyển đổi giữa SalaryRecord và một bản ghi CSV
+ *
+ * Thứ tự cột: teacherId, basicMonthlyPay.
+ */
+class SalaryRecordCsvParser : public IEntityParser<SalaryRecord, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { TEACHER_ID = 0, BASIC_MONTHLY_PAY = 1, COLUMN_COUNT = 2 };
+
+    SalaryRecordCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<SalaryRecord, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const SalaryRecord& salaryRecord) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const SalaryRecord& salaryRecord) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const SalaryRecord& salaryRecord) const override;
+};
+
+#endif // SALARYRECORDCSVPARSER_H
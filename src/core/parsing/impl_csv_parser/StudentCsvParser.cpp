@@ -0,0 +1,43 @@
+#include "StudentCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& StudentCsvParser::columns() {
+    static const std::vector<std::string> cols = [] {
+        std::vector<std::string> c = CsvParserUtils::userColumns();
+        c.push_back("facultyId");
+        return c;
+    }();
+    return cols;
+}
+
+std::expected<Student, Error> StudentCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "Student"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Student ID is empty in CSV row."});
+    }
+    Student student(row[ID], row[1], row[2], row[FACULTY_ID]);
+    CsvParserUtils::readUserFields(row, student);
+    return student;
+}
+
+std::expected<CsvRow, Error> StudentCsvParser::serialize(const Student& student) const {
+    CsvRow row;
+    row.reserve(COLUMN_COUNT);
+    CsvParserUtils::appendUserFields(row, student);
+    row.push_back(student.getFacultyId());
+    return row;
+}
+
+std::expected<std::vector<std::any>, Error> StudentCsvParser::toQueryInsertParams(const Student& student) const {
+    auto row = serialize(student);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> StudentCsvParser::toQueryUpdateParams(const Student& student) const {
+    auto row = serialize(student);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 1);
+}
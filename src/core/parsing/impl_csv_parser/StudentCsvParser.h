@@ -0,0 +1,38 @@
+#ifndef STUDENTCSVPARSER_H
+#define STUDENTCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../entities/Student.h"
+#include <any>
+
+/**
+ * @class StudentCsvParser
+ * @brief Chuyển đổi giữa Student và một bản ghi CSV
+ *
+ * Thứ tự cột: các cột chung của User (CsvParserUtils::userColumns()), sau đó facultyId.
+ */
+class StudentCsvParser : public IEntityParser<Student, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { ID = 0, EMAIL = 8, STATUS = 11, FACULTY_ID = 12, COLUMN_COUNT = 13 };
+
+    StudentCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<Student, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const Student& student) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const Student& student) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const Student& student) const override;
+};
+
+#endif // STUDENTCSVPARSER_H
@@ -0,0 +1,51 @@
+#include "TeacherCsvParser.h"
+#include "CsvParserUtils.h"
+
+const std::vector<std::string>& TeacherCsvParser::columns() {
+    static const std::vector<std::string> cols = [] {
+        std::vector<std::string> c = CsvParserUtils::userColumns();
+        c.insert(c.end(), {"facultyId", "qualification", "specializationSubjects", "designation", "experienceYears"});
+        return c;
+    }();
+    return cols;
+}
+
+std::expected<Teacher, Error> TeacherCsvParser::parse(const CsvRow& row) const {
+    if (auto count = CsvParserUtils::checkFieldCount(row, COLUMN_COUNT, "Teacher"); !count) {
+        return std::unexpected(count.error());
+    }
+    if (row[ID].empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Teacher ID is empty in CSV row."});
+    }
+    Teacher teacher(row[ID], row[1], row[2], row[FACULTY_ID]);
+    CsvParserUtils::readUserFields(row, teacher);
+    teacher.setQualification(row[QUALIFICATION]);
+    teacher.setSpecializationSubjects(row[SPECIALIZATION_SUBJECTS]);
+    teacher.setDesignation(row[DESIGNATION]);
+    teacher.setExperienceYears(static_cast<int>(CsvParserUtils::toLongLong(row[EXPERIENCE_YEARS])));
+    return teacher;
+}
+
+std::expected<CsvRow, Error> TeacherCsvParser::serialize(const Teacher& teacher) const {
+    CsvRow row;
+    row.reserve(COLUMN_COUNT);
+    CsvParserUtils::appendUserFields(row, teacher);
+    row.push_back(teacher.getFacultyId());
+    row.push_back(teacher.getQualification());
+    row.push_back(teacher.getSpecializationSubjects());
+    row.push_back(teacher.getDesignation());
+    row.push_back(std::to_string(teacher.getExperienceYears()));
+    return row;
+}
+
+std::expected<std::vector<std::any>, Error> TeacherCsvParser::toQueryInsertParams(const Teacher& teacher) const {
+    auto row = serialize(teacher);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyParams(*row);
+}
+
+std::expected<std::vector<std::any>, Error> TeacherCsvParser::toQueryUpdateParams(const Teacher& teacher) const {
+    auto row = serialize(teacher);
+    if (!row) return std::unexpected(row.error());
+    return CsvParserUtils::toAnyUpdateParams(*row, 1);
+}
@@ -0,0 +1,39 @@
+#ifndef TEACHERCSVPARSER_H
+#define TEACHERCSVPARSER_H
+
+#include "../interface/IEntityParser.h"
+#include "../../entities/Teacher.h"
+#include <any>
+
+/**
+ * @class TeacherCsvParser
+ * @brief Chuyển đổi giữa Teacher và một bản ghi CSV
+ *
+ * Thứ tự cột: các cột chung của User (CsvParserUtils::userColumns()), sau đó facultyId,
+ * qualification, specializationSubjects, designation, experienceYears.
+ */
+class TeacherCsvParser : public IEntityParser<Teacher, CsvRow> {
+public:
+    /**
+     * @brief Vị trí các cột được DAO dùng làm khóa hoặc chỉ mục
+     */
+    enum Column : std::size_t { ID = 0, EMAIL = 8, FACULTY_ID = 12, QUALIFICATION = 13, SPECIALIZATION_SUBJECTS = 14, DESIGNATION = 15, EXPERIENCE_YEARS = 16, COLUMN_COUNT = 17 };
+
+    TeacherCsvParser() = default;
+
+    /**
+     * @brief Tên các cột theo thứ tự lưu trong file (dòng header)
+     */
+    static const std::vector<std::string>& columns();
+
+    std::expected<Teacher, Error> parse(const CsvRow& row) const override;
+    std::expected<CsvRow, Error> serialize(const Teacher& teacher) const override;
+
+    // Các trường đã serialize, dạng std::string trong std::any
+    std::expected<std::vector<std::any>, Error> toQueryInsertParams(const Teacher& teacher) const override;
+
+    // Như toQueryInsertParams nhưng các cột khóa được chuyển xuống cuối (giống WHERE của SQL parser)
+    std::expected<std::vector<std::any>, Error> toQueryUpdateParams(const Teacher& teacher) const override;
+};
+
+#endif // TEACHERCSVPARSER_H
@@ -33,7 +33,9 @@ std::expected<CourseResult, Error> CourseResultSqlParser::parse(const DbQueryRes
         // std::string grade_str = SqlParserUtils::getOptional<std::string>(row, "grade");
         // char grade = grade_str.empty() ? '-' : grade_str[0];
 
-        return CourseResult(studentId, courseId, marks);
+        CourseResult result(studentId, courseId, marks);
+        result.setTermId(SqlParserUtils::getOptional<std::string>(row, "termId")); // NULL -> rỗng
+        return result;
 
     } catch (const std::bad_any_cast& e) {
         return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Failed to parse CourseResult from SQL row: " + std::string(e.what())});
@@ -25,6 +25,11 @@ std::expected<Course, Error> CourseSqlParser::parse(const DbQueryResultRow& row)
         int credits = credits_val;
 
         std::string facultyId = SqlParserUtils::getOptional<std::string>(row, "facultyId");
+        int capacity = static_cast<int>(SqlParserUtils::getOptional<long long>(row, "capacity", 0LL));
+        auto meetingSlots = MeetingSlot::parseSchedule(SqlParserUtils::getOptional<std::string>(row, "schedule"));
+        if (!meetingSlots.has_value()) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Course schedule invalid in SQL row: " + meetingSlots.error().message});
+        }
 
         if (name.empty()) {
              return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Course name not found or empty in SQL row."});
@@ -35,7 +40,11 @@ std::expected<Course, Error> CourseSqlParser::parse(const DbQueryResultRow& row)
         // facultyId có thể null trong DB, Course constructor có thể cần điều chỉnh hoặc Course entity
         // chấp nhận facultyId rỗng và service sẽ validate sau. Giả sử Course entity chấp nhận.
 
-        return Course(id, name, credits, facultyId);
+        Course course(id, name, credits, facultyId, capacity);
+        if (!course.setMeetingSlots(std::move(meetingSlots.value()))) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Course schedule has overlapping meetings in SQL row."});
+        }
+        return course;
     } catch (const std::bad_any_cast& e) {
         return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Failed to parse Course from SQL row: " + std::string(e.what())});
     } catch (const std::exception& e) {
@@ -49,6 +58,8 @@ std::expected<DbQueryResultRow, Error> CourseSqlParser::serialize(const Course&
     row.emplace("name", course.getName());
     row.emplace("credits", course.getCredits());
     row.emplace("facultyId", course.getFacultyId().empty() ? std::any{} : std::any{course.getFacultyId()});
+    row.emplace("capacity", course.getCapacity());
+    row.emplace("schedule", MeetingSlot::formatSchedule(course.getMeetingSlots()));
     return row;
 }
 
@@ -58,6 +69,8 @@ std::expected<std::vector<std::any>, Error> CourseSqlParser::toQueryInsertParams
     params.push_back(course.getName());
     params.push_back(course.getCredits());
     params.push_back(course.getFacultyId().empty() ? std::any{} : std::any{course.getFacultyId()});
+    params.push_back(course.getCapacity());
+    params.push_back(MeetingSlot::formatSchedule(course.getMeetingSlots()));
     return params;
 }
 
@@ -66,6 +79,8 @@ std::expected<std::vector<std::any>, Error> CourseSqlParser::toQueryUpdateParams
     params.push_back(course.getName());
     params.push_back(course.getCredits());
     params.push_back(course.getFacultyId().empty() ? std::any{} : std::any{course.getFacultyId()});
+    params.push_back(course.getCapacity());
+    params.push_back(MeetingSlot::formatSchedule(course.getMeetingSlots()));
     params.push_back(course.getId()); // For WHERE clause
     return params;
 }
\ No newline at end of file
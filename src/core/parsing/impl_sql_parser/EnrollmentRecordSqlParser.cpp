@@ -6,6 +6,7 @@ std::expected<EnrollmentRecord, Error> EnrollmentRecordSqlParser::parse(const Db
         EnrollmentRecord record;
         record.studentId = SqlParserUtils::getOptional<std::string>(row, "studentId");
         record.courseId = SqlParserUtils::getOptional<std::string>(row, "courseId");
+        record.termId = SqlParserUtils::getOptional<std::string>(row, "termId"); // NULL -> rỗng
 
         if (record.studentId.empty() || record.courseId.empty()) {
             return std::unexpected(Error{ErrorCode::PARSING_ERROR, "studentId or courseId not found or empty in EnrollmentRecord SQL row."});
@@ -69,4 +69,10 @@ public:
  * @brief Kiểu dữ liệu đại diện cho một hàng kết quả từ truy vấn cơ sở dữ liệu
  */
 using DbQueryResultRow = std::map<std::string, std::any>;
+
+/**
+ * @typedef CsvRow
+ * @brief Kiểu dữ liệu đại diện cho một bản ghi CSV (các trường theo thứ tự cột)
+ */
+using CsvRow = std::vector<std::string>;
 #endif // IENTITYPARSER_H
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "AttendanceBitmap.h"
+#include <bit>
+
+namespace {
+    constexpr unsigned char BITMAP_CONTAINER = 0; // Tiếp theo là các byte của bitmap (little-endian)
+    constexpr unsigned char ARRAY_CONTAINER = 1;  // Tiếp theo là các slot có mặt tăng dần, mỗi slot 2 byte
+}
+
+void AttendanceBitmap::set(std::size_t slot, bool present) {
+    std::size_t index = slot / 64;
+    std::uint64_t bit = std::uint64_t{1} << (slot % 64);
+    if (present) {
+        if (index >= _words.size()) _words.resize(index + 1, 0);
+        _words[index] |= bit;
+    } else if (index < _words.size()) {
+        _words[index] &= ~bit;
+    }
+}
+
+bool AttendanceBitmap::test(std::size_t slot) const {
+    return (word(slot / 64) >> (slot % 64)) & 1;
+}
+
+std::size_t AttendanceBitmap::count() const {
+    std::size_t total = 0;
+    for (std::uint64_t value : _words) total += static_cast<std::size_t>(std::popcount(value));
+    return total;
+}
+
+std::vector<unsigned char> AttendanceBitmap::encode() const {
+    std::vector<unsigned char> bitmapBytes;
+    bitmapBytes.reserve(_words.size() * 8);
+    for (std::uint64_t value : _words) {
+        for (int shift = 0; shift < 64; shift += 8) bitmapBytes.push_back(static_cast<unsigned char>(value >> shift));
+    }
+    while (!bitmapBytes.empty() && bitmapBytes.back() == 0) bitmapBytes.pop_back();
+
+    std::size_t present = count();
+    std::vector<unsigned char> encoded;
+    if (present * 2 < bitmapBytes.size()) {
+        encoded.reserve(1 + present * 2);
+        encoded.push_back(ARRAY_CONTAINER);
+        for (std::size_t index = 0; index < _words.size(); ++index) {
+            for (std::uint64_t value = _words[index]; value != 0; value &= value - 1) {
+                auto slot = static_cast<std::uint16_t>(index * 64 + static_cast<std::size_t>(std::countr_zero(value)));
+                encoded.push_back(static_cast<unsigned char>(slot));
+                encoded.push_back(static_cast<unsigned char>(slot >> 8));
+            }
+        }
+    } else {
+        encoded.reserve(1 + bitmapBytes.size());
+        encoded.push_back(BITMAP_CONTAINER);
+        encoded.insert(encoded.end(), bitmapBytes.begin(), bitmapBytes.end());
+    }
+    return encoded;
+}
+
+std::expected<AttendanceBitmap, Error> AttendanceBitmap::decode(const std::vector<unsigned char>& bytes) {
+    AttendanceBitmap bitmap;
+    if (bytes.empty()) {
+        return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Attendance bitmap is empty."});
+    }
+    if (bytes[0] == BITMAP_CONTAINER) {
+        if (bytes.size() - 1 > MAX_SLOTS / 8) {
+            return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Attendance bitmap is too large."});
+        }
+        bitmap._words.assign((bytes.size() - 1 + 7) / 8, 0);
+        for (std::size_t i = 1; i < bytes.size(); ++i) {
+            bitmap._words[(i - 1) / 8] |= static_cast<std::uint64_t>(bytes[i]) << (((i - 1) % 8) * 8);
+        }
+        return bitmap;
+    }
+    if (bytes[0] == ARRAY_CONTAINER && bytes.size() % 2 == 1) {
+        for (std::size_t i = 1; i < bytes.size(); i += 2) {
+            bitmap.set(static_cast<std::size_t>(bytes[i]) | (static_cast<std::size_t>(bytes[i + 1]) << 8));
+        }
+        return bitmap;
+    }
+    return std::unexpected(Error{ErrorCode::PARSING_ERROR, "Unknown attendance bitmap encoding."});
+}
+
+AttendanceTally::AttendanceTally(std::size_t slots) : _slots(slots), _words((slots + 63) / 64) {}
+
+void AttendanceTally::add(const AttendanceBitmap& session) {
+    ++_sessions;
+    for (std::size_t index = 0; index < _words; ++index) {
+        // Cộng có nhớ theo từng mặt phẳng; dừng khi không còn bit nhớ
+        std::uint64_t carry = session.word(index);
+        for (std::size_t plane = 0; carry != 0; ++plane) {
+            if (plane == _planes.size()) _planes.emplace_back(_words, 0);
+            std::uint64_t next = _planes[plane][index] & carry;
+            _planes[plane][index] ^= carry;
+            carry = next;
+        }
+    }
+}
+
+std::vector<int> AttendanceTally::counts() const {
+    std::vector<int> result(_slots, 0);
+    for (std::size_t plane = 0; plane < _planes.size(); ++plane) {
+        for (std::size_t index = 0; index < _words; ++index) {
+            for (std::uint64_t value = _planes[plane][index]; value != 0; value &= value - 1) {
+                std::size_t slot = index * 64 + static_cast<std::size_t>(std::countr_zero(value));
+                if (slot < _slots) result[slot] += 1 << plane;
+            }
+        }
+    }
+    return result;
+}
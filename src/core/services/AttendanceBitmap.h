@@ -0,0 +1,104 @@
+/**
+ * @file AttendanceBitmap.h
+ * @brief Định nghĩa bitmap điểm danh của một buổi học và bộ đếm số buổi có mặt dạng bit-sliced
+ */
+#ifndef ATTENDANCEBITMAP_H
+#define ATTENDANCEBITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <vector>
+#include "../../common/ErrorType.h"
+
+/**
+ * @class AttendanceBitmap
+ * @brief Tập các slot có mặt trong một buổi học, mỗi slot một bit
+ *
+ * Khi lưu, bitmap được mã hóa như một container của roaring bitmap: chọn dạng ngắn hơn giữa
+ * bitmap thô (bỏ các byte 0 ở cuối) và mảng các slot có mặt (2 byte mỗi slot). Vì vậy slot phải
+ * nhỏ hơn MAX_SLOTS. 300 sinh viên tốn tối đa 39 byte mỗi buổi.
+ */
+class AttendanceBitmap {
+public:
+    static constexpr std::size_t MAX_SLOTS = 65536; ///< Số slot tối đa của một khóa học
+
+private:
+    std::vector<std::uint64_t> _words; ///< 64 slot mỗi từ
+
+public:
+    /**
+     * @brief Đánh dấu slot có mặt (hoặc vắng)
+     */
+    void set(std::size_t slot, bool present = true);
+
+    /**
+     * @brief Slot có mặt hay không
+     */
+    bool test(std::size_t slot) const;
+
+    /**
+     * @brief Số slot có mặt (popcount)
+     */
+    std::size_t count() const;
+
+    /**
+     * @brief Từ thứ index của bitmap (0 nếu vượt quá kích thước hiện tại)
+     */
+    std::uint64_t word(std::size_t index) const { return index < _words.size() ? _words[index] : 0; }
+
+    /**
+     * @brief Số từ đang dùng
+     */
+    std::size_t wordCount() const { return _words.size(); }
+
+    /**
+     * @brief Mã hóa để lưu trữ
+     */
+    std::vector<unsigned char> encode() const;
+
+    /**
+     * @brief Giải mã dữ liệu do encode() tạo ra
+     * @return Bitmap, hoặc Error (PARSING_ERROR nếu dữ liệu hỏng)
+     */
+    static std::expected<AttendanceBitmap, Error> decode(const std::vector<unsigned char>& bytes);
+};
+
+/**
+ * @class AttendanceTally
+ * @brief Đếm số buổi có mặt của mọi slot bằng bộ đếm bit-sliced
+ *
+ * Bit k của bộ đếm các slot được giữ trong mặt phẳng k, nên cộng một buổi học là phép cộng có nhớ
+ * trên từng từ 64 bit (64 sinh viên mỗi phép AND/XOR) thay vì kiểm tra từng bit. 100 buổi chỉ cần
+ * 7 mặt phẳng.
+ */
+class AttendanceTally {
+private:
+    std::size_t _slots = 0;                          ///< Số slot được đếm
+    std::size_t _words = 0;                          ///< Số từ mỗi mặt phẳng
+    std::size_t _sessions = 0;                       ///< Số buổi đã cộng
+    std::vector<std::vector<std::uint64_t>> _planes; ///< Mặt phẳng bit của các bộ đếm
+
+public:
+    /**
+     * @brief Tạo bộ đếm cho các slot [0, slots)
+     */
+    explicit AttendanceTally(std::size_t slots);
+
+    /**
+     * @brief Cộng một buổi học
+     */
+    void add(const AttendanceBitmap& session);
+
+    /**
+     * @brief Số buổi đã cộng
+     */
+    std::size_t sessionCount() const { return _sessions; }
+
+    /**
+     * @brief Số buổi có mặt của từng slot
+     */
+    std::vector<int> counts() const;
+};
+
+#endif // ATTENDANCEBITMAP_H
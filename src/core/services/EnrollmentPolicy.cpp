@@ -0,0 +1,129 @@
+#include "EnrollmentPolicy.h"
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+EnrollmentPolicy::EnrollmentPolicy(std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                                   std::shared_ptr<IStudentDao> studentDao,
+                                   std::shared_ptr<ICourseDao> courseDao,
+                                   std::shared_ptr<TimetableIndex> timetableIndex,
+                                   std::shared_ptr<IPrerequisiteService> prerequisiteService)
+    : _enrollmentDao(std::move(enrollmentDao)),
+      _studentDao(std::move(studentDao)),
+      _courseDao(std::move(courseDao)),
+      _timetableIndex(std::move(timetableIndex)),
+      _prerequisiteService(std::move(prerequisiteService)) {
+    if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null for EnrollmentPolicy.");
+    if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null for EnrollmentPolicy.");
+    if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null for EnrollmentPolicy.");
+    if (!_timetableIndex) throw std::invalid_argument("TimetableIndex cannot be null for EnrollmentPolicy.");
+    if (!_prerequisiteService) throw std::invalid_argument("PrerequisiteService cannot be null for EnrollmentPolicy.");
+}
+
+bool EnrollmentPolicy::isRejection(int code) {
+    return code == ErrorCode::VALIDATION_ERROR || code == ErrorCode::COURSE_PREREQUISITE_NOT_MET ||
+           code == ErrorCode::COURSE_SCHEDULE_CONFLICT;
+}
+
+std::expected<TimetableIndex::CourseSchedule, Error> EnrollmentPolicy::courseSchedule(const std::string& courseId) const {
+    if (auto cached = _timetableIndex->findCourse(courseId)) return cached.value();
+    auto course = _courseDao->getById(courseId);
+    if (!course.has_value()) return std::unexpected(course.error());
+    _timetableIndex->storeCourse(courseId, course->getMeetingSlots());
+    return TimetableIndex::CourseSchedule{course->getMeetingSlots(), WeeklyTimetable::maskOf(course->getMeetingSlots())};
+}
+
+std::expected<bool, Error> EnrollmentPolicy::checkRules(const std::string& studentId, const std::string& courseId,
+                                                        std::optional<LoginStatus> knownStatus,
+                                                        std::optional<TimetableSnapshot>& snapshot) {
+    if (!knownStatus.has_value()) {
+        auto student = _studentDao->getById(studentId);
+        if (!student.has_value()) return std::unexpected(student.error());
+        knownStatus = student->getStatus();
+    }
+    if (knownStatus.value() != LoginStatus::ACTIVE) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Student account is not active. Cannot enroll in courses."});
+    }
+
+    auto missing = _prerequisiteService->findMissingPrerequisites(studentId, courseId);
+    if (!missing.has_value()) return std::unexpected(missing.error());
+    if (!missing->empty()) {
+        std::string missingList;
+        for (const auto& missingId : missing.value()) missingList += (missingList.empty() ? "" : ", ") + missingId;
+        return std::unexpected(Error{ErrorCode::COURSE_PREREQUISITE_NOT_MET,
+            "Student " + studentId + " has not passed the prerequisites of course " + courseId + ": " + missingList + "."});
+    }
+    return checkTimetable(studentId, courseId, snapshot);
+}
+
+std::expected<bool, Error> EnrollmentPolicy::checkTimetable(const std::string& studentId, const std::string& courseId,
+                                                            std::optional<TimetableSnapshot>& snapshot) {
+    // Khóa học không có lịch thì không thể trùng; khóa học không tồn tại để enrollIfSeatAvailable báo NOT_FOUND
+    auto target = courseSchedule(courseId);
+    if (!target.has_value()) {
+        if (target.error().code == ErrorCode::NOT_FOUND) return true;
+        return std::unexpected(target.error());
+    }
+    if (target->mask.none()) return true;
+
+    auto courseIdsResult = _enrollmentDao->findCourseIdsByStudentId(studentId);
+    if (!courseIdsResult.has_value()) return std::unexpected(courseIdsResult.error());
+    std::vector<std::string> enrolledIds = std::move(courseIdsResult.value());
+    std::sort(enrolledIds.begin(), enrolledIds.end());
+    // Khóa học đã đăng ký luôn "trùng" với chính nó; báo đúng lý do
+    if (std::binary_search(enrolledIds.begin(), enrolledIds.end(), courseId)) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student " + studentId + " already enrolled in course " + courseId});
+    }
+
+    auto timetable = _timetableIndex->findStudent(studentId, enrolledIds);
+    if (!timetable.has_value()) {
+        // Danh sách khóa học đã đổi kể từ lần đệm trước (hoặc chưa đệm): ghép lại từ mặt nạ đã đệm của từng khóa học
+        WeeklyTimetable rebuilt;
+        for (const auto& enrolledId : enrolledIds) {
+            auto schedule = courseSchedule(enrolledId);
+            if (schedule.has_value()) rebuilt.add(schedule->mask);
+        }
+        _timetableIndex->storeStudent(studentId, enrolledIds, rebuilt);
+        timetable = rebuilt;
+    }
+
+    if (timetable->clashesWith(target->mask)) {
+        // Chỉ khi trùng mới tìm khóa học gây trùng để báo lỗi rõ ràng
+        for (const auto& enrolledId : enrolledIds) {
+            auto schedule = courseSchedule(enrolledId);
+            if (schedule.has_value() && (schedule->mask & target->mask).any()) {
+                return std::unexpected(Error{ErrorCode::COURSE_SCHEDULE_CONFLICT,
+                    "Course " + courseId + " clashes with enrolled course " + enrolledId + "."});
+            }
+        }
+        return std::unexpected(Error{ErrorCode::COURSE_SCHEDULE_CONFLICT, "Course " + courseId + " clashes with the student's timetable."});
+    }
+    snapshot = TimetableSnapshot{std::move(enrolledIds), timetable.value(), target->mask};
+    return true;
+}
+
+std::expected<bool, Error> EnrollmentPolicy::checkEligible(const std::string& studentId, const std::string& courseId,
+                                                           std::optional<LoginStatus> knownStatus) {
+    std::lock_guard<std::mutex> studentLock(_timetableIndex->studentLock(studentId));
+    std::optional<TimetableSnapshot> snapshot;
+    return checkRules(studentId, courseId, knownStatus, snapshot);
+}
+
+std::expected<bool, Error> EnrollmentPolicy::enroll(const std::string& studentId, const std::string& courseId,
+                                                    std::optional<LoginStatus> knownStatus) {
+    // Kiểm tra trùng lịch và giữ chỗ như một thao tác đối với cùng sinh viên
+    std::lock_guard<std::mutex> studentLock(_timetableIndex->studentLock(studentId));
+    std::optional<TimetableSnapshot> snapshot;
+    auto eligible = checkRules(studentId, courseId, knownStatus, snapshot);
+    if (!eligible.has_value()) return eligible;
+
+    // Một lần gọi DAO: kiểm tra khóa học, đăng ký trùng, số chỗ còn lại và giữ chỗ trong một thao tác nguyên tử
+    auto enrollResult = _enrollmentDao->enrollIfSeatAvailable(studentId, courseId);
+    if (enrollResult.has_value() && enrollResult.value() && snapshot.has_value()) {
+        auto& courseIds = snapshot->courseIds;
+        courseIds.insert(std::upper_bound(courseIds.begin(), courseIds.end(), courseId), courseId);
+        snapshot->timetable.add(snapshot->target);
+        _timetableIndex->storeStudent(studentId, std::move(courseIds), snapshot->timetable);
+    }
+    return enrollResult;
+}
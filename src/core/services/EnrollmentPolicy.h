@@ -0,0 +1,112 @@
+/**
+ * @file EnrollmentPolicy.h
+ * @brief Định nghĩa các điều kiện đăng ký khóa học dùng chung cho mọi đường đăng ký
+ */
+#ifndef ENROLLMENTPOLICY_H
+#define ENROLLMENTPOLICY_H
+
+#include <expected>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../../common/ErrorType.h"
+#include "../../common/LoginStatus.h"
+#include "../data_access/interface/IEnrollmentDao.h"
+#include "../data_access/interface/IStudentDao.h"
+#include "../data_access/interface/ICourseDao.h"
+#include "interface/IPrerequisiteService.h"
+#include "TimetableIndex.h"
+
+/**
+ * @class EnrollmentPolicy
+ * @brief Kiểm tra sinh viên có được vào khóa học hay không, rồi giữ chỗ
+ *
+ * Sinh viên tự đăng ký (EnrollmentService) và sinh viên được xếp từ danh sách chờ (WaitlistService)
+ * đều đi qua lớp này, nên một điều kiện mới chỉ cần thêm ở một chỗ. Lớp không kiểm tra quyền của
+ * người dùng hiện tại: việc xếp từ danh sách chờ chạy thay cho sinh viên khác, bên gọi tự kiểm tra quyền.
+ */
+class EnrollmentPolicy {
+private:
+    /**
+     * @brief Thời khóa biểu đã đọc khi kiểm tra trùng lịch, dùng lại để cập nhật bộ đệm sau khi giữ chỗ
+     */
+    struct TimetableSnapshot {
+        std::vector<std::string> courseIds; ///< Các khóa học đang đăng ký, đã sắp xếp
+        WeeklyTimetable timetable;          ///< Thời khóa biểu ghép từ courseIds
+        WeeklyTimetable::Mask target;       ///< Mặt nạ lịch học của khóa học muốn vào
+    };
+
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;  ///< Đối tượng dao để giữ chỗ và lấy khóa học đã đăng ký
+    std::shared_ptr<IStudentDao> _studentDao;        ///< Đối tượng dao để lấy trạng thái sinh viên
+    std::shared_ptr<ICourseDao> _courseDao;          ///< Đối tượng dao để lấy lịch học chưa đệm
+    std::shared_ptr<TimetableIndex> _timetableIndex; ///< Bộ đệm lịch học dùng chung với CourseService
+    std::shared_ptr<IPrerequisiteService> _prerequisiteService; ///< Dịch vụ môn tiên quyết
+
+    /**
+     * @brief Lịch học của khóa học, lấy từ bộ đệm hoặc nạp từ DAO rồi đệm lại
+     */
+    std::expected<TimetableIndex::CourseSchedule, Error> courseSchedule(const std::string& courseId) const;
+
+    /**
+     * @brief Kiểm tra mọi điều kiện (gọi khi đang giữ khóa của sinh viên)
+     * @param snapshot Nhận thời khóa biểu đã đọc; để trống nếu khóa học không có lịch
+     */
+    std::expected<bool, Error> checkRules(const std::string& studentId, const std::string& courseId,
+                                          std::optional<LoginStatus> knownStatus, std::optional<TimetableSnapshot>& snapshot);
+
+    /**
+     * @brief Kiểm tra khóa học không trùng lịch với các khóa học sinh viên đang đăng ký
+     */
+    std::expected<bool, Error> checkTimetable(const std::string& studentId, const std::string& courseId,
+                                              std::optional<TimetableSnapshot>& snapshot);
+
+public:
+    /**
+     * @brief Hàm khởi tạo EnrollmentPolicy
+     * @param enrollmentDao Đối tượng dao cho đăng ký khóa học
+     * @param studentDao Đối tượng dao cho sinh viên
+     * @param courseDao Đối tượng dao cho khóa học
+     * @param timetableIndex Bộ đệm lịch học của khóa học và thời khóa biểu của sinh viên
+     * @param prerequisiteService Dịch vụ môn tiên quyết
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    EnrollmentPolicy(std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                     std::shared_ptr<IStudentDao> studentDao,
+                     std::shared_ptr<ICourseDao> courseDao,
+                     std::shared_ptr<TimetableIndex> timetableIndex,
+                     std::shared_ptr<IPrerequisiteService> prerequisiteService);
+
+    /**
+     * @brief Mã lỗi có phải do sinh viên không đủ điều kiện (không phải lỗi truy cập dữ liệu)
+     */
+    static bool isRejection(int code);
+
+    /**
+     * @brief Kiểm tra sinh viên đủ điều kiện vào khóa học (chưa giữ chỗ)
+     * @param studentId ID của sinh viên
+     * @param courseId ID của khóa học
+     * @param knownStatus Trạng thái tài khoản nếu bên gọi đã biết (sinh viên đang đăng nhập), để khỏi đọc lại
+     * @return true nếu đủ điều kiện, hoặc Error (VALIDATION_ERROR nếu tài khoản không ACTIVE,
+     *         COURSE_PREREQUISITE_NOT_MET nếu chưa qua môn tiên quyết, COURSE_SCHEDULE_CONFLICT nếu trùng lịch,
+     *         ALREADY_EXISTS nếu đã đăng ký)
+     */
+    std::expected<bool, Error> checkEligible(const std::string& studentId, const std::string& courseId,
+                                             std::optional<LoginStatus> knownStatus = std::nullopt);
+
+    /**
+     * @brief Kiểm tra điều kiện rồi giữ chỗ bằng IEnrollmentDao::enrollIfSeatAvailable
+     *
+     * Kiểm tra trùng lịch và giữ chỗ diễn ra dưới cùng khóa của sinh viên, nên hai lần đăng ký đồng thời
+     * của một sinh viên không thể cùng lọt qua kiểm tra.
+     *
+     * @param studentId ID của sinh viên
+     * @param courseId ID của khóa học
+     * @param knownStatus Trạng thái tài khoản nếu bên gọi đã biết
+     * @return true nếu đã đăng ký, hoặc Error của checkEligible hay của DAO (COURSE_CAPACITY_REACHED, ALREADY_EXISTS, ...)
+     */
+    std::expected<bool, Error> enroll(const std::string& studentId, const std::string& courseId,
+                                      std::optional<LoginStatus> knownStatus = std::nullopt);
+};
+
+#endif // ENROLLMENTPOLICY_H
@@ -0,0 +1,127 @@
+#include "ExamScheduler.h"
+#include "../../utils/ParallelUtils.h"
+#include <algorithm>
+#include <bit>
+#include <tuple>
+
+namespace {
+    constexpr std::size_t COURSES_PER_WORKER = 256; // Dưới mức này một luồng dựng ma trận nhanh hơn
+}
+
+ExamScheduler::ExamScheduler(std::vector<std::string> courseIds, const std::vector<std::vector<std::uint32_t>>& coursesOfStudent)
+    : _courseIds(std::move(courseIds)), _studentCount(coursesOfStudent.size()) {
+    const std::size_t courseCount = _courseIds.size();
+    _words = (courseCount + 63) / 64;
+    _adjacency.assign(courseCount * _words, 0);
+    _studentsOf.resize(courseCount);
+    for (std::size_t student = 0; student < coursesOfStudent.size(); ++student) {
+        for (std::uint32_t course : coursesOfStudent[student]) {
+            if (course < courseCount) _studentsOf[course].push_back(static_cast<std::uint32_t>(student));
+        }
+    }
+
+    // Mỗi luồng duyệt mọi sinh viên nhưng chỉ ghi các hàng thuộc dải [begin, end) của mình
+    auto buildRows = [&](std::size_t begin, std::size_t end) {
+        for (const auto& courses : coursesOfStudent) {
+            for (std::uint32_t course : courses) {
+                if (course < begin || course >= end) continue;
+                std::uint64_t* courseRow = _adjacency.data() + course * _words;
+                for (std::uint32_t other : courses) {
+                    if (other != course && other < courseCount) courseRow[other / 64] |= std::uint64_t{1} << (other % 64);
+                }
+            }
+        }
+    };
+    ParallelUtils::parallelForChunks(courseCount, COURSES_PER_WORKER, buildRows);
+}
+
+bool ExamScheduler::conflicts(std::size_t first, std::size_t second) const {
+    return (row(first)[second / 64] >> (second % 64)) & 1;
+}
+
+std::size_t ExamScheduler::conflictCount() const {
+    std::size_t ends = 0;
+    for (std::uint64_t word : _adjacency) ends += static_cast<std::size_t>(std::popcount(word));
+    return ends / 2;
+}
+
+std::expected<std::vector<ExamSlot>, Error> ExamScheduler::schedule(const ExamSchedulingOptions& options) const {
+    if (options.periodsPerDay < 1 || options.maxExamsPerStudentPerDay < 1 || options.seatsPerPeriod < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Periods per day and exams per student per day must be at least 1, seats cannot be negative."});
+    }
+    const std::size_t courseCount = _courseIds.size();
+    for (std::size_t course = 0; course < courseCount; ++course) {
+        if (options.seatsPerPeriod > 0 && _studentsOf[course].size() > static_cast<std::size_t>(options.seatsPerPeriod)) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Course " + _courseIds[course] + " has " + std::to_string(_studentsOf[course].size()) +
+                                                                      " students, more than the " + std::to_string(options.seatsPerPeriod) + " seats of an exam period."});
+        }
+    }
+
+    std::vector<std::size_t> degree(courseCount);
+    for (std::size_t course = 0; course < courseCount; ++course) {
+        for (std::size_t w = 0; w < _words; ++w) degree[course] += static_cast<std::size_t>(std::popcount(row(course)[w]));
+    }
+    std::vector<int> slotOf(courseCount, -1);
+    std::vector<std::vector<bool>> blockedSlots(courseCount); // Ca đã bị hàng xóm chiếm
+    std::vector<std::size_t> saturation(courseCount, 0);
+    std::vector<std::size_t> seatsUsed;                         // Theo ca
+    std::vector<std::vector<std::uint8_t>> examsOnDay(_studentCount); // Theo sinh viên, rồi theo ngày
+
+    for (std::size_t step = 0; step < courseCount; ++step) {
+        // DSatur: độ bão hòa lớn nhất, rồi bậc lớn nhất, rồi khóa học đông hơn (khó xếp hơn)
+        std::size_t next = courseCount;
+        for (std::size_t course = 0; course < courseCount; ++course) {
+            if (slotOf[course] >= 0) continue;
+            if (next == courseCount ||
+                std::tie(saturation[course], degree[course]) > std::tie(saturation[next], degree[next]) ||
+                (saturation[course] == saturation[next] && degree[course] == degree[next] && _studentsOf[course].size() > _studentsOf[next].size())) {
+                next = course;
+            }
+        }
+
+        // Ca sớm nhất hợp lệ; luôn tồn tại vì một ngày mới chưa có ca nào bị chiếm
+        const auto& students = _studentsOf[next];
+        std::size_t slot = 0;
+        for (;; ++slot) {
+            if (slot < blockedSlots[next].size() && blockedSlots[next][slot]) continue;
+            std::size_t used = slot < seatsUsed.size() ? seatsUsed[slot] : 0;
+            if (options.seatsPerPeriod > 0 && used + students.size() > static_cast<std::size_t>(options.seatsPerPeriod)) continue;
+            std::size_t day = slot / static_cast<std::size_t>(options.periodsPerDay);
+            bool dayFull = std::any_of(students.begin(), students.end(), [&](std::uint32_t student) {
+                return day < examsOnDay[student].size() && examsOnDay[student][day] >= options.maxExamsPerStudentPerDay;
+            });
+            if (!dayFull) break;
+        }
+
+        slotOf[next] = static_cast<int>(slot);
+        if (slot >= seatsUsed.size()) seatsUsed.resize(slot + 1, 0);
+        seatsUsed[slot] += students.size();
+        std::size_t day = slot / static_cast<std::size_t>(options.periodsPerDay);
+        for (std::uint32_t student : students) {
+            if (day >= examsOnDay[student].size()) examsOnDay[student].resize(day + 1, 0);
+            ++examsOnDay[student][day];
+        }
+        for (std::size_t w = 0; w < _words; ++w) {
+            for (std::uint64_t bits = row(next)[w]; bits != 0; bits &= bits - 1) {
+                std::size_t neighbor = w * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+                if (slotOf[neighbor] >= 0) continue;
+                auto& blocked = blockedSlots[neighbor];
+                if (slot >= blocked.size()) blocked.resize(slot + 1, false);
+                if (!blocked[slot]) {
+                    blocked[slot] = true;
+                    ++saturation[neighbor];
+                }
+            }
+        }
+    }
+
+    std::vector<ExamSlot> slots;
+    slots.reserve(courseCount);
+    for (std::size_t course = 0; course < courseCount; ++course) {
+        slots.push_back(ExamSlot{_courseIds[course], slotOf[course] / options.periodsPerDay + 1, slotOf[course] % options.periodsPerDay + 1});
+    }
+    std::sort(slots.begin(), slots.end(), [](const ExamSlot& a, const ExamSlot& b) {
+        return std::tie(a.day, a.period, a.courseId) < std::tie(b.day, b.period, b.courseId);
+    });
+    return slots;
+}
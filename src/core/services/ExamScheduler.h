@@ -0,0 +1,73 @@
+/**
+ * @file ExamScheduler.h
+ * @brief Định nghĩa bộ xếp lịch thi bằng tô màu đồ thị xung đột giữa các khóa học
+ */
+#ifndef EXAMSCHEDULER_H
+#define EXAMSCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <vector>
+#include "../../common/ErrorType.h"
+#include "../data_access/interface/IExamScheduleDao.h" // ExamSlot
+
+/**
+ * @struct ExamSchedulingOptions
+ * @brief Các ràng buộc khi xếp lịch thi
+ */
+struct ExamSchedulingOptions {
+    int periodsPerDay = 3;            ///< Số ca thi mỗi ngày
+    int maxExamsPerStudentPerDay = 2; ///< Số môn thi tối đa của một sinh viên trong một ngày
+    int seatsPerPeriod = 0;           ///< Tổng số chỗ ngồi của các phòng thi trong một ca (0 = không giới hạn)
+    std::string termId{};             ///< Học kỳ cần xếp lịch thi (rỗng = học kỳ hiện tại)
+};
+
+/**
+ * @class ExamScheduler
+ * @brief Xếp ca thi sao cho không sinh viên nào có hai môn thi cùng ca
+ *
+ * Đồ thị xung đột có một đỉnh cho mỗi khóa học và một cạnh giữa hai khóa học có chung sinh viên,
+ * lưu dạng ma trận kề bitset (2.000 khóa học chiếm 500 KB). Ma trận được dựng song song: mỗi luồng
+ * sở hữu một dải hàng nên không cần khóa. Ca thi được gán theo DSatur: luôn xếp khóa học có nhiều
+ * ca bị hàng xóm chiếm nhất (rồi đến bậc cao nhất) vào ca sớm nhất thỏa mãn mọi ràng buộc.
+ */
+class ExamScheduler {
+private:
+    std::vector<std::string> _courseIds;                    ///< courseId theo chỉ số dày đặc
+    std::vector<std::vector<std::uint32_t>> _studentsOf;    ///< Chỉ số sinh viên của từng khóa học
+    std::size_t _studentCount = 0;                          ///< Số sinh viên
+    std::size_t _words = 0;                                 ///< Số từ 64 bit mỗi hàng của ma trận kề
+    std::vector<std::uint64_t> _adjacency;                  ///< Ma trận kề, hàng i bắt đầu tại i * _words
+
+    const std::uint64_t* row(std::size_t course) const { return _adjacency.data() + course * _words; }
+
+public:
+    /**
+     * @brief Dựng đồ thị xung đột
+     * @param courseIds ID của các khóa học cần thi (chỉ số trong vector là chỉ số dày đặc)
+     * @param coursesOfStudent Với mỗi sinh viên, chỉ số các khóa học sinh viên đó đăng ký
+     */
+    ExamScheduler(std::vector<std::string> courseIds, const std::vector<std::vector<std::uint32_t>>& coursesOfStudent);
+
+    /**
+     * @brief Hai khóa học có chung sinh viên hay không
+     */
+    bool conflicts(std::size_t first, std::size_t second) const;
+
+    /**
+     * @brief Số cạnh của đồ thị xung đột
+     */
+    std::size_t conflictCount() const;
+
+    /**
+     * @brief Xếp ca thi cho mọi khóa học
+     * @param options Các ràng buộc
+     * @return Lịch thi theo (day, period, courseId), hoặc Error (VALIDATION_ERROR nếu ràng buộc không hợp lệ
+     *         hoặc một khóa học đông hơn số chỗ của một ca)
+     */
+    std::expected<std::vector<ExamSlot>, Error> schedule(const ExamSchedulingOptions& options) const;
+};
+
+#endif // EXAMSCHEDULER_H
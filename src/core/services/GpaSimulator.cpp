@@ -0,0 +1,98 @@
+#include "GpaSimulator.h"
+#include "../../common/GradeScale.h"
+#include <algorithm>
+
+namespace {
+    constexpr double CGPA_EPSILON = 1e-9;
+
+    // Tổng điểm có trọng số đã đủ cho CGPA mục tiêu trên tổng số tín chỉ hay chưa
+    bool meetsTarget(long long weightedPoints, long long credits, double targetCgpa) {
+        if (credits <= 0) return targetCgpa <= CGPA_EPSILON;
+        return static_cast<double>(weightedPoints) + CGPA_EPSILON >= targetCgpa * static_cast<double>(credits);
+    }
+}
+
+GpaSimulator::GpaSimulator(std::string studentId, WeightedGradePoints graded, std::vector<PendingCourse> pending)
+    : _studentId(std::move(studentId)), _graded(graded) {
+    _pending.reserve(pending.size());
+    for (auto& course : pending) {
+        if (course.credits <= 0 || _pendingIndex.contains(course.courseId)) continue;
+        _pendingIndex.emplace(course.courseId, _pending.size());
+        _pending.push_back(std::move(course));
+    }
+}
+
+std::expected<WeightedGradePoints, Error> GpaSimulator::accumulate(const std::map<std::string, int>& hypotheticalMarks,
+                                                                   std::vector<const PendingCourse*>* freeCourses) const {
+    WeightedGradePoints totals = _graded;
+    for (const auto& [courseId, marks] : hypotheticalMarks) {
+        auto it = _pendingIndex.find(courseId);
+        if (it == _pendingIndex.end()) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Course '" + courseId + "' is not an in-progress course of student " + _studentId + "."});
+        }
+        if (marks == GradeScale::UNGRADED_MARKS) continue; // Giả định môn này chưa có điểm
+        if (marks < GradeScale::MIN_MARKS || marks > GradeScale::MAX_MARKS) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Hypothetical marks for course '" + courseId + "' must be between 0 and 100."});
+        }
+        const int credits = _pending[it->second].credits;
+        totals.weightedPoints += static_cast<long long>(GradeScale::gradePointFromMarks(marks)) * credits;
+        totals.gradedCredits += credits;
+    }
+    if (freeCourses) {
+        for (const auto& course : _pending) {
+            if (!hypotheticalMarks.contains(course.courseId)) freeCourses->push_back(&course);
+        }
+    }
+    return totals;
+}
+
+std::expected<double, Error> GpaSimulator::simulate(const std::map<std::string, int>& hypotheticalMarks) const {
+    auto totals = accumulate(hypotheticalMarks, nullptr);
+    if (!totals.has_value()) return std::unexpected(totals.error());
+    return totals->average();
+}
+
+std::expected<GpaTargetPlan, Error> GpaSimulator::solveForTarget(double targetCgpa, const std::map<std::string, int>& fixedMarks) const {
+    if (!(targetCgpa >= 0.0 && targetCgpa <= GradeScale::MAX_GRADE_POINT)) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Target CGPA must be between 0 and 4."});
+    }
+    std::vector<const PendingCourse*> freeCourses;
+    auto fixedTotals = accumulate(fixedMarks, &freeCourses);
+    if (!fixedTotals.has_value()) return std::unexpected(fixedTotals.error());
+
+    long long freeCredits = 0;
+    for (const auto* course : freeCourses) freeCredits += course->credits;
+    const long long totalCredits = fixedTotals->gradedCredits + freeCredits;
+    const long long basePoints = fixedTotals->weightedPoints;
+    const long long bestPoints = basePoints + GradeScale::MAX_GRADE_POINT * freeCredits;
+
+    GpaTargetPlan plan;
+    plan.targetCgpa = targetCgpa;
+    plan.bestCaseCgpa = WeightedGradePoints{bestPoints, totalCredits}.average();
+    plan.reachable = meetsTarget(bestPoints, totalCredits, targetCgpa);
+
+    // Mọi môn tự do cùng một điểm chữ: chọn mức thấp nhất vẫn đạt mục tiêu
+    if (plan.reachable) {
+        for (int gradePoint = 0; gradePoint <= GradeScale::MAX_GRADE_POINT; ++gradePoint) {
+            if (meetsTarget(basePoints + gradePoint * freeCredits, totalCredits, targetCgpa)) {
+                plan.uniformMinimumMarks = freeCredits > 0 ? GradeScale::minMarksForGradePoint(gradePoint) : GradeScale::MIN_MARKS;
+                break;
+            }
+        }
+    }
+
+    // Từng môn: điểm thấp nhất của môn đó khi các môn tự do còn lại đạt điểm A
+    plan.perCourse.reserve(freeCourses.size());
+    for (const auto* course : freeCourses) {
+        CourseMarksRequirement requirement{course->courseId, course->credits, -1};
+        const long long othersBest = bestPoints - static_cast<long long>(GradeScale::MAX_GRADE_POINT) * course->credits;
+        for (int gradePoint = 0; plan.reachable && gradePoint <= GradeScale::MAX_GRADE_POINT; ++gradePoint) {
+            if (meetsTarget(othersBest + static_cast<long long>(gradePoint) * course->credits, totalCredits, targetCgpa)) {
+                requirement.minimumMarks = GradeScale::minMarksForGradePoint(gradePoint);
+                break;
+            }
+        }
+        plan.perCourse.push_back(std::move(requirement));
+    }
+    return plan;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file GpaSimulator.h
+ * @brief Định nghĩa bộ mô phỏng điểm trung bình tích lũy "nếu ... thì" của một sinh viên
+ */
+#ifndef GPASIMULATOR_H
+#define GPASIMULATOR_H
+
+#include <cstddef>
+#include <expected>
+#include <map>
+#include <string>
+#include <vector>
+#include "../../common/ErrorType.h"
+#include "../analytics/MarksColumn.h" // WeightedGradePoints
+
+/**
+ * @struct PendingCourse
+ * @brief Khóa học sinh viên đang học (đã đăng ký nhưng chưa có điểm)
+ */
+struct PendingCourse {
+    std::string courseId; ///< ID của khóa học
+    int credits = 0;      ///< Số tín chỉ của khóa học
+};
+
+/**
+ * @struct CourseMarksRequirement
+ * @brief Điểm tối thiểu cần đạt ở một khóa học đang học
+ */
+struct CourseMarksRequirement {
+    std::string courseId;  ///< ID của khóa học
+    int credits = 0;       ///< Số tín chỉ của khóa học
+    int minimumMarks = -1; ///< Điểm tối thiểu khi các môn tự do còn lại đạt điểm A, -1 nếu không thể đạt
+};
+
+/**
+ * @struct GpaTargetPlan
+ * @brief Kết quả giải bài toán "cần bao nhiêu điểm để đạt CGPA mục tiêu"
+ */
+struct GpaTargetPlan {
+    double targetCgpa = 0.0;                     ///< CGPA mục tiêu
+    bool reachable = false;                      ///< Có thể đạt nếu mọi môn tự do đạt điểm A
+    double bestCaseCgpa = 0.0;                   ///< CGPA khi mọi môn tự do đạt điểm A
+    int uniformMinimumMarks = -1;                ///< Điểm tối thiểu nếu mọi môn tự do cùng một mức, -1 nếu không thể đạt
+    std::vector<CourseMarksRequirement> perCourse; ///< Điểm tối thiểu của từng môn tự do
+};
+
+/**
+ * @class GpaSimulator
+ * @brief Mô phỏng CGPA trên tổng điểm đã tích lũy, không cần nạp lại bảng điểm
+ *
+ * Tổng (điểm hệ 4 * tín chỉ) và tổng tín chỉ của các môn đã có điểm được nạp một lần khi tạo đối tượng.
+ * Mỗi lần mô phỏng chỉ cộng thêm phần đóng góp của các môn đang học, nên chi phí tỉ lệ với số môn
+ * đang học chứ không phải độ dài bảng điểm. Mọi phép cộng dồn dùng số nguyên, chỉ chia ở bước cuối.
+ */
+class GpaSimulator {
+private:
+    std::string _studentId;                         ///< ID của sinh viên
+    WeightedGradePoints _graded;                    ///< Tổng đã tích lũy của các môn đã có điểm
+    std::vector<PendingCourse> _pending;            ///< Các môn đang học
+    std::map<std::string, std::size_t> _pendingIndex; ///< courseId -> vị trí trong _pending
+
+    /**
+     * @brief Cộng phần đóng góp của các điểm giả định vào tổng đã tích lũy
+     * @param hypotheticalMarks courseId -> điểm giả định (-1 là bỏ qua môn đó)
+     * @param freeCourses Nhận các môn đang học không có trong hypotheticalMarks (có thể nullptr)
+     */
+    std::expected<WeightedGradePoints, Error> accumulate(const std::map<std::string, int>& hypotheticalMarks,
+                                                         std::vector<const PendingCourse*>* freeCourses) const;
+
+public:
+    /**
+     * @brief Khởi tạo bộ mô phỏng
+     * @param studentId ID của sinh viên
+     * @param graded Tổng điểm hệ 4 có trọng số và tổng tín chỉ của các môn đã có điểm
+     * @param pending Các môn đang học; môn có tín chỉ <= 0 bị bỏ qua
+     */
+    GpaSimulator(std::string studentId, WeightedGradePoints graded, std::vector<PendingCourse> pending);
+
+    const std::string& getStudentId() const { return _studentId; }
+    const std::vector<PendingCourse>& getPendingCourses() const { return _pending; }
+    const WeightedGradePoints& getGradedTotals() const { return _graded; }
+
+    /**
+     * @brief CGPA hiện tại (chỉ tính các môn đã có điểm)
+     */
+    double currentCgpa() const { return _graded.average(); }
+
+    /**
+     * @brief Tính CGPA nếu các môn đang học đạt điểm giả định
+     * @param hypotheticalMarks courseId -> điểm giả định (0-100, hoặc -1 để bỏ qua); môn không có trong map không được tính
+     * @return CGPA mô phỏng, hoặc Error nếu khóa học không phải môn đang học hoặc điểm ngoài thang điểm
+     */
+    std::expected<double, Error> simulate(const std::map<std::string, int>& hypotheticalMarks) const;
+
+    /**
+     * @brief Tìm điểm tối thiểu cần đạt ở các môn đang học để CGPA đạt mục tiêu
+     *
+     * Các môn có trong fixedMarks được giữ nguyên điểm giả định; các môn còn lại là môn tự do.
+     * Vì điểm hệ 4 là hàm bậc thang của điểm số, kết quả luôn là ngưỡng dưới của một điểm chữ.
+     *
+     * @param targetCgpa CGPA mục tiêu (0-4)
+     * @param fixedMarks courseId -> điểm giả định đã biết trước
+     * @return Kế hoạch điểm, hoặc Error nếu đầu vào không hợp lệ
+     */
+    std::expected<GpaTargetPlan, Error> solveForTarget(double targetCgpa, const std::map<std::string, int>& fixedMarks = {}) const;
+};
+
+#endif // GPASIMULATOR_H
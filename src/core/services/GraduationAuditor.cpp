@@ -0,0 +1,98 @@
+#include "GraduationAuditor.h"
+#include "../../common/GradeScale.h"
+#include "../../utils/ParallelUtils.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+
+namespace {
+    constexpr std::size_t STUDENTS_PER_WORKER = 2048; // Dưới mức này một luồng xét nhanh hơn
+    constexpr double CGPA_EPSILON = 1e-9;
+
+    std::string formatGpa(double value) {
+        std::array<char, 32> buffer{};
+        auto [end, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::fixed, 2);
+        return std::string(buffer.data(), end);
+    }
+}
+
+GraduationAuditor::GraduationAuditor(std::vector<std::string> courseIds, std::vector<int> credits,
+                                     const std::vector<DegreeRequirement>& requirements)
+    : _courseIds(std::move(courseIds)), _credits(std::move(credits)) {
+    _credits.resize(_courseIds.size(), 0);
+    std::unordered_map<std::string, std::size_t> indexById;
+    indexById.reserve(_courseIds.size());
+    for (std::size_t i = 0; i < _courseIds.size(); ++i) indexById.emplace(_courseIds[i], i);
+
+    for (const auto& requirement : requirements) {
+        CompiledRule rule{requirement, {}, {}};
+        for (const auto& courseId : requirement.requiredCourseIds) {
+            auto it = indexById.find(courseId);
+            if (it != indexById.end()) {
+                rule.required.set(it->second);
+            } else {
+                rule.unknownCourseIds.push_back(courseId);
+            }
+        }
+        _rules[requirement.facultyId] = std::move(rule);
+    }
+}
+
+GraduationAuditEntry GraduationAuditor::audit(const StudentTranscript& transcript) const {
+    GraduationAuditEntry entry;
+    entry.studentId = transcript.studentId;
+    entry.facultyId = transcript.facultyId;
+
+    CourseBitset passed;
+    long long weightedPoints = 0;
+    long long gradedCredits = 0;
+    for (const auto& [course, marks] : transcript.marks) {
+        if (course >= _courseIds.size() || marks == GradeScale::UNGRADED_MARKS) continue;
+        int credits = _credits[course];
+        if (credits <= 0) continue;
+        int gradePoint = GradeScale::gradePointFromMarks(marks);
+        if (gradePoint < 0) continue;
+        weightedPoints += static_cast<long long>(gradePoint) * credits;
+        gradedCredits += credits;
+        if (marks >= GradeScale::PASS_MARKS) {
+            passed.set(course);
+            entry.earnedCredits += credits;
+        }
+    }
+    entry.cgpa = gradedCredits > 0 ? static_cast<double>(weightedPoints) / static_cast<double>(gradedCredits) : 0.0;
+
+    auto ruleIt = _rules.find(transcript.facultyId);
+    if (ruleIt == _rules.end()) {
+        entry.shortfalls.push_back("No degree requirement defined for faculty " + transcript.facultyId + ".");
+        return entry;
+    }
+    const CompiledRule& rule = ruleIt->second;
+    entry.requiredCredits = rule.requirement.minTotalCredits;
+    entry.requiredCgpa = rule.requirement.minCgpa;
+
+    if (entry.earnedCredits < entry.requiredCredits) {
+        entry.shortfalls.push_back("Earned " + std::to_string(entry.earnedCredits) + " of " +
+                                   std::to_string(entry.requiredCredits) + " required credits.");
+    }
+    // Dung sai nhỏ để CGPA bằng đúng ngưỡng (vd. 2.5) không bị loại vì sai số dấu phẩy động
+    if (entry.cgpa + CGPA_EPSILON < entry.requiredCgpa) {
+        entry.shortfalls.push_back("CGPA " + formatGpa(entry.cgpa) + " is below the required " + formatGpa(entry.requiredCgpa) + ".");
+    }
+    for (std::size_t course : rule.required.without(passed)) entry.missingCourseIds.push_back(_courseIds[course]);
+    entry.missingCourseIds.insert(entry.missingCourseIds.end(), rule.unknownCourseIds.begin(), rule.unknownCourseIds.end());
+    if (!entry.missingCourseIds.empty()) {
+        entry.shortfalls.push_back(std::to_string(entry.missingCourseIds.size()) + " required course(s) not passed.");
+    }
+
+    entry.eligible = entry.shortfalls.empty();
+    return entry;
+}
+
+std::vector<GraduationAuditEntry> GraduationAuditor::auditAll(const std::vector<StudentTranscript>& transcripts) const {
+    std::vector<GraduationAuditEntry> entries(transcripts.size());
+    auto auditRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) entries[i] = audit(transcripts[i]);
+    };
+    ParallelUtils::parallelForChunks(transcripts.size(), STUDENTS_PER_WORKER, auditRange);
+    return entries;
+}
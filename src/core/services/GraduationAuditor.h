@@ -0,0 +1,91 @@
+/**
+ * @file GraduationAuditor.h
+ * @brief Định nghĩa bộ xét điều kiện tốt nghiệp của sinh viên theo quy định của từng khoa
+ */
+#ifndef GRADUATIONAUDITOR_H
+#define GRADUATIONAUDITOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../data_access/interface/IDegreeRequirementDao.h" // DegreeRequirement
+#include "PrerequisiteGraph.h"                              // CourseBitset
+
+/**
+ * @struct StudentTranscript
+ * @brief Bảng điểm rút gọn của một sinh viên theo chỉ số dày đặc của khóa học
+ */
+struct StudentTranscript {
+    std::string studentId;                          ///< ID của sinh viên
+    std::string facultyId;                          ///< Khoa của sinh viên
+    std::vector<std::pair<std::uint32_t, int>> marks; ///< (chỉ số khóa học, điểm) của các kết quả
+};
+
+/**
+ * @struct GraduationAuditEntry
+ * @brief Kết quả xét tốt nghiệp của một sinh viên
+ */
+struct GraduationAuditEntry {
+    std::string studentId;                      ///< ID của sinh viên
+    std::string facultyId;                      ///< Khoa của sinh viên
+    bool eligible = false;                      ///< Đủ mọi điều kiện tốt nghiệp
+    int earnedCredits = 0;                      ///< Số tín chỉ đã qua
+    int requiredCredits = 0;                    ///< Số tín chỉ tối thiểu của khoa
+    double cgpa = 0.0;                          ///< Điểm trung bình tích lũy hệ 4
+    double requiredCgpa = 0.0;                  ///< Điểm trung bình tích lũy tối thiểu của khoa
+    std::vector<std::string> missingCourseIds;  ///< Các khóa học bắt buộc chưa qua
+    std::vector<std::string> shortfalls;        ///< Mô tả từng điều kiện chưa đạt
+};
+
+/**
+ * @class GraduationAuditor
+ * @brief Xét điều kiện tốt nghiệp cho nhiều sinh viên trên dữ liệu đã nạp sẵn
+ *
+ * Các khóa học bắt buộc của mỗi khoa được biên dịch một lần thành CourseBitset, nên kiểm tra
+ * "đã qua mọi môn bắt buộc" là một phép trừ tập trên vài từ máy. auditAll() chia sinh viên thành
+ * các dải liên tiếp cho nhiều luồng; mỗi luồng chỉ ghi kết quả của dải mình nên không cần khóa.
+ */
+class GraduationAuditor {
+private:
+    /**
+     * @brief Quy định của một khoa đã biên dịch
+     */
+    struct CompiledRule {
+        DegreeRequirement requirement;             ///< Quy định gốc
+        CourseBitset required;                     ///< Các khóa học bắt buộc đã biết
+        std::vector<std::string> unknownCourseIds; ///< Khóa học bắt buộc không còn tồn tại (luôn coi là chưa qua)
+    };
+
+    std::vector<std::string> _courseIds;                        ///< courseId theo chỉ số dày đặc
+    std::vector<int> _credits;                                  ///< Tín chỉ theo chỉ số dày đặc
+    std::unordered_map<std::string, CompiledRule> _rules;       ///< Quy định theo facultyId
+
+public:
+    /**
+     * @brief Biên dịch quy định của các khoa
+     * @param courseIds ID của các khóa học (chỉ số trong vector là chỉ số dày đặc)
+     * @param credits Số tín chỉ của từng khóa học, cùng chỉ số với courseIds
+     * @param requirements Quy định tốt nghiệp của các khoa
+     */
+    GraduationAuditor(std::vector<std::string> courseIds, std::vector<int> credits,
+                      const std::vector<DegreeRequirement>& requirements);
+
+    /**
+     * @brief Xét một sinh viên
+     *
+     * Tín chỉ và CGPA được tính như ResultService::calculateCGPA: bỏ qua môn chưa có điểm và
+     * môn 0 tín chỉ. Sinh viên thuộc khoa chưa có quy định luôn không đủ điều kiện.
+     */
+    GraduationAuditEntry audit(const StudentTranscript& transcript) const;
+
+    /**
+     * @brief Xét mọi sinh viên song song
+     * @return Kết quả theo đúng thứ tự của transcripts
+     */
+    std::vector<GraduationAuditEntry> auditAll(const std::vector<StudentTranscript>& transcripts) const;
+};
+
+#endif // GRADUATIONAUDITOR_H
@@ -0,0 +1,33 @@
+#include "InstallmentSchedule.h"
+#include <algorithm>
+
+long long InstallmentSchedule::totalOf(const std::vector<FeeInstallment>& installments) {
+    long long total = 0;
+    for (const auto& installment : installments) total += installment.amount;
+    return total;
+}
+
+std::vector<FeeInstallment> InstallmentSchedule::rescale(const std::vector<FeeInstallment>& installments, long newTotal, long paidTotal) {
+    const long long oldTotal = totalOf(installments);
+    if (installments.empty() || newTotal <= 0 || oldTotal <= 0) return {};
+
+    std::vector<FeeInstallment> rescaled;
+    rescaled.reserve(installments.size());
+    long long assigned = 0;
+    for (std::size_t i = 0; i < installments.size(); ++i) {
+        FeeInstallment installment = installments[i];
+        // Đợt cuối nhận phần còn lại để tổng khớp chính xác với newTotal
+        installment.amount = i + 1 == installments.size()
+            ? static_cast<long>(newTotal - assigned)
+            : static_cast<long>(static_cast<long long>(installments[i].amount) * newTotal / oldTotal);
+        assigned += installment.amount;
+        if (installment.amount > 0) rescaled.push_back(std::move(installment));
+    }
+
+    long remaining = std::max(0L, paidTotal);
+    for (auto& installment : rescaled) {
+        installment.paidAmount = std::min(installment.amount, remaining);
+        remaining -= installment.paidAmount;
+    }
+    return rescaled;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file InstallmentSchedule.h
+ * @brief Điều chỉnh lịch trả góp khi tổng học phí thay đổi
+ */
+#ifndef INSTALLMENTSCHEDULE_H
+#define INSTALLMENTSCHEDULE_H
+
+#include <vector>
+#include "../data_access/interface/IInstallmentDao.h"
+
+/**
+ * @namespace InstallmentSchedule
+ * @brief Các phép tính trên lịch trả góp dùng chung cho những nơi ghi tổng học phí
+ *
+ * Lịch trả góp được lập sao cho tổng các đợt bằng tổng học phí; khi tổng học phí đổi (tính lại theo
+ * tín chỉ hoặc admin đặt tay) lịch phải đổi theo, nếu không nợ quá hạn sẽ tính theo số tiền cũ.
+ */
+namespace InstallmentSchedule {
+    /**
+     * @brief Tổng số tiền của các đợt
+     */
+    long long totalOf(const std::vector<FeeInstallment>& installments);
+
+    /**
+     * @brief Chia lại số tiền các đợt theo tỷ lệ cho tổng học phí mới rồi phân bổ lại số đã đóng
+     *
+     * Ngày đến hạn, số thứ tự và cờ trễ hạn giữ nguyên; phần lẻ do làm tròn dồn vào đợt cuối. Đợt có
+     * số tiền về 0 bị bỏ, tổng mới bằng 0 thì lịch rỗng.
+     * @param installments Lịch hiện tại, theo ngày đến hạn
+     * @param newTotal Tổng học phí mới
+     * @param paidTotal Tổng học phí đã đóng
+     * @return Lịch mới có tổng bằng newTotal
+     */
+    std::vector<FeeInstallment> rescale(const std::vector<FeeInstallment>& installments, long newTotal, long paidTotal);
+}
+
+#endif // INSTALLMENTSCHEDULE_H
@@ -0,0 +1,165 @@
+#include "PrerequisiteGraph.h"
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+void CourseBitset::set(std::size_t index) {
+    std::size_t word = index / 64;
+    if (word >= _words.size()) _words.resize(word + 1, 0);
+    _words[word] |= std::uint64_t{1} << (index % 64);
+}
+
+bool CourseBitset::test(std::size_t index) const {
+    std::size_t word = index / 64;
+    return word < _words.size() && (_words[word] >> (index % 64)) & 1;
+}
+
+void CourseBitset::merge(const CourseBitset& other) {
+    if (other._words.size() > _words.size()) _words.resize(other._words.size(), 0);
+    for (std::size_t i = 0; i < other._words.size(); ++i) _words[i] |= other._words[i];
+}
+
+bool CourseBitset::none() const {
+    return std::all_of(_words.begin(), _words.end(), [](std::uint64_t word) { return word == 0; });
+}
+
+std::vector<std::size_t> CourseBitset::without(const CourseBitset& other) const {
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < _words.size(); ++i) {
+        std::uint64_t rest = _words[i] & ~(i < other._words.size() ? other._words[i] : 0);
+        while (rest != 0) {
+            indices.push_back(i * 64 + static_cast<std::size_t>(std::countr_zero(rest)));
+            rest &= rest - 1;
+        }
+    }
+    return indices;
+}
+
+std::size_t PrerequisiteGraph::indexOf(const std::string& courseId) {
+    auto [it, inserted] = _indexById.try_emplace(courseId, _courseIds.size());
+    if (inserted) {
+        _courseIds.push_back(courseId);
+        _direct.emplace_back();
+        _closures.emplace_back();
+    }
+    return it->second;
+}
+
+const std::size_t* PrerequisiteGraph::findIndex(const std::string& courseId) const {
+    auto it = _indexById.find(courseId);
+    return it == _indexById.end() ? nullptr : &it->second;
+}
+
+void PrerequisiteGraph::rebuildClosures() {
+    // Đồ thị không có chu trình nên DFS có ghi nhớ tính mỗi bao đóng đúng một lần
+    std::vector<bool> done(_courseIds.size(), false);
+    std::function<const CourseBitset&(std::size_t)> closureOf = [&](std::size_t course) -> const CourseBitset& {
+        if (!done[course]) {
+            CourseBitset closure;
+            for (std::size_t prerequisite : _direct[course]) {
+                closure.set(prerequisite);
+                closure.merge(closureOf(prerequisite));
+            }
+            _closures[course] = std::move(closure);
+            done[course] = true;
+        }
+        return _closures[course];
+    };
+    for (std::size_t course = 0; course < _courseIds.size(); ++course) closureOf(course);
+}
+
+std::vector<std::string> PrerequisiteGraph::idsOf(std::vector<std::size_t> indices) const {
+    std::vector<std::string> ids;
+    ids.reserve(indices.size());
+    for (std::size_t index : indices) ids.push_back(_courseIds[index]);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+std::expected<PrerequisiteGraph, Error> PrerequisiteGraph::build(const std::vector<CoursePrerequisite>& prerequisites) {
+    PrerequisiteGraph graph;
+    for (const auto& prerequisite : prerequisites) {
+        auto added = graph.add(prerequisite.courseId, prerequisite.prerequisiteId);
+        if (!added.has_value() && added.error().code != ErrorCode::ALREADY_EXISTS) return std::unexpected(added.error());
+    }
+    return graph;
+}
+
+std::expected<bool, Error> PrerequisiteGraph::canAdd(const std::string& courseId, const std::string& prerequisiteId) const {
+    if (courseId == prerequisiteId) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Course " + courseId + " cannot be its own prerequisite."});
+    }
+    const std::size_t* course = findIndex(courseId);
+    const std::size_t* prerequisite = findIndex(prerequisiteId);
+    if (course == nullptr || prerequisite == nullptr) return true;
+    if (std::find(_direct[*course].begin(), _direct[*course].end(), *prerequisite) != _direct[*course].end()) {
+        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Course " + prerequisiteId + " is already a prerequisite of course " + courseId + "."});
+    }
+    // Cạnh course -> prerequisite tạo chu trình khi và chỉ khi course đã là môn tiên quyết của prerequisite
+    if (_closures[*prerequisite].test(*course)) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Making " + prerequisiteId + " a prerequisite of " + courseId +
+                                                                  " would create a cycle: " + courseId + " is already required for " + prerequisiteId + "."});
+    }
+    return true;
+}
+
+std::expected<bool, Error> PrerequisiteGraph::add(const std::string& courseId, const std::string& prerequisiteId) {
+    auto allowed = canAdd(courseId, prerequisiteId);
+    if (!allowed.has_value()) return allowed;
+
+    std::size_t course = indexOf(courseId);
+    std::size_t prerequisite = indexOf(prerequisiteId);
+    _direct[course].push_back(prerequisite);
+
+    // course và mọi khóa học cần course đều cần thêm prerequisite cùng bao đóng của nó
+    CourseBitset gained = _closures[prerequisite];
+    gained.set(prerequisite);
+    for (std::size_t other = 0; other < _closures.size(); ++other) {
+        if (other == course || _closures[other].test(course)) _closures[other].merge(gained);
+    }
+    return true;
+}
+
+bool PrerequisiteGraph::remove(const std::string& courseId, const std::string& prerequisiteId) {
+    const std::size_t* course = findIndex(courseId);
+    const std::size_t* prerequisite = findIndex(prerequisiteId);
+    if (course == nullptr || prerequisite == nullptr) return false;
+    auto& direct = _direct[*course];
+    auto it = std::find(direct.begin(), direct.end(), *prerequisite);
+    if (it == direct.end()) return false;
+    direct.erase(it);
+    // Một môn có thể vẫn được yêu cầu qua đường khác nên bao đóng được tính lại từ đầu
+    rebuildClosures();
+    return true;
+}
+
+std::vector<std::string> PrerequisiteGraph::directPrerequisites(const std::string& courseId) const {
+    const std::size_t* course = findIndex(courseId);
+    if (course == nullptr) return {};
+    return idsOf(_direct[*course]);
+}
+
+std::vector<std::string> PrerequisiteGraph::allPrerequisites(const std::string& courseId) const {
+    const std::size_t* course = findIndex(courseId);
+    if (course == nullptr) return {};
+    return idsOf(_closures[*course].without(CourseBitset{}));
+}
+
+bool PrerequisiteGraph::hasPrerequisites(const std::string& courseId) const {
+    const std::size_t* course = findIndex(courseId);
+    return course != nullptr && !_direct[*course].empty();
+}
+
+CourseBitset PrerequisiteGraph::bitsetOf(const std::vector<std::string>& courseIds) const {
+    CourseBitset bitset;
+    for (const auto& courseId : courseIds) {
+        if (const std::size_t* index = findIndex(courseId)) bitset.set(*index);
+    }
+    return bitset;
+}
+
+std::vector<std::string> PrerequisiteGraph::missingPrerequisites(const std::string& courseId, const CourseBitset& passed) const {
+    const std::size_t* course = findIndex(courseId);
+    if (course == nullptr) return {};
+    return idsOf(_closures[*course].without(passed));
+}
@@ -0,0 +1,130 @@
+/**
+ * @file PrerequisiteGraph.h
+ * @brief Định nghĩa đồ thị môn tiên quyết với bao đóng bắc cầu tính sẵn dạng bitset
+ */
+#ifndef PREREQUISITEGRAPH_H
+#define PREREQUISITEGRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../../common/ErrorType.h"
+#include "../data_access/interface/IPrerequisiteDao.h" // CoursePrerequisite
+
+/**
+ * @class CourseBitset
+ * @brief Tập khóa học theo chỉ số dày đặc của PrerequisiteGraph, mỗi khóa học một bit
+ *
+ * Tự mở rộng khi đặt bit mới; các bit ngoài kích thước hiện tại được coi là 0.
+ */
+class CourseBitset {
+private:
+    std::vector<std::uint64_t> _words; ///< 64 khóa học mỗi từ
+
+public:
+    /**
+     * @brief Thêm khóa học có chỉ số index vào tập
+     */
+    void set(std::size_t index);
+
+    /**
+     * @brief Tập có chứa khóa học có chỉ số index hay không
+     */
+    bool test(std::size_t index) const;
+
+    /**
+     * @brief Hợp với một tập khác
+     */
+    void merge(const CourseBitset& other);
+
+    /**
+     * @brief Tập có rỗng hay không
+     */
+    bool none() const;
+
+    /**
+     * @brief Các chỉ số thuộc tập này nhưng không thuộc other (theo thứ tự tăng dần)
+     */
+    std::vector<std::size_t> without(const CourseBitset& other) const;
+};
+
+/**
+ * @class PrerequisiteGraph
+ * @brief Đồ thị có hướng không chu trình của các môn tiên quyết
+ *
+ * Mỗi khóa học xuất hiện trong đồ thị được gán một chỉ số dày đặc. Bao đóng bắc cầu (mọi môn
+ * tiên quyết trực tiếp và gián tiếp) của từng khóa học được giữ sẵn dạng CourseBitset, nên kiểm
+ * tra "đã qua mọi môn tiên quyết" là một phép trừ tập trên vài từ máy dù chuỗi tiên quyết dài.
+ * Thêm cạnh cập nhật bao đóng của các khóa học phụ thuộc, O(V * V / 64); xóa cạnh tính lại toàn bộ.
+ * Lớp không an toàn luồng; người dùng tự đồng bộ.
+ */
+class PrerequisiteGraph {
+private:
+    std::unordered_map<std::string, std::size_t> _indexById;  ///< Chỉ số dày đặc theo courseId
+    std::vector<std::string> _courseIds;                     ///< courseId theo chỉ số
+    std::vector<std::vector<std::size_t>> _direct;           ///< Môn tiên quyết trực tiếp theo chỉ số
+    std::vector<CourseBitset> _closures;                     ///< Bao đóng bắc cầu theo chỉ số
+
+    std::size_t indexOf(const std::string& courseId);
+    const std::size_t* findIndex(const std::string& courseId) const;
+    void rebuildClosures();
+    std::vector<std::string> idsOf(std::vector<std::size_t> indices) const;
+
+public:
+    /**
+     * @brief Dựng đồ thị từ các cạnh đã lưu
+     * @return Đồ thị, hoặc Error (VALIDATION_ERROR nếu dữ liệu có chu trình)
+     */
+    static std::expected<PrerequisiteGraph, Error> build(const std::vector<CoursePrerequisite>& prerequisites);
+
+    /**
+     * @brief Kiểm tra có thể thêm cạnh mà không tạo chu trình hay không (không thay đổi đồ thị)
+     * @return true, hoặc Error (VALIDATION_ERROR nếu tạo chu trình, ALREADY_EXISTS nếu cạnh đã có)
+     */
+    std::expected<bool, Error> canAdd(const std::string& courseId, const std::string& prerequisiteId) const;
+
+    /**
+     * @brief Thêm cạnh: phải qua prerequisiteId trước khi học courseId
+     * @return true, hoặc Error như canAdd()
+     */
+    std::expected<bool, Error> add(const std::string& courseId, const std::string& prerequisiteId);
+
+    /**
+     * @brief Xóa cạnh
+     * @return false nếu cạnh không tồn tại
+     */
+    bool remove(const std::string& courseId, const std::string& prerequisiteId);
+
+    /**
+     * @brief Các môn tiên quyết trực tiếp của khóa học (theo courseId)
+     */
+    std::vector<std::string> directPrerequisites(const std::string& courseId) const;
+
+    /**
+     * @brief Mọi môn tiên quyết trực tiếp và gián tiếp của khóa học (theo courseId)
+     */
+    std::vector<std::string> allPrerequisites(const std::string& courseId) const;
+
+    /**
+     * @brief Khóa học có môn tiên quyết nào không
+     */
+    bool hasPrerequisites(const std::string& courseId) const;
+
+    /**
+     * @brief Tập các khóa học trong đồ thị thuộc danh sách (bỏ qua khóa học không phải môn tiên quyết của ai)
+     */
+    CourseBitset bitsetOf(const std::vector<std::string>& courseIds) const;
+
+    /**
+     * @brief Các môn tiên quyết (trực tiếp và gián tiếp) của khóa học chưa có trong passed
+     * @param courseId ID của khóa học
+     * @param passed Tập các khóa học đã qua, dựng bằng bitsetOf()
+     * @return Danh sách courseId (rỗng nếu đủ điều kiện)
+     */
+    std::vector<std::string> missingPrerequisites(const std::string& courseId, const CourseBitset& passed) const;
+};
+
+#endif // PREREQUISITEGRAPH_H
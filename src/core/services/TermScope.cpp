@@ -0,0 +1,25 @@
+#include "TermScope.h"
+#include "../../utils/DateUtils.h"
+
+std::expected<std::string, Error> TermScope::resolve(const ITermDao& termDao, const std::string& termId) {
+    if (!termId.empty()) {
+        auto term = termDao.findById(termId);
+        if (!term.has_value()) return std::unexpected(term.error());
+        return term->id;
+    }
+    auto current = termDao.findCurrent(DateUtils::todayIsoDate());
+    if (current.has_value()) return current->id;
+    if (current.error().code != ErrorCode::NOT_FOUND) return std::unexpected(current.error());
+
+    // Không có học kỳ hiện tại: chỉ dùng mọi đăng ký khi chưa từng tạo học kỳ nào
+    auto terms = termDao.getAll();
+    if (!terms.has_value()) return std::unexpected(terms.error());
+    if (!terms->empty()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "No open term has started. Specify the term explicitly."});
+    }
+    return std::string{};
+}
+
+bool TermScope::includes(const std::string& scopeTermId, const std::string& recordTermId) {
+    return scopeTermId.empty() || recordTermId.empty() || recordTermId == scopeTermId;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file TermScope.h
+ * @brief Chọn học kỳ cho các tác vụ toàn trường (tính học phí, xếp lịch thi)
+ */
+#ifndef TERMSCOPE_H
+#define TERMSCOPE_H
+
+#include <expected>
+#include <string>
+#include "../../common/ErrorType.h"
+#include "../data_access/interface/ITermDao.h"
+
+/**
+ * @namespace TermScope
+ * @brief Phạm vi học kỳ của các tác vụ duyệt mọi đăng ký
+ *
+ * Đăng ký của các học kỳ đã qua vẫn nằm trong cùng bảng, nên các tác vụ toàn trường phải lọc theo
+ * một học kỳ. Đăng ký chưa gán học kỳ (dữ liệu trước khi có học kỳ) thuộc mọi phạm vi.
+ */
+namespace TermScope {
+    /**
+     * @brief Học kỳ mà tác vụ làm việc trên đó
+     * @param termDao Đối tượng dao cho học kỳ
+     * @param termId Học kỳ được chỉ rõ; rỗng để dùng học kỳ hiện tại
+     * @return Mã học kỳ, chuỗi rỗng nếu chưa có học kỳ nào (mọi đăng ký), hoặc Error (NOT_FOUND nếu
+     *         termId không tồn tại, VALIDATION_ERROR nếu đã có học kỳ nhưng không học kỳ nào đang diễn ra)
+     */
+    std::expected<std::string, Error> resolve(const ITermDao& termDao, const std::string& termId = "");
+
+    /**
+     * @brief Đăng ký thuộc học kỳ recordTermId có nằm trong phạm vi scopeTermId không
+     */
+    bool includes(const std::string& scopeTermId, const std::string& recordTermId);
+}
+
+#endif // TERMSCOPE_H
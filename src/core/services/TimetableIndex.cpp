@@ -0,0 +1,70 @@
+#include "TimetableIndex.h"
+#include <algorithm>
+#include <functional>
+
+WeeklyTimetable::Mask WeeklyTimetable::maskOf(const std::vector<MeetingSlot>& slots) {
+    Mask mask;
+    for (const auto& slot : slots) {
+        if (!slot.validate().isValid) continue;
+        std::size_t dayOffset = static_cast<std::size_t>(slot.weekday - 1) * CELLS_PER_DAY;
+        auto first = static_cast<std::size_t>(slot.startMinute / MeetingSlot::SLOT_MINUTES);
+        auto last = static_cast<std::size_t>(slot.endMinute / MeetingSlot::SLOT_MINUTES);
+        for (std::size_t cell = first; cell < last; ++cell) mask.set(dayOffset + cell);
+    }
+    return mask;
+}
+
+bool WeeklyTimetable::clashesWith(const Mask& mask) const {
+    return (_busy & mask).any();
+}
+
+void WeeklyTimetable::add(const Mask& mask) {
+    _busy |= mask;
+}
+
+bool WeeklyTimetable::empty() const {
+    return _busy.none();
+}
+
+std::mutex& TimetableIndex::studentLock(const std::string& studentId) {
+    return _studentLocks[std::hash<std::string>{}(studentId) % STUDENT_LOCK_STRIPES];
+}
+
+std::optional<TimetableIndex::CourseSchedule> TimetableIndex::findCourse(const std::string& courseId) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _courses.find(courseId);
+    if (it == _courses.end()) return std::nullopt;
+    return it->second;
+}
+
+void TimetableIndex::storeCourse(const std::string& courseId, const std::vector<MeetingSlot>& slots) {
+    CourseSchedule schedule{slots, WeeklyTimetable::maskOf(slots)};
+    std::lock_guard<std::mutex> lock(_mutex);
+    _courses[courseId] = std::move(schedule);
+}
+
+std::optional<WeeklyTimetable> TimetableIndex::findStudent(const std::string& studentId, const std::vector<std::string>& courseIds) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _students.find(studentId);
+    if (it == _students.end() || it->second.courseIds != courseIds) return std::nullopt;
+    return it->second.timetable;
+}
+
+void TimetableIndex::storeStudent(const std::string& studentId, std::vector<std::string> courseIds, const WeeklyTimetable& timetable) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _students[studentId] = StudentTimetable{std::move(courseIds), timetable};
+}
+
+void TimetableIndex::invalidateCourse(const std::string& courseId) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _courses.erase(courseId);
+    std::erase_if(_students, [&courseId](const auto& entry) {
+        return std::binary_search(entry.second.courseIds.begin(), entry.second.courseIds.end(), courseId);
+    });
+}
+
+void TimetableIndex::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _courses.clear();
+    _students.clear();
+}
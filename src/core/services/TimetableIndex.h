@@ -0,0 +1,133 @@
+/**
+ * @file TimetableIndex.h
+ * @brief Định nghĩa thời khóa biểu tuần dạng bitset và bộ đệm thời khóa biểu của sinh viên
+ */
+#ifndef TIMETABLEINDEX_H
+#define TIMETABLEINDEX_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../entities/MeetingSlot.h"
+
+/**
+ * @class WeeklyTimetable
+ * @brief Các khoảng giờ bận trong một tuần, mỗi bit là một ô MeetingSlot::SLOT_MINUTES phút
+ *
+ * Một tuần có 2016 ô (252 byte), nên kiểm tra trùng lịch là một phép AND trên 32 từ máy,
+ * không phụ thuộc số môn đã đăng ký.
+ */
+class WeeklyTimetable {
+public:
+    static constexpr std::size_t CELLS_PER_DAY = MeetingSlot::MINUTES_PER_DAY / MeetingSlot::SLOT_MINUTES; ///< Số ô mỗi ngày
+    static constexpr std::size_t CELLS = 7 * CELLS_PER_DAY; ///< Số ô mỗi tuần
+    using Mask = std::bitset<CELLS>;
+
+private:
+    Mask _busy; ///< Các ô đã có buổi học
+
+public:
+    /**
+     * @brief Mặt nạ các ô bị chiếm bởi lịch học (bỏ qua buổi học không hợp lệ)
+     */
+    static Mask maskOf(const std::vector<MeetingSlot>& slots);
+
+    /**
+     * @brief Lịch học có trùng với thời khóa biểu hay không
+     */
+    bool clashesWith(const Mask& mask) const;
+
+    /**
+     * @brief Đánh dấu bận các ô của lịch học
+     */
+    void add(const Mask& mask);
+
+    /**
+     * @brief Thời khóa biểu chưa có buổi học nào
+     */
+    bool empty() const;
+};
+
+/**
+ * @class TimetableIndex
+ * @brief Bộ đệm dùng chung của lịch học từng khóa học và thời khóa biểu từng sinh viên
+ *
+ * Thời khóa biểu của sinh viên được ghép từ mặt nạ của các khóa học đã đăng ký và chỉ được
+ * ghép lại khi danh sách khóa học đó thay đổi, nên khi đăng ký chỉ cần danh sách ID khóa học
+ * (một truy vấn theo khóa chính) thay vì nạp lại mọi khóa học. Đổi lịch hoặc xóa khóa học phải
+ * gọi invalidateCourse(). Mọi phương thức đều an toàn luồng.
+ */
+class TimetableIndex {
+public:
+    /**
+     * @brief Lịch học đã đệm của một khóa học
+     */
+    struct CourseSchedule {
+        std::vector<MeetingSlot> slots; ///< Các buổi học
+        WeeklyTimetable::Mask mask;     ///< Mặt nạ các ô của các buổi học
+    };
+
+private:
+    /**
+     * @brief Thời khóa biểu đã ghép của một sinh viên
+     */
+    struct StudentTimetable {
+        std::vector<std::string> courseIds; ///< Các khóa học đã ghép, đã sắp xếp
+        WeeklyTimetable timetable;          ///< Thời khóa biểu ghép từ courseIds
+    };
+
+    static constexpr std::size_t STUDENT_LOCK_STRIPES = 64; ///< Số khóa dùng chung theo băm studentId
+
+    mutable std::mutex _mutex;                                          ///< Bảo vệ hai bộ đệm
+    std::unordered_map<std::string, CourseSchedule> _courses;           ///< Lịch học theo courseId
+    std::unordered_map<std::string, StudentTimetable> _students;        ///< Thời khóa biểu theo studentId
+    std::array<std::mutex, STUDENT_LOCK_STRIPES> _studentLocks;         ///< Khóa tuần tự hóa đăng ký của cùng sinh viên
+
+public:
+    /**
+     * @brief Khóa dùng để kiểm tra trùng lịch và đăng ký của một sinh viên như một thao tác
+     */
+    std::mutex& studentLock(const std::string& studentId);
+
+    /**
+     * @brief Lịch học đã đệm của khóa học
+     */
+    std::optional<CourseSchedule> findCourse(const std::string& courseId) const;
+
+    /**
+     * @brief Đệm (hoặc thay) lịch học của khóa học
+     */
+    void storeCourse(const std::string& courseId, const std::vector<MeetingSlot>& slots);
+
+    /**
+     * @brief Thời khóa biểu đã đệm của sinh viên nếu được ghép từ đúng các khóa học này
+     * @param studentId ID của sinh viên
+     * @param courseIds Các khóa học sinh viên đang đăng ký (đã sắp xếp)
+     */
+    std::optional<WeeklyTimetable> findStudent(const std::string& studentId, const std::vector<std::string>& courseIds) const;
+
+    /**
+     * @brief Đệm thời khóa biểu của sinh viên
+     * @param studentId ID của sinh viên
+     * @param courseIds Các khóa học đã ghép (đã sắp xếp)
+     * @param timetable Thời khóa biểu ghép từ courseIds
+     */
+    void storeStudent(const std::string& studentId, std::vector<std::string> courseIds, const WeeklyTimetable& timetable);
+
+    /**
+     * @brief Bỏ lịch đã đệm của khóa học và thời khóa biểu của các sinh viên có khóa học đó
+     */
+    void invalidateCourse(const std::string& courseId);
+
+    /**
+     * @brief Bỏ toàn bộ bộ đệm
+     */
+    void clear();
+};
+
+#endif // TIMETABLEINDEX_H
@@ -0,0 +1,152 @@
+#include "WaitlistQueue.h"
+#include <algorithm>
+#include <tuple>
+
+namespace {
+    // Số vé tối thiểu trước khi một nhóm được dồn lại, tránh xây lại liên tục khi hàng còn ngắn
+    constexpr std::size_t MIN_COMPACT_TICKETS = 32;
+
+    std::size_t lowBit(std::size_t index) {
+        return index & (~index + 1);
+    }
+}
+
+WaitlistQueue::WaitlistQueue(std::string courseId) : _courseId(std::move(courseId)) {}
+
+void WaitlistQueue::fenwickAdd(Lane& lane, std::size_t index, int delta) {
+    for (std::size_t i = index + 1; i < lane.fenwick.size(); i += lowBit(i)) {
+        lane.fenwick[i] += delta;
+    }
+}
+
+std::size_t WaitlistQueue::fenwickPrefix(const Lane& lane, std::size_t count) {
+    long long sum = 0;
+    for (std::size_t i = count; i > 0; i -= lowBit(i)) {
+        sum += lane.fenwick[i];
+    }
+    return static_cast<std::size_t>(sum);
+}
+
+void WaitlistQueue::fenwickAppend(Lane& lane, int value) {
+    if (lane.fenwick.empty()) lane.fenwick.push_back(0); // Chỉ số 0 không dùng
+    // Nút mới i bao đoạn (i - lowbit(i), i]: giá trị mới cộng tổng các vé trước nó trong đoạn
+    std::size_t i = lane.fenwick.size();
+    long long covered = static_cast<long long>(fenwickPrefix(lane, i - 1)) - static_cast<long long>(fenwickPrefix(lane, i - lowBit(i)));
+    lane.fenwick.push_back(value + static_cast<int>(covered));
+}
+
+void WaitlistQueue::rebuildLane(int priorityClass, std::vector<Ticket> tickets) {
+    Lane& lane = _lanes[static_cast<std::size_t>(priorityClass)];
+    lane.tickets = std::move(tickets);
+    lane.activeCount = lane.tickets.size();
+    lane.head = 0;
+    lane.fenwick.assign(lane.tickets.size() + 1, 1);
+    lane.fenwick[0] = 0;
+    // Xây cây Fenwick trong O(n): mỗi nút cộng dồn vào nút cha của nó
+    for (std::size_t i = 1; i < lane.fenwick.size(); ++i) {
+        std::size_t parent = i + lowBit(i);
+        if (parent < lane.fenwick.size()) lane.fenwick[parent] += lane.fenwick[i];
+    }
+    for (std::size_t index = 0; index < lane.tickets.size(); ++index) {
+        _slots[lane.tickets[index].studentId] = Slot{priorityClass, index};
+    }
+}
+
+bool WaitlistQueue::push(const WaitlistEntry& entry) {
+    if (entry.courseId != _courseId || entry.studentId.empty() || entry.priorityClass < 0 || _slots.contains(entry.studentId)) {
+        return false;
+    }
+    auto laneIndex = static_cast<std::size_t>(entry.priorityClass);
+    if (laneIndex >= _lanes.size()) _lanes.resize(laneIndex + 1);
+    Lane& lane = _lanes[laneIndex];
+
+    Ticket ticket{entry.studentId, entry.requestedAt, true};
+    auto rank = [](const Ticket& t) { return std::tie(t.requestedAt, t.studentId); };
+    if (!lane.tickets.empty() && rank(ticket) < rank(lane.tickets.back())) {
+        // Vé đến muộn hơn vé đã có: xây lại nhóm theo đúng thứ tự
+        std::vector<Ticket> active;
+        active.reserve(lane.activeCount + 1);
+        for (auto& existing : lane.tickets) {
+            if (existing.active) active.push_back(std::move(existing));
+        }
+        active.insert(std::upper_bound(active.begin(), active.end(), ticket,
+                                       [&rank](const Ticket& a, const Ticket& b) { return rank(a) < rank(b); }),
+                      ticket);
+        rebuildLane(entry.priorityClass, std::move(active));
+        return true;
+    }
+
+    lane.tickets.push_back(std::move(ticket));
+    fenwickAppend(lane, 1);
+    ++lane.activeCount;
+    _slots[entry.studentId] = Slot{entry.priorityClass, lane.tickets.size() - 1};
+    return true;
+}
+
+bool WaitlistQueue::erase(const std::string& studentId) {
+    auto it = _slots.find(studentId);
+    if (it == _slots.end()) return false;
+    Slot slot = it->second;
+    _slots.erase(it);
+
+    Lane& lane = _lanes[static_cast<std::size_t>(slot.priorityClass)];
+    lane.tickets[slot.index].active = false;
+    fenwickAdd(lane, slot.index, -1);
+    --lane.activeCount;
+
+    if (lane.tickets.size() >= MIN_COMPACT_TICKETS && lane.activeCount * 2 < lane.tickets.size()) {
+        std::vector<Ticket> active;
+        active.reserve(lane.activeCount);
+        for (auto& ticket : lane.tickets) {
+            if (ticket.active) active.push_back(std::move(ticket));
+        }
+        rebuildLane(slot.priorityClass, std::move(active));
+    }
+    return true;
+}
+
+std::optional<std::size_t> WaitlistQueue::position(const std::string& studentId) const {
+    auto it = _slots.find(studentId);
+    if (it == _slots.end()) return std::nullopt;
+    const Slot& slot = it->second;
+
+    std::size_t ahead = 0;
+    for (int priorityClass = 0; priorityClass < slot.priorityClass; ++priorityClass) {
+        ahead += _lanes[static_cast<std::size_t>(priorityClass)].activeCount;
+    }
+    return ahead + fenwickPrefix(_lanes[static_cast<std::size_t>(slot.priorityClass)], slot.index + 1);
+}
+
+std::optional<WaitlistEntry> WaitlistQueue::front() {
+    for (std::size_t priorityClass = 0; priorityClass < _lanes.size(); ++priorityClass) {
+        Lane& lane = _lanes[priorityClass];
+        if (lane.activeCount == 0) continue;
+        while (!lane.tickets[lane.head].active) ++lane.head;
+        const Ticket& ticket = lane.tickets[lane.head];
+        return WaitlistEntry{_courseId, ticket.studentId, static_cast<int>(priorityClass), ticket.requestedAt};
+    }
+    return std::nullopt;
+}
+
+std::vector<WaitlistEntry> WaitlistQueue::entries() const {
+    std::vector<WaitlistEntry> result;
+    result.reserve(_slots.size());
+    for (std::size_t priorityClass = 0; priorityClass < _lanes.size(); ++priorityClass) {
+        for (const auto& ticket : _lanes[priorityClass].tickets) {
+            if (ticket.active) result.push_back(WaitlistEntry{_courseId, ticket.studentId, static_cast<int>(priorityClass), ticket.requestedAt});
+        }
+    }
+    return result;
+}
+
+std::size_t WaitlistQueue::size() const {
+    return _slots.size();
+}
+
+bool WaitlistQueue::empty() const {
+    return _slots.empty();
+}
+
+const std::string& WaitlistQueue::getCourseId() const {
+    return _courseId;
+}
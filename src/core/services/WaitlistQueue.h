@@ -0,0 +1,122 @@
+/**
+ * @file WaitlistQueue.h
+ * @brief Định nghĩa hàng đợi ưu tiên trong bộ nhớ cho danh sách chờ của một khóa học
+ */
+#ifndef WAITLISTQUEUE_H
+#define WAITLISTQUEUE_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../data_access/interface/IWaitlistDao.h"
+
+/**
+ * @class WaitlistQueue
+ * @brief Danh sách chờ của một khóa học, sắp theo (priorityClass, requestedAt, studentId)
+ *
+ * Mỗi nhóm ưu tiên là một dãy vé chỉ thêm vào cuối kèm cây Fenwick đếm số vé còn hiệu lực,
+ * nên vị trí chờ = số người ở các nhóm ưu tiên cao hơn + tổng tiền tố trong nhóm, tính
+ * trong O(số nhóm + log n). Rời hàng chỉ đánh dấu vé hết hiệu lực (O(log n)); một nhóm được
+ * dồn lại khi quá nửa số vé đã hết hiệu lực. Vé đến không theo thứ tự thời gian (hiếm) làm
+ * nhóm được xây lại trong O(n).
+ *
+ * Lớp không tự đồng bộ hóa; WaitlistService giữ khóa khi truy cập.
+ */
+class WaitlistQueue {
+private:
+    /**
+     * @brief Một vé chờ trong nhóm ưu tiên
+     */
+    struct Ticket {
+        std::string studentId;     ///< ID của sinh viên
+        long long requestedAt = 0; ///< Thời điểm đăng ký chờ
+        bool active = true;        ///< Vé còn hiệu lực (chưa rời hàng)
+    };
+
+    /**
+     * @brief Các vé của một nhóm ưu tiên theo thứ tự chờ
+     */
+    struct Lane {
+        std::vector<Ticket> tickets; ///< Vé theo thứ tự (requestedAt, studentId)
+        std::vector<int> fenwick;    ///< Cây Fenwick (chỉ số từ 1) trên cờ active của tickets
+        std::size_t activeCount = 0; ///< Số vé còn hiệu lực
+        std::size_t head = 0;        ///< Không có vé còn hiệu lực nào đứng trước vị trí này
+    };
+
+    /**
+     * @brief Vị trí của một sinh viên trong các nhóm
+     */
+    struct Slot {
+        int priorityClass = 0; ///< Nhóm ưu tiên
+        std::size_t index = 0; ///< Chỉ số vé trong nhóm
+    };
+
+    std::vector<Lane> _lanes;                           ///< Các nhóm, theo priorityClass
+    std::unordered_map<std::string, Slot> _slots;       ///< Vé còn hiệu lực của từng sinh viên
+    std::string _courseId;                              ///< ID của khóa học
+
+    static void fenwickAdd(Lane& lane, std::size_t index, int delta);
+    static std::size_t fenwickPrefix(const Lane& lane, std::size_t count);
+    static void fenwickAppend(Lane& lane, int value);
+
+    /**
+     * @brief Xây lại nhóm chỉ với các vé còn hiệu lực (đã sắp xếp) và cập nhật _slots
+     */
+    void rebuildLane(int priorityClass, std::vector<Ticket> tickets);
+
+public:
+    /**
+     * @brief Hàm khởi tạo hàng đợi rỗng
+     * @param courseId ID của khóa học
+     */
+    explicit WaitlistQueue(std::string courseId);
+
+    /**
+     * @brief Thêm sinh viên vào hàng đợi
+     * @param entry Vị trí chờ (courseId phải trùng khóa học của hàng đợi, priorityClass >= 0)
+     * @return true nếu đã thêm, false nếu sinh viên đã có trong hàng hoặc entry không hợp lệ
+     */
+    bool push(const WaitlistEntry& entry);
+
+    /**
+     * @brief Xóa sinh viên khỏi hàng đợi
+     * @return true nếu đã xóa, false nếu sinh viên không có trong hàng
+     */
+    bool erase(const std::string& studentId);
+
+    /**
+     * @brief Vị trí chờ của sinh viên (bắt đầu từ 1)
+     * @return Vị trí, hoặc std::nullopt nếu sinh viên không có trong hàng
+     */
+    std::optional<std::size_t> position(const std::string& studentId) const;
+
+    /**
+     * @brief Người đứng đầu hàng đợi
+     * @return Vị trí chờ đầu tiên, hoặc std::nullopt nếu hàng rỗng
+     */
+    std::optional<WaitlistEntry> front();
+
+    /**
+     * @brief Toàn bộ hàng đợi theo thứ tự chờ
+     */
+    std::vector<WaitlistEntry> entries() const;
+
+    /**
+     * @brief Số sinh viên đang chờ
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Hàng đợi rỗng hay không
+     */
+    bool empty() const;
+
+    /**
+     * @brief ID của khóa học
+     */
+    const std::string& getCourseId() const;
+};
+
+#endif // WAITLISTQUEUE_H
@@ -1,7 +1,213 @@
 #include "AdminService.h"
 #include "../../../utils/Logger.h"
 #include "../../../utils/StringUtils.h"
+#include "../../../utils/MappedFile.h"
+#include "../../../utils/CsvTokenizer.h"
+#include "../../../utils/JsonLineParser.h"
+#include "../../../utils/ParallelUtils.h"
+#include "../../validators/impl/StudentValidator.h"
+#include "../../data_access/UnitOfWork.h"
 #include <random>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+    const std::size_t ADMISSION_IMPORT_BATCH_SIZE = 1000;   // Số sinh viên mỗi lô ghi
+    const std::size_t ADMISSION_ROWS_PER_WORKER = 256;      // Số dòng tối thiểu để thêm một luồng kiểm tra
+
+    enum AdmissionField : std::size_t {
+        ADMISSION_EMAIL, ADMISSION_FIRST_NAME, ADMISSION_LAST_NAME, ADMISSION_FACULTY_ID,
+        ADMISSION_BIRTH_DAY, ADMISSION_BIRTH_MONTH, ADMISSION_BIRTH_YEAR, ADMISSION_ADDRESS,
+        ADMISSION_CITIZEN_ID, ADMISSION_PHONE_NUMBER, ADMISSION_PASSWORD, ADMISSION_FIELD_COUNT
+    };
+
+    struct RawAdmissionRow {
+        std::size_t lineNumber = 0;
+        std::array<std::string, ADMISSION_FIELD_COUNT> fields;
+        std::string error; // Lỗi cú pháp của dòng (nếu có)
+    };
+
+    struct CheckedAdmissionRow {
+        std::optional<Student> student; // Có giá trị nếu dòng hợp lệ (ID tạm, được cấp lại ở bước sau)
+        std::string passwordHash;
+        std::string salt;
+        std::string error;
+    };
+
+    std::string currentYearPrefix() {
+        auto now_c = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        std::tm now_tm = {};
+        #if defined(_WIN32) || defined(_WIN64)
+            localtime_s(&now_tm, &now_c);
+        #else
+            localtime_r(&now_c, &now_tm);
+        #endif
+        return std::to_string((now_tm.tm_year + 1900) % 100);
+    }
+
+    std::optional<AdmissionField> admissionFieldOf(std::string_view header) {
+        std::string name;
+        for (char c : header) {
+            if (c != '_' && c != ' ') name.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+        static const std::unordered_map<std::string, AdmissionField> names = {
+            {"email", ADMISSION_EMAIL}, {"firstname", ADMISSION_FIRST_NAME}, {"lastname", ADMISSION_LAST_NAME},
+            {"facultyid", ADMISSION_FACULTY_ID}, {"birthday", ADMISSION_BIRTH_DAY}, {"birthmonth", ADMISSION_BIRTH_MONTH},
+            {"birthyear", ADMISSION_BIRTH_YEAR}, {"address", ADMISSION_ADDRESS}, {"citizenid", ADMISSION_CITIZEN_ID},
+            {"phonenumber", ADMISSION_PHONE_NUMBER}, {"phone", ADMISSION_PHONE_NUMBER},
+            {"password", ADMISSION_PASSWORD}, {"initialpassword", ADMISSION_PASSWORD}
+        };
+        auto it = names.find(name);
+        if (it == names.end()) return std::nullopt;
+        return it->second;
+    }
+
+    bool isJsonLinesFile(const std::string& filePath) {
+        std::string extension = StringUtils::toLower(std::filesystem::path(filePath).extension().string());
+        return extension == ".jsonl" || extension == ".json" || extension == ".ndjson";
+    }
+
+    std::expected<std::vector<RawAdmissionRow>, Error> readAdmissionCsv(std::string_view data) {
+        std::vector<RawAdmissionRow> rows;
+        CsvTokenizer tokenizer(data);
+        std::vector<std::string_view> fields;
+        std::vector<std::optional<AdmissionField>> columns; // Cột CSV -> trường, theo dòng header
+        while (tokenizer.nextRecord(fields)) {
+            if (fields.size() == 1 && CsvTokenizer::trimView(fields[0]).empty()) continue; // Dòng trống
+            if (columns.empty()) {
+                std::array<bool, ADMISSION_FIELD_COUNT> seen{};
+                for (auto header : fields) {
+                    auto field = admissionFieldOf(CsvTokenizer::trimView(header));
+                    if (field.has_value()) seen[*field] = true;
+                    columns.push_back(field);
+                }
+                for (AdmissionField required : {ADMISSION_EMAIL, ADMISSION_FIRST_NAME, ADMISSION_LAST_NAME, ADMISSION_FACULTY_ID,
+                                                ADMISSION_BIRTH_DAY, ADMISSION_BIRTH_MONTH, ADMISSION_BIRTH_YEAR, ADMISSION_CITIZEN_ID}) {
+                    if (!seen[required]) {
+                        return std::unexpected(Error{ErrorCode::FILE_FORMAT_ERROR,
+                            "Admission CSV header must contain email, firstName, lastName, facultyId, birthDay, birthMonth, birthYear and citizenId columns."});
+                    }
+                }
+                continue;
+            }
+            RawAdmissionRow row;
+            row.lineNumber = tokenizer.recordLine();
+            if (tokenizer.isRecordMalformed() || fields.size() != columns.size()) {
+                row.error = "Malformed CSV record (expected " + std::to_string(columns.size()) + " fields).";
+            }
+            for (std::size_t i = 0; i < fields.size() && i < columns.size(); ++i) {
+                if (columns[i].has_value()) row.fields[*columns[i]] = CsvTokenizer::unescapeField(CsvTokenizer::trimView(fields[i]));
+            }
+            rows.push_back(std::move(row));
+        }
+        if (columns.empty()) {
+            return std::unexpected(Error{ErrorCode::FILE_FORMAT_ERROR, "Admission CSV file is empty."});
+        }
+        return rows;
+    }
+
+    std::expected<std::vector<RawAdmissionRow>, Error> readAdmissionJsonLines(std::string_view data) {
+        std::vector<RawAdmissionRow> rows;
+        std::size_t lineNumber = 0;
+        std::size_t pos = 0;
+        if (data.starts_with("\xEF\xBB\xBF")) pos = 3; // BOM UTF-8
+        while (pos < data.size()) {
+            std::size_t end = data.find('\n', pos);
+            if (end == std::string_view::npos) end = data.size();
+            std::string_view line = CsvTokenizer::trimView(data.substr(pos, end - pos));
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            pos = end + 1;
+            ++lineNumber;
+            if (line.empty()) continue;
+
+            RawAdmissionRow row;
+            row.lineNumber = lineNumber;
+            auto object = JsonLineParser::parseObject(line);
+            if (!object.has_value()) {
+                row.error = object.error().message;
+            } else {
+                for (auto& [key, value] : object.value()) {
+                    auto field = admissionFieldOf(key);
+                    if (field.has_value()) row.fields[*field] = StringUtils::trim(value);
+                }
+            }
+            rows.push_back(std::move(row));
+        }
+        return rows;
+    }
+
+    CheckedAdmissionRow checkAdmissionRow(const RawAdmissionRow& row, const std::string& yearPrefix, const std::string& defaultPassword,
+                                          const StudentValidator& studentValidator, const IGeneralInputValidator& inputValidator,
+                                          const std::unordered_set<std::string>& facultyIds) {
+        CheckedAdmissionRow checked;
+        if (!row.error.empty()) {
+            checked.error = row.error;
+            return checked;
+        }
+        const auto& fields = row.fields;
+        int birthDate[3] = {0, 0, 0};
+        for (int i = 0; i < 3; ++i) {
+            const std::string& text = fields[ADMISSION_BIRTH_DAY + i];
+            auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), birthDate[i]);
+            if (text.empty() || ec != std::errc() || end != text.data() + text.size()) {
+                checked.error = "Birth day, month and year must be numbers.";
+                return checked;
+            }
+        }
+
+        // ID tạm có cùng dạng với ID thật để StudentValidator kiểm tra; ID thật được cấp sau khi loại trùng
+        Student student(yearPrefix + fields[ADMISSION_FACULTY_ID] + "0000", fields[ADMISSION_FIRST_NAME], fields[ADMISSION_LAST_NAME],
+                        fields[ADMISSION_FACULTY_ID], LoginStatus::ACTIVE);
+        if (!student.setBirthday(birthDate[0], birthDate[1], birthDate[2])) {
+            checked.error = "Invalid birth date " + fields[ADMISSION_BIRTH_DAY] + "/" + fields[ADMISSION_BIRTH_MONTH] + "/" + fields[ADMISSION_BIRTH_YEAR] + ".";
+            return checked;
+        }
+        student.setAddress(fields[ADMISSION_ADDRESS]);
+        student.setCitizenId(fields[ADMISSION_CITIZEN_ID]);
+        student.setEmail(fields[ADMISSION_EMAIL]);
+        student.setPhoneNumber(fields[ADMISSION_PHONE_NUMBER]);
+        student.setRole(UserRole::STUDENT);
+
+        ValidationResult vr = studentValidator.validateEntity(student);
+        if (!fields[ADMISSION_FACULTY_ID].empty() && !facultyIds.contains(fields[ADMISSION_FACULTY_ID])) {
+            vr.addError(ErrorCode::NOT_FOUND, "Faculty ID '" + fields[ADMISSION_FACULTY_ID] + "' not found.");
+        }
+        const bool usesDefaultPassword = fields[ADMISSION_PASSWORD].empty();
+        const std::string& password = usesDefaultPassword ? defaultPassword : fields[ADMISSION_PASSWORD];
+        if (password.empty()) {
+            vr.addError(ErrorCode::VALIDATION_ERROR, "Password is required (no default password given).");
+        } else if (!usesDefaultPassword) { // Mật khẩu mặc định đã được kiểm tra một lần
+            for (const auto& err : inputValidator.validatePasswordComplexity(password).errors) vr.addError(err);
+        }
+        if (!vr.isValid) {
+            checked.error = vr.getErrorMessagesCombined("; ");
+            return checked;
+        }
+
+        checked.salt = PasswordUtils::generateSalt();
+        checked.passwordHash = PasswordUtils::hashPassword(password, checked.salt);
+        checked.student = std::move(student);
+        return checked;
+    }
+
+    Student withStudentId(const Student& source, const std::string& studentId) {
+        Student student(studentId, source.getFirstName(), source.getLastName(), source.getFacultyId(), source.getStatus());
+        student.setBirthday(source.getBirthday());
+        student.setAddress(source.getAddress());
+        student.setCitizenId(source.getCitizenId());
+        student.setEmail(source.getEmail());
+        student.setPhoneNumber(source.getPhoneNumber());
+        student.setRole(source.getRole());
+        return student;
+    }
+}
 
 /**
  * @brief Khởi tạo đối tượng AdminService
@@ -15,6 +221,7 @@
  * @param courseResultDao Đối tượng truy cập dữ liệu kết quả học tập
  * @param inputValidator Đối tượng kiểm tra đầu vào
  * @param sessionContext Đối tượng quản lý phiên đăng nhập
+ * @param reportService Dịch vụ báo cáo tài chính cần làm mới sau khi ghi học phí/lương
  * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
  */
 AdminService::AdminService(
@@ -27,7 +234,10 @@ AdminService::AdminService(
     std::shared_ptr<IEnrollmentDao> enrollmentDao,
     std::shared_ptr<ICourseResultDao> courseResultDao,
     std::shared_ptr<IGeneralInputValidator> inputValidator,
-    std::shared_ptr<SessionContext> sessionContext)
+    std::shared_ptr<SessionContext> sessionContext,
+    std::shared_ptr<IIdSequenceService> idSequenceService,
+    std::shared_ptr<ITransactionManager> transactionManager,
+    std::shared_ptr<IFinanceReportService> reportService)
     : _studentDao(std::move(studentDao)),
       _teacherDao(std::move(teacherDao)),
       _facultyDao(std::move(facultyDao)),
@@ -37,11 +247,15 @@ AdminService::AdminService(
       _enrollmentDao(std::move(enrollmentDao)),
       _courseResultDao(std::move(courseResultDao)),
       _inputValidator(std::move(inputValidator)),
-      _sessionContext(std::move(sessionContext)) {
+      _sessionContext(std::move(sessionContext)),
+      _idSequenceService(std::move(idSequenceService)),
+      _transactionManager(std::move(transactionManager)),
+      _reportService(std::move(reportService)) {
     // Kiểm tra null cho tất cả dependencies
     if (!_studentDao || !_teacherDao || !_loginDao || !_feeDao || !_salaryDao || 
-        !_enrollmentDao || !_courseResultDao || !_inputValidator || !_sessionContext) {
-        throw std::invalid_argument("One or more DAO/Validator/SessionContext is null for AdminService.");
+        !_enrollmentDao || !_courseResultDao || !_inputValidator || !_sessionContext || !_idSequenceService ||
+        !_transactionManager || !_reportService) {
+        throw std::invalid_argument("One or more DAO/Validator/SessionContext/IdSequenceService/TransactionManager/FinanceReportService is null for AdminService.");
     }
 }
 
@@ -101,13 +315,13 @@ std::expected<bool, Error> AdminService::approveStudentRegistration(const std::s
             updateStatusRoleRes.error());
     }
     
-    // Tạo FeeRecord ban đầu cho sinh viên (ví dụ học phí cố định hoặc 0)
-    // Điều này nên được cấu hình hoặc nhập liệu
-    long initialFee = 5000000; // Ví dụ
-    auto feeRecordResult = _feeDao->add(FeeRecord(studentIdToApprove, initialFee, 0));
+    // Tạo FeeRecord rỗng; tổng học phí được tính theo tín chỉ đã đăng ký bởi TuitionService::recomputeTuition
+    auto feeRecordResult = _feeDao->add(FeeRecord(studentIdToApprove, 0, 0));
     if (!feeRecordResult.has_value()) {
         LOG_WARN("Student " + studentIdToApprove + " approved, but failed to create initial fee record: " + feeRecordResult.error().message);
         // Không coi đây là lỗi chặn việc approve, nhưng cần log lại. Admin có thể tạo sau.
+    } else {
+        _reportService->invalidate();
     }
 
 
@@ -171,50 +385,14 @@ std::expected<Student, Error> AdminService::addStudentByAdmin(const NewStudentDa
     if (studentByEmail.has_value()) return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Email already registered."});
     if (studentByEmail.error().code != ErrorCode::NOT_FOUND) return std::unexpected(studentByEmail.error());
 
-    std::string studentId;
-    // Lấy năm hiện tại
-    auto nowChrono = std::chrono::system_clock::now(); // Đổi tên biến để tránh trùng
-    auto now_c = std::chrono::system_clock::to_time_t(nowChrono);
-    std::tm now_tm = {};
-    #if defined(_WIN32) || defined(_WIN64)
-        localtime_s(&now_tm, &now_c);
-    #else
-        localtime_r(&now_c, &now_tm);
-    #endif
-    std::string yearPrefix = std::to_string((now_tm.tm_year + 1900) % 100);
-
     auto facultyDetails = _facultyDao->getById(data.studentInfo.facultyId);
     if (!facultyDetails.has_value()) { /* Đã check ở trên, nhưng để an toàn */
         return std::unexpected(Error{ErrorCode::NOT_FOUND, "Faculty details not found for ID: " + data.studentInfo.facultyId});
     }
 
-    std::string idPrefix = yearPrefix + data.studentInfo.facultyId; 
-    bool idOk = false;
-    int maxRetriesForIdGeneration = 1000; // Tăng số lần thử để tìm số thứ tự
-    for (int sequence = 1; sequence <= 9999; ++sequence) {
-        std::ostringstream oss;
-        oss << idPrefix << std::setfill('0') << std::setw(4) << sequence;
-        studentId = oss.str();
-        // Kiểm tra xem studentId đã tồn tại trong bảng Users hay chưa
-        auto userExists = _loginDao->findCredentialsByUserId(studentId); 
-        if (!userExists.has_value()) {
-            if (userExists.error().code == ErrorCode::NOT_FOUND) {
-                idOk = true; 
-                break;
-            } else {
-                LOG_ERROR("Error checking student ID existence: " + userExists.error().message);
-                return std::unexpected(userExists.error()); // Lỗi DB
-            }
-        }
-        if (sequence >= maxRetriesForIdGeneration && !idOk) { // Giới hạn số lần thử
-             LOG_WARN("Student ID generation: Max retries reached for prefix " + idPrefix);
-             break; // Dừng nếu thử quá nhiều
-        }
-    }
-
-    if (!idOk) {
-        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Could not generate unique student ID for prefix " + idPrefix + ". Sequence may be exhausted or DB error occurred."});
-    }
+    auto nextId = _idSequenceService->nextStudentId(_idSequenceService->studentIdPrefix(data.studentInfo.facultyId));
+    if (!nextId.has_value()) return std::unexpected(nextId.error());
+    const std::string& studentId = nextId.value();
     Student newStudent(studentId, studentInfo.firstName, studentInfo.lastName, studentInfo.facultyId, LoginStatus::ACTIVE); // ACTIVE ngay
     newStudent.setBirthday(studentInfo.birthDay, studentInfo.birthMonth, studentInfo.birthYear);
     newStudent.setAddress(studentInfo.address);
@@ -223,29 +401,242 @@ std::expected<Student, Error> AdminService::addStudentByAdmin(const NewStudentDa
     newStudent.setPhoneNumber(studentInfo.phoneNumber);
     newStudent.setRole(UserRole::STUDENT); // Role STUDENT ngay
 
+    std::string salt = PasswordUtils::generateSalt();
+    std::string hashedPassword = PasswordUtils::hashPassword(data.initialPassword, salt);
+
+    // Users/Students, Logins và FeeRecords trong một transaction; transaction riêng của từng DAO trở thành savepoint
+    auto unitOfWork = UnitOfWork::begin(_transactionManager);
+    if (!unitOfWork.has_value()) return std::unexpected(unitOfWork.error());
+
     auto addStudentResult = _studentDao->add(newStudent);
     if (!addStudentResult.has_value()) return std::unexpected(addStudentResult.error());
+    unitOfWork->addCompensation([this, studentId]() { _studentDao->remove(studentId); });
 
-    std::string salt = PasswordUtils::generateSalt();
-    std::string hashedPassword = PasswordUtils::hashPassword(data.initialPassword, salt);
     auto addCredsResult = _loginDao->addUserCredentials(studentId, hashedPassword, salt, UserRole::STUDENT, LoginStatus::ACTIVE);
     if (!addCredsResult.has_value() || !addCredsResult.value()) {
-        _studentDao->remove(studentId); // Rollback
         return std::unexpected(addCredsResult.has_value() ? Error{ErrorCode::OPERATION_FAILED, "Failed to set credentials."} : addCredsResult.error());
     }
 
-    // Tạo FeeRecord ban đầu
-    long initialFee = 5000000; // Ví dụ
-    auto feeRecordResult = _feeDao->add(FeeRecord(studentId, initialFee, 0));
+    // Tạo FeeRecord rỗng; tổng học phí được tính theo tín chỉ đã đăng ký bởi TuitionService::recomputeTuition
+    auto feeRecordResult = _feeDao->add(FeeRecord(studentId, 0, 0));
      if (!feeRecordResult.has_value()) {
         LOG_WARN("Student " + studentId + " added by admin, but failed to create initial fee record: " + feeRecordResult.error().message);
-        // Không rollback student, admin có thể tạo fee sau
+        // Không rollback student, admin có thể tạo fee sau (savepoint của FeeRecordDao đã hủy phần ghi dở)
     }
 
+    auto committed = unitOfWork->commit();
+    if (!committed.has_value()) return std::unexpected(committed.error());
+    _reportService->invalidate();
+
     LOG_INFO("Student " + studentId + " added by admin successfully.");
     return addStudentResult.value();
 }
 
+/**
+ * @brief Nhập hàng loạt hồ sơ tuyển sinh từ file CSV hoặc JSON Lines
+ * 
+ * Quy trình gồm bốn bước:
+ * 1. Đọc file (ánh xạ bộ nhớ) và tách thành các dòng thô
+ * 2. Kiểm tra song song từng dòng: StudentValidator, khoa tồn tại, độ phức tạp mật khẩu và băm mật khẩu
+ * 3. Loại trùng email/CCCD trong toàn file và với người dùng hiện có (một lần duyệt DAO),
+ *    cấp ID theo khối: mỗi tiền tố năm + khoa giữ chỗ một khoảng số thứ tự bằng một lần tăng bộ đếm
+ * 4. Ghi theo lô: Users/Students, Logins rồi FeeRecords của mỗi lô trong một UnitOfWork; nếu Logins
+ *    thất bại thì cả lô được rollback (giống addStudentByAdmin)
+ * Yêu cầu quyền truy cập: chỉ admin.
+ * 
+ * @param filePath Đường dẫn file
+ * @param defaultPassword Mật khẩu ban đầu cho các dòng không có cột password
+ * @return std::expected<AdmissionImportReport, Error> Báo cáo nhập, hoặc lỗi nếu không thể nhập
+ */
+std::expected<AdmissionImportReport, Error> AdminService::importStudentAdmissions(const std::string& filePath, const std::string& defaultPassword) {
+    if (!isAdminAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can import student admissions."});
+    }
+    if (!defaultPassword.empty()) {
+        ValidationResult passwordVr = _inputValidator->validatePasswordComplexity(defaultPassword);
+        if (!passwordVr.isValid) return std::unexpected(passwordVr.errors[0]);
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+    auto mapped = MappedFile::open(filePath);
+    if (!mapped.has_value()) return std::unexpected(mapped.error());
+
+    // --- 1. Tách bản ghi ---
+    auto rowsResult = isJsonLinesFile(filePath) ? readAdmissionJsonLines(mapped->view()) : readAdmissionCsv(mapped->view());
+    if (!rowsResult.has_value()) return std::unexpected(rowsResult.error());
+    std::vector<RawAdmissionRow>& rows = rowsResult.value();
+
+    AdmissionImportReport report;
+    report.totalRows = rows.size();
+
+    // Dữ liệu tra cứu chỉ đọc cho các luồng kiểm tra: danh sách khoa được lấy một lần
+    std::unordered_set<std::string> facultyIds;
+    if (_facultyDao) {
+        auto faculties = _facultyDao->getAll();
+        if (!faculties.has_value()) return std::unexpected(faculties.error());
+        for (const auto& faculty : faculties.value()) facultyIds.insert(faculty.getId());
+    }
+    const std::string yearPrefix = currentYearPrefix();
+
+    // --- 2. Kiểm tra song song: mỗi luồng ghi vào một đoạn riêng của 'checked', không cần khóa ---
+    std::vector<CheckedAdmissionRow> checked(rows.size());
+    const StudentValidator studentValidator(_inputValidator);
+    const IGeneralInputValidator& inputValidator = *_inputValidator;
+    auto checkRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            checked[i] = checkAdmissionRow(rows[i], yearPrefix, defaultPassword, studentValidator, inputValidator, facultyIds);
+        }
+    };
+    ParallelUtils::parallelForChunks(rows.size(), ADMISSION_ROWS_PER_WORKER, checkRange);
+
+    // --- 3. Loại trùng lặp và cấp ID theo khối ---
+    // Email và CCCD đã dùng được lấy bằng một lần duyệt sinh viên và giảng viên
+    std::unordered_map<std::string, std::size_t> lineOfEmail;     // Email (chữ thường) -> dòng đầu tiên, 0 nếu đã có trong hệ thống
+    std::unordered_map<std::string, std::size_t> lineOfCitizenId; // CCCD -> dòng đầu tiên, 0 nếu đã có trong hệ thống
+    auto collectUser = [&](const User& user) {
+        if (!user.getEmail().empty()) lineOfEmail.emplace(StringUtils::toLower(user.getEmail()), 0);
+        if (!user.getCitizenId().empty()) lineOfCitizenId.emplace(user.getCitizenId(), 0);
+        return true;
+    };
+    auto studentScan = _studentDao->forEach([&](const Student& student) { return collectUser(student); });
+    if (!studentScan.has_value()) return std::unexpected(studentScan.error());
+    auto teacherScan = _teacherDao->forEach([&](const Teacher& teacher) { return collectUser(teacher); });
+    if (!teacherScan.has_value()) return std::unexpected(teacherScan.error());
+
+    struct PendingAdmission {
+        std::size_t lineNumber;
+        Student student;
+        LoginCredentials credentials;
+    };
+    std::vector<PendingAdmission> pending;
+    pending.reserve(rows.size());
+    std::vector<std::size_t> accepted; // Chỉ số các dòng hợp lệ, không trùng lặp, theo thứ tự trong file
+    accepted.reserve(rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        std::string email = rows[i].fields[ADMISSION_EMAIL];
+        if (!checked[i].student.has_value()) {
+            report.lineErrors.push_back({rows[i].lineNumber, std::move(email), std::move(checked[i].error)});
+            continue;
+        }
+        const Student& candidate = checked[i].student.value();
+        auto [emailIt, emailNew] = lineOfEmail.emplace(StringUtils::toLower(candidate.getEmail()), rows[i].lineNumber);
+        if (!emailNew) {
+            report.lineErrors.push_back({rows[i].lineNumber, candidate.getEmail(), emailIt->second == 0
+                ? "Email already registered."
+                : "Duplicate email; already listed on line " + std::to_string(emailIt->second) + "."});
+            continue;
+        }
+        auto [citizenIt, citizenNew] = lineOfCitizenId.emplace(candidate.getCitizenId(), rows[i].lineNumber);
+        if (!citizenNew) {
+            lineOfEmail.erase(emailIt); // Dòng bị loại không giữ chỗ email
+            report.lineErrors.push_back({rows[i].lineNumber, candidate.getEmail(), citizenIt->second == 0
+                ? "Citizen ID already registered."
+                : "Duplicate citizen ID; already listed on line " + std::to_string(citizenIt->second) + "."});
+            continue;
+        }
+
+        accepted.push_back(i);
+    }
+
+    // Mỗi tiền tố chỉ tăng bộ đếm một lần cho toàn bộ các dòng hợp lệ của nó
+    std::map<std::string, std::vector<std::size_t>> acceptedOfPrefix;
+    for (std::size_t i : accepted) {
+        acceptedOfPrefix[_idSequenceService->studentIdPrefix(checked[i].student->getFacultyId())].push_back(i);
+    }
+    std::vector<std::optional<std::string>> assignedIds(rows.size());
+    for (const auto& [idPrefix, indices] : acceptedOfPrefix) {
+        auto block = _idSequenceService->reserveStudentIds(idPrefix, indices.size());
+        if (!block.has_value()) {
+            for (std::size_t i : indices) {
+                report.lineErrors.push_back({rows[i].lineNumber, checked[i].student->getEmail(), block.error().message});
+            }
+            continue;
+        }
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            if (k < block->size()) {
+                assignedIds[indices[k]] = block->idAt(k);
+            } else {
+                report.lineErrors.push_back({rows[indices[k]].lineNumber, checked[indices[k]].student->getEmail(),
+                                             "Student ID sequence exhausted for prefix " + idPrefix + "."});
+            }
+        }
+    }
+
+    for (std::size_t i : accepted) {
+        if (!assignedIds[i].has_value()) continue;
+        const std::string& studentId = assignedIds[i].value();
+        pending.push_back({rows[i].lineNumber, withStudentId(checked[i].student.value(), studentId),
+                           LoginCredentials{studentId, std::move(checked[i].passwordHash), std::move(checked[i].salt), UserRole::STUDENT, LoginStatus::ACTIVE}});
+    }
+
+    // --- 4. Ghi theo lô ---
+    for (std::size_t begin = 0; begin < pending.size(); begin += ADMISSION_IMPORT_BATCH_SIZE) {
+        std::size_t count = std::min(ADMISSION_IMPORT_BATCH_SIZE, pending.size() - begin);
+        std::vector<Student> students;
+        std::vector<LoginCredentials> credentials;
+        std::vector<FeeRecord> feeRecords;
+        students.reserve(count);
+        credentials.reserve(count);
+        feeRecords.reserve(count);
+        for (std::size_t i = begin; i < begin + count; ++i) {
+            students.push_back(pending[i].student);
+            credentials.push_back(pending[i].credentials);
+            feeRecords.emplace_back(pending[i].student.getId(), 0, 0); // Học phí tính sau theo tín chỉ
+        }
+        auto rejectBatch = [&](const std::string& reason) {
+            for (std::size_t i = begin; i < begin + count; ++i) {
+                report.lineErrors.push_back({pending[i].lineNumber, pending[i].student.getEmail(), "Batch not saved: " + reason});
+            }
+        };
+
+        auto unitOfWork = UnitOfWork::begin(_transactionManager);
+        if (!unitOfWork.has_value()) {
+            rejectBatch(unitOfWork.error().message);
+            continue;
+        }
+        auto addStudents = _studentDao->addBatch(students);
+        if (!addStudents.has_value()) {
+            rejectBatch(addStudents.error().message);
+            continue;
+        }
+        unitOfWork->addCompensation([this, &students]() {
+            for (const auto& student : students) _studentDao->remove(student.getId());
+        });
+        auto addCredentials = _loginDao->addUserCredentialsBatch(credentials);
+        if (!addCredentials.has_value()) {
+            unitOfWork->rollback();
+            rejectBatch(addCredentials.error().message);
+            continue;
+        }
+        auto addFees = _feeDao->addBatch(feeRecords);
+        if (!addFees.has_value()) {
+            // Giống addStudentByAdmin: không rollback sinh viên, admin có thể tạo học phí sau
+            LOG_WARN("Admission import: " + std::to_string(count) + " students added, but failed to create initial fee records: " + addFees.error().message);
+        }
+        auto committed = unitOfWork->commit();
+        if (!committed.has_value()) {
+            rejectBatch(committed.error().message);
+            continue;
+        }
+        report.batchCount++;
+        for (std::size_t i = begin; i < begin + count; ++i) {
+            report.admitted.push_back({pending[i].lineNumber, pending[i].student.getId(), pending[i].student.getEmail()});
+        }
+    }
+
+    if (!report.admitted.empty()) _reportService->invalidate();
+
+    std::sort(report.lineErrors.begin(), report.lineErrors.end(),
+              [](const AdmissionImportLineError& a, const AdmissionImportLineError& b) { return a.lineNumber < b.lineNumber; });
+    report.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    LOG_INFO("Imported admissions '" + filePath + "': " + std::to_string(report.admitted.size()) + "/" +
+             std::to_string(report.totalRows) + " students admitted in " + std::to_string(report.batchCount) + " batches, " +
+             std::to_string(static_cast<long long>(report.rowsPerSecond())) + " rows/s, " +
+             std::to_string(report.lineErrors.size()) + " line errors.");
+    return report;
+}
+
 /**
  * @brief Xóa tài khoản sinh viên
  * 
@@ -267,6 +658,7 @@ std::expected<bool, Error> AdminService::removeStudentAccount(const std::string&
     // Nên chỉ cần gọi _studentDao->remove(studentId)
     auto removeResult = _studentDao->remove(studentId);
     if (removeResult.has_value() && removeResult.value()) {
+        _reportService->invalidate();
         LOG_INFO("Student account removed: " + studentId);
     }
     return removeResult;
@@ -329,14 +721,18 @@ std::expected<Teacher, Error> AdminService::addTeacherByAdmin(const NewTeacherDa
     newTeacher.setExperienceYears(data.experienceYears);
     newTeacher.setRole(UserRole::TEACHER);
 
+    std::string salt = PasswordUtils::generateSalt();
+    std::string hashedPassword = PasswordUtils::hashPassword(data.initialPassword, salt);
+
+    auto unitOfWork = UnitOfWork::begin(_transactionManager);
+    if (!unitOfWork.has_value()) return std::unexpected(unitOfWork.error());
+
     auto addTeacherResult = _teacherDao->add(newTeacher); // Sẽ thêm vào Users và Teachers
     if (!addTeacherResult.has_value()) return std::unexpected(addTeacherResult.error());
+    unitOfWork->addCompensation([this, teacherId = data.id]() { _teacherDao->remove(teacherId); });
 
-    std::string salt = PasswordUtils::generateSalt();
-    std::string hashedPassword = PasswordUtils::hashPassword(data.initialPassword, salt);
     auto addCredsResult = _loginDao->addUserCredentials(data.id, hashedPassword, salt, UserRole::TEACHER, LoginStatus::ACTIVE);
     if (!addCredsResult.has_value() || !addCredsResult.value()) {
-        _teacherDao->remove(data.id); // Rollback
         return std::unexpected(addCredsResult.has_value() ? Error{ErrorCode::OPERATION_FAILED, "Failed to set credentials for teacher."} : addCredsResult.error());
     }
     
@@ -347,6 +743,9 @@ std::expected<Teacher, Error> AdminService::addTeacherByAdmin(const NewTeacherDa
         LOG_WARN("Teacher " + data.id + " added by admin, but failed to create initial salary record: " + salaryRecordResult.error().message);
     }
 
+    auto committed = unitOfWork->commit();
+    if (!committed.has_value()) return std::unexpected(committed.error());
+    _reportService->invalidate();
 
     LOG_INFO("Teacher " + data.id + " added by admin successfully.");
     return addTeacherResult.value();
@@ -372,6 +771,7 @@ std::expected<bool, Error> AdminService::removeTeacherAccount(const std::string&
     // DAO Teacher::remove sẽ xóa User, và DB schema sẽ cascade xóa Teachers, Logins, SalaryRecords
     auto removeResult = _teacherDao->remove(teacherId);
      if (removeResult.has_value() && removeResult.value()) {
+        _reportService->invalidate();
         LOG_INFO("Teacher account removed: " + teacherId);
     }
     return removeResult;
@@ -17,7 +17,10 @@
 #include "../../data_access/interface/ISalaryRecordDao.h"   // Để xóa khi remove teacher
 #include "../../data_access/interface/IEnrollmentDao.h"   // Để xóa khi remove student
 #include "../../data_access/interface/ICourseResultDao.h" // Để xóa khi remove student
+#include "../../data_access/interface/ITransactionManager.h"
 #include "../../validators/interface/IValidator.h"
+#include "../interface/IIdSequenceService.h"
+#include "../interface/IFinanceReportService.h"
 #include "../SessionContext.h"
 #include "../../../utils/PasswordInput.h" // Để hash password mới
 
@@ -40,6 +43,9 @@ private:
     std::shared_ptr<ICourseResultDao> _courseResultDao; ///< Đối tượng dao để truy cập dữ liệu kết quả khóa học
     std::shared_ptr<IGeneralInputValidator> _inputValidator; ///< Đối tượng validator để kiểm tra đầu vào
     std::shared_ptr<SessionContext> _sessionContext;  ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<IIdSequenceService> _idSequenceService; ///< Dịch vụ cấp phát mã sinh viên
+    std::shared_ptr<ITransactionManager> _transactionManager; ///< Gom các lần ghi của nhiều DAO vào một transaction
+    std::shared_ptr<IFinanceReportService> _reportService; ///< Báo cáo tổng hợp cần làm mới sau khi ghi học phí/lương
     // Có thể inject IAuthService để dùng lại logic register (tạo User + Login)
     // std::shared_ptr<IAuthService> _authServiceForRegistration;
 
@@ -55,6 +61,9 @@ public:
      * @param courseResultDao Đối tượng dao để truy cập dữ liệu kết quả khóa học
      * @param inputValidator Đối tượng validator để kiểm tra đầu vào
      * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param idSequenceService Dịch vụ cấp phát mã sinh viên
+     * @param transactionManager Bộ quản lý transaction của nguồn dữ liệu
+     * @param reportService Dịch vụ báo cáo tài chính (được invalidate sau khi thêm/xóa sinh viên, giảng viên)
      */
     AdminService(std::shared_ptr<IStudentDao> studentDao,
                  std::shared_ptr<ITeacherDao> teacherDao,
@@ -65,7 +74,10 @@ public:
                  std::shared_ptr<IEnrollmentDao> enrollmentDao,
                  std::shared_ptr<ICourseResultDao> courseResultDao,
                  std::shared_ptr<IGeneralInputValidator> inputValidator,
-                 std::shared_ptr<SessionContext> sessionContext);
+                 std::shared_ptr<SessionContext> sessionContext,
+                 std::shared_ptr<IIdSequenceService> idSequenceService,
+                 std::shared_ptr<ITransactionManager> transactionManager,
+                 std::shared_ptr<IFinanceReportService> reportService);
     
     /**
      * @brief Hàm hủy ảo mặc định
@@ -90,6 +102,18 @@ public:
      * @return Đối tượng Student mới nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<Student, Error> addStudentByAdmin(const NewStudentDataByAdmin& data) override;
+
+    /**
+     * @brief Nhập hàng loạt hồ sơ tuyển sinh từ file CSV hoặc JSON Lines
+     *
+     * Các dòng được kiểm tra song song (StudentValidator, độ phức tạp mật khẩu, khoa tồn tại,
+     * băm mật khẩu), sau đó loại trùng email/CCCD trong bộ nhớ, cấp ID theo khối cho từng
+     * tiền tố năm + khoa và ghi Users/Students, Logins, FeeRecords theo lô.
+     * @param filePath Đường dẫn file
+     * @param defaultPassword Mật khẩu ban đầu cho các dòng không có cột password
+     * @return Báo cáo nhập, hoặc Error nếu không có quyền/không đọc được file
+     */
+    std::expected<AdmissionImportReport, Error> importStudentAdmissions(const std::string& filePath, const std::string& defaultPassword) override;
     
     /**
      * @brief Xóa tài khoản sinh viên
@@ -0,0 +1,108 @@
+#include "ArchiveService.h"
+#include "../../../common/GradeScale.h"
+#include "../../../utils/Logger.h"
+#include "../../../utils/DateUtils.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+
+ArchiveService::ArchiveService(std::shared_ptr<IStudentArchiveDao> archiveDao,
+                               std::shared_ptr<IGraduationAuditService> graduationAuditService,
+                               std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                               std::shared_ptr<ICourseResultDao> courseResultDao,
+                               std::shared_ptr<SessionContext> sessionContext)
+    : _archiveDao(std::move(archiveDao)),
+      _graduationAuditService(std::move(graduationAuditService)),
+      _enrollmentDao(std::move(enrollmentDao)),
+      _courseResultDao(std::move(courseResultDao)),
+      _sessionContext(std::move(sessionContext)) {
+    if (!_archiveDao) throw std::invalid_argument("StudentArchiveDao cannot be null for ArchiveService.");
+    if (!_graduationAuditService) throw std::invalid_argument("GraduationAuditService cannot be null for ArchiveService.");
+    if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null for ArchiveService.");
+    if (!_courseResultDao) throw std::invalid_argument("CourseResultDao cannot be null for ArchiveService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for ArchiveService.");
+}
+
+std::expected<bool, Error> ArchiveService::requireAdmin(const std::string& action) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can " + action + "."});
+    }
+    return true;
+}
+
+std::expected<std::vector<std::string>, Error> ArchiveService::findGraduates() const {
+    auto audit = _graduationAuditService->runGraduationAudit();
+    if (!audit.has_value()) return std::unexpected(audit.error());
+
+    std::vector<std::string> graduates;
+    for (const auto& entry : audit->entries) {
+        if (!entry.eligible) continue;
+        // Sinh viên còn môn đang học (đã đăng ký nhưng chưa có điểm) chưa được lưu trữ
+        auto courseIds = _enrollmentDao->findCourseIdsByStudentId(entry.studentId);
+        if (!courseIds.has_value()) return std::unexpected(courseIds.error());
+        auto results = _courseResultDao->findByStudentId(entry.studentId);
+        if (!results.has_value()) return std::unexpected(results.error());
+        std::unordered_set<std::string> graded;
+        for (const auto& result : results.value()) {
+            if (result.getMarks() != GradeScale::UNGRADED_MARKS) graded.insert(result.getCourseId());
+        }
+        bool settled = std::all_of(courseIds->begin(), courseIds->end(),
+                                   [&graded](const std::string& courseId) { return graded.contains(courseId); });
+        if (settled) graduates.push_back(entry.studentId);
+    }
+    return graduates;
+}
+
+std::expected<ArchiveRunReport, Error> ArchiveService::runArchival(const ArchivePolicy& policy) {
+    auto allowed = requireAdmin("archive students");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    if (policy.disabledDays < 0 || policy.batchSize == 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Archive policy requires non-negative disabled days and a positive batch size."});
+    }
+    if (!_archiveDao->isAvailable()) {
+        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "No archive database is configured."});
+    }
+
+    ArchiveRunReport report;
+    // Sinh viên đã chuyển không còn trong dữ liệu chính, nên mỗi lần truy vấn trả về nhóm kế tiếp
+    const std::string cutoff = DateUtils::isoDateDaysAgo(policy.disabledDays);
+    while (true) {
+        auto batch = _archiveDao->findDisabledStudentIds(cutoff, policy.batchSize);
+        if (!batch.has_value()) return std::unexpected(batch.error());
+        if (batch->empty()) break;
+        auto archived = _archiveDao->archiveStudents(batch.value());
+        if (!archived.has_value()) return std::unexpected(archived.error());
+        ++report.batches;
+        report.disabledArchived += archived.value();
+        if (archived.value() == 0 || batch->size() < policy.batchSize) break;
+    }
+
+    if (policy.includeGraduates) {
+        auto graduates = findGraduates();
+        if (!graduates.has_value()) return std::unexpected(graduates.error());
+        for (std::size_t begin = 0; begin < graduates->size(); begin += policy.batchSize) {
+            const std::size_t end = std::min(graduates->size(), begin + policy.batchSize);
+            std::vector<std::string> batch(graduates->begin() + static_cast<std::ptrdiff_t>(begin),
+                                           graduates->begin() + static_cast<std::ptrdiff_t>(end));
+            auto archived = _archiveDao->archiveStudents(batch);
+            if (!archived.has_value()) return std::unexpected(archived.error());
+            ++report.batches;
+            report.graduatesArchived += archived.value();
+        }
+    }
+
+    LOG_INFO("Archived " + std::to_string(report.disabledArchived) + " disabled and " + std::to_string(report.graduatesArchived) +
+             " graduated students in " + std::to_string(report.batches) + " batches.");
+    return report;
+}
+
+std::expected<bool, Error> ArchiveService::isStudentArchived(const std::string& studentId) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    return _archiveDao->isArchived(studentId);
+}
@@ -0,0 +1,64 @@
+/**
+ * @file ArchiveService.h
+ * @brief Triển khai dịch vụ lưu trữ sinh viên không còn hoạt động
+ */
+#ifndef ARCHIVESERVICE_H
+#define ARCHIVESERVICE_H
+
+#include <memory>
+#include <vector>
+#include "../interface/IArchiveService.h"
+#include "../interface/IGraduationAuditService.h"
+#include "../../data_access/interface/IStudentArchiveDao.h"
+#include "../../data_access/interface/IEnrollmentDao.h"
+#include "../../data_access/interface/ICourseResultDao.h"
+#include "../SessionContext.h"
+
+/**
+ * @class ArchiveService
+ * @brief Lớp triển khai dịch vụ lưu trữ sinh viên
+ *
+ * Mỗi nhóm tối đa ArchivePolicy::batchSize sinh viên được chuyển trong một transaction riêng, nên
+ * khóa ghi chỉ giữ trong thời gian ngắn và một lần chạy bị gián đoạn có thể tiếp tục ở lần sau.
+ */
+class ArchiveService : public IArchiveService {
+private:
+    std::shared_ptr<IStudentArchiveDao> _archiveDao;                    ///< Đối tượng dao cho kho lưu trữ
+    std::shared_ptr<IGraduationAuditService> _graduationAuditService; ///< Dịch vụ xét tốt nghiệp để tìm sinh viên đã tốt nghiệp
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;                     ///< Đối tượng dao cho đăng ký
+    std::shared_ptr<ICourseResultDao> _courseResultDao;                 ///< Đối tượng dao cho kết quả học tập
+    std::shared_ptr<SessionContext> _sessionContext;                    ///< Đối tượng quản lý phiên làm việc
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin(const std::string& action) const;
+
+    /**
+     * @brief Sinh viên đủ điều kiện tốt nghiệp và mọi môn đã đăng ký đều đã có điểm
+     */
+    std::expected<std::vector<std::string>, Error> findGraduates() const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo ArchiveService
+     * @param archiveDao Đối tượng dao cho kho lưu trữ
+     * @param graduationAuditService Dịch vụ xét tốt nghiệp
+     * @param enrollmentDao Đối tượng dao cho đăng ký
+     * @param courseResultDao Đối tượng dao cho kết quả học tập
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    ArchiveService(std::shared_ptr<IStudentArchiveDao> archiveDao,
+                   std::shared_ptr<IGraduationAuditService> graduationAuditService,
+                   std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                   std::shared_ptr<ICourseResultDao> courseResultDao,
+                   std::shared_ptr<SessionContext> sessionContext);
+
+    ~ArchiveService() override = default;
+
+    std::expected<ArchiveRunReport, Error> runArchival(const ArchivePolicy& policy) override;
+    std::expected<bool, Error> isStudentArchived(const std::string& studentId) const override;
+};
+
+#endif // ARCHIVESERVICE_H
@@ -0,0 +1,196 @@
+#include "AttendanceService.h"
+#include "../AttendanceBitmap.h"
+#include "../../../utils/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+AttendanceService::AttendanceService(std::shared_ptr<IAttendanceDao> attendanceDao,
+                                     std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                                     std::shared_ptr<ICourseDao> courseDao,
+                                     std::shared_ptr<IGeneralInputValidator> inputValidator,
+                                     std::shared_ptr<SessionContext> sessionContext)
+    : _attendanceDao(std::move(attendanceDao)),
+      _enrollmentDao(std::move(enrollmentDao)),
+      _courseDao(std::move(courseDao)),
+      _inputValidator(std::move(inputValidator)),
+      _sessionContext(std::move(sessionContext)) {
+    if (!_attendanceDao) throw std::invalid_argument("AttendanceDao cannot be null for AttendanceService.");
+    if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null for AttendanceService.");
+    if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null for AttendanceService.");
+    if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null for AttendanceService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for AttendanceService.");
+}
+
+std::expected<bool, Error> AttendanceService::requireStaff(const std::string& courseId, const std::string& action) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || (currentRole.value() != UserRole::ADMIN && currentRole.value() != UserRole::TEACHER)) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to " + action + "."});
+    }
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+    return true;
+}
+
+std::expected<std::vector<std::string>, Error> AttendanceService::ensureRoster(const std::string& courseId, std::vector<std::string> studentIds) {
+    auto roster = _attendanceDao->getRoster(courseId);
+    if (!roster.has_value()) return roster;
+    std::sort(studentIds.begin(), studentIds.end());
+    studentIds.erase(std::unique(studentIds.begin(), studentIds.end()), studentIds.end());
+    std::unordered_set<std::string> listed(roster->begin(), roster->end());
+    std::erase_if(studentIds, [&listed](const std::string& studentId) { return listed.contains(studentId); });
+    for (const auto& studentId : studentIds) {
+        if (roster->size() >= AttendanceBitmap::MAX_SLOTS) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Attendance roster of course " + courseId + " is full."});
+        }
+        auto added = _attendanceDao->addToRoster(courseId, static_cast<int>(roster->size()), studentId);
+        if (!added.has_value()) return std::unexpected(added.error());
+        roster->push_back(studentId);
+    }
+    return roster;
+}
+
+std::expected<std::size_t, Error> AttendanceService::markAttendance(const std::string& courseId, int sessionNo,
+                                                                    const std::vector<std::string>& presentStudentIds) {
+    auto allowed = requireStaff(courseId, "mark attendance");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    if (sessionNo < 1) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Session number must be at least 1."});
+    }
+    auto courseExists = _courseDao->exists(courseId);
+    if (!courseExists.has_value()) return std::unexpected(courseExists.error());
+    if (!courseExists.value()) return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course " + courseId + " not found."});
+
+    auto enrolled = _enrollmentDao->findStudentIdsByCourseId(courseId);
+    if (!enrolled.has_value()) return std::unexpected(enrolled.error());
+    std::vector<std::string> enrolledIds = enrolled.value();
+    std::sort(enrolledIds.begin(), enrolledIds.end());
+    for (const auto& studentId : presentStudentIds) {
+        if (!std::binary_search(enrolledIds.begin(), enrolledIds.end(), studentId)) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Student " + studentId + " is not enrolled in course " + courseId + "."});
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto roster = ensureRoster(courseId, enrolledIds);
+    if (!roster.has_value()) return std::unexpected(roster.error());
+    std::unordered_map<std::string, std::size_t> slotOf;
+    slotOf.reserve(roster->size());
+    for (std::size_t slot = 0; slot < roster->size(); ++slot) slotOf.emplace((*roster)[slot], slot);
+
+    AttendanceBitmap bitmap;
+    for (const auto& studentId : presentStudentIds) bitmap.set(slotOf.at(studentId));
+    auto saved = _attendanceDao->saveSession(AttendanceSession{courseId, sessionNo, bitmap.encode()});
+    if (!saved.has_value()) return std::unexpected(saved.error());
+    LOG_INFO("Attendance of course " + courseId + " session " + std::to_string(sessionNo) + ": " +
+             std::to_string(bitmap.count()) + " of " + std::to_string(enrolledIds.size()) + " present.");
+    return bitmap.count();
+}
+
+std::expected<bool, Error> AttendanceService::setAttendance(const std::string& courseId, int sessionNo,
+                                                            const std::string& studentId, bool present) {
+    auto allowed = requireStaff(courseId, "mark attendance");
+    if (!allowed.has_value()) return allowed;
+    if (sessionNo < 1) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Session number must be at least 1."});
+    }
+    auto enrolled = _enrollmentDao->isEnrolled(studentId, courseId);
+    if (!enrolled.has_value()) return std::unexpected(enrolled.error());
+    if (!enrolled.value()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Student " + studentId + " is not enrolled in course " + courseId + "."});
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto roster = ensureRoster(courseId, {studentId});
+    if (!roster.has_value()) return std::unexpected(roster.error());
+    auto slot = static_cast<std::size_t>(std::find(roster->begin(), roster->end(), studentId) - roster->begin());
+
+    AttendanceBitmap bitmap;
+    auto existing = _attendanceDao->findSession(courseId, sessionNo);
+    if (existing.has_value()) {
+        auto decoded = AttendanceBitmap::decode(existing->presence);
+        if (!decoded.has_value()) return std::unexpected(decoded.error());
+        bitmap = std::move(decoded.value());
+    } else if (existing.error().code != ErrorCode::NOT_FOUND) {
+        return std::unexpected(existing.error());
+    }
+    bitmap.set(slot, present);
+    return _attendanceDao->saveSession(AttendanceSession{courseId, sessionNo, bitmap.encode()});
+}
+
+std::expected<std::vector<AttendanceRate>, Error> AttendanceService::computeRates(const std::string& courseId) const {
+    auto enrolled = _enrollmentDao->findStudentIdsByCourseId(courseId);
+    if (!enrolled.has_value()) return std::unexpected(enrolled.error());
+    auto roster = _attendanceDao->getRoster(courseId);
+    if (!roster.has_value()) return std::unexpected(roster.error());
+    auto sessions = _attendanceDao->getSessions(courseId);
+    if (!sessions.has_value()) return std::unexpected(sessions.error());
+
+    AttendanceTally tally(roster->size());
+    for (const auto& session : sessions.value()) {
+        auto bitmap = AttendanceBitmap::decode(session.presence);
+        if (!bitmap.has_value()) return std::unexpected(bitmap.error());
+        tally.add(bitmap.value());
+    }
+    std::vector<int> counts = tally.counts();
+    std::unordered_map<std::string, std::size_t> slotOf;
+    slotOf.reserve(roster->size());
+    for (std::size_t slot = 0; slot < roster->size(); ++slot) slotOf.emplace((*roster)[slot], slot);
+
+    // Sinh viên chưa có slot (đăng ký sau buổi điểm danh cuối) được coi là vắng mọi buổi
+    std::vector<AttendanceRate> rates;
+    rates.reserve(enrolled->size());
+    int sessionCount = static_cast<int>(tally.sessionCount());
+    for (const auto& studentId : enrolled.value()) {
+        auto it = slotOf.find(studentId);
+        int attended = it != slotOf.end() ? counts[it->second] : 0;
+        double rate = sessionCount > 0 ? static_cast<double>(attended) / sessionCount : 0.0;
+        rates.push_back(AttendanceRate{studentId, attended, sessionCount, rate});
+    }
+    std::sort(rates.begin(), rates.end(), [](const AttendanceRate& a, const AttendanceRate& b) { return a.studentId < b.studentId; });
+    return rates;
+}
+
+std::expected<std::vector<AttendanceRate>, Error> AttendanceService::getAttendanceRates(const std::string& courseId) const {
+    auto allowed = requireStaff(courseId, "view attendance");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    return computeRates(courseId);
+}
+
+std::expected<std::vector<AttendanceRate>, Error> AttendanceService::getStudentsBelowThreshold(const std::string& courseId, double minRate) const {
+    auto allowed = requireStaff(courseId, "view attendance");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    if (minRate < 0.0 || minRate > 1.0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Attendance threshold must be between 0 and 1."});
+    }
+    auto rates = computeRates(courseId);
+    if (!rates.has_value()) return rates;
+    std::erase_if(rates.value(), [minRate](const AttendanceRate& rate) { return rate.sessions == 0 || rate.rate >= minRate; });
+    return rates;
+}
+
+std::expected<AttendanceRate, Error> AttendanceService::getStudentAttendance(const std::string& studentId, const std::string& courseId) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    auto currentUserId = _sessionContext->getCurrentUserId();
+    if (!currentRole.has_value() ||
+        (currentRole.value() == UserRole::STUDENT && (!currentUserId.has_value() || currentUserId.value() != studentId))) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to view another student's attendance."});
+    }
+    ValidationResult studentIdVr = _inputValidator->validateIdFormat(studentId, "Student ID");
+    if (!studentIdVr.isValid) return std::unexpected(studentIdVr.errors[0]);
+
+    auto rates = computeRates(courseId);
+    if (!rates.has_value()) return std::unexpected(rates.error());
+    auto it = std::find_if(rates->begin(), rates->end(), [&](const AttendanceRate& rate) { return rate.studentId == studentId; });
+    if (it == rates->end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " is not enrolled in course " + courseId + "."});
+    }
+    return *it;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file AttendanceService.h
+ * @brief Triển khai dịch vụ điểm danh các buổi học
+ */
+#ifndef ATTENDANCESERVICE_H
+#define ATTENDANCESERVICE_H
+
+#include <memory>
+#include <mutex>
+#include "../interface/IAttendanceService.h"
+#include "../../data_access/interface/IAttendanceDao.h"
+#include "../../data_access/interface/IEnrollmentDao.h"
+#include "../../data_access/interface/ICourseDao.h"
+#include "../../validators/interface/IValidator.h"
+#include "../SessionContext.h"
+
+/**
+ * @class AttendanceService
+ * @brief Lớp triển khai dịch vụ điểm danh
+ *
+ * Sinh viên được gán slot trong danh sách điểm danh của khóa học ở lần điểm danh đầu tiên sau khi
+ * đăng ký; mỗi buổi học lưu một AttendanceBitmap. Thống kê cộng các bitmap bằng AttendanceTally.
+ */
+class AttendanceService : public IAttendanceService {
+private:
+    std::shared_ptr<IAttendanceDao> _attendanceDao;          ///< Đối tượng dao cho điểm danh
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;          ///< Đối tượng dao để đọc các đăng ký
+    std::shared_ptr<ICourseDao> _courseDao;                  ///< Đối tượng dao cho khóa học
+    std::shared_ptr<IGeneralInputValidator> _inputValidator; ///< Đối tượng validator để kiểm tra đầu vào
+    std::shared_ptr<SessionContext> _sessionContext;         ///< Đối tượng quản lý phiên làm việc
+    std::mutex _mutex;                                       ///< Tuần tự hóa việc cấp slot và ghi buổi học
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là giảng viên hoặc admin và courseId hợp lệ
+     */
+    std::expected<bool, Error> requireStaff(const std::string& courseId, const std::string& action) const;
+
+    /**
+     * @brief Danh sách điểm danh của khóa học sau khi cấp slot cho các sinh viên chưa có
+     * @param courseId ID của khóa học
+     * @param studentIds Các sinh viên cần có slot
+     * @return studentId theo slot, hoặc Error nếu thất bại
+     */
+    std::expected<std::vector<std::string>, Error> ensureRoster(const std::string& courseId, std::vector<std::string> studentIds);
+
+    /**
+     * @brief Tỷ lệ chuyên cần của các sinh viên đang đăng ký khóa học, theo studentId
+     */
+    std::expected<std::vector<AttendanceRate>, Error> computeRates(const std::string& courseId) const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo AttendanceService
+     * @param attendanceDao Đối tượng dao cho điểm danh
+     * @param enrollmentDao Đối tượng dao để truy cập dữ liệu đăng ký khóa học
+     * @param courseDao Đối tượng dao cho khóa học
+     * @param inputValidator Đối tượng validator để kiểm tra đầu vào
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     */
+    AttendanceService(std::shared_ptr<IAttendanceDao> attendanceDao,
+                      std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                      std::shared_ptr<ICourseDao> courseDao,
+                      std::shared_ptr<IGeneralInputValidator> inputValidator,
+                      std::shared_ptr<SessionContext> sessionContext);
+
+    ~AttendanceService() override = default;
+
+    std::expected<std::size_t, Error> markAttendance(const std::string& courseId, int sessionNo,
+                                                     const std::vector<std::string>& presentStudentIds) override;
+    std::expected<bool, Error> setAttendance(const std::string& courseId, int sessionNo,
+                                             const std::string& studentId, bool present) override;
+    std::expected<std::vector<AttendanceRate>, Error> getAttendanceRates(const std::string& courseId) const override;
+    std::expected<std::vector<AttendanceRate>, Error> getStudentsBelowThreshold(const std::string& courseId, double minRate) const override;
+    std::expected<AttendanceRate, Error> getStudentAttendance(const std::string& studentId, const std::string& courseId) const override;
+};
+
+#endif // ATTENDANCESERVICE_H
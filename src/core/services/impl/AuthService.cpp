@@ -13,6 +13,7 @@
 #include <stdexcept> // For std::invalid_argument
 #include <expected> // Add at the top of the file
 #include "../../entities/AdminUser.h" // For UserRole enum
+#include "../../data_access/UnitOfWork.h"
 
 /**
  * @brief Constructor khởi tạo dịch vụ xác thực với các dependency cần thiết
@@ -30,18 +31,24 @@ AuthService::AuthService(std::shared_ptr<ILoginDao> loginDao,
                          std::shared_ptr<IFacultyDao> _facultyDao,
                          std::shared_ptr<ITeacherDao> teacherDao,
                          std::shared_ptr<IGeneralInputValidator> inputValidator,
-                         std::shared_ptr<SessionContext> sessionContext)
+                         std::shared_ptr<SessionContext> sessionContext,
+                         std::shared_ptr<IIdSequenceService> idSequenceService,
+                         std::shared_ptr<ITransactionManager> transactionManager)
     : _loginDao(std::move(loginDao)),
       _studentDao(std::move(studentDao)),
       _facultyDao(std::move(_facultyDao)), // (➕)
       _teacherDao(std::move(teacherDao)), // (➕)
       _inputValidator(std::move(inputValidator)),
-      _sessionContext(std::move(sessionContext)) {
+      _sessionContext(std::move(sessionContext)),
+      _idSequenceService(std::move(idSequenceService)),
+      _transactionManager(std::move(transactionManager)) {
     if (!_loginDao) throw std::invalid_argument("LoginDao cannot be null for AuthService.");
     if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null for AuthService.");
     if (!_teacherDao) throw std::invalid_argument("TeacherDao cannot be null for AuthService."); // (➕)
     if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null for AuthService.");
     if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for AuthService.");
+    if (!_idSequenceService) throw std::invalid_argument("IdSequenceService cannot be null for AuthService.");
+    if (!_transactionManager) throw std::invalid_argument("TransactionManager cannot be null for AuthService.");
 }
 
 /**
@@ -245,51 +252,13 @@ std::expected<bool, Error> AuthService::registerStudent(const StudentRegistratio
         return std::unexpected(teacherByEmail.error());
     }
     
-    // Logic tạo Student ID (cần cải thiện cho production)
-    std::string studentId;
-    // Lấy năm hiện tại
-    auto nowChrono = std::chrono::system_clock::now(); // Đổi tên biến để tránh trùng
-    auto now_c = std::chrono::system_clock::to_time_t(nowChrono);
-    std::tm now_tm = {};
-    #if defined(_WIN32) || defined(_WIN64)
-        localtime_s(&now_tm, &now_c);
-    #else
-        localtime_r(&now_c, &now_tm);
-    #endif
-    std::string yearPrefix = std::to_string((now_tm.tm_year + 1900) % 100);
-
-    auto facultyDetails = _facultyDao->getById(data.facultyId);
-    if (!facultyDetails.has_value()) { /* Đã check ở trên, nhưng để an toàn */
-        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Faculty details not found for ID: " + data.facultyId});
-    }
-
-    std::string idPrefix = yearPrefix + data.facultyId; 
-    bool idOk = false;
-    int maxRetriesForIdGeneration = 1000; // Tăng số lần thử để tìm số thứ tự
-    for (int sequence = 1; sequence <= 9999; ++sequence) {
-        std::ostringstream oss;
-        oss << idPrefix << std::setfill('0') << std::setw(4) << sequence;
-        studentId = oss.str();
-        // Kiểm tra xem studentId đã tồn tại trong bảng Users hay chưa
-        auto userExists = _loginDao->findCredentialsByUserId(studentId); 
-        if (!userExists.has_value()) {
-            if (userExists.error().code == ErrorCode::NOT_FOUND) {
-                idOk = true; 
-                break;
-            } else {
-                LOG_ERROR("Error checking student ID existence: " + userExists.error().message);
-                return std::unexpected(userExists.error()); // Lỗi DB
-            }
-        }
-        if (sequence >= maxRetriesForIdGeneration && !idOk) { // Giới hạn số lần thử
-             LOG_WARN("Student ID generation: Max retries reached for prefix " + idPrefix);
-             break; // Dừng nếu thử quá nhiều
-        }
-    }
-
-    if (!idOk) {
-        return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Could not generate unique student ID for prefix " + idPrefix + ". Sequence may be exhausted or DB error occurred."});
+    // Cấp mã sinh viên từ bộ đếm của tiền tố năm + khoa
+    auto nextId = _idSequenceService->nextStudentId(_idSequenceService->studentIdPrefix(data.facultyId));
+    if (!nextId.has_value()) {
+        LOG_ERROR("Student registration failed to allocate an ID: " + nextId.error().message);
+        return std::unexpected(nextId.error());
     }
+    const std::string& studentId = nextId.value();
     
     Student newStudent(studentId, data.firstName, data.lastName, data.facultyId, LoginStatus::PENDING_APPROVAL);
     newStudent.setBirthday(data.birthDay, data.birthMonth, data.birthYear);
@@ -299,30 +268,37 @@ std::expected<bool, Error> AuthService::registerStudent(const StudentRegistratio
     newStudent.setPhoneNumber(data.phoneNumber);
     newStudent.setRole(UserRole::PENDING_STUDENT);
 
+    std::string salt = PasswordUtils::generateSalt();
+    std::string hashedPassword = PasswordUtils::hashPassword(plainPassword, salt);
+
+    // Users/Students và Logins trong một transaction; transaction riêng của SqlStudentDao::add trở thành savepoint
+    auto unitOfWork = UnitOfWork::begin(_transactionManager);
+    if (!unitOfWork.has_value()) return std::unexpected(unitOfWork.error());
+
     // Thêm Student (bao gồm cả User record)
-    // SqlStudentDao::add nên xử lý transaction nội bộ cho việc thêm vào Users và Students.
     auto addStudentResult = _studentDao->add(newStudent);
     if (!addStudentResult.has_value()) {
         LOG_ERROR("Student registration failed during studentDao->add: " + addStudentResult.error().message);
         return std::unexpected(addStudentResult.error());
     }
+    // Nguồn dữ liệu không hỗ trợ transaction: xóa student nếu các bước sau thất bại
+    unitOfWork->addCompensation([this, studentId]() {
+        auto removeRollback = _studentDao->remove(studentId);
+        if (!removeRollback.has_value()) {
+            LOG_CRITICAL("Failed to rollback student creation for " + studentId + " after credential add failure: " + removeRollback.error().message);
+        }
+    });
 
-    std::string salt = PasswordUtils::generateSalt();
-    std::string hashedPassword = PasswordUtils::hashPassword(plainPassword, salt);
-    
     // Thêm LoginCredentials. addUserCredentials chỉ thêm vào bảng Logins.
     auto addCredsResult = _loginDao->addUserCredentials(studentId, hashedPassword, salt, UserRole::PENDING_STUDENT, LoginStatus::PENDING_APPROVAL);
     if (!addCredsResult.has_value() || !addCredsResult.value()) {
         LOG_ERROR("Student registration failed at addUserCredentials for " + studentId + ": " + (addCredsResult.has_value() ? "Op failed" : addCredsResult.error().message));
-        // Nếu thất bại, cần rollback việc thêm student.
-        // DAO::remove nên xử lý transaction để xóa cả Users và Students.
-        auto removeRollback = _studentDao->remove(studentId); 
-        if (!removeRollback.has_value()) {
-            LOG_CRITICAL("Failed to rollback student creation for " + studentId + " after credential add failure: " + removeRollback.error().message);
-        }
         return std::unexpected(addCredsResult.has_value() ? Error{ErrorCode::OPERATION_FAILED, "Failed to set login credentials."} : addCredsResult.error());
     }
 
+    auto committed = unitOfWork->commit();
+    if (!committed.has_value()) return std::unexpected(committed.error());
+
     LOG_INFO("Student " + studentId + " registered successfully. Status: PENDING_APPROVAL.");
     return true;
 }
@@ -18,6 +18,8 @@
 #include "../../validators/interface/IValidator.h" // IGeneralInputValidator
 #include "../../entities/Student.h"
 #include "../../entities/Teacher.h" // (➕)
+#include "../../data_access/interface/ITransactionManager.h"
+#include "../interface/IIdSequenceService.h"
 #include "../SessionContext.h"
 #include <memory> // Cho std::shared_ptr
 
@@ -36,6 +38,8 @@ private:
     std::shared_ptr<ITeacherDao> _teacherDao; /**< DAO để truy vấn thông tin giảng viên */
     std::shared_ptr<IGeneralInputValidator> _inputValidator; /**< Bộ xác thực đầu vào */
     std::shared_ptr<SessionContext> _sessionContext; /**< Context lưu trữ thông tin phiên làm việc */
+    std::shared_ptr<IIdSequenceService> _idSequenceService; /**< Dịch vụ cấp phát mã sinh viên */
+    std::shared_ptr<ITransactionManager> _transactionManager; /**< Gom các lần ghi khi đăng ký vào một transaction */
 
 public:
     /**
@@ -45,13 +49,17 @@ public:
      * @param teacherDao DAO để truy vấn thông tin giảng viên
      * @param inputValidator Bộ xác thực đầu vào
      * @param sessionContext Context lưu trữ thông tin phiên làm việc
+     * @param idSequenceService Dịch vụ cấp phát mã sinh viên
+     * @param transactionManager Bộ quản lý transaction của nguồn dữ liệu
      */
     AuthService(std::shared_ptr<ILoginDao> loginDao,
                 std::shared_ptr<IStudentDao> studentDao,
                 std::shared_ptr<IFacultyDao> _facultyDao,
                 std::shared_ptr<ITeacherDao> teacherDao,
                 std::shared_ptr<IGeneralInputValidator> inputValidator,
-                std::shared_ptr<SessionContext> sessionContext);
+                std::shared_ptr<SessionContext> sessionContext,
+                std::shared_ptr<IIdSequenceService> idSequenceService,
+                std::shared_ptr<ITransactionManager> transactionManager);
     
     /**
      * @brief Destructor mặc định
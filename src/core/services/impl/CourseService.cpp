@@ -10,6 +10,8 @@
  * @param courseResultDao Đối tượng truy cập dữ liệu kết quả học tập
  * @param inputValidator Đối tượng kiểm tra đầu vào
  * @param sessionContext Đối tượng quản lý phiên đăng nhập
+ * @param timetableIndex Bộ đệm lịch học dùng chung
+ * @param waitlistService Dịch vụ danh sách chờ, dùng để lấp chỗ khi số chỗ tăng
  * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
  */
 CourseService::CourseService(std::shared_ptr<ICourseDao> courseDao,
@@ -17,19 +19,25 @@ CourseService::CourseService(std::shared_ptr<ICourseDao> courseDao,
                              std::shared_ptr<IEnrollmentDao> enrollmentDao,
                              std::shared_ptr<ICourseResultDao> courseResultDao,
                              std::shared_ptr<IGeneralInputValidator> inputValidator,
-                             std::shared_ptr<SessionContext> sessionContext)
+                             std::shared_ptr<SessionContext> sessionContext,
+                             std::shared_ptr<TimetableIndex> timetableIndex,
+                             std::shared_ptr<IWaitlistService> waitlistService)
     : _courseDao(std::move(courseDao)),
       _facultyDao(std::move(facultyDao)),
       _enrollmentDao(std::move(enrollmentDao)),
       _courseResultDao(std::move(courseResultDao)),
       _inputValidator(std::move(inputValidator)),
-      _sessionContext(std::move(sessionContext)) {
+      _sessionContext(std::move(sessionContext)),
+      _timetableIndex(std::move(timetableIndex)),
+      _waitlistService(std::move(waitlistService)) {
     if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null.");
     if (!_facultyDao) throw std::invalid_argument("FacultyDao cannot be null.");
     if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null.");
     if (!_courseResultDao) throw std::invalid_argument("CourseResultDao cannot be null.");
     if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null.");
     if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null.");
+    if (!_timetableIndex) throw std::invalid_argument("TimetableIndex cannot be null.");
+    if (!_waitlistService) throw std::invalid_argument("WaitlistService cannot be null.");
 }
 
 /**
@@ -207,6 +215,82 @@ std::expected<bool, Error> CourseService::removeCourse(const std::string& course
     auto removeResult = _courseDao->remove(courseId);
     if (removeResult.has_value() && removeResult.value()){
         LOG_INFO("Course removed: ID=" + courseId);
+        _timetableIndex->invalidateCourse(courseId);
     }
     return removeResult;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Đặt số chỗ tối đa của khóa học
+ * 
+ * Yêu cầu quyền truy cập: chỉ admin mới có quyền thay đổi số chỗ. Khi số chỗ tăng hoặc bỏ giới hạn,
+ * các sinh viên đứng đầu danh sách chờ được đăng ký vào những chỗ vừa có.
+ * 
+ * @param courseId ID của khóa học
+ * @param capacity Số chỗ mới (0 = không giới hạn)
+ * @return std::expected<bool, Error> true nếu thành công, hoặc lỗi nếu thất bại
+ */
+std::expected<bool, Error> CourseService::setCourseCapacity(const std::string& courseId, int capacity) {
+    if (!_sessionContext->isAuthenticated() || !_sessionContext->getCurrentUserRole().has_value() || _sessionContext->getCurrentUserRole().value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can change course capacity."});
+    }
+    ValidationResult capacityVr = _inputValidator->validateInteger(capacity, "Capacity", 0, Course::MAX_CAPACITY);
+    if (!capacityVr.isValid) return std::unexpected(capacityVr.errors[0]);
+
+    auto courseResult = _courseDao->getById(courseId);
+    if (!courseResult.has_value()) {
+        return std::unexpected(courseResult.error());
+    }
+    Course course = courseResult.value();
+    const int oldCapacity = course.getCapacity();
+    if (oldCapacity == capacity) return true;
+    course.setCapacity(capacity);
+
+    auto updateResult = _courseDao->update(course);
+    if (updateResult.has_value() && updateResult.value()) {
+        LOG_INFO("Course capacity updated: ID=" + courseId + ", capacity=" + std::to_string(capacity));
+        // Chỉ khi có thêm chỗ (0 = không giới hạn); lỗi khi lấp chỗ chỉ ghi log như khi hủy đăng ký
+        if (capacity == 0 || (oldCapacity != 0 && capacity > oldCapacity)) {
+            auto promoted = _waitlistService->promoteWaitlisted({courseId});
+            if (!promoted.has_value()) {
+                LOG_WARN("Could not promote waitlisted students into course " + courseId + ": " + promoted.error().message);
+            }
+        }
+    }
+    return updateResult;
+}
+
+/**
+ * @brief Đặt lịch học của khóa học
+ * 
+ * Yêu cầu quyền truy cập: chỉ admin mới có quyền thay đổi lịch học. Lịch đã đệm của khóa học
+ * và thời khóa biểu đã đệm của các sinh viên học khóa học này bị bỏ để lần đăng ký sau ghép lại.
+ * 
+ * @param courseId ID của khóa học
+ * @param scheduleText Lịch học, các buổi cách nhau bởi ';' (rỗng = không có lịch)
+ * @return std::expected<bool, Error> true nếu thành công, hoặc lỗi nếu thất bại
+ */
+std::expected<bool, Error> CourseService::setCourseSchedule(const std::string& courseId, const std::string& scheduleText) {
+    if (!_sessionContext->isAuthenticated() || !_sessionContext->getCurrentUserRole().has_value() || _sessionContext->getCurrentUserRole().value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can change course schedules."});
+    }
+    auto slotsResult = MeetingSlot::parseSchedule(scheduleText);
+    if (!slotsResult.has_value()) return std::unexpected(slotsResult.error());
+
+    auto courseResult = _courseDao->getById(courseId);
+    if (!courseResult.has_value()) {
+        return std::unexpected(courseResult.error());
+    }
+    Course course = courseResult.value();
+    if (course.getMeetingSlots() == slotsResult.value()) return true;
+    if (!course.setMeetingSlots(slotsResult.value())) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Meetings of a course must not overlap each other."});
+    }
+
+    auto updateResult = _courseDao->update(course);
+    if (updateResult.has_value() && updateResult.value()) {
+        _timetableIndex->invalidateCourse(courseId);
+        LOG_INFO("Course schedule updated: ID=" + courseId + ", schedule=" + MeetingSlot::formatSchedule(course.getMeetingSlots()));
+    }
+    return updateResult;
+}
@@ -15,6 +15,8 @@
 #include "../../data_access/interface/ICourseResultDao.h"// (➕) Để check ràng buộc
 #include "../../validators/interface/IValidator.h"
 #include "../SessionContext.h" // (➕)
+#include "../TimetableIndex.h"
+#include "../interface/IWaitlistService.h"
 
 /**
  * @class CourseService
@@ -31,6 +33,8 @@ private:
     std::shared_ptr<ICourseResultDao> _courseResultDao; ///< Đối tượng dao để truy cập dữ liệu kết quả khóa học
     std::shared_ptr<IGeneralInputValidator> _inputValidator; ///< Đối tượng validator để kiểm tra đầu vào
     std::shared_ptr<SessionContext> _sessionContext;    ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<TimetableIndex> _timetableIndex;    ///< Bộ đệm lịch học dùng chung với EnrollmentService
+    std::shared_ptr<IWaitlistService> _waitlistService; ///< Dịch vụ danh sách chờ, để lấp chỗ khi tăng số chỗ
 
 public:
     /**
@@ -41,13 +45,17 @@ public:
      * @param courseResultDao Đối tượng dao để truy cập dữ liệu kết quả khóa học
      * @param inputValidator Đối tượng validator để kiểm tra đầu vào
      * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param timetableIndex Bộ đệm lịch học, được làm mới khi lịch học thay đổi
+     * @param waitlistService Dịch vụ danh sách chờ
      */
     CourseService(std::shared_ptr<ICourseDao> courseDao,
                   std::shared_ptr<IFacultyDao> facultyDao,
                   std::shared_ptr<IEnrollmentDao> enrollmentDao, // (➕)
                   std::shared_ptr<ICourseResultDao> courseResultDao, // (➕)
                   std::shared_ptr<IGeneralInputValidator> inputValidator,
-                  std::shared_ptr<SessionContext> sessionContext); // (➕)
+                  std::shared_ptr<SessionContext> sessionContext, // (➕)
+                  std::shared_ptr<TimetableIndex> timetableIndex,
+                  std::shared_ptr<IWaitlistService> waitlistService);
     
     /**
      * @brief Hàm hủy ảo mặc định
@@ -98,6 +106,22 @@ public:
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<bool, Error> removeCourse(const std::string& courseId) override;
+
+    /**
+     * @brief Đặt số chỗ tối đa của khóa học; khi số chỗ tăng (hoặc bỏ giới hạn) thì xếp sinh viên từ danh sách chờ vào
+     * @param courseId ID của khóa học
+     * @param capacity Số chỗ mới (0 = không giới hạn)
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    std::expected<bool, Error> setCourseCapacity(const std::string& courseId, int capacity) override;
+
+    /**
+     * @brief Đặt lịch học của khóa học
+     * @param courseId ID của khóa học
+     * @param scheduleText Lịch học dạng "Mon 07:30-09:30 E301; Wed 13:00-15:00 F201"
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    std::expected<bool, Error> setCourseSchedule(const std::string& courseId, const std::string& scheduleText) override;
 };
 
 #endif // COURSESERVICE_H
\ No newline at end of file
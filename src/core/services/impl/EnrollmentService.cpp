@@ -1,5 +1,9 @@
 #include "EnrollmentService.h"
 #include "../../../utils/Logger.h"
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <unordered_map>
 
 /**
  * @brief Khởi tạo đối tượng EnrollmentService
@@ -9,6 +13,9 @@
  * @param courseDao Đối tượng truy cập dữ liệu khóa học
  * @param inputValidator Đối tượng kiểm tra đầu vào
  * @param sessionContext Đối tượng quản lý phiên đăng nhập
+ * @param waitlistService Dịch vụ danh sách chờ
+ * @param timetableIndex Bộ đệm lịch học dùng chung
+ * @param enrollmentPolicy Điều kiện đăng ký dùng chung
  * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
  */
 EnrollmentService::EnrollmentService(
@@ -16,17 +23,26 @@ EnrollmentService::EnrollmentService(
     std::shared_ptr<IStudentDao> studentDao,
     std::shared_ptr<ICourseDao> courseDao,
     std::shared_ptr<IGeneralInputValidator> inputValidator,
-    std::shared_ptr<SessionContext> sessionContext)
+    std::shared_ptr<SessionContext> sessionContext,
+    std::shared_ptr<IWaitlistService> waitlistService,
+    std::shared_ptr<TimetableIndex> timetableIndex,
+    std::shared_ptr<EnrollmentPolicy> enrollmentPolicy)
     : _enrollmentDao(std::move(enrollmentDao)),
       _studentDao(std::move(studentDao)),
       _courseDao(std::move(courseDao)),
       _inputValidator(std::move(inputValidator)),
-      _sessionContext(std::move(sessionContext)) {
+      _sessionContext(std::move(sessionContext)),
+      _waitlistService(std::move(waitlistService)),
+      _timetableIndex(std::move(timetableIndex)),
+      _enrollmentPolicy(std::move(enrollmentPolicy)) {
     if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null.");
     if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null.");
     if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null.");
     if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null.");
     if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null.");
+    if (!_waitlistService) throw std::invalid_argument("WaitlistService cannot be null.");
+    if (!_timetableIndex) throw std::invalid_argument("TimetableIndex cannot be null.");
+    if (!_enrollmentPolicy) throw std::invalid_argument("EnrollmentPolicy cannot be null.");
 }
 
 /**
@@ -62,30 +78,15 @@ std::expected<bool, Error> EnrollmentService::enrollStudentInCourse(const std::s
     ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
     if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
 
-    // Kiểm tra Student tồn tại và ACTIVE
-    auto studentResult = _studentDao->getById(studentId);
-    if (!studentResult.has_value()) {
-        return std::unexpected(studentResult.error());
+    // Kiểm tra Student tồn tại và ACTIVE. Sinh viên tự đăng ký thì tài khoản đang đăng nhập chính là
+    // sinh viên đó (đăng nhập đòi hỏi ACTIVE), nên không cần truy vấn lại
+    std::optional<LoginStatus> sessionStatus;
+    if (currentUserRoleOpt.value() == UserRole::STUDENT) {
+        auto currentUser = _sessionContext->getCurrentUser();
+        sessionStatus = currentUser.has_value() ? currentUser.value()->getStatus() : LoginStatus::DISABLED;
     }
-    if (studentResult.value().getStatus() != LoginStatus::ACTIVE) {
-        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Student account is not active. Cannot enroll in courses."});
-    }
-
-    // Kiểm tra Course tồn tại
-    auto courseExists = _courseDao->exists(courseId);
-    if (!courseExists.has_value()) return std::unexpected(courseExists.error());
-    if (!courseExists.value()) {
-        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course with ID '" + courseId + "' not found."});
-    }
-
-    // Kiểm tra đã enroll chưa
-    auto enrolledCheck = _enrollmentDao->isEnrolled(studentId, courseId);
-    if (!enrolledCheck.has_value()) return std::unexpected(enrolledCheck.error());
-    if (enrolledCheck.value()) {
-        return std::unexpected(Error{ErrorCode::ALREADY_EXISTS, "Student is already enrolled in this course."});
-    }
-
-    auto enrollResult = _enrollmentDao->addEnrollment(studentId, courseId);
+    // Trạng thái tài khoản, môn tiên quyết, trùng lịch và số chỗ được kiểm tra bởi EnrollmentPolicy, dùng chung với danh sách chờ
+    auto enrollResult = _enrollmentPolicy->enroll(studentId, courseId, sessionStatus);
     if (enrollResult.has_value() && enrollResult.value()) {
         LOG_INFO("Student " + studentId + " enrolled in course " + courseId);
     }
@@ -128,10 +129,126 @@ std::expected<bool, Error> EnrollmentService::dropCourseForStudent(const std::st
     auto dropResult = _enrollmentDao->removeEnrollment(studentId, courseId);
      if (dropResult.has_value() && dropResult.value()) {
         LOG_INFO("Student " + studentId + " dropped course " + courseId);
+        // Hủy đăng ký đã thành công; lỗi khi lấp chỗ chỉ ghi log, chỗ trống sẽ được lấp ở lần hủy kế tiếp
+        auto promoted = _waitlistService->promoteWaitlisted({courseId});
+        if (!promoted.has_value()) {
+            LOG_WARN("Could not promote waitlisted students into course " + courseId + ": " + promoted.error().message);
+        }
     }
     return dropResult;
 }
 
+/**
+ * @brief Hủy nhiều đăng ký cùng lúc
+ * 
+ * Chỉ admin được thực hiện. Các chỗ trống được lấp sau khi hủy xong toàn bộ, mỗi khóa học
+ * một lượt, thay vì một lượt cho mỗi đăng ký bị hủy.
+ * 
+ * @param enrollments Các cặp (sinh viên, khóa học) cần hủy
+ * @return std::expected<std::size_t, Error> Số đăng ký đã hủy, hoặc lỗi nếu thất bại
+ */
+std::expected<std::size_t, Error> EnrollmentService::dropCoursesForStudents(const std::vector<EnrollmentRecord>& enrollments) {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentUserRoleOpt = _sessionContext->getCurrentUserRole();
+    if (!currentUserRoleOpt.has_value() || currentUserRoleOpt.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can drop courses in bulk."});
+    }
+    for (const auto& enrollment : enrollments) {
+        ValidationResult studentIdVr = _inputValidator->validateIdFormat(enrollment.studentId, "Student ID");
+        if (!studentIdVr.isValid) return std::unexpected(studentIdVr.errors[0]);
+        ValidationResult courseIdVr = _inputValidator->validateIdFormat(enrollment.courseId, "Course ID");
+        if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+    }
+
+    std::size_t dropped = 0;
+    std::vector<std::string> freedCourseIds;
+    std::optional<Error> dropError;
+    for (const auto& enrollment : enrollments) {
+        auto dropResult = _enrollmentDao->removeEnrollment(enrollment.studentId, enrollment.courseId);
+        if (!dropResult.has_value()) {
+            dropError = dropResult.error();
+            break;
+        }
+        ++dropped;
+        freedCourseIds.push_back(enrollment.courseId);
+    }
+    LOG_INFO("Dropped " + std::to_string(dropped) + " of " + std::to_string(enrollments.size()) + " enrollments in bulk.");
+
+    // Lấp chỗ cho cả những khóa học đã hủy được trước khi gặp lỗi
+    auto promoted = _waitlistService->promoteWaitlisted(freedCourseIds);
+    if (!promoted.has_value()) {
+        LOG_WARN("Could not promote waitlisted students after bulk drop: " + promoted.error().message);
+    }
+    if (dropError.has_value()) return std::unexpected(dropError.value());
+    return dropped;
+}
+
+/**
+ * @brief Lập báo cáo trùng lịch học của mọi sinh viên
+ * 
+ * Chỉ admin được thực hiện. Nạp lại lịch của mọi khóa học vào bộ đệm, duyệt các đăng ký một lượt
+ * và ghép thời khóa biểu từng sinh viên bằng bitset; chỉ những khóa học có ô trùng mới được so
+ * từng cặp buổi học. Thời khóa biểu ghép được sẽ thay cho bộ đệm cũ.
+ * 
+ * @return std::expected<std::vector<TimetableClash>, Error> Các cặp buổi học trùng giờ, hoặc lỗi nếu thất bại
+ */
+std::expected<std::vector<TimetableClash>, Error> EnrollmentService::getTimetableClashReport() {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentUserRoleOpt = _sessionContext->getCurrentUserRole();
+    if (!currentUserRoleOpt.has_value() || currentUserRoleOpt.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can view the timetable clash report."});
+    }
+
+    auto coursesResult = _courseDao->getAll();
+    if (!coursesResult.has_value()) return std::unexpected(coursesResult.error());
+    _timetableIndex->clear();
+    std::unordered_map<std::string, TimetableIndex::CourseSchedule> schedules;
+    for (const auto& course : coursesResult.value()) {
+        _timetableIndex->storeCourse(course.getId(), course.getMeetingSlots());
+        schedules.emplace(course.getId(), TimetableIndex::CourseSchedule{course.getMeetingSlots(), WeeklyTimetable::maskOf(course.getMeetingSlots())});
+    }
+
+    std::map<std::string, std::vector<std::string>> courseIdsByStudent;
+    auto visited = _enrollmentDao->forEachEnrollment([&courseIdsByStudent](const EnrollmentRecord& record) {
+        courseIdsByStudent[record.studentId].push_back(record.courseId);
+        return true;
+    });
+    if (!visited.has_value()) return std::unexpected(visited.error());
+
+    std::vector<TimetableClash> clashes;
+    for (auto& [studentId, courseIds] : courseIdsByStudent) {
+        std::sort(courseIds.begin(), courseIds.end());
+        WeeklyTimetable timetable;
+        std::vector<const std::string*> scheduled;
+        for (const auto& courseId : courseIds) {
+            auto it = schedules.find(courseId);
+            if (it == schedules.end() || it->second.mask.none()) continue;
+            if (timetable.clashesWith(it->second.mask)) {
+                for (const auto* earlierId : scheduled) {
+                    const auto& earlier = schedules.at(*earlierId);
+                    if ((earlier.mask & it->second.mask).none()) continue;
+                    for (const auto& slot : earlier.slots) {
+                        for (const auto& otherSlot : it->second.slots) {
+                            if (slot.overlaps(otherSlot)) {
+                                clashes.push_back(TimetableClash{studentId, *earlierId, slot, courseId, otherSlot});
+                            }
+                        }
+                    }
+                }
+            }
+            timetable.add(it->second.mask);
+            scheduled.push_back(&courseId);
+        }
+        _timetableIndex->storeStudent(studentId, courseIds, timetable);
+    }
+    LOG_INFO("Timetable clash report: " + std::to_string(clashes.size()) + " clashes across " + std::to_string(courseIdsByStudent.size()) + " students.");
+    return clashes;
+}
+
 /**
  * @brief Lấy danh sách khóa học mà sinh viên đã đăng ký
  * 
@@ -13,6 +13,9 @@
 #include "../../data_access/interface/IStudentDao.h"  // Để kiểm tra Student tồn tại và status
 #include "../../data_access/interface/ICourseDao.h"   // Để kiểm tra Course tồn tại
 #include "../../validators/interface/IValidator.h"    // GeneralInputValidator
+#include "../interface/IWaitlistService.h"            // Lấp chỗ trống sau khi hủy đăng ký
+#include "../TimetableIndex.h"                        // Kiểm tra trùng lịch học
+#include "../EnrollmentPolicy.h"                      // Điều kiện đăng ký dùng chung với danh sách chờ
 #include "../SessionContext.h"
 
 /**
@@ -29,6 +32,9 @@ private:
     std::shared_ptr<ICourseDao> _courseDao;           ///< Đối tượng dao để truy cập dữ liệu khóa học
     std::shared_ptr<IGeneralInputValidator> _inputValidator; ///< Đối tượng validator để kiểm tra đầu vào
     std::shared_ptr<SessionContext> _sessionContext;  ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<IWaitlistService> _waitlistService; ///< Dịch vụ danh sách chờ, lấp chỗ vừa được hủy
+    std::shared_ptr<TimetableIndex> _timetableIndex;  ///< Bộ đệm lịch học dùng chung với CourseService
+    std::shared_ptr<EnrollmentPolicy> _enrollmentPolicy; ///< Điều kiện đăng ký dùng chung với WaitlistService
 
 public:
     /**
@@ -38,12 +44,18 @@ public:
      * @param courseDao Đối tượng dao để truy cập dữ liệu khóa học
      * @param inputValidator Đối tượng validator để kiểm tra đầu vào
      * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param waitlistService Dịch vụ danh sách chờ
+     * @param timetableIndex Bộ đệm lịch học của khóa học và thời khóa biểu của sinh viên
+     * @param enrollmentPolicy Điều kiện đăng ký dùng chung
      */
     EnrollmentService(std::shared_ptr<IEnrollmentDao> enrollmentDao,
                       std::shared_ptr<IStudentDao> studentDao,
                       std::shared_ptr<ICourseDao> courseDao,
                       std::shared_ptr<IGeneralInputValidator> inputValidator,
-                      std::shared_ptr<SessionContext> sessionContext);
+                      std::shared_ptr<SessionContext> sessionContext,
+                      std::shared_ptr<IWaitlistService> waitlistService,
+                      std::shared_ptr<TimetableIndex> timetableIndex,
+                      std::shared_ptr<EnrollmentPolicy> enrollmentPolicy);
     
     /**
      * @brief Hàm hủy ảo mặc định
@@ -52,7 +64,7 @@ public:
      * @brief Đăng ký khóa học cho sinh viên
      * @param studentId ID của sinh viên
      * @param courseId ID của khóa học
-     * @return true nếu thành công, hoặc Error nếu thất bại
+     * @return true nếu thành công, hoặc Error nếu thất bại (COURSE_PREREQUISITE_NOT_MET nếu chưa qua môn tiên quyết, COURSE_SCHEDULE_CONFLICT nếu trùng lịch)
      */
     std::expected<bool, Error> enrollStudentInCourse(const std::string& studentId, const std::string& courseId) override;
     
@@ -63,6 +75,19 @@ public:
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<bool, Error> dropCourseForStudent(const std::string& studentId, const std::string& courseId) override;
+
+    /**
+     * @brief Hủy nhiều đăng ký cùng lúc (chỉ admin)
+     * @param enrollments Các cặp (sinh viên, khóa học) cần hủy
+     * @return Số đăng ký đã hủy, hoặc Error nếu thất bại
+     */
+    std::expected<std::size_t, Error> dropCoursesForStudents(const std::vector<EnrollmentRecord>& enrollments) override;
+
+    /**
+     * @brief Lập báo cáo trùng lịch học của mọi sinh viên (chỉ admin)
+     * @return Các cặp buổi học trùng giờ, hoặc Error nếu thất bại
+     */
+    std::expected<std::vector<TimetableClash>, Error> getTimetableClashReport() override;
     
     /**
      * @brief Lấy danh sách khóa học mà sinh viên đã đăng ký
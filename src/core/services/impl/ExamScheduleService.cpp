@@ -0,0 +1,98 @@
+#include "ExamScheduleService.h"
+#include "../../../utils/Logger.h"
+#include "../TermScope.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+ExamScheduleService::ExamScheduleService(std::shared_ptr<IExamScheduleDao> examScheduleDao,
+                                         std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                                         std::shared_ptr<IGeneralInputValidator> inputValidator,
+                                         std::shared_ptr<SessionContext> sessionContext,
+                                         std::shared_ptr<ITermDao> termDao)
+    : _examScheduleDao(std::move(examScheduleDao)),
+      _enrollmentDao(std::move(enrollmentDao)),
+      _inputValidator(std::move(inputValidator)),
+      _sessionContext(std::move(sessionContext)),
+      _termDao(std::move(termDao)) {
+    if (!_examScheduleDao) throw std::invalid_argument("ExamScheduleDao cannot be null for ExamScheduleService.");
+    if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null for ExamScheduleService.");
+    if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null for ExamScheduleService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for ExamScheduleService.");
+    if (!_termDao) throw std::invalid_argument("TermDao cannot be null for ExamScheduleService.");
+}
+
+std::expected<ExamScheduleSummary, Error> ExamScheduleService::generateExamSchedule(const ExamSchedulingOptions& options) {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can generate the exam schedule."});
+    }
+
+    // Đăng ký của các học kỳ khác không tạo xung đột lịch thi
+    auto termId = TermScope::resolve(*_termDao, options.termId);
+    if (!termId.has_value()) return std::unexpected(termId.error());
+
+    // Gán chỉ số dày đặc cho khóa học và sinh viên trong một lần duyệt các đăng ký
+    std::vector<std::string> courseIds;
+    std::unordered_map<std::string, std::uint32_t> courseIndex;
+    std::unordered_map<std::string, std::uint32_t> studentIndex;
+    std::vector<std::vector<std::uint32_t>> coursesOfStudent;
+    auto visited = _enrollmentDao->forEachEnrollment([&](const EnrollmentRecord& record) {
+        if (!TermScope::includes(termId.value(), record.termId)) return true;
+        auto [courseIt, newCourse] = courseIndex.try_emplace(record.courseId, static_cast<std::uint32_t>(courseIds.size()));
+        if (newCourse) courseIds.push_back(record.courseId);
+        auto [studentIt, newStudent] = studentIndex.try_emplace(record.studentId, static_cast<std::uint32_t>(coursesOfStudent.size()));
+        if (newStudent) coursesOfStudent.emplace_back();
+        coursesOfStudent[studentIt->second].push_back(courseIt->second);
+        return true;
+    });
+    if (!visited.has_value()) return std::unexpected(visited.error());
+
+    ExamScheduler scheduler(std::move(courseIds), coursesOfStudent);
+    auto slots = scheduler.schedule(options);
+    if (!slots.has_value()) return std::unexpected(slots.error());
+    auto saved = _examScheduleDao->replaceAll(slots.value());
+    if (!saved.has_value()) return std::unexpected(saved.error());
+
+    ExamScheduleSummary summary;
+    summary.studentCount = coursesOfStudent.size();
+    summary.conflictCount = scheduler.conflictCount();
+    for (const auto& slot : slots.value()) summary.dayCount = std::max(summary.dayCount, slot.day);
+    summary.slots = std::move(slots.value());
+    LOG_INFO("Exam schedule generated: " + std::to_string(summary.slots.size()) + " exams over " + std::to_string(summary.dayCount) +
+             " days for " + std::to_string(summary.studentCount) + " students.");
+    return summary;
+}
+
+std::expected<std::vector<ExamSlot>, Error> ExamScheduleService::getExamSchedule() const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    return _examScheduleDao->getAll();
+}
+
+std::expected<std::vector<ExamSlot>, Error> ExamScheduleService::getStudentExamSchedule(const std::string& studentId) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    auto currentUserId = _sessionContext->getCurrentUserId();
+    if (!currentRole.has_value() ||
+        (currentRole.value() == UserRole::STUDENT && (!currentUserId.has_value() || currentUserId.value() != studentId))) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to view another student's exam schedule."});
+    }
+    ValidationResult studentIdVr = _inputValidator->validateIdFormat(studentId, "Student ID");
+    if (!studentIdVr.isValid) return std::unexpected(studentIdVr.errors[0]);
+
+    auto courseIds = _enrollmentDao->findCourseIdsByStudentId(studentId);
+    if (!courseIds.has_value()) return std::unexpected(courseIds.error());
+    auto schedule = _examScheduleDao->getAll();
+    if (!schedule.has_value()) return std::unexpected(schedule.error());
+    std::unordered_set<std::string> enrolled(courseIds->begin(), courseIds->end());
+    std::erase_if(schedule.value(), [&enrolled](const ExamSlot& slot) { return !enrolled.contains(slot.courseId); });
+    return schedule;
+}
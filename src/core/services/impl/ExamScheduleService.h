@@ -0,0 +1,53 @@
+/**
+ * @file ExamScheduleService.h
+ * @brief Triển khai dịch vụ xếp lịch thi cuối kỳ
+ */
+#ifndef EXAMSCHEDULESERVICE_H
+#define EXAMSCHEDULESERVICE_H
+
+#include <memory>
+#include "../interface/IExamScheduleService.h"
+#include "../../data_access/interface/IExamScheduleDao.h"
+#include "../../data_access/interface/IEnrollmentDao.h"
+#include "../../data_access/interface/ITermDao.h"
+#include "../../validators/interface/IValidator.h"
+#include "../SessionContext.h"
+
+/**
+ * @class ExamScheduleService
+ * @brief Lớp triển khai dịch vụ lịch thi
+ *
+ * Đọc các đăng ký của học kỳ bằng một lần duyệt, gán chỉ số dày đặc cho khóa học và sinh viên rồi giao cho
+ * ExamScheduler; lịch thi mới chỉ thay lịch cũ khi xếp thành công.
+ */
+class ExamScheduleService : public IExamScheduleService {
+private:
+    std::shared_ptr<IExamScheduleDao> _examScheduleDao;       ///< Đối tượng dao cho lịch thi
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;           ///< Đối tượng dao để đọc các đăng ký
+    std::shared_ptr<IGeneralInputValidator> _inputValidator;  ///< Đối tượng validator để kiểm tra đầu vào
+    std::shared_ptr<SessionContext> _sessionContext;          ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<ITermDao> _termDao;                       ///< Đối tượng dao để tìm học kỳ hiện tại
+
+public:
+    /**
+     * @brief Hàm khởi tạo ExamScheduleService
+     * @param examScheduleDao Đối tượng dao cho lịch thi
+     * @param enrollmentDao Đối tượng dao để truy cập dữ liệu đăng ký khóa học
+     * @param inputValidator Đối tượng validator để kiểm tra đầu vào
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param termDao Đối tượng dao cho học kỳ
+     */
+    ExamScheduleService(std::shared_ptr<IExamScheduleDao> examScheduleDao,
+                        std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                        std::shared_ptr<IGeneralInputValidator> inputValidator,
+                        std::shared_ptr<SessionContext> sessionContext,
+                        std::shared_ptr<ITermDao> termDao);
+
+    ~ExamScheduleService() override = default;
+
+    std::expected<ExamScheduleSummary, Error> generateExamSchedule(const ExamSchedulingOptions& options) override;
+    std::expected<std::vector<ExamSlot>, Error> getExamSchedule() const override;
+    std::expected<std::vector<ExamSlot>, Error> getStudentExamSchedule(const std::string& studentId) const override;
+};
+
+#endif // EXAMSCHEDULESERVICE_H
@@ -0,0 +1,285 @@
+#include "ExportService.h"
+#include "../../../utils/RecordWriter.h"
+#include "../../../utils/Logger.h"
+#include "../../parsing/impl_csv_parser/StudentCsvParser.h"
+#include "../../parsing/impl_csv_parser/TeacherCsvParser.h"
+#include "../../parsing/impl_csv_parser/FacultyCsvParser.h"
+#include "../../parsing/impl_csv_parser/CourseCsvParser.h"
+#include "../../parsing/impl_csv_parser/EnrollmentRecordCsvParser.h"
+#include "../../parsing/impl_csv_parser/CourseResultCsvParser.h"
+#include "../../parsing/impl_csv_parser/FeeRecordCsvParser.h"
+#include "../../parsing/impl_csv_parser/SalaryRecordCsvParser.h"
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    // Các hàm ghi trường theo đúng thứ tự cột của parser CSV tương ứng, để file xuất dạng CSV
+    // có thể dùng lại làm file dữ liệu cho nguồn dữ liệu CSV. Chuỗi được ghi qua string_view
+    // của getter nên không tạo bản sao nào cho mỗi bản ghi.
+
+    void writeUserFields(RecordWriter& writer, const User& user) {
+        writer.writeField(user.getId());
+        writer.writeField(user.getFirstName());
+        writer.writeField(user.getLastName());
+        if (user.getBirthday().isSet()) {
+            writer.writeField(static_cast<long long>(user.getBirthday().getDay()));
+            writer.writeField(static_cast<long long>(user.getBirthday().getMonth()));
+            writer.writeField(static_cast<long long>(user.getBirthday().getYear()));
+        } else {
+            writer.writeNull();
+            writer.writeNull();
+            writer.writeNull();
+        }
+        writer.writeField(user.getAddress());
+        writer.writeField(user.getCitizenId());
+        writer.writeField(user.getEmail());
+        writer.writeField(user.getPhoneNumber());
+        writer.writeField(static_cast<long long>(user.getRole()));
+        writer.writeField(static_cast<long long>(user.getStatus()));
+    }
+
+    void writeStudent(RecordWriter& writer, const Student& student) {
+        writeUserFields(writer, student);
+        writer.writeField(student.getFacultyId());
+    }
+
+    void writeTeacher(RecordWriter& writer, const Teacher& teacher) {
+        writeUserFields(writer, teacher);
+        writer.writeField(teacher.getFacultyId());
+        writer.writeField(teacher.getQualification());
+        writer.writeField(teacher.getSpecializationSubjects());
+        writer.writeField(teacher.getDesignation());
+        writer.writeField(static_cast<long long>(teacher.getExperienceYears()));
+    }
+
+    void writeFaculty(RecordWriter& writer, const Faculty& faculty) {
+        writer.writeField(faculty.getId());
+        writer.writeField(faculty.getName());
+    }
+
+    void writeCourse(RecordWriter& writer, const Course& course) {
+        writer.writeField(course.getId());
+        writer.writeField(course.getName());
+        writer.writeField(static_cast<long long>(course.getCredits()));
+        writer.writeField(course.getFacultyId());
+        writer.writeField(static_cast<long long>(course.getCapacity()));
+        writer.writeField(MeetingSlot::formatSchedule(course.getMeetingSlots()));
+    }
+
+    void writeEnrollment(RecordWriter& writer, const EnrollmentRecord& record) {
+        writer.writeField(record.studentId);
+        writer.writeField(record.courseId);
+        if (record.termId.empty()) writer.writeNull(); // Chưa gán học kỳ
+        else writer.writeField(record.termId);
+    }
+
+    void writeCourseResult(RecordWriter& writer, const CourseResult& result) {
+        writer.writeField(result.getStudentId());
+        writer.writeField(result.getCourseId());
+        if (result.getMarks() == -1) writer.writeNull(); // Chưa có điểm
+        else writer.writeField(static_cast<long long>(result.getMarks()));
+        if (result.getTermId().empty()) writer.writeNull();
+        else writer.writeField(result.getTermId());
+    }
+
+    void writeFeeRecord(RecordWriter& writer, const FeeRecord& record) {
+        writer.writeField(record.getStudentId());
+        writer.writeField(static_cast<long long>(record.getTotalFee()));
+        writer.writeField(static_cast<long long>(record.getPaidFee()));
+    }
+
+    void writeSalaryRecord(RecordWriter& writer, const SalaryRecord& record) {
+        writer.writeField(record.getTeacherId());
+        writer.writeField(static_cast<long long>(record.getBasicMonthlyPay()));
+    }
+
+    /**
+     * @brief Tạo visitor cho DAO: ghi thực thể thành một bản ghi, dừng duyệt ở lỗi ghi đầu tiên
+     */
+    template <typename TEntity>
+    std::function<bool(const TEntity&)> recordSink(RecordWriter& writer, void (*writeFields)(RecordWriter&, const TEntity&),
+                                                   std::optional<Error>& writeError) {
+        return [&writer, writeFields, &writeError](const TEntity& entity) {
+            writeFields(writer, entity);
+            auto written = writer.endRecord();
+            if (!written.has_value()) {
+                writeError = written.error();
+                return false;
+            }
+            return true;
+        };
+    }
+
+    const std::vector<std::string>* columnsFor(EntityType entityType) {
+        switch (entityType) {
+            case EntityType::STUDENT:      return &StudentCsvParser::columns();
+            case EntityType::TEACHER:      return &TeacherCsvParser::columns();
+            case EntityType::FACULTY:      return &FacultyCsvParser::columns();
+            case EntityType::COURSE:       return &CourseCsvParser::columns();
+            case EntityType::ENROLLMENT:   return &EnrollmentRecordCsvParser::columns();
+            case EntityType::COURSERESULT: return &CourseResultCsvParser::columns();
+            case EntityType::FEERECORD:    return &FeeRecordCsvParser::columns();
+            case EntityType::SALARYRECORD: return &SalaryRecordCsvParser::columns();
+            default:                       return nullptr; // LOGIN: không xuất mật khẩu/salt
+        }
+    }
+}
+
+ExportService::ExportService(std::shared_ptr<IStudentDao> studentDao,
+                             std::shared_ptr<ITeacherDao> teacherDao,
+                             std::shared_ptr<IFacultyDao> facultyDao,
+                             std::shared_ptr<ICourseDao> courseDao,
+                             std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                             std::shared_ptr<ICourseResultDao> courseResultDao,
+                             std::shared_ptr<IFeeRecordDao> feeDao,
+                             std::shared_ptr<ISalaryRecordDao> salaryDao,
+                             std::shared_ptr<SessionContext> sessionContext)
+    : _studentDao(std::move(studentDao)),
+      _teacherDao(std::move(teacherDao)),
+      _facultyDao(std::move(facultyDao)),
+      _courseDao(std::move(courseDao)),
+      _enrollmentDao(std::move(enrollmentDao)),
+      _courseResultDao(std::move(courseResultDao)),
+      _feeDao(std::move(feeDao)),
+      _salaryDao(std::move(salaryDao)),
+      _sessionContext(std::move(sessionContext)) {
+    if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null for ExportService.");
+    if (!_teacherDao) throw std::invalid_argument("TeacherDao cannot be null for ExportService.");
+    if (!_facultyDao) throw std::invalid_argument("FacultyDao cannot be null for ExportService.");
+    if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null for ExportService.");
+    if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null for ExportService.");
+    if (!_courseResultDao) throw std::invalid_argument("CourseResultDao cannot be null for ExportService.");
+    if (!_feeDao) throw std::invalid_argument("FeeRecordDao cannot be null for ExportService.");
+    if (!_salaryDao) throw std::invalid_argument("SalaryRecordDao cannot be null for ExportService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for ExportService.");
+}
+
+bool ExportService::isAdminAuthenticated() const {
+    if (!_sessionContext->isAuthenticated()) {
+        return false;
+    }
+    auto roleOpt = _sessionContext->getCurrentUserRole();
+    return roleOpt.has_value() && roleOpt.value() == UserRole::ADMIN;
+}
+
+std::vector<EntityType> ExportService::getExportableTables() const {
+    return {EntityType::STUDENT, EntityType::TEACHER, EntityType::FACULTY, EntityType::COURSE,
+            EntityType::ENROLLMENT, EntityType::COURSERESULT, EntityType::FEERECORD, EntityType::SALARYRECORD};
+}
+
+std::string ExportService::getDefaultFileName(EntityType entityType, ExportFormat format) const {
+    std::string stem;
+    switch (entityType) {
+        case EntityType::STUDENT:      stem = "students"; break;
+        case EntityType::TEACHER:      stem = "teachers"; break;
+        case EntityType::FACULTY:      stem = "faculties"; break;
+        case EntityType::COURSE:       stem = "courses"; break;
+        case EntityType::ENROLLMENT:   stem = "enrollments"; break;
+        case EntityType::COURSERESULT: stem = "course_results"; break;
+        case EntityType::FEERECORD:    stem = "fee_records"; break;
+        case EntityType::SALARYRECORD: stem = "salary_records"; break;
+        case EntityType::LOGIN:        stem = "logins"; break;
+    }
+    return stem + (format == ExportFormat::CSV ? ".csv" : ".jsonl");
+}
+
+ExportTableReport ExportService::runExport(EntityType entityType, const std::string& filePath, ExportFormat format) const {
+    ExportTableReport report;
+    report.entityType = entityType;
+    report.filePath = filePath;
+    auto started = std::chrono::steady_clock::now();
+
+    const std::vector<std::string>* columns = columnsFor(entityType);
+    if (!columns) {
+        report.error = Error{ErrorCode::VALIDATION_ERROR, "Table " + getDefaultFileName(entityType, format) + " cannot be exported."};
+        return report;
+    }
+    auto writerFormat = format == ExportFormat::CSV ? RecordWriter::Format::CSV : RecordWriter::Format::JSON_LINES;
+    auto writerResult = RecordWriter::open(filePath, writerFormat, *columns);
+    if (!writerResult.has_value()) {
+        report.error = writerResult.error();
+        return report;
+    }
+    RecordWriter& writer = writerResult.value();
+
+    std::optional<Error> writeError;
+    std::expected<std::size_t, Error> scan = 0;
+    switch (entityType) {
+        case EntityType::STUDENT:      scan = _studentDao->forEach(recordSink<Student>(writer, writeStudent, writeError)); break;
+        case EntityType::TEACHER:      scan = _teacherDao->forEach(recordSink<Teacher>(writer, writeTeacher, writeError)); break;
+        case EntityType::FACULTY:      scan = _facultyDao->forEach(recordSink<Faculty>(writer, writeFaculty, writeError)); break;
+        case EntityType::COURSE:       scan = _courseDao->forEach(recordSink<Course>(writer, writeCourse, writeError)); break;
+        case EntityType::ENROLLMENT:   scan = _enrollmentDao->forEachEnrollment(recordSink<EnrollmentRecord>(writer, writeEnrollment, writeError)); break;
+        case EntityType::COURSERESULT: scan = _courseResultDao->forEachResult(recordSink<CourseResult>(writer, writeCourseResult, writeError)); break;
+        case EntityType::FEERECORD:    scan = _feeDao->forEach(recordSink<FeeRecord>(writer, writeFeeRecord, writeError)); break;
+        case EntityType::SALARYRECORD: scan = _salaryDao->forEach(recordSink<SalaryRecord>(writer, writeSalaryRecord, writeError)); break;
+        default: break;
+    }
+
+    if (!scan.has_value()) {
+        report.error = scan.error();
+    } else if (writeError) {
+        report.error = writeError;
+    } else {
+        auto closed = writer.close(); // Chỉ thay file đích khi toàn bộ bảng đã được ghi
+        if (!closed.has_value()) report.error = closed.error();
+    }
+    report.rowCount = writer.recordCount();
+    report.writeCount = writer.flushCount();
+    report.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    if (report.error) {
+        LOG_ERROR("ExportService: Export to " + filePath + " failed: " + report.error->message);
+    } else {
+        LOG_INFO("ExportService: Exported " + std::to_string(report.rowCount) + " rows to " + filePath +
+                 " with " + std::to_string(report.writeCount) + " write(s).");
+    }
+    return report;
+}
+
+std::expected<ExportTableReport, Error> ExportService::exportTable(EntityType entityType, const std::string& filePath, ExportFormat format) {
+    if (!isAdminAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can export data."});
+    }
+    if (filePath.empty()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Export file path cannot be empty."});
+    }
+    ExportTableReport report = runExport(entityType, filePath, format);
+    if (report.error) return std::unexpected(*report.error);
+    return report;
+}
+
+std::expected<std::vector<ExportTableReport>, Error> ExportService::exportTables(const std::vector<EntityType>& entityTypes,
+                                                                                const std::string& directory,
+                                                                                ExportFormat format, bool parallel) {
+    if (!isAdminAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can export data."});
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot create export directory " + directory + ": " + ec.message()});
+    }
+
+    std::vector<ExportTableReport> reports(entityTypes.size());
+    auto exportAt = [&](std::size_t i) {
+        std::string filePath = (std::filesystem::path(directory) / getDefaultFileName(entityTypes[i], format)).string();
+        reports[i] = runExport(entityTypes[i], filePath, format);
+    };
+
+    if (parallel && entityTypes.size() > 1) {
+        // Các bảng độc lập với nhau: mỗi bảng một luồng, mỗi luồng ghi vào phần tử báo cáo của riêng nó
+        std::vector<std::thread> workers;
+        workers.reserve(entityTypes.size());
+        for (std::size_t i = 0; i < entityTypes.size(); ++i) {
+            workers.emplace_back(exportAt, i);
+        }
+        for (auto& worker : workers) worker.join();
+    } else {
+        for (std::size_t i = 0; i < entityTypes.size(); ++i) exportAt(i);
+    }
+    return reports;
+}
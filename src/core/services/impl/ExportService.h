@@ -0,0 +1,75 @@
+/**
+ * @file ExportService.h
+ * @brief Triển khai dịch vụ xuất dữ liệu
+ *
+ * ExportService duyệt từng DAO bằng con trỏ đọc theo luồng (forEach) và ghi mỗi
+ * thực thể trực tiếp vào RecordWriter, nên bộ nhớ dùng cho một lần xuất chỉ gồm
+ * bộ đệm ghi, không phụ thuộc số bản ghi.
+ */
+#ifndef EXPORTSERVICE_H
+#define EXPORTSERVICE_H
+
+#include <memory>
+#include "../interface/IExportService.h"
+#include "../../data_access/interface/IStudentDao.h"
+#include "../../data_access/interface/ITeacherDao.h"
+#include "../../data_access/interface/IFacultyDao.h"
+#include "../../data_access/interface/ICourseDao.h"
+#include "../../data_access/interface/IEnrollmentDao.h"
+#include "../../data_access/interface/ICourseResultDao.h"
+#include "../../data_access/interface/IFeeRecordDao.h"
+#include "../../data_access/interface/ISalaryRecordDao.h"
+#include "../SessionContext.h"
+
+/**
+ * @class ExportService
+ * @brief Lớp triển khai dịch vụ xuất dữ liệu (chỉ dành cho quản trị viên)
+ */
+class ExportService : public IExportService {
+private:
+    std::shared_ptr<IStudentDao> _studentDao;           ///< Đối tượng dao để truy cập dữ liệu sinh viên
+    std::shared_ptr<ITeacherDao> _teacherDao;           ///< Đối tượng dao để truy cập dữ liệu giảng viên
+    std::shared_ptr<IFacultyDao> _facultyDao;           ///< Đối tượng dao để truy cập dữ liệu khoa
+    std::shared_ptr<ICourseDao> _courseDao;             ///< Đối tượng dao để truy cập dữ liệu khóa học
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;     ///< Đối tượng dao để truy cập dữ liệu đăng ký khóa học
+    std::shared_ptr<ICourseResultDao> _courseResultDao; ///< Đối tượng dao để truy cập dữ liệu kết quả khóa học
+    std::shared_ptr<IFeeRecordDao> _feeDao;             ///< Đối tượng dao để truy cập dữ liệu học phí
+    std::shared_ptr<ISalaryRecordDao> _salaryDao;       ///< Đối tượng dao để truy cập dữ liệu lương
+    std::shared_ptr<SessionContext> _sessionContext;    ///< Đối tượng quản lý phiên làm việc
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là quản trị viên đã đăng nhập
+     */
+    bool isAdminAuthenticated() const;
+
+    /**
+     * @brief Xuất một bảng (không kiểm tra quyền)
+     */
+    ExportTableReport runExport(EntityType entityType, const std::string& filePath, ExportFormat format) const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo ExportService
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    ExportService(std::shared_ptr<IStudentDao> studentDao,
+                  std::shared_ptr<ITeacherDao> teacherDao,
+                  std::shared_ptr<IFacultyDao> facultyDao,
+                  std::shared_ptr<ICourseDao> courseDao,
+                  std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                  std::shared_ptr<ICourseResultDao> courseResultDao,
+                  std::shared_ptr<IFeeRecordDao> feeDao,
+                  std::shared_ptr<ISalaryRecordDao> salaryDao,
+                  std::shared_ptr<SessionContext> sessionContext);
+
+    ~ExportService() override = default;
+
+    std::vector<EntityType> getExportableTables() const override;
+    std::string getDefaultFileName(EntityType entityType, ExportFormat format) const override;
+    std::expected<ExportTableReport, Error> exportTable(EntityType entityType, const std::string& filePath, ExportFormat format) override;
+    std::expected<std::vector<ExportTableReport>, Error> exportTables(const std::vector<EntityType>& entityTypes,
+                                                                     const std::string& directory,
+                                                                     ExportFormat format, bool parallel) override;
+};
+
+#endif // EXPORTSERVICE_H
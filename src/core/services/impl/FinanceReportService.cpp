@@ -0,0 +1,75 @@
+#include "FinanceReportService.h"
+#include "../../../utils/Logger.h"
+#include <map>
+#include <stdexcept>
+
+FinanceReportService::FinanceReportService(std::shared_ptr<IFinanceReportDao> reportDao,
+                                           std::shared_ptr<SessionContext> sessionContext)
+    : _reportDao(std::move(reportDao)),
+      _sessionContext(std::move(sessionContext)) {
+    if (!_reportDao) throw std::invalid_argument("FinanceReportDao cannot be null for FinanceReportService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for FinanceReportService.");
+}
+
+std::expected<bool, Error> FinanceReportService::requireAdmin() const {
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!_sessionContext->isAuthenticated() || !currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can view finance reports."});
+    }
+    return true;
+}
+
+std::expected<std::vector<FacultyFeeSummary>, Error> FinanceReportService::getFeeSummaryByFacultyAndCohort() {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+
+    // Giữ khóa trong lúc tính để invalidate() không xen giữa truy vấn và lúc lưu đệm
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    if (_feeCache.has_value() && Clock::now() - _feeCache->computedAt < CACHE_TTL) {
+        return _feeCache->rows;
+    }
+    auto computed = _reportDao->sumFeesByFacultyAndCohort();
+    if (!computed.has_value()) return std::unexpected(computed.error());
+    _feeCache = CachedReport<FacultyFeeSummary>{std::move(computed.value()), Clock::now()};
+    LOG_DEBUG("FinanceReportService: Recomputed fee totals (" + std::to_string(_feeCache->rows.size()) + " faculty/cohort groups).");
+    return _feeCache->rows;
+}
+
+std::expected<std::vector<FacultyFeeSummary>, Error> FinanceReportService::getFeeSummaryByFaculty() {
+    auto byCohort = getFeeSummaryByFacultyAndCohort();
+    if (!byCohort.has_value()) return std::unexpected(byCohort.error());
+
+    std::map<std::string, FacultyFeeSummary> totals;
+    for (const auto& summary : byCohort.value()) {
+        FacultyFeeSummary& total = totals[summary.facultyId];
+        total.facultyId = summary.facultyId;
+        total.studentCount += summary.studentCount;
+        total.totalBilled += summary.totalBilled;
+        total.totalPaid += summary.totalPaid;
+    }
+    std::vector<FacultyFeeSummary> summaries;
+    summaries.reserve(totals.size());
+    for (auto& [facultyId, total] : totals) summaries.push_back(std::move(total));
+    return summaries;
+}
+
+std::expected<std::vector<FacultyPayrollSummary>, Error> FinanceReportService::getPayrollByFaculty() {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    if (_payrollCache.has_value() && Clock::now() - _payrollCache->computedAt < CACHE_TTL) {
+        return _payrollCache->rows;
+    }
+    auto computed = _reportDao->sumPayrollByFaculty();
+    if (!computed.has_value()) return std::unexpected(computed.error());
+    _payrollCache = CachedReport<FacultyPayrollSummary>{std::move(computed.value()), Clock::now()};
+    LOG_DEBUG("FinanceReportService: Recomputed payroll totals (" + std::to_string(_payrollCache->rows.size()) + " faculties).");
+    return _payrollCache->rows;
+}
+
+void FinanceReportService::invalidate() {
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    _feeCache.reset();
+    _payrollCache.reset();
+}
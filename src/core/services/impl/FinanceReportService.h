@@ -0,0 +1,67 @@
+/**
+ * @file FinanceReportService.h
+ * @brief Triển khai dịch vụ báo cáo tài chính tổng hợp theo khoa
+ */
+#ifndef FINANCEREPORTSERVICE_H
+#define FINANCEREPORTSERVICE_H
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include "../interface/IFinanceReportService.h"
+#include "../SessionContext.h"
+
+/**
+ * @class FinanceReportService
+ * @brief Lớp triển khai dịch vụ báo cáo tài chính tổng hợp
+ *
+ * Mỗi báo cáo được tính bằng một truy vấn tổng hợp của IFinanceReportDao và lưu đệm cho đến
+ * khi invalidate() được gọi. Thời hạn CACHE_TTL giới hạn độ cũ của số liệu khi dữ liệu được
+ * ghi ngoài các dịch vụ (ví dụ sửa trực tiếp file CSV hoặc CSDL).
+ */
+class FinanceReportService : public IFinanceReportService {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Một báo cáo đã tính cùng thời điểm tính
+     */
+    template<typename TSummary>
+    struct CachedReport {
+        std::vector<TSummary> rows;  ///< Kết quả báo cáo
+        Clock::time_point computedAt; ///< Thời điểm tính
+    };
+
+    std::shared_ptr<IFinanceReportDao> _reportDao;   ///< Đối tượng dao để tính số liệu tổng hợp
+    std::shared_ptr<SessionContext> _sessionContext; ///< Đối tượng quản lý phiên làm việc
+    std::mutex _cacheMutex;                          ///< Bảo vệ các báo cáo đã lưu đệm
+    std::optional<CachedReport<FacultyFeeSummary>> _feeCache;         ///< Học phí theo khoa và khóa
+    std::optional<CachedReport<FacultyPayrollSummary>> _payrollCache; ///< Quỹ lương theo khoa
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin() const;
+
+public:
+    static constexpr std::chrono::minutes CACHE_TTL{5}; ///< Thời gian tối đa dùng lại một báo cáo đã tính
+
+    /**
+     * @brief Hàm khởi tạo FinanceReportService
+     * @param reportDao Đối tượng dao để tính số liệu tổng hợp
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    FinanceReportService(std::shared_ptr<IFinanceReportDao> reportDao,
+                         std::shared_ptr<SessionContext> sessionContext);
+
+    ~FinanceReportService() override = default;
+
+    std::expected<std::vector<FacultyFeeSummary>, Error> getFeeSummaryByFacultyAndCohort() override;
+    std::expected<std::vector<FacultyFeeSummary>, Error> getFeeSummaryByFaculty() override;
+    std::expected<std::vector<FacultyPayrollSummary>, Error> getPayrollByFaculty() override;
+    void invalidate() override;
+};
+
+#endif // FINANCEREPORTSERVICE_H
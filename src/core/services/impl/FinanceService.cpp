@@ -1,8 +1,12 @@
 #include "FinanceService.h"
 #include "../../../utils/Logger.h"
+#include "../../data_access/UnitOfWork.h"
+#include "../InstallmentSchedule.h"
 #include <sstream>   // For receipt/certificate generation
 #include <chrono>    // For date on receipt/certificate
 #include <ctime>     // For date formatting
+#include <iomanip>   // For std::put_time, std::setw, std::setfill
+#include <random>    // For generated idempotency keys
 
 // Helper function for current date string
 std::string getCurrentDateString() {
@@ -19,6 +23,16 @@ std::string getCurrentDateString() {
     return oss.str();
 }
 
+namespace {
+    // Khóa idempotency cho các lần thanh toán mà phía gửi không tự tạo khóa
+    std::string generatePaymentKey() {
+        static thread_local std::mt19937_64 generator(std::random_device{}());
+        std::ostringstream oss;
+        oss << "pay-" << std::hex << std::setfill('0') << std::setw(16) << generator() << std::setw(16) << generator();
+        return oss.str();
+    }
+}
+
 
 FinanceService::FinanceService(
     std::shared_ptr<IFeeRecordDao> feeDao,
@@ -27,20 +41,29 @@ FinanceService::FinanceService(
     std::shared_ptr<ITeacherDao> teacherDao,
     std::shared_ptr<IFacultyDao> facultyDao,
     std::shared_ptr<IGeneralInputValidator> inputValidator,
-    std::shared_ptr<SessionContext> sessionContext)
+    std::shared_ptr<SessionContext> sessionContext,
+    std::shared_ptr<IFinanceReportService> reportService,
+    std::shared_ptr<IInstallmentDao> installmentDao,
+    std::shared_ptr<ITransactionManager> transactionManager)
     : _feeDao(std::move(feeDao)),
       _salaryDao(std::move(salaryDao)),
       _studentDao(std::move(studentDao)),
       _teacherDao(std::move(teacherDao)),
       _facultyDao(std::move(facultyDao)),
       _inputValidator(std::move(inputValidator)),
-      _sessionContext(std::move(sessionContext)) {
+      _sessionContext(std::move(sessionContext)),
+      _reportService(std::move(reportService)),
+      _installmentDao(std::move(installmentDao)),
+      _transactionManager(std::move(transactionManager)) {
     if (!_feeDao) throw std::invalid_argument("FeeRecordDao cannot be null.");
     if (!_salaryDao) throw std::invalid_argument("SalaryRecordDao cannot be null.");
     if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null.");
     if (!_teacherDao) throw std::invalid_argument("TeacherDao cannot be null.");
     if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null.");
     if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null.");
+    if (!_reportService) throw std::invalid_argument("FinanceReportService cannot be null.");
+    if (!_installmentDao) throw std::invalid_argument("InstallmentDao cannot be null.");
+    if (!_transactionManager) throw std::invalid_argument("TransactionManager cannot be null.");
 }
 
 // --- Fee Operations ---
@@ -63,6 +86,14 @@ std::expected<FeeRecord, Error> FinanceService::getStudentFeeRecord(const std::s
 }
 
 std::expected<bool, Error> FinanceService::makeFeePayment(const std::string& studentId, long amount) {
+    return makeFeePayment(studentId, amount, generatePaymentKey());
+}
+
+std::string FinanceService::newPaymentKey() const {
+    return generatePaymentKey();
+}
+
+std::expected<bool, Error> FinanceService::makeFeePayment(const std::string& studentId, long amount, const std::string& idempotencyKey) {
     if (!_sessionContext->isAuthenticated()){
          return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
     }
@@ -82,21 +113,46 @@ std::expected<bool, Error> FinanceService::makeFeePayment(const std::string& stu
     if (amount <= 0) {
         return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Payment amount must be positive."});
     }
+    if (idempotencyKey.empty()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Payment idempotency key is required."});
+    }
 
-    auto feeRecordExp = _feeDao->getById(studentId);
-    if (!feeRecordExp.has_value()) {
-        return std::unexpected(feeRecordExp.error());
+    // Sổ cái và lịch trả góp được ghi trong cùng một transaction để không bao giờ lệch nhau
+    auto unitOfWork = UnitOfWork::begin(_transactionManager);
+    if (!unitOfWork.has_value()) return std::unexpected(unitOfWork.error());
+
+    // Ghi sổ cái và cộng học phí đã đóng trong một lần ghi của DAO, không đọc-sửa-ghi FeeRecord
+    FeePayment payment{idempotencyKey, studentId, amount,
+                       std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count()};
+    auto recordResult = _feeDao->recordPayment(payment);
+    if (!recordResult.has_value()) {
+        return std::unexpected(recordResult.error());
     }
-    FeeRecord record = feeRecordExp.value();
-    if (!record.makePayment(amount)) {
-        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Payment amount exceeds due fee or is invalid."});
+
+    // Phân bổ theo tổng đã đóng (không theo từng khoản) nên gọi lại khi thử lại là vô hại
+    auto paidRecord = _feeDao->getById(studentId);
+    if (!paidRecord.has_value()) return std::unexpected(paidRecord.error());
+    auto allocated = _installmentDao->allocatePaid(studentId, paidRecord->getPaidFee());
+    if (!allocated.has_value()) {
+        LOG_ERROR("Fee payment for student " + studentId + " rolled back: installments could not be reallocated: " + allocated.error().message);
+        return std::unexpected(allocated.error());
     }
-    
-    auto updateResult = _feeDao->update(record);
-    if (updateResult.has_value() && updateResult.value()) {
+    auto committed = unitOfWork->commit();
+    if (!committed.has_value()) return std::unexpected(committed.error());
+
+    if (recordResult.value()) {
+        _reportService->invalidate();
         LOG_INFO("Fee payment of " + std::to_string(amount) + " made for student " + studentId);
+    } else {
+        LOG_INFO("Fee payment '" + idempotencyKey + "' for student " + studentId + " was already recorded; not applied again.");
     }
-    return updateResult;
+    return true;
+}
+
+std::expected<std::vector<FeePayment>, Error> FinanceService::getFeePayments(const std::string& studentId) const {
+    auto feeRecord = getStudentFeeRecord(studentId); // Kiểm tra quyền và định dạng ID như khi xem học phí
+    if (!feeRecord.has_value()) return std::unexpected(feeRecord.error());
+    return _feeDao->getPayments(studentId);
 }
 
 std::expected<bool, Error> FinanceService::setStudentTotalFee(const std::string& studentId, long newTotalFee) {
@@ -113,17 +169,31 @@ std::expected<bool, Error> FinanceService::setStudentTotalFee(const std::string&
     if (!feeRecordExp.has_value()) {
         // Nếu chưa có record, tạo mới
         FeeRecord newRecord(studentId, newTotalFee);
-        return _feeDao->add(newRecord).has_value(); // true if add successful
+        bool added = _feeDao->add(newRecord).has_value(); // true if add successful
+        if (added) _reportService->invalidate();
+        return added;
     }
     FeeRecord record = feeRecordExp.value();
     if (!record.setTotalFee(newTotalFee)) { // setTotalFee có thể fail nếu paidFee > newTotalFee
          return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Could not set total fee (e.g., new total fee is less than already paid amount)."});
     }
-    
+
+    // Lịch trả góp được chia lại theo tổng mới trong cùng transaction với học phí
+    auto unitOfWork = UnitOfWork::begin(_transactionManager);
+    if (!unitOfWork.has_value()) return std::unexpected(unitOfWork.error());
     auto updateResult = _feeDao->update(record);
-    if (updateResult.has_value() && updateResult.value()) {
-        LOG_INFO("Total fee for student " + studentId + " set to " + std::to_string(newTotalFee));
+    if (!updateResult.has_value() || !updateResult.value()) return updateResult;
+    auto schedule = _installmentDao->getByStudent(studentId);
+    if (!schedule.has_value()) return std::unexpected(schedule.error());
+    if (!schedule->empty() && InstallmentSchedule::totalOf(schedule.value()) != newTotalFee) {
+        auto replaced = _installmentDao->replaceSchedule(studentId, InstallmentSchedule::rescale(schedule.value(), newTotalFee, record.getPaidFee()));
+        if (!replaced.has_value()) return replaced;
     }
+    auto committed = unitOfWork->commit();
+    if (!committed.has_value()) return committed;
+
+    _reportService->invalidate();
+    LOG_INFO("Total fee for student " + studentId + " set to " + std::to_string(newTotalFee));
     return updateResult;
 }
 
@@ -150,6 +220,7 @@ std::expected<bool, Error> FinanceService::createInitialFeeRecord(const std::str
     FeeRecord newRecord(studentId, initialTotalFee, 0);
     auto addResult = _feeDao->add(newRecord);
     if (addResult.has_value()) {
+        _reportService->invalidate();
         LOG_INFO("Initial fee record created for student " + studentId + " with total fee " + std::to_string(initialTotalFee));
         return true;
     }
@@ -217,13 +288,16 @@ std::expected<bool, Error> FinanceService::setTeacherBasicSalary(const std::stri
     if (!salaryRecordExp.has_value()) {
         // Nếu chưa có, tạo mới
         SalaryRecord newRecord(teacherId, newBasicMonthlyPay);
-        return _salaryDao->add(newRecord).has_value();
+        bool added = _salaryDao->add(newRecord).has_value();
+        if (added) _reportService->invalidate();
+        return added;
     }
     SalaryRecord record = salaryRecordExp.value();
     record.setBasicMonthlyPay(newBasicMonthlyPay);
     
     auto updateResult = _salaryDao->update(record);
     if (updateResult.has_value() && updateResult.value()) {
+        _reportService->invalidate();
         LOG_INFO("Basic salary for teacher " + teacherId + " set to " + std::to_string(newBasicMonthlyPay));
     }
     return updateResult;
@@ -252,6 +326,7 @@ std::expected<bool, Error> FinanceService::createInitialSalaryRecord(const std::
     SalaryRecord newRecord(teacherId, initialBasicPay);
     auto addResult = _salaryDao->add(newRecord);
     if (addResult.has_value()) {
+        _reportService->invalidate();
         LOG_INFO("Initial salary record created for teacher " + teacherId + " with basic pay " + std::to_string(initialBasicPay));
         return true;
     }
@@ -9,11 +9,14 @@
 #define FINANCESERVICE_H
 
 #include "../interface/IFinanceService.h"
+#include "../interface/IFinanceReportService.h"
 #include "../../data_access/interface/IFeeRecordDao.h"
+#include "../../data_access/interface/IInstallmentDao.h"
 #include "../../data_access/interface/ISalaryRecordDao.h"
 #include "../../data_access/interface/IStudentDao.h" // Để lấy thông tin SV cho receipt
 #include "../../data_access/interface/ITeacherDao.h" // Để lấy thông tin GV cho certificate
 #include "../../data_access/interface/IFacultyDao.h" // Để lấy thông tin khoa cho certificate
+#include "../../data_access/interface/ITransactionManager.h"
 #include "../../validators/interface/IValidator.h"
 #include "../SessionContext.h"
 #include <iomanip> // For setprecision in receipt/certificate
@@ -34,6 +37,9 @@ private:
     std::shared_ptr<IFacultyDao> _facultyDao;         ///< Đối tượng dao để truy cập dữ liệu khoa
     std::shared_ptr<IGeneralInputValidator> _inputValidator; ///< Đối tượng validator để kiểm tra đầu vào
     std::shared_ptr<SessionContext> _sessionContext;  ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<IFinanceReportService> _reportService; ///< Báo cáo tổng hợp cần làm mới sau mỗi lần ghi
+    std::shared_ptr<IInstallmentDao> _installmentDao; ///< Lịch trả góp được phân bổ lại sau mỗi lần thanh toán
+    std::shared_ptr<ITransactionManager> _transactionManager; ///< Ghi học phí và lịch trả góp trong cùng transaction
 
 public:
     /**
@@ -45,6 +51,9 @@ public:
      * @param facultyDao Đối tượng dao để truy cập dữ liệu khoa
      * @param inputValidator Đối tượng validator để kiểm tra đầu vào
      * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param reportService Dịch vụ báo cáo tổng hợp (bỏ lưu đệm sau mỗi lần ghi học phí/lương)
+     * @param installmentDao Đối tượng dao cho lịch trả góp (phân bổ tiền đã đóng vào các đợt)
+     * @param transactionManager Bộ quản lý transaction của nguồn dữ liệu
      */
     FinanceService(std::shared_ptr<IFeeRecordDao> feeDao,
                    std::shared_ptr<ISalaryRecordDao> salaryDao,
@@ -52,7 +61,10 @@ public:
                    std::shared_ptr<ITeacherDao> teacherDao,
                    std::shared_ptr<IFacultyDao> facultyDao,
                    std::shared_ptr<IGeneralInputValidator> inputValidator,
-                   std::shared_ptr<SessionContext> sessionContext);
+                   std::shared_ptr<SessionContext> sessionContext,
+                   std::shared_ptr<IFinanceReportService> reportService,
+                   std::shared_ptr<IInstallmentDao> installmentDao,
+                   std::shared_ptr<ITransactionManager> transactionManager);
     
     /**
      * @brief Hàm hủy ảo mặc định
@@ -71,6 +83,23 @@ public:
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<bool, Error> makeFeePayment(const std::string& studentId, long amount) override;
+
+    /**
+     * @brief Thực hiện thanh toán học phí với khóa idempotency
+     * @param studentId ID của sinh viên
+     * @param amount Số tiền thanh toán
+     * @param idempotencyKey Khóa duy nhất của lần thanh toán
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    std::expected<bool, Error> makeFeePayment(const std::string& studentId, long amount, const std::string& idempotencyKey) override;
+    std::string newPaymentKey() const override;
+
+    /**
+     * @brief Lấy lịch sử thanh toán học phí của sinh viên
+     * @param studentId ID của sinh viên
+     * @return Danh sách thanh toán, hoặc Error nếu thất bại
+     */
+    std::expected<std::vector<FeePayment>, Error> getFeePayments(const std::string& studentId) const override;
     
     /**
      * @brief Thiết lập tổng học phí mới cho sinh viên
@@ -0,0 +1,181 @@
+#include "GraduationAuditService.h"
+#include "../../../utils/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+GraduationAuditService::GraduationAuditService(std::shared_ptr<IDegreeRequirementDao> degreeRequirementDao,
+                                               std::shared_ptr<IStudentDao> studentDao,
+                                               std::shared_ptr<ICourseDao> courseDao,
+                                               std::shared_ptr<ICourseResultDao> courseResultDao,
+                                               std::shared_ptr<IFacultyDao> facultyDao,
+                                               std::shared_ptr<IGeneralInputValidator> inputValidator,
+                                               std::shared_ptr<SessionContext> sessionContext)
+    : _degreeRequirementDao(std::move(degreeRequirementDao)),
+      _studentDao(std::move(studentDao)),
+      _courseDao(std::move(courseDao)),
+      _courseResultDao(std::move(courseResultDao)),
+      _facultyDao(std::move(facultyDao)),
+      _inputValidator(std::move(inputValidator)),
+      _sessionContext(std::move(sessionContext)) {
+    if (!_degreeRequirementDao) throw std::invalid_argument("DegreeRequirementDao cannot be null for GraduationAuditService.");
+    if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null for GraduationAuditService.");
+    if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null for GraduationAuditService.");
+    if (!_courseResultDao) throw std::invalid_argument("CourseResultDao cannot be null for GraduationAuditService.");
+    if (!_facultyDao) throw std::invalid_argument("FacultyDao cannot be null for GraduationAuditService.");
+    if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null for GraduationAuditService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for GraduationAuditService.");
+}
+
+std::expected<bool, Error> GraduationAuditService::requireAdmin(const std::string& action) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can " + action + "."});
+    }
+    return true;
+}
+
+std::expected<bool, Error> GraduationAuditService::setDegreeRequirement(const DegreeRequirement& requirement) {
+    auto allowed = requireAdmin("set degree requirements");
+    if (!allowed.has_value()) return allowed;
+
+    ValidationResult facultyIdVr = _inputValidator->validateIdFormat(requirement.facultyId, "Faculty ID");
+    if (!facultyIdVr.isValid) return std::unexpected(facultyIdVr.errors[0]);
+    if (requirement.minTotalCredits < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Minimum total credits cannot be negative."});
+    }
+    if (requirement.minCgpa < 0.0 || requirement.minCgpa > 4.0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Minimum CGPA must be between 0 and 4."});
+    }
+    auto facultyExists = _facultyDao->exists(requirement.facultyId);
+    if (!facultyExists.has_value()) return std::unexpected(facultyExists.error());
+    if (!facultyExists.value()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Faculty " + requirement.facultyId + " not found."});
+    }
+
+    // Bỏ khóa học trùng để bitset và báo cáo không đếm một môn hai lần
+    DegreeRequirement normalized = requirement;
+    std::sort(normalized.requiredCourseIds.begin(), normalized.requiredCourseIds.end());
+    normalized.requiredCourseIds.erase(std::unique(normalized.requiredCourseIds.begin(), normalized.requiredCourseIds.end()),
+                                       normalized.requiredCourseIds.end());
+    for (const auto& courseId : normalized.requiredCourseIds) {
+        ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+        if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+        auto courseExists = _courseDao->exists(courseId);
+        if (!courseExists.has_value()) return std::unexpected(courseExists.error());
+        if (!courseExists.value()) {
+            return std::unexpected(Error{ErrorCode::NOT_FOUND, "Required course " + courseId + " not found."});
+        }
+    }
+
+    auto saved = _degreeRequirementDao->upsert(normalized);
+    if (!saved.has_value()) return saved;
+    LOG_INFO("Degree requirement of faculty " + normalized.facultyId + " set: " + std::to_string(normalized.minTotalCredits) +
+             " credits, " + std::to_string(normalized.requiredCourseIds.size()) + " required courses.");
+    return true;
+}
+
+std::expected<bool, Error> GraduationAuditService::removeDegreeRequirement(const std::string& facultyId) {
+    auto allowed = requireAdmin("remove degree requirements");
+    if (!allowed.has_value()) return allowed;
+    return _degreeRequirementDao->remove(facultyId);
+}
+
+std::expected<std::vector<DegreeRequirement>, Error> GraduationAuditService::getDegreeRequirements() const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    return _degreeRequirementDao->getAll();
+}
+
+std::expected<GraduationAuditReport, Error> GraduationAuditService::runGraduationAudit() const {
+    auto allowed = requireAdmin("run the graduation audit");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+
+    auto requirements = _degreeRequirementDao->getAll();
+    if (!requirements.has_value()) return std::unexpected(requirements.error());
+
+    // Mỗi bảng chỉ duyệt một lần: khóa học -> chỉ số dày đặc, sinh viên -> bảng điểm, kết quả -> điểm
+    std::vector<std::string> courseIds;
+    std::vector<int> credits;
+    std::unordered_map<std::string, std::uint32_t> courseIndex;
+    auto coursesVisited = _courseDao->forEach([&](const Course& course) {
+        courseIndex.emplace(course.getId(), static_cast<std::uint32_t>(courseIds.size()));
+        courseIds.push_back(course.getId());
+        credits.push_back(course.getCredits());
+        return true;
+    });
+    if (!coursesVisited.has_value()) return std::unexpected(coursesVisited.error());
+
+    std::vector<StudentTranscript> transcripts;
+    std::unordered_map<std::string, std::size_t> studentIndex;
+    auto studentsVisited = _studentDao->forEach([&](const Student& student) {
+        studentIndex.emplace(student.getId(), transcripts.size());
+        transcripts.push_back(StudentTranscript{student.getId(), student.getFacultyId(), {}});
+        return true;
+    });
+    if (!studentsVisited.has_value()) return std::unexpected(studentsVisited.error());
+
+    auto resultsVisited = _courseResultDao->forEachResult([&](const CourseResult& result) {
+        auto studentIt = studentIndex.find(result.getStudentId());
+        auto courseIt = courseIndex.find(result.getCourseId());
+        if (studentIt != studentIndex.end() && courseIt != courseIndex.end()) {
+            transcripts[studentIt->second].marks.emplace_back(courseIt->second, result.getMarks());
+        }
+        return true;
+    });
+    if (!resultsVisited.has_value()) return std::unexpected(resultsVisited.error());
+
+    GraduationAuditor auditor(std::move(courseIds), std::move(credits), requirements.value());
+    GraduationAuditReport report;
+    report.entries = auditor.auditAll(transcripts);
+    report.eligibleCount = static_cast<std::size_t>(std::count_if(report.entries.begin(), report.entries.end(),
+                                                                  [](const GraduationAuditEntry& entry) { return entry.eligible; }));
+    LOG_INFO("Graduation audit: " + std::to_string(report.eligibleCount) + " of " + std::to_string(report.entries.size()) +
+             " students eligible.");
+    return report;
+}
+
+std::expected<GraduationAuditEntry, Error> GraduationAuditService::auditStudent(const std::string& studentId) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    auto currentUserId = _sessionContext->getCurrentUserId();
+    if (!currentRole.has_value() ||
+        (currentRole.value() != UserRole::ADMIN &&
+         (currentRole.value() != UserRole::STUDENT || !currentUserId.has_value() || currentUserId.value() != studentId))) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to view graduation audit."});
+    }
+    ValidationResult studentIdVr = _inputValidator->validateIdFormat(studentId, "Student ID");
+    if (!studentIdVr.isValid) return std::unexpected(studentIdVr.errors[0]);
+
+    auto student = _studentDao->getById(studentId);
+    if (!student.has_value()) return std::unexpected(student.error());
+    auto requirements = _degreeRequirementDao->getAll();
+    if (!requirements.has_value()) return std::unexpected(requirements.error());
+    std::erase_if(requirements.value(), [&](const DegreeRequirement& requirement) {
+        return requirement.facultyId != student->getFacultyId();
+    });
+    auto results = _courseResultDao->findByStudentId(studentId);
+    if (!results.has_value()) return std::unexpected(results.error());
+
+    // Chỉ cần các khóa học có kết quả; môn bắt buộc chưa học không có chỉ số nên luôn được coi là chưa qua
+    std::vector<std::string> courseIds;
+    std::vector<int> credits;
+    StudentTranscript transcript{studentId, student->getFacultyId(), {}};
+    for (const auto& result : results.value()) {
+        auto course = _courseDao->getById(result.getCourseId());
+        if (!course.has_value()) {
+            LOG_WARN("Graduation audit: Course " + result.getCourseId() + " not found for student " + studentId);
+            continue;
+        }
+        transcript.marks.emplace_back(static_cast<std::uint32_t>(courseIds.size()), result.getMarks());
+        courseIds.push_back(course->getId());
+        credits.push_back(course->getCredits());
+    }
+    return GraduationAuditor(std::move(courseIds), std::move(credits), requirements.value()).audit(transcript);
+}
@@ -0,0 +1,68 @@
+/**
+ * @file GraduationAuditService.h
+ * @brief Triển khai dịch vụ xét điều kiện tốt nghiệp
+ */
+#ifndef GRADUATIONAUDITSERVICE_H
+#define GRADUATIONAUDITSERVICE_H
+
+#include <memory>
+#include "../interface/IGraduationAuditService.h"
+#include "../../data_access/interface/IDegreeRequirementDao.h"
+#include "../../data_access/interface/IStudentDao.h"
+#include "../../data_access/interface/ICourseDao.h"
+#include "../../data_access/interface/ICourseResultDao.h"
+#include "../../data_access/interface/IFacultyDao.h"
+#include "../../validators/interface/IValidator.h"
+#include "../SessionContext.h"
+
+/**
+ * @class GraduationAuditService
+ * @brief Lớp triển khai dịch vụ xét tốt nghiệp
+ *
+ * Khi xét toàn bộ, sinh viên, khóa học và kết quả học tập mỗi loại chỉ được duyệt một lần để dựng
+ * bảng điểm rút gọn theo chỉ số dày đặc, sau đó GraduationAuditor xét song song.
+ */
+class GraduationAuditService : public IGraduationAuditService {
+private:
+    std::shared_ptr<IDegreeRequirementDao> _degreeRequirementDao; ///< Đối tượng dao cho điều kiện tốt nghiệp
+    std::shared_ptr<IStudentDao> _studentDao;                     ///< Đối tượng dao cho sinh viên
+    std::shared_ptr<ICourseDao> _courseDao;                       ///< Đối tượng dao cho khóa học
+    std::shared_ptr<ICourseResultDao> _courseResultDao;           ///< Đối tượng dao cho kết quả học tập
+    std::shared_ptr<IFacultyDao> _facultyDao;                     ///< Đối tượng dao cho khoa
+    std::shared_ptr<IGeneralInputValidator> _inputValidator;      ///< Đối tượng validator để kiểm tra đầu vào
+    std::shared_ptr<SessionContext> _sessionContext;              ///< Đối tượng quản lý phiên làm việc
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin(const std::string& action) const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo GraduationAuditService
+     * @param degreeRequirementDao Đối tượng dao cho điều kiện tốt nghiệp
+     * @param studentDao Đối tượng dao cho sinh viên
+     * @param courseDao Đối tượng dao cho khóa học
+     * @param courseResultDao Đối tượng dao cho kết quả học tập
+     * @param facultyDao Đối tượng dao cho khoa
+     * @param inputValidator Đối tượng validator để kiểm tra đầu vào
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     */
+    GraduationAuditService(std::shared_ptr<IDegreeRequirementDao> degreeRequirementDao,
+                           std::shared_ptr<IStudentDao> studentDao,
+                           std::shared_ptr<ICourseDao> courseDao,
+                           std::shared_ptr<ICourseResultDao> courseResultDao,
+                           std::shared_ptr<IFacultyDao> facultyDao,
+                           std::shared_ptr<IGeneralInputValidator> inputValidator,
+                           std::shared_ptr<SessionContext> sessionContext);
+
+    ~GraduationAuditService() override = default;
+
+    std::expected<bool, Error> setDegreeRequirement(const DegreeRequirement& requirement) override;
+    std::expected<bool, Error> removeDegreeRequirement(const std::string& facultyId) override;
+    std::expected<std::vector<DegreeRequirement>, Error> getDegreeRequirements() const override;
+    std::expected<GraduationAuditReport, Error> runGraduationAudit() const override;
+    std::expected<GraduationAuditEntry, Error> auditStudent(const std::string& studentId) const override;
+};
+
+#endif // GRADUATIONAUDITSERVICE_H
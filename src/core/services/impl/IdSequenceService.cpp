@@ -0,0 +1,142 @@
+#include "IdSequenceService.h"
+#include "../../../utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <charconv>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace {
+    constexpr std::size_t SEQUENCE_DIGITS = 4; // Số chữ số của phần số thứ tự trong mã sinh viên
+}
+
+IdSequenceService::IdSequenceService(std::shared_ptr<ISequenceDao> sequenceDao,
+                                     std::shared_ptr<IStudentDao> studentDao,
+                                     std::shared_ptr<ITeacherDao> teacherDao)
+    : _sequenceDao(std::move(sequenceDao)),
+      _studentDao(std::move(studentDao)),
+      _teacherDao(std::move(teacherDao)) {
+    if (!_sequenceDao) throw std::invalid_argument("SequenceDao cannot be null for IdSequenceService.");
+    if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null for IdSequenceService.");
+    if (!_teacherDao) throw std::invalid_argument("TeacherDao cannot be null for IdSequenceService.");
+}
+
+std::string IdSequenceService::studentIdPrefix(const std::string& facultyId) const {
+    auto now_c = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm now_tm = {};
+    #if defined(_WIN32) || defined(_WIN64)
+        localtime_s(&now_tm, &now_c);
+    #else
+        localtime_r(&now_c, &now_tm);
+    #endif
+    return std::to_string((now_tm.tm_year + 1900) % 100) + facultyId;
+}
+
+std::expected<std::unordered_map<std::string, int>, Error> IdSequenceService::scanLastSequences(std::size_t& scannedUsers) const {
+    // Mã sinh viên và giảng viên dùng chung không gian ID (bảng Users), nên duyệt cả hai
+    std::unordered_map<std::string, int> lastSequenceOfPrefix;
+    auto collectId = [&lastSequenceOfPrefix](const std::string& id) {
+        if (id.size() <= SEQUENCE_DIGITS) return true;
+        int sequence = 0;
+        const char* suffix = id.data() + id.size() - SEQUENCE_DIGITS;
+        auto [end, ec] = std::from_chars(suffix, id.data() + id.size(), sequence);
+        if (ec != std::errc() || end != id.data() + id.size()) return true;
+        int& last = lastSequenceOfPrefix[id.substr(0, id.size() - SEQUENCE_DIGITS)];
+        last = std::max(last, sequence);
+        return true;
+    };
+    auto studentScan = _studentDao->forEach([&](const Student& student) { return collectId(student.getId()); });
+    if (!studentScan.has_value()) return std::unexpected(studentScan.error());
+    auto teacherScan = _teacherDao->forEach([&](const Teacher& teacher) { return collectId(teacher.getId()); });
+    if (!teacherScan.has_value()) return std::unexpected(teacherScan.error());
+    scannedUsers = studentScan.value() + teacherScan.value();
+    return lastSequenceOfPrefix;
+}
+
+std::expected<std::size_t, Error> IdSequenceService::rebuildFromExistingIds() {
+    std::size_t scannedUsers = 0;
+    auto scanned = scanLastSequences(scannedUsers);
+    if (!scanned.has_value()) return std::unexpected(scanned.error());
+    const auto& lastSequenceOfPrefix = scanned.value();
+
+    for (const auto& [prefix, last] : lastSequenceOfPrefix) {
+        auto raised = _sequenceDao->raiseTo(prefix, last);
+        if (!raised.has_value()) return std::unexpected(raised.error());
+        _readyPrefixes.insert(prefix);
+    }
+    LOG_INFO("IdSequenceService: Rebuilt " + std::to_string(lastSequenceOfPrefix.size()) + " ID sequences from " +
+             std::to_string(scannedUsers) + " existing users.");
+    return lastSequenceOfPrefix.size();
+}
+
+std::expected<bool, Error> IdSequenceService::ensureSequence(const std::string& idPrefix) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_readyPrefixes.contains(idPrefix)) return true;
+
+    auto current = _sequenceDao->getValue(idPrefix);
+    if (!current.has_value()) {
+        if (current.error().code != ErrorCode::NOT_FOUND) return std::unexpected(current.error());
+        auto stored = _sequenceDao->count();
+        if (!stored.has_value()) return std::unexpected(stored.error());
+        int seed = 0;
+        if (stored.value() == 0) {
+            auto rebuilt = rebuildFromExistingIds();
+            if (!rebuilt.has_value()) return std::unexpected(rebuilt.error());
+        } else {
+            // Bảng đã có bộ đếm khác: tiền tố này vẫn có thể đã được dùng (ví dụ mã giảng viên do admin tự đặt)
+            std::size_t scannedUsers = 0;
+            auto scanned = scanLastSequences(scannedUsers);
+            if (!scanned.has_value()) return std::unexpected(scanned.error());
+            if (auto it = scanned->find(idPrefix); it != scanned->end()) seed = it->second;
+        }
+        // Không làm giảm nếu vừa được dựng lại hoặc tiến trình khác đã tạo bộ đếm
+        auto created = _sequenceDao->raiseTo(idPrefix, seed);
+        if (!created.has_value()) return std::unexpected(created.error());
+    }
+    _readyPrefixes.insert(idPrefix);
+    return true;
+}
+
+std::expected<std::string, Error> IdSequenceService::nextStudentId(const std::string& idPrefix) {
+    auto block = reserveStudentIds(idPrefix, 1);
+    if (!block.has_value()) return std::unexpected(block.error());
+    return block->idAt(0);
+}
+
+std::expected<StudentIdBlock, Error> IdSequenceService::reserveStudentIds(const std::string& idPrefix, std::size_t count) {
+    if (count == 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Number of student IDs to reserve must be positive."});
+    }
+    auto ready = ensureSequence(idPrefix);
+    if (!ready.has_value()) return std::unexpected(ready.error());
+
+    long long amount = static_cast<long long>(std::min<std::size_t>(count, MAX_STUDENT_SEQUENCE));
+    auto last = _sequenceDao->advance(idPrefix, amount);
+    if (!last.has_value()) return std::unexpected(last.error());
+    if (last.value() > MAX_STUDENT_SEQUENCE) {
+        // Trả lại phần vượt quá để bộ đếm dừng ở số lớn nhất; phép trừ giao hoán nên vẫn đúng khi có lần giữ chỗ đồng thời
+        long long excess = std::min(last.value() - MAX_STUDENT_SEQUENCE, amount);
+        auto released = _sequenceDao->advance(idPrefix, -excess);
+        if (!released.has_value()) LOG_ERROR("IdSequenceService: Failed to release sequence '" + idPrefix + "': " + released.error().message);
+        if (excess == amount) {
+            return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "Student ID sequence exhausted for prefix " + idPrefix + "."});
+        }
+        amount -= excess;
+        last = last.value() - excess;
+    }
+
+    StudentIdBlock block;
+    block.prefix = idPrefix;
+    block.last = static_cast<int>(last.value());
+    block.first = block.last - static_cast<int>(amount) + 1;
+    return block;
+}
+
+std::expected<std::size_t, Error> IdSequenceService::ensureInitialized() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto stored = _sequenceDao->count();
+    if (!stored.has_value()) return std::unexpected(stored.error());
+    if (stored.value() > 0) return 0;
+    return rebuildFromExistingIds();
+}
@@ -0,0 +1,67 @@
+/**
+ * @file IdSequenceService.h
+ * @brief Triển khai dịch vụ cấp phát mã sinh viên theo bộ đếm
+ *
+ * Bộ đếm của mỗi tiền tố được tạo khi dùng lần đầu: nếu bảng Sequences còn trống thì
+ * toàn bộ bộ đếm được dựng lại bằng một lần duyệt sinh viên và giảng viên, lấy số thứ tự
+ * lớn nhất đang dùng của mỗi tiền tố.
+ */
+#ifndef IDSEQUENCESERVICE_H
+#define IDSEQUENCESERVICE_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include "../interface/IIdSequenceService.h"
+#include "../../data_access/interface/ISequenceDao.h"
+#include "../../data_access/interface/IStudentDao.h"
+#include "../../data_access/interface/ITeacherDao.h"
+
+/**
+ * @class IdSequenceService
+ * @brief Lớp triển khai dịch vụ cấp phát mã sinh viên
+ */
+class IdSequenceService : public IIdSequenceService {
+private:
+    std::shared_ptr<ISequenceDao> _sequenceDao; ///< Đối tượng dao để truy cập bộ đếm
+    std::shared_ptr<IStudentDao> _studentDao;   ///< Đối tượng dao để đọc mã sinh viên đang tồn tại
+    std::shared_ptr<ITeacherDao> _teacherDao;   ///< Đối tượng dao để đọc mã giảng viên đang tồn tại
+    std::mutex _mutex;                          ///< Bảo vệ việc tạo bộ đếm và _readyPrefixes
+    std::unordered_set<std::string> _readyPrefixes; ///< Các tiền tố đã chắc chắn có bộ đếm
+
+    /**
+     * @brief Duyệt sinh viên và giảng viên, lấy số thứ tự lớn nhất đang dùng của mỗi tiền tố
+     * @param scannedUsers Nhận số người dùng đã duyệt
+     */
+    std::expected<std::unordered_map<std::string, int>, Error> scanLastSequences(std::size_t& scannedUsers) const;
+
+    /**
+     * @brief Duyệt sinh viên và giảng viên, nâng bộ đếm của mỗi tiền tố lên số thứ tự lớn nhất đang dùng
+     * @return Số tiền tố tìm thấy
+     */
+    std::expected<std::size_t, Error> rebuildFromExistingIds();
+
+    /**
+     * @brief Bảo đảm tiền tố đã có bộ đếm trước khi tăng
+     */
+    std::expected<bool, Error> ensureSequence(const std::string& idPrefix);
+
+public:
+    /**
+     * @brief Hàm khởi tạo IdSequenceService
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    IdSequenceService(std::shared_ptr<ISequenceDao> sequenceDao,
+                      std::shared_ptr<IStudentDao> studentDao,
+                      std::shared_ptr<ITeacherDao> teacherDao);
+
+    ~IdSequenceService() override = default;
+
+    std::string studentIdPrefix(const std::string& facultyId) const override;
+    std::expected<std::string, Error> nextStudentId(const std::string& idPrefix) override;
+    std::expected<StudentIdBlock, Error> reserveStudentIds(const std::string& idPrefix, std::size_t count) override;
+    std::expected<std::size_t, Error> ensureInitialized() override;
+};
+
+#endif // IDSEQUENCESERVICE_H
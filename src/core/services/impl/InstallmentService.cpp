@@ -0,0 +1,189 @@
+#include "InstallmentService.h"
+#include "../../../utils/Logger.h"
+#include "../../../utils/DateUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <optional>
+#include <stdexcept>
+
+namespace {
+    std::optional<std::chrono::year_month_day> parseIsoDate(const std::string& text) {
+        int year = 0;
+        unsigned month = 0, day = 0;
+        char extra = 0;
+        if (text.size() != 10 || std::sscanf(text.c_str(), "%4d-%2u-%2u%c", &year, &month, &day, &extra) != 3) {
+            return std::nullopt;
+        }
+        std::chrono::year_month_day date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+        if (!date.ok()) return std::nullopt;
+        return date;
+    }
+
+    std::string formatIsoDate(const std::chrono::year_month_day& date) {
+        char buffer[16];
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", static_cast<int>(date.year()),
+                      static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()));
+        return buffer;
+    }
+
+    // Cộng tháng, lùi về ngày cuối tháng nếu ngày không tồn tại (31/01 + 1 tháng -> 28 hoặc 29/02)
+    std::chrono::year_month_day addMonths(const std::chrono::year_month_day& date, int months) {
+        std::chrono::year_month_day shifted = date + std::chrono::months{months};
+        if (!shifted.ok()) shifted = shifted.year() / shifted.month() / std::chrono::last;
+        return shifted;
+    }
+
+    std::expected<bool, Error> validateIsoDate(const std::string& text, const std::string& field) {
+        if (!parseIsoDate(text)) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, field + " must be a valid date in YYYY-MM-DD format."});
+        }
+        return true;
+    }
+}
+
+InstallmentService::InstallmentService(std::shared_ptr<IInstallmentDao> installmentDao,
+                                       std::shared_ptr<IFeeRecordDao> feeDao,
+                                       std::shared_ptr<SessionContext> sessionContext,
+                                       std::shared_ptr<IFinanceReportService> reportService)
+    : _installmentDao(std::move(installmentDao)),
+      _feeDao(std::move(feeDao)),
+      _sessionContext(std::move(sessionContext)),
+      _reportService(std::move(reportService)) {
+    if (!_installmentDao) throw std::invalid_argument("InstallmentDao cannot be null for InstallmentService.");
+    if (!_feeDao) throw std::invalid_argument("FeeRecordDao cannot be null for InstallmentService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for InstallmentService.");
+    if (!_reportService) throw std::invalid_argument("FinanceReportService cannot be null for InstallmentService.");
+}
+
+std::expected<bool, Error> InstallmentService::requireAdmin() const {
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!_sessionContext->isAuthenticated() || !currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can manage fee installments."});
+    }
+    return true;
+}
+
+std::expected<bool, Error> InstallmentService::setInstallmentPlan(const std::string& studentId, const std::vector<InstallmentDue>& dues) {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    if (dues.empty()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "An installment plan needs at least one installment."});
+    }
+
+    auto feeRecord = _feeDao->getById(studentId);
+    if (!feeRecord.has_value()) return std::unexpected(feeRecord.error());
+
+    long long planTotal = 0;
+    for (const auto& due : dues) {
+        auto validDate = validateIsoDate(due.dueDate, "Installment due date");
+        if (!validDate.has_value()) return std::unexpected(validDate.error());
+        if (due.amount <= 0) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Installment amount must be positive."});
+        }
+        planTotal += due.amount;
+    }
+    if (planTotal != feeRecord->getTotalFee()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Installments add up to " + std::to_string(planTotal) +
+                                                                 " but the total fee is " + std::to_string(feeRecord->getTotalFee()) + "."});
+    }
+
+    std::vector<InstallmentDue> ordered = dues;
+    std::stable_sort(ordered.begin(), ordered.end(), [](const InstallmentDue& a, const InstallmentDue& b) { return a.dueDate < b.dueDate; });
+    std::vector<FeeInstallment> installments;
+    installments.reserve(ordered.size());
+    long remainingPaid = feeRecord->getPaidFee();
+    for (std::size_t i = 0; i < ordered.size(); ++i) {
+        long allocated = std::min(ordered[i].amount, remainingPaid);
+        remainingPaid -= allocated;
+        installments.push_back(FeeInstallment{studentId, static_cast<int>(i + 1), ordered[i].dueDate, ordered[i].amount, allocated, false});
+    }
+
+    auto replaced = _installmentDao->replaceSchedule(studentId, installments);
+    if (replaced.has_value()) {
+        _reportService->invalidate();
+        LOG_INFO("Installment plan with " + std::to_string(installments.size()) + " installments set for student " + studentId);
+    }
+    return replaced;
+}
+
+std::expected<bool, Error> InstallmentService::createEqualInstallmentPlan(const std::string& studentId, int count,
+                                                                          const std::string& firstDueDate, int monthsBetween) {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    auto firstDate = parseIsoDate(firstDueDate);
+    if (!firstDate) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "First due date must be a valid date in YYYY-MM-DD format."});
+    }
+    if (count < 1 || monthsBetween < 1) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Installment count and spacing must be at least 1."});
+    }
+
+    auto feeRecord = _feeDao->getById(studentId);
+    if (!feeRecord.has_value()) return std::unexpected(feeRecord.error());
+    long share = feeRecord->getTotalFee() / count;
+    if (share <= 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Total fee is too small to split into " + std::to_string(count) + " installments."});
+    }
+
+    std::vector<InstallmentDue> dues;
+    dues.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        dues.push_back(InstallmentDue{formatIsoDate(addMonths(*firstDate, i * monthsBetween)), share});
+    }
+    dues.back().amount += feeRecord->getTotalFee() - share * count;
+    return setInstallmentPlan(studentId, dues);
+}
+
+std::expected<std::vector<FeeInstallment>, Error> InstallmentService::getInstallments(const std::string& studentId) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    auto currentId = _sessionContext->getCurrentUserId();
+    bool canAccess = false;
+    if (currentRole.has_value()) {
+        if (currentRole.value() == UserRole::ADMIN) canAccess = true;
+        else if (currentRole.value() == UserRole::STUDENT && currentId.has_value() && currentId.value() == studentId) canAccess = true;
+    }
+    if (!canAccess) return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to view installments."});
+    return _installmentDao->getByStudent(studentId);
+}
+
+std::expected<std::vector<FeeInstallment>, Error> InstallmentService::getOpenInstallmentsDueBetween(const std::string& fromDate,
+                                                                                                   const std::string& toDate) const {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    auto validFrom = validateIsoDate(fromDate, "Start date");
+    if (!validFrom.has_value()) return std::unexpected(validFrom.error());
+    auto validTo = validateIsoDate(toDate, "End date");
+    if (!validTo.has_value()) return std::unexpected(validTo.error());
+    return _installmentDao->getOpenDueBetween(fromDate, toDate);
+}
+
+std::expected<OverdueJobReport, Error> InstallmentService::runOverdueJob(const std::string& asOfDate) {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    auto validDate = validateIsoDate(asOfDate, "Job date");
+    if (!validDate.has_value()) return std::unexpected(validDate.error());
+
+    OverdueJobReport report;
+    report.asOfDate = asOfDate;
+    auto flagged = _installmentDao->markLate(asOfDate);
+    if (!flagged.has_value()) return std::unexpected(flagged.error());
+    report.newlyLate = flagged.value();
+    if (report.newlyLate > 0) _reportService->invalidate();
+
+    auto balances = _installmentDao->sumOverdue(asOfDate);
+    if (!balances.has_value()) return std::unexpected(balances.error());
+    report.balances = std::move(balances.value());
+    for (const auto& balance : report.balances) report.totalOverdue += balance.overdueAmount;
+
+    LOG_INFO("Overdue job " + asOfDate + ": " + std::to_string(report.newlyLate) + " installments newly late, " +
+             std::to_string(report.balances.size()) + " students overdue, total " + std::to_string(report.totalOverdue) + ".");
+    return report;
+}
+
+std::expected<OverdueJobReport, Error> InstallmentService::runOverdueJob() {
+    return runOverdueJob(DateUtils::todayIsoDate());
+}
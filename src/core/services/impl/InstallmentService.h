@@ -0,0 +1,56 @@
+/**
+ * @file InstallmentService.h
+ * @brief Triển khai dịch vụ trả góp học phí
+ */
+#ifndef INSTALLMENTSERVICE_H
+#define INSTALLMENTSERVICE_H
+
+#include <memory>
+#include "../interface/IInstallmentService.h"
+#include "../interface/IFinanceReportService.h"
+#include "../../data_access/interface/IFeeRecordDao.h"
+#include "../SessionContext.h"
+
+/**
+ * @class InstallmentService
+ * @brief Lớp triển khai dịch vụ trả góp học phí
+ */
+class InstallmentService : public IInstallmentService {
+private:
+    std::shared_ptr<IInstallmentDao> _installmentDao; ///< Đối tượng dao cho lịch trả góp
+    std::shared_ptr<IFeeRecordDao> _feeDao;           ///< Đối tượng dao để lấy tổng học phí và số đã đóng
+    std::shared_ptr<SessionContext> _sessionContext;  ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<IFinanceReportService> _reportService; ///< Báo cáo tổng hợp cần làm mới sau khi ghi
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin() const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo InstallmentService
+     * @param installmentDao Đối tượng dao cho lịch trả góp
+     * @param feeDao Đối tượng dao cho học phí
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param reportService Dịch vụ báo cáo tài chính (được invalidate sau mỗi lần ghi)
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    InstallmentService(std::shared_ptr<IInstallmentDao> installmentDao,
+                       std::shared_ptr<IFeeRecordDao> feeDao,
+                       std::shared_ptr<SessionContext> sessionContext,
+                       std::shared_ptr<IFinanceReportService> reportService);
+
+    ~InstallmentService() override = default;
+
+    std::expected<bool, Error> setInstallmentPlan(const std::string& studentId, const std::vector<InstallmentDue>& dues) override;
+    std::expected<bool, Error> createEqualInstallmentPlan(const std::string& studentId, int count,
+                                                          const std::string& firstDueDate, int monthsBetween) override;
+    std::expected<std::vector<FeeInstallment>, Error> getInstallments(const std::string& studentId) const override;
+    std::expected<std::vector<FeeInstallment>, Error> getOpenInstallmentsDueBetween(const std::string& fromDate,
+                                                                                   const std::string& toDate) const override;
+    std::expected<OverdueJobReport, Error> runOverdueJob(const std::string& asOfDate) override;
+    std::expected<OverdueJobReport, Error> runOverdueJob() override;
+};
+
+#endif // INSTALLMENTSERVICE_H
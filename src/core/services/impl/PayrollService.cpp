@@ -0,0 +1,134 @@
+#include "PayrollService.h"
+#include "../../../utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    bool containsWord(const std::string& text, const std::string& keyword) {
+        return text.find(keyword) != std::string::npos;
+    }
+}
+
+PayrollService::PayrollService(std::shared_ptr<IPayrollDao> payrollDao,
+                               std::shared_ptr<ITeacherDao> teacherDao,
+                               std::shared_ptr<ISalaryRecordDao> salaryDao,
+                               std::shared_ptr<SessionContext> sessionContext,
+                               std::shared_ptr<IFinanceReportService> reportService)
+    : _payrollDao(std::move(payrollDao)),
+      _teacherDao(std::move(teacherDao)),
+      _salaryDao(std::move(salaryDao)),
+      _sessionContext(std::move(sessionContext)),
+      _reportService(std::move(reportService)) {
+    if (!_payrollDao) throw std::invalid_argument("PayrollDao cannot be null for PayrollService.");
+    if (!_teacherDao) throw std::invalid_argument("TeacherDao cannot be null for PayrollService.");
+    if (!_salaryDao) throw std::invalid_argument("SalaryRecordDao cannot be null for PayrollService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for PayrollService.");
+    if (!_reportService) throw std::invalid_argument("FinanceReportService cannot be null for PayrollService.");
+}
+
+std::expected<bool, Error> PayrollService::requireAdmin() const {
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!_sessionContext->isAuthenticated() || !currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can run or view the payroll."});
+    }
+    return true;
+}
+
+long PayrollService::computeAllowance(const Teacher& teacher, long basicPay) {
+    std::string designation = teacher.getDesignation();
+    std::transform(designation.begin(), designation.end(), designation.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    int percent = 0;
+    if (containsWord(designation, "associate professor")) percent += 15;
+    else if (containsWord(designation, "professor")) percent += 25;
+    else if (containsWord(designation, "lecturer")) percent += 5;
+    if (containsWord(designation, "head") || containsWord(designation, "dean")) percent += 10;
+    percent += std::clamp(teacher.getExperienceYears(), 0, MAX_EXPERIENCE_PERCENT);
+
+    // Nhân trên long long để lương cơ bản lớn không tràn số
+    return static_cast<long>(static_cast<long long>(basicPay) * percent / 100);
+}
+
+std::expected<PayrollRunReport, Error> PayrollService::runPayroll(int year, int month) {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    if (year < 1900 || month < 1 || month > 12) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Invalid payroll period."});
+    }
+
+    PayrollRunReport report;
+    report.period = payrollPeriod(year, month);
+
+    std::unordered_map<std::string, long> basicPayByTeacher;
+    auto salariesVisited = _salaryDao->forEach([&basicPayByTeacher](const SalaryRecord& record) {
+        basicPayByTeacher.emplace(record.getTeacherId(), record.getBasicMonthlyPay());
+        return true;
+    });
+    if (!salariesVisited.has_value()) return std::unexpected(salariesVisited.error());
+
+    auto existingRows = _payrollDao->getByPeriod(report.period);
+    if (!existingRows.has_value()) return std::unexpected(existingRows.error());
+    std::unordered_map<std::string, SalaryPayment> existing;
+    existing.reserve(existingRows->size());
+    for (auto& payment : existingRows.value()) existing.emplace(payment.teacherId, std::move(payment));
+
+    std::vector<SalaryPayment> changed;
+    auto teachersVisited = _teacherDao->forEach([&](const Teacher& teacher) {
+        ++report.teacherCount;
+        auto basic = basicPayByTeacher.find(teacher.getId());
+        if (basic == basicPayByTeacher.end()) {
+            ++report.skipped;
+            return true;
+        }
+        SalaryPayment payment{teacher.getId(), report.period, basic->second, computeAllowance(teacher, basic->second)};
+        report.totalGross += payment.grossPay();
+
+        auto previous = existing.find(payment.teacherId);
+        if (previous == existing.end()) {
+            ++report.created;
+        } else if (previous->second.basicPay != payment.basicPay || previous->second.allowance != payment.allowance) {
+            ++report.updated;
+        } else {
+            ++report.unchanged;
+            return true;
+        }
+        changed.push_back(std::move(payment));
+        return true;
+    });
+    if (!teachersVisited.has_value()) return std::unexpected(teachersVisited.error());
+
+    auto written = _payrollDao->upsertBatch(changed);
+    if (!written.has_value()) {
+        LOG_ERROR("PayrollService: Failed to write payroll for " + report.period + ": " + written.error().message);
+        return std::unexpected(written.error());
+    }
+    if (!changed.empty()) _reportService->invalidate();
+    LOG_INFO("Payroll " + report.period + " run: " + std::to_string(report.created) + " created, " +
+             std::to_string(report.updated) + " updated, " + std::to_string(report.unchanged) + " unchanged, " +
+             std::to_string(report.skipped) + " skipped.");
+    return report;
+}
+
+std::expected<std::vector<SalaryPayment>, Error> PayrollService::getTeacherPayrollHistory(const std::string& teacherId) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    auto currentId = _sessionContext->getCurrentUserId();
+    bool canAccess = false;
+    if (currentRole.has_value()) {
+        if (currentRole.value() == UserRole::ADMIN) canAccess = true;
+        else if (currentRole.value() == UserRole::TEACHER && currentId.has_value() && currentId.value() == teacherId) canAccess = true;
+    }
+    if (!canAccess) return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to view payroll history."});
+    return _payrollDao->getByTeacher(teacherId);
+}
+
+std::expected<std::vector<PayrollYearToDate>, Error> PayrollService::getYearToDate(int year, int throughMonth) const {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    return _payrollDao->sumYearToDate(year, throughMonth);
+}
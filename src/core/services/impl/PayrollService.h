@@ -0,0 +1,72 @@
+/**
+ * @file PayrollService.h
+ * @brief Triển khai dịch vụ tính lương hàng tháng
+ */
+#ifndef PAYROLLSERVICE_H
+#define PAYROLLSERVICE_H
+
+#include <memory>
+#include "../interface/IPayrollService.h"
+#include "../interface/IFinanceReportService.h"
+#include "../../data_access/interface/ITeacherDao.h"
+#include "../../data_access/interface/ISalaryRecordDao.h"
+#include "../SessionContext.h"
+
+/**
+ * @class PayrollService
+ * @brief Lớp triển khai dịch vụ tính lương hàng tháng
+ *
+ * Một lần chạy chỉ duyệt mỗi bảng (SalaryRecords, Teachers, bảng lương của kỳ) một lần và gửi
+ * các bảng lương mới hoặc thay đổi tới IPayrollDao::upsertBatch trong một lô duy nhất.
+ */
+class PayrollService : public IPayrollService {
+private:
+    std::shared_ptr<IPayrollDao> _payrollDao;        ///< Đối tượng dao cho lịch sử lương
+    std::shared_ptr<ITeacherDao> _teacherDao;        ///< Đối tượng dao cho giảng viên
+    std::shared_ptr<ISalaryRecordDao> _salaryDao;    ///< Đối tượng dao cho lương cơ bản
+    std::shared_ptr<SessionContext> _sessionContext; ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<IFinanceReportService> _reportService; ///< Báo cáo tổng hợp cần làm mới sau khi ghi bảng lương
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin() const;
+
+public:
+    static constexpr int MAX_EXPERIENCE_PERCENT = 20; ///< Phụ cấp thâm niên tối đa (1% mỗi năm)
+
+    /**
+     * @brief Hàm khởi tạo PayrollService
+     * @param payrollDao Đối tượng dao cho lịch sử lương
+     * @param teacherDao Đối tượng dao cho giảng viên
+     * @param salaryDao Đối tượng dao cho lương cơ bản
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param reportService Dịch vụ báo cáo tài chính (được invalidate sau mỗi lần chạy lương có ghi)
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    PayrollService(std::shared_ptr<IPayrollDao> payrollDao,
+                   std::shared_ptr<ITeacherDao> teacherDao,
+                   std::shared_ptr<ISalaryRecordDao> salaryDao,
+                   std::shared_ptr<SessionContext> sessionContext,
+                   std::shared_ptr<IFinanceReportService> reportService);
+
+    ~PayrollService() override = default;
+
+    /**
+     * @brief Tính phụ cấp tháng của một giảng viên
+     *
+     * Chức danh là chuỗi tự do nên được so khớp theo từ khóa (không phân biệt hoa thường):
+     * "associate professor" 15%, "professor" 25%, "lecturer" 5%, thêm 10% nếu có "head" hoặc "dean".
+     * Thâm niên cộng 1% mỗi năm, tối đa MAX_EXPERIENCE_PERCENT.
+     * @param teacher Giảng viên
+     * @param basicPay Lương cơ bản của tháng
+     * @return Phụ cấp (làm tròn xuống)
+     */
+    static long computeAllowance(const Teacher& teacher, long basicPay);
+
+    std::expected<PayrollRunReport, Error> runPayroll(int year, int month) override;
+    std::expected<std::vector<SalaryPayment>, Error> getTeacherPayrollHistory(const std::string& teacherId) const override;
+    std::expected<std::vector<PayrollYearToDate>, Error> getYearToDate(int year, int throughMonth) const override;
+};
+
+#endif // PAYROLLSERVICE_H
@@ -0,0 +1,142 @@
+#include "PrerequisiteService.h"
+#include "../../../common/GradeScale.h"
+#include "../../../utils/Logger.h"
+#include <stdexcept>
+
+PrerequisiteService::PrerequisiteService(std::shared_ptr<IPrerequisiteDao> prerequisiteDao,
+                                         std::shared_ptr<ICourseDao> courseDao,
+                                         std::shared_ptr<ICourseResultDao> courseResultDao,
+                                         std::shared_ptr<IGeneralInputValidator> inputValidator,
+                                         std::shared_ptr<SessionContext> sessionContext)
+    : _prerequisiteDao(std::move(prerequisiteDao)),
+      _courseDao(std::move(courseDao)),
+      _courseResultDao(std::move(courseResultDao)),
+      _inputValidator(std::move(inputValidator)),
+      _sessionContext(std::move(sessionContext)) {
+    if (!_prerequisiteDao) throw std::invalid_argument("PrerequisiteDao cannot be null for PrerequisiteService.");
+    if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null for PrerequisiteService.");
+    if (!_courseResultDao) throw std::invalid_argument("CourseResultDao cannot be null for PrerequisiteService.");
+    if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null for PrerequisiteService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for PrerequisiteService.");
+}
+
+std::expected<std::shared_ptr<const PrerequisiteGraph>, Error> PrerequisiteService::loadGraph() {
+    if (_graph) return _graph;
+    auto prerequisites = _prerequisiteDao->getAll();
+    if (!prerequisites.has_value()) return std::unexpected(prerequisites.error());
+    auto graph = PrerequisiteGraph::build(prerequisites.value());
+    if (!graph.has_value()) {
+        LOG_ERROR("PrerequisiteService: Stored prerequisites are inconsistent: " + graph.error().message);
+        return std::unexpected(graph.error());
+    }
+    _graph = std::make_shared<const PrerequisiteGraph>(std::move(graph.value()));
+    return _graph;
+}
+
+std::expected<std::shared_ptr<const PrerequisiteGraph>, Error> PrerequisiteService::graphSnapshot() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return loadGraph();
+}
+
+std::expected<bool, Error> PrerequisiteService::requireAdmin(const std::string& action) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can " + action + "."});
+    }
+    return true;
+}
+
+std::expected<bool, Error> PrerequisiteService::addPrerequisite(const std::string& courseId, const std::string& prerequisiteId) {
+    auto allowed = requireAdmin("change course prerequisites");
+    if (!allowed.has_value()) return allowed;
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+    ValidationResult prerequisiteIdVr = _inputValidator->validateIdFormat(prerequisiteId, "Prerequisite course ID");
+    if (!prerequisiteIdVr.isValid) return std::unexpected(prerequisiteIdVr.errors[0]);
+    // CSV và mock không có khóa ngoại nên kiểm tra khóa học tồn tại ở đây
+    for (const auto& id : {courseId, prerequisiteId}) {
+        auto exists = _courseDao->exists(id);
+        if (!exists.has_value()) return std::unexpected(exists.error());
+        if (!exists.value()) return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course " + id + " not found."});
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto graph = loadGraph();
+    if (!graph.has_value()) return std::unexpected(graph.error());
+    // Kiểm tra chu trình trên đồ thị trước khi ghi để dữ liệu đã lưu luôn không có chu trình
+    auto acyclic = graph.value()->canAdd(courseId, prerequisiteId);
+    if (!acyclic.has_value()) return acyclic;
+
+    auto added = _prerequisiteDao->add(CoursePrerequisite{courseId, prerequisiteId});
+    if (!added.has_value()) return added;
+    // Sửa trên bản sao rồi mới thay: người đọc đang giữ đồ thị cũ không thấy trạng thái dở dang
+    auto updated = std::make_shared<PrerequisiteGraph>(*graph.value());
+    updated->add(courseId, prerequisiteId);
+    _graph = std::move(updated);
+    LOG_INFO("Course " + prerequisiteId + " is now a prerequisite of course " + courseId);
+    return true;
+}
+
+std::expected<bool, Error> PrerequisiteService::removePrerequisite(const std::string& courseId, const std::string& prerequisiteId) {
+    auto allowed = requireAdmin("change course prerequisites");
+    if (!allowed.has_value()) return allowed;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto graph = loadGraph();
+    if (!graph.has_value()) return std::unexpected(graph.error());
+    auto removed = _prerequisiteDao->remove(courseId, prerequisiteId);
+    if (!removed.has_value()) return removed;
+    auto updated = std::make_shared<PrerequisiteGraph>(*graph.value());
+    updated->remove(courseId, prerequisiteId);
+    _graph = std::move(updated);
+    LOG_INFO("Course " + prerequisiteId + " is no longer a prerequisite of course " + courseId);
+    return true;
+}
+
+std::expected<std::vector<std::string>, Error> PrerequisiteService::getPrerequisites(const std::string& courseId, bool transitive) {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+
+    auto graph = graphSnapshot();
+    if (!graph.has_value()) return std::unexpected(graph.error());
+    return transitive ? graph.value()->allPrerequisites(courseId) : graph.value()->directPrerequisites(courseId);
+}
+
+std::expected<std::vector<std::string>, Error> PrerequisiteService::getMissingPrerequisites(const std::string& studentId, const std::string& courseId) {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    auto currentUserId = _sessionContext->getCurrentUserId();
+    if (!currentRole.has_value() ||
+        (currentRole.value() == UserRole::STUDENT && (!currentUserId.has_value() || currentUserId.value() != studentId))) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to check prerequisites of another student."});
+    }
+    ValidationResult studentIdVr = _inputValidator->validateIdFormat(studentId, "Student ID");
+    if (!studentIdVr.isValid) return std::unexpected(studentIdVr.errors[0]);
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+    return findMissingPrerequisites(studentId, courseId);
+}
+
+std::expected<std::vector<std::string>, Error> PrerequisiteService::findMissingPrerequisites(const std::string& studentId, const std::string& courseId) {
+    // Chỉ giữ khóa để lấy con trỏ đồ thị; đọc kết quả học tập và so bitset chạy song song giữa các lần đăng ký
+    auto graph = graphSnapshot();
+    if (!graph.has_value()) return std::unexpected(graph.error());
+    // Phần lớn khóa học không có môn tiên quyết: không cần đọc kết quả học tập
+    if (!graph.value()->hasPrerequisites(courseId)) return std::vector<std::string>{};
+
+    auto results = _courseResultDao->findByStudentId(studentId);
+    if (!results.has_value()) return std::unexpected(results.error());
+    std::vector<std::string> passedIds;
+    for (const auto& result : results.value()) {
+        if (result.getMarks() >= GradeScale::PASS_MARKS) passedIds.push_back(result.getCourseId());
+    }
+    return graph.value()->missingPrerequisites(courseId, graph.value()->bitsetOf(passedIds));
+}
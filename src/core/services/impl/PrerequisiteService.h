@@ -0,0 +1,76 @@
+/**
+ * @file PrerequisiteService.h
+ * @brief Triển khai dịch vụ quản lý môn tiên quyết của các khóa học
+ */
+#ifndef PREREQUISITESERVICE_H
+#define PREREQUISITESERVICE_H
+
+#include <memory>
+#include <mutex>
+#include "../interface/IPrerequisiteService.h"
+#include "../../data_access/interface/IPrerequisiteDao.h"
+#include "../../data_access/interface/ICourseDao.h"
+#include "../../data_access/interface/ICourseResultDao.h"
+#include "../../validators/interface/IValidator.h"
+#include "../PrerequisiteGraph.h"
+#include "../SessionContext.h"
+
+/**
+ * @class PrerequisiteService
+ * @brief Lớp triển khai dịch vụ môn tiên quyết
+ *
+ * Bảng CoursePrerequisites là nguồn dữ liệu gốc; đồ thị cùng các bao đóng bắc cầu được nạp từ DAO
+ * ở lần truy cập đầu tiên và cập nhật sau mỗi lần ghi thành công. Khi kiểm tra điều kiện, tập
+ * môn đã qua của sinh viên được dựng từ kết quả học tập chỉ khi khóa học có môn tiên quyết.
+ */
+class PrerequisiteService : public IPrerequisiteService {
+private:
+    std::shared_ptr<IPrerequisiteDao> _prerequisiteDao;        ///< Đối tượng dao cho quan hệ môn tiên quyết
+    std::shared_ptr<ICourseDao> _courseDao;                    ///< Đối tượng dao để kiểm tra khóa học tồn tại
+    std::shared_ptr<ICourseResultDao> _courseResultDao;        ///< Đối tượng dao để lấy các môn sinh viên đã qua
+    std::shared_ptr<IGeneralInputValidator> _inputValidator;   ///< Đối tượng validator để kiểm tra đầu vào
+    std::shared_ptr<SessionContext> _sessionContext;           ///< Đối tượng quản lý phiên làm việc
+
+    mutable std::mutex _mutex;                         ///< Tuần tự hóa ghi DAO và việc thay con trỏ đồ thị
+    std::shared_ptr<const PrerequisiteGraph> _graph;   ///< Đồ thị đã nạp; mỗi lần ghi thay bằng bản sao mới
+
+    /**
+     * @brief Lấy đồ thị, nạp từ DAO nếu chưa có (gọi khi đang giữ _mutex)
+     */
+    std::expected<std::shared_ptr<const PrerequisiteGraph>, Error> loadGraph();
+
+    /**
+     * @brief Lấy đồ thị hiện tại chỉ trong lúc giữ _mutex; bên gọi đọc đồ thị sau khi đã nhả khóa
+     */
+    std::expected<std::shared_ptr<const PrerequisiteGraph>, Error> graphSnapshot();
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin(const std::string& action) const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo PrerequisiteService
+     * @param prerequisiteDao Đối tượng dao cho quan hệ môn tiên quyết
+     * @param courseDao Đối tượng dao để truy cập dữ liệu khóa học
+     * @param courseResultDao Đối tượng dao để truy cập kết quả học tập
+     * @param inputValidator Đối tượng validator để kiểm tra đầu vào
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     */
+    PrerequisiteService(std::shared_ptr<IPrerequisiteDao> prerequisiteDao,
+                        std::shared_ptr<ICourseDao> courseDao,
+                        std::shared_ptr<ICourseResultDao> courseResultDao,
+                        std::shared_ptr<IGeneralInputValidator> inputValidator,
+                        std::shared_ptr<SessionContext> sessionContext);
+
+    ~PrerequisiteService() override = default;
+
+    std::expected<bool, Error> addPrerequisite(const std::string& courseId, const std::string& prerequisiteId) override;
+    std::expected<bool, Error> removePrerequisite(const std::string& courseId, const std::string& prerequisiteId) override;
+    std::expected<std::vector<std::string>, Error> getPrerequisites(const std::string& courseId, bool transitive) override;
+    std::expected<std::vector<std::string>, Error> getMissingPrerequisites(const std::string& studentId, const std::string& courseId) override;
+    std::expected<std::vector<std::string>, Error> findMissingPrerequisites(const std::string& studentId, const std::string& courseId) override;
+};
+
+#endif // PREREQUISITESERVICE_H
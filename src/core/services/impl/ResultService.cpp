@@ -1,6 +1,20 @@
 #include "ResultService.h"
 #include "../../../utils/Logger.h"
 #include <sstream> // For report generation
+#include <map>
+#include <unordered_set>
+#include <unordered_map>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <chrono>
+#include <optional>
+#include "../../../utils/MappedFile.h"
+#include "../../../utils/CsvTokenizer.h"
+#include "../../../utils/StringUtils.h"
+#include "../../../utils/ParallelUtils.h"
+#include "../../../common/GradeScale.h"
+#include "../../analytics/MarksColumn.h"
 
 /**
  * @brief Khởi tạo đối tượng ResultService
@@ -118,30 +132,312 @@ std::expected<bool, Error> ResultService::enterMultipleMarks(const std::string&
     if (!studentExists.has_value()) return std::unexpected(studentExists.error());
     if (!studentExists.value()) return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student ID '" + studentId + "' not found."});
 
-    // TODO: Cân nhắc transaction cho việc nhập nhiều điểm
-    // auto transResult = _resultDao->beginTransaction(); // Giả sử resultDao có thể bắt đầu transaction (hoặc dbAdapter)
-    // if (!transResult.has_value()) return std::unexpected(transResult.error());
-
-
-    for (const auto& pair : courseMarksMap) {
-        const std::string& courseId = pair.first;
-        int marks = pair.second;
-        
-        auto enterOneMarkResult = enterMarks(studentId, courseId, marks); // Gọi lại hàm enterMarks đã có check quyền (nhưng ở đây quyền đã check rồi)
-                                                                           // và các validate khác.
-        if (!enterOneMarkResult.has_value() || !enterOneMarkResult.value()) {
-            LOG_ERROR("Failed to enter marks for course " + courseId + " for student " + studentId + ". Rolling back if applicable.");
-            // _resultDao->rollbackTransaction(); // Giả sử
-            return std::unexpected(enterOneMarkResult.has_value() ? Error{ErrorCode::OPERATION_FAILED, "Failed to enter marks for course " + courseId} : enterOneMarkResult.error());
+    // Kiểm tra toàn bộ trước rồi ghi một lô: addOrUpdateBatch ghi tất cả hoặc không ghi dòng nào
+    std::vector<CourseResult> results;
+    results.reserve(courseMarksMap.size());
+    for (const auto& [courseId, marks] : courseMarksMap) {
+        ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+        if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+
+        CourseResult result(studentId, courseId, marks);
+        ValidationResult marksVr = result.validate();
+        if (!marksVr.isValid) return std::unexpected(marksVr.errors[0]);
+
+        auto courseExists = _courseDao->exists(courseId);
+        if (!courseExists.has_value()) return std::unexpected(courseExists.error());
+        if (!courseExists.value()) return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course ID '" + courseId + "' not found."});
+
+        auto isEnrolled = _enrollmentDao->isEnrolled(studentId, courseId);
+        if (!isEnrolled.has_value()) return std::unexpected(isEnrolled.error());
+        if (!isEnrolled.value()) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Student " + studentId + " is not enrolled in course " + courseId + "."});
         }
+        results.push_back(std::move(result));
+    }
+    if (results.empty()) return true;
+
+    auto saved = _resultDao->addOrUpdateBatch(results);
+    if (!saved.has_value()) {
+        LOG_ERROR("Failed to enter marks for student " + studentId + ": " + saved.error().message);
+        return std::unexpected(saved.error());
     }
-    // auto commitResult = _resultDao->commitTransaction(); // Giả sử
-    // if (!commitResult.has_value()) return std::unexpected(commitResult.error());
     LOG_INFO("Multiple marks entered successfully for student " + studentId);
     return true;
 }
 
 
+/**
+ * @brief Nhập bảng điểm cho toàn bộ sinh viên của một khóa học
+ * 
+ * Khác với việc gọi enterMarks cho từng dòng, phương thức này kiểm tra quyền,
+ * khóa học và danh sách đăng ký đúng một lần cho cả bảng điểm (một truy vấn
+ * lấy toàn bộ sinh viên đã đăng ký), sau đó ghi tất cả dòng hợp lệ trong một
+ * giao dịch. Sinh viên đã đăng ký thì chắc chắn tồn tại (khóa ngoại), nên không
+ * cần kiểm tra riêng từng sinh viên.
+ * Yêu cầu quyền truy cập: Admin hoặc giảng viên.
+ * 
+ * @param courseId ID của khóa học
+ * @param entries Các dòng bảng điểm
+ * @return std::expected<MarkSheetResult, Error> Số dòng đã ghi và lỗi từng dòng, hoặc lỗi nếu cả bảng điểm thất bại
+ */
+std::expected<MarkSheetResult, Error> ResultService::enterCourseMarkSheet(const std::string& courseId, std::span<const MarkSheetEntry> entries) {
+    if (!_sessionContext->isAuthenticated() || !_sessionContext->getCurrentUserRole().has_value() || 
+        (_sessionContext->getCurrentUserRole().value() != UserRole::ADMIN && _sessionContext->getCurrentUserRole().value() != UserRole::TEACHER)
+       ) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only Admins or Teachers can enter marks."});
+    }
+
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+
+    auto courseExists = _courseDao->exists(courseId);
+    if (!courseExists.has_value()) return std::unexpected(courseExists.error());
+    if (!courseExists.value()) return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course ID '" + courseId + "' not found."});
+
+    auto enrolledIds = _enrollmentDao->findStudentIdsByCourseId(courseId);
+    if (!enrolledIds.has_value()) return std::unexpected(enrolledIds.error());
+    const std::unordered_set<std::string> enrolled(enrolledIds.value().begin(), enrolledIds.value().end());
+    return saveCourseMarkSheet(courseId, entries, enrolled);
+}
+
+std::expected<MarkSheetResult, Error> ResultService::saveCourseMarkSheet(const std::string& courseId, std::span<const MarkSheetEntry> entries,
+                                                                         const std::unordered_set<std::string>& enrolled) {
+    MarkSheetResult sheetResult;
+    std::vector<CourseResult> toSave;
+    toSave.reserve(entries.size());
+    std::unordered_set<std::string> seenStudents;
+
+    for (std::size_t row = 0; row < entries.size(); ++row) {
+        const MarkSheetEntry& entry = entries[row];
+        auto rejectRow = [&](Error error) {
+            sheetResult.rowErrors.push_back(MarkSheetRowError{row, entry.studentId, std::move(error)});
+        };
+
+        ValidationResult studentIdVr = _inputValidator->validateIdFormat(entry.studentId, "Student ID");
+        if (!studentIdVr.isValid) { rejectRow(studentIdVr.errors[0]); continue; }
+
+        // Constructor CourseResult bỏ qua điểm ngoài miền (giữ -1), nên phải kiểm tra điểm gốc ở đây
+        if (entry.marks < GradeScale::UNGRADED_MARKS || entry.marks > GradeScale::MAX_MARKS) {
+            rejectRow(Error{ErrorCode::VALIDATION_ERROR, "Marks must be between -1 (not graded) and 100."});
+            continue;
+        }
+        CourseResult result(entry.studentId, courseId, entry.marks);
+
+        if (!enrolled.contains(entry.studentId)) {
+            rejectRow(Error{ErrorCode::VALIDATION_ERROR, "Student " + entry.studentId + " is not enrolled in course " + courseId + "."});
+            continue;
+        }
+        if (!seenStudents.insert(entry.studentId).second) {
+            rejectRow(Error{ErrorCode::VALIDATION_ERROR, "Student " + entry.studentId + " appears more than once in the mark sheet."});
+            continue;
+        }
+        toSave.push_back(std::move(result));
+    }
+
+    if (!toSave.empty()) {
+        auto saveResult = _resultDao->addOrUpdateBatch(toSave);
+        if (!saveResult.has_value()) {
+            LOG_ERROR("Failed to save mark sheet for course " + courseId + ": " + saveResult.error().message);
+            return std::unexpected(saveResult.error());
+        }
+    }
+    sheetResult.savedCount = toSave.size();
+
+    LOG_INFO("Mark sheet entered for course " + courseId + ": " + std::to_string(sheetResult.savedCount) + " saved, " +
+             std::to_string(sheetResult.rowErrors.size()) + " rejected.");
+    return sheetResult;
+}
+
+namespace {
+    // Một dòng dữ liệu đã tách từ file CSV; các view trỏ thẳng vào vùng nhớ của MappedFile
+    struct RawMarkSheetRow {
+        std::size_t lineNumber = 0;
+        std::string_view studentId;
+        std::string_view marks;
+        bool malformed = false;
+    };
+
+    // Kết quả kiểm tra một dòng: hoặc là một MarkSheetEntry hợp lệ, hoặc là thông điệp lỗi
+    struct CheckedMarkSheetRow {
+        std::optional<MarkSheetEntry> entry;
+        std::string error;
+    };
+
+    CheckedMarkSheetRow checkMarkSheetRow(const RawMarkSheetRow& row, const std::string& courseId,
+                                          const IGeneralInputValidator& validator) {
+        CheckedMarkSheetRow checked;
+        if (row.malformed) {
+            checked.error = "Malformed CSV record (unbalanced quotes).";
+            return checked;
+        }
+        std::string studentId = CsvTokenizer::unescapeField(CsvTokenizer::trimView(row.studentId));
+        ValidationResult idVr = validator.validateIdFormat(studentId, "Student ID");
+        if (!idVr.isValid) {
+            checked.error = idVr.errors[0].message;
+            return checked;
+        }
+
+        int marks = GradeScale::UNGRADED_MARKS;
+        std::string_view marksText = CsvTokenizer::trimView(row.marks);
+        if (!marksText.empty() && marksText != "N/A" && marksText != "n/a") {
+            auto [ptr, ec] = std::from_chars(marksText.data(), marksText.data() + marksText.size(), marks);
+            if (ec != std::errc() || ptr != marksText.data() + marksText.size()) {
+                checked.error = "Marks '" + std::string(marksText) + "' is not an integer.";
+                return checked;
+            }
+        }
+        // Áp dụng cùng quy tắc với CourseResult::validate (constructor tự bỏ qua điểm ngoài miền)
+        if (marks < GradeScale::UNGRADED_MARKS || marks > GradeScale::MAX_MARKS) {
+            checked.error = "Marks must be between -1 (not graded) and 100.";
+            return checked;
+        }
+        ValidationResult resultVr = CourseResult(studentId, courseId, marks).validate();
+        if (!resultVr.isValid) {
+            checked.error = resultVr.errors[0].message;
+            return checked;
+        }
+        checked.entry = MarkSheetEntry{std::move(studentId), marks};
+        return checked;
+    }
+}
+
+/**
+ * @brief Nhập bảng điểm của một khóa học từ file CSV
+ * 
+ * Quy trình gồm bốn bước:
+ * 1. Ánh xạ file vào bộ nhớ và tách bản ghi bằng CsvTokenizer (không sao chép dữ liệu).
+ * 2. Kiểm tra các dòng song song trên nhiều luồng (mỗi luồng một đoạn liên tiếp).
+ * 3. Loại các dòng trùng sinh viên trong toàn file (giữ dòng đầu tiên).
+ * 4. Ghi các dòng hợp lệ theo lô, mỗi lô một giao dịch; quyền, khóa học và danh sách
+ *    đăng ký chỉ được kiểm tra một lần trước khi đọc file.
+ * Lô bị lỗi khi ghi không làm hỏng các lô đã commit; các dòng của lô đó được báo lỗi.
+ * Yêu cầu quyền truy cập: Admin hoặc giảng viên.
+ * 
+ * @param courseId ID của khóa học
+ * @param filePath Đường dẫn file CSV
+ * @return std::expected<MarkSheetImportReport, Error> Báo cáo nhập, hoặc lỗi nếu không thể nhập
+ */
+std::expected<MarkSheetImportReport, Error> ResultService::importCourseMarkSheetCsv(const std::string& courseId, const std::string& filePath) {
+    if (!_sessionContext->isAuthenticated() || !_sessionContext->getCurrentUserRole().has_value() || 
+        (_sessionContext->getCurrentUserRole().value() != UserRole::ADMIN && _sessionContext->getCurrentUserRole().value() != UserRole::TEACHER)
+       ) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only Admins or Teachers can enter marks."});
+    }
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+    auto courseExists = _courseDao->exists(courseId);
+    if (!courseExists.has_value()) return std::unexpected(courseExists.error());
+    if (!courseExists.value()) return std::unexpected(Error{ErrorCode::NOT_FOUND, "Course ID '" + courseId + "' not found."});
+    // Danh sách đăng ký được đọc một lần cho cả file, không đọc lại ở mỗi lô
+    auto enrolledIds = _enrollmentDao->findStudentIdsByCourseId(courseId);
+    if (!enrolledIds.has_value()) return std::unexpected(enrolledIds.error());
+    const std::unordered_set<std::string> enrolled(enrolledIds.value().begin(), enrolledIds.value().end());
+
+    const auto startTime = std::chrono::steady_clock::now();
+    auto mapped = MappedFile::open(filePath);
+    if (!mapped.has_value()) return std::unexpected(mapped.error());
+
+    // --- 1. Tách bản ghi ---
+    std::vector<RawMarkSheetRow> rows;
+    rows.reserve(mapped->size() / 16); // Ước lượng thô: ~16 byte mỗi dòng "ID,điểm"
+    CsvTokenizer tokenizer(mapped->view());
+    std::vector<std::string_view> fields;
+    std::size_t studentColumn = 0;
+    std::size_t marksColumn = 1;
+    bool firstRecord = true;
+    while (tokenizer.nextRecord(fields)) {
+        if (fields.size() == 1 && CsvTokenizer::trimView(fields[0]).empty()) continue; // Dòng trống
+        if (firstRecord) {
+            firstRecord = false;
+            std::optional<std::size_t> headerStudent, headerMarks;
+            for (std::size_t i = 0; i < fields.size(); ++i) {
+                std::string name = StringUtils::toLower(std::string(CsvTokenizer::trimView(fields[i])));
+                if (name == "studentid" || name == "student id" || name == "student_id") headerStudent = i;
+                else if (name == "marks" || name == "mark") headerMarks = i;
+            }
+            if (headerStudent.has_value() || headerMarks.has_value()) {
+                if (!headerStudent.has_value() || !headerMarks.has_value()) {
+                    return std::unexpected(Error{ErrorCode::FILE_FORMAT_ERROR, "CSV header must contain both 'studentId' and 'marks' columns."});
+                }
+                studentColumn = headerStudent.value();
+                marksColumn = headerMarks.value();
+                continue;
+            }
+        }
+        RawMarkSheetRow row;
+        row.lineNumber = tokenizer.recordLine();
+        row.malformed = tokenizer.isRecordMalformed() || fields.size() <= std::max(studentColumn, marksColumn);
+        if (!row.malformed) {
+            row.studentId = fields[studentColumn];
+            row.marks = fields[marksColumn];
+        } else if (fields.size() > studentColumn) {
+            row.studentId = fields[studentColumn];
+        }
+        rows.push_back(row);
+    }
+
+    MarkSheetImportReport report;
+    report.totalRows = rows.size();
+
+    // --- 2. Kiểm tra song song: mỗi luồng ghi vào một đoạn riêng của 'checked', không cần khóa ---
+    std::vector<CheckedMarkSheetRow> checked(rows.size());
+    const IGeneralInputValidator& validator = *_inputValidator;
+    auto checkRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) checked[i] = checkMarkSheetRow(rows[i], courseId, validator);
+    };
+    ParallelUtils::parallelForChunks(rows.size(), MARK_SHEET_ROWS_PER_WORKER, checkRange);
+
+    // --- 3. Loại trùng lặp trong toàn file ---
+    std::vector<MarkSheetEntry> validEntries;
+    std::vector<std::size_t> validLines;
+    validEntries.reserve(rows.size());
+    validLines.reserve(rows.size());
+    std::unordered_map<std::string, std::size_t> firstLineOfStudent;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (!checked[i].entry.has_value()) {
+            report.lineErrors.push_back({rows[i].lineNumber, std::string(CsvTokenizer::trimView(rows[i].studentId)), std::move(checked[i].error)});
+            continue;
+        }
+        MarkSheetEntry& entry = checked[i].entry.value();
+        auto [it, inserted] = firstLineOfStudent.emplace(entry.studentId, rows[i].lineNumber);
+        if (!inserted) {
+            report.lineErrors.push_back({rows[i].lineNumber, entry.studentId,
+                                         "Duplicate student; already listed on line " + std::to_string(it->second) + "."});
+            continue;
+        }
+        validEntries.push_back(std::move(entry));
+        validLines.push_back(rows[i].lineNumber);
+    }
+
+    // --- 4. Ghi theo lô ---
+    for (std::size_t begin = 0; begin < validEntries.size(); begin += MARK_SHEET_IMPORT_BATCH_SIZE) {
+        std::size_t count = std::min(MARK_SHEET_IMPORT_BATCH_SIZE, validEntries.size() - begin);
+        std::span<const MarkSheetEntry> batch(validEntries.data() + begin, count);
+        auto batchResult = saveCourseMarkSheet(courseId, batch, enrolled);
+        if (!batchResult.has_value()) {
+            for (std::size_t i = 0; i < count; ++i) {
+                report.lineErrors.push_back({validLines[begin + i], batch[i].studentId, "Batch not saved: " + batchResult.error().message});
+            }
+            continue;
+        }
+        report.batchCount++;
+        report.savedCount += batchResult->savedCount;
+        for (auto& rowError : batchResult->rowErrors) {
+            report.lineErrors.push_back({validLines[begin + rowError.rowIndex], rowError.studentId, rowError.error.message});
+        }
+    }
+
+    std::sort(report.lineErrors.begin(), report.lineErrors.end(),
+              [](const MarkSheetImportLineError& a, const MarkSheetImportLineError& b) { return a.lineNumber < b.lineNumber; });
+    report.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    LOG_INFO("Imported mark sheet '" + filePath + "' for course " + courseId + ": " + std::to_string(report.savedCount) + "/" +
+             std::to_string(report.totalRows) + " rows saved in " + std::to_string(report.batchCount) + " batches, " +
+             std::to_string(static_cast<long long>(report.rowsPerSecond())) + " rows/s, " +
+             std::to_string(report.lineErrors.size()) + " line errors.");
+    return report;
+}
+
 /**
  * @brief Lấy kết quả học tập của một sinh viên trong một khóa học cụ thể
  * 
@@ -297,47 +593,260 @@ std::expected<double, Error> ResultService::calculateCGPA(const std::string& stu
     if (!resultsExp.has_value()) {
         return std::unexpected(resultsExp.error());
     }
-    const auto& results = resultsExp.value();
+    // average() trả về 0.0 khi không có tín chỉ nào, tránh chia cho 0
+    return gradedTotals(studentId, resultsExp.value()).average();
+}
 
-    if (results.empty()) {
-        return 0.0; // Hoặc lỗi nếu không có kết quả nào
-    }
-
-    double totalGradePoints = 0;
-    int totalCreditsAttempted = 0;
-    // Mapping Grade to Points (ví dụ)
-    // A=4.0, B=3.0, C=2.0, D=1.0, F=0.0
-    // Cần quy định rõ ràng hơn
-    auto gradeToPoint = [](char grade) -> double {
-        switch (grade) {
-            case 'A': return 4.0;
-            case 'B': return 3.0;
-            case 'C': return 2.0;
-            case 'D': return 1.0;
-            case 'F': return 0.0;
-            default: return -1.0; // Điểm không hợp lệ hoặc chưa có
+WeightedGradePoints ResultService::gradedTotals(const std::string& studentId, const std::vector<CourseResult>& results) const {
+    // Nạp điểm và tín chỉ vào cột liên tục rồi tính tổng có trọng số bằng kernel
+    // (A=4, B=3, C=2, D=1, F=0 theo GradeScale). Tín chỉ được tra một lần cho mỗi môn.
+    MarksColumn column;
+    column.reserve(results.size());
+    std::map<std::string, int> creditsByCourse;
+    for (const auto& res : results) {
+        if (res.getMarks() == -1) continue; // Bỏ qua môn chưa có điểm
+
+        auto creditIt = creditsByCourse.find(res.getCourseId());
+        if (creditIt == creditsByCourse.end()) {
+            auto courseDetails = _courseDao->getById(res.getCourseId());
+            if (!courseDetails.has_value()) {
+                LOG_WARN("CGPA Calc: Course " + res.getCourseId() + " not found for student " + studentId);
+                continue; // Bỏ qua nếu không tìm thấy thông tin môn học
+            }
+            creditIt = creditsByCourse.emplace(res.getCourseId(), courseDetails.value().getCredits()).first;
         }
-    };
+        if (creditIt->second > 0) { // Chỉ tính môn có tín chỉ > 0
+            column.append(res.getMarks(), creditIt->second);
+        }
+    }
+    return column.weightedGradePoints();
+}
 
+/**
+ * @brief Thống kê điểm của một khóa học
+ * 
+ * Phương thức này nạp toàn bộ điểm của khóa học vào MarksColumn một lần và dùng
+ * các kernel hàng loạt để lập phân bố điểm chữ, đếm số qua/trượt và tính điểm
+ * hệ 4 trung bình.
+ * Yêu cầu quyền truy cập: giống getResultsByCourse (Admin hoặc Teacher).
+ * 
+ * @param courseId ID của khóa học
+ * @return std::expected<CourseGradeStatistics, Error> Thống kê điểm nếu thành công, hoặc lỗi nếu thất bại
+ */
+std::expected<CourseGradeStatistics, Error> ResultService::getCourseGradeStatistics(const std::string& courseId) const {
+    auto resultsExp = getResultsByCourse(courseId); // Đã check quyền và validate ID
+    if (!resultsExp.has_value()) {
+        return std::unexpected(resultsExp.error());
+    }
+    const auto& results = resultsExp.value();
+
+    MarksColumn column;
+    column.reserve(results.size());
     for (const auto& res : results) {
-        if (res.getMarks() == -1) continue; // Bỏ qua môn chưa có điểm
+        // Trọng số như nhau cho mọi sinh viên trong cùng khóa học
+        column.append(res.getMarks(), 1);
+    }
 
-        auto courseDetails = _courseDao->getById(res.getCourseId());
-        if (!courseDetails.has_value()) {
-            LOG_WARN("CGPA Calc: Course " + res.getCourseId() + " not found for student " + studentId);
-            continue; // Bỏ qua nếu không tìm thấy thông tin môn học
+    CourseGradeStatistics stats;
+    stats.courseId = courseId;
+    stats.histogram = column.histogram();
+    stats.passFail = column.passFailCounts();
+    stats.averageGradePoint = column.weightedGradePoints().average();
+    return stats;
+}
+
+namespace {
+    std::expected<MarksAffine, Error> resolveCurve(const GradeCurvePolicy& policy, const MarksColumn& column) {
+        if (policy.cap < GradeScale::MIN_MARKS || policy.cap > GradeScale::MAX_MARKS) {
+            return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Curve cap must be between 0 and 100."});
         }
-        int credits = courseDetails.value().getCredits();
-        double point = gradeToPoint(res.getGrade());
+        switch (policy.method) {
+            case GradeCurveMethod::LINEAR:
+                if (!(policy.scale >= 0.0 && policy.scale <= 16.0) || !(policy.offset >= -100.0 && policy.offset <= 100.0)) {
+                    return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Linear curve needs a scale in [0, 16] and an offset in [-100, 100]."});
+                }
+                return MarksAffine::fromReal(policy.scale, policy.offset, policy.cap);
+            case GradeCurveMethod::CAP:
+                return MarksAffine::fromReal(1.0, 0.0, policy.cap);
+            case GradeCurveMethod::Z_SCORE: {
+                if (!(policy.targetMean >= 0.0 && policy.targetMean <= 100.0) || !(policy.targetStdDev >= 0.0 && policy.targetStdDev <= 50.0)) {
+                    return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Z-score curve needs a target mean in [0, 100] and a target deviation in [0, 50]."});
+                }
+                // Trung bình và độ lệch chuẩn tổng thể của các điểm đã có
+                long long sum = 0;
+                long long sumSquares = 0;
+                long long graded = 0;
+                for (std::int16_t marks : column.getMarks()) {
+                    if (marks < GradeScale::MIN_MARKS) continue;
+                    sum += marks;
+                    sumSquares += static_cast<long long>(marks) * marks;
+                    ++graded;
+                }
+                if (graded == 0) return MarksAffine::fromReal(1.0, 0.0, policy.cap);
+                double mean = static_cast<double>(sum) / static_cast<double>(graded);
+                double variance = static_cast<double>(sumSquares) / static_cast<double>(graded) - mean * mean;
+                double stdDev = variance > 0.0 ? std::sqrt(variance) : 0.0;
+                if (stdDev == 0.0) return MarksAffine::fromReal(0.0, policy.targetMean, policy.cap); // Mọi điểm bằng nhau: z = 0
+                double scale = policy.targetStdDev / stdDev;
+                if (scale > MarksAffine::MAX_SCALE) {
+                    return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Marks are too close together for the requested deviation."});
+                }
+                // fromReal giới hạn offset vào [-MAX_OFFSET, MAX_OFFSET]; offset bị cắt sẽ dời cả thang điểm nên phải từ chối
+                double offset = policy.targetMean - scale * mean;
+                if (offset < -MarksAffine::MAX_OFFSET || offset > MarksAffine::MAX_OFFSET) {
+                    return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Marks are too close together for the requested deviation."});
+                }
+                return MarksAffine::fromReal(scale, offset, policy.cap);
+            }
+        }
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Unknown curve method."});
+    }
+}
 
-        if (point >= 0 && credits > 0) { // Chỉ tính môn có điểm hợp lệ và tín chỉ > 0
-            totalGradePoints += point * credits;
-            totalCreditsAttempted += credits;
+/**
+ * @brief Nạp điểm của khóa học một lần và tính điểm sau điều chỉnh bằng kernel hàng loạt
+ * 
+ * Yêu cầu quyền truy cập: giống getResultsByCourse (Admin hoặc Teacher).
+ */
+std::expected<GradeCurveResult, Error> ResultService::computeCourseCurve(const std::string& courseId, const GradeCurvePolicy& policy,
+                                                                         std::vector<CourseResult>& results, MarksColumn& curved) const {
+    auto resultsExp = getResultsByCourse(courseId); // Đã check quyền và validate ID
+    if (!resultsExp.has_value()) return std::unexpected(resultsExp.error());
+    results = std::move(resultsExp.value());
+
+    MarksColumn column;
+    column.reserve(results.size());
+    for (const auto& res : results) column.append(res.getMarks(), 1);
+
+    auto transform = resolveCurve(policy, column);
+    if (!transform.has_value()) return std::unexpected(transform.error());
+    curved = column.transformed(transform.value());
+
+    GradeCurveResult curveResult;
+    curveResult.courseId = courseId;
+    curveResult.before = column.histogram();
+    curveResult.after = curved.histogram();
+    curveResult.passFailBefore = column.passFailCounts();
+    curveResult.passFailAfter = curved.passFailCounts();
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        if (column.getMarks()[i] != curved.getMarks()[i]) ++curveResult.changedCount;
+    }
+    return curveResult;
+}
+
+std::expected<GradeCurveResult, Error> ResultService::previewCourseCurve(const std::string& courseId, const GradeCurvePolicy& policy) const {
+    std::vector<CourseResult> results;
+    MarksColumn curved;
+    return computeCourseCurve(courseId, policy, results, curved);
+}
+
+/**
+ * @brief Điều chỉnh điểm của cả khóa học
+ * 
+ * Chỉ các kết quả bị đổi điểm được ghi, trong một lần addOrUpdateBatch (một giao dịch).
+ * Ảnh chụp điểm cũ chỉ thay ảnh chụp trước đó khi ghi thành công.
+ */
+std::expected<GradeCurveResult, Error> ResultService::curveCourseMarks(const std::string& courseId, const GradeCurvePolicy& policy) {
+    std::lock_guard<std::mutex> lock(_curveMutex);
+    std::vector<CourseResult> results;
+    MarksColumn curved;
+    auto curveResult = computeCourseCurve(courseId, policy, results, curved);
+    if (!curveResult.has_value()) return curveResult;
+
+    CurveSnapshot snapshot;
+    std::vector<CourseResult> toSave;
+    toSave.reserve(curveResult->changedCount);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        int newMarks = curved.getMarks()[i];
+        if (newMarks == results[i].getMarks()) continue;
+        toSave.emplace_back(results[i].getStudentId(), courseId, newMarks);
+        snapshot.original.push_back(results[i]);
+        snapshot.curvedMarks.push_back(newMarks);
+    }
+    if (!toSave.empty()) {
+        auto saveResult = _resultDao->addOrUpdateBatch(toSave);
+        if (!saveResult.has_value()) {
+            LOG_ERROR("Failed to curve marks for course " + courseId + ": " + saveResult.error().message);
+            return std::unexpected(saveResult.error());
         }
+        _curveSnapshots[courseId] = std::move(snapshot);
+    }
+    curveResult->applied = true;
+    LOG_INFO("Marks of course " + courseId + " curved: " + std::to_string(curveResult->changedCount) + " of " +
+             std::to_string(results.size()) + " results changed.");
+    return curveResult;
+}
+
+std::expected<std::size_t, Error> ResultService::undoCourseCurve(const std::string& courseId) {
+    std::lock_guard<std::mutex> lock(_curveMutex);
+    auto resultsExp = getResultsByCourse(courseId); // Đã check quyền và validate ID
+    if (!resultsExp.has_value()) return std::unexpected(resultsExp.error());
+    auto snapshotIt = _curveSnapshots.find(courseId);
+    if (snapshotIt == _curveSnapshots.end()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "No curve to undo for course " + courseId + "."});
+    }
+
+    std::unordered_map<std::string, int> currentMarks;
+    currentMarks.reserve(resultsExp->size());
+    for (const auto& res : resultsExp.value()) currentMarks.emplace(res.getStudentId(), res.getMarks());
+
+    // Chỉ khôi phục kết quả vẫn giữ đúng điểm đã điều chỉnh; điểm được sửa tay sau đó được giữ nguyên
+    const CurveSnapshot& snapshot = snapshotIt->second;
+    std::vector<CourseResult> toRestore;
+    for (std::size_t i = 0; i < snapshot.original.size(); ++i) {
+        auto currentIt = currentMarks.find(snapshot.original[i].getStudentId());
+        if (currentIt != currentMarks.end() && currentIt->second == snapshot.curvedMarks[i]) {
+            toRestore.push_back(snapshot.original[i]);
+        }
+    }
+    if (!toRestore.empty()) {
+        auto saveResult = _resultDao->addOrUpdateBatch(toRestore);
+        if (!saveResult.has_value()) {
+            LOG_ERROR("Failed to undo curve for course " + courseId + ": " + saveResult.error().message);
+            return std::unexpected(saveResult.error());
+        }
+    }
+    _curveSnapshots.erase(snapshotIt);
+    LOG_INFO("Curve of course " + courseId + " undone: " + std::to_string(toRestore.size()) + " results restored.");
+    return toRestore.size();
+}
+
+/**
+ * @brief Tạo bộ mô phỏng CGPA "nếu ... thì" cho sinh viên
+ * 
+ * Bảng điểm chỉ được nạp và cộng dồn một lần tại đây; các lần mô phỏng sau đó trên
+ * GpaSimulator không truy cập DAO. Môn đang học là môn đã đăng ký nhưng chưa có điểm
+ * (chưa có kết quả hoặc kết quả là -1).
+ * 
+ * @param studentId ID của sinh viên
+ * @return std::expected<GpaSimulator, Error> Bộ mô phỏng nếu thành công, hoặc lỗi nếu thất bại
+ */
+std::expected<GpaSimulator, Error> ResultService::createGpaSimulator(const std::string& studentId) const {
+    auto resultsExp = getResultsByStudent(studentId); // Đã check quyền và validate ID
+    if (!resultsExp.has_value()) {
+        return std::unexpected(resultsExp.error());
     }
+    const auto& results = resultsExp.value();
 
-    if (totalCreditsAttempted == 0) {
-        return 0.0; // Tránh chia cho 0, hoặc trả về lỗi
+    auto courseIdsExp = _enrollmentDao->findCourseIdsByStudentId(studentId);
+    if (!courseIdsExp.has_value()) {
+        return std::unexpected(courseIdsExp.error());
     }
-    return totalGradePoints / totalCreditsAttempted;
-}
\ No newline at end of file
+
+    std::unordered_set<std::string> gradedCourseIds;
+    for (const auto& res : results) {
+        if (res.getMarks() != -1) gradedCourseIds.insert(res.getCourseId());
+    }
+
+    std::vector<PendingCourse> pending;
+    for (const auto& courseId : courseIdsExp.value()) {
+        if (gradedCourseIds.contains(courseId)) continue;
+        auto courseDetails = _courseDao->getById(courseId);
+        if (!courseDetails.has_value()) {
+            LOG_WARN("GPA Simulator: Course " + courseId + " not found for student " + studentId);
+            continue;
+        }
+        pending.push_back({courseId, courseDetails.value().getCredits()});
+    }
+    return GpaSimulator(studentId, gradedTotals(studentId, results), std::move(pending));
+}
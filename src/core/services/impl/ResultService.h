@@ -17,6 +17,9 @@
 #include "../../validators/interface/IValidator.h"
 #include "../SessionContext.h"
 #include <iomanip> // For setprecision in report
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 /**
  * @class ResultService
@@ -35,6 +38,46 @@ private:
     std::shared_ptr<IGeneralInputValidator> _inputValidator; ///< Đối tượng validator để kiểm tra đầu vào
     std::shared_ptr<SessionContext> _sessionContext;   ///< Đối tượng quản lý phiên làm việc
 
+    static constexpr std::size_t MARK_SHEET_IMPORT_BATCH_SIZE = 500;     ///< Số dòng mỗi giao dịch khi nhập file CSV
+    static constexpr std::size_t MARK_SHEET_ROWS_PER_WORKER = 4096;      ///< Số dòng tối thiểu để tách thêm một luồng kiểm tra
+
+    /**
+     * @brief Ảnh chụp của lần điều chỉnh điểm gần nhất của một khóa học
+     */
+    struct CurveSnapshot {
+        std::vector<CourseResult> original; ///< Kết quả trước khi điều chỉnh
+        std::vector<int> curvedMarks;       ///< Điểm sau khi điều chỉnh, cùng thứ tự với original
+    };
+
+    std::mutex _curveMutex;                                          ///< Bảo vệ _curveSnapshots và tuần tự hóa việc điều chỉnh
+    std::unordered_map<std::string, CurveSnapshot> _curveSnapshots;  ///< Ảnh chụp theo courseId
+
+    /**
+     * @brief Tổng điểm hệ 4 có trọng số tín chỉ của các kết quả đã có điểm
+     * @param studentId ID của sinh viên (dùng cho log)
+     * @param results Các kết quả của sinh viên
+     */
+    WeightedGradePoints gradedTotals(const std::string& studentId, const std::vector<CourseResult>& results) const;
+
+    /**
+     * @brief Kiểm tra từng dòng bảng điểm và ghi các dòng hợp lệ trong một giao dịch
+     * @param courseId ID của khóa học (đã được kiểm tra quyền và sự tồn tại)
+     * @param entries Các dòng bảng điểm
+     * @param enrolled Tập sinh viên đã đăng ký khóa học
+     */
+    std::expected<MarkSheetResult, Error> saveCourseMarkSheet(const std::string& courseId, std::span<const MarkSheetEntry> entries,
+                                                              const std::unordered_set<std::string>& enrolled);
+
+    /**
+     * @brief Nạp điểm của khóa học và tính điểm sau điều chỉnh
+     * @param courseId ID của khóa học
+     * @param policy Cách điều chỉnh
+     * @param results Nhận các kết quả hiện tại của khóa học
+     * @param curved Nhận cột điểm sau điều chỉnh, cùng thứ tự với results
+     */
+    std::expected<GradeCurveResult, Error> computeCourseCurve(const std::string& courseId, const GradeCurvePolicy& policy,
+                                                              std::vector<CourseResult>& results, MarksColumn& curved) const;
+
 public:
     /**
      * @brief Hàm khởi tạo ResultService
@@ -73,6 +116,22 @@ public:
      * @return true nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<bool, Error> enterMultipleMarks(const std::string& studentId, const std::map<std::string, int>& courseMarksMap) override;
+
+    /**
+     * @brief Nhập bảng điểm cho toàn bộ sinh viên của một khóa học
+     * @param courseId ID của khóa học
+     * @param entries Các dòng bảng điểm
+     * @return Số dòng đã ghi và lỗi của từng dòng, hoặc Error nếu cả bảng điểm thất bại
+     */
+    std::expected<MarkSheetResult, Error> enterCourseMarkSheet(const std::string& courseId, std::span<const MarkSheetEntry> entries) override;
+
+    /**
+     * @brief Nhập bảng điểm của một khóa học từ file CSV
+     * @param courseId ID của khóa học
+     * @param filePath Đường dẫn file CSV
+     * @return Báo cáo nhập, hoặc Error nếu không thể nhập
+     */
+    std::expected<MarkSheetImportReport, Error> importCourseMarkSheetCsv(const std::string& courseId, const std::string& filePath) override;
     
     /**
      * @brief Lấy kết quả cụ thể của sinh viên trong một khóa học
@@ -109,6 +168,43 @@ public:
      * @return Điểm trung bình nếu thành công, hoặc Error nếu thất bại
      */
     std::expected<double, Error> calculateCGPA(const std::string& studentId) const override;
+
+    /**
+     * @brief Thống kê phân bố điểm và tỉ lệ qua môn của một khóa học
+     * @param courseId ID của khóa học
+     * @return Thống kê điểm nếu thành công, hoặc Error nếu thất bại
+     */
+    std::expected<CourseGradeStatistics, Error> getCourseGradeStatistics(const std::string& courseId) const override;
+
+    /**
+     * @brief Xem trước phân bố điểm của khóa học sau khi điều chỉnh
+     * @param courseId ID của khóa học
+     * @param policy Cách điều chỉnh
+     * @return Phân bố trước/sau, hoặc Error nếu thất bại
+     */
+    std::expected<GradeCurveResult, Error> previewCourseCurve(const std::string& courseId, const GradeCurvePolicy& policy) const override;
+
+    /**
+     * @brief Điều chỉnh điểm của cả khóa học trong một giao dịch
+     * @param courseId ID của khóa học
+     * @param policy Cách điều chỉnh
+     * @return Phân bố trước/sau, hoặc Error nếu thất bại
+     */
+    std::expected<GradeCurveResult, Error> curveCourseMarks(const std::string& courseId, const GradeCurvePolicy& policy) override;
+
+    /**
+     * @brief Khôi phục điểm trước lần điều chỉnh gần nhất của khóa học
+     * @param courseId ID của khóa học
+     * @return Số kết quả đã khôi phục, hoặc Error nếu thất bại
+     */
+    std::expected<std::size_t, Error> undoCourseCurve(const std::string& courseId) override;
+
+    /**
+     * @brief Tạo bộ mô phỏng CGPA "nếu ... thì" cho sinh viên
+     * @param studentId ID của sinh viên
+     * @return Bộ mô phỏng nếu thành công, hoặc Error nếu thất bại
+     */
+    std::expected<GpaSimulator, Error> createGpaSimulator(const std::string& studentId) const override;
 };
 
 #endif // RESULTSERVICE_H
\ No newline at end of file
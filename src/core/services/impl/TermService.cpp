@@ -0,0 +1,207 @@
+#include "TermService.h"
+#include "../../../utils/Logger.h"
+#include "../../../utils/DateUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <optional>
+#include <stdexcept>
+
+namespace {
+    std::optional<std::chrono::year_month_day> parseIsoDate(const std::string& text) {
+        int year = 0;
+        unsigned month = 0, day = 0;
+        char extra = 0;
+        if (text.size() != 10 || std::sscanf(text.c_str(), "%4d-%2u-%2u%c", &year, &month, &day, &extra) != 3) {
+            return std::nullopt;
+        }
+        std::chrono::year_month_day date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+        if (!date.ok()) return std::nullopt;
+        return date;
+    }
+}
+
+TermService::TermService(std::shared_ptr<ITermDao> termDao,
+                         std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                         std::shared_ptr<ICourseResultDao> courseResultDao,
+                         std::shared_ptr<IGeneralInputValidator> inputValidator,
+                         std::shared_ptr<SessionContext> sessionContext)
+    : _termDao(std::move(termDao)),
+      _enrollmentDao(std::move(enrollmentDao)),
+      _courseResultDao(std::move(courseResultDao)),
+      _inputValidator(std::move(inputValidator)),
+      _sessionContext(std::move(sessionContext)) {
+    if (!_termDao) throw std::invalid_argument("TermDao cannot be null for TermService.");
+    if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null for TermService.");
+    if (!_courseResultDao) throw std::invalid_argument("CourseResultDao cannot be null for TermService.");
+    if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null for TermService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for TermService.");
+}
+
+std::expected<bool, Error> TermService::requireAdmin(const std::string& action) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can " + action + "."});
+    }
+    return true;
+}
+
+std::expected<AcademicTerm, Error> TermService::requireOpenTerm(const std::string& termId) const {
+    auto term = _termDao->findById(termId);
+    if (!term.has_value()) return term;
+    if (term->closed) {
+        return std::unexpected(Error{ErrorCode::COURSE_ENROLLMENT_CLOSED, "Term " + termId + " is closed and is read-only."});
+    }
+    return term;
+}
+
+std::expected<bool, Error> TermService::createTerm(const AcademicTerm& term) {
+    auto allowed = requireAdmin("create terms");
+    if (!allowed.has_value()) return allowed;
+
+    ValidationResult termIdVr = _inputValidator->validateIdFormat(term.id, "Term ID");
+    if (!termIdVr.isValid) return std::unexpected(termIdVr.errors[0]);
+    if (term.name.empty()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Term name cannot be empty."});
+    }
+    auto startDate = parseIsoDate(term.startDate);
+    auto endDate = parseIsoDate(term.endDate);
+    if (!startDate || !endDate) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Term dates must be valid dates in YYYY-MM-DD format."});
+    }
+    if (*endDate < *startDate) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Term end date cannot be before its start date."});
+    }
+
+    AcademicTerm created = term;
+    created.closed = false;
+    auto added = _termDao->add(created);
+    if (!added.has_value()) return added;
+    LOG_INFO("Term " + created.id + " created (" + created.startDate + " to " + created.endDate + ").");
+    return true;
+}
+
+std::expected<bool, Error> TermService::closeTerm(const std::string& termId) {
+    auto allowed = requireAdmin("close terms");
+    if (!allowed.has_value()) return allowed;
+    ValidationResult termIdVr = _inputValidator->validateIdFormat(termId, "Term ID");
+    if (!termIdVr.isValid) return std::unexpected(termIdVr.errors[0]);
+
+    auto closed = _termDao->close(termId);
+    if (closed.has_value() && closed.value()) {
+        LOG_INFO("Term " + termId + " closed; its enrollments and results are now read-only.");
+    }
+    return closed;
+}
+
+std::expected<std::vector<AcademicTerm>, Error> TermService::getAllTerms() const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    return _termDao->getAll();
+}
+
+std::expected<AcademicTerm, Error> TermService::getCurrentTerm() const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    return _termDao->findCurrent(DateUtils::todayIsoDate());
+}
+
+std::expected<bool, Error> TermService::assignEnrollmentTerm(const std::string& studentId, const std::string& courseId,
+                                                             const std::string& termId) {
+    auto allowed = requireAdmin("move enrollments between terms");
+    if (!allowed.has_value()) return allowed;
+    ValidationResult studentIdVr = _inputValidator->validateIdFormat(studentId, "Student ID");
+    if (!studentIdVr.isValid) return std::unexpected(studentIdVr.errors[0]);
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+    ValidationResult termIdVr = _inputValidator->validateIdFormat(termId, "Term ID");
+    if (!termIdVr.isValid) return std::unexpected(termIdVr.errors[0]);
+
+    auto target = requireOpenTerm(termId);
+    if (!target.has_value()) return std::unexpected(target.error());
+    auto enrolled = _enrollmentDao->isEnrolled(studentId, courseId);
+    if (!enrolled.has_value()) return enrolled;
+    if (!enrolled.value()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " is not enrolled in course " + courseId + "."});
+    }
+
+    // Bản ghi thuộc học kỳ đã đóng thì không được chuyển đi; chỉ dò phân vùng (học kỳ, khóa học) của các học kỳ đã đóng
+    auto terms = _termDao->getAll();
+    if (!terms.has_value()) return std::unexpected(terms.error());
+    for (const auto& term : terms.value()) {
+        if (!term.closed) continue;
+        auto studentIds = _enrollmentDao->findStudentIdsByTermAndCourse(term.id, courseId);
+        if (!studentIds.has_value()) return std::unexpected(studentIds.error());
+        if (std::find(studentIds->begin(), studentIds->end(), studentId) != studentIds->end()) {
+            return std::unexpected(Error{ErrorCode::COURSE_ENROLLMENT_CLOSED, "Enrollment of student " + studentId + " in course " +
+                                         courseId + " belongs to closed term " + term.id + " and is read-only."});
+        }
+    }
+
+    auto moved = _enrollmentDao->setEnrollmentTerm(studentId, courseId, termId);
+    if (!moved.has_value()) return moved;
+
+    // Kết quả (nếu có) đi theo bản ghi đăng ký sang học kỳ mới
+    auto result = _courseResultDao->find(studentId, courseId);
+    if (result.has_value()) {
+        CourseResult updated = result.value();
+        updated.setTermId(termId);
+        auto saved = _courseResultDao->addOrUpdate(updated);
+        if (!saved.has_value()) return saved;
+    } else if (result.error().code != ErrorCode::NOT_FOUND) {
+        return std::unexpected(result.error());
+    }
+    LOG_INFO("Enrollment of student " + studentId + " in course " + courseId + " moved to term " + termId + ".");
+    return true;
+}
+
+std::expected<TermSummary, Error> TermService::getTermSummary(const std::string& termId) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || (currentRole.value() != UserRole::ADMIN && currentRole.value() != UserRole::TEACHER)) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to view term statistics."});
+    }
+    ValidationResult termIdVr = _inputValidator->validateIdFormat(termId, "Term ID");
+    if (!termIdVr.isValid) return std::unexpected(termIdVr.errors[0]);
+
+    {
+        std::lock_guard<std::mutex> lock(_cacheMutex);
+        auto cached = _closedSummaries.find(termId);
+        if (cached != _closedSummaries.end()) return cached->second;
+    }
+
+    // Đọc trạng thái trước dữ liệu: nếu học kỳ đóng giữa chừng thì lần này không lưu đệm, lần sau sẽ lưu
+    auto term = _termDao->findById(termId);
+    if (!term.has_value()) return std::unexpected(term.error());
+    auto enrollments = _enrollmentDao->findByTerm(termId);
+    if (!enrollments.has_value()) return std::unexpected(enrollments.error());
+    auto results = _courseResultDao->findByTerm(termId);
+    if (!results.has_value()) return std::unexpected(results.error());
+
+    MarksColumn column;
+    column.reserve(results->size());
+    for (const auto& res : results.value()) {
+        column.append(res.getMarks(), 1);
+    }
+
+    TermSummary summary;
+    summary.termId = termId;
+    summary.closed = term->closed;
+    summary.enrollmentCount = enrollments->size();
+    summary.histogram = column.histogram();
+    summary.passFail = column.passFailCounts();
+    summary.averageGradePoint = column.weightedGradePoints().average();
+
+    if (summary.closed) {
+        std::lock_guard<std::mutex> lock(_cacheMutex);
+        _closedSummaries.try_emplace(termId, summary);
+    }
+    return summary;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file TermService.h
+ * @brief Triển khai dịch vụ quản lý học kỳ
+ */
+#ifndef TERMSERVICE_H
+#define TERMSERVICE_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "../interface/ITermService.h"
+#include "../../data_access/interface/ITermDao.h"
+#include "../../data_access/interface/IEnrollmentDao.h"
+#include "../../data_access/interface/ICourseResultDao.h"
+#include "../../validators/interface/IValidator.h"
+#include "../SessionContext.h"
+
+/**
+ * @class TermService
+ * @brief Lớp triển khai dịch vụ quản lý học kỳ
+ *
+ * Thống kê học kỳ chỉ đọc phân vùng của học kỳ đó (findByTerm). Học kỳ đã đóng không thể mở lại
+ * và dữ liệu của nó chỉ được đọc, nên thống kê của học kỳ đã đóng được lưu đệm vĩnh viễn.
+ */
+class TermService : public ITermService {
+private:
+    std::shared_ptr<ITermDao> _termDao;                      ///< Đối tượng dao cho học kỳ
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;          ///< Đối tượng dao cho đăng ký
+    std::shared_ptr<ICourseResultDao> _courseResultDao;      ///< Đối tượng dao cho kết quả học tập
+    std::shared_ptr<IGeneralInputValidator> _inputValidator; ///< Đối tượng validator để kiểm tra đầu vào
+    std::shared_ptr<SessionContext> _sessionContext;         ///< Đối tượng quản lý phiên làm việc
+    mutable std::mutex _cacheMutex;                          ///< Bảo vệ _closedSummaries
+    mutable std::unordered_map<std::string, TermSummary> _closedSummaries; ///< termId -> thống kê của học kỳ đã đóng
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin(const std::string& action) const;
+
+    /**
+     * @brief Lấy học kỳ đang mở, COURSE_ENROLLMENT_CLOSED nếu đã đóng
+     */
+    std::expected<AcademicTerm, Error> requireOpenTerm(const std::string& termId) const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo TermService
+     * @param termDao Đối tượng dao cho học kỳ
+     * @param enrollmentDao Đối tượng dao cho đăng ký
+     * @param courseResultDao Đối tượng dao cho kết quả học tập
+     * @param inputValidator Đối tượng validator để kiểm tra đầu vào
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    TermService(std::shared_ptr<ITermDao> termDao,
+                std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                std::shared_ptr<ICourseResultDao> courseResultDao,
+                std::shared_ptr<IGeneralInputValidator> inputValidator,
+                std::shared_ptr<SessionContext> sessionContext);
+
+    ~TermService() override = default;
+
+    std::expected<bool, Error> createTerm(const AcademicTerm& term) override;
+    std::expected<bool, Error> closeTerm(const std::string& termId) override;
+    std::expected<std::vector<AcademicTerm>, Error> getAllTerms() const override;
+    std::expected<AcademicTerm, Error> getCurrentTerm() const override;
+    std::expected<bool, Error> assignEnrollmentTerm(const std::string& studentId, const std::string& courseId,
+                                                    const std::string& termId) override;
+    std::expected<TermSummary, Error> getTermSummary(const std::string& termId) const override;
+};
+
+#endif // TERMSERVICE_H
@@ -0,0 +1,129 @@
+#include "TuitionService.h"
+#include "../../../utils/Logger.h"
+#include "../TermScope.h"
+#include "../InstallmentSchedule.h"
+#include "../../data_access/UnitOfWork.h"
+#include <stdexcept>
+
+TuitionService::TuitionService(std::shared_ptr<ITuitionDao> tuitionDao,
+                               std::shared_ptr<ITuitionRateDao> rateDao,
+                               std::shared_ptr<IFeeRecordDao> feeDao,
+                               std::shared_ptr<IFacultyDao> facultyDao,
+                               std::shared_ptr<SessionContext> sessionContext,
+                               std::shared_ptr<IFinanceReportService> reportService,
+                               std::shared_ptr<ITermDao> termDao,
+                               std::shared_ptr<IInstallmentDao> installmentDao,
+                               std::shared_ptr<ITransactionManager> transactionManager)
+    : _tuitionDao(std::move(tuitionDao)),
+      _rateDao(std::move(rateDao)),
+      _feeDao(std::move(feeDao)),
+      _facultyDao(std::move(facultyDao)),
+      _sessionContext(std::move(sessionContext)),
+      _reportService(std::move(reportService)),
+      _termDao(std::move(termDao)),
+      _installmentDao(std::move(installmentDao)),
+      _transactionManager(std::move(transactionManager)) {
+    if (!_tuitionDao) throw std::invalid_argument("TuitionDao cannot be null for TuitionService.");
+    if (!_rateDao) throw std::invalid_argument("TuitionRateDao cannot be null for TuitionService.");
+    if (!_feeDao) throw std::invalid_argument("FeeRecordDao cannot be null for TuitionService.");
+    if (!_facultyDao) throw std::invalid_argument("FacultyDao cannot be null for TuitionService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for TuitionService.");
+    if (!_reportService) throw std::invalid_argument("FinanceReportService cannot be null for TuitionService.");
+    if (!_termDao) throw std::invalid_argument("TermDao cannot be null for TuitionService.");
+    if (!_installmentDao) throw std::invalid_argument("InstallmentDao cannot be null for TuitionService.");
+    if (!_transactionManager) throw std::invalid_argument("TransactionManager cannot be null for TuitionService.");
+}
+
+std::expected<bool, Error> TuitionService::requireAdmin() const {
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!_sessionContext->isAuthenticated() || !currentRole.has_value() || currentRole.value() != UserRole::ADMIN) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Only admins can manage tuition."});
+    }
+    return true;
+}
+
+std::expected<std::vector<TuitionRate>, Error> TuitionService::getTuitionRates() const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    return _rateDao->getAll();
+}
+
+std::expected<bool, Error> TuitionService::setTuitionRate(const std::string& facultyId, long ratePerCredit) {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    if (ratePerCredit < 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Tuition rate cannot be negative."});
+    }
+    auto facultyExists = _facultyDao->exists(facultyId);
+    if (!facultyExists.has_value()) return std::unexpected(facultyExists.error());
+    if (!facultyExists.value()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Faculty with ID " + facultyId + " not found."});
+    }
+
+    auto result = _rateDao->upsert(TuitionRate{facultyId, ratePerCredit});
+    if (result.has_value()) {
+        LOG_INFO("Tuition rate for faculty " + facultyId + " set to " + std::to_string(ratePerCredit) + " per credit.");
+    }
+    return result;
+}
+
+std::expected<TuitionRunReport, Error> TuitionService::recomputeTuition() {
+    auto allowed = requireAdmin();
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+
+    // Đăng ký của các học kỳ trước không còn tính vào học phí
+    auto termId = TermScope::resolve(*_termDao);
+    if (!termId.has_value()) return std::unexpected(termId.error());
+    auto assessment = _tuitionDao->assessTuition(termId.value());
+    if (!assessment.has_value()) return std::unexpected(assessment.error());
+
+    TuitionRunReport report;
+    report.studentCount = assessment->studentCount;
+    report.unratedCount = assessment->unratedCount;
+
+    std::vector<FeeRecord> newTotals;
+    newTotals.reserve(assessment->changes.size());
+    for (auto& change : assessment->changes) {
+        if (change.newTotalFee < change.paidFee) {
+            report.blocked.push_back(std::move(change));
+            continue;
+        }
+        if (change.previousTotalFee.has_value()) ++report.updatedCount;
+        else ++report.createdCount;
+        newTotals.emplace_back(change.studentId, change.newTotalFee, 0);
+        report.applied.push_back(std::move(change));
+    }
+    report.unchangedCount = report.studentCount - report.unratedCount - assessment->changes.size();
+
+    // Hồ sơ mới chưa thể có lịch trả góp; lịch của hồ sơ đã có được chia lại theo tổng mới
+    std::vector<std::pair<std::string, std::vector<FeeInstallment>>> schedules;
+    for (const auto& change : report.applied) {
+        if (!change.previousTotalFee.has_value()) continue;
+        auto schedule = _installmentDao->getByStudent(change.studentId);
+        if (!schedule.has_value()) return std::unexpected(schedule.error());
+        if (schedule->empty()) continue;
+        schedules.emplace_back(change.studentId, InstallmentSchedule::rescale(schedule.value(), change.newTotalFee, change.paidFee));
+    }
+
+    auto unitOfWork = UnitOfWork::begin(_transactionManager);
+    if (!unitOfWork.has_value()) return std::unexpected(unitOfWork.error());
+    auto written = _feeDao->setTotalFees(newTotals);
+    if (!written.has_value()) {
+        LOG_ERROR("TuitionService: Failed to write recomputed tuition: " + written.error().message);
+        return std::unexpected(written.error());
+    }
+    for (const auto& [studentId, installments] : schedules) {
+        auto replaced = _installmentDao->replaceSchedule(studentId, installments);
+        if (!replaced.has_value()) {
+            LOG_ERROR("TuitionService: Failed to rescale the installment plan of student " + studentId + ": " + replaced.error().message);
+            return std::unexpected(replaced.error());
+        }
+    }
+    auto committed = unitOfWork->commit();
+    if (!committed.has_value()) return std::unexpected(committed.error());
+    if (!newTotals.empty()) _reportService->invalidate();
+    LOG_INFO("Tuition recomputed: " + std::to_string(report.createdCount) + " created, " + std::to_string(report.updatedCount) +
+             " updated, " + std::to_string(report.blocked.size()) + " blocked, " + std::to_string(report.unratedCount) + " without a rate.");
+    return report;
+}
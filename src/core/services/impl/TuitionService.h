@@ -0,0 +1,73 @@
+/**
+ * @file TuitionService.h
+ * @brief Triển khai dịch vụ tính học phí theo tín chỉ
+ */
+#ifndef TUITIONSERVICE_H
+#define TUITIONSERVICE_H
+
+#include <memory>
+#include "../interface/ITuitionService.h"
+#include "../interface/IFinanceReportService.h"
+#include "../../data_access/interface/IFeeRecordDao.h"
+#include "../../data_access/interface/IFacultyDao.h"
+#include "../../data_access/interface/ITermDao.h"
+#include "../../data_access/interface/IInstallmentDao.h"
+#include "../../data_access/interface/ITransactionManager.h"
+#include "../SessionContext.h"
+
+/**
+ * @class TuitionService
+ * @brief Lớp triển khai dịch vụ tính học phí theo tín chỉ
+ *
+ * Việc tính do ITuitionDao thực hiện theo tập; dịch vụ chỉ lọc các thay đổi không hợp lệ và ghi
+ * phần còn lại bằng một lần IFeeRecordDao::setTotalFees.
+ */
+class TuitionService : public ITuitionService {
+private:
+    std::shared_ptr<ITuitionDao> _tuitionDao;               ///< Đối tượng dao để tính học phí
+    std::shared_ptr<ITuitionRateDao> _rateDao;              ///< Đối tượng dao cho bảng đơn giá
+    std::shared_ptr<IFeeRecordDao> _feeDao;                 ///< Đối tượng dao để ghi học phí
+    std::shared_ptr<IFacultyDao> _facultyDao;               ///< Đối tượng dao để kiểm tra khoa
+    std::shared_ptr<SessionContext> _sessionContext;        ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<IFinanceReportService> _reportService;  ///< Báo cáo tổng hợp cần làm mới sau khi ghi
+    std::shared_ptr<ITermDao> _termDao;                     ///< Đối tượng dao để tìm học kỳ hiện tại
+    std::shared_ptr<IInstallmentDao> _installmentDao;       ///< Lịch trả góp được chia lại khi tổng học phí đổi
+    std::shared_ptr<ITransactionManager> _transactionManager; ///< Ghi học phí và lịch trả góp trong cùng transaction
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin
+     */
+    std::expected<bool, Error> requireAdmin() const;
+
+public:
+    /**
+     * @brief Hàm khởi tạo TuitionService
+     * @param tuitionDao Đối tượng dao để tính học phí
+     * @param rateDao Đối tượng dao cho bảng đơn giá
+     * @param feeDao Đối tượng dao để ghi học phí
+     * @param facultyDao Đối tượng dao để kiểm tra khoa
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param reportService Dịch vụ báo cáo tài chính (được invalidate sau mỗi lần ghi)
+     * @param termDao Đối tượng dao cho học kỳ
+     * @param installmentDao Đối tượng dao cho lịch trả góp
+     * @param transactionManager Bộ quản lý transaction của nguồn dữ liệu
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    TuitionService(std::shared_ptr<ITuitionDao> tuitionDao,
+                   std::shared_ptr<ITuitionRateDao> rateDao,
+                   std::shared_ptr<IFeeRecordDao> feeDao,
+                   std::shared_ptr<IFacultyDao> facultyDao,
+                   std::shared_ptr<SessionContext> sessionContext,
+                   std::shared_ptr<IFinanceReportService> reportService,
+                   std::shared_ptr<ITermDao> termDao,
+                   std::shared_ptr<IInstallmentDao> installmentDao,
+                   std::shared_ptr<ITransactionManager> transactionManager);
+
+    ~TuitionService() override = default;
+
+    std::expected<std::vector<TuitionRate>, Error> getTuitionRates() const override;
+    std::expected<bool, Error> setTuitionRate(const std::string& facultyId, long ratePerCredit) override;
+    std::expected<TuitionRunReport, Error> recomputeTuition() override;
+};
+
+#endif // TUITIONSERVICE_H
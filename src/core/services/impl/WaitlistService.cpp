@@ -0,0 +1,231 @@
+#include "WaitlistService.h"
+#include "../../data_access/UnitOfWork.h"
+#include "../../../utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <stdexcept>
+
+WaitlistService::WaitlistService(std::shared_ptr<IWaitlistDao> waitlistDao,
+                                 std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                                 std::shared_ptr<IStudentDao> studentDao,
+                                 std::shared_ptr<ICourseDao> courseDao,
+                                 std::shared_ptr<IGeneralInputValidator> inputValidator,
+                                 std::shared_ptr<SessionContext> sessionContext,
+                                 std::shared_ptr<ITransactionManager> transactionManager,
+                                 std::shared_ptr<EnrollmentPolicy> enrollmentPolicy)
+    : _waitlistDao(std::move(waitlistDao)),
+      _enrollmentDao(std::move(enrollmentDao)),
+      _studentDao(std::move(studentDao)),
+      _courseDao(std::move(courseDao)),
+      _inputValidator(std::move(inputValidator)),
+      _sessionContext(std::move(sessionContext)),
+      _transactionManager(std::move(transactionManager)),
+      _enrollmentPolicy(std::move(enrollmentPolicy)) {
+    if (!_waitlistDao) throw std::invalid_argument("WaitlistDao cannot be null for WaitlistService.");
+    if (!_enrollmentDao) throw std::invalid_argument("EnrollmentDao cannot be null for WaitlistService.");
+    if (!_studentDao) throw std::invalid_argument("StudentDao cannot be null for WaitlistService.");
+    if (!_courseDao) throw std::invalid_argument("CourseDao cannot be null for WaitlistService.");
+    if (!_inputValidator) throw std::invalid_argument("InputValidator cannot be null for WaitlistService.");
+    if (!_sessionContext) throw std::invalid_argument("SessionContext cannot be null for WaitlistService.");
+    if (!_transactionManager) throw std::invalid_argument("TransactionManager cannot be null for WaitlistService.");
+    if (!_enrollmentPolicy) throw std::invalid_argument("EnrollmentPolicy cannot be null for WaitlistService.");
+}
+
+std::expected<bool, Error> WaitlistService::requireSelfOrAdmin(const std::string& studentId, const std::string& action) const {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    auto currentUserId = _sessionContext->getCurrentUserId();
+    if (!currentRole.has_value() ||
+        (currentRole.value() != UserRole::ADMIN &&
+         (currentRole.value() != UserRole::STUDENT || !currentUserId.has_value() || currentUserId.value() != studentId))) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to " + action + "."});
+    }
+    ValidationResult studentIdVr = _inputValidator->validateIdFormat(studentId, "Student ID");
+    if (!studentIdVr.isValid) return std::unexpected(studentIdVr.errors[0]);
+    return true;
+}
+
+std::expected<WaitlistQueue*, Error> WaitlistService::loadQueue(const std::string& courseId) {
+    auto it = _queues.find(courseId);
+    if (it != _queues.end()) return &it->second;
+
+    auto entries = _waitlistDao->getByCourse(courseId);
+    if (!entries.has_value()) return std::unexpected(entries.error());
+    WaitlistQueue queue(courseId);
+    for (const auto& entry : entries.value()) {
+        queue.push(entry);
+        _lastRequestedAt = std::max(_lastRequestedAt, entry.requestedAt);
+    }
+    return &_queues.emplace(courseId, std::move(queue)).first->second;
+}
+
+long long WaitlistService::nextRequestedAt() {
+    auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    _lastRequestedAt = std::max(static_cast<long long>(now), _lastRequestedAt + 1);
+    return _lastRequestedAt;
+}
+
+std::expected<std::size_t, Error> WaitlistService::joinWaitlist(const std::string& studentId, const std::string& courseId) {
+    auto allowed = requireSelfOrAdmin(studentId, "join waitlist");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    ValidationResult courseIdVr = _inputValidator->validateIdFormat(courseId, "Course ID");
+    if (!courseIdVr.isValid) return std::unexpected(courseIdVr.errors[0]);
+
+    auto student = _studentDao->getById(studentId);
+    if (!student.has_value()) return std::unexpected(student.error());
+    auto course = _courseDao->getById(courseId);
+    if (!course.has_value()) return std::unexpected(course.error());
+    if (course->getCapacity() == 0) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Course " + courseId + " has no seat limit. Enroll directly instead."});
+    }
+    auto enrolled = _enrollmentDao->isEnrolled(studentId, courseId);
+    if (!enrolled.has_value()) return std::unexpected(enrolled.error());
+    if (enrolled.value()) {
+        return std::unexpected(Error{ErrorCode::STUDENT_ALREADY_ENROLLED, "Student " + studentId + " is already enrolled in course " + courseId + "."});
+    }
+    // Cùng điều kiện với đăng ký trực tiếp (tài khoản ACTIVE, đã qua môn tiên quyết, không trùng lịch): không xếp hàng cho chỗ không thể nhận
+    auto eligible = _enrollmentPolicy->checkEligible(studentId, courseId, student->getStatus());
+    if (!eligible.has_value()) return std::unexpected(eligible.error());
+    auto enrolledIds = _enrollmentDao->findStudentIdsByCourseId(courseId);
+    if (!enrolledIds.has_value()) return std::unexpected(enrolledIds.error());
+    if (enrolledIds->size() < static_cast<std::size_t>(course->getCapacity())) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "Course " + courseId + " still has open seats. Enroll directly instead."});
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto queue = loadQueue(courseId);
+    if (!queue.has_value()) return std::unexpected(queue.error());
+
+    WaitlistEntry entry{courseId, studentId,
+                        student->getFacultyId() == course->getFacultyId() ? SAME_FACULTY_PRIORITY : OTHER_FACULTY_PRIORITY,
+                        nextRequestedAt()};
+    auto added = _waitlistDao->add(entry);
+    if (!added.has_value()) return std::unexpected(added.error());
+    queue.value()->push(entry);
+
+    std::size_t position = queue.value()->position(studentId).value_or(0);
+    LOG_INFO("Student " + studentId + " joined the waitlist of course " + courseId + " at position " + std::to_string(position));
+    return position;
+}
+
+std::expected<bool, Error> WaitlistService::leaveWaitlist(const std::string& studentId, const std::string& courseId) {
+    auto allowed = requireSelfOrAdmin(studentId, "leave waitlist");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto removed = _waitlistDao->remove(courseId, studentId);
+    if (!removed.has_value()) return removed;
+    auto it = _queues.find(courseId);
+    if (it != _queues.end()) it->second.erase(studentId);
+    LOG_INFO("Student " + studentId + " left the waitlist of course " + courseId);
+    return true;
+}
+
+std::expected<std::size_t, Error> WaitlistService::getWaitlistPosition(const std::string& studentId, const std::string& courseId) {
+    auto allowed = requireSelfOrAdmin(studentId, "view waitlist position");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto queue = loadQueue(courseId);
+    if (!queue.has_value()) return std::unexpected(queue.error());
+    auto position = queue.value()->position(studentId);
+    if (!position.has_value()) {
+        return std::unexpected(Error{ErrorCode::NOT_FOUND, "Student " + studentId + " is not waitlisted for course " + courseId + "."});
+    }
+    return position.value();
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> WaitlistService::getWaitlist(const std::string& courseId) {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+    auto currentRole = _sessionContext->getCurrentUserRole();
+    if (!currentRole.has_value() || (currentRole.value() != UserRole::ADMIN && currentRole.value() != UserRole::TEACHER)) {
+        return std::unexpected(Error{ErrorCode::PERMISSION_DENIED, "Permission denied to view course waitlist."});
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto queue = loadQueue(courseId);
+    if (!queue.has_value()) return std::unexpected(queue.error());
+    return queue.value()->entries();
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> WaitlistService::getWaitlistedCourses(const std::string& studentId) const {
+    auto allowed = requireSelfOrAdmin(studentId, "view waitlisted courses");
+    if (!allowed.has_value()) return std::unexpected(allowed.error());
+    return _waitlistDao->getByStudent(studentId);
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> WaitlistService::promoteCourse(const std::string& courseId) {
+    auto queue = loadQueue(courseId);
+    if (!queue.has_value()) return std::unexpected(queue.error());
+    if (queue.value()->empty()) return std::vector<WaitlistEntry>{};
+
+    auto unitOfWork = UnitOfWork::begin(_transactionManager);
+    if (!unitOfWork.has_value()) return std::unexpected(unitOfWork.error());
+
+    // Hàng đợi được cập nhật ngay để lấy người kế tiếp; nếu transaction thất bại thì trả lại các vé đã lấy
+    std::vector<WaitlistEntry> promoted;
+    std::vector<WaitlistEntry> taken;
+    auto restore = [&](Error error) -> std::expected<std::vector<WaitlistEntry>, Error> {
+        for (const auto& entry : taken) queue.value()->push(entry);
+        return std::unexpected(std::move(error));
+    };
+
+    while (auto head = queue.value()->front()) {
+        auto enrolled = _enrollmentPolicy->enroll(head->studentId, courseId);
+        if (!enrolled.has_value()) {
+            int code = enrolled.error().code;
+            if (code == ErrorCode::COURSE_CAPACITY_REACHED) break;
+            if (EnrollmentPolicy::isRejection(code)) {
+                // Sinh viên không còn đủ điều kiện: bỏ vé để không chặn người phía sau
+                LOG_INFO("Waitlist entry of student " + head->studentId + " for course " + courseId +
+                         " dropped: " + enrolled.error().message);
+            } else if (code != ErrorCode::ALREADY_EXISTS && code != ErrorCode::NOT_FOUND) {
+                // Vé cũ (sinh viên đã tự đăng ký hoặc không còn tồn tại) chỉ cần bỏ khỏi hàng
+                return restore(enrolled.error());
+            }
+        } else {
+            unitOfWork->addCompensation([this, head = *head]() { _enrollmentDao->removeEnrollment(head.studentId, head.courseId); });
+            promoted.push_back(*head);
+        }
+
+        auto removed = _waitlistDao->remove(courseId, head->studentId);
+        if (!removed.has_value() && removed.error().code != ErrorCode::NOT_FOUND) return restore(removed.error());
+        if (removed.has_value()) {
+            unitOfWork->addCompensation([this, head = *head]() { _waitlistDao->add(head); });
+        }
+        queue.value()->erase(head->studentId);
+        taken.push_back(*head);
+    }
+
+    if (taken.empty()) return promoted;
+    auto committed = unitOfWork->commit();
+    if (!committed.has_value()) return restore(committed.error());
+    return promoted;
+}
+
+std::expected<std::vector<WaitlistEntry>, Error> WaitlistService::promoteWaitlisted(const std::vector<std::string>& courseIds) {
+    if (!_sessionContext->isAuthenticated()) {
+        return std::unexpected(Error{ErrorCode::AUTHENTICATION_FAILED, "User not authenticated."});
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<WaitlistEntry> promoted;
+    for (const auto& courseId : std::set<std::string>(courseIds.begin(), courseIds.end())) {
+        auto coursePromoted = promoteCourse(courseId);
+        if (!coursePromoted.has_value()) {
+            LOG_ERROR("WaitlistService: Failed to promote waitlist of course " + courseId + ": " + coursePromoted.error().message);
+            return std::unexpected(coursePromoted.error());
+        }
+        for (auto& entry : coursePromoted.value()) {
+            LOG_INFO("Student " + entry.studentId + " promoted from the waitlist into course " + courseId);
+            promoted.push_back(std::move(entry));
+        }
+    }
+    return promoted;
+}
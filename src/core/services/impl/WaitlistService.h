@@ -0,0 +1,100 @@
+/**
+ * @file WaitlistService.h
+ * @brief Triển khai dịch vụ danh sách chờ của các khóa học đã đầy
+ */
+#ifndef WAITLISTSERVICE_H
+#define WAITLISTSERVICE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include "../interface/IWaitlistService.h"
+#include "../../data_access/interface/IWaitlistDao.h"
+#include "../../data_access/interface/IEnrollmentDao.h"
+#include "../../data_access/interface/IStudentDao.h"
+#include "../../data_access/interface/ICourseDao.h"
+#include "../../data_access/interface/ITransactionManager.h"
+#include "../../validators/interface/IValidator.h"
+#include "../WaitlistQueue.h"
+#include "../EnrollmentPolicy.h"
+#include "../SessionContext.h"
+
+/**
+ * @class WaitlistService
+ * @brief Lớp triển khai dịch vụ danh sách chờ
+ *
+ * Bảng Waitlist là nguồn dữ liệu gốc; mỗi khóa học có một WaitlistQueue trong bộ nhớ được nạp
+ * từ DAO ở lần truy cập đầu tiên và cập nhật sau mỗi lần ghi thành công, để truy vấn vị trí chờ
+ * và người đứng đầu hàng không phải đọc lại cả danh sách.
+ */
+class WaitlistService : public IWaitlistService {
+private:
+    std::shared_ptr<IWaitlistDao> _waitlistDao;                 ///< Đối tượng dao cho danh sách chờ
+    std::shared_ptr<IEnrollmentDao> _enrollmentDao;             ///< Đối tượng dao để đăng ký người được lên
+    std::shared_ptr<IStudentDao> _studentDao;                   ///< Đối tượng dao để lấy khoa của sinh viên
+    std::shared_ptr<ICourseDao> _courseDao;                     ///< Đối tượng dao để lấy số chỗ và khoa của khóa học
+    std::shared_ptr<IGeneralInputValidator> _inputValidator;    ///< Đối tượng validator để kiểm tra đầu vào
+    std::shared_ptr<SessionContext> _sessionContext;            ///< Đối tượng quản lý phiên làm việc
+    std::shared_ptr<ITransactionManager> _transactionManager;   ///< Transaction bao quanh mỗi lượt đăng ký người chờ
+    std::shared_ptr<EnrollmentPolicy> _enrollmentPolicy;        ///< Điều kiện đăng ký dùng chung với EnrollmentService
+
+    mutable std::mutex _mutex;                    ///< Tuần tự hóa ghi DAO và cập nhật hàng đợi tương ứng
+    std::map<std::string, WaitlistQueue> _queues; ///< Hàng đợi đã nạp, theo courseId
+    long long _lastRequestedAt = 0;               ///< Thời điểm đăng ký chờ gần nhất đã cấp
+
+    /**
+     * @brief Kiểm tra người dùng hiện tại là admin hoặc chính sinh viên đó
+     */
+    std::expected<bool, Error> requireSelfOrAdmin(const std::string& studentId, const std::string& action) const;
+
+    /**
+     * @brief Lấy hàng đợi của khóa học, nạp từ DAO nếu chưa có (gọi khi đang giữ _mutex)
+     */
+    std::expected<WaitlistQueue*, Error> loadQueue(const std::string& courseId);
+
+    /**
+     * @brief Thời điểm đăng ký chờ mới, tăng ngặt để hàng đợi chỉ thêm vào cuối (gọi khi đang giữ _mutex)
+     */
+    long long nextRequestedAt();
+
+    /**
+     * @brief Lấp chỗ trống của một khóa học trong một transaction (gọi khi đang giữ _mutex)
+     *
+     * Người đứng đầu hàng được đăng ký qua EnrollmentPolicy; vé của sinh viên không còn đủ điều kiện
+     * bị bỏ khỏi hàng và lượt xếp chuyển sang người kế tiếp.
+     */
+    std::expected<std::vector<WaitlistEntry>, Error> promoteCourse(const std::string& courseId);
+
+public:
+    /**
+     * @brief Hàm khởi tạo WaitlistService
+     * @param waitlistDao Đối tượng dao cho danh sách chờ
+     * @param enrollmentDao Đối tượng dao cho đăng ký khóa học
+     * @param studentDao Đối tượng dao cho sinh viên
+     * @param courseDao Đối tượng dao cho khóa học
+     * @param inputValidator Đối tượng validator để kiểm tra đầu vào
+     * @param sessionContext Đối tượng quản lý phiên làm việc
+     * @param transactionManager Bộ quản lý transaction của nguồn dữ liệu
+     * @param enrollmentPolicy Điều kiện đăng ký dùng chung
+     * @throw std::invalid_argument Nếu bất kỳ đối số nào là nullptr
+     */
+    WaitlistService(std::shared_ptr<IWaitlistDao> waitlistDao,
+                    std::shared_ptr<IEnrollmentDao> enrollmentDao,
+                    std::shared_ptr<IStudentDao> studentDao,
+                    std::shared_ptr<ICourseDao> courseDao,
+                    std::shared_ptr<IGeneralInputValidator> inputValidator,
+                    std::shared_ptr<SessionContext> sessionContext,
+                    std::shared_ptr<ITransactionManager> transactionManager,
+                    std::shared_ptr<EnrollmentPolicy> enrollmentPolicy);
+
+    ~WaitlistService() override = default;
+
+    std::expected<std::size_t, Error> joinWaitlist(const std::string& studentId, const std::string& courseId) override;
+    std::expected<bool, Error> leaveWaitlist(const std::string& studentId, const std::string& courseId) override;
+    std::expected<std::size_t, Error> getWaitlistPosition(const std::string& studentId, const std::string& courseId) override;
+    std::expected<std::vector<WaitlistEntry>, Error> getWaitlist(const std::string& courseId) override;
+    std::expected<std::vector<WaitlistEntry>, Error> getWaitlistedCourses(const std::string& studentId) const override;
+    std::expected<std::vector<WaitlistEntry>, Error> promoteWaitlisted(const std::vector<std::string>& courseIds) override;
+};
+
+#endif // WAITLISTSERVICE_H
@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstddef>
 #include <expected> // (➕)
 #include "../../../common/ErrorType.h" // (➕)
 #include "../../../common/LoginStatus.h"
@@ -56,6 +57,43 @@ struct NewTeacherDataByAdmin {
     std::string phoneNumber; ///< Số điện thoại
 };
 
+/**
+ * @struct AdmissionImportLineError
+ * @brief Lỗi của một dòng trong file hồ sơ tuyển sinh
+ */
+struct AdmissionImportLineError {
+    std::size_t lineNumber = 0; ///< Số dòng trong file (tính từ 1)
+    std::string email;          ///< Email đọc được ở dòng đó (có thể rỗng)
+    std::string message;        ///< Mô tả lỗi
+};
+
+/**
+ * @struct AdmittedStudentEntry
+ * @brief Một sinh viên đã được tiếp nhận từ file hồ sơ tuyển sinh
+ */
+struct AdmittedStudentEntry {
+    std::size_t lineNumber = 0; ///< Số dòng trong file
+    std::string studentId;      ///< ID sinh viên được cấp
+    std::string email;          ///< Email của sinh viên
+};
+
+/**
+ * @struct AdmissionImportReport
+ * @brief Báo cáo sau khi nhập hồ sơ tuyển sinh từ file
+ */
+struct AdmissionImportReport {
+    std::size_t totalRows = 0;                        ///< Số dòng dữ liệu (không tính header, dòng trống)
+    std::size_t batchCount = 0;                       ///< Số lô đã ghi thành công
+    double elapsedSeconds = 0;                        ///< Tổng thời gian nhập
+    std::vector<AdmittedStudentEntry> admitted;       ///< Sinh viên đã được tạo, theo thứ tự trong file
+    std::vector<AdmissionImportLineError> lineErrors; ///< Lỗi theo từng dòng, sắp xếp theo số dòng
+
+    /**
+     * @brief Tốc độ nhập (dòng/giây)
+     */
+    double rowsPerSecond() const { return elapsedSeconds > 0 ? static_cast<double>(totalRows) / elapsedSeconds : 0.0; }
+};
+
 /**
  * @class IAdminService
  * @brief Giao diện dịch vụ quản trị hệ thống
@@ -93,6 +131,21 @@ public:
      * @return Đối tượng Student mới nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<Student, Error> addStudentByAdmin(const NewStudentDataByAdmin& data) = 0;
+
+    /**
+     * @brief Nhập hàng loạt hồ sơ tuyển sinh từ file CSV hoặc JSON Lines
+     *
+     * File .jsonl/.json là JSON Lines, các file khác được đọc như CSV có dòng header.
+     * Các cột/khóa: email, firstName, lastName, facultyId, birthDay, birthMonth, birthYear,
+     * citizenId (bắt buộc), address, phoneNumber, password (tùy chọn). Mỗi dòng hợp lệ
+     * tạo một sinh viên ACTIVE giống addStudentByAdmin; dòng lỗi hoặc trùng email/CCCD
+     * bị bỏ qua và ghi vào báo cáo.
+     *
+     * @param filePath Đường dẫn file
+     * @param defaultPassword Mật khẩu ban đầu cho các dòng không có cột password (có thể rỗng)
+     * @return Báo cáo nhập, hoặc Error nếu không có quyền/không đọc được file
+     */
+    virtual std::expected<AdmissionImportReport, Error> importStudentAdmissions(const std::string& filePath, const std::string& defaultPassword) = 0;
     
     /**
      * @brief Xóa tài khoản sinh viên
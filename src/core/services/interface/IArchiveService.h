@@ -0,0 +1,62 @@
+/**
+ * @file IArchiveService.h
+ * @brief Định nghĩa giao diện dịch vụ lưu trữ sinh viên không còn hoạt động
+ *
+ * Sinh viên đã tốt nghiệp hoặc bị vô hiệu hóa lâu ngày được chuyển sang kho lưu trữ để dữ liệu
+ * chính chỉ chứa sinh viên đang học; các thao tác đọc theo sinh viên vẫn tìm thấy họ trong kho lưu trữ.
+ */
+#ifndef IARCHIVESERVICE_H
+#define IARCHIVESERVICE_H
+
+#include <string>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct ArchivePolicy
+ * @brief Điều kiện chọn sinh viên cần lưu trữ
+ */
+struct ArchivePolicy {
+    int disabledDays = 365;       ///< Số ngày tối thiểu ở trạng thái DISABLED
+    bool includeGraduates = true; ///< Lưu trữ cả sinh viên đủ điều kiện tốt nghiệp và không còn môn đang học
+    std::size_t batchSize = 500;  ///< Số sinh viên tối đa được chuyển trong một transaction
+};
+
+/**
+ * @struct ArchiveRunReport
+ * @brief Kết quả một lần chạy lưu trữ
+ */
+struct ArchiveRunReport {
+    std::size_t disabledArchived = 0;  ///< Số sinh viên bị vô hiệu hóa lâu ngày đã lưu trữ
+    std::size_t graduatesArchived = 0; ///< Số sinh viên đã tốt nghiệp đã lưu trữ
+    std::size_t batches = 0;           ///< Số transaction đã thực hiện
+};
+
+/**
+ * @class IArchiveService
+ * @brief Giao diện dịch vụ lưu trữ sinh viên
+ */
+class IArchiveService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IArchiveService() = default;
+
+    /**
+     * @brief Chuyển các sinh viên thỏa điều kiện sang kho lưu trữ theo từng nhóm (chỉ admin)
+     * @param policy Điều kiện chọn sinh viên và kích thước mỗi nhóm
+     * @return Báo cáo số sinh viên đã chuyển, hoặc Error (OPERATION_FAILED nếu không có kho lưu trữ)
+     */
+    virtual std::expected<ArchiveRunReport, Error> runArchival(const ArchivePolicy& policy) = 0;
+
+    /**
+     * @brief Kiểm tra sinh viên đã nằm trong kho lưu trữ hay chưa
+     * @param studentId ID của sinh viên
+     * @return true nếu đã lưu trữ, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> isStudentArchived(const std::string& studentId) const = 0;
+};
+
+#endif // IARCHIVESERVICE_H
@@ -0,0 +1,81 @@
+/**
+ * @file IAttendanceService.h
+ * @brief Định nghĩa giao diện dịch vụ điểm danh các buổi học
+ */
+#ifndef IATTENDANCESERVICE_H
+#define IATTENDANCESERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct AttendanceRate
+ * @brief Tỷ lệ chuyên cần của một sinh viên trong một khóa học
+ */
+struct AttendanceRate {
+    std::string studentId; ///< ID của sinh viên
+    int attended = 0;      ///< Số buổi có mặt
+    int sessions = 0;      ///< Số buổi đã điểm danh của khóa học
+    double rate = 0.0;     ///< attended / sessions (0 nếu chưa có buổi nào)
+};
+
+/**
+ * @class IAttendanceService
+ * @brief Giao diện dịch vụ điểm danh
+ */
+class IAttendanceService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IAttendanceService() = default;
+
+    /**
+     * @brief Điểm danh cả buổi học, thay điểm danh cũ của buổi đó (giảng viên, admin)
+     * @param courseId ID của khóa học
+     * @param sessionNo Số thứ tự buổi học (bắt đầu từ 1)
+     * @param presentStudentIds Các sinh viên có mặt; những sinh viên đã đăng ký còn lại là vắng
+     * @return Số sinh viên có mặt, hoặc Error (VALIDATION_ERROR nếu có sinh viên chưa đăng ký khóa học)
+     */
+    virtual std::expected<std::size_t, Error> markAttendance(const std::string& courseId, int sessionNo,
+                                                             const std::vector<std::string>& presentStudentIds) = 0;
+
+    /**
+     * @brief Sửa điểm danh của một sinh viên trong một buổi học (giảng viên, admin)
+     * @param courseId ID của khóa học
+     * @param sessionNo Số thứ tự buổi học (bắt đầu từ 1)
+     * @param studentId ID của sinh viên
+     * @param present true nếu có mặt
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> setAttendance(const std::string& courseId, int sessionNo,
+                                                     const std::string& studentId, bool present) = 0;
+
+    /**
+     * @brief Tỷ lệ chuyên cần của mọi sinh viên đang đăng ký khóa học (giảng viên, admin)
+     * @param courseId ID của khóa học
+     * @return Danh sách theo studentId, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<AttendanceRate>, Error> getAttendanceRates(const std::string& courseId) const = 0;
+
+    /**
+     * @brief Các sinh viên có tỷ lệ chuyên cần dưới ngưỡng (giảng viên, admin)
+     * @param courseId ID của khóa học
+     * @param minRate Ngưỡng trong [0, 1]
+     * @return Danh sách theo studentId (rỗng nếu khóa học chưa có buổi nào), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<AttendanceRate>, Error> getStudentsBelowThreshold(const std::string& courseId, double minRate) const = 0;
+
+    /**
+     * @brief Tỷ lệ chuyên cần của một sinh viên
+     * @param studentId ID của sinh viên (chính sinh viên đó, giảng viên hoặc admin)
+     * @param courseId ID của khóa học
+     * @return Tỷ lệ, hoặc Error (NOT_FOUND nếu sinh viên không đăng ký khóa học)
+     */
+    virtual std::expected<AttendanceRate, Error> getStudentAttendance(const std::string& studentId, const std::string& courseId) const = 0;
+};
+
+#endif // IATTENDANCESERVICE_H
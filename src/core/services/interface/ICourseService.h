@@ -81,6 +81,28 @@ public:
      * @return true nếu thành công, Error nếu thất bại
      */
     virtual std::expected<bool, Error> removeCourse(const std::string& courseId) = 0;
+
+    /**
+     * @brief Đặt số chỗ tối đa của khóa học (chỉ admin)
+     *
+     * Giảm số chỗ xuống dưới số sinh viên đã đăng ký không hủy đăng ký nào; khóa học chỉ không nhận thêm.
+     * Tăng số chỗ hoặc bỏ giới hạn thì sinh viên trong danh sách chờ được xếp vào các chỗ vừa có.
+     * @param courseId ID của khóa học
+     * @param capacity Số chỗ mới (0 = không giới hạn)
+     * @return true nếu thành công, Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> setCourseCapacity(const std::string& courseId, int capacity) = 0;
+
+    /**
+     * @brief Đặt lịch học của khóa học (chỉ admin)
+     *
+     * Lịch mới không được kiểm tra với thời khóa biểu của các sinh viên đã đăng ký; dùng báo cáo
+     * trùng lịch của IEnrollmentService để tìm các đăng ký bị ảnh hưởng.
+     * @param courseId ID của khóa học
+     * @param scheduleText Lịch học dạng "Mon 07:30-09:30 E301; Wed 13:00-15:00 F201" (rỗng = không có lịch)
+     * @return true nếu thành công, Error nếu thất bại (VALIDATION_ERROR nếu lịch không hợp lệ)
+     */
+    virtual std::expected<bool, Error> setCourseSchedule(const std::string& courseId, const std::string& scheduleText) = 0;
 };
 
 #endif // ICOURSESERVICE_H
\ No newline at end of file
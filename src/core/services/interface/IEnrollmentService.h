@@ -12,10 +12,25 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstddef>
 #include <expected> // (➕)
 #include "../../../common/ErrorType.h" // (➕)
 #include "../../entities/Course.h"
 #include "../../entities/Student.h"
+#include "../../data_access/interface/IEnrollmentDao.h" // EnrollmentRecord
+#include "../../entities/MeetingSlot.h"
+
+/**
+ * @struct TimetableClash
+ * @brief Hai buổi học trùng giờ trong thời khóa biểu của một sinh viên
+ */
+struct TimetableClash {
+    std::string studentId;      ///< ID của sinh viên
+    std::string courseId;       ///< Khóa học thứ nhất (theo thứ tự courseId)
+    MeetingSlot meeting;        ///< Buổi học của khóa học thứ nhất
+    std::string otherCourseId;  ///< Khóa học thứ hai
+    MeetingSlot otherMeeting;   ///< Buổi học trùng giờ của khóa học thứ hai
+};
 
 /**
  * @class IEnrollmentService
@@ -36,7 +51,7 @@ public:
      * 
      * @param studentId ID của sinh viên
      * @param courseId ID của khóa học
-     * @return true nếu thành công, Error nếu thất bại
+     * @return true nếu thành công, Error nếu thất bại (COURSE_CAPACITY_REACHED nếu khóa học đã hết chỗ)
      */
     virtual std::expected<bool, Error> enrollStudentInCourse(const std::string& studentId, const std::string& courseId) = 0;
     
@@ -48,6 +63,19 @@ public:
      * @return true nếu thành công, Error nếu thất bại
      */
     virtual std::expected<bool, Error> dropCourseForStudent(const std::string& studentId, const std::string& courseId) = 0;
+
+    /**
+     * @brief Hủy nhiều đăng ký cùng lúc (chỉ admin), rồi lấp chỗ trống từ danh sách chờ một lần cho mỗi khóa học
+     * @param enrollments Các cặp (sinh viên, khóa học) cần hủy
+     * @return Số đăng ký đã hủy, hoặc Error nếu thất bại (các đăng ký đã hủy trước lỗi vẫn giữ nguyên)
+     */
+    virtual std::expected<std::size_t, Error> dropCoursesForStudents(const std::vector<EnrollmentRecord>& enrollments) = 0;
+
+    /**
+     * @brief Lập báo cáo trùng lịch học của mọi sinh viên (chỉ admin), dùng sau khi đổi lịch các khóa học
+     * @return Các cặp buổi học trùng giờ theo studentId rồi courseId (rỗng nếu không có), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<TimetableClash>, Error> getTimetableClashReport() = 0;
     
     /**
      * @brief Lấy danh sách khóa học mà sinh viên đã đăng ký
@@ -0,0 +1,62 @@
+/**
+ * @file IExamScheduleService.h
+ * @brief Định nghĩa giao diện dịch vụ xếp lịch thi cuối kỳ
+ */
+#ifndef IEXAMSCHEDULESERVICE_H
+#define IEXAMSCHEDULESERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/IExamScheduleDao.h" // ExamSlot
+#include "../ExamScheduler.h"                             // ExamSchedulingOptions
+
+/**
+ * @struct ExamScheduleSummary
+ * @brief Kết quả một lần xếp lịch thi
+ */
+struct ExamScheduleSummary {
+    std::vector<ExamSlot> slots;     ///< Lịch thi theo (day, period, courseId)
+    std::size_t studentCount = 0;    ///< Số sinh viên có ít nhất một môn thi
+    std::size_t conflictCount = 0;   ///< Số cặp khóa học có chung sinh viên
+    int dayCount = 0;                ///< Số ngày thi
+};
+
+/**
+ * @class IExamScheduleService
+ * @brief Giao diện dịch vụ lịch thi
+ */
+class IExamScheduleService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IExamScheduleService() = default;
+
+    /**
+     * @brief Xếp lại lịch thi cho mọi khóa học có sinh viên đăng ký trong học kỳ và lưu thay lịch cũ (chỉ admin)
+     *
+     * Chỉ các đăng ký của học kỳ được chọn và các đăng ký chưa gán học kỳ tạo xung đột giữa hai khóa học.
+     * @param options Học kỳ, số ca mỗi ngày, số môn thi tối đa mỗi ngày của sinh viên và số chỗ mỗi ca
+     * @return Kết quả xếp lịch, hoặc Error (VALIDATION_ERROR nếu ràng buộc không thể thỏa mãn hoặc không
+     *         có học kỳ đang diễn ra, NOT_FOUND nếu học kỳ không tồn tại)
+     */
+    virtual std::expected<ExamScheduleSummary, Error> generateExamSchedule(const ExamSchedulingOptions& options) = 0;
+
+    /**
+     * @brief Lịch thi đã lưu
+     * @return Danh sách theo (day, period, courseId) (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<ExamSlot>, Error> getExamSchedule() const = 0;
+
+    /**
+     * @brief Lịch thi của một sinh viên
+     * @param studentId ID của sinh viên (chính sinh viên đó, giảng viên hoặc admin)
+     * @return Các ca thi của những khóa học sinh viên đang học, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<ExamSlot>, Error> getStudentExamSchedule(const std::string& studentId) const = 0;
+};
+
+#endif // IEXAMSCHEDULESERVICE_H
@@ -0,0 +1,95 @@
+/**
+ * @file IExportService.h
+ * @brief Định nghĩa giao diện dịch vụ xuất dữ liệu
+ *
+ * File này định nghĩa giao diện IExportService, cho phép quản trị viên (phòng đào tạo)
+ * xuất toàn bộ một bảng dữ liệu ra file CSV hoặc JSON Lines mà không cần công cụ
+ * SQLite bên ngoài. Dữ liệu được đọc theo luồng từ DAO nên bộ nhớ không tăng theo
+ * kích thước bảng.
+ */
+#ifndef IEXPORTSERVICE_H
+#define IEXPORTSERVICE_H
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../../common/EntityType.h"
+
+/**
+ * @enum ExportFormat
+ * @brief Định dạng file xuất
+ */
+enum class ExportFormat {
+    CSV,        ///< CSV có dòng tiêu đề, cùng bố cục cột với nguồn dữ liệu CSV
+    JSON_LINES  ///< Mỗi dòng một JSON object
+};
+
+/**
+ * @struct ExportTableReport
+ * @brief Kết quả xuất một bảng
+ */
+struct ExportTableReport {
+    EntityType entityType = EntityType::STUDENT; ///< Bảng được xuất
+    std::string filePath;                        ///< File đích
+    std::size_t rowCount = 0;                    ///< Số bản ghi đã ghi
+    std::size_t writeCount = 0;                  ///< Số lần ghi bộ đệm xuống file
+    double elapsedSeconds = 0;                   ///< Thời gian xuất
+    std::optional<Error> error;                  ///< Lỗi nếu bảng này xuất thất bại
+
+    /**
+     * @brief Tốc độ xuất (bản ghi/giây)
+     */
+    double rowsPerSecond() const { return elapsedSeconds > 0 ? static_cast<double>(rowCount) / elapsedSeconds : 0.0; }
+};
+
+/**
+ * @class IExportService
+ * @brief Giao diện dịch vụ xuất dữ liệu
+ */
+class IExportService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IExportService() = default;
+
+    /**
+     * @brief Danh sách các bảng có thể xuất (không bao gồm thông tin đăng nhập)
+     */
+    virtual std::vector<EntityType> getExportableTables() const = 0;
+
+    /**
+     * @brief Tên file mặc định của một bảng khi xuất ra thư mục (vd: students.csv, students.jsonl)
+     */
+    virtual std::string getDefaultFileName(EntityType entityType, ExportFormat format) const = 0;
+
+    /**
+     * @brief Xuất một bảng ra file
+     *
+     * File đích chỉ được thay thế khi toàn bộ bảng đã được ghi thành công.
+     * @param entityType Bảng cần xuất
+     * @param filePath Đường dẫn file đích
+     * @param format Định dạng file
+     * @return Báo cáo xuất nếu thành công, hoặc Error (PERMISSION_DENIED, VALIDATION_ERROR, FILE_*)
+     */
+    virtual std::expected<ExportTableReport, Error> exportTable(EntityType entityType, const std::string& filePath, ExportFormat format) = 0;
+
+    /**
+     * @brief Xuất nhiều bảng vào một thư mục, mỗi bảng một file với tên mặc định
+     *
+     * Lỗi của một bảng được ghi vào báo cáo của bảng đó và không dừng các bảng khác.
+     * @param entityTypes Các bảng cần xuất
+     * @param directory Thư mục đích (được tạo nếu chưa có)
+     * @param format Định dạng file
+     * @param parallel true để xuất các bảng đồng thời, mỗi bảng trên một luồng
+     * @return Báo cáo theo thứ tự của entityTypes, hoặc Error nếu không có quyền/không tạo được thư mục
+     */
+    virtual std::expected<std::vector<ExportTableReport>, Error> exportTables(const std::vector<EntityType>& entityTypes,
+                                                                             const std::string& directory,
+                                                                             ExportFormat format, bool parallel) = 0;
+};
+
+#endif // IEXPORTSERVICE_H
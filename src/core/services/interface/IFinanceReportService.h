@@ -0,0 +1,54 @@
+/**
+ * @file IFinanceReportService.h
+ * @brief Định nghĩa giao diện dịch vụ báo cáo tài chính tổng hợp theo khoa
+ *
+ * Dùng cho bảng tổng hợp cuối tháng: tổng học phí phải đóng, đã đóng, còn nợ theo khoa
+ * và khóa, cùng tổng quỹ lương theo khoa.
+ */
+#ifndef IFINANCEREPORTSERVICE_H
+#define IFINANCEREPORTSERVICE_H
+
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/IFinanceReportDao.h" // FacultyFeeSummary, FacultyPayrollSummary
+
+/**
+ * @class IFinanceReportService
+ * @brief Giao diện dịch vụ báo cáo tài chính tổng hợp
+ *
+ * Kết quả được lưu đệm; mọi dịch vụ ghi học phí/lương (IFinanceService, ITuitionService,
+ * IAdminService, IInstallmentService, IPayrollService) gọi invalidate() để lần đọc sau tính lại.
+ */
+class IFinanceReportService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IFinanceReportService() = default;
+
+    /**
+     * @brief Tổng học phí theo khoa và khóa
+     * @return Danh sách sắp theo (facultyId, cohort), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FacultyFeeSummary>, Error> getFeeSummaryByFacultyAndCohort() = 0;
+
+    /**
+     * @brief Tổng học phí theo khoa (gộp mọi khóa, cohort rỗng)
+     * @return Danh sách sắp theo facultyId, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FacultyFeeSummary>, Error> getFeeSummaryByFaculty() = 0;
+
+    /**
+     * @brief Tổng lương cơ bản hàng tháng theo khoa
+     * @return Danh sách sắp theo facultyId, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FacultyPayrollSummary>, Error> getPayrollByFaculty() = 0;
+
+    /**
+     * @brief Bỏ kết quả đã lưu đệm (gọi sau mỗi lần ghi học phí hoặc lương)
+     */
+    virtual void invalidate() = 0;
+};
+
+#endif // IFINANCEREPORTSERVICE_H
@@ -16,6 +16,7 @@
 #include "../../../common/ErrorType.h" // (➕)
 #include "../../entities/FeeRecord.h"
 #include "../../entities/SalaryRecord.h"
+#include "../../data_access/interface/IFeeRecordDao.h" // FeePayment
 
 /**
  * @class IFinanceService
@@ -47,10 +48,39 @@ public:
      * @return true nếu thành công, Error nếu thất bại
      */
     virtual std::expected<bool, Error> makeFeePayment(const std::string& studentId, long amount) = 0;
+
+    /**
+     * @brief Thực hiện thanh toán học phí với khóa idempotency do phía gửi tạo
+     *
+     * Gửi lại cùng một khóa (ví dụ khi thử lại) không cộng tiền lần thứ hai. Số đã đóng được phân bổ
+     * vào lịch trả góp trong cùng transaction; nếu phân bổ thất bại thì khoản thanh toán không được ghi.
+     * @param studentId ID của sinh viên
+     * @param amount Số tiền thanh toán
+     * @param idempotencyKey Khóa duy nhất của lần thanh toán
+     * @return true nếu thành công (kể cả khi khóa đã được ghi nhận trước đó), Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> makeFeePayment(const std::string& studentId, long amount, const std::string& idempotencyKey) = 0;
+
+    /**
+     * @brief Tạo khóa idempotency mới cho một lần thanh toán
+     *
+     * Phía gửi tạo khóa một lần cho mỗi lần thanh toán và dùng lại khóa đó khi thử lại.
+     * @return Khóa ngẫu nhiên chưa từng được cấp
+     */
+    virtual std::string newPaymentKey() const = 0;
+
+    /**
+     * @brief Lấy lịch sử thanh toán học phí của sinh viên
+     *
+     * @param studentId ID của sinh viên
+     * @return Danh sách các lần thanh toán theo thời gian, Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FeePayment>, Error> getFeePayments(const std::string& studentId) const = 0;
     
     /**
      * @brief Đặt tổng học phí cho sinh viên
      * 
+     * Nếu sinh viên có lịch trả góp, số tiền các đợt được chia lại theo tỷ lệ cho khớp tổng mới.
      * @param studentId ID của sinh viên
      * @param newTotalFee Tổng học phí mới
      * @return true nếu thành công, Error nếu thất bại
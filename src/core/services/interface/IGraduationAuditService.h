@@ -0,0 +1,72 @@
+/**
+ * @file IGraduationAuditService.h
+ * @brief Định nghĩa giao diện dịch vụ xét điều kiện tốt nghiệp
+ *
+ * Mỗi khoa quy định số tín chỉ đã qua tối thiểu, CGPA tối thiểu và các khóa học bắt buộc.
+ */
+#ifndef IGRADUATIONAUDITSERVICE_H
+#define IGRADUATIONAUDITSERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/IDegreeRequirementDao.h" // DegreeRequirement
+#include "../GraduationAuditor.h"                              // GraduationAuditEntry
+
+/**
+ * @struct GraduationAuditReport
+ * @brief Kết quả xét tốt nghiệp của toàn bộ sinh viên
+ */
+struct GraduationAuditReport {
+    std::vector<GraduationAuditEntry> entries; ///< Kết quả từng sinh viên
+    std::size_t eligibleCount = 0;             ///< Số sinh viên đủ điều kiện
+};
+
+/**
+ * @class IGraduationAuditService
+ * @brief Giao diện dịch vụ xét tốt nghiệp
+ */
+class IGraduationAuditService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IGraduationAuditService() = default;
+
+    /**
+     * @brief Đặt (hoặc thay) điều kiện tốt nghiệp của một khoa (chỉ admin)
+     * @param requirement Điều kiện mới; khoa và các khóa học bắt buộc phải tồn tại
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> setDegreeRequirement(const DegreeRequirement& requirement) = 0;
+
+    /**
+     * @brief Xóa điều kiện tốt nghiệp của một khoa (chỉ admin)
+     * @param facultyId Mã khoa
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu khoa chưa có điều kiện)
+     */
+    virtual std::expected<bool, Error> removeDegreeRequirement(const std::string& facultyId) = 0;
+
+    /**
+     * @brief Điều kiện tốt nghiệp của mọi khoa
+     * @return Danh sách theo facultyId (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<DegreeRequirement>, Error> getDegreeRequirements() const = 0;
+
+    /**
+     * @brief Xét tốt nghiệp cho mọi sinh viên (chỉ admin)
+     * @return Báo cáo theo thứ tự sinh viên, hoặc Error nếu thất bại
+     */
+    virtual std::expected<GraduationAuditReport, Error> runGraduationAudit() const = 0;
+
+    /**
+     * @brief Xét tốt nghiệp cho một sinh viên
+     * @param studentId ID của sinh viên (chính sinh viên đó hoặc admin)
+     * @return Kết quả xét, hoặc Error nếu thất bại
+     */
+    virtual std::expected<GraduationAuditEntry, Error> auditStudent(const std::string& studentId) const = 0;
+};
+
+#endif // IGRADUATIONAUDITSERVICE_H
@@ -0,0 +1,94 @@
+/**
+ * @file IIdSequenceService.h
+ * @brief Định nghĩa giao diện dịch vụ cấp phát mã sinh viên theo bộ đếm
+ *
+ * Mã sinh viên có dạng <2 số cuối của năm><mã khoa><số thứ tự 4 chữ số>. Thay vì dò
+ * lần lượt từng mã còn trống, mỗi tiền tố (năm + khoa) có một bộ đếm lưu trong bảng
+ * Sequences và được tăng nguyên tử mỗi lần cấp phát.
+ */
+#ifndef IIDSEQUENCESERVICE_H
+#define IIDSEQUENCESERVICE_H
+
+#include <string>
+#include <cstddef>
+#include <expected>
+#include <iomanip>
+#include <sstream>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @struct StudentIdBlock
+ * @brief Một khoảng số thứ tự liên tiếp đã được giữ chỗ cho một tiền tố
+ *
+ * Khoảng [first, last] đã được ghi nhận trong bộ đếm, nên có thể cấp các mã trong
+ * khoảng này từ bộ nhớ mà không cần truy cập nguồn dữ liệu nữa.
+ */
+struct StudentIdBlock {
+    std::string prefix; ///< Tiền tố năm + khoa
+    int first = 1;      ///< Số thứ tự đầu tiên của khoảng
+    int last = 0;       ///< Số thứ tự cuối cùng của khoảng
+
+    /**
+     * @brief Số mã trong khoảng
+     */
+    std::size_t size() const { return last >= first ? static_cast<std::size_t>(last - first + 1) : 0; }
+
+    /**
+     * @brief Mã sinh viên thứ index trong khoảng (bắt đầu từ 0)
+     */
+    std::string idAt(std::size_t index) const {
+        std::ostringstream oss;
+        oss << prefix << std::setfill('0') << std::setw(4) << (first + static_cast<int>(index));
+        return oss.str();
+    }
+};
+
+/**
+ * @class IIdSequenceService
+ * @brief Giao diện dịch vụ cấp phát mã sinh viên
+ */
+class IIdSequenceService {
+public:
+    static constexpr int MAX_STUDENT_SEQUENCE = 9999; ///< Số thứ tự lớn nhất của một tiền tố (4 chữ số)
+
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IIdSequenceService() = default;
+
+    /**
+     * @brief Tiền tố mã sinh viên của một khoa trong năm hiện tại
+     * @param facultyId Mã khoa
+     * @return Hai chữ số cuối của năm hiện tại nối với mã khoa
+     */
+    virtual std::string studentIdPrefix(const std::string& facultyId) const = 0;
+
+    /**
+     * @brief Cấp một mã sinh viên mới
+     * @param idPrefix Tiền tố năm + khoa (xem studentIdPrefix)
+     * @return Mã sinh viên, hoặc Error (OPERATION_FAILED nếu đã hết số thứ tự)
+     */
+    virtual std::expected<std::string, Error> nextStudentId(const std::string& idPrefix) = 0;
+
+    /**
+     * @brief Giữ chỗ một khoảng mã sinh viên liên tiếp bằng một lần tăng bộ đếm (dùng cho nhập hàng loạt)
+     *
+     * Các số của khoảng không được dùng hết sẽ bị bỏ trống, không được cấp lại. Nếu tiền tố
+     * không còn đủ số thứ tự, khoảng trả về chỉ gồm các số còn lại (size() < count).
+     * @param idPrefix Tiền tố năm + khoa
+     * @param count Số mã cần giữ chỗ (lớn hơn 0)
+     * @return Khoảng mã đã giữ chỗ, hoặc Error (OPERATION_FAILED nếu tiền tố đã hết số thứ tự)
+     */
+    virtual std::expected<StudentIdBlock, Error> reserveStudentIds(const std::string& idPrefix, std::size_t count) = 0;
+
+    /**
+     * @brief Dựng lại bộ đếm từ mã lớn nhất đang tồn tại nếu bảng Sequences còn trống
+     *
+     * Được gọi khi khởi động, để cơ sở dữ liệu có sẵn từ trước (hoặc file sequences.csv bị mất)
+     * không cấp lại các mã đã dùng.
+     * @return Số bộ đếm đã được dựng lại (0 nếu bảng đã có dữ liệu), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::size_t, Error> ensureInitialized() = 0;
+};
+
+#endif // IIDSEQUENCESERVICE_H
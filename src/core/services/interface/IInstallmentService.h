@@ -0,0 +1,100 @@
+/**
+ * @file IInstallmentService.h
+ * @brief Định nghĩa giao diện dịch vụ trả góp học phí
+ *
+ * Học phí của sinh viên có thể chia thành nhiều đợt có ngày đến hạn; tiền đã đóng được phân bổ
+ * vào đợt đến hạn sớm nhất trước. Công việc chạy hằng đêm đánh dấu các đợt trễ hạn và tính tổng
+ * nợ quá hạn của toàn trường.
+ */
+#ifndef IINSTALLMENTSERVICE_H
+#define IINSTALLMENTSERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/IInstallmentDao.h" // FeeInstallment, OverdueBalance
+
+/**
+ * @struct InstallmentDue
+ * @brief Một đợt trong kế hoạch trả góp cần lập
+ */
+struct InstallmentDue {
+    std::string dueDate; ///< Ngày đến hạn "YYYY-MM-DD"
+    long amount = 0;     ///< Số tiền của đợt (> 0)
+};
+
+/**
+ * @struct OverdueJobReport
+ * @brief Kết quả một lần chạy công việc tính quá hạn
+ */
+struct OverdueJobReport {
+    std::string asOfDate;                 ///< Ngày chạy "YYYY-MM-DD"
+    std::size_t newlyLate = 0;            ///< Số đợt mới bị đánh dấu trễ hạn
+    std::vector<OverdueBalance> balances; ///< Nợ quá hạn của từng sinh viên, theo studentId
+    long long totalOverdue = 0;           ///< Tổng nợ quá hạn toàn trường
+};
+
+/**
+ * @class IInstallmentService
+ * @brief Giao diện dịch vụ trả góp học phí
+ */
+class IInstallmentService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IInstallmentService() = default;
+
+    /**
+     * @brief Lập (hoặc lập lại) kế hoạch trả góp cho một sinh viên (chỉ admin)
+     *
+     * Tổng các đợt phải bằng tổng học phí; số đã đóng hiện tại được phân bổ ngay vào các đợt.
+     * @param studentId ID của sinh viên
+     * @param dues Các đợt, theo thứ tự bất kỳ
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> setInstallmentPlan(const std::string& studentId, const std::vector<InstallmentDue>& dues) = 0;
+
+    /**
+     * @brief Chia tổng học phí thành các đợt bằng nhau cách nhau một số tháng (chỉ admin)
+     * @param studentId ID của sinh viên
+     * @param count Số đợt (>= 1); phần dư được cộng vào đợt cuối
+     * @param firstDueDate Ngày đến hạn của đợt đầu "YYYY-MM-DD"
+     * @param monthsBetween Số tháng giữa hai đợt liên tiếp (>= 1)
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> createEqualInstallmentPlan(const std::string& studentId, int count,
+                                                                  const std::string& firstDueDate, int monthsBetween) = 0;
+
+    /**
+     * @brief Lấy lịch trả góp của một sinh viên (admin hoặc chính sinh viên đó)
+     * @param studentId ID của sinh viên
+     * @return Các đợt theo ngày đến hạn, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FeeInstallment>, Error> getInstallments(const std::string& studentId) const = 0;
+
+    /**
+     * @brief Các đợt chưa đóng đủ đến hạn trong khoảng ngày (chỉ admin)
+     * @param fromDate Ngày bắt đầu "YYYY-MM-DD"
+     * @param toDate Ngày kết thúc "YYYY-MM-DD"
+     * @return Các đợt theo ngày đến hạn, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<FeeInstallment>, Error> getOpenInstallmentsDueBetween(const std::string& fromDate,
+                                                                                           const std::string& toDate) const = 0;
+
+    /**
+     * @brief Công việc hằng đêm: đánh dấu trễ hạn và tính nợ quá hạn tính đến một ngày (chỉ admin)
+     * @param asOfDate Ngày chạy "YYYY-MM-DD"
+     * @return Báo cáo quá hạn, hoặc Error nếu thất bại
+     */
+    virtual std::expected<OverdueJobReport, Error> runOverdueJob(const std::string& asOfDate) = 0;
+
+    /**
+     * @brief Chạy công việc quá hạn cho ngày hôm nay (giờ địa phương)
+     */
+    virtual std::expected<OverdueJobReport, Error> runOverdueJob() = 0;
+};
+
+#endif // IINSTALLMENTSERVICE_H
@@ -0,0 +1,70 @@
+/**
+ * @file IPayrollService.h
+ * @brief Định nghĩa giao diện dịch vụ tính lương hàng tháng
+ *
+ * Mỗi lần chạy bảng lương sinh một SalaryPayment cho mỗi giảng viên có SalaryRecord, gồm lương
+ * cơ bản và phụ cấp theo chức danh và thâm niên, rồi lưu vào lịch sử lương.
+ */
+#ifndef IPAYROLLSERVICE_H
+#define IPAYROLLSERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/IPayrollDao.h" // SalaryPayment, PayrollYearToDate
+
+/**
+ * @struct PayrollRunReport
+ * @brief Kết quả một lần chạy bảng lương
+ */
+struct PayrollRunReport {
+    std::string period;           ///< Kỳ lương "YYYY-MM"
+    std::size_t teacherCount = 0; ///< Số giảng viên đã duyệt
+    std::size_t created = 0;      ///< Số bảng lương mới được tạo
+    std::size_t updated = 0;      ///< Số bảng lương đã có nhưng được tính lại khác trước
+    std::size_t unchanged = 0;    ///< Số bảng lương giữ nguyên (không ghi lại)
+    std::size_t skipped = 0;      ///< Số giảng viên chưa có SalaryRecord
+    long long totalGross = 0;     ///< Tổng lương của kỳ sau khi chạy
+};
+
+/**
+ * @class IPayrollService
+ * @brief Giao diện dịch vụ tính lương hàng tháng
+ */
+class IPayrollService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IPayrollService() = default;
+
+    /**
+     * @brief Chạy (hoặc chạy lại) bảng lương của một tháng
+     *
+     * Chạy lại một kỳ chỉ ghi các giảng viên có bảng lương mới hoặc thay đổi; toàn bộ được ghi
+     * trong một lần (tất cả hoặc không có gì).
+     * @param year Năm
+     * @param month Tháng (1-12)
+     * @return Kết quả lần chạy, hoặc Error nếu thất bại
+     */
+    virtual std::expected<PayrollRunReport, Error> runPayroll(int year, int month) = 0;
+
+    /**
+     * @brief Lấy lịch sử lương của một giảng viên (admin hoặc chính giảng viên đó)
+     * @param teacherId ID của giảng viên
+     * @return Danh sách bảng lương theo kỳ tăng dần, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<SalaryPayment>, Error> getTeacherPayrollHistory(const std::string& teacherId) const = 0;
+
+    /**
+     * @brief Tổng lương lũy kế từ đầu năm của từng giảng viên
+     * @param year Năm
+     * @param throughMonth Tháng cuối cùng được tính (1-12)
+     * @return Danh sách sắp theo teacherId, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<PayrollYearToDate>, Error> getYearToDate(int year, int throughMonth) const = 0;
+};
+
+#endif // IPAYROLLSERVICE_H
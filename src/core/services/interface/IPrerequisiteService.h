@@ -0,0 +1,73 @@
+/**
+ * @file IPrerequisiteService.h
+ * @brief Định nghĩa giao diện dịch vụ quản lý môn tiên quyết của các khóa học
+ *
+ * Quan hệ môn tiên quyết là đồ thị có hướng không chu trình: thêm một môn tạo thành vòng lặp
+ * bị từ chối. Sinh viên đủ điều kiện học một khóa học khi đã qua (điểm >= GradeScale::PASS_MARKS)
+ * mọi môn tiên quyết trực tiếp và gián tiếp của nó.
+ */
+#ifndef IPREREQUISITESERVICE_H
+#define IPREREQUISITESERVICE_H
+
+#include <string>
+#include <vector>
+#include <expected>
+#include "../../../common/ErrorType.h"
+
+/**
+ * @class IPrerequisiteService
+ * @brief Giao diện dịch vụ môn tiên quyết
+ */
+class IPrerequisiteService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IPrerequisiteService() = default;
+
+    /**
+     * @brief Thêm môn tiên quyết trực tiếp cho khóa học (chỉ admin)
+     * @param courseId ID của khóa học
+     * @param prerequisiteId ID của khóa học phải qua trước
+     * @return true nếu thành công, hoặc Error (VALIDATION_ERROR nếu tạo chu trình, NOT_FOUND nếu khóa học không tồn tại)
+     */
+    virtual std::expected<bool, Error> addPrerequisite(const std::string& courseId, const std::string& prerequisiteId) = 0;
+
+    /**
+     * @brief Bỏ môn tiên quyết trực tiếp của khóa học (chỉ admin)
+     * @param courseId ID của khóa học
+     * @param prerequisiteId ID của khóa học tiên quyết
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu không có quan hệ này)
+     */
+    virtual std::expected<bool, Error> removePrerequisite(const std::string& courseId, const std::string& prerequisiteId) = 0;
+
+    /**
+     * @brief Các môn tiên quyết của khóa học
+     * @param courseId ID của khóa học
+     * @param transitive true để lấy cả môn tiên quyết gián tiếp
+     * @return Danh sách courseId đã sắp xếp (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<std::string>, Error> getPrerequisites(const std::string& courseId, bool transitive) = 0;
+
+    /**
+     * @brief Các môn tiên quyết (trực tiếp và gián tiếp) mà sinh viên chưa qua
+     * @param studentId ID của sinh viên (chính sinh viên đó, giảng viên hoặc admin)
+     * @param courseId ID của khóa học muốn học
+     * @return Danh sách courseId đã sắp xếp (rỗng nếu đủ điều kiện), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<std::string>, Error> getMissingPrerequisites(const std::string& studentId, const std::string& courseId) = 0;
+
+    /**
+     * @brief Như getMissingPrerequisites nhưng không kiểm tra quyền của người dùng hiện tại
+     *
+     * Dành cho các luồng hệ thống chạy thay cho sinh viên khác (ví dụ xếp chỗ từ danh sách chờ);
+     * bên gọi tự chịu trách nhiệm kiểm tra quyền và định dạng ID.
+     *
+     * @param studentId ID của sinh viên
+     * @param courseId ID của khóa học muốn học
+     * @return Danh sách courseId đã sắp xếp (rỗng nếu đủ điều kiện), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<std::string>, Error> findMissingPrerequisites(const std::string& studentId, const std::string& courseId) = 0;
+};
+
+#endif // IPREREQUISITESERVICE_H
@@ -14,8 +14,119 @@
 #include <map>
 #include <optional>
 #include <expected> // (➕)
+#include <span>
 #include "../../../common/ErrorType.h" // (➕)
 #include "../../entities/CourseResult.h"
+#include "../../analytics/MarksColumn.h"
+#include "../GpaSimulator.h"
+
+/**
+ * @struct CourseGradeStatistics
+ * @brief Thống kê điểm của một khóa học
+ */
+struct CourseGradeStatistics {
+    std::string courseId;         ///< ID của khóa học
+    GradeHistogram histogram;     ///< Phân bố điểm chữ
+    PassFailCounts passFail;      ///< Số lượng qua môn / trượt / chưa có điểm
+    double averageGradePoint = 0; ///< Điểm hệ 4 trung bình của các kết quả đã có điểm
+};
+
+/**
+ * @struct MarkSheetEntry
+ * @brief Một dòng trong bảng điểm của khóa học
+ */
+struct MarkSheetEntry {
+    std::string studentId; ///< ID của sinh viên
+    int marks = -1;        ///< Điểm số
+};
+
+/**
+ * @struct MarkSheetRowError
+ * @brief Lỗi của một dòng trong bảng điểm
+ */
+struct MarkSheetRowError {
+    std::size_t rowIndex = 0; ///< Vị trí dòng trong bảng điểm (tính từ 0)
+    std::string studentId;    ///< ID của sinh viên ở dòng đó
+    Error error;              ///< Lỗi chi tiết
+};
+
+/**
+ * @struct MarkSheetResult
+ * @brief Kết quả nhập bảng điểm của một khóa học
+ */
+struct MarkSheetResult {
+    std::size_t savedCount = 0;              ///< Số dòng đã được ghi
+    std::vector<MarkSheetRowError> rowErrors; ///< Các dòng bị bỏ qua kèm lỗi
+
+    /**
+     * @brief Kiểm tra tất cả các dòng đều được ghi
+     */
+    bool allSaved() const { return rowErrors.empty(); }
+};
+
+/**
+ * @struct MarkSheetImportLineError
+ * @brief Lỗi của một dòng trong file CSV bảng điểm
+ */
+struct MarkSheetImportLineError {
+    std::size_t lineNumber = 0; ///< Số dòng trong file (tính từ 1)
+    std::string studentId;      ///< ID sinh viên đọc được ở dòng đó (có thể rỗng)
+    std::string message;        ///< Mô tả lỗi
+};
+
+/**
+ * @struct MarkSheetImportReport
+ * @brief Báo cáo sau khi nhập bảng điểm từ file CSV
+ */
+struct MarkSheetImportReport {
+    std::size_t totalRows = 0;                       ///< Số dòng dữ liệu (không tính header, dòng trống)
+    std::size_t savedCount = 0;                      ///< Số dòng đã được ghi
+    std::size_t batchCount = 0;                      ///< Số lô đã commit
+    double elapsedSeconds = 0;                       ///< Tổng thời gian nhập
+    std::vector<MarkSheetImportLineError> lineErrors; ///< Lỗi theo từng dòng, sắp xếp theo số dòng
+
+    /**
+     * @brief Tốc độ nhập (dòng/giây)
+     */
+    double rowsPerSecond() const { return elapsedSeconds > 0 ? static_cast<double>(totalRows) / elapsedSeconds : 0.0; }
+};
+
+/**
+ * @enum GradeCurveMethod
+ * @brief Cách điều chỉnh điểm của cả khóa học
+ */
+enum class GradeCurveMethod {
+    LINEAR,  ///< new = scale * marks + offset
+    Z_SCORE, ///< Đưa trung bình và độ lệch chuẩn của các điểm đã có về targetMean, targetStdDev
+    CAP      ///< Chỉ giới hạn điểm tối đa bằng cap
+};
+
+/**
+ * @struct GradeCurvePolicy
+ * @brief Tham số điều chỉnh điểm; kết quả luôn được làm tròn và giới hạn trong [0, cap]
+ */
+struct GradeCurvePolicy {
+    GradeCurveMethod method = GradeCurveMethod::LINEAR; ///< Cách điều chỉnh
+    double scale = 1.0;                                 ///< Hệ số nhân (LINEAR), trong [0, 16]
+    double offset = 0.0;                                ///< Số cộng thêm (LINEAR), trong [-100, 100]
+    double targetMean = 70.0;                           ///< Điểm trung bình mong muốn (Z_SCORE), trong [0, 100]
+    double targetStdDev = 10.0;                         ///< Độ lệch chuẩn mong muốn (Z_SCORE), trong [0, 50]
+    int cap = 100;                                      ///< Điểm tối đa sau điều chỉnh, trong [0, 100]
+};
+
+/**
+ * @struct GradeCurveResult
+ * @brief Phân bố điểm trước và sau khi điều chỉnh
+ */
+struct GradeCurveResult {
+    std::string courseId;            ///< ID của khóa học
+    GradeHistogram before;           ///< Phân bố điểm chữ hiện tại
+    GradeHistogram after;            ///< Phân bố điểm chữ sau điều chỉnh
+    PassFailCounts passFailBefore;   ///< Số qua/trượt hiện tại
+    PassFailCounts passFailAfter;    ///< Số qua/trượt sau điều chỉnh
+    std::size_t changedCount = 0;    ///< Số kết quả bị đổi điểm
+    bool applied = false;            ///< Điểm mới đã được ghi hay chỉ là xem trước
+};
 
 /**
  * @class IResultService
@@ -49,6 +160,32 @@ public:
      * @return true nếu thành công, Error nếu thất bại
      */
     virtual std::expected<bool, Error> enterMultipleMarks(const std::string& studentId, const std::map<std::string, int>& courseMarksMap) = 0;
+
+    /**
+     * @brief Nhập bảng điểm cho toàn bộ sinh viên của một khóa học
+     * 
+     * Các dòng hợp lệ được ghi trong một giao dịch; các dòng không hợp lệ
+     * (sai định dạng, sai điểm, chưa đăng ký, trùng lặp) bị bỏ qua và được
+     * trả về trong MarkSheetResult::rowErrors.
+     * 
+     * @param courseId ID của khóa học
+     * @param entries Các dòng bảng điểm
+     * @return Kết quả nhập bảng điểm, hoặc Error nếu cả bảng điểm thất bại
+     */
+    virtual std::expected<MarkSheetResult, Error> enterCourseMarkSheet(const std::string& courseId, std::span<const MarkSheetEntry> entries) = 0;
+
+    /**
+     * @brief Nhập bảng điểm của một khóa học từ file CSV
+     * 
+     * File gồm các cột studentId, marks (dòng header là tùy chọn; nếu có header
+     * thì thứ tự cột được lấy theo tên). Ô điểm để trống hoặc "N/A" được hiểu là
+     * chưa có điểm. Các dòng hợp lệ được ghi theo lô, mỗi lô một giao dịch.
+     * 
+     * @param courseId ID của khóa học
+     * @param filePath Đường dẫn file CSV
+     * @return Báo cáo nhập (số dòng đã ghi, lỗi từng dòng, tốc độ), hoặc Error nếu không thể nhập
+     */
+    virtual std::expected<MarkSheetImportReport, Error> importCourseMarkSheetCsv(const std::string& courseId, const std::string& filePath) = 0;
     
     /**
      * @brief Lấy kết quả học tập cụ thể của sinh viên cho một môn học
@@ -90,6 +227,56 @@ public:
      * @return Điểm trung bình tích lũy nếu thành công, hoặc Error nếu thất bại
      */
     virtual std::expected<double, Error> calculateCGPA(const std::string& studentId) const = 0;
+
+    /**
+     * @brief Thống kê phân bố điểm và tỉ lệ qua môn của một khóa học
+     * 
+     * @param courseId ID của khóa học
+     * @return Thống kê điểm nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<CourseGradeStatistics, Error> getCourseGradeStatistics(const std::string& courseId) const = 0;
+
+    /**
+     * @brief Xem trước phân bố điểm của khóa học sau khi điều chỉnh, không ghi gì
+     * 
+     * @param courseId ID của khóa học
+     * @param policy Cách điều chỉnh
+     * @return Phân bố trước/sau, hoặc Error (VALIDATION_ERROR nếu tham số ngoài miền cho phép)
+     */
+    virtual std::expected<GradeCurveResult, Error> previewCourseCurve(const std::string& courseId, const GradeCurvePolicy& policy) const = 0;
+
+    /**
+     * @brief Điều chỉnh điểm của cả khóa học trong một giao dịch (Admin hoặc Teacher)
+     * 
+     * Điểm cũ của các kết quả bị đổi được giữ làm ảnh chụp để undoCourseCurve() khôi phục;
+     * mỗi khóa học chỉ giữ ảnh chụp của lần điều chỉnh gần nhất, trong suốt phiên chạy.
+     * 
+     * @param courseId ID của khóa học
+     * @param policy Cách điều chỉnh
+     * @return Phân bố trước/sau, hoặc Error nếu thất bại (khi đó không điểm nào bị đổi)
+     */
+    virtual std::expected<GradeCurveResult, Error> curveCourseMarks(const std::string& courseId, const GradeCurvePolicy& policy) = 0;
+
+    /**
+     * @brief Khôi phục điểm trước lần điều chỉnh gần nhất của khóa học
+     * 
+     * Kết quả đã bị sửa tay sau khi điều chỉnh được giữ nguyên.
+     * 
+     * @param courseId ID của khóa học
+     * @return Số kết quả đã khôi phục, hoặc Error (NOT_FOUND nếu không có ảnh chụp)
+     */
+    virtual std::expected<std::size_t, Error> undoCourseCurve(const std::string& courseId) = 0;
+
+    /**
+     * @brief Tạo bộ mô phỏng CGPA "nếu ... thì" cho sinh viên
+     * 
+     * Bảng điểm được nạp một lần; các môn đang học là các môn đã đăng ký nhưng chưa có điểm.
+     * Quyền truy cập giống getResultsByStudent (sinh viên chỉ xem được của chính mình).
+     * 
+     * @param studentId ID của sinh viên
+     * @return Bộ mô phỏng nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<GpaSimulator, Error> createGpaSimulator(const std::string& studentId) const = 0;
 };
 
 #endif // IRESULTSERVICE_H
\ No newline at end of file
@@ -0,0 +1,89 @@
+/**
+ * @file ITermService.h
+ * @brief Định nghĩa giao diện dịch vụ quản lý học kỳ
+ *
+ * Đăng ký và kết quả học tập được gắn với một học kỳ; học kỳ đã đóng chỉ được đọc.
+ */
+#ifndef ITERMSERVICE_H
+#define ITERMSERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/ITermDao.h" // AcademicTerm
+#include "../../analytics/MarksColumn.h"          // GradeHistogram, PassFailCounts
+
+/**
+ * @struct TermSummary
+ * @brief Thống kê đăng ký và điểm của một học kỳ
+ */
+struct TermSummary {
+    std::string termId;           ///< Mã học kỳ
+    bool closed = false;          ///< Học kỳ đã đóng (thống kê không còn thay đổi)
+    std::size_t enrollmentCount = 0; ///< Số bản ghi đăng ký trong học kỳ
+    GradeHistogram histogram;     ///< Phân bố điểm chữ
+    PassFailCounts passFail;      ///< Số lượng qua môn / trượt / chưa có điểm
+    double averageGradePoint = 0; ///< Điểm hệ 4 trung bình của các kết quả đã có điểm
+};
+
+/**
+ * @class ITermService
+ * @brief Giao diện dịch vụ quản lý học kỳ
+ */
+class ITermService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~ITermService() = default;
+
+    /**
+     * @brief Tạo học kỳ mới ở trạng thái mở (chỉ admin)
+     * @param term Học kỳ mới; ngày dạng YYYY-MM-DD, ngày bắt đầu không sau ngày kết thúc
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> createTerm(const AcademicTerm& term) = 0;
+
+    /**
+     * @brief Đóng học kỳ; đăng ký và kết quả của học kỳ trở thành chỉ đọc (chỉ admin)
+     * @param termId Mã học kỳ
+     * @return true nếu vừa đóng, false nếu đã đóng từ trước, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> closeTerm(const std::string& termId) = 0;
+
+    /**
+     * @brief Lấy mọi học kỳ
+     * @return Danh sách theo ngày bắt đầu, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<AcademicTerm>, Error> getAllTerms() const = 0;
+
+    /**
+     * @brief Học kỳ hiện tại: học kỳ đang mở có ngày bắt đầu gần nhất tính đến hôm nay
+     * @return Học kỳ hiện tại, hoặc Error (NOT_FOUND nếu không có)
+     */
+    virtual std::expected<AcademicTerm, Error> getCurrentTerm() const = 0;
+
+    /**
+     * @brief Chuyển một bản ghi đăng ký (và kết quả nếu có) sang học kỳ khác (chỉ admin)
+     * @param studentId ID của sinh viên
+     * @param courseId ID của khóa học
+     * @param termId Mã học kỳ đích; cả học kỳ cũ và mới phải đang mở
+     * @return true nếu thành công, hoặc Error (COURSE_ENROLLMENT_CLOSED nếu một trong hai học kỳ đã đóng)
+     */
+    virtual std::expected<bool, Error> assignEnrollmentTerm(const std::string& studentId, const std::string& courseId,
+                                                            const std::string& termId) = 0;
+
+    /**
+     * @brief Thống kê của một học kỳ (chỉ admin hoặc giảng viên)
+     *
+     * Chỉ đọc phân vùng của học kỳ đó. Thống kê của học kỳ đã đóng được lưu lại vĩnh viễn.
+     *
+     * @param termId Mã học kỳ
+     * @return Thống kê, hoặc Error (NOT_FOUND nếu không có học kỳ)
+     */
+    virtual std::expected<TermSummary, Error> getTermSummary(const std::string& termId) const = 0;
+};
+
+#endif // ITERMSERVICE_H
@@ -0,0 +1,71 @@
+/**
+ * @file ITuitionService.h
+ * @brief Định nghĩa giao diện dịch vụ tính học phí theo tín chỉ
+ *
+ * Học phí của sinh viên = tổng tín chỉ đã đăng ký x đơn giá tín chỉ của khoa; một lần tính lại
+ * áp dụng cho toàn trường và chỉ ghi các hồ sơ học phí thay đổi.
+ */
+#ifndef ITUITIONSERVICE_H
+#define ITUITIONSERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/ITuitionDao.h"     // TuitionChange
+#include "../../data_access/interface/ITuitionRateDao.h" // TuitionRate
+
+/**
+ * @struct TuitionRunReport
+ * @brief Kết quả một lần tính lại học phí
+ */
+struct TuitionRunReport {
+    std::size_t studentCount = 0;       ///< Tổng số sinh viên
+    std::size_t unratedCount = 0;       ///< Số sinh viên thuộc khoa chưa có đơn giá (giữ nguyên)
+    std::size_t unchangedCount = 0;     ///< Số sinh viên có học phí không đổi
+    std::size_t createdCount = 0;       ///< Số hồ sơ học phí mới được tạo
+    std::size_t updatedCount = 0;       ///< Số hồ sơ học phí được cập nhật
+    std::vector<TuitionChange> applied; ///< Các thay đổi đã ghi
+    std::vector<TuitionChange> blocked; ///< Các thay đổi không ghi vì học phí mới nhỏ hơn số đã đóng
+};
+
+/**
+ * @class ITuitionService
+ * @brief Giao diện dịch vụ tính học phí theo tín chỉ
+ */
+class ITuitionService {
+public:
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~ITuitionService() = default;
+
+    /**
+     * @brief Lấy bảng đơn giá tín chỉ của các khoa
+     * @return Danh sách đơn giá theo mã khoa, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<TuitionRate>, Error> getTuitionRates() const = 0;
+
+    /**
+     * @brief Đặt đơn giá tín chỉ của một khoa (chỉ admin)
+     * @param facultyId Mã khoa (phải tồn tại)
+     * @param ratePerCredit Học phí mỗi tín chỉ (>= 0)
+     * @return true nếu thành công, hoặc Error nếu thất bại
+     */
+    virtual std::expected<bool, Error> setTuitionRate(const std::string& facultyId, long ratePerCredit) = 0;
+
+    /**
+     * @brief Tính lại học phí của toàn trường và ghi các hồ sơ thay đổi trong một lần (chỉ admin)
+     *
+     * Các thay đổi làm học phí nhỏ hơn số đã đóng không được ghi mà được trả về trong
+     * TuitionRunReport::blocked để xử lý thủ công (ví dụ hoàn tiền). Chỉ các đăng ký của học kỳ hiện tại
+     * (và các đăng ký chưa gán học kỳ) được tính. Lịch trả góp của các hồ sơ thay đổi được chia lại theo
+     * tổng mới trong cùng transaction.
+     * @return Báo cáo các thay đổi, hoặc Error nếu thất bại (khi đó không hồ sơ nào bị ghi; VALIDATION_ERROR
+     *         nếu đã có học kỳ nhưng không học kỳ nào đang diễn ra)
+     */
+    virtual std::expected<TuitionRunReport, Error> recomputeTuition() = 0;
+};
+
+#endif // ITUITIONSERVICE_H
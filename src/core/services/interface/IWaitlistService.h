@@ -0,0 +1,84 @@
+/**
+ * @file IWaitlistService.h
+ * @brief Định nghĩa giao diện dịch vụ danh sách chờ của các khóa học đã đầy
+ *
+ * Sinh viên cùng khoa với khóa học được ưu tiên trước, trong cùng nhóm ưu tiên thì ai đăng ký
+ * chờ sớm hơn đứng trước. Khi khóa học có chỗ trống, người đứng đầu hàng được tự động đăng ký.
+ */
+#ifndef IWAITLISTSERVICE_H
+#define IWAITLISTSERVICE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <expected>
+#include "../../../common/ErrorType.h"
+#include "../../data_access/interface/IWaitlistDao.h" // WaitlistEntry
+
+/**
+ * @class IWaitlistService
+ * @brief Giao diện dịch vụ danh sách chờ
+ */
+class IWaitlistService {
+public:
+    static constexpr int SAME_FACULTY_PRIORITY = 0;  ///< Nhóm ưu tiên của sinh viên cùng khoa với khóa học
+    static constexpr int OTHER_FACULTY_PRIORITY = 1; ///< Nhóm ưu tiên của các sinh viên còn lại
+
+    /**
+     * @brief Hàm hủy ảo mặc định
+     */
+    virtual ~IWaitlistService() = default;
+
+    /**
+     * @brief Đăng ký chờ một khóa học đã hết chỗ
+     * @param studentId ID của sinh viên (sinh viên tự đăng ký, hoặc admin đăng ký thay)
+     * @param courseId ID của khóa học
+     * @return Vị trí chờ (bắt đầu từ 1), hoặc Error (VALIDATION_ERROR nếu khóa học còn chỗ hoặc không giới hạn chỗ,
+     *         COURSE_PREREQUISITE_NOT_MET nếu chưa qua môn tiên quyết,
+     *         COURSE_SCHEDULE_CONFLICT nếu khóa học trùng lịch với các khóa học đang đăng ký)
+     */
+    virtual std::expected<std::size_t, Error> joinWaitlist(const std::string& studentId, const std::string& courseId) = 0;
+
+    /**
+     * @brief Rời danh sách chờ
+     * @param studentId ID của sinh viên
+     * @param courseId ID của khóa học
+     * @return true nếu thành công, hoặc Error (NOT_FOUND nếu sinh viên không chờ khóa học này)
+     */
+    virtual std::expected<bool, Error> leaveWaitlist(const std::string& studentId, const std::string& courseId) = 0;
+
+    /**
+     * @brief Vị trí chờ hiện tại của sinh viên, O(log n)
+     * @param studentId ID của sinh viên
+     * @param courseId ID của khóa học
+     * @return Vị trí (bắt đầu từ 1), hoặc Error (NOT_FOUND nếu sinh viên không chờ khóa học này)
+     */
+    virtual std::expected<std::size_t, Error> getWaitlistPosition(const std::string& studentId, const std::string& courseId) = 0;
+
+    /**
+     * @brief Danh sách chờ của một khóa học theo thứ tự chờ (admin, giảng viên)
+     * @param courseId ID của khóa học
+     * @return Danh sách (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<WaitlistEntry>, Error> getWaitlist(const std::string& courseId) = 0;
+
+    /**
+     * @brief Các khóa học mà sinh viên đang chờ
+     * @param studentId ID của sinh viên
+     * @return Danh sách theo courseId (có thể rỗng), hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<WaitlistEntry>, Error> getWaitlistedCourses(const std::string& studentId) const = 0;
+
+    /**
+     * @brief Đăng ký người đứng đầu hàng vào các chỗ trống của các khóa học
+     *
+     * Mỗi khóa học (dù xuất hiện nhiều lần) được xử lý một lần trong một transaction: lấp mọi chỗ
+     * trống rồi xóa những người được đăng ký khỏi danh sách chờ. Nếu có lỗi, khóa học đang xử lý không
+     * thay đổi; các khóa học đã xử lý trước đó vẫn giữ kết quả.
+     * @param courseIds ID của các khóa học vừa có chỗ trống
+     * @return Những vị trí chờ đã được đăng ký, hoặc Error nếu thất bại
+     */
+    virtual std::expected<std::vector<WaitlistEntry>, Error> promoteWaitlisted(const std::vector<std::string>& courseIds) = 0;
+};
+
+#endif // IWAITLISTSERVICE_H
@@ -27,7 +27,8 @@ ValidationResult GeneralInputValidator::validateEmail(const std::string& email)
     // Regex này khá cơ bản, có thể cần một regex phức tạp hơn cho production
     // Tham khảo: RFC 5322 nhưng nó rất phức tạp.
     // Regex đơn giản: something@something.something
-    const std::regex email_regex(R"((\w+)(\.|_)?(\w*)@(\w+)(\.(\w+))+)"); // C++11 regex
+    // Biên dịch một lần (khởi tạo static an toàn luồng); regex_match trên regex const có thể gọi song song
+    static const std::regex email_regex(R"((\w+)(\.|_)?(\w*)@(\w+)(\.(\w+))+)", std::regex::optimize); // C++11 regex
     if (!std::regex_match(trimmedEmail, email_regex)) {
         vr.addError(ErrorCode::VALIDATION_ERROR, "Invalid email address format.");
     }
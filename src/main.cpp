@@ -33,9 +33,14 @@
 #include "core/services/impl/FacultyService.h"
 #include "core/services/impl/CourseService.h"
 #include "core/services/impl/EnrollmentService.h"
+#include "core/services/impl/WaitlistService.h"
+#include "core/services/impl/PrerequisiteService.h"
 #include "core/services/impl/ResultService.h"
 #include "core/services/impl/FinanceService.h"
+#include "core/services/impl/FinanceReportService.h"
 #include "core/services/impl/AdminService.h"
+#include "core/services/impl/IdSequenceService.h"
+#include "core/services/impl/ExportService.h"
 
 #include "ui/ConsoleUI.h"
 
@@ -110,7 +115,7 @@ int main(int argc, char* argv[]) {
     LOG_INFO("University Management System - Application Starting...");
     LOG_INFO("Configuration loaded. Data Source: " + 
              std::string(appConfig.dataSourceType == DataSourceType::SQL ? "SQL" : 
-                        (appConfig.dataSourceType == DataSourceType::MOCK ? "Mock" : "CSV (if implemented)")) +
+                        (appConfig.dataSourceType == DataSourceType::MOCK ? "Mock" : "CSV")) +
              ". Log Level: " + Logger::getInstance().levelToString(appConfig.logLevel));
     LOG_INFO("============================================================");
 
@@ -133,17 +138,27 @@ int main(int argc, char* argv[]) {
         auto courseResultDao = DaoFactory::createCourseResultDao(appConfig);
         auto feeRecordDao = DaoFactory::createFeeRecordDao(appConfig);
         auto salaryRecordDao = DaoFactory::createSalaryRecordDao(appConfig);        
+        auto sequenceDao = DaoFactory::createSequenceDao(appConfig);
+        auto transactionManager = DaoFactory::createTransactionManager(appConfig);
         LOG_INFO("DAOs initialized successfully.");
 
         // Khởi tạo các Service
         LOG_DEBUG("Initializing Services...");
+        auto idSequenceService = std::make_shared<IdSequenceService>(sequenceDao, studentDao, teacherDao);
+        auto sequenceInit = idSequenceService->ensureInitialized();
+        if (!sequenceInit.has_value()) {
+            LOG_WARN("Failed to rebuild student ID sequences at startup: " + sequenceInit.error().message);
+        }
+
         auto authService = std::make_shared<AuthService>(
             loginDao, 
             studentDao, 
             facultyDao,   
             teacherDao, 
             generalInputValidator, 
-            sessionContext
+            sessionContext,
+            idSequenceService,
+            transactionManager
         );   
 
         auto studentService = std::make_shared<StudentService>(
@@ -152,12 +167,20 @@ int main(int argc, char* argv[]) {
         
         auto teacherService = std::make_shared<TeacherService>(teacherDao, studentDao, facultyDao, generalInputValidator, sessionContext);
         auto facultyService = std::make_shared<FacultyService>(facultyDao, studentDao, teacherDao, courseDao, generalInputValidator, sessionContext);
-        auto courseService = std::make_shared<CourseService>(courseDao, facultyDao, enrollmentDao, courseResultDao, generalInputValidator, sessionContext);
-        auto enrollmentService = std::make_shared<EnrollmentService>(enrollmentDao, studentDao, courseDao, generalInputValidator, sessionContext);
+        auto timetableIndex = std::make_shared<TimetableIndex>();
+        auto prerequisiteService = std::make_shared<PrerequisiteService>(DaoFactory::createPrerequisiteDao(appConfig), courseDao, courseResultDao, generalInputValidator, sessionContext);
+        auto enrollmentPolicy = std::make_shared<EnrollmentPolicy>(enrollmentDao, studentDao, courseDao, timetableIndex, prerequisiteService);
+        auto waitlistService = std::make_shared<WaitlistService>(DaoFactory::createWaitlistDao(appConfig), enrollmentDao, studentDao, courseDao, generalInputValidator, sessionContext, transactionManager, enrollmentPolicy);
+        auto courseService = std::make_shared<CourseService>(courseDao, facultyDao, enrollmentDao, courseResultDao, generalInputValidator, sessionContext, timetableIndex, waitlistService);
+        auto enrollmentService = std::make_shared<EnrollmentService>(enrollmentDao, studentDao, courseDao, generalInputValidator, sessionContext, waitlistService, timetableIndex, enrollmentPolicy);
         auto resultService = std::make_shared<ResultService>(courseResultDao, facultyDao, studentDao, courseDao, enrollmentDao, generalInputValidator, sessionContext);
-        auto financeService = std::make_shared<FinanceService>(feeRecordDao, salaryRecordDao, studentDao, teacherDao, facultyDao, generalInputValidator, sessionContext);
+        auto financeReportService = std::make_shared<FinanceReportService>(DaoFactory::createFinanceReportDao(appConfig), sessionContext);
+        auto financeService = std::make_shared<FinanceService>(feeRecordDao, salaryRecordDao, studentDao, teacherDao, facultyDao, generalInputValidator, sessionContext, financeReportService, DaoFactory::createInstallmentDao(appConfig), transactionManager);
         auto adminService = std::make_shared<AdminService>(
-            studentDao, teacherDao, facultyDao,loginDao, feeRecordDao, salaryRecordDao, enrollmentDao, courseResultDao, generalInputValidator, sessionContext
+            studentDao, teacherDao, facultyDao,loginDao, feeRecordDao, salaryRecordDao, enrollmentDao, courseResultDao, generalInputValidator, sessionContext, idSequenceService, transactionManager, financeReportService
+        );
+        auto exportService = std::make_shared<ExportService>(
+            studentDao, teacherDao, facultyDao, courseDao, enrollmentDao, courseResultDao, feeRecordDao, salaryRecordDao, sessionContext
         );        
         LOG_INFO("Services initialized successfully.");
 
@@ -165,7 +188,7 @@ int main(int argc, char* argv[]) {
         LOG_DEBUG("Initializing ConsoleUI...");
         ConsoleUI consoleUI(
             authService, studentService, teacherService, facultyService,
-            courseService, enrollmentService, resultService, financeService, adminService
+            courseService, enrollmentService, resultService, financeService, adminService, exportService
         );        
         LOG_INFO("ConsoleUI initialized. Starting UI run loop...");
         
@@ -46,7 +46,8 @@ ConsoleUI::ConsoleUI(
     std::shared_ptr<IEnrollmentService> enrollmentService,
     std::shared_ptr<IResultService> resultService,
     std::shared_ptr<IFinanceService> financeService,
-    std::shared_ptr<IAdminService> adminService
+    std::shared_ptr<IAdminService> adminService,
+    std::shared_ptr<IExportService> exportService
 ) : _authService(std::move(authService)),
     _studentService(std::move(studentService)),
     _teacherService(std::move(teacherService)),
@@ -56,6 +57,7 @@ ConsoleUI::ConsoleUI(
     _resultService(std::move(resultService)),
     _financeService(std::move(financeService)),
     _adminService(std::move(adminService)),
+    _exportService(std::move(exportService)),
     _isRunning(true),
     _currentState(UnauthenticatedState{}) {
 
@@ -403,6 +405,7 @@ void ConsoleUI::handleState(AdminPanelState&) {
         {"3", "Faculty Management"},
         {"4", "Course Management"},
         {"5", "User Account Utilities"},
+        {"6", "Export Data (CSV / JSON Lines)"},
         {"8", "Change My Password"},
         {"9", "Logout"},
         {"0", "Exit Application"}
@@ -413,6 +416,7 @@ void ConsoleUI::handleState(AdminPanelState&) {
         [this]() { _currentState = AdminFacultyManagementState{}; },
         [this]() { _currentState = AdminCourseManagementState{}; },
         [this]() { _currentState = AdminAccountManagementState{}; },
+        [this]() { this->doAdminExportData(); },
         [this]() { _currentState = ChangePasswordPromptState{}; },
         [this]() { doLogout(); },
         [this]() { doExitApplication(); }
@@ -433,6 +437,7 @@ void ConsoleUI::handleState(StudentPanelState&) {
         {"4", "Drop an Enrolled Course"},
         {"5", "View My Fee Record"},
         {"6", "Make Fee Payment"},
+        {"7", "What-if GPA Simulator"},
         {"8", "Change My Password"},
         {"9", "Logout"},
         {"0", "Exit Application"}
@@ -444,6 +449,7 @@ void ConsoleUI::handleState(StudentPanelState&) {
         [this]() { this->doStudentDropCourse(); },
         [this]() { this->doStudentViewFeeRecord(); },
         [this]() { this->doStudentMakeFeePayment(); },
+        [this]() { this->doStudentWhatIfGpa(); },
         [this]() { _currentState = ChangePasswordPromptState{}; },
         [this]() { doLogout(); },
         [this]() { doExitApplication(); }
@@ -502,6 +508,7 @@ void ConsoleUI::handleState(TeacherPanelState&) {
  * - Xóa tài khoản sinh viên
  * - Xem tất cả sinh viên
  * - Tìm sinh viên theo ID
+ * - Nhập hồ sơ tuyển sinh từ file
  * 
  * @param state Tham chiếu đến đối tượng trạng thái
  */
@@ -514,6 +521,7 @@ void ConsoleUI::handleState(AdminStudentManagementState&) {
         {"5", "Remove Student Account (Admin)"},
         {"6", "View All Students"},
         {"7", "Find Student by ID"},
+        {"8", "Import Student Admissions from File (CSV/JSONL)"},
         {"0", "Back to Admin Panel"}
     };
     std::vector<std::function<void()>> actions = {
@@ -524,6 +532,7 @@ void ConsoleUI::handleState(AdminStudentManagementState&) {
         [this]() { this->doAdminRemoveStudent(); },
         [this]() { this->doAdminViewAllStudents(); },
         [this]() { this->doAdminFindStudentById(); },
+        [this]() { this->doAdminImportAdmissions(); },
         [this]() { _currentState = AdminPanelState{}; } 
     };
     processMenu("ADMIN - STUDENT MANAGEMENT", items, actions, true);
@@ -884,6 +893,56 @@ void ConsoleUI::doAdminAddStudent() {
     clearAndPause();
 }
 
+/**
+ * @brief Xử lý hành động nhập hồ sơ tuyển sinh từ file
+ * 
+ * Yêu cầu Admin nhập đường dẫn file và mật khẩu ban đầu mặc định (dùng cho các dòng
+ * không có cột password), sau đó hiển thị số sinh viên đã tạo và các dòng bị từ chối.
+ */
+void ConsoleUI::doAdminImportAdmissions() {
+    clearScreen();
+    drawHeader("ADMIN - IMPORT STUDENT ADMISSIONS");
+    std::cout << "Columns: email, firstName, lastName, facultyId, birthDay, birthMonth, birthYear, citizenId,\n"
+              << "         address, phoneNumber, password (optional). Use a .jsonl file for JSON Lines.\n";
+    std::string filePath = _prompter->promptForString("Enter file path:");
+    std::string defaultPassword;
+    if (_prompter->promptForYesNo("Set a default initial password for rows without a password column?")) {
+        defaultPassword = _prompter->promptForPassword("Enter default initial password:");
+    }
+
+    auto importResult = _adminService->importStudentAdmissions(filePath, defaultPassword);
+    if (!importResult.has_value()) {
+        showErrorMessage(importResult.error());
+        clearAndPause(); return;
+    }
+    const AdmissionImportReport& report = importResult.value();
+    std::ostringstream summary;
+    summary << report.admitted.size() << "/" << report.totalRows << " students admitted in " << report.batchCount << " batch(es), "
+            << std::fixed << std::setprecision(3) << report.elapsedSeconds << "s ("
+            << static_cast<long long>(report.rowsPerSecond()) << " rows/s).";
+    showSuccessMessage(summary.str());
+    for (const auto& entry : report.admitted) {
+        LOG_INFO("Admission import, line " + std::to_string(entry.lineNumber) + ": " + entry.email + " -> " + entry.studentId);
+    }
+    if (!report.lineErrors.empty()) {
+        const std::size_t maxShown = 20;
+        std::cout << report.lineErrors.size() << " line(s) were rejected:\n";
+        for (std::size_t i = 0; i < report.lineErrors.size() && i < maxShown; ++i) {
+            const auto& lineError = report.lineErrors[i];
+            std::cout << "  Line " << lineError.lineNumber
+                      << (lineError.email.empty() ? "" : " [" + lineError.email + "]")
+                      << ": " << lineError.message << "\n";
+        }
+        if (report.lineErrors.size() > maxShown) {
+            std::cout << "  ... and " << (report.lineErrors.size() - maxShown) << " more (see log file).\n";
+            for (std::size_t i = maxShown; i < report.lineErrors.size(); ++i) {
+                LOG_WARN("Admission import, line " + std::to_string(report.lineErrors[i].lineNumber) + ": " + report.lineErrors[i].message);
+            }
+        }
+    }
+    clearAndPause();
+}
+
 /**
  * @brief Xử lý hành động cập nhật thông tin sinh viên
  * 
@@ -1340,7 +1399,25 @@ void ConsoleUI::doAdminUpdateCourse() {
     std::string newFacultyId = _prompter->promptForString("New Faculty ID ["+courseExp.value().getFacultyId()+"]:", true);
     if(newFacultyId.empty()) newFacultyId = courseExp.value().getFacultyId();
 
+    std::string capacityStr = _prompter->promptForString("New Capacity, 0 = unlimited ["+std::to_string(courseExp.value().getCapacity())+"]:", true);
+    int newCapacity = courseExp.value().getCapacity();
+    if(!capacityStr.empty()){
+        try { newCapacity = std::stoi(capacityStr); }
+        catch(const std::exception&){ showErrorMessage("Invalid capacity format. Keeping old value."); }
+    }
+
+    std::string currentSchedule = MeetingSlot::formatSchedule(courseExp.value().getMeetingSlots());
+    std::string scheduleStr = _prompter->promptForString("New Schedule, e.g. \"Mon 07:30-09:30 E301; Wed 13:00-15:00 F201\", - = none ["+currentSchedule+"]:", true);
+    if(scheduleStr == "-") scheduleStr.clear();
+    else if(scheduleStr.empty()) scheduleStr = currentSchedule;
+
     auto result = _courseService->updateCourse(courseId, newName, newCredits, newFacultyId);
+    if(result.has_value() && result.value() && newCapacity != courseExp.value().getCapacity()){
+        result = _courseService->setCourseCapacity(courseId, newCapacity);
+    }
+    if(result.has_value() && result.value() && scheduleStr != currentSchedule){
+        result = _courseService->setCourseSchedule(courseId, scheduleStr);
+    }
     if(result.has_value() && result.value()){
         showSuccessMessage("Course details updated successfully.");
     } else {
@@ -1474,6 +1551,57 @@ void ConsoleUI::doAdminEnableUserAccount(){
     clearAndPause();
 }
 
+/**
+ * @brief Xử lý hành động xuất dữ liệu (Admin)
+ * 
+ * Cho phép Admin chọn định dạng, sau đó xuất tất cả các bảng vào một thư mục
+ * (tuần tự hoặc song song) hoặc xuất một bảng ra một file cụ thể.
+ */
+void ConsoleUI::doAdminExportData() {
+    clearScreen();
+    drawHeader("ADMIN - EXPORT DATA");
+    int formatChoice = _prompter->promptForInt("Format (1 = CSV, 2 = JSON Lines):", 1, 2);
+    ExportFormat format = formatChoice == 1 ? ExportFormat::CSV : ExportFormat::JSON_LINES;
+
+    auto describe = [](const ExportTableReport& report) {
+        std::ostringstream line;
+        line << report.filePath << ": " << report.rowCount << " rows, " << report.writeCount << " write(s), "
+             << std::fixed << std::setprecision(3) << report.elapsedSeconds << "s ("
+             << static_cast<long long>(report.rowsPerSecond()) << " rows/s)";
+        return line.str();
+    };
+
+    std::vector<EntityType> tables = _exportService->getExportableTables();
+    if (_prompter->promptForYesNo("Export all tables?")) {
+        std::string directory = _prompter->promptForString("Enter output directory:");
+        bool parallel = _prompter->promptForYesNo("Export tables in parallel?");
+        auto result = _exportService->exportTables(tables, directory, format, parallel);
+        if (!result.has_value()) {
+            showErrorMessage(result.error());
+            clearAndPause(); return;
+        }
+        for (const auto& report : result.value()) {
+            if (report.error) showErrorMessage(report.filePath + ": " + report.error->message);
+            else std::cout << "  " << describe(report) << "\n";
+        }
+        clearAndPause(); return;
+    }
+
+    for (std::size_t i = 0; i < tables.size(); ++i) {
+        std::cout << "  " << (i + 1) << ". " << _exportService->getDefaultFileName(tables[i], format) << "\n";
+    }
+    int tableChoice = _prompter->promptForInt("Select table:", 1, static_cast<int>(tables.size()));
+    EntityType table = tables[static_cast<std::size_t>(tableChoice - 1)];
+    std::string filePath = _prompter->promptForString("Enter output file path:");
+    auto result = _exportService->exportTable(table, filePath, format);
+    if (result.has_value()) {
+        showSuccessMessage("Exported " + describe(result.value()));
+    } else {
+        showErrorMessage(result.error());
+    }
+    clearAndPause();
+}
+
 // --- Student Actions ---
 /**
 * @brief Xử lý hành động xem thông tin cá nhân của sinh viên
@@ -1589,6 +1717,79 @@ void ConsoleUI::doStudentDropCourse() {
     clearAndPause();
 }
 
+/**
+ * @brief Xử lý hành động mô phỏng CGPA "nếu ... thì" (Sinh viên)
+ * 
+ * Bảng điểm chỉ được nạp một lần khi mở màn hình; mỗi lần thử điểm giả định hoặc
+ * đặt CGPA mục tiêu chỉ tính lại trên tổng đã tích lũy của bộ mô phỏng.
+ */
+void ConsoleUI::doStudentWhatIfGpa() {
+    if(!_authService->isAuthenticated() || !_authService->getCurrentUserId().has_value()) {
+        showErrorMessage("Not logged in."); clearAndPause(); return;
+    }
+    std::string studentId = _authService->getCurrentUserId().value();
+    drawHeader("WHAT-IF GPA SIMULATOR");
+    auto simulatorExp = _resultService->createGpaSimulator(studentId);
+    if(!simulatorExp.has_value()){
+        showErrorMessage(simulatorExp.error());
+        clearAndPause(); return;
+    }
+    const GpaSimulator& simulator = simulatorExp.value();
+    std::cout << "Current CGPA: " << std::fixed << std::setprecision(2) << simulator.currentCgpa()
+              << " over " << simulator.getGradedTotals().gradedCredits << " graded credit(s).\n";
+    if(simulator.getPendingCourses().empty()){
+        showErrorMessage("You have no in-progress courses to simulate.");
+        clearAndPause(); return;
+    }
+
+    while (true) {
+        std::cout << "\nIn-progress courses:\n";
+        std::vector<std::vector<std::string>> rows;
+        for (const auto& course : simulator.getPendingCourses()) {
+            rows.push_back({course.courseId, std::to_string(course.credits)});
+        }
+        _displayer->displayTable({"Course ID", "Credits"}, rows, {10, 10});
+        std::cout << "1. Try hypothetical marks\n2. Find marks needed for a target CGPA\n0. Back\n";
+        int choice = _prompter->promptForInt("Enter your choice:", 0, 2);
+        if (choice == 0) break;
+
+        if (choice == 1) {
+            std::map<std::string, int> hypothetical;
+            for (const auto& course : simulator.getPendingCourses()) {
+                hypothetical[course.courseId] = _prompter->promptForInt("Marks for " + course.courseId + " (0-100, -1 to skip):", -1, 100);
+            }
+            auto cgpaExp = simulator.simulate(hypothetical);
+            if (cgpaExp.has_value()) {
+                std::cout << "Simulated CGPA: " << std::fixed << std::setprecision(2) << cgpaExp.value() << "\n";
+            } else {
+                showErrorMessage(cgpaExp.error());
+            }
+            continue;
+        }
+
+        double target = _prompter->promptForDouble("Target CGPA (0-4):", 0.0, 4.0);
+        auto planExp = simulator.solveForTarget(target);
+        if (!planExp.has_value()) {
+            showErrorMessage(planExp.error());
+            continue;
+        }
+        const auto& plan = planExp.value();
+        if (!plan.reachable) {
+            std::cout << "Target not reachable: the best possible CGPA is " << std::fixed << std::setprecision(2)
+                      << plan.bestCaseCgpa << ".\n";
+            continue;
+        }
+        std::cout << "Scoring at least " << plan.uniformMinimumMarks << " in every in-progress course reaches the target.\n";
+        std::vector<std::vector<std::string>> planRows;
+        for (const auto& requirement : plan.perCourse) {
+            planRows.push_back({requirement.courseId, std::to_string(requirement.credits), std::to_string(requirement.minimumMarks)});
+        }
+        std::cout << "Lowest marks per course if every other course scores an A:\n";
+        _displayer->displayTable({"Course ID", "Credits", "Min Marks"}, planRows, {10, 10, 10});
+    }
+    clearAndPause();
+}
+
 /**
  * @brief Xử lý hành động xem hồ sơ học phí (Sinh viên)
  * 
@@ -1634,7 +1835,18 @@ void ConsoleUI::doStudentMakeFeePayment() {
     long amount = _prompter->promptForLong("Enter amount to pay (1 - " + std::to_string(feeExp.value().getDueFee()) + "):", 1, feeExp.value().getDueFee());
     
     if(_prompter->promptForYesNo("Confirm payment of " + std::to_string(amount) + " VND?")){
-        auto paymentResult = _financeService->makeFeePayment(studentId, amount);
+        // Một khóa cho cả lần thanh toán: thử lại sau lỗi (ví dụ mất kết nối sau khi đã ghi) không trừ tiền hai lần
+        const std::string paymentKey = _financeService->newPaymentKey();
+        auto paymentResult = _financeService->makeFeePayment(studentId, amount, paymentKey);
+        auto canRetry = [](const Error& error) {
+            return error.code != ErrorCode::VALIDATION_ERROR && error.code != ErrorCode::PERMISSION_DENIED &&
+                   error.code != ErrorCode::NOT_FOUND;
+        };
+        while (!paymentResult.has_value() && canRetry(paymentResult.error())) {
+            showErrorMessage(paymentResult.error());
+            if (!_prompter->promptForYesNo("Retry this payment?")) break;
+            paymentResult = _financeService->makeFeePayment(studentId, amount, paymentKey);
+        }
         if(paymentResult.has_value() && paymentResult.value()){
             showSuccessMessage("Payment of " + std::to_string(amount) + " successful.");
             auto receiptExp = _financeService->generateFeeReceipt(studentId, amount);
@@ -1642,8 +1854,8 @@ void ConsoleUI::doStudentMakeFeePayment() {
                 std::cout << "\n--- PAYMENT RECEIPT ---\n";
                 std::cout << receiptExp.value() << "\n";
             }
-        } else {
-            showErrorMessage(paymentResult.error());
+        } else if (!paymentResult.has_value() && !canRetry(paymentResult.error())) {
+            showErrorMessage(paymentResult.error()); // Lỗi có thể thử lại đã được hiển thị trong vòng lặp
         }
     } else {
         std::cout << "Payment cancelled.\n";
@@ -1691,6 +1903,38 @@ void ConsoleUI::doTeacherEnterMarks() {
     }
     std::cout << "Selected course: " << courseExp.value().getName() << " (" << courseId << ")\n";
 
+    if (_prompter->promptForYesNo("Import the whole grade sheet from a CSV file (studentId,marks)?")) {
+        std::string filePath = _prompter->promptForString("Enter CSV file path:");
+        auto importResult = _resultService->importCourseMarkSheetCsv(courseId, filePath);
+        if (!importResult.has_value()) {
+            showErrorMessage(importResult.error());
+            clearAndPause(); return;
+        }
+        const MarkSheetImportReport& report = importResult.value();
+        std::ostringstream summary;
+        summary << report.savedCount << "/" << report.totalRows << " rows saved in " << report.batchCount << " batch(es), "
+                << std::fixed << std::setprecision(3) << report.elapsedSeconds << "s ("
+                << static_cast<long long>(report.rowsPerSecond()) << " rows/s).";
+        showSuccessMessage(summary.str());
+        if (!report.lineErrors.empty()) {
+            const std::size_t maxShown = 20;
+            std::cout << report.lineErrors.size() << " line(s) were rejected:\n";
+            for (std::size_t i = 0; i < report.lineErrors.size() && i < maxShown; ++i) {
+                const auto& lineError = report.lineErrors[i];
+                std::cout << "  Line " << lineError.lineNumber
+                          << (lineError.studentId.empty() ? "" : " [" + lineError.studentId + "]")
+                          << ": " << lineError.message << "\n";
+            }
+            if (report.lineErrors.size() > maxShown) {
+                std::cout << "  ... and " << (report.lineErrors.size() - maxShown) << " more (see log file).\n";
+                for (std::size_t i = maxShown; i < report.lineErrors.size(); ++i) {
+                    LOG_WARN("Mark sheet import, line " + std::to_string(report.lineErrors[i].lineNumber) + ": " + report.lineErrors[i].message);
+                }
+            }
+        }
+        clearAndPause(); return;
+    }
+
     std::string studentId = _prompter->promptForString("Enter Student ID:");
     int marks = _prompter->promptForInt("Enter Marks (-1 for N/A, 0-100):", -1, 100);
 
@@ -25,6 +25,7 @@
 #include "../core/services/interface/IResultService.h"
 #include "../core/services/interface/IFinanceService.h"
 #include "../core/services/interface/IAdminService.h"
+#include "../core/services/interface/IExportService.h"
 
 // UI Helpers
 #include "view_helpers/InputPrompter.h"
@@ -143,6 +144,7 @@ private:
     std::shared_ptr<IResultService> _resultService; /**< Dịch vụ quản lý kết quả học tập */
     std::shared_ptr<IFinanceService> _financeService; /**< Dịch vụ quản lý tài chính */
     std::shared_ptr<IAdminService> _adminService; /**< Dịch vụ quản trị hệ thống */
+    std::shared_ptr<IExportService> _exportService; /**< Dịch vụ xuất dữ liệu */
 
     // UI Helpers
     std::unique_ptr<InputPrompter> _prompter; /**< Tiện ích nhập liệu từ người dùng */
@@ -284,6 +286,11 @@ private:
      * @brief Thêm sinh viên mới vào hệ thống
      */
     void doAdminAddStudent();
+
+    /**
+     * @brief Nhập hàng loạt hồ sơ tuyển sinh từ file CSV hoặc JSON Lines
+     */
+    void doAdminImportAdmissions();
     
     /**
      * @brief Cập nhật thông tin sinh viên
@@ -395,6 +402,11 @@ private:
      */
     void doAdminEnableUserAccount();
 
+    /**
+     * @brief Xuất một hoặc nhiều bảng dữ liệu ra file CSV/JSON Lines
+     */
+    void doAdminExportData();
+
     // --- Student Actions ---
     /**
      * @brief Xem thông tin chi tiết của sinh viên đang đăng nhập
@@ -426,6 +438,11 @@ private:
      */
     void doStudentMakeFeePayment();
 
+    /**
+     * @brief Mô phỏng CGPA với điểm giả định của các môn đang học và tìm điểm cần đạt cho CGPA mục tiêu
+     */
+    void doStudentWhatIfGpa();
+
     // --- Teacher Actions ---
     /**
      * @brief Xem thông tin chi tiết của giảng viên đang đăng nhập
@@ -584,6 +601,7 @@ public:
      * @param resultService Dịch vụ quản lý kết quả học tập
      * @param financeService Dịch vụ quản lý tài chính
      * @param adminService Dịch vụ quản trị hệ thống
+     * @param exportService Dịch vụ xuất dữ liệu
      */
     ConsoleUI(
         std::shared_ptr<IAuthService> authService,
@@ -594,7 +612,8 @@ public:
         std::shared_ptr<IEnrollmentService> enrollmentService,
         std::shared_ptr<IResultService> resultService,
         std::shared_ptr<IFinanceService> financeService,
-        std::shared_ptr<IAdminService> adminService
+        std::shared_ptr<IAdminService> adminService,
+        std::shared_ptr<IExportService> exportService
     );
 
     /**
@@ -2,6 +2,8 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm> // for std::transform
+#include <optional>
+#include <map>
 #include "../../utils/StringUtils.h" // Cho trim, toUpper
 #include "../../utils/Logger.h" // Để log
 
@@ -51,6 +53,29 @@ Logger::Level parseLogLevel(const std::string& str) {
     return Logger::Level::INFO; // Default
 }
 
+/**
+ * @brief Ánh xạ khóa trong mục [CsvFiles] sang loại thực thể
+ * 
+ * @param key Tên khóa (ví dụ: Students, CourseResults)
+ * @return Loại thực thể, hoặc std::nullopt nếu khóa không phải tên thực thể
+ */
+std::optional<EntityType> parseCsvEntityKey(const std::string& key) {
+    static const std::map<std::string, EntityType> keys = {
+        {"Students", EntityType::STUDENT},
+        {"Teachers", EntityType::TEACHER},
+        {"Faculties", EntityType::FACULTY},
+        {"Courses", EntityType::COURSE},
+        {"Enrollments", EntityType::ENROLLMENT},
+        {"CourseResults", EntityType::COURSERESULT},
+        {"FeeRecords", EntityType::FEERECORD},
+        {"SalaryRecords", EntityType::SALARYRECORD},
+        {"Logins", EntityType::LOGIN}
+    };
+    auto it = keys.find(key);
+    if (it == keys.end()) return std::nullopt;
+    return it->second;
+}
+
 /**
  * @brief Đọc và phân tích file cấu hình
  * 
@@ -92,6 +117,24 @@ std::expected<AppConfig, Error> ConfigLoader::loadConfig() const { // (➕) Thay
                     config.dataSourceType = parseDataSourceType(value);
                 } else if (key == "SqlConnectionString") {
                     config.sqlConnectionString = value;
+                } else if (key == "SqlArchivePath") {
+                    config.sqlArchivePath = value;
+                } else if (key == "SqlShardDirectory") {
+                    config.sqlShardDirectory = value;
+                }
+            } else if (currentSection == "CsvFiles") {
+                if (key == "DataDirectory") {
+                    config.csvDataDirectory = value;
+                } else if (key == "CompactionThreshold") {
+                    try {
+                        config.csvCompactionThreshold = static_cast<std::size_t>(std::stoul(value));
+                    } catch (const std::exception&) {
+                        LOG_WARN("ConfigLoader: Invalid CompactionThreshold '" + value + "', keeping default.");
+                    }
+                } else if (auto entity = parseCsvEntityKey(key)) {
+                    config.csvFilePaths[*entity] = value;
+                } else {
+                    LOG_WARN("ConfigLoader: Unknown key '" + key + "' in [CsvFiles].");
                 }
             } else if (currentSection == "Logging") {
                 if (key == "LogLevel") {
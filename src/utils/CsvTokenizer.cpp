@@ -0,0 +1,102 @@
+#include "CsvTokenizer.h"
+
+CsvTokenizer::CsvTokenizer(std::string_view data, char delimiter)
+    : _data(data), _delimiter(delimiter) {
+    // Bỏ qua BOM UTF-8 do Excel thường ghi vào đầu file
+    if (_data.size() >= 3 && _data.substr(0, 3) == "\xEF\xBB\xBF") {
+        _pos = 3;
+    }
+}
+
+bool CsvTokenizer::nextRecord(std::vector<std::string_view>& fields) {
+    fields.clear();
+    _recordMalformed = false;
+    if (_pos >= _data.size()) return false;
+
+    _recordOffset = _pos;
+    _recordLine = _nextLine;
+    const std::size_t size = _data.size();
+
+    while (true) {
+        if (_pos < size && _data[_pos] == '"') {
+            // Trường trong dấu nháy: tìm dấu nháy đóng, bỏ qua cặp "" và đếm xuống dòng bên trong
+            std::size_t start = ++_pos;
+            std::size_t end = std::string_view::npos;
+            while (_pos < size) {
+                char c = _data[_pos];
+                if (c == '"') {
+                    if (_pos + 1 < size && _data[_pos + 1] == '"') { _pos += 2; continue; }
+                    end = _pos++;
+                    break;
+                }
+                if (c == '\n') ++_nextLine;
+                ++_pos;
+            }
+            if (end == std::string_view::npos) { // Hết dữ liệu mà chưa gặp dấu nháy đóng
+                _recordMalformed = true;
+                end = size;
+            }
+            fields.push_back(_data.substr(start, end - start));
+            // Sau dấu nháy đóng chỉ được phép là dấu phân cách hoặc xuống dòng
+            while (_pos < size && _data[_pos] != _delimiter && _data[_pos] != '\n' && _data[_pos] != '\r') {
+                _recordMalformed = true;
+                ++_pos;
+            }
+        } else {
+            std::size_t start = _pos;
+            while (_pos < size && _data[_pos] != _delimiter && _data[_pos] != '\n' && _data[_pos] != '\r') ++_pos;
+            fields.push_back(_data.substr(start, _pos - start));
+        }
+
+        if (_pos >= size) break;
+        char c = _data[_pos];
+        if (c == _delimiter) { ++_pos; continue; }
+        // Kết thúc bản ghi: \n, \r\n hoặc \r
+        if (c == '\r') ++_pos;
+        if (_pos < size && _data[_pos] == '\n') ++_pos;
+        ++_nextLine;
+        break;
+    }
+    return true;
+}
+
+std::size_t CsvTokenizer::recordLine() const { return _recordLine; }
+std::size_t CsvTokenizer::recordOffset() const { return _recordOffset; }
+std::size_t CsvTokenizer::position() const { return _pos; }
+bool CsvTokenizer::isRecordMalformed() const { return _recordMalformed; }
+
+std::string CsvTokenizer::unescapeField(std::string_view field) {
+    std::string value;
+    value.reserve(field.size());
+    for (std::size_t i = 0; i < field.size(); ++i) {
+        value.push_back(field[i]);
+        if (field[i] == '"' && i + 1 < field.size() && field[i + 1] == '"') ++i;
+    }
+    return value;
+}
+
+std::string CsvTokenizer::escapeField(std::string_view value, char delimiter) {
+    bool needsQuotes = !value.empty() && (value.front() == ' ' || value.back() == ' ' || value.front() == '"');
+    for (char c : value) {
+        if (c == delimiter || c == '"' || c == '\n' || c == '\r') { needsQuotes = true; break; }
+    }
+    if (!needsQuotes) return std::string(value);
+
+    std::string escaped;
+    escaped.reserve(value.size() + 2);
+    escaped.push_back('"');
+    for (char c : value) {
+        if (c == '"') escaped.push_back('"');
+        escaped.push_back(c);
+    }
+    escaped.push_back('"');
+    return escaped;
+}
+
+std::string_view CsvTokenizer::trimView(std::string_view field) {
+    const char* whitespace = " \t\r\n";
+    std::size_t first = field.find_first_not_of(whitespace);
+    if (first == std::string_view::npos) return {};
+    std::size_t last = field.find_last_not_of(whitespace);
+    return field.substr(first, last - first + 1);
+}
@@ -0,0 +1,92 @@
+/**
+ * @file CsvTokenizer.h
+ * @brief Định nghĩa bộ tách bản ghi CSV không sao chép dữ liệu
+ *
+ * CsvTokenizer duyệt một vùng nhớ chứa dữ liệu CSV (thường lấy từ MappedFile)
+ * và trả về từng bản ghi dưới dạng các std::string_view trỏ thẳng vào vùng nhớ
+ * gốc. Hỗ trợ trường đặt trong dấu nháy kép (có thể chứa dấu phân cách, xuống
+ * dòng và "" để biểu diễn một dấu nháy), xuống dòng LF/CRLF và BOM UTF-8.
+ */
+#ifndef CSVTOKENIZER_H
+#define CSVTOKENIZER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class CsvTokenizer
+ * @brief Bộ tách bản ghi CSV trả về string_view
+ *
+ * Với trường đặt trong dấu nháy, view trả về đã bỏ hai dấu nháy bao ngoài nhưng
+ * vẫn giữ nguyên "" bên trong; dùng unescapeField() khi cần giá trị chính xác.
+ */
+class CsvTokenizer {
+private:
+    std::string_view _data;          ///< Dữ liệu CSV
+    char _delimiter;                 ///< Ký tự phân cách trường
+    std::size_t _pos = 0;            ///< Vị trí đọc hiện tại
+    std::size_t _nextLine = 1;       ///< Số dòng (tính từ 1) tại vị trí đọc hiện tại
+    std::size_t _recordLine = 0;     ///< Số dòng bắt đầu của bản ghi vừa đọc
+    std::size_t _recordOffset = 0;   ///< Vị trí byte bắt đầu của bản ghi vừa đọc
+    bool _recordMalformed = false;   ///< Bản ghi vừa đọc có dấu nháy không hợp lệ
+
+public:
+    /**
+     * @brief Khởi tạo bộ tách
+     * @param data Dữ liệu CSV (phải sống lâu hơn bộ tách và các view trả về)
+     * @param delimiter Ký tự phân cách trường
+     */
+    explicit CsvTokenizer(std::string_view data, char delimiter = ',');
+
+    /**
+     * @brief Đọc bản ghi tiếp theo
+     * @param fields Danh sách trường của bản ghi (được xóa và ghi đè)
+     * @return true nếu đọc được một bản ghi, false nếu đã hết dữ liệu
+     */
+    bool nextRecord(std::vector<std::string_view>& fields);
+
+    /**
+     * @brief Số dòng (tính từ 1) nơi bản ghi vừa đọc bắt đầu
+     */
+    std::size_t recordLine() const;
+
+    /**
+     * @brief Vị trí byte nơi bản ghi vừa đọc bắt đầu
+     */
+    std::size_t recordOffset() const;
+
+    /**
+     * @brief Vị trí byte ngay sau bản ghi vừa đọc (bao gồm ký tự xuống dòng)
+     */
+    std::size_t position() const;
+
+    /**
+     * @brief Kiểm tra bản ghi vừa đọc có dấu nháy không đóng hoặc ký tự thừa sau dấu nháy
+     */
+    bool isRecordMalformed() const;
+
+    /**
+     * @brief Chuyển "" thành " trong một trường đã bỏ nháy bao ngoài
+     * @param field Trường trả về từ nextRecord
+     * @return Giá trị thực của trường
+     */
+    static std::string unescapeField(std::string_view field);
+
+    /**
+     * @brief Đặt trường trong dấu nháy nếu cần (chứa dấu phân cách, dấu nháy, xuống dòng
+     *        hoặc khoảng trắng ở hai đầu) để có thể đọc lại chính xác bằng CsvTokenizer
+     * @param value Giá trị cần ghi
+     * @param delimiter Ký tự phân cách trường
+     * @return Chuỗi đã được escape
+     */
+    static std::string escapeField(std::string_view value, char delimiter = ',');
+
+    /**
+     * @brief Bỏ khoảng trắng ở đầu và cuối một view (không cấp phát)
+     */
+    static std::string_view trimView(std::string_view field);
+};
+
+#endif // CSVTOKENIZER_H
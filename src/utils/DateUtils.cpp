@@ -0,0 +1,18 @@
+#include "DateUtils.h"
+#include <chrono>
+#include <cstdio>
+
+namespace DateUtils {
+    std::string todayIsoDate() {
+        return isoDateDaysAgo(0);
+    }
+
+    std::string isoDateDaysAgo(int days) {
+        const auto today = std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now());
+        const std::chrono::year_month_day date{today - std::chrono::days{days}};
+        char buffer[16];
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", static_cast<int>(date.year()),
+                      static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()));
+        return buffer;
+    }
+}
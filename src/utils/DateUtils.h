@@ -0,0 +1,32 @@
+/**
+ * @file DateUtils.h
+ * @brief Định nghĩa các hàm tiện ích về ngày tháng
+ *
+ * Mọi ngày được tính theo UTC và có dạng YYYY-MM-DD, trùng với date('now') mà các
+ * trigger SQL dùng, để ngày do dịch vụ tính so sánh được với ngày trong cơ sở dữ liệu.
+ */
+#ifndef DATEUTILS_H
+#define DATEUTILS_H
+
+#include <string>
+
+/**
+ * @namespace DateUtils
+ * @brief Namespace chứa các hàm tiện ích về ngày tháng
+ */
+namespace DateUtils {
+    /**
+     * @brief Ngày hôm nay theo UTC
+     * @return Chuỗi ngày dạng YYYY-MM-DD
+     */
+    std::string todayIsoDate();
+
+    /**
+     * @brief Ngày cách hôm nay một số ngày về trước, theo UTC
+     * @param days Số ngày lùi lại (âm để tiến tới)
+     * @return Chuỗi ngày dạng YYYY-MM-DD
+     */
+    std::string isoDateDaysAgo(int days);
+}
+
+#endif // DATEUTILS_H
@@ -0,0 +1,148 @@
+#include "JsonLineParser.h"
+#include <cstdint>
+
+namespace {
+    class Cursor {
+    private:
+        std::string_view _text;
+        std::size_t _pos = 0;
+
+    public:
+        explicit Cursor(std::string_view text) : _text(text) {}
+
+        void skipSpace() {
+            while (_pos < _text.size() && (_text[_pos] == ' ' || _text[_pos] == '\t' || _text[_pos] == '\r' || _text[_pos] == '\n')) ++_pos;
+        }
+        bool atEnd() const { return _pos >= _text.size(); }
+        char peek() const { return atEnd() ? '\0' : _text[_pos]; }
+        bool consume(char c) {
+            if (peek() != c) return false;
+            ++_pos;
+            return true;
+        }
+
+        Error error(const std::string& what) const {
+            return Error{ErrorCode::PARSING_ERROR, "Invalid JSON line at column " + std::to_string(_pos + 1) + ": " + what};
+        }
+
+        static void appendUtf8(std::string& out, std::uint32_t codePoint) {
+            if (codePoint < 0x80) {
+                out.push_back(static_cast<char>(codePoint));
+            } else if (codePoint < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            } else if (codePoint < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            } else {
+                out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+        }
+
+        std::expected<std::uint32_t, Error> readHex4() {
+            if (_pos + 4 > _text.size()) return std::unexpected(error("truncated \\u escape"));
+            std::uint32_t value = 0;
+            for (int i = 0; i < 4; ++i) {
+                char c = _text[_pos++];
+                value <<= 4;
+                if (c >= '0' && c <= '9') value |= static_cast<std::uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') value |= static_cast<std::uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') value |= static_cast<std::uint32_t>(c - 'A' + 10);
+                else return std::unexpected(error("invalid \\u escape"));
+            }
+            return value;
+        }
+
+        std::expected<std::string, Error> readString() {
+            if (!consume('"')) return std::unexpected(error("expected '\"'"));
+            std::string out;
+            while (true) {
+                // Sao chép nguyên đoạn không có ký tự đặc biệt
+                std::size_t start = _pos;
+                while (_pos < _text.size() && _text[_pos] != '"' && _text[_pos] != '\\') ++_pos;
+                out.append(_text.substr(start, _pos - start));
+                if (atEnd()) return std::unexpected(error("unterminated string"));
+                if (_text[_pos++] == '"') return out;
+
+                if (atEnd()) return std::unexpected(error("unterminated escape"));
+                char escaped = _text[_pos++];
+                switch (escaped) {
+                    case '"': out.push_back('"'); break;
+                    case '\\': out.push_back('\\'); break;
+                    case '/': out.push_back('/'); break;
+                    case 'b': out.push_back('\b'); break;
+                    case 'f': out.push_back('\f'); break;
+                    case 'n': out.push_back('\n'); break;
+                    case 'r': out.push_back('\r'); break;
+                    case 't': out.push_back('\t'); break;
+                    case 'u': {
+                        auto high = readHex4();
+                        if (!high) return std::unexpected(high.error());
+                        std::uint32_t codePoint = *high;
+                        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                            if (!consume('\\') || !consume('u')) return std::unexpected(error("unpaired surrogate"));
+                            auto low = readHex4();
+                            if (!low) return std::unexpected(low.error());
+                            if (*low < 0xDC00 || *low > 0xDFFF) return std::unexpected(error("unpaired surrogate"));
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (*low - 0xDC00);
+                        }
+                        appendUtf8(out, codePoint);
+                        break;
+                    }
+                    default:
+                        return std::unexpected(error(std::string("unknown escape '\\") + escaped + "'"));
+                }
+            }
+        }
+
+        std::expected<std::string, Error> readScalar() {
+            char c = peek();
+            if (c == '"') return readString();
+            if (c == '{' || c == '[') return std::unexpected(error("nested objects and arrays are not supported"));
+            std::size_t start = _pos;
+            while (!atEnd() && peek() != ',' && peek() != '}' && peek() != ' ' && peek() != '\t') ++_pos;
+            std::string_view token = _text.substr(start, _pos - start);
+            if (token == "null") return std::string();
+            if (token == "true" || token == "false") return std::string(token);
+            if (token.empty()) return std::unexpected(error("missing value"));
+            for (char d : token) {
+                if (!((d >= '0' && d <= '9') || d == '-' || d == '+' || d == '.' || d == 'e' || d == 'E')) {
+                    return std::unexpected(error("invalid value '" + std::string(token) + "'"));
+                }
+            }
+            return std::string(token);
+        }
+    };
+}
+
+std::expected<std::vector<JsonLineParser::Field>, Error> JsonLineParser::parseObject(std::string_view line) {
+    Cursor cursor(line);
+    std::vector<Field> fields;
+    cursor.skipSpace();
+    if (!cursor.consume('{')) return std::unexpected(cursor.error("expected '{'"));
+    cursor.skipSpace();
+    if (!cursor.consume('}')) {
+        while (true) {
+            cursor.skipSpace();
+            auto key = cursor.readString();
+            if (!key) return std::unexpected(key.error());
+            cursor.skipSpace();
+            if (!cursor.consume(':')) return std::unexpected(cursor.error("expected ':'"));
+            cursor.skipSpace();
+            auto value = cursor.readScalar();
+            if (!value) return std::unexpected(value.error());
+            fields.emplace_back(std::move(*key), std::move(*value));
+            cursor.skipSpace();
+            if (cursor.consume(',')) continue;
+            if (cursor.consume('}')) break;
+            return std::unexpected(cursor.error("expected ',' or '}'"));
+        }
+    }
+    cursor.skipSpace();
+    if (!cursor.atEnd()) return std::unexpected(cursor.error("unexpected trailing characters"));
+    return fields;
+}
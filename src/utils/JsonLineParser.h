@@ -0,0 +1,38 @@
+/**
+ * @file JsonLineParser.h
+ * @brief Định nghĩa bộ phân tích một dòng JSON Lines dạng object phẳng
+ *
+ * Dùng để đọc các file nhập liệu JSON Lines (mỗi dòng một object gồm các cặp
+ * khóa/giá trị vô hướng), tương ứng với đầu ra JSON_LINES của RecordWriter.
+ */
+#ifndef JSONLINEPARSER_H
+#define JSONLINEPARSER_H
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <expected>
+#include "../common/ErrorType.h"
+
+/**
+ * @class JsonLineParser
+ * @brief Phân tích một JSON object phẳng thành danh sách cặp khóa/giá trị
+ *
+ * Giá trị chuỗi được giải mã escape (kể cả \\uXXXX sang UTF-8), số và true/false
+ * được giữ nguyên dạng văn bản, null trở thành chuỗi rỗng. Object hoặc mảng lồng
+ * nhau không được hỗ trợ và bị báo lỗi.
+ */
+class JsonLineParser {
+public:
+    using Field = std::pair<std::string, std::string>; ///< Cặp khóa/giá trị
+
+    /**
+     * @brief Phân tích một dòng
+     * @param line Nội dung dòng (không gồm ký tự xuống dòng)
+     * @return Các cặp khóa/giá trị theo thứ tự xuất hiện, hoặc Error (PARSING_ERROR) nếu dòng không hợp lệ
+     */
+    static std::expected<std::vector<Field>, Error> parseObject(std::string_view line);
+};
+
+#endif // JSONLINEPARSER_H
@@ -0,0 +1,123 @@
+#include "MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+std::expected<MappedFile, Error> MappedFile::open(const std::string& filePath) {
+    MappedFile mapped;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        DWORD err = GetLastError();
+        if (err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND) {
+            return std::unexpected(Error{ErrorCode::FILE_NOT_FOUND, "File not found: " + filePath});
+        }
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot open file: " + filePath});
+    }
+    mapped._fileHandle = file;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot read size of file: " + filePath});
+    }
+    mapped._size = static_cast<std::size_t>(fileSize.QuadPart);
+    if (mapped._size == 0) return mapped; // Không thể ánh xạ file rỗng
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot create file mapping: " + filePath});
+    }
+    mapped._mappingHandle = mapping;
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot map file into memory: " + filePath});
+    }
+    mapped._data = static_cast<const char*>(view);
+#else
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (errno == ENOENT) {
+            return std::unexpected(Error{ErrorCode::FILE_NOT_FOUND, "File not found: " + filePath});
+        }
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot open file: " + filePath});
+    }
+    struct stat st{};
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot read size of file: " + filePath});
+    }
+    mapped._size = static_cast<std::size_t>(st.st_size);
+    if (mapped._size == 0) { // mmap không chấp nhận độ dài 0
+        ::close(fd);
+        return mapped;
+    }
+    void* view = mmap(nullptr, mapped._size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Vùng ánh xạ vẫn hợp lệ sau khi đóng file descriptor
+    if (view == MAP_FAILED) {
+        mapped._size = 0;
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot map file into memory: " + filePath});
+    }
+    // Các bộ phân tích đọc tuần tự từ đầu đến cuối
+    madvise(view, mapped._size, MADV_SEQUENTIAL);
+    mapped._data = static_cast<const char*>(view);
+#endif
+    return mapped;
+}
+
+void MappedFile::release() {
+#ifdef _WIN32
+    if (_data) UnmapViewOfFile(_data);
+    if (_mappingHandle) CloseHandle(static_cast<HANDLE>(_mappingHandle));
+    if (_fileHandle) CloseHandle(static_cast<HANDLE>(_fileHandle));
+    _mappingHandle = nullptr;
+    _fileHandle = nullptr;
+#else
+    if (_data) munmap(const_cast<char*>(_data), _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _data(std::exchange(other._data, nullptr)),
+      _size(std::exchange(other._size, 0))
+#ifdef _WIN32
+      , _fileHandle(std::exchange(other._fileHandle, nullptr)),
+      _mappingHandle(std::exchange(other._mappingHandle, nullptr))
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+#ifdef _WIN32
+        _fileHandle = std::exchange(other._fileHandle, nullptr);
+        _mappingHandle = std::exchange(other._mappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+std::string_view MappedFile::view() const {
+    return _data ? std::string_view(_data, _size) : std::string_view();
+}
+
+std::size_t MappedFile::size() const { return _size; }
+bool MappedFile::empty() const { return _size == 0; }
@@ -0,0 +1,68 @@
+/**
+ * @file MappedFile.h
+ * @brief Định nghĩa lớp ánh xạ file vào bộ nhớ (chỉ đọc)
+ *
+ * Lớp MappedFile ánh xạ toàn bộ nội dung file vào bộ nhớ (mmap trên POSIX,
+ * MapViewOfFile trên Windows) để các bộ phân tích có thể đọc trực tiếp qua
+ * std::string_view mà không phải sao chép dữ liệu.
+ */
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <expected>
+#include "../common/ErrorType.h"
+
+/**
+ * @class MappedFile
+ * @brief Ánh xạ chỉ đọc một file vào bộ nhớ
+ *
+ * Đối tượng chỉ có thể di chuyển (không sao chép). Vùng nhớ được giải phóng
+ * khi đối tượng bị hủy, vì vậy mọi string_view lấy từ view() chỉ hợp lệ trong
+ * thời gian sống của đối tượng.
+ */
+class MappedFile {
+private:
+    const char* _data = nullptr; ///< Con trỏ đến vùng nhớ được ánh xạ
+    std::size_t _size = 0;       ///< Kích thước file (byte)
+#ifdef _WIN32
+    void* _fileHandle = nullptr;    ///< HANDLE của file
+    void* _mappingHandle = nullptr; ///< HANDLE của file mapping
+#endif
+
+    MappedFile() = default;
+    void release();
+
+public:
+    /**
+     * @brief Mở và ánh xạ file
+     * @param filePath Đường dẫn file
+     * @return Đối tượng MappedFile nếu thành công, hoặc Error nếu thất bại
+     */
+    static std::expected<MappedFile, Error> open(const std::string& filePath);
+
+    ~MappedFile();
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Toàn bộ nội dung file
+     */
+    std::string_view view() const;
+
+    /**
+     * @brief Kích thước file (byte)
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Kiểm tra file rỗng
+     */
+    bool empty() const;
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,22 @@
+#include "ParallelUtils.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace ParallelUtils {
+    void parallelForChunks(std::size_t count, std::size_t perWorker, const std::function<void(std::size_t, std::size_t)>& fn) {
+        std::size_t workerCount = std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(),
+                                                                                 count / std::max<std::size_t>(perWorker, 1)));
+        if (workerCount == 1) {
+            fn(0, count);
+            return;
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        std::size_t chunk = (count + workerCount - 1) / workerCount;
+        for (std::size_t begin = 0; begin < count; begin += chunk) {
+            workers.emplace_back(fn, begin, std::min(count, begin + chunk));
+        }
+        for (auto& worker : workers) worker.join();
+    }
+}
@@ -0,0 +1,33 @@
+/**
+ * @file ParallelUtils.h
+ * @brief Định nghĩa các hàm tiện ích chia việc cho nhiều luồng
+ *
+ * Namespace ParallelUtils gom cách chia một dải chỉ số thành các đoạn liên tiếp
+ * và xử lý mỗi đoạn trên một luồng riêng, dùng chung cho các bước kiểm tra và
+ * tính toán song song của tầng dịch vụ.
+ */
+#ifndef PARALLELUTILS_H
+#define PARALLELUTILS_H
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * @namespace ParallelUtils
+ * @brief Namespace chứa các hàm tiện ích xử lý song song
+ */
+namespace ParallelUtils {
+    /**
+     * @brief Chia [0, count) thành các đoạn liên tiếp và gọi fn(begin, end) cho mỗi đoạn trên một luồng
+     *
+     * Số luồng là min(số lõi, count / perWorker) và ít nhất là một; khi chỉ cần một luồng,
+     * fn(0, count) chạy ngay trên luồng gọi. Các đoạn không giao nhau nên fn có thể ghi
+     * vào phần tử của đoạn mình mà không cần khóa. Hàm trả về khi mọi đoạn đã xong.
+     * @param count Số phần tử cần xử lý
+     * @param perWorker Số phần tử tối thiểu để thêm một luồng
+     * @param fn Hàm xử lý đoạn [begin, end)
+     */
+    void parallelForChunks(std::size_t count, std::size_t perWorker, const std::function<void(std::size_t, std::size_t)>& fn);
+}
+
+#endif // PARALLELUTILS_H
@@ -28,8 +28,8 @@ namespace PasswordUtils {
      */
     std::string generateSalt(size_t length) {
         const std::string characters = "TDTH@!@PTPC";
-        std::random_device random_device;
-        std::mt19937 generator(random_device());
+        // Mỗi luồng gieo hạt một lần: mở random_device ở mỗi lần gọi rất chậm khi tạo hàng loạt tài khoản
+        thread_local std::mt19937 generator(std::random_device{}());
         std::uniform_int_distribution<> distribution(0, characters.length() - 1);
     
         std::string salt;
@@ -0,0 +1,252 @@
+#include "RecordWriter.h"
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+std::expected<RecordWriter, Error> RecordWriter::open(const std::string& filePath, Format format,
+                                                      const std::vector<std::string>& columns,
+                                                      std::size_t bufferSize) {
+    if (columns.empty()) {
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR, "RecordWriter requires at least one column."});
+    }
+    RecordWriter writer;
+    writer._filePath = filePath;
+    writer._tempPath = filePath + ".tmp";
+    writer._format = format;
+    writer._columnCount = columns.size();
+    writer._capacity = bufferSize < 4096 ? 4096 : bufferSize;
+    writer._buffer = std::make_unique<char[]>(writer._capacity);
+
+    writer._file = std::fopen(writer._tempPath.c_str(), "wb");
+    if (!writer._file) {
+        return std::unexpected(Error{ErrorCode::FILE_ACCESS_DENIED, "Cannot create export file: " + writer._tempPath});
+    }
+    // Bộ đệm của RecordWriter đã đủ lớn: tắt bộ đệm stdio để mỗi lần flush là đúng một lần ghi
+    std::setvbuf(writer._file, nullptr, _IONBF, 0);
+
+    if (format == Format::CSV) {
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            if (i > 0) writer.append(',');
+            writer.appendCsvEscaped(columns[i]);
+        }
+        writer.append('\n');
+    } else {
+        // Khóa JSON được escape một lần ở đây thay vì ở mỗi bản ghi
+        writer._jsonKeys.reserve(columns.size());
+        for (const auto& column : columns) {
+            std::string key = "\"";
+            for (char c : column) {
+                if (c == '"' || c == '\\') key.push_back('\\');
+                key.push_back(c);
+            }
+            key += "\":";
+            writer._jsonKeys.push_back(std::move(key));
+        }
+    }
+    return writer;
+}
+
+RecordWriter::~RecordWriter() {
+    discard();
+}
+
+RecordWriter::RecordWriter(RecordWriter&& other) noexcept
+    : _filePath(std::move(other._filePath)),
+      _tempPath(std::move(other._tempPath)),
+      _file(std::exchange(other._file, nullptr)),
+      _format(other._format),
+      _columnCount(other._columnCount),
+      _jsonKeys(std::move(other._jsonKeys)),
+      _buffer(std::move(other._buffer)),
+      _capacity(std::exchange(other._capacity, 0)),
+      _used(std::exchange(other._used, 0)),
+      _fieldIndex(std::exchange(other._fieldIndex, 0)),
+      _recordCount(std::exchange(other._recordCount, 0)),
+      _flushCount(std::exchange(other._flushCount, 0)),
+      _error(std::move(other._error)) {
+}
+
+RecordWriter& RecordWriter::operator=(RecordWriter&& other) noexcept {
+    if (this != &other) {
+        discard();
+        _filePath = std::move(other._filePath);
+        _tempPath = std::move(other._tempPath);
+        _file = std::exchange(other._file, nullptr);
+        _format = other._format;
+        _columnCount = other._columnCount;
+        _jsonKeys = std::move(other._jsonKeys);
+        _buffer = std::move(other._buffer);
+        _capacity = std::exchange(other._capacity, 0);
+        _used = std::exchange(other._used, 0);
+        _fieldIndex = std::exchange(other._fieldIndex, 0);
+        _recordCount = std::exchange(other._recordCount, 0);
+        _flushCount = std::exchange(other._flushCount, 0);
+        _error = std::move(other._error);
+    }
+    return *this;
+}
+
+void RecordWriter::discard() {
+    if (!_file) return;
+    std::fclose(_file);
+    _file = nullptr;
+    std::error_code ec;
+    std::filesystem::remove(_tempPath, ec);
+}
+
+// --- Bộ đệm ---
+
+void RecordWriter::flush() {
+    if (_used == 0 || !_file) return;
+    if (!_error && std::fwrite(_buffer.get(), 1, _used, _file) != _used) {
+        _error = Error{ErrorCode::FILE_WRITE_ERROR, "Failed to write export file: " + _tempPath};
+    }
+    ++_flushCount;
+    _used = 0;
+}
+
+void RecordWriter::append(const char* data, std::size_t length) {
+    if (_used + length > _capacity) {
+        flush();
+        if (length > _capacity) { // Trường lớn hơn cả bộ đệm: ghi thẳng
+            if (!_error && _file && std::fwrite(data, 1, length, _file) != length) {
+                _error = Error{ErrorCode::FILE_WRITE_ERROR, "Failed to write export file: " + _tempPath};
+            }
+            ++_flushCount;
+            return;
+        }
+    }
+    std::memcpy(_buffer.get() + _used, data, length);
+    _used += length;
+}
+
+void RecordWriter::append(char c) {
+    if (_used == _capacity) flush();
+    _buffer[_used++] = c;
+}
+
+// --- Trường ---
+
+void RecordWriter::beginField() {
+    if (_format == Format::CSV) {
+        if (_fieldIndex > 0) append(',');
+    } else {
+        append(_fieldIndex == 0 ? '{' : ',');
+        if (_fieldIndex < _jsonKeys.size()) {
+            const std::string& key = _jsonKeys[_fieldIndex];
+            append(key.data(), key.size());
+        }
+    }
+    ++_fieldIndex;
+}
+
+void RecordWriter::appendCsvEscaped(std::string_view value) {
+    // Cùng quy tắc với CsvTokenizer::escapeField, nhưng ghi thẳng vào bộ đệm
+    bool needsQuotes = !value.empty() && (value.front() == ' ' || value.back() == ' ' || value.front() == '"');
+    if (!needsQuotes) {
+        for (char c : value) {
+            if (c == ',' || c == '"' || c == '\n' || c == '\r') { needsQuotes = true; break; }
+        }
+    }
+    if (!needsQuotes) {
+        append(value.data(), value.size());
+        return;
+    }
+    append('"');
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        if (value[i] == '"') {
+            append(value.data() + start, i - start + 1);
+            append('"');
+            start = i + 1;
+        }
+    }
+    append(value.data() + start, value.size() - start);
+    append('"');
+}
+
+void RecordWriter::appendJsonEscaped(std::string_view value) {
+    static constexpr char HEX[] = "0123456789abcdef";
+    append('"');
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') continue; // Byte UTF-8 giữ nguyên
+        append(value.data() + start, i - start);
+        switch (c) {
+            case '"':  append("\\\"", 2); break;
+            case '\\': append("\\\\", 2); break;
+            case '\n': append("\\n", 2); break;
+            case '\r': append("\\r", 2); break;
+            case '\t': append("\\t", 2); break;
+            default: {
+                char escaped[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0x0F]};
+                append(escaped, sizeof(escaped));
+            }
+        }
+        start = i + 1;
+    }
+    append(value.data() + start, value.size() - start);
+    append('"');
+}
+
+void RecordWriter::writeField(std::string_view value) {
+    beginField();
+    if (_format == Format::CSV) appendCsvEscaped(value);
+    else appendJsonEscaped(value);
+}
+
+void RecordWriter::writeField(long long value) {
+    beginField();
+    char digits[24];
+    auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+    append(digits, static_cast<std::size_t>(end - digits));
+}
+
+void RecordWriter::writeNull() {
+    beginField();
+    if (_format == Format::JSON_LINES) append("null", 4);
+}
+
+std::expected<bool, Error> RecordWriter::endRecord() {
+    if (_fieldIndex != _columnCount) {
+        std::size_t written = _fieldIndex;
+        _fieldIndex = 0;
+        return std::unexpected(Error{ErrorCode::VALIDATION_ERROR,
+            "Record has " + std::to_string(written) + " fields, expected " + std::to_string(_columnCount) + "."});
+    }
+    if (_format == Format::JSON_LINES) append('}');
+    append('\n');
+    _fieldIndex = 0;
+    ++_recordCount;
+    if (_error) return std::unexpected(*_error);
+    return true;
+}
+
+std::expected<bool, Error> RecordWriter::close() {
+    if (!_file) {
+        return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Export file is not open: " + _filePath});
+    }
+    flush();
+    if (std::fclose(_file) != 0 && !_error) {
+        _error = Error{ErrorCode::FILE_WRITE_ERROR, "Failed to close export file: " + _tempPath};
+    }
+    _file = nullptr;
+    std::error_code ec;
+    if (_error) {
+        std::filesystem::remove(_tempPath, ec);
+        return std::unexpected(*_error);
+    }
+    std::filesystem::rename(_tempPath, _filePath, ec);
+    if (ec) {
+        std::string reason = ec.message();
+        std::filesystem::remove(_tempPath, ec);
+        return std::unexpected(Error{ErrorCode::FILE_WRITE_ERROR, "Cannot replace export file " + _filePath + ": " + reason});
+    }
+    return true;
+}
+
+std::size_t RecordWriter::recordCount() const { return _recordCount; }
+std::size_t RecordWriter::flushCount() const { return _flushCount; }
@@ -0,0 +1,128 @@
+/**
+ * @file RecordWriter.h
+ * @brief Định nghĩa bộ ghi bản ghi CSV/JSON Lines có bộ đệm lớn
+ *
+ * RecordWriter ghi từng trường trực tiếp vào một bộ đệm cố định (mặc định 1 MiB),
+ * escape tại chỗ mà không tạo chuỗi tạm, và chỉ gọi một lần ghi xuống file cho mỗi
+ * lần bộ đệm đầy. Dữ liệu được ghi vào "<file>.tmp" và chỉ đổi tên thành file đích
+ * khi close() thành công, nên một lần xuất bị gián đoạn không để lại file dở dang.
+ */
+#ifndef RECORDWRITER_H
+#define RECORDWRITER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <expected>
+#include <cstdio>
+#include <cstddef>
+#include "../common/ErrorType.h"
+
+/**
+ * @class RecordWriter
+ * @brief Bộ ghi bản ghi dạng bảng ra CSV (có dòng tiêu đề) hoặc JSON Lines (mỗi dòng một object)
+ *
+ * Cách dùng: gọi writeField()/writeNull() theo đúng thứ tự cột rồi endRecord(); cuối cùng
+ * gọi close(). Lỗi ghi được giữ lại và trả về ở endRecord()/close() tiếp theo.
+ */
+class RecordWriter {
+public:
+    /**
+     * @enum Format
+     * @brief Định dạng đầu ra
+     */
+    enum class Format {
+        CSV,        ///< RFC 4180, đọc lại được bằng CsvTokenizer
+        JSON_LINES  ///< Mỗi bản ghi là một JSON object trên một dòng, khóa là tên cột
+    };
+
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1 << 20; ///< Kích thước bộ đệm mặc định (1 MiB)
+
+    /**
+     * @brief Mở file đích để ghi
+     * @param filePath Đường dẫn file đích (ghi vào "<filePath>.tmp" cho đến khi close())
+     * @param format Định dạng đầu ra
+     * @param columns Tên các cột, theo thứ tự ghi
+     * @param bufferSize Kích thước bộ đệm; mỗi lần đầy là một lần ghi xuống file
+     * @return RecordWriter nếu thành công, FILE_ACCESS_DENIED nếu không tạo được file
+     */
+    static std::expected<RecordWriter, Error> open(const std::string& filePath, Format format,
+                                                   const std::vector<std::string>& columns,
+                                                   std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * @brief Hủy file tạm nếu close() chưa được gọi
+     */
+    ~RecordWriter();
+
+    RecordWriter(RecordWriter&& other) noexcept;
+    RecordWriter& operator=(RecordWriter&& other) noexcept;
+    RecordWriter(const RecordWriter&) = delete;
+    RecordWriter& operator=(const RecordWriter&) = delete;
+
+    /**
+     * @brief Ghi trường văn bản tiếp theo của bản ghi hiện tại
+     */
+    void writeField(std::string_view value);
+
+    /**
+     * @brief Ghi trường số nguyên tiếp theo (JSON Lines ghi dưới dạng số)
+     */
+    void writeField(long long value);
+
+    /**
+     * @brief Ghi trường rỗng (CSV: để trống, JSON Lines: null)
+     */
+    void writeNull();
+
+    /**
+     * @brief Kết thúc bản ghi hiện tại
+     * @return true nếu thành công, VALIDATION_ERROR nếu số trường khác số cột, FILE_WRITE_ERROR nếu ghi lỗi
+     */
+    std::expected<bool, Error> endRecord();
+
+    /**
+     * @brief Ghi phần còn lại của bộ đệm, đóng file và đổi tên file tạm thành file đích
+     * @return true nếu thành công, hoặc FILE_WRITE_ERROR
+     */
+    std::expected<bool, Error> close();
+
+    /**
+     * @brief Số bản ghi đã ghi
+     */
+    std::size_t recordCount() const;
+
+    /**
+     * @brief Số lần ghi bộ đệm xuống file
+     */
+    std::size_t flushCount() const;
+
+private:
+    RecordWriter() = default;
+
+    std::string _filePath;                     ///< File đích
+    std::string _tempPath;                     ///< File tạm đang ghi
+    std::FILE* _file = nullptr;                ///< File tạm (không dùng bộ đệm của stdio)
+    Format _format = Format::CSV;
+    std::size_t _columnCount = 0;
+    std::vector<std::string> _jsonKeys;        ///< "\"tên\":" đã escape sẵn cho JSON Lines
+    std::unique_ptr<char[]> _buffer;
+    std::size_t _capacity = 0;
+    std::size_t _used = 0;
+    std::size_t _fieldIndex = 0;               ///< Số trường đã ghi trong bản ghi hiện tại
+    std::size_t _recordCount = 0;
+    std::size_t _flushCount = 0;
+    std::optional<Error> _error;               ///< Lỗi ghi đầu tiên (giữ lại cho endRecord/close)
+
+    void append(const char* data, std::size_t length);
+    void append(char c);
+    void beginField();
+    void appendCsvEscaped(std::string_view value);
+    void appendJsonEscaped(std::string_view value);
+    void flush();
+    void discard();
+};
+
+#endif // RECORDWRITER_H
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/analytics/MarksColumn.h"
+#include "../../../src/core/entities/CourseResult.h"
+#include <random>
+#include <vector>
+
+namespace {
+    const MarksKernels::InstructionSet ALL_ISAS[] = {
+        MarksKernels::InstructionSet::SCALAR,
+        MarksKernels::InstructionSet::SSE4_1,
+        MarksKernels::InstructionSet::AVX2
+    };
+
+    // Cột điểm ngẫu nhiên, độ dài không chia hết cho 16 để kiểm tra cả phần đuôi scalar
+    MarksColumn makeRandomColumn(std::size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> marksDist(-1, 100);
+        std::uniform_int_distribution<int> creditsDist(1, 10);
+        MarksColumn column;
+        column.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            column.append(marksDist(rng), creditsDist(rng));
+        }
+        return column;
+    }
+}
+
+TEST(MarksColumnTest, AppendRejectsOutOfRangeValues) {
+    MarksColumn column;
+    EXPECT_TRUE(column.append(-1, 3));
+    EXPECT_TRUE(column.append(100, 3));
+    EXPECT_FALSE(column.append(-2, 3));
+    EXPECT_FALSE(column.append(101, 3));
+    EXPECT_FALSE(column.append(50, 256));
+    EXPECT_EQ(column.size(), 2u);
+}
+
+TEST(MarksColumnTest, GradePointsMatchCourseResultForEveryMark) {
+    MarksColumn column;
+    for (int marks = -1; marks <= 100; ++marks) column.append(marks, 1);
+
+    for (auto isa : ALL_ISAS) {
+        std::vector<std::int8_t> points(column.size());
+        MarksKernels::computeGradePoints(column.getMarks().data(), column.size(), points.data(), isa);
+        for (int marks = -1; marks <= 100; ++marks) {
+            CourseResult reference("S1", "C1", marks);
+            EXPECT_EQ(points[static_cast<std::size_t>(marks + 1)], GradeScale::gradePointFromGrade(reference.getGrade()))
+                << "marks=" << marks << " isa=" << MarksKernels::toString(isa);
+        }
+    }
+}
+
+TEST(MarksColumnTest, WeightedGradePointsMatchScalarPath) {
+    MarksColumn column = makeRandomColumn(1037, 42);
+
+    long long expectedPoints = 0;
+    long long expectedCredits = 0;
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        CourseResult reference("S1", "C1", column.getMarks()[i]);
+        int point = GradeScale::gradePointFromGrade(reference.getGrade());
+        if (point < 0) continue;
+        expectedPoints += static_cast<long long>(point) * column.getCredits()[i];
+        expectedCredits += column.getCredits()[i];
+    }
+
+    for (auto isa : ALL_ISAS) {
+        auto weighted = MarksKernels::weightedGradePoints(column.getMarks().data(), column.getCredits().data(), column.size(), isa);
+        EXPECT_EQ(weighted.weightedPoints, expectedPoints) << MarksKernels::toString(isa);
+        EXPECT_EQ(weighted.gradedCredits, expectedCredits) << MarksKernels::toString(isa);
+    }
+}
+
+TEST(MarksColumnTest, HistogramAndPassFailMatchScalarPath) {
+    MarksColumn column = makeRandomColumn(999, 7);
+
+    GradeHistogram expected;
+    PassFailCounts expectedPassFail;
+    for (auto marks : column.getMarks()) {
+        CourseResult reference("S1", "C1", marks);
+        char grade = reference.getGrade();
+        int point = GradeScale::gradePointFromGrade(grade);
+        expected.buckets[point < 0 ? GradeHistogram::UNGRADED_BUCKET : static_cast<std::size_t>(point)]++;
+        if (grade == '-') expectedPassFail.ungraded++;
+        else if (grade == 'F') expectedPassFail.failed++;
+        else expectedPassFail.passed++;
+    }
+
+    for (auto isa : ALL_ISAS) {
+        auto histogram = MarksKernels::gradeHistogram(column.getMarks().data(), column.size(), isa);
+        EXPECT_EQ(histogram.buckets, expected.buckets) << MarksKernels::toString(isa);
+        EXPECT_EQ(histogram.total(), column.size());
+
+        auto passFail = MarksKernels::passFailCounts(column.getMarks().data(), column.size(), isa);
+        EXPECT_EQ(passFail.passed, expectedPassFail.passed) << MarksKernels::toString(isa);
+        EXPECT_EQ(passFail.failed, expectedPassFail.failed) << MarksKernels::toString(isa);
+        EXPECT_EQ(passFail.ungraded, expectedPassFail.ungraded) << MarksKernels::toString(isa);
+    }
+}
+
+TEST(MarksColumnTest, AverageAndCountForGrade) {
+    MarksColumn column;
+    column.append(90, 4);  // A -> 4
+    column.append(60, 2);  // C -> 2
+    column.append(-1, 3);  // Chưa có điểm, không tính
+    auto weighted = column.weightedGradePoints();
+    EXPECT_EQ(weighted.gradedCredits, 6);
+    EXPECT_DOUBLE_EQ(weighted.average(), (4.0 * 4 + 2.0 * 2) / 6.0);
+
+    auto histogram = column.histogram();
+    EXPECT_EQ(histogram.countFor('A'), 1u);
+    EXPECT_EQ(histogram.countFor('C'), 1u);
+    EXPECT_EQ(histogram.countFor('-'), 1u);
+    EXPECT_EQ(histogram.countFor('X'), 0u);
+
+    EXPECT_DOUBLE_EQ(MarksColumn().weightedGradePoints().average(), 0.0);
+}
+
+TEST(MarksColumnTest, AffineKernelsMatchScalarReference) {
+    MarksColumn column = makeRandomColumn(1031, 46);
+    const MarksAffine transforms[] = {
+        MarksAffine::fromReal(1.0, 0.0, 80),      // Chỉ giới hạn điểm tối đa
+        MarksAffine::fromReal(1.15, -3.5),        // Tuyến tính, có làm tròn
+        MarksAffine::fromReal(0.37, 41.25, 95),
+        MarksAffine::fromReal(0.0, 70.0),         // Mọi điểm đã có thành 70
+        MarksAffine::fromReal(-1.0, 100.0)        // Hệ số âm vẫn phải khớp bản scalar
+    };
+    for (const auto& transform : transforms) {
+        std::vector<std::int16_t> expected(column.size());
+        for (std::size_t i = 0; i < column.size(); ++i) expected[i] = static_cast<std::int16_t>(transform.apply(column.getMarks()[i]));
+        for (auto isa : ALL_ISAS) {
+            std::vector<std::int16_t> curved(column.size());
+            MarksKernels::applyAffine(column.getMarks().data(), column.size(), curved.data(), transform, isa);
+            EXPECT_EQ(curved, expected) << MarksKernels::toString(isa);
+        }
+    }
+
+    EXPECT_EQ(MarksAffine::fromReal(1.0, 0.0, 80).apply(-1), -1);
+    EXPECT_EQ(MarksAffine::fromReal(1.1, 0.0).apply(95), 100);
+    EXPECT_EQ(MarksAffine::fromReal(0.5, 0.0).apply(45), 23); // 22.5 làm tròn lên
+    EXPECT_EQ(column.transformed(transforms[0]).getCredits(), column.getCredits());
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "core/data_access/UnitOfWork.h"
+#include "core/data_access/NullTransactionManager.h"
+#include "core/data_access/sql/SqlTransactionManager.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class UnitOfWorkTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::shared_ptr<SqlTransactionManager> manager;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        dbAdapter->connect(":memory:");
+        manager = std::make_shared<SqlTransactionManager>(dbAdapter);
+        ASSERT_TRUE(dbAdapter->executeUpdate("CREATE TABLE Items (id TEXT PRIMARY KEY) WITHOUT ROWID;").has_value());
+    }
+
+    // Ghi giống một DAO: mở transaction riêng, rollback nếu câu lệnh thất bại
+    bool daoInsert(const std::string& id) {
+        if (!dbAdapter->beginTransaction().has_value()) return false;
+        if (!dbAdapter->executeUpdate("INSERT INTO Items (id) VALUES (?);", {id}).has_value()) {
+            dbAdapter->rollbackTransaction();
+            return false;
+        }
+        return dbAdapter->commitTransaction().has_value();
+    }
+
+    long long itemCount() {
+        auto rows = dbAdapter->executeQuery("SELECT COUNT(*) AS total FROM Items;");
+        return rows.has_value() ? std::any_cast<long long>(rows->front().at("total")) : -1;
+    }
+};
+
+TEST_F(UnitOfWorkTest, DestroyedWithoutCommit_RollsBackNestedDaoWrites) {
+    {
+        auto unit = UnitOfWork::begin(manager);
+        ASSERT_TRUE(unit.has_value());
+        ASSERT_TRUE(daoInsert("A"));
+        ASSERT_TRUE(daoInsert("B"));
+        EXPECT_EQ(itemCount(), 2);
+    }
+    EXPECT_EQ(itemCount(), 0);
+    EXPECT_FALSE(dbAdapter->isInTransaction());
+}
+
+TEST_F(UnitOfWorkTest, FailedDaoWrite_OnlyRollsBackItsSavepoint) {
+    auto unit = UnitOfWork::begin(manager);
+    ASSERT_TRUE(unit.has_value());
+    ASSERT_TRUE(daoInsert("A"));
+    EXPECT_FALSE(daoInsert("A")); // Trùng khóa
+    ASSERT_TRUE(daoInsert("B"));
+    ASSERT_TRUE(unit->commit().has_value());
+    EXPECT_FALSE(unit->isActive());
+    EXPECT_EQ(itemCount(), 2);
+    EXPECT_FALSE(dbAdapter->isInTransaction());
+}
+
+TEST_F(UnitOfWorkTest, NonTransactionalSource_RunsCompensationsInReverseOrder) {
+    std::vector<int> undone;
+    {
+        auto unit = UnitOfWork::begin(std::make_shared<NullTransactionManager>());
+        ASSERT_TRUE(unit.has_value());
+        unit->addCompensation([&undone]() { undone.push_back(1); });
+        unit->addCompensation([&undone]() { undone.push_back(2); });
+    }
+    EXPECT_EQ(undone, (std::vector<int>{2, 1}));
+
+    undone.clear();
+    auto committed = UnitOfWork::begin(std::make_shared<NullTransactionManager>());
+    ASSERT_TRUE(committed.has_value());
+    committed->addCompensation([&undone]() { undone.push_back(1); });
+    ASSERT_TRUE(committed->commit().has_value());
+    EXPECT_TRUE(undone.empty());
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "../../../../src/core/data_access/csv/CsvEnrollmentDao.h"
+#include "../../../../src/core/data_access/csv/CsvCourseResultDao.h"
+#include "../../../../src/core/parsing/impl_csv_parser/EnrollmentRecordCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/CourseResultCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/CourseCsvParser.h"
+#include "../../../../src/common/ErrorType.h"
+#include <filesystem>
+
+class CsvEnrollmentDaoTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+    std::shared_ptr<CsvTable> courseTable;
+    std::shared_ptr<CsvEnrollmentDao> enrollments;
+    std::shared_ptr<CsvCourseResultDao> results;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / "csv_enrollment_dao_test";
+        std::filesystem::remove_all(dir);
+
+        auto enrollmentTable = std::make_shared<CsvTable>(dir / "enrollments.csv", CsvTableSchema{
+            EnrollmentRecordCsvParser::columns(),
+            {EnrollmentRecordCsvParser::STUDENT_ID, EnrollmentRecordCsvParser::COURSE_ID},
+            {EnrollmentRecordCsvParser::STUDENT_ID, EnrollmentRecordCsvParser::COURSE_ID}});
+        ASSERT_TRUE(enrollmentTable->load().has_value());
+        courseTable = std::make_shared<CsvTable>(dir / "courses.csv", CsvTableSchema{
+            CourseCsvParser::columns(), {CourseCsvParser::ID}, {CourseCsvParser::FACULTY_ID}});
+        ASSERT_TRUE(courseTable->load().has_value());
+        enrollments = std::make_shared<CsvEnrollmentDao>(enrollmentTable, std::make_shared<EnrollmentRecordCsvParser>(), courseTable);
+
+        auto resultTable = std::make_shared<CsvTable>(dir / "course_results.csv", CsvTableSchema{
+            CourseResultCsvParser::columns(),
+            {CourseResultCsvParser::STUDENT_ID, CourseResultCsvParser::COURSE_ID},
+            {CourseResultCsvParser::STUDENT_ID, CourseResultCsvParser::COURSE_ID}});
+        ASSERT_TRUE(resultTable->load().has_value());
+        results = std::make_shared<CsvCourseResultDao>(resultTable, std::make_shared<CourseResultCsvParser>());
+    }
+
+    void TearDown() override {
+        enrollments.reset();
+        courseTable.reset();
+        results.reset();
+        std::filesystem::remove_all(dir);
+    }
+};
+
+TEST_F(CsvEnrollmentDaoTest, EnrollLookupAndRemove) {
+    ASSERT_TRUE(enrollments->addEnrollment("S1", "CS101").has_value());
+    ASSERT_TRUE(enrollments->addEnrollment("S2", "CS101").has_value());
+    ASSERT_TRUE(enrollments->addEnrollment("S1", "MA101").has_value());
+
+    auto duplicate = enrollments->addEnrollment("S1", "CS101");
+    ASSERT_FALSE(duplicate.has_value());
+    EXPECT_EQ(duplicate.error().code, ErrorCode::ALREADY_EXISTS);
+
+    EXPECT_TRUE(enrollments->isEnrolled("S1", "MA101").value());
+    EXPECT_EQ(enrollments->findStudentIdsByCourseId("CS101")->size(), 2u);
+    EXPECT_EQ(enrollments->findCourseIdsByStudentId("S1")->size(), 2u);
+
+    ASSERT_TRUE(enrollments->removeEnrollmentsByCourse("CS101").has_value());
+    EXPECT_FALSE(enrollments->isEnrolled("S2", "CS101").value());
+    EXPECT_EQ(enrollments->getAllEnrollments()->size(), 1u);
+    EXPECT_EQ(enrollments->removeEnrollment("S2", "CS101").error().code, ErrorCode::NOT_FOUND);
+}
+
+TEST_F(CsvEnrollmentDaoTest, EnrollIfSeatAvailableHonorsCapacity) {
+    CourseCsvParser courseParser;
+    ASSERT_TRUE(courseTable->insert(*courseParser.serialize(Course("CS101", "Programming", 3, "IT", 2))).has_value());
+    ASSERT_TRUE(enrollments->enrollIfSeatAvailable("S1", "CS101").has_value());
+    ASSERT_TRUE(enrollments->enrollIfSeatAvailable("S2", "CS101").has_value());
+
+    EXPECT_EQ(enrollments->enrollIfSeatAvailable("S3", "CS101").error().code, ErrorCode::COURSE_CAPACITY_REACHED);
+    EXPECT_EQ(enrollments->enrollIfSeatAvailable("S1", "CS101").error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(enrollments->enrollIfSeatAvailable("S1", "MA101").error().code, ErrorCode::NOT_FOUND);
+
+    ASSERT_TRUE(enrollments->removeEnrollment("S1", "CS101").has_value());
+    EXPECT_TRUE(enrollments->enrollIfSeatAvailable("S3", "CS101").has_value());
+}
+
+TEST_F(CsvEnrollmentDaoTest, CourseResultBatchIsAllOrNothing) {
+    std::vector<CourseResult> batch = {CourseResult("S1", "CS101", 85), CourseResult("S2", "CS101", -1)};
+    ASSERT_TRUE(results->addOrUpdateBatch(batch).has_value());
+
+    auto s1 = results->find("S1", "CS101");
+    ASSERT_TRUE(s1.has_value());
+    EXPECT_EQ(s1->getMarks(), 85);
+    EXPECT_EQ(results->find("S2", "CS101")->getMarks(), -1);
+
+    std::vector<CourseResult> invalid = {CourseResult("S3", "CS101", 70), CourseResult("", "CS101", 60)};
+    auto rejected = results->addOrUpdateBatch(invalid);
+    ASSERT_FALSE(rejected.has_value());
+    EXPECT_EQ(rejected.error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(results->find("S3", "CS101").error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(results->findByCourseId("CS101")->size(), 2u);
+}
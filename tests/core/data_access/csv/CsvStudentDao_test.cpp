@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "../../../../src/core/data_access/csv/CsvStudentDao.h"
+#include "../../../../src/core/parsing/impl_csv_parser/StudentCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/LoginCredentialsCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/EnrollmentRecordCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/CourseResultCsvParser.h"
+#include "../../../../src/common/ErrorType.h"
+#include <filesystem>
+
+class CsvStudentDaoTest : public ::testing::Test {
+protected:
+    std::filesystem::path file;
+    std::shared_ptr<CsvTable> table;
+    std::shared_ptr<CsvStudentDao> dao;
+
+    static CsvTableSchema schema() {
+        return {StudentCsvParser::columns(), {StudentCsvParser::ID},
+                {StudentCsvParser::FACULTY_ID, StudentCsvParser::EMAIL, StudentCsvParser::STATUS}};
+    }
+
+    void SetUp() override {
+        file = std::filesystem::temp_directory_path() / "csv_student_dao_test" / "students.csv";
+        std::filesystem::remove_all(file.parent_path());
+        openDao();
+    }
+
+    void TearDown() override {
+        dao.reset();
+        table.reset();
+        std::filesystem::remove_all(file.parent_path());
+    }
+
+    void openDao() {
+        dao.reset();
+        table = std::make_shared<CsvTable>(file, schema());
+        ASSERT_TRUE(table->load().has_value());
+        dao = std::make_shared<CsvStudentDao>(table, std::make_shared<StudentCsvParser>());
+    }
+
+    static Student makeStudent(const std::string& id, const std::string& email, const std::string& facultyId = "IT") {
+        Student s(id, "Alice", "Smith", facultyId, LoginStatus::ACTIVE);
+        s.setBirthday(1, 1, 2000);
+        s.setEmail(email);
+        s.setCitizenId("0123456789");
+        s.setAddress("12 Nguyen Van Cu, Q5");
+        return s;
+    }
+};
+
+TEST_F(CsvStudentDaoTest, Constructor_NullDependencies_Throws) {
+    EXPECT_THROW(CsvStudentDao(nullptr, std::make_shared<StudentCsvParser>()), std::invalid_argument);
+    EXPECT_THROW(CsvStudentDao(table, nullptr), std::invalid_argument);
+}
+
+TEST_F(CsvStudentDaoTest, AddAndGetById_RoundTripsAllFields) {
+    Student student = makeStudent("S100", "alice@example.com");
+    ASSERT_TRUE(dao->add(student).has_value());
+
+    auto loaded = dao->getById("S100");
+    ASSERT_TRUE(loaded.has_value()) << loaded.error().message;
+    EXPECT_EQ(loaded->getFullName(), student.getFullName());
+    EXPECT_EQ(loaded->getEmail(), "alice@example.com");
+    EXPECT_EQ(loaded->getAddress(), "12 Nguyen Van Cu, Q5");
+    EXPECT_EQ(loaded->getBirthday().getYear(), 2000);
+    EXPECT_EQ(loaded->getStatus(), LoginStatus::ACTIVE);
+    EXPECT_EQ(loaded->getRole(), student.getRole());
+}
+
+TEST_F(CsvStudentDaoTest, Add_DuplicateIdOrEmail_Fails) {
+    ASSERT_TRUE(dao->add(makeStudent("S100", "alice@example.com")).has_value());
+
+    auto sameId = dao->add(makeStudent("S100", "other@example.com"));
+    ASSERT_FALSE(sameId.has_value());
+    EXPECT_EQ(sameId.error().code, ErrorCode::ALREADY_EXISTS);
+
+    auto sameEmail = dao->add(makeStudent("S101", "alice@example.com"));
+    ASSERT_FALSE(sameEmail.has_value());
+    EXPECT_EQ(sameEmail.error().code, ErrorCode::ALREADY_EXISTS);
+}
+
+TEST_F(CsvStudentDaoTest, FindByFacultyAndEmail_UseIndexes) {
+    ASSERT_TRUE(dao->add(makeStudent("S100", "a@example.com", "IT")).has_value());
+    ASSERT_TRUE(dao->add(makeStudent("S101", "b@example.com", "IT")).has_value());
+    ASSERT_TRUE(dao->add(makeStudent("S102", "c@example.com", "LAW")).has_value());
+
+    auto it = dao->findByFacultyId("IT");
+    ASSERT_TRUE(it.has_value());
+    EXPECT_EQ(it->size(), 2u);
+
+    auto byEmail = dao->findByEmail("c@example.com");
+    ASSERT_TRUE(byEmail.has_value());
+    EXPECT_EQ(byEmail->getId(), "S102");
+    EXPECT_EQ(dao->findByEmail("none@example.com").error().code, ErrorCode::NOT_FOUND);
+}
+
+TEST_F(CsvStudentDaoTest, ChangesPersistAcrossReload) {
+    ASSERT_TRUE(dao->add(makeStudent("S100", "a@example.com")).has_value());
+    ASSERT_TRUE(dao->add(makeStudent("S101", "b@example.com")).has_value());
+    ASSERT_TRUE(dao->updateStatus("S100", LoginStatus::DISABLED).has_value());
+    ASSERT_TRUE(dao->remove("S101").has_value());
+
+    openDao();
+    auto s100 = dao->getById("S100");
+    ASSERT_TRUE(s100.has_value());
+    EXPECT_EQ(s100->getStatus(), LoginStatus::DISABLED);
+    EXPECT_FALSE(dao->exists("S101").value());
+    EXPECT_EQ(dao->findByStatus(LoginStatus::DISABLED)->size(), 1u);
+}
+
+TEST_F(CsvStudentDaoTest, Remove_CascadesToLoginsEnrollmentsAndResults) {
+    const auto dir = file.parent_path();
+    auto logins = std::make_shared<CsvTable>(dir / "logins.csv", CsvTableSchema{LoginCredentialsCsvParser::columns(),
+                                             {LoginCredentialsCsvParser::USER_ID}, {LoginCredentialsCsvParser::STATUS}});
+    auto enrollments = std::make_shared<CsvTable>(dir / "enrollments.csv", CsvTableSchema{EnrollmentRecordCsvParser::columns(),
+                                                  {EnrollmentRecordCsvParser::STUDENT_ID, EnrollmentRecordCsvParser::COURSE_ID},
+                                                  {EnrollmentRecordCsvParser::STUDENT_ID, EnrollmentRecordCsvParser::COURSE_ID}});
+    auto results = std::make_shared<CsvTable>(dir / "results.csv", CsvTableSchema{CourseResultCsvParser::columns(),
+                                              {CourseResultCsvParser::STUDENT_ID, CourseResultCsvParser::COURSE_ID},
+                                              {CourseResultCsvParser::STUDENT_ID, CourseResultCsvParser::COURSE_ID}});
+    for (const auto& dependent : {logins, enrollments, results}) ASSERT_TRUE(dependent->load().has_value());
+    dao = std::make_shared<CsvStudentDao>(table, std::make_shared<StudentCsvParser>(), std::vector<CsvCascade>{
+        {logins, LoginCredentialsCsvParser::USER_ID},
+        {enrollments, EnrollmentRecordCsvParser::STUDENT_ID},
+        {results, CourseResultCsvParser::STUDENT_ID}});
+
+    LoginCredentialsCsvParser loginParser;
+    EnrollmentRecordCsvParser enrollmentParser;
+    CourseResultCsvParser resultParser;
+    for (const std::string id : {"S100", "S101"}) {
+        ASSERT_TRUE(dao->add(makeStudent(id, id + "@example.com")).has_value());
+        ASSERT_TRUE(logins->insert(loginParser.serialize(LoginCredentials{id, "hash", "salt", UserRole::STUDENT, LoginStatus::ACTIVE}).value()).has_value());
+        for (const std::string courseId : {"CS101", "CS102"}) {
+            EnrollmentRecord enrollment;
+            enrollment.studentId = id;
+            enrollment.courseId = courseId;
+            ASSERT_TRUE(enrollments->insert(enrollmentParser.serialize(enrollment).value()).has_value());
+            ASSERT_TRUE(results->insert(resultParser.serialize(CourseResult(id, courseId, 70)).value()).has_value());
+        }
+    }
+
+    ASSERT_TRUE(dao->remove("S100").has_value());
+    EXPECT_FALSE(logins->contains("S100"));
+    EXPECT_TRUE(enrollments->findBy(EnrollmentRecordCsvParser::STUDENT_ID, "S100").empty());
+    EXPECT_TRUE(results->findBy(CourseResultCsvParser::STUDENT_ID, "S100").empty());
+
+    // Dữ liệu của sinh viên khác không bị ảnh hưởng
+    EXPECT_TRUE(logins->contains("S101"));
+    EXPECT_EQ(enrollments->findBy(EnrollmentRecordCsvParser::STUDENT_ID, "S101").size(), 2u);
+    EXPECT_EQ(results->size(), 2u);
+    EXPECT_EQ(dao->remove("S100").error().code, ErrorCode::NOT_FOUND);
+}
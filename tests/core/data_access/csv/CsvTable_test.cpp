@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include "../../../../src/core/data_access/csv/CsvTable.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    // id, name, facultyId: khóa chính là id, chỉ mục trên facultyId
+    CsvTableSchema makeSchema() {
+        return {{"id", "name", "facultyId"}, {0}, {2}};
+    }
+
+    std::string readFile(const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        return buffer.str();
+    }
+}
+
+class CsvTableTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+    std::filesystem::path file;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / ("csv_table_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                                                        "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(dir);
+        file = dir / "items.csv";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+
+    void writeBase(const std::string& content) {
+        std::filesystem::create_directories(dir);
+        std::ofstream out(file, std::ios::binary);
+        out << content;
+    }
+};
+
+TEST_F(CsvTableTest, LoadCreatesFileWithHeader) {
+    CsvTable table(file, makeSchema());
+    ASSERT_TRUE(table.load().has_value());
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(readFile(file), "id,name,facultyId\n");
+}
+
+TEST_F(CsvTableTest, LoadParsesRowsAndBuildsIndexes) {
+    writeBase("id,name,facultyId\r\nC1,\"Intro, Part 1\",IT\r\nC2,Databases,IT\r\n\r\nC3,Ethics,LAW\r\nbroken,row\r\n");
+    CsvTable table(file, makeSchema());
+    ASSERT_TRUE(table.load().has_value());
+    EXPECT_EQ(table.size(), 3u);
+
+    auto c1 = table.find("C1");
+    ASSERT_TRUE(c1.has_value());
+    EXPECT_EQ((*c1)[1], "Intro, Part 1");
+
+    auto it = table.findBy(2, "IT");
+    ASSERT_EQ(it.size(), 2u);
+    EXPECT_EQ(it[0][0], "C1");
+    EXPECT_EQ(it[1][0], "C2");
+    EXPECT_TRUE(table.findBy(2, "NONE").empty());
+    EXPECT_EQ(table.findBy(1, "Ethics").size(), 1u); // Cột không có chỉ mục: quét toàn bảng
+}
+
+TEST_F(CsvTableTest, LoadRejectsMismatchedHeader) {
+    writeBase("id,title,facultyId\nC1,X,IT\n");
+    CsvTable table(file, makeSchema());
+    auto loaded = table.load();
+    ASSERT_FALSE(loaded.has_value());
+    EXPECT_EQ(loaded.error().code, ErrorCode::FILE_FORMAT_ERROR);
+}
+
+TEST_F(CsvTableTest, LoadPadsColumnsAppendedToSchema) {
+    writeBase("id,name\nC1,Intro\n");
+    CsvTable table(file, CsvTableSchema{{"id", "name", "facultyId"}, {0}, {2}});
+    ASSERT_TRUE(table.load().has_value());
+    EXPECT_EQ((*table.find("C1"))[2], "");
+
+    ASSERT_TRUE(table.compact().has_value());
+    EXPECT_EQ(readFile(file), "id,name,facultyId\nC1,Intro,\n");
+}
+
+TEST_F(CsvTableTest, InsertIfFewerCountsThroughIndex) {
+    CsvTable table(file, makeSchema());
+    ASSERT_TRUE(table.load().has_value());
+    ASSERT_TRUE(table.insertIfFewer({"C1", "A", "IT"}, 2, 2).has_value());
+    ASSERT_TRUE(table.insertIfFewer({"C2", "B", "IT"}, 2, 2).has_value());
+
+    auto full = table.insertIfFewer({"C3", "C", "IT"}, 2, 2);
+    ASSERT_FALSE(full.has_value());
+    EXPECT_EQ(full.error().code, ErrorCode::OPERATION_FAILED);
+    EXPECT_EQ(table.insertIfFewer({"C1", "A", "CS"}, 2, 2).error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_TRUE(table.insertIfFewer({"C3", "C", "CS"}, 2, 2).has_value());
+    EXPECT_TRUE(table.insertIfFewer({"C4", "D", "CS"}, 1, 1).has_value()); // Cột không có chỉ mục
+}
+
+TEST_F(CsvTableTest, MutationsReturnRepoErrorCodes) {
+    CsvTable table(file, makeSchema());
+    ASSERT_TRUE(table.load().has_value());
+    ASSERT_TRUE(table.insert({"C1", "A", "IT"}).has_value());
+
+    auto duplicate = table.insert({"C1", "B", "IT"});
+    ASSERT_FALSE(duplicate.has_value());
+    EXPECT_EQ(duplicate.error().code, ErrorCode::ALREADY_EXISTS);
+
+    auto missing = table.update({"C9", "B", "IT"});
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error().code, ErrorCode::NOT_FOUND);
+
+    auto wrongWidth = table.insert({"C2", "B"});
+    ASSERT_FALSE(wrongWidth.has_value());
+    EXPECT_EQ(wrongWidth.error().code, ErrorCode::VALIDATION_ERROR);
+
+    EXPECT_EQ(table.erase("C9").error().code, ErrorCode::NOT_FOUND);
+}
+
+TEST_F(CsvTableTest, InsertManyIsAllOrNothing) {
+    CsvTable table(file, makeSchema());
+    ASSERT_TRUE(table.load().has_value());
+    ASSERT_TRUE(table.insert({"C1", "A", "IT"}).has_value());
+
+    auto clash = table.insertMany({{"C2", "B", "IT"}, {"C1", "A2", "IT"}});
+    ASSERT_FALSE(clash.has_value());
+    EXPECT_EQ(clash.error().code, ErrorCode::ALREADY_EXISTS);
+    auto repeated = table.insertMany({{"C3", "C", "CS"}, {"C3", "C", "CS"}});
+    ASSERT_FALSE(repeated.has_value());
+    EXPECT_EQ(repeated.error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_EQ(table.journalEntryCount(), 1u);
+
+    ASSERT_TRUE(table.insertMany({{"C2", "B", "IT"}, {"C3", "C", "CS"}}).has_value());
+    EXPECT_EQ(table.size(), 3u);
+    EXPECT_EQ(table.findBy(2, "IT").size(), 2u);
+    EXPECT_EQ(table.journalEntryCount(), 3u);
+}
+
+TEST_F(CsvTableTest, UpdateMovesRowBetweenIndexBuckets) {
+    CsvTable table(file, makeSchema());
+    ASSERT_TRUE(table.load().has_value());
+    ASSERT_TRUE(table.insert({"C1", "A", "IT"}).has_value());
+    ASSERT_TRUE(table.update({"C1", "A", "LAW"}).has_value());
+    EXPECT_TRUE(table.findBy(2, "IT").empty());
+    EXPECT_EQ(table.findBy(2, "LAW").size(), 1u);
+
+    auto removed = table.eraseBy(2, "LAW");
+    ASSERT_TRUE(removed.has_value());
+    EXPECT_EQ(removed.value(), 1u);
+    EXPECT_EQ(table.size(), 0u);
+}
+
+TEST_F(CsvTableTest, JournalIsReplayedOnReopen) {
+    {
+        CsvTable table(file, makeSchema(), 1000);
+        ASSERT_TRUE(table.load().has_value());
+        ASSERT_TRUE(table.insert({"C1", "Line \"one\"\nand two", "IT"}).has_value());
+        ASSERT_TRUE(table.insert({"C2", "B", "IT"}).has_value());
+        ASSERT_TRUE(table.update({"C2", "B2", "CS"}).has_value());
+        ASSERT_TRUE(table.erase("C1").has_value());
+        ASSERT_TRUE(table.upsertMany({{"C3", "C", "CS"}, {"C4", " padded ", "CS"}}).has_value());
+        EXPECT_EQ(table.journalEntryCount(), 6u);
+    }
+    // File gốc chưa đổi, toàn bộ thay đổi nằm trong journal
+    EXPECT_EQ(readFile(file), "id,name,facultyId\n");
+
+    CsvTable reopened(file, makeSchema(), 1000);
+    ASSERT_TRUE(reopened.load().has_value());
+    EXPECT_FALSE(reopened.contains("C1"));
+    EXPECT_EQ((*reopened.find("C2"))[1], "B2");
+    EXPECT_EQ((*reopened.find("C4"))[1], " padded ");
+    EXPECT_EQ(reopened.findBy(2, "CS").size(), 3u);
+}
+
+TEST_F(CsvTableTest, IncompleteJournalTailIsIgnored) {
+    {
+        CsvTable table(file, makeSchema());
+        ASSERT_TRUE(table.load().has_value());
+        ASSERT_TRUE(table.insert({"C1", "A", "IT"}).has_value());
+    }
+    {
+        std::ofstream journal(file.string() + ".journal", std::ios::binary | std::ios::app);
+        journal << "U,C2,B"; // Dòng bị ghi dở
+    }
+    CsvTable reopened(file, makeSchema());
+    ASSERT_TRUE(reopened.load().has_value());
+    EXPECT_TRUE(reopened.contains("C1"));
+    EXPECT_FALSE(reopened.contains("C2"));
+}
+
+TEST_F(CsvTableTest, BackgroundCompactionRewritesBaseFile) {
+    {
+        CsvTable table(file, makeSchema(), 4);
+        ASSERT_TRUE(table.load().has_value());
+        for (int i = 0; i < 10; ++i) {
+            ASSERT_TRUE(table.upsert({"C" + std::to_string(i), "Name" + std::to_string(i), "IT"}).has_value());
+        }
+        table.waitForCompaction();
+        EXPECT_LT(table.journalEntryCount(), 10u); // Ít nhất một lần compaction đã xoay journal
+        EXPECT_FALSE(std::filesystem::exists(file.string() + ".journal.compacting"));
+        ASSERT_TRUE(table.compact().has_value());
+        EXPECT_EQ(table.journalEntryCount(), 0u);
+    }
+    std::string base = readFile(file);
+    EXPECT_NE(base.find("C9,Name9,IT"), std::string::npos);
+
+    CsvTable reopened(file, makeSchema());
+    ASSERT_TRUE(reopened.load().has_value());
+    EXPECT_EQ(reopened.size(), 10u);
+}
+
+TEST_F(CsvTableTest, InterruptedCompactionIsRecoveredOnLoad) {
+    writeBase("id,name,facultyId\nC1,A,IT\n");
+    {
+        std::ofstream compacting(file.string() + ".journal.compacting", std::ios::binary);
+        compacting << "U,C2,B,IT\n";
+        std::ofstream journal(file.string() + ".journal", std::ios::binary);
+        journal << "D,C1\n";
+    }
+    CsvTable table(file, makeSchema());
+    ASSERT_TRUE(table.load().has_value());
+    EXPECT_FALSE(table.contains("C1"));
+    EXPECT_TRUE(table.contains("C2"));
+    EXPECT_FALSE(std::filesystem::exists(file.string() + ".journal.compacting"));
+    EXPECT_EQ(readFile(file), "id,name,facultyId\nC2,B,IT\n");
+}
+
+TEST_F(CsvTableTest, CompositeKeys) {
+    CsvTable table(file, {{"studentId", "courseId", "marks"}, {0, 1}, {0, 1}});
+    ASSERT_TRUE(table.load().has_value());
+    ASSERT_TRUE(table.insert({"S1", "C1", "90"}).has_value());
+    ASSERT_TRUE(table.insert({"S1", "C2", "80"}).has_value());
+    EXPECT_TRUE(table.contains(CsvTable::compositeKey({"S1", "C2"})));
+    EXPECT_FALSE(table.contains(CsvTable::compositeKey({"S1C", "2"})));
+    EXPECT_EQ(table.findBy(0, "S1").size(), 2u);
+    ASSERT_TRUE(table.erase(CsvTable::compositeKey({"S1", "C1"})).has_value());
+    EXPECT_EQ(table.findBy(1, "C1").size(), 0u);
+}
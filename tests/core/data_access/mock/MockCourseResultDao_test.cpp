@@ -146,4 +146,31 @@ TEST_F(MockCourseResultDaoTest, RemoveAllForCourse_Success) {
     ASSERT_TRUE(otherCourse.has_value());
     EXPECT_EQ(otherCourse->size(), 1);
 }
-// --- END OF MODIFIED FILE tests/core/data_access/mock/MockCourseResultDao_test.cpp ---
\ No newline at end of file
+
+TEST_F(MockCourseResultDaoTest, AddOrUpdateBatch_WritesAllRows) {
+    std::vector<CourseResult> batch = {
+        makeResult("SV011_Batch", "CS600_Batch", 80),
+        makeResult("SV012_Batch", "CS600_Batch", 45)
+    };
+    auto res = dao.addOrUpdateBatch(batch);
+    ASSERT_TRUE(res.has_value()) << res.error().message;
+
+    auto byCourse = dao.findByCourseId("CS600_Batch");
+    ASSERT_TRUE(byCourse.has_value());
+    EXPECT_EQ(byCourse->size(), 2);
+}
+
+TEST_F(MockCourseResultDaoTest, AddOrUpdateBatch_InvalidRow_WritesNothing) {
+    std::vector<CourseResult> batch = {
+        makeResult("SV013_Batch", "CS601_Batch", 80),
+        makeResult("", "CS601_Batch", 70) // Thiếu ID sinh viên
+    };
+    auto res = dao.addOrUpdateBatch(batch);
+    ASSERT_FALSE(res.has_value());
+    EXPECT_EQ(res.error().code, ErrorCode::VALIDATION_ERROR);
+
+    auto byCourse = dao.findByCourseId("CS601_Batch");
+    ASSERT_TRUE(byCourse.has_value());
+    EXPECT_TRUE(byCourse->empty());
+}
+// --- END OF MODIFIED FILE tests/core/data_access/mock/MockCourseResultDao_test.cpp ---
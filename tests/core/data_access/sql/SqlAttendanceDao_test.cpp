@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlAttendanceDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlAttendanceDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlAttendanceDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlAttendanceDao>(dbAdapter);
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Courses (id, name, credits, facultyId) VALUES ('CS101', 'Course', 3, 'IT');").has_value());
+    }
+};
+
+TEST_F(SqlAttendanceDaoTest, StoresRosterAndBlobSessions) {
+    ASSERT_TRUE(dao->addToRoster("CS101", 0, "S002").has_value());
+    ASSERT_TRUE(dao->addToRoster("CS101", 1, "S001").has_value());
+    EXPECT_EQ(dao->addToRoster("CS101", 2, "S001").error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(dao->addToRoster("NOPE", 0, "S001").error().code, ErrorCode::NOT_FOUND);
+    auto roster = dao->getRoster("CS101");
+    ASSERT_TRUE(roster.has_value());
+    EXPECT_EQ(roster.value(), (std::vector<std::string>{"S002", "S001"}));
+
+    // Byte 0 ở giữa BLOB phải được giữ nguyên
+    ASSERT_TRUE(dao->saveSession(AttendanceSession{"CS101", 2, {0, 0, 3}}).has_value());
+    ASSERT_TRUE(dao->saveSession(AttendanceSession{"CS101", 1, {0, 1}}).has_value());
+    ASSERT_TRUE(dao->saveSession(AttendanceSession{"CS101", 1, {0, 2}}).has_value());
+    auto sessions = dao->getSessions("CS101");
+    ASSERT_TRUE(sessions.has_value());
+    ASSERT_EQ(sessions->size(), 2u);
+    EXPECT_EQ(sessions->at(0).presence, (std::vector<unsigned char>{0, 2}));
+    EXPECT_EQ(sessions->at(1).presence, (std::vector<unsigned char>{0, 0, 3}));
+    EXPECT_EQ(dao->findSession("CS101", 3).error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(dao->saveSession(AttendanceSession{"NOPE", 1, {0}}).error().code, ErrorCode::NOT_FOUND);
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlDegreeRequirementDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlDegreeRequirementDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlDegreeRequirementDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlDegreeRequirementDao>(dbAdapter);
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+    }
+};
+
+TEST_F(SqlDegreeRequirementDaoTest, UpsertsAndRemovesRequirement) {
+    ASSERT_TRUE(dao->upsert(DegreeRequirement{"IT", 120, 2.5, {"CS101", "CS201"}}).has_value());
+    ASSERT_TRUE(dao->upsert(DegreeRequirement{"IT", 130, 2.0, {}}).has_value());
+    auto requirements = dao->getAll();
+    ASSERT_TRUE(requirements.has_value());
+    ASSERT_EQ(requirements->size(), 1u);
+    EXPECT_EQ(requirements->front().minTotalCredits, 130);
+    EXPECT_DOUBLE_EQ(requirements->front().minCgpa, 2.0);
+    EXPECT_TRUE(requirements->front().requiredCourseIds.empty());
+
+    EXPECT_EQ(dao->upsert(DegreeRequirement{"NOPE", 10, 2.0, {}}).error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(dao->upsert(DegreeRequirement{"IT", 10, 4.5, {}}).error().code, ErrorCode::VALIDATION_ERROR);
+
+    ASSERT_TRUE(dao->remove("IT").has_value());
+    EXPECT_EQ(dao->remove("IT").error().code, ErrorCode::NOT_FOUND);
+}
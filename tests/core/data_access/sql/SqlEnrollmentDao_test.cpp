@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlEnrollmentDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+#include "core/parsing/impl_sql_parser/EnrollmentRecordSqlParser.h"
+
+class SqlEnrollmentDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlEnrollmentDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        // Dùng schema thật để các trigger Enrollments_seat_* được kiểm tra
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlEnrollmentDao>(dbAdapter, std::make_shared<EnrollmentRecordSqlParser>());
+
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate(
+            "INSERT INTO Courses (id, name, credits, facultyId, capacity) VALUES ('CS101', 'Programming', 3, 'IT', 2), "
+            "('CS102', 'Open Lecture', 2, 'IT', 0);").has_value());
+        for (int i = 1; i <= 4; ++i) addStudent("S00" + std::to_string(i));
+    }
+
+    void addStudent(const std::string& id) {
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES (?, 'Van', 'Nguyen', 1, 1);",
+                                             {id}).has_value());
+    }
+
+    long long enrolledCount(const std::string& courseId) {
+        auto rows = dbAdapter->executeQuery("SELECT enrolledCount FROM Courses WHERE id = ?;", {courseId});
+        return std::any_cast<long long>(rows->at(0).at("enrolledCount"));
+    }
+};
+
+TEST_F(SqlEnrollmentDaoTest, EnrollStopsAtCapacity) {
+    ASSERT_TRUE(dao->enrollIfSeatAvailable("S001", "CS101").has_value());
+    ASSERT_TRUE(dao->enrollIfSeatAvailable("S002", "CS101").has_value());
+
+    auto full = dao->enrollIfSeatAvailable("S003", "CS101");
+    ASSERT_FALSE(full.has_value());
+    EXPECT_EQ(full.error().code, ErrorCode::COURSE_CAPACITY_REACHED);
+    EXPECT_EQ(enrolledCount("CS101"), 2);
+    EXPECT_FALSE(dao->isEnrolled("S003", "CS101").value());
+
+    // Trùng vẫn được báo là trùng kể cả khi khóa học đã đầy
+    auto duplicate = dao->enrollIfSeatAvailable("S001", "CS101");
+    ASSERT_FALSE(duplicate.has_value());
+    EXPECT_EQ(duplicate.error().code, ErrorCode::ALREADY_EXISTS);
+
+    auto missing = dao->enrollIfSeatAvailable("S001", "NOPE");
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error().code, ErrorCode::NOT_FOUND);
+}
+
+TEST_F(SqlEnrollmentDaoTest, DroppingFreesSeat) {
+    ASSERT_TRUE(dao->enrollIfSeatAvailable("S001", "CS101").has_value());
+    ASSERT_TRUE(dao->addEnrollment("S002", "CS101").has_value());
+    EXPECT_EQ(dao->addEnrollment("S003", "CS101").error().code, ErrorCode::DB_CONSTRAINT_ERROR);
+
+    ASSERT_TRUE(dao->removeEnrollment("S001", "CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 1);
+    ASSERT_TRUE(dao->enrollIfSeatAvailable("S003", "CS101").has_value());
+
+    ASSERT_TRUE(dao->removeEnrollmentsByCourse("CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 0);
+}
+
+TEST_F(SqlEnrollmentDaoTest, ZeroCapacityIsUnlimited) {
+    for (int i = 1; i <= 4; ++i) {
+        ASSERT_TRUE(dao->enrollIfSeatAvailable("S00" + std::to_string(i), "CS102").has_value());
+    }
+    EXPECT_EQ(enrolledCount("CS102"), 4);
+}
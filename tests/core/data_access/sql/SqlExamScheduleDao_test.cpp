@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlExamScheduleDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlExamScheduleDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlExamScheduleDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlExamScheduleDao>(dbAdapter);
+
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+        for (const std::string courseId : {"CS101", "CS201", "CS301"}) {
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Courses (id, name, credits, facultyId) VALUES (?, 'Course', 3, 'IT');",
+                                                 {courseId}).has_value());
+        }
+    }
+};
+
+TEST_F(SqlExamScheduleDaoTest, ReplacesWholeScheduleAtomically) {
+    ASSERT_TRUE(dao->replaceAll({{"CS301", 1, 1}, {"CS101", 2, 1}, {"CS201", 1, 1}}).has_value());
+    auto schedule = dao->getAll();
+    ASSERT_TRUE(schedule.has_value());
+    ASSERT_EQ(schedule->size(), 3u);
+    EXPECT_EQ(schedule->at(0).courseId, "CS201");
+    EXPECT_EQ(schedule->at(2).day, 2);
+
+    // Khóa học không tồn tại: lịch cũ được giữ nguyên
+    EXPECT_EQ(dao->replaceAll({{"CS101", 1, 1}, {"NOPE", 1, 2}}).error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(dao->getAll()->size(), 3u);
+
+    ASSERT_TRUE(dao->replaceAll({{"CS101", 1, 3}}).has_value());
+    ASSERT_EQ(dao->getAll()->size(), 1u);
+    EXPECT_EQ(dao->getAll()->front().period, 3);
+}
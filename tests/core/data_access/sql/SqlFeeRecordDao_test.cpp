@@ -25,6 +25,15 @@ protected:
             );
         )");
         ASSERT_TRUE(result.has_value());
+        result = dbAdapter->executeUpdate(R"(
+            CREATE TABLE FeePayments (
+                idempotencyKey TEXT PRIMARY KEY,
+                studentId TEXT NOT NULL,
+                amount INTEGER NOT NULL,
+                paidAt INTEGER NOT NULL
+            );
+        )");
+        ASSERT_TRUE(result.has_value());
     }
 };
 
@@ -83,3 +92,56 @@ TEST_F(SqlFeeRecordDaoTest, GetAllFeeRecords) {
     ASSERT_TRUE(records.has_value());
     EXPECT_EQ(records->size(), 2);
 }
+
+TEST_F(SqlFeeRecordDaoTest, RecordPayment_RetriedKeyIsAppliedOnce) {
+    dao->add(FeeRecord("SV010", 5000000, 0));
+    FeePayment payment{"key-1", "SV010", 1000000, 1700000000};
+
+    auto first = dao->recordPayment(payment);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_TRUE(first.value());
+    auto retried = dao->recordPayment(payment);
+    ASSERT_TRUE(retried.has_value());
+    EXPECT_FALSE(retried.value());
+
+    EXPECT_EQ(dao->getById("SV010")->getPaidFee(), 1000000);
+    auto payments = dao->getPayments("SV010");
+    ASSERT_TRUE(payments.has_value());
+    ASSERT_EQ(payments->size(), 1u);
+    EXPECT_EQ(payments->front().amount, 1000000);
+
+    auto reused = dao->recordPayment(FeePayment{"key-1", "SV010", 2000000, 1700000001});
+    ASSERT_FALSE(reused.has_value());
+    EXPECT_EQ(reused.error().code, ErrorCode::ALREADY_EXISTS);
+}
+
+TEST_F(SqlFeeRecordDaoTest, RecordPayment_OverpaymentLeavesNoLedgerEntry) {
+    dao->add(FeeRecord("SV011", 5000000, 4000000));
+
+    auto overpaid = dao->recordPayment(FeePayment{"key-2", "SV011", 1500000, 1700000000});
+    ASSERT_FALSE(overpaid.has_value());
+    EXPECT_EQ(overpaid.error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(dao->getById("SV011")->getPaidFee(), 4000000);
+    EXPECT_TRUE(dao->getPayments("SV011")->empty());
+
+    auto missing = dao->recordPayment(FeePayment{"key-3", "SV999", 100, 1700000000});
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error().code, ErrorCode::NOT_FOUND);
+    EXPECT_FALSE(dbAdapter->isInTransaction());
+}
+
+TEST_F(SqlFeeRecordDaoTest, SetTotalFees_KeepsPaidFeeAndIsAllOrNothing) {
+    dao->add(FeeRecord("SV012", 5000000, 3000000));
+    dao->add(FeeRecord("SV013", 5000000, 1000000));
+
+    ASSERT_TRUE(dao->setTotalFees({FeeRecord("SV012", 6000000, 0), FeeRecord("SV014", 2000000, 0)}).has_value());
+    EXPECT_EQ(dao->getById("SV012")->getTotalFee(), 6000000);
+    EXPECT_EQ(dao->getById("SV012")->getPaidFee(), 3000000);
+    EXPECT_EQ(dao->getById("SV014")->getTotalFee(), 2000000);
+
+    auto belowPaid = dao->setTotalFees({FeeRecord("SV012", 7000000, 0), FeeRecord("SV013", 500000, 0)});
+    ASSERT_FALSE(belowPaid.has_value());
+    EXPECT_EQ(belowPaid.error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(dao->getById("SV012")->getTotalFee(), 6000000);
+    EXPECT_FALSE(dbAdapter->isInTransaction());
+}
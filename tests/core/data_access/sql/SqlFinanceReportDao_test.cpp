@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "core/data_access/sql/SqlFinanceReportDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlFinanceReportDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlFinanceReportDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        dbAdapter->connect(":memory:");
+        dao = std::make_unique<SqlFinanceReportDao>(dbAdapter);
+
+        for (const char* sql : {
+                 "CREATE TABLE Students (userId TEXT PRIMARY KEY, facultyId TEXT);",
+                 "CREATE TABLE Teachers (userId TEXT PRIMARY KEY, facultyId TEXT);",
+                 "CREATE TABLE FeeRecords (studentId TEXT PRIMARY KEY, totalFee INTEGER NOT NULL, paidFee INTEGER NOT NULL);",
+                 "CREATE TABLE SalaryRecords (teacherId TEXT PRIMARY KEY, basicMonthlyPay INTEGER NOT NULL);"}) {
+            ASSERT_TRUE(dbAdapter->executeUpdate(sql).has_value());
+        }
+    }
+};
+
+TEST_F(SqlFinanceReportDaoTest, SumsFeesByFacultyAndCohort) {
+    dbAdapter->executeUpdate("INSERT INTO Students VALUES ('24IT0001', 'IT'), ('25IT0001', 'IT'), ('25IT0002', 'IT'), ('S001', NULL);");
+    dbAdapter->executeUpdate("INSERT INTO FeeRecords VALUES ('24IT0001', 1000, 400), ('25IT0001', 1000, 1000), ('25IT0002', 2000, 0), ('S001', 700, 700);");
+
+    auto totals = dao->sumFeesByFacultyAndCohort();
+    ASSERT_TRUE(totals.has_value());
+    ASSERT_EQ(totals->size(), 3u);
+    EXPECT_EQ(totals->at(0).facultyId, "");
+    EXPECT_EQ(totals->at(0).cohort, "");
+    EXPECT_EQ(totals->at(2).facultyId, "IT");
+    EXPECT_EQ(totals->at(2).cohort, "25");
+    EXPECT_EQ(totals->at(2).studentCount, 2u);
+    EXPECT_EQ(totals->at(2).totalBilled, 3000);
+    EXPECT_EQ(totals->at(2).outstanding(), 2000);
+}
+
+TEST_F(SqlFinanceReportDaoTest, SumsPayrollByFaculty) {
+    dbAdapter->executeUpdate("INSERT INTO Teachers VALUES ('T001', 'IT'), ('T002', 'IT'), ('T003', 'CS');");
+    dbAdapter->executeUpdate("INSERT INTO SalaryRecords VALUES ('T001', 7000000), ('T002', 10000000), ('T003', 8000000);");
+
+    auto totals = dao->sumPayrollByFaculty();
+    ASSERT_TRUE(totals.has_value());
+    ASSERT_EQ(totals->size(), 2u);
+    EXPECT_EQ(totals->at(1).facultyId, "IT");
+    EXPECT_EQ(totals->at(1).teacherCount, 2u);
+    EXPECT_EQ(totals->at(1).totalMonthlyPay, 17000000);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "core/data_access/sql/SqlInstallmentDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlInstallmentDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlInstallmentDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        dbAdapter->connect(":memory:");
+        dao = std::make_unique<SqlInstallmentDao>(dbAdapter);
+
+        ASSERT_TRUE(dbAdapter->executeUpdate(
+            "CREATE TABLE FeeInstallments (studentId TEXT NOT NULL, sequence INTEGER NOT NULL, dueDate TEXT NOT NULL, "
+            "amount INTEGER NOT NULL CHECK(amount > 0), "
+            "paidAmount INTEGER NOT NULL DEFAULT 0 CHECK(paidAmount >= 0 AND paidAmount <= amount), "
+            "isLate INTEGER NOT NULL DEFAULT 0, PRIMARY KEY (studentId, sequence)) WITHOUT ROWID;").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate(
+            "CREATE INDEX idx_FeeInstallments_open ON FeeInstallments (dueDate, studentId) WHERE paidAmount < amount;").has_value());
+    }
+
+    void addSchedule(const std::string& studentId, const std::vector<std::pair<std::string, long>>& dues) {
+        std::vector<FeeInstallment> installments;
+        int sequence = 1;
+        for (const auto& [dueDate, amount] : dues) {
+            installments.push_back(FeeInstallment{studentId, sequence++, dueDate, amount, 0, false});
+        }
+        ASSERT_TRUE(dao->replaceSchedule(studentId, installments).has_value());
+    }
+};
+
+TEST_F(SqlInstallmentDaoTest, AllocatesPaidTotalOldestFirst) {
+    addSchedule("S001", {{"2025-01-15", 100}, {"2025-02-15", 100}, {"2025-03-15", 100}});
+
+    ASSERT_TRUE(dao->allocatePaid("S001", 150).has_value());
+    auto schedule = dao->getByStudent("S001");
+    ASSERT_TRUE(schedule.has_value());
+    ASSERT_EQ(schedule->size(), 3u);
+    EXPECT_EQ(schedule->at(0).paidAmount, 100);
+    EXPECT_EQ(schedule->at(1).paidAmount, 50);
+    EXPECT_EQ(schedule->at(2).paidAmount, 0);
+
+    // Phân bổ lại từ tổng đã đóng nên gọi lại không cộng dồn
+    ASSERT_TRUE(dao->allocatePaid("S001", 150).has_value());
+    EXPECT_EQ(dao->getByStudent("S001")->at(1).paidAmount, 50);
+}
+
+TEST_F(SqlInstallmentDaoTest, MarksLateOnceAndSumsOverdue) {
+    addSchedule("S001", {{"2025-01-15", 100}, {"2025-02-15", 100}, {"2025-03-15", 100}});
+    addSchedule("S002", {{"2025-01-10", 300}});
+    ASSERT_TRUE(dao->allocatePaid("S001", 130).has_value());
+    ASSERT_TRUE(dao->allocatePaid("S002", 300).has_value());
+
+    auto flagged = dao->markLate("2025-03-01");
+    ASSERT_TRUE(flagged.has_value());
+    EXPECT_EQ(flagged.value(), 1u);
+    EXPECT_EQ(dao->markLate("2025-03-01").value(), 0u);
+
+    auto overdue = dao->sumOverdue("2025-03-01");
+    ASSERT_TRUE(overdue.has_value());
+    ASSERT_EQ(overdue->size(), 1u);
+    EXPECT_EQ(overdue->at(0).studentId, "S001");
+    EXPECT_EQ(overdue->at(0).installmentCount, 1u);
+    EXPECT_EQ(overdue->at(0).overdueAmount, 70);
+    EXPECT_EQ(overdue->at(0).oldestDueDate, "2025-02-15");
+    EXPECT_TRUE(dao->getByStudent("S001")->at(1).late);
+}
+
+TEST_F(SqlInstallmentDaoTest, ListsOpenInstallmentsDueInRange) {
+    addSchedule("S001", {{"2025-01-15", 100}, {"2025-02-15", 100}});
+    addSchedule("S002", {{"2025-02-01", 300}, {"2025-04-01", 300}});
+    ASSERT_TRUE(dao->allocatePaid("S001", 100).has_value());
+
+    auto open = dao->getOpenDueBetween("2025-01-01", "2025-02-28");
+    ASSERT_TRUE(open.has_value());
+    ASSERT_EQ(open->size(), 2u);
+    EXPECT_EQ(open->at(0).studentId, "S002");
+    EXPECT_EQ(open->at(1).dueDate, "2025-02-15");
+    EXPECT_EQ(open->at(1).outstanding(), 100);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "core/data_access/sql/SqlPayrollDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlPayrollDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlPayrollDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        dbAdapter->connect(":memory:");
+        dao = std::make_unique<SqlPayrollDao>(dbAdapter);
+
+        ASSERT_TRUE(dbAdapter->executeUpdate(
+            "CREATE TABLE SalaryPayments (teacherId TEXT NOT NULL, period TEXT NOT NULL, "
+            "basicPay INTEGER NOT NULL CHECK(basicPay >= 0), allowance INTEGER NOT NULL CHECK(allowance >= 0), "
+            "PRIMARY KEY (period, teacherId)) WITHOUT ROWID;").has_value());
+    }
+};
+
+TEST_F(SqlPayrollDaoTest, UpsertBatchReplacesExistingPeriod) {
+    ASSERT_TRUE(dao->upsertBatch({{"T001", "2025-01", 1000, 100}, {"T002", "2025-01", 2000, 0}}).has_value());
+    ASSERT_TRUE(dao->upsertBatch({{"T001", "2025-01", 1200, 150}, {"T001", "2025-02", 1200, 150}}).has_value());
+
+    auto january = dao->getByPeriod("2025-01");
+    ASSERT_TRUE(january.has_value());
+    ASSERT_EQ(january->size(), 2u);
+    EXPECT_EQ(january->at(0).teacherId, "T001");
+    EXPECT_EQ(january->at(0).grossPay(), 1350);
+
+    auto history = dao->getByTeacher("T001");
+    ASSERT_TRUE(history.has_value());
+    ASSERT_EQ(history->size(), 2u);
+    EXPECT_EQ(history->at(1).period, "2025-02");
+}
+
+TEST_F(SqlPayrollDaoTest, UpsertBatchIsAllOrNothing) {
+    // Đã kiểm tra dữ liệu đầu vào; phải để CHECK của bảng từ chối hàng thứ hai
+    ASSERT_TRUE(dbAdapter->executeUpdate("DROP TABLE SalaryPayments;").has_value());
+    ASSERT_TRUE(dbAdapter->executeUpdate(
+        "CREATE TABLE SalaryPayments (teacherId TEXT NOT NULL, period TEXT NOT NULL, basicPay INTEGER NOT NULL, "
+        "allowance INTEGER NOT NULL CHECK(allowance < 500), PRIMARY KEY (period, teacherId)) WITHOUT ROWID;").has_value());
+
+    EXPECT_FALSE(dao->upsertBatch({{"T001", "2025-02", 1000, 100}, {"T002", "2025-02", 1000, 900}}).has_value());
+    EXPECT_TRUE(dao->getByPeriod("2025-02")->empty());
+    EXPECT_FALSE(dbAdapter->isInTransaction());
+}
+
+TEST_F(SqlPayrollDaoTest, SumsYearToDateThroughMonth) {
+    ASSERT_TRUE(dao->upsertBatch({{"T002", "2025-01", 2000, 0}, {"T001", "2025-01", 1000, 100},
+                                  {"T001", "2025-02", 1000, 100}, {"T001", "2025-03", 1000, 100},
+                                  {"T001", "2024-12", 1000, 100}}).has_value());
+
+    auto totals = dao->sumYearToDate(2025, 2);
+    ASSERT_TRUE(totals.has_value());
+    ASSERT_EQ(totals->size(), 2u);
+    EXPECT_EQ(totals->at(0).teacherId, "T001");
+    EXPECT_EQ(totals->at(0).months, 2u);
+    EXPECT_EQ(totals->at(0).totalGross(), 2200);
+    EXPECT_EQ(totals->at(1).totalBasic, 2000);
+
+    EXPECT_FALSE(dao->sumYearToDate(2025, 13).has_value());
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlPrerequisiteDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlPrerequisiteDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlPrerequisiteDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlPrerequisiteDao>(dbAdapter);
+
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+        for (const std::string courseId : {"CS101", "CS201", "CS301"}) {
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Courses (id, name, credits, facultyId) VALUES (?, 'Course', 3, 'IT');",
+                                                 {courseId}).has_value());
+        }
+    }
+};
+
+TEST_F(SqlPrerequisiteDaoTest, StoresEdgesAndCascadesCourseRemoval) {
+    ASSERT_TRUE(dao->add(CoursePrerequisite{"CS301", "CS201"}).has_value());
+    ASSERT_TRUE(dao->add(CoursePrerequisite{"CS201", "CS101"}).has_value());
+    EXPECT_EQ(dao->add(CoursePrerequisite{"CS201", "CS101"}).error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(dao->add(CoursePrerequisite{"CS201", "NOPE"}).error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(dao->add(CoursePrerequisite{"CS201", "CS201"}).error().code, ErrorCode::VALIDATION_ERROR);
+
+    auto all = dao->getAll();
+    ASSERT_TRUE(all.has_value());
+    ASSERT_EQ(all->size(), 2u);
+    EXPECT_EQ(all->at(0).courseId, "CS201");
+    EXPECT_EQ(all->at(0).prerequisiteId, "CS101");
+
+    ASSERT_TRUE(dbAdapter->executeUpdate("DELETE FROM Courses WHERE id = 'CS101';").has_value());
+    ASSERT_EQ(dao->getAll()->size(), 1u);
+    ASSERT_TRUE(dao->remove("CS301", "CS201").has_value());
+    EXPECT_EQ(dao->remove("CS301", "CS201").error().code, ErrorCode::NOT_FOUND);
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "core/data_access/sql/SqlSequenceDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlSequenceDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlSequenceDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        dbAdapter->connect(":memory:");
+        dao = std::make_unique<SqlSequenceDao>(dbAdapter);
+
+        auto result = dbAdapter->executeUpdate(R"(
+            CREATE TABLE Sequences (
+                name TEXT PRIMARY KEY,
+                value INTEGER NOT NULL CHECK(value >= 0)
+            ) WITHOUT ROWID;
+        )");
+        ASSERT_TRUE(result.has_value());
+    }
+};
+
+TEST_F(SqlSequenceDaoTest, MissingSequence_ReturnsNotFound) {
+    auto value = dao->getValue("25IT");
+    ASSERT_FALSE(value.has_value());
+    EXPECT_EQ(value.error().code, ErrorCode::NOT_FOUND);
+
+    auto advanced = dao->advance("25IT", 1);
+    ASSERT_FALSE(advanced.has_value());
+    EXPECT_EQ(advanced.error().code, ErrorCode::NOT_FOUND);
+}
+
+TEST_F(SqlSequenceDaoTest, AdvanceReturnsUpperBoundOfReservedBlock) {
+    ASSERT_TRUE(dao->raiseTo("25IT", 0).has_value());
+    auto first = dao->advance("25IT", 1);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first.value(), 1);
+
+    auto block = dao->advance("25IT", 500);
+    ASSERT_TRUE(block.has_value());
+    EXPECT_EQ(block.value(), 501);
+    EXPECT_EQ(dao->getValue("25IT").value(), 501);
+}
+
+TEST_F(SqlSequenceDaoTest, RaiseToNeverLowersValue) {
+    ASSERT_TRUE(dao->raiseTo("25CS", 42).has_value());
+    ASSERT_TRUE(dao->raiseTo("25CS", 10).has_value());
+    EXPECT_EQ(dao->getValue("25CS").value(), 42);
+    ASSERT_TRUE(dao->raiseTo("25CS", 100).has_value());
+    EXPECT_EQ(dao->getValue("25CS").value(), 100);
+
+    ASSERT_TRUE(dao->raiseTo("25IT", 0).has_value());
+    EXPECT_EQ(dao->count().value(), 2u);
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlShardRouter.h"
+#include "core/data_access/sql/SqlShardedEnrollmentDao.h"
+#include "core/data_access/sql/SqlShardedCourseResultDao.h"
+#include "core/data_access/sql/SqlShardedFeeRecordDao.h"
+#include "core/data_access/sql/SqlShardedStudentDao.h"
+#include "core/data_access/sql/SqlShardedCourseDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+#include "core/parsing/impl_sql_parser/EnrollmentRecordSqlParser.h"
+#include "core/parsing/impl_sql_parser/CourseResultSqlParser.h"
+#include "core/parsing/impl_sql_parser/FeeRecordSqlParser.h"
+#include "core/parsing/impl_sql_parser/StudentSqlParser.h"
+#include "core/parsing/impl_sql_parser/CourseSqlParser.h"
+
+class SqlShardRouterTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+    std::shared_ptr<SQLiteAdapter> mainAdapter;
+    std::shared_ptr<SqlShardRouter> router;
+    std::unique_ptr<SqlShardedEnrollmentDao> enrollmentDao;
+    std::unique_ptr<SqlShardedCourseResultDao> resultDao;
+    std::unique_ptr<SqlShardedFeeRecordDao> feeDao;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / ("sql_shard_router_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        const std::string mainPath = (dir / "main.db").string();
+
+        mainAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(mainAdapter->connect(mainPath).has_value());
+        ASSERT_TRUE(mainAdapter->ensureTablesExist().has_value());
+        router = std::make_shared<SqlShardRouter>(mainAdapter, mainPath, dir / "shards");
+        enrollmentDao = std::make_unique<SqlShardedEnrollmentDao>(router, std::make_shared<EnrollmentRecordSqlParser>());
+        resultDao = std::make_unique<SqlShardedCourseResultDao>(router, std::make_shared<CourseResultSqlParser>());
+        feeDao = std::make_unique<SqlShardedFeeRecordDao>(router, std::make_shared<FeeRecordSqlParser>());
+
+        ASSERT_TRUE(mainAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology'), ('EE', 'Electrical');").has_value());
+        ASSERT_TRUE(mainAdapter->executeUpdate(
+            "INSERT INTO Courses (id, name, credits, facultyId, capacity) VALUES ('CS101', 'Programming', 3, 'IT', 2), "
+            "('EE101', 'Circuits', 3, 'EE', 0);").has_value());
+        ASSERT_TRUE(mainAdapter->executeUpdate(
+            "INSERT INTO Terms (id, name, startDate, endDate, closed) VALUES ('2000-1', 'Old term', '2000-01-01', '2000-06-30', 1), "
+            "('2001-1', 'Current term', '2001-01-01', '2099-12-31', 0);").has_value());
+        for (const auto& [studentId, facultyId] : {std::pair{"S001", "IT"}, std::pair{"S002", "IT"}, std::pair{"S003", "EE"}}) {
+            ASSERT_TRUE(mainAdapter->executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES (?, 'Van', 'Nguyen', 1, 1);",
+                                                   {std::string(studentId)}).has_value());
+            ASSERT_TRUE(mainAdapter->executeUpdate("INSERT INTO Students (userId, facultyId) VALUES (?, ?);",
+                                                   {std::string(studentId), std::string(facultyId)}).has_value());
+        }
+    }
+
+    void TearDown() override {
+        enrollmentDao.reset();
+        resultDao.reset();
+        feeDao.reset();
+        router.reset();
+        mainAdapter.reset();
+        std::filesystem::remove_all(dir);
+    }
+
+    long long rowCount(const std::string& shardKey, const std::string& sql) {
+        auto rows = router->shardFor(shardKey).value()->executeQuery(sql);
+        EXPECT_TRUE(rows.has_value());
+        return rows->size();
+    }
+};
+
+TEST_F(SqlShardRouterTest, RoutesStudentsToFacultyFilesAndFansOutReads) {
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S003", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S003", "EE101").has_value());
+    EXPECT_EQ(enrollmentDao->addEnrollment("S003", "EE101").error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(enrollmentDao->addEnrollment("S999", "CS101").error().code, ErrorCode::NOT_FOUND);
+
+    EXPECT_TRUE(std::filesystem::exists(router->shardPath("IT")));
+    EXPECT_TRUE(std::filesystem::exists(router->shardPath("EE")));
+    EXPECT_EQ(router->shardKeyOfStudent("S003").value(), "EE");
+    EXPECT_EQ(rowCount("IT", "SELECT 1 FROM Enrollments;"), 1);
+    EXPECT_EQ(rowCount("EE", "SELECT 1 FROM Enrollments;"), 2);
+
+    // Đọc theo khóa học gom kết quả từ mọi shard
+    auto students = enrollmentDao->findStudentIdsByCourseId("CS101");
+    ASSERT_TRUE(students.has_value());
+    EXPECT_EQ(students->size(), 2u);
+    EXPECT_EQ(enrollmentDao->getAllEnrollments()->size(), 3u);
+    EXPECT_EQ(enrollmentDao->findByTerm("2001-1")->size(), 3u);
+    EXPECT_TRUE(enrollmentDao->findCourseIdsByStudentId("S002")->empty());
+
+    // Sức chứa vẫn được giữ trong CSDL chính
+    EXPECT_EQ(enrollmentDao->enrollIfSeatAvailable("S002", "CS101").error().code, ErrorCode::COURSE_CAPACITY_REACHED);
+    ASSERT_TRUE(enrollmentDao->removeEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S002", "CS101").has_value());
+    auto seats = mainAdapter->executeQuery("SELECT enrolledCount FROM Courses WHERE id = 'CS101';");
+    EXPECT_EQ(std::any_cast<long long>(seats->front().at("enrolledCount")), 2);
+
+    ASSERT_TRUE(feeDao->add(FeeRecord("S003", 1000, 0)).has_value());
+    EXPECT_EQ(feeDao->getById("S003")->getTotalFee(), 1000);
+    EXPECT_EQ(rowCount("EE", "SELECT 1 FROM FeeRecords;"), 1);
+    EXPECT_EQ(feeDao->getAll()->size(), 1u);
+}
+
+TEST_F(SqlShardRouterTest, ClosedTermRowsAreReadOnly) {
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS101", 80)).has_value());
+    EXPECT_EQ(resultDao->find("S001", "CS101")->getTermId(), "2001-1");
+
+    ASSERT_TRUE(mainAdapter->executeUpdate("UPDATE Terms SET closed = 1 WHERE id = '2001-1';").has_value());
+    EXPECT_EQ(resultDao->addOrUpdate(CourseResult("S001", "CS101", 90)).error().code, ErrorCode::GRADING_PERIOD_CLOSED);
+    EXPECT_EQ(enrollmentDao->removeEnrollment("S001", "CS101").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+
+    SqlShardedStudentDao studentDao(router, std::make_shared<StudentSqlParser>());
+    EXPECT_EQ(studentDao.remove("S001").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+    EXPECT_TRUE(studentDao.getById("S001").has_value());
+    EXPECT_TRUE(enrollmentDao->isEnrolled("S001", "CS101").value());
+    SqlShardedCourseDao courseDao(router, std::make_shared<CourseSqlParser>());
+    EXPECT_EQ(courseDao.remove("CS101").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+    EXPECT_EQ(resultDao->find("S001", "CS101")->getMarks(), 80);
+}
+
+TEST_F(SqlShardRouterTest, FacultyChangeMovesRowsAndRemovalPurgesThem) {
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS101", 75)).has_value());
+    ASSERT_TRUE(feeDao->add(FeeRecord("S001", 500, 100)).has_value());
+
+    SqlShardedStudentDao studentDao(router, std::make_shared<StudentSqlParser>());
+    auto student = studentDao.getById("S001");
+    ASSERT_TRUE(student.has_value());
+    ASSERT_TRUE(student->setBirthday(1, 2, 2003));
+    ASSERT_TRUE(student->setEmail("s001@example.com"));
+    ASSERT_TRUE(student->setCitizenId("012345678901"));
+    ASSERT_TRUE(student->setFacultyId("EE"));
+    auto updated = studentDao.update(student.value());
+    ASSERT_TRUE(updated.has_value()) << updated.error().message;
+
+    EXPECT_EQ(router->shardKeyOfStudent("S001").value(), "EE");
+    EXPECT_EQ(rowCount("IT", "SELECT 1 FROM Enrollments;"), 0);
+    EXPECT_EQ(rowCount("EE", "SELECT 1 FROM CourseResults;"), 1);
+    EXPECT_TRUE(enrollmentDao->isEnrolled("S001", "CS101").value());
+    EXPECT_EQ(feeDao->getById("S001")->getPaidFee(), 100);
+
+    ASSERT_TRUE(studentDao.remove("S001").has_value());
+    EXPECT_EQ(studentDao.getById("S001").error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(rowCount("EE", "SELECT 1 FROM Enrollments;"), 0);
+    EXPECT_EQ(rowCount("EE", "SELECT 1 FROM FeeRecords;"), 0);
+    EXPECT_TRUE(resultDao->findByCourseId("CS101")->empty());
+
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S002", "CS101").has_value());
+    SqlShardedCourseDao courseDao(router, std::make_shared<CourseSqlParser>());
+    ASSERT_TRUE(courseDao.remove("CS101").has_value());
+    EXPECT_TRUE(enrollmentDao->getAllEnrollments()->empty());
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlShardRouter.h"
+#include "core/data_access/sql/SqlShardedEnrollmentDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+#include "core/parsing/impl_sql_parser/EnrollmentRecordSqlParser.h"
+
+class SqlShardedEnrollmentDaoTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+    std::shared_ptr<SQLiteAdapter> mainAdapter;
+    std::shared_ptr<SqlShardRouter> router;
+    std::unique_ptr<SqlShardedEnrollmentDao> enrollmentDao;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / ("sql_sharded_enrollment_dao_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        const std::string mainPath = (dir / "main.db").string();
+
+        mainAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(mainAdapter->connect(mainPath).has_value());
+        ASSERT_TRUE(mainAdapter->ensureTablesExist().has_value());
+        router = std::make_shared<SqlShardRouter>(mainAdapter, mainPath, dir / "shards");
+        enrollmentDao = std::make_unique<SqlShardedEnrollmentDao>(router, std::make_shared<EnrollmentRecordSqlParser>());
+
+        ASSERT_TRUE(mainAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology'), ('EE', 'Electrical');").has_value());
+        ASSERT_TRUE(mainAdapter->executeUpdate(
+            "INSERT INTO Courses (id, name, credits, facultyId, capacity) VALUES ('CS101', 'Programming', 3, 'IT', 2), "
+            "('EE101', 'Circuits', 3, 'EE', 0);").has_value());
+        ASSERT_TRUE(mainAdapter->executeUpdate(
+            "INSERT INTO Terms (id, name, startDate, endDate, closed) VALUES ('2001-1', 'Current term', '2001-01-01', '2099-12-31', 0);").has_value());
+        for (const auto& [studentId, facultyId] : {std::pair{"S001", "IT"}, std::pair{"S002", "IT"}, std::pair{"S003", "EE"}}) {
+            ASSERT_TRUE(mainAdapter->executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES (?, 'Van', 'Nguyen', 1, 1);",
+                                                   {std::string(studentId)}).has_value());
+            ASSERT_TRUE(mainAdapter->executeUpdate("INSERT INTO Students (userId, facultyId) VALUES (?, ?);",
+                                                   {std::string(studentId), std::string(facultyId)}).has_value());
+        }
+    }
+
+    void TearDown() override {
+        enrollmentDao.reset();
+        router.reset();
+        mainAdapter.reset();
+        std::filesystem::remove_all(dir);
+    }
+
+    long long enrolledCount(const std::string& courseId) {
+        auto rows = mainAdapter->executeQuery("SELECT enrolledCount FROM Courses WHERE id = ?;", {courseId});
+        EXPECT_TRUE(rows.has_value());
+        return std::any_cast<long long>(rows->front().at("enrolledCount"));
+    }
+
+    long long rowCount(IDatabaseAdapter& adapter, const std::string& sql) {
+        auto rows = adapter.executeQuery(sql);
+        EXPECT_TRUE(rows.has_value());
+        return rows->size();
+    }
+
+    long long shardRowCount(const std::string& shardKey, const std::string& sql) {
+        return rowCount(*router->shardFor(shardKey).value(), sql);
+    }
+};
+
+TEST_F(SqlShardedEnrollmentDaoTest, EnrollTakesTheSeatInMainAndInsertsInTheShard) {
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S001", "CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 1);
+    EXPECT_EQ(shardRowCount("IT", "SELECT 1 FROM Enrollments WHERE studentId = 'S001' AND courseId = 'CS101' AND termId = '2001-1';"), 1);
+    EXPECT_EQ(rowCount(*mainAdapter, "SELECT 1 FROM Enrollments;"), 0);
+
+    // Sinh viên đã đăng ký không giữ thêm chỗ
+    EXPECT_EQ(enrollmentDao->enrollIfSeatAvailable("S001", "CS101").error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(enrolledCount("CS101"), 1);
+
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S003", "CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 2);
+    EXPECT_EQ(enrollmentDao->enrollIfSeatAvailable("S002", "CS101").error().code, ErrorCode::COURSE_CAPACITY_REACHED);
+    EXPECT_EQ(enrolledCount("CS101"), 2);
+    EXPECT_EQ(shardRowCount("IT", "SELECT 1 FROM Enrollments;"), 1);
+
+    // Sức chứa 0 là không giới hạn nhưng vẫn đếm chỗ đã dùng
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S003", "EE101").has_value());
+    EXPECT_EQ(enrolledCount("EE101"), 1);
+    EXPECT_EQ(enrollmentDao->enrollIfSeatAvailable("S001", "XX999").error().code, ErrorCode::NOT_FOUND);
+}
+
+TEST_F(SqlShardedEnrollmentDaoTest, DropReleasesTheSeat) {
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S001", "EE101").has_value());
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S002", "CS101").has_value());
+
+    ASSERT_TRUE(enrollmentDao->removeEnrollment("S002", "CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 1);
+    EXPECT_FALSE(enrollmentDao->isEnrolled("S002", "CS101").value());
+    EXPECT_EQ(enrollmentDao->removeEnrollment("S002", "CS101").error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(enrolledCount("CS101"), 1);
+
+    ASSERT_TRUE(enrollmentDao->removeEnrollmentsByStudent("S001").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 0);
+    EXPECT_EQ(enrolledCount("EE101"), 0);
+    EXPECT_EQ(shardRowCount("IT", "SELECT 1 FROM Enrollments;"), 0);
+}
+
+TEST_F(SqlShardedEnrollmentDaoTest, FailedShardInsertReleasesTheSeat) {
+    ASSERT_TRUE(router->shardFor("IT").value()->executeUpdate(
+        "CREATE TRIGGER fail_enrollment_insert BEFORE INSERT ON Enrollments BEGIN SELECT RAISE(ABORT, 'shard insert failed'); END;").has_value());
+
+    auto enrolled = enrollmentDao->enrollIfSeatAvailable("S001", "CS101");
+    ASSERT_FALSE(enrolled.has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 0);
+    EXPECT_FALSE(enrollmentDao->isEnrolled("S001", "CS101").value());
+
+    // Shard khác không bị ảnh hưởng
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S003", "CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 1);
+}
+
+TEST_F(SqlShardedEnrollmentDaoTest, RemoveByCourseFansOutToEveryShard) {
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S003", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S003", "EE101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 2);
+
+    ASSERT_TRUE(enrollmentDao->removeEnrollmentsByCourse("CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 0);
+    EXPECT_EQ(shardRowCount("IT", "SELECT 1 FROM Enrollments;"), 0);
+    EXPECT_EQ(shardRowCount("EE", "SELECT 1 FROM Enrollments WHERE courseId = 'CS101';"), 0);
+    EXPECT_TRUE(enrollmentDao->findStudentIdsByCourseId("CS101")->empty());
+
+    // Khóa học khác giữ nguyên dòng và số chỗ
+    EXPECT_EQ(shardRowCount("EE", "SELECT 1 FROM Enrollments WHERE courseId = 'EE101';"), 1);
+    EXPECT_EQ(enrolledCount("EE101"), 1);
+    ASSERT_TRUE(enrollmentDao->removeEnrollmentsByCourse("CS101").has_value());
+    EXPECT_EQ(enrolledCount("CS101"), 0);
+}
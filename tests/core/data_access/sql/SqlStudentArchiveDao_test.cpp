@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlStudentArchiveDao.h"
+#include "core/data_access/sql/SqlStudentDao.h"
+#include "core/data_access/sql/SqlEnrollmentDao.h"
+#include "core/data_access/sql/SqlCourseResultDao.h"
+#include "core/data_access/sql/SqlFeeRecordDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+#include "core/parsing/impl_sql_parser/StudentSqlParser.h"
+#include "core/parsing/impl_sql_parser/EnrollmentRecordSqlParser.h"
+#include "core/parsing/impl_sql_parser/CourseResultSqlParser.h"
+#include "core/parsing/impl_sql_parser/FeeRecordSqlParser.h"
+
+class SqlStudentArchiveDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlStudentArchiveDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlStudentArchiveDao>(dbAdapter);
+
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Courses (id, name, credits, facultyId) VALUES ('CS101', 'Programming', 3, 'IT');").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Terms (id, name, startDate, endDate) VALUES ('2000-1', 'Old term', '2000-01-01', '2000-06-30');").has_value());
+        for (const char* id : {"S001", "S002"}) {
+            const std::string studentId = id;
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES (?, 'Van', 'Nguyen', 1, 0);",
+                                                 {studentId}).has_value());
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Students (userId, facultyId) VALUES (?, 'IT');", {studentId}).has_value());
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Enrollments (studentId, courseId, termId) VALUES (?, 'CS101', '2000-1');",
+                                                 {studentId}).has_value());
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO CourseResults (studentId, courseId, marks, termId) VALUES (?, 'CS101', 75, '2000-1');",
+                                                 {studentId}).has_value());
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO FeeRecords (studentId, totalFee, paidFee) VALUES (?, 1000, 1000);",
+                                                 {studentId}).has_value());
+        }
+        ASSERT_TRUE(dbAdapter->executeUpdate("UPDATE Terms SET closed = 1 WHERE id = '2000-1';").has_value());
+        // S001 bị vô hiệu hóa từ lâu
+        ASSERT_TRUE(dbAdapter->executeUpdate("UPDATE Users SET status = 2 WHERE id = 'S001';").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate("UPDATE Users SET statusChangedAt = '2001-01-01' WHERE id = 'S001';").has_value());
+    }
+
+    long long count(const std::string& sql) {
+        auto rows = dbAdapter->executeQuery(sql);
+        return std::any_cast<long long>(rows->at(0).begin()->second);
+    }
+};
+
+TEST_F(SqlStudentArchiveDaoTest, RequiresAttachedArchive) {
+    EXPECT_FALSE(dao->isAvailable());
+    EXPECT_EQ(dao->archiveStudents({"S001"}).error().code, ErrorCode::OPERATION_FAILED);
+    EXPECT_FALSE(dao->isArchived("S001").value());
+}
+
+TEST_F(SqlStudentArchiveDaoTest, FindsStudentsDisabledBeforeCutoff) {
+    auto disabled = dao->findDisabledStudentIds("2010-01-01", 10);
+    ASSERT_TRUE(disabled.has_value());
+    ASSERT_EQ(disabled->size(), 1u);
+    EXPECT_EQ(disabled->front(), "S001");
+    EXPECT_TRUE(dao->findDisabledStudentIds("2000-12-31", 10)->empty());
+
+    // Đổi trạng thái cập nhật lại ngày, nên vô hiệu hóa hôm nay không phải "lâu ngày"
+    ASSERT_TRUE(dbAdapter->executeUpdate("UPDATE Users SET status = 2 WHERE id = 'S002';").has_value());
+    EXPECT_EQ(dao->findDisabledStudentIds("2010-01-01", 10)->size(), 1u);
+}
+
+TEST_F(SqlStudentArchiveDaoTest, MovesStudentWithDependentRowsAndReadsFallBack) {
+    ASSERT_TRUE(dbAdapter->attachArchive(":memory:").has_value());
+    ASSERT_TRUE(dao->isAvailable());
+
+    auto archived = dao->archiveStudents({"S001", "S001", "NOPE"});
+    ASSERT_TRUE(archived.has_value());
+    EXPECT_EQ(archived.value(), 1u);
+    EXPECT_TRUE(dao->isArchived("S001").value());
+    EXPECT_FALSE(dao->isArchived("S002").value());
+
+    // Dữ liệu chính chỉ còn S002, kể cả kết quả của học kỳ đã đóng
+    EXPECT_EQ(count("SELECT COUNT(*) FROM main.Users WHERE id = 'S001';"), 0);
+    EXPECT_EQ(count("SELECT COUNT(*) FROM main.CourseResults;"), 1);
+    EXPECT_EQ(count("SELECT COUNT(*) FROM main.ArchiveQueue;"), 0);
+    EXPECT_EQ(count("SELECT COUNT(*) FROM archive.Enrollments;"), 1);
+    EXPECT_EQ(count("SELECT enrolledCount FROM Courses WHERE id = 'CS101';"), 1);
+
+    SqlStudentDao studentDao(dbAdapter, std::make_shared<StudentSqlParser>());
+    SqlEnrollmentDao enrollmentDao(dbAdapter, std::make_shared<EnrollmentRecordSqlParser>());
+    SqlCourseResultDao resultDao(dbAdapter, std::make_shared<CourseResultSqlParser>());
+    SqlFeeRecordDao feeDao(dbAdapter, std::make_shared<FeeRecordSqlParser>());
+
+    auto student = studentDao.getById("S001");
+    ASSERT_TRUE(student.has_value());
+    EXPECT_EQ(student->getFacultyId(), "IT");
+    EXPECT_TRUE(studentDao.exists("S001").value());
+    EXPECT_EQ(studentDao.getAll()->size(), 1u);
+    EXPECT_EQ(resultDao.find("S001", "CS101")->getMarks(), 75);
+    EXPECT_EQ(resultDao.findByStudentId("S001")->size(), 1u);
+    EXPECT_EQ(enrollmentDao.findCourseIdsByStudentId("S001")->size(), 1u);
+    EXPECT_EQ(feeDao.getById("S001")->getPaidFee(), 1000);
+    EXPECT_EQ(studentDao.getById("NOPE").error().code, ErrorCode::NOT_FOUND);
+
+    EXPECT_EQ(dao->archiveStudents({"S001"}).value(), 0u);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlTermDao.h"
+#include "core/data_access/sql/SqlEnrollmentDao.h"
+#include "core/data_access/sql/SqlCourseResultDao.h"
+#include "core/data_access/sql/SqlStudentDao.h"
+#include "core/data_access/sql/SqlCourseDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+#include "core/parsing/impl_sql_parser/EnrollmentRecordSqlParser.h"
+#include "core/parsing/impl_sql_parser/CourseResultSqlParser.h"
+#include "core/parsing/impl_sql_parser/StudentSqlParser.h"
+#include "core/parsing/impl_sql_parser/CourseSqlParser.h"
+
+class SqlTermDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlTermDao> dao;
+    std::unique_ptr<SqlEnrollmentDao> enrollmentDao;
+    std::unique_ptr<SqlCourseResultDao> resultDao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        // Dùng schema thật để các trigger gán học kỳ mặc định và khóa học kỳ đã đóng được kiểm tra
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlTermDao>(dbAdapter);
+        enrollmentDao = std::make_unique<SqlEnrollmentDao>(dbAdapter, std::make_shared<EnrollmentRecordSqlParser>());
+        resultDao = std::make_unique<SqlCourseResultDao>(dbAdapter, std::make_shared<CourseResultSqlParser>());
+
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate(
+            "INSERT INTO Courses (id, name, credits, facultyId) VALUES ('CS101', 'Programming', 3, 'IT'), "
+            "('CS201', 'Data Structures', 3, 'IT');").has_value());
+        for (const char* id : {"S001", "S002"}) {
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES (?, 'Van', 'Nguyen', 1, 1);",
+                                                 {std::string(id)}).has_value());
+        }
+        ASSERT_TRUE(dao->add(AcademicTerm{"2000-1", "Old term", "2000-01-01", "2000-06-30", false}).has_value());
+        ASSERT_TRUE(dao->add(AcademicTerm{"2001-1", "Current term", "2001-01-01", "2099-12-31", false}).has_value());
+        ASSERT_TRUE(dao->add(AcademicTerm{"2100-1", "Future term", "2100-01-01", "2100-06-30", false}).has_value());
+    }
+};
+
+TEST_F(SqlTermDaoTest, AddsFindsAndClosesTerms) {
+    EXPECT_EQ(dao->add(AcademicTerm{"2000-1", "Duplicate", "2000-01-01", "2000-06-30", false}).error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(dao->add(AcademicTerm{"BAD", "Backwards", "2000-06-30", "2000-01-01", false}).error().code, ErrorCode::VALIDATION_ERROR);
+
+    auto terms = dao->getAll();
+    ASSERT_TRUE(terms.has_value());
+    ASSERT_EQ(terms->size(), 3u);
+    EXPECT_EQ(terms->front().id, "2000-1");
+    EXPECT_EQ(dao->findById("NOPE").error().code, ErrorCode::NOT_FOUND);
+
+    auto current = dao->findCurrent("2050-01-01");
+    ASSERT_TRUE(current.has_value());
+    EXPECT_EQ(current->id, "2001-1");
+    EXPECT_EQ(dao->findCurrent("1999-01-01").error().code, ErrorCode::NOT_FOUND);
+
+    auto closed = dao->close("2001-1");
+    ASSERT_TRUE(closed.has_value());
+    EXPECT_TRUE(closed.value());
+    EXPECT_FALSE(dao->close("2001-1").value());
+    EXPECT_EQ(dao->close("NOPE").error().code, ErrorCode::NOT_FOUND);
+    EXPECT_TRUE(dao->findById("2001-1")->closed);
+
+    // Học kỳ đã đóng bị bỏ qua khi tìm học kỳ hiện tại
+    EXPECT_EQ(dao->findCurrent("2050-01-01")->id, "2000-1");
+}
+
+TEST_F(SqlTermDaoTest, EnrollmentsAndResultsDefaultToCurrentTermAndPrune) {
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S002", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS201").has_value());
+    ASSERT_TRUE(enrollmentDao->setEnrollmentTerm("S001", "CS201", "2000-1").has_value());
+    EXPECT_EQ(enrollmentDao->setEnrollmentTerm("S001", "CS201", "NOPE").error().code, ErrorCode::NOT_FOUND);
+
+    // Kết quả không chỉ rõ học kỳ kế thừa học kỳ của bản ghi đăng ký
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS101", 80)).has_value());
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS201", 70)).has_value());
+    EXPECT_EQ(resultDao->find("S001", "CS101")->getTermId(), "2001-1");
+    EXPECT_EQ(resultDao->find("S001", "CS201")->getTermId(), "2000-1");
+
+    auto current = enrollmentDao->findByTerm("2001-1");
+    ASSERT_TRUE(current.has_value());
+    EXPECT_EQ(current->size(), 2u);
+    auto students = enrollmentDao->findStudentIdsByTermAndCourse("2000-1", "CS201");
+    ASSERT_TRUE(students.has_value());
+    ASSERT_EQ(students->size(), 1u);
+    EXPECT_EQ(students->front(), "S001");
+
+    auto oldResults = resultDao->findByTerm("2000-1");
+    ASSERT_TRUE(oldResults.has_value());
+    ASSERT_EQ(oldResults->size(), 1u);
+    EXPECT_EQ(oldResults->front().getCourseId(), "CS201");
+    EXPECT_TRUE(resultDao->findByTermAndCourse("2000-1", "CS101")->empty());
+
+    // Cập nhật điểm không chỉ rõ học kỳ giữ nguyên học kỳ đã lưu
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS201", 75)).has_value());
+    EXPECT_EQ(resultDao->find("S001", "CS201")->getTermId(), "2000-1");
+}
+
+TEST_F(SqlTermDaoTest, ClosedTermIsReadOnly) {
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S002", "CS101").has_value());
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS101", 80)).has_value());
+    ASSERT_TRUE(dao->close("2001-1").value());
+
+    EXPECT_EQ(resultDao->addOrUpdate(CourseResult("S001", "CS101", 90)).error().code, ErrorCode::GRADING_PERIOD_CLOSED);
+    EXPECT_EQ(resultDao->addOrUpdate(CourseResult("S002", "CS101", 90)).error().code, ErrorCode::GRADING_PERIOD_CLOSED);
+    EXPECT_EQ(resultDao->remove("S001", "CS101").error().code, ErrorCode::GRADING_PERIOD_CLOSED);
+    EXPECT_EQ(enrollmentDao->removeEnrollment("S002", "CS101").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+    EXPECT_FALSE(enrollmentDao->setEnrollmentTerm("S002", "CS101", "2000-1").has_value());
+    EXPECT_FALSE(dbAdapter->executeUpdate("UPDATE Terms SET name = 'Renamed' WHERE id = '2001-1';").has_value());
+
+    EXPECT_EQ(resultDao->find("S001", "CS101")->getMarks(), 80);
+    EXPECT_EQ(enrollmentDao->findByTerm("2001-1")->size(), 2u);
+}
+
+TEST_F(SqlTermDaoTest, ClosedTermBlocksCascadingDeletes) {
+    ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Students (userId, facultyId) VALUES ('S001', 'IT'), ('S002', 'IT');").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S002", "CS201").has_value());
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S002", "CS201", 70)).has_value());
+    ASSERT_TRUE(dao->close("2001-1").value());
+
+    SqlStudentDao studentDao(dbAdapter, std::make_shared<StudentSqlParser>());
+    SqlCourseDao courseDao(dbAdapter, std::make_shared<CourseSqlParser>());
+    EXPECT_EQ(studentDao.remove("S001").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+    EXPECT_EQ(studentDao.remove("S002").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+    EXPECT_EQ(courseDao.remove("CS101").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+    EXPECT_EQ(studentDao.remove("NOPE").error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(enrollmentDao->findByTerm("2001-1")->size(), 2u);
+    EXPECT_EQ(resultDao->find("S002", "CS201")->getMarks(), 70);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "core/data_access/sql/SqlTuitionDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlTuitionDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlTuitionDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        dbAdapter->connect(":memory:");
+        dao = std::make_unique<SqlTuitionDao>(dbAdapter);
+
+        for (const char* sql : {
+                 "CREATE TABLE Students (userId TEXT PRIMARY KEY, facultyId TEXT);",
+                 "CREATE TABLE Courses (id TEXT PRIMARY KEY, credits INTEGER NOT NULL);",
+                 "CREATE TABLE Enrollments (studentId TEXT NOT NULL, courseId TEXT NOT NULL, termId TEXT, PRIMARY KEY (studentId, courseId));",
+                 "CREATE TABLE FeeRecords (studentId TEXT PRIMARY KEY, totalFee INTEGER NOT NULL, paidFee INTEGER NOT NULL);",
+                 "CREATE TABLE TuitionRates (facultyId TEXT PRIMARY KEY, ratePerCredit INTEGER NOT NULL);"}) {
+            ASSERT_TRUE(dbAdapter->executeUpdate(sql).has_value());
+        }
+    }
+};
+
+TEST_F(SqlTuitionDaoTest, ReturnsOnlyChangedFeeRecords) {
+    dbAdapter->executeUpdate("INSERT INTO Students VALUES ('S1', 'IT'), ('S2', 'IT'), ('S3', 'IT'), ('S4', 'CS'), ('S5', 'IT');");
+    dbAdapter->executeUpdate("INSERT INTO Courses VALUES ('C1', 3), ('C2', 4);");
+    dbAdapter->executeUpdate("INSERT INTO Enrollments (studentId, courseId) VALUES ('S1', 'C1'), ('S1', 'C2'), ('S2', 'C1'), ('S3', 'C2'), ('S4', 'C1');");
+    dbAdapter->executeUpdate("INSERT INTO FeeRecords VALUES ('S1', 700, 100), ('S2', 500, 0);");
+    dbAdapter->executeUpdate("INSERT INTO TuitionRates VALUES ('IT', 100);");
+
+    auto assessment = dao->assessTuition("");
+    ASSERT_TRUE(assessment.has_value());
+    EXPECT_EQ(assessment->studentCount, 5u);
+    EXPECT_EQ(assessment->unratedCount, 1u);
+
+    // S1 không đổi; S5 không đăng ký và chưa có hồ sơ nên không được tạo hồ sơ 0 đồng
+    ASSERT_EQ(assessment->changes.size(), 2u);
+    EXPECT_EQ(assessment->changes[0].studentId, "S2");
+    EXPECT_EQ(assessment->changes[0].credits, 3);
+    EXPECT_EQ(assessment->changes[0].newTotalFee, 300);
+    EXPECT_EQ(assessment->changes[0].previousTotalFee, 500);
+    EXPECT_EQ(assessment->changes[1].studentId, "S3");
+    EXPECT_EQ(assessment->changes[1].newTotalFee, 400);
+    EXPECT_FALSE(assessment->changes[1].previousTotalFee.has_value());
+}
+
+TEST_F(SqlTuitionDaoTest, CountsOnlyEnrollmentsOfTheGivenTerm) {
+    dbAdapter->executeUpdate("INSERT INTO Students VALUES ('S1', 'IT'), ('S2', 'IT');");
+    dbAdapter->executeUpdate("INSERT INTO Courses VALUES ('C1', 3), ('C2', 4), ('C3', 2);");
+    dbAdapter->executeUpdate("INSERT INTO Enrollments VALUES ('S1', 'C1', '2000-1'), ('S1', 'C2', '2001-1'), ('S1', 'C3', NULL), "
+                             "('S2', 'C1', '2000-1');");
+    dbAdapter->executeUpdate("INSERT INTO FeeRecords VALUES ('S2', 300, 300);");
+    dbAdapter->executeUpdate("INSERT INTO TuitionRates VALUES ('IT', 100);");
+
+    // S1: C2 của học kỳ đang tính và C3 chưa gán học kỳ; S2 không còn tín chỉ nào trong học kỳ này
+    auto assessment = dao->assessTuition("2001-1");
+    ASSERT_TRUE(assessment.has_value());
+    ASSERT_EQ(assessment->changes.size(), 2u);
+    EXPECT_EQ(assessment->changes[0].studentId, "S1");
+    EXPECT_EQ(assessment->changes[0].credits, 6);
+    EXPECT_EQ(assessment->changes[1].studentId, "S2");
+    EXPECT_EQ(assessment->changes[1].newTotalFee, 0);
+}
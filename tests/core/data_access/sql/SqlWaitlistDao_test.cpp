@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "core/data_access/sql/SqlWaitlistDao.h"
+#include "core/database_adapter/sql/SQLiteAdapter.h"
+
+class SqlWaitlistDaoTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::unique_ptr<SqlWaitlistDao> dao;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        dao = std::make_unique<SqlWaitlistDao>(dbAdapter);
+
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Faculties (id, name) VALUES ('IT', 'Information Technology');").has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate(
+            "INSERT INTO Courses (id, name, credits, facultyId, capacity) VALUES ('CS101', 'Programming', 3, 'IT', 1);").has_value());
+        for (int i = 1; i <= 3; ++i) {
+            ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES (?, 'Van', 'Nguyen', 1, 1);",
+                                                 {"S00" + std::to_string(i)}).has_value());
+        }
+    }
+};
+
+TEST_F(SqlWaitlistDaoTest, ReturnsCourseQueueInWaitingOrder) {
+    ASSERT_TRUE(dao->add(WaitlistEntry{"CS101", "S001", 1, 100}).has_value());
+    ASSERT_TRUE(dao->add(WaitlistEntry{"CS101", "S002", 0, 300}).has_value());
+    ASSERT_TRUE(dao->add(WaitlistEntry{"CS101", "S003", 0, 200}).has_value());
+
+    auto queue = dao->getByCourse("CS101");
+    ASSERT_TRUE(queue.has_value());
+    ASSERT_EQ(queue->size(), 3u);
+    EXPECT_EQ(queue->at(0).studentId, "S003");
+    EXPECT_EQ(queue->at(1).studentId, "S002");
+    EXPECT_EQ(queue->at(2).studentId, "S001");
+    EXPECT_EQ(queue->at(2).requestedAt, 100);
+
+    auto byStudent = dao->getByStudent("S002");
+    ASSERT_TRUE(byStudent.has_value());
+    ASSERT_EQ(byStudent->size(), 1u);
+    EXPECT_EQ(byStudent->front().priorityClass, 0);
+}
+
+TEST_F(SqlWaitlistDaoTest, RejectsDuplicatesAndUnknownReferences) {
+    ASSERT_TRUE(dao->add(WaitlistEntry{"CS101", "S001", 0, 100}).has_value());
+    EXPECT_EQ(dao->add(WaitlistEntry{"CS101", "S001", 0, 200}).error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(dao->add(WaitlistEntry{"NOPE", "S001", 0, 200}).error().code, ErrorCode::NOT_FOUND);
+
+    ASSERT_TRUE(dao->remove("CS101", "S001").has_value());
+    EXPECT_EQ(dao->remove("CS101", "S001").error().code, ErrorCode::NOT_FOUND);
+    EXPECT_TRUE(dao->getByCourse("CS101")->empty());
+}
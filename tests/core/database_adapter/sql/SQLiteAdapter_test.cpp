@@ -123,4 +123,132 @@ TEST(SQLiteAdapterTest, ExecuteUpdateInvalidSQL) {
     adapter.disconnect();
 }
 
+TEST(SQLiteAdapterTest, ExecuteBatchUpdate_InsertsAllRows) {
+    SQLiteAdapter adapter;
+    ASSERT_TRUE(adapter.connect(":memory:").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TABLE t (id TEXT PRIMARY KEY, value INT);").has_value());
+
+    std::vector<std::vector<DbQueryParam>> paramSets = {
+        {std::string("a"), 1},
+        {std::string("b"), 2},
+        {std::string("c"), 3}
+    };
+    auto result = adapter.executeBatchUpdate("INSERT INTO t (id, value) VALUES (?, ?);", paramSets);
+    ASSERT_TRUE(result.has_value()) << result.error().message;
+    EXPECT_EQ(result.value(), 3);
+
+    auto sum = adapter.executeQuery("SELECT SUM(value) AS total FROM t;");
+    ASSERT_TRUE(sum.has_value());
+    EXPECT_EQ(std::any_cast<long long>((*sum)[0].at("total")), 6);
+}
+
+TEST(SQLiteAdapterTest, ExecuteBatchUpdate_RollbackDiscardsBatchOnError) {
+    SQLiteAdapter adapter;
+    ASSERT_TRUE(adapter.connect(":memory:").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TABLE t (id TEXT PRIMARY KEY);").has_value());
+
+    std::vector<std::vector<DbQueryParam>> paramSets = {
+        {std::string("a")},
+        {std::string("a")} // Trùng khóa chính
+    };
+    ASSERT_TRUE(adapter.beginTransaction().has_value());
+    auto result = adapter.executeBatchUpdate("INSERT INTO t (id) VALUES (?);", paramSets);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code, ErrorCode::ALREADY_EXISTS);
+    ASSERT_TRUE(adapter.rollbackTransaction().has_value());
+
+    auto count = adapter.executeQuery("SELECT COUNT(*) AS count FROM t;");
+    ASSERT_TRUE(count.has_value());
+    EXPECT_EQ(std::any_cast<long long>((*count)[0].at("count")), 0);
+}
+
 // --- END OF NEW FILE tests/SQLiteAdapter_test.cpp ---
+
+TEST(SQLiteAdapterTest, ExecuteQueryStreaming_VisitsRowsAndStopsEarly) {
+    SQLiteAdapter adapter;
+    ASSERT_TRUE(adapter.connect(":memory:").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TABLE t (id INTEGER, name TEXT);").has_value());
+    std::vector<std::vector<DbQueryParam>> rows;
+    for (long long i = 0; i < 100; ++i) rows.push_back({i, std::string("N") + std::to_string(i)});
+    ASSERT_TRUE(adapter.executeBatchUpdate("INSERT INTO t (id, name) VALUES (?, ?);", rows).has_value());
+
+    long long sum = 0;
+    auto all = adapter.executeQueryStreaming("SELECT id, name FROM t;", {}, [&sum](const DbQueryResultRow& row) {
+        sum += std::any_cast<long long>(row.at("id"));
+        return true;
+    });
+    ASSERT_TRUE(all.has_value());
+    EXPECT_EQ(all.value(), 100u);
+    EXPECT_EQ(sum, 4950);
+
+    auto firstTen = adapter.executeQueryStreaming("SELECT id FROM t WHERE id >= ? ORDER BY id;", {10LL},
+                                                  [](const DbQueryResultRow& row) { return std::any_cast<long long>(row.at("id")) < 19; });
+    ASSERT_TRUE(firstTen.has_value());
+    EXPECT_EQ(firstTen.value(), 10u);
+
+    adapter.disconnect();
+}
+
+TEST(SQLiteAdapterTest, EnsureTablesExist_UpgradesOldTables) {
+    SQLiteAdapter adapter;
+    ASSERT_TRUE(adapter.connect(":memory:").has_value());
+    // Lược đồ trước khi có sức chứa, lịch học của khóa học và học kỳ
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TABLE Courses (id TEXT PRIMARY KEY, name TEXT NOT NULL, credits INTEGER NOT NULL, "
+                                      "facultyId TEXT);").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TABLE Enrollments (studentId TEXT NOT NULL, courseId TEXT NOT NULL, "
+                                      "enrollmentDate TEXT, PRIMARY KEY (studentId, courseId));").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TABLE CourseResults (studentId TEXT NOT NULL, courseId TEXT NOT NULL, marks INTEGER, "
+                                      "grade TEXT, PRIMARY KEY (studentId, courseId));").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TABLE Users (id TEXT PRIMARY KEY, firstName TEXT NOT NULL, lastName TEXT NOT NULL, "
+                                      "birthDay INTEGER, birthMonth INTEGER, birthYear INTEGER, address TEXT, citizenId TEXT UNIQUE, "
+                                      "email TEXT UNIQUE, phoneNumber TEXT, role INTEGER NOT NULL, status INTEGER NOT NULL) WITHOUT ROWID;").has_value());
+    // Trigger của học kỳ đã đóng trước khi có kho lưu trữ
+    ASSERT_TRUE(adapter.executeUpdate("CREATE TRIGGER trg_Enrollments_term_closed_delete BEFORE DELETE ON Enrollments "
+                                      "WHEN OLD.termId IN (SELECT id FROM Terms WHERE closed = 1) "
+                                      "BEGIN SELECT RAISE(ABORT, 'Term is closed'); END;").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES ('S1', 'Van', 'Nguyen', 1, 0);").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("INSERT INTO Courses (id, name, credits) VALUES ('C1', 'Programming', 3), ('C2', 'Databases', 3);").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("INSERT INTO Enrollments (studentId, courseId) VALUES ('S1', 'C1'), ('S2', 'C1'), ('S1', 'C2');").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("INSERT INTO CourseResults (studentId, courseId, marks) VALUES ('S1', 'C2', 80);").has_value());
+
+    ASSERT_TRUE(adapter.ensureTablesExist().has_value());
+    ASSERT_TRUE(adapter.ensureTablesExist().has_value()); // Chạy lại không thêm cột hay đếm lại lần nữa
+    auto schedules = adapter.executeQuery("SELECT schedule FROM Courses WHERE id = 'C1';");
+    ASSERT_TRUE(schedules.has_value());
+    EXPECT_EQ(std::any_cast<std::string>(schedules->front().at("schedule")), "");
+    // Đăng ký và kết quả cũ chưa thuộc học kỳ nào
+    auto unassigned = adapter.executeQuery("SELECT (SELECT COUNT(*) FROM Enrollments WHERE termId IS NULL) AS enrollments, "
+                                           "(SELECT COUNT(*) FROM CourseResults WHERE termId IS NULL) AS results;");
+    ASSERT_TRUE(unassigned.has_value());
+    EXPECT_EQ(std::any_cast<long long>(unassigned->front().at("enrollments")), 3);
+    EXPECT_EQ(std::any_cast<long long>(unassigned->front().at("results")), 1);
+
+    // Người dùng cũ và người dùng mới đều có ngày đổi trạng thái
+    ASSERT_TRUE(adapter.executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES ('S2', 'Thi', 'Tran', 1, 1);").has_value());
+    auto missingDates = adapter.executeQuery("SELECT COUNT(*) AS missing FROM Users WHERE statusChangedAt = '';");
+    ASSERT_TRUE(missingDates.has_value());
+    EXPECT_EQ(std::any_cast<long long>(missingDates->front().at("missing")), 0);
+
+    // Trigger có thân đã đổi được tạo lại
+    auto trigger = adapter.executeQuery("SELECT sql FROM sqlite_master WHERE name = 'trg_Enrollments_term_closed_delete';");
+    ASSERT_TRUE(trigger.has_value());
+    ASSERT_EQ(trigger->size(), 1u);
+    EXPECT_NE(std::any_cast<std::string>(trigger->front().at("sql")).find("ArchiveQueue"), std::string::npos);
+
+    auto seats = adapter.executeQuery("SELECT id, capacity, enrolledCount FROM Courses ORDER BY id;");
+    ASSERT_TRUE(seats.has_value());
+    ASSERT_EQ(seats->size(), 2u);
+    EXPECT_EQ(std::any_cast<long long>((*seats)[0].at("capacity")), 0);
+    EXPECT_EQ(std::any_cast<long long>((*seats)[0].at("enrolledCount")), 2);
+    EXPECT_EQ(std::any_cast<long long>((*seats)[1].at("enrolledCount")), 1);
+
+    // Các trigger giữ chỗ hoạt động trên bảng đã nâng cấp
+    ASSERT_TRUE(adapter.executeUpdate("UPDATE Courses SET capacity = 2 WHERE id = 'C1';").has_value());
+    auto full = adapter.executeUpdate("INSERT INTO Enrollments (studentId, courseId) VALUES ('S3', 'C1');");
+    ASSERT_FALSE(full.has_value());
+    EXPECT_NE(full.error().message.find("Course capacity reached"), std::string::npos);
+    ASSERT_TRUE(adapter.executeUpdate("DELETE FROM Enrollments WHERE studentId = 'S1' AND courseId = 'C1';").has_value());
+    ASSERT_TRUE(adapter.executeUpdate("INSERT INTO Enrollments (studentId, courseId) VALUES ('S3', 'C1');").has_value());
+
+    adapter.disconnect();
+}
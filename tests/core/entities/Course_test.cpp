@@ -71,3 +71,29 @@ TEST(CourseTest, ValidateBasic_Invalid) {
     EXPECT_FALSE(c3.validateBasic().errors.empty());
     EXPECT_FALSE(c4.validateBasic().errors.empty());
 }
+
+// Lịch học: đọc, ghi lại và từ chối buổi học trùng nhau
+TEST(CourseTest, MeetingSlots_ParseAndSet) {
+    auto slots = MeetingSlot::parseSchedule("Mon 07:30-09:30 E301; wed 13:00-15:00 F201");
+    ASSERT_TRUE(slots.has_value());
+    ASSERT_EQ(slots->size(), 2u);
+    EXPECT_EQ(slots->at(0).weekday, 1);
+    EXPECT_EQ(slots->at(0).startMinute, 450);
+    EXPECT_EQ(slots->at(1).toString(), "Wed 13:00-15:00 F201");
+    EXPECT_EQ(MeetingSlot::formatSchedule(slots.value()), "Mon 07:30-09:30 E301; Wed 13:00-15:00 F201");
+    EXPECT_TRUE(MeetingSlot::parseSchedule("").value().empty());
+
+    EXPECT_FALSE(MeetingSlot::parseSchedule("Mon 09:30-07:30 E301").has_value());
+    EXPECT_FALSE(MeetingSlot::parseSchedule("Mon 07:31-09:30 E301").has_value());
+    EXPECT_FALSE(MeetingSlot::parseSchedule("Xyz 07:30-09:30 E301").has_value());
+
+    Course c("CS101", "Intro to Programming", 3, "CS");
+    EXPECT_TRUE(c.setMeetingSlots(slots.value()));
+    EXPECT_EQ(c.getMeetingSlots(), slots.value());
+    EXPECT_TRUE(c.validateBasic().isValid);
+
+    auto clashing = MeetingSlot::parseSchedule("Mon 07:30-09:30 E301; Mon 09:00-10:00 E302");
+    ASSERT_TRUE(clashing.has_value());
+    EXPECT_FALSE(c.setMeetingSlots(clashing.value()));
+    EXPECT_EQ(c.getMeetingSlots(), slots.value());
+}
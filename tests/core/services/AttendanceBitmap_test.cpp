@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/services/AttendanceBitmap.h"
+#include <random>
+#include <vector>
+
+TEST(AttendanceBitmapTest, EncodesSmallerContainerAndRoundTrips) {
+    AttendanceBitmap full;
+    for (std::size_t slot = 0; slot < 300; ++slot) full.set(slot, slot % 10 != 0);
+    auto dense = full.encode();
+    EXPECT_EQ(dense.size(), 1u + 38u); // Bitmap thô 300 bit
+    auto decodedFull = AttendanceBitmap::decode(dense);
+    ASSERT_TRUE(decodedFull.has_value());
+    EXPECT_EQ(decodedFull->count(), 270u);
+    EXPECT_FALSE(decodedFull->test(0));
+    EXPECT_TRUE(decodedFull->test(299));
+
+    AttendanceBitmap sparse;
+    sparse.set(5);
+    sparse.set(290);
+    auto encoded = sparse.encode();
+    EXPECT_EQ(encoded.size(), 1u + 4u); // Hai slot dạng mảng
+    auto decodedSparse = AttendanceBitmap::decode(encoded);
+    ASSERT_TRUE(decodedSparse.has_value());
+    EXPECT_TRUE(decodedSparse->test(290));
+    EXPECT_EQ(decodedSparse->count(), 2u);
+
+    EXPECT_EQ(AttendanceBitmap().encode().size(), 1u);
+    EXPECT_FALSE(AttendanceBitmap::decode({}).has_value());
+    EXPECT_FALSE(AttendanceBitmap::decode({7, 1}).has_value());
+}
+
+TEST(AttendanceTallyTest, BitSlicedCountsMatchPerBitCounts) {
+    constexpr std::size_t students = 300;
+    constexpr int sessions = 100;
+    std::mt19937 rng(45);
+    AttendanceTally tally(students);
+    std::vector<int> expected(students, 0);
+    std::size_t storedBytes = 0;
+    for (int session = 0; session < sessions; ++session) {
+        AttendanceBitmap bitmap;
+        for (std::size_t slot = 0; slot < students; ++slot) {
+            if (rng() % 100 < 20 + slot % 80) {
+                bitmap.set(slot);
+                ++expected[slot];
+            }
+        }
+        storedBytes += bitmap.encode().size();
+        tally.add(bitmap);
+    }
+    EXPECT_EQ(tally.sessionCount(), static_cast<std::size_t>(sessions));
+    EXPECT_EQ(tally.counts(), expected);
+    EXPECT_LE(storedBytes, 4000u); // 100 buổi x 300 sinh viên chỉ vài KB
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/services/ExamScheduler.h"
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(ExamSchedulerTest, SeparatesSharedStudentsAndRespectsDailyLimit) {
+    // S0 học A, B, C; S1 học C, D: A-B-C là tam giác, D chỉ xung đột với C
+    ExamScheduler scheduler({"A", "B", "C", "D"}, {{0, 1, 2}, {2, 3}});
+    EXPECT_TRUE(scheduler.conflicts(0, 2));
+    EXPECT_FALSE(scheduler.conflicts(0, 3));
+    EXPECT_EQ(scheduler.conflictCount(), 4u);
+
+    auto slots = scheduler.schedule(ExamSchedulingOptions{3, 1, 0});
+    ASSERT_TRUE(slots.has_value());
+    std::map<std::string, ExamSlot> byCourse;
+    for (const auto& slot : slots.value()) byCourse[slot.courseId] = slot;
+    // Mỗi ngày S0 chỉ thi một môn nên A, B, C ở ba ngày khác nhau
+    EXPECT_NE(byCourse["A"].day, byCourse["B"].day);
+    EXPECT_NE(byCourse["A"].day, byCourse["C"].day);
+    EXPECT_NE(byCourse["B"].day, byCourse["C"].day);
+    EXPECT_NE(byCourse["C"].day, byCourse["D"].day);
+
+    EXPECT_EQ(scheduler.schedule(ExamSchedulingOptions{0, 1, 0}).error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(scheduler.schedule(ExamSchedulingOptions{3, 2, 1}).error().code, ErrorCode::VALIDATION_ERROR); // C có 2 sinh viên
+}
+
+TEST(ExamSchedulerTest, RandomEnrollmentsProduceValidSchedule) {
+    constexpr std::size_t courseCount = 600;
+    constexpr std::size_t studentCount = 8000;
+    constexpr int periodsPerDay = 3;
+    constexpr int maxPerDay = 2;
+    constexpr int seatsPerPeriod = 900;
+    std::mt19937 rng(43);
+    std::vector<std::string> courseIds;
+    for (std::size_t i = 0; i < courseCount; ++i) courseIds.push_back("C" + std::to_string(i));
+    std::vector<std::vector<std::uint32_t>> coursesOfStudent(studentCount);
+    for (auto& courses : coursesOfStudent) {
+        std::uint32_t major = static_cast<std::uint32_t>(rng() % (courseCount - 10));
+        for (std::uint32_t offset = 0; offset < 5; ++offset) courses.push_back(major + offset * 2);
+    }
+
+    ExamScheduler scheduler(courseIds, coursesOfStudent);
+    auto slots = scheduler.schedule(ExamSchedulingOptions{periodsPerDay, maxPerDay, seatsPerPeriod});
+    ASSERT_TRUE(slots.has_value());
+    ASSERT_EQ(slots->size(), courseCount);
+
+    std::vector<ExamSlot> slotOf(courseCount);
+    for (const auto& slot : slots.value()) slotOf[std::stoul(slot.courseId.substr(1))] = slot;
+    std::map<std::pair<int, int>, std::size_t> seats;
+    std::vector<std::size_t> sizeOf(courseCount, 0);
+    for (const auto& courses : coursesOfStudent) {
+        std::map<int, int> examsPerDay;
+        for (std::size_t i = 0; i < courses.size(); ++i) {
+            ++sizeOf[courses[i]];
+            ++examsPerDay[slotOf[courses[i]].day];
+            for (std::size_t j = i + 1; j < courses.size(); ++j) {
+                const auto& a = slotOf[courses[i]];
+                const auto& b = slotOf[courses[j]];
+                ASSERT_FALSE(a.day == b.day && a.period == b.period) << a.courseId << " and " << b.courseId;
+            }
+        }
+        for (const auto& [day, count] : examsPerDay) ASSERT_LE(count, maxPerDay);
+    }
+    for (std::size_t course = 0; course < courseCount; ++course) seats[{slotOf[course].day, slotOf[course].period}] += sizeOf[course];
+    for (const auto& [slot, used] : seats) EXPECT_LE(used, static_cast<std::size_t>(seatsPerPeriod));
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/services/GpaSimulator.h"
+#include <map>
+#include <string>
+
+TEST(GpaSimulatorTest, SimulatesOnCachedTotals) {
+    // Đã có điểm: 6 tín chỉ, tổng 18 điểm có trọng số (CGPA 3.0); đang học M1 (3 tc), M2 (1 tc)
+    GpaSimulator simulator("S1", WeightedGradePoints{18, 6}, {{"M1", 3}, {"M2", 1}, {"Z0", 0}});
+    EXPECT_DOUBLE_EQ(simulator.currentCgpa(), 3.0);
+    ASSERT_EQ(simulator.getPendingCourses().size(), 2u); // Môn 0 tín chỉ bị bỏ qua
+
+    EXPECT_DOUBLE_EQ(simulator.simulate({}).value(), 3.0);
+    EXPECT_DOUBLE_EQ(simulator.simulate({{"M1", 90}}).value(), 30.0 / 9.0);
+    EXPECT_DOUBLE_EQ(simulator.simulate({{"M1", 90}, {"M2", 39}}).value(), 3.0);
+    EXPECT_DOUBLE_EQ(simulator.simulate({{"M1", -1}, {"M2", 100}}).value(), 22.0 / 7.0);
+
+    EXPECT_EQ(simulator.simulate({{"NOPE", 50}}).error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(simulator.simulate({{"M1", 101}}).error().code, ErrorCode::VALIDATION_ERROR);
+}
+
+TEST(GpaSimulatorTest, SolvesMinimumMarksForTarget) {
+    GpaSimulator simulator("S1", WeightedGradePoints{18, 6}, {{"M1", 3}, {"M2", 1}});
+
+    // 3.2 * 10 = 32 điểm: cần 14 điểm từ 4 tín chỉ -> cùng mức A (16) vì B chỉ được 12
+    auto plan = simulator.solveForTarget(3.2).value();
+    EXPECT_TRUE(plan.reachable);
+    EXPECT_DOUBLE_EQ(plan.bestCaseCgpa, 3.4);
+    EXPECT_EQ(plan.uniformMinimumMarks, GradeScale::A_MIN_MARKS);
+    ASSERT_EQ(plan.perCourse.size(), 2u);
+    // M1 với M2 = A: 18 + 4 + 3g >= 32 -> g = 4; M2 với M1 = A: 18 + 12 + g >= 32 -> g = 2
+    EXPECT_EQ(plan.perCourse[0].minimumMarks, GradeScale::A_MIN_MARKS);
+    EXPECT_EQ(plan.perCourse[1].minimumMarks, GradeScale::C_MIN_MARKS);
+
+    // Mục tiêu thấp hơn CGPA hiện tại vẫn cần điểm vì tín chỉ mới làm tăng mẫu số
+    plan = simulator.solveForTarget(1.8).value();
+    EXPECT_EQ(plan.uniformMinimumMarks, GradeScale::MIN_MARKS);
+    EXPECT_EQ(plan.perCourse[1].minimumMarks, GradeScale::MIN_MARKS);
+
+    // Cố định M1 = B: 18 + 9 + g >= 3.0 * 10 -> g = 3
+    plan = simulator.solveForTarget(3.0, {{"M1", 70}}).value();
+    ASSERT_EQ(plan.perCourse.size(), 1u);
+    EXPECT_EQ(plan.perCourse[0].courseId, "M2");
+    EXPECT_EQ(plan.perCourse[0].minimumMarks, GradeScale::B_MIN_MARKS);
+
+    plan = simulator.solveForTarget(3.5).value();
+    EXPECT_FALSE(plan.reachable);
+    EXPECT_EQ(plan.uniformMinimumMarks, -1);
+    EXPECT_EQ(plan.perCourse[0].minimumMarks, -1);
+
+    EXPECT_EQ(simulator.solveForTarget(4.5).error().code, ErrorCode::VALIDATION_ERROR);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/services/GraduationAuditor.h"
+#include <string>
+#include <vector>
+
+TEST(GraduationAuditorTest, ReportsEachShortfall) {
+    // A, B, C mỗi môn 3 tín chỉ; X 0 tín chỉ không tính vào CGPA
+    GraduationAuditor auditor({"A", "B", "C", "X"}, {3, 3, 3, 0},
+                              {DegreeRequirement{"IT", 6, 2.5, {"A", "C", "GONE"}}});
+
+    // Qua A (B = 3.0) và B (C = 2.0), trượt C: 6 tín chỉ, CGPA (9 + 6 + 0) / 9
+    auto entry = auditor.audit(StudentTranscript{"S1", "IT", {{0, 75}, {1, 60}, {2, 20}, {3, 100}}});
+    EXPECT_FALSE(entry.eligible);
+    EXPECT_EQ(entry.earnedCredits, 6);
+    EXPECT_NEAR(entry.cgpa, 15.0 / 9.0, 1e-9);
+    EXPECT_EQ(entry.missingCourseIds, (std::vector<std::string>{"C", "GONE"}));
+    EXPECT_EQ(entry.shortfalls.size(), 2u); // CGPA và môn bắt buộc; tín chỉ đã đủ
+
+    auto noRule = auditor.audit(StudentTranscript{"S2", "MATH", {{0, 90}}});
+    EXPECT_FALSE(noRule.eligible);
+    ASSERT_EQ(noRule.shortfalls.size(), 1u);
+
+    GraduationAuditor exact({"A", "B"}, {2, 2}, {DegreeRequirement{"IT", 4, 2.5, {"A"}}});
+    // B (3.0) và C (2.0) cùng tín chỉ: CGPA đúng bằng ngưỡng 2.5
+    auto atThreshold = exact.audit(StudentTranscript{"S3", "IT", {{0, 70}, {1, 55}}});
+    EXPECT_TRUE(atThreshold.eligible);
+    EXPECT_TRUE(atThreshold.shortfalls.empty());
+}
+
+TEST(GraduationAuditorTest, ParallelAuditMatchesSingleStudentAudit) {
+    constexpr std::size_t courseCount = 200;
+    std::vector<std::string> courseIds;
+    std::vector<int> credits;
+    for (std::size_t i = 0; i < courseCount; ++i) {
+        courseIds.push_back("C" + std::to_string(i));
+        credits.push_back(static_cast<int>(i % 4) + 1);
+    }
+    std::vector<DegreeRequirement> requirements{DegreeRequirement{"F0", 40, 2.0, {"C0", "C64", "C130"}},
+                                                DegreeRequirement{"F1", 20, 1.5, {"C7"}}};
+    GraduationAuditor auditor(courseIds, credits, requirements);
+
+    std::vector<StudentTranscript> transcripts;
+    for (std::size_t s = 0; s < 10000; ++s) {
+        StudentTranscript transcript{"S" + std::to_string(s), "F" + std::to_string(s % 3), {}};
+        for (std::size_t k = 0; k < 20; ++k) {
+            transcript.marks.emplace_back(static_cast<std::uint32_t>((s * 7 + k * 13) % courseCount),
+                                          static_cast<int>((s * 31 + k * 17) % 101));
+        }
+        transcripts.push_back(std::move(transcript));
+    }
+
+    auto entries = auditor.auditAll(transcripts);
+    ASSERT_EQ(entries.size(), transcripts.size());
+    std::size_t eligible = 0;
+    for (std::size_t s = 0; s < transcripts.size(); ++s) {
+        auto expected = auditor.audit(transcripts[s]);
+        ASSERT_EQ(entries[s].studentId, expected.studentId);
+        ASSERT_EQ(entries[s].eligible, expected.eligible);
+        ASSERT_EQ(entries[s].earnedCredits, expected.earnedCredits);
+        ASSERT_EQ(entries[s].missingCourseIds, expected.missingCourseIds);
+        if (entries[s].eligible) ++eligible;
+    }
+    EXPECT_GT(eligible, 0u);
+}
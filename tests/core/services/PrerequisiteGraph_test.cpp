@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/services/PrerequisiteGraph.h"
+#include <string>
+#include <vector>
+
+TEST(PrerequisiteGraphTest, ClosureCoversLongChainsAndRejectsCycles) {
+    // Chuỗi C0 <- C1 <- ... <- C149: vượt qua ranh giới từ máy 64 bit của bitset
+    PrerequisiteGraph graph;
+    for (int i = 1; i < 150; ++i) {
+        ASSERT_TRUE(graph.add("C" + std::to_string(i), "C" + std::to_string(i - 1)).has_value());
+    }
+    EXPECT_EQ(graph.allPrerequisites("C149").size(), 149u);
+    EXPECT_EQ(graph.directPrerequisites("C149"), std::vector<std::string>{"C148"});
+    EXPECT_FALSE(graph.hasPrerequisites("C0"));
+
+    auto cycle = graph.add("C0", "C149");
+    ASSERT_FALSE(cycle.has_value());
+    EXPECT_EQ(cycle.error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(graph.add("C5", "C5").error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(graph.add("C5", "C4").error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_TRUE(graph.allPrerequisites("C0").empty());
+
+    std::vector<std::string> passed;
+    for (int i = 0; i < 149; ++i) {
+        if (i != 70) passed.push_back("C" + std::to_string(i));
+    }
+    EXPECT_EQ(graph.missingPrerequisites("C149", graph.bitsetOf(passed)), std::vector<std::string>{"C70"});
+    passed.push_back("C70");
+    EXPECT_TRUE(graph.missingPrerequisites("C149", graph.bitsetOf(passed)).empty());
+}
+
+TEST(PrerequisiteGraphTest, RemovingEdgeKeepsPrerequisitesReachableByOtherPaths) {
+    auto graph = PrerequisiteGraph::build({{"CS301", "CS201"}, {"CS301", "MATH101"}, {"CS201", "MATH101"}, {"CS201", "CS101"}});
+    ASSERT_TRUE(graph.has_value());
+    EXPECT_EQ(graph->allPrerequisites("CS301"), (std::vector<std::string>{"CS101", "CS201", "MATH101"}));
+
+    // MATH101 vẫn cần qua CS201
+    ASSERT_TRUE(graph->remove("CS301", "MATH101"));
+    EXPECT_EQ(graph->allPrerequisites("CS301"), (std::vector<std::string>{"CS101", "CS201", "MATH101"}));
+
+    ASSERT_TRUE(graph->remove("CS201", "MATH101"));
+    EXPECT_EQ(graph->allPrerequisites("CS301"), (std::vector<std::string>{"CS101", "CS201"}));
+    EXPECT_FALSE(graph->remove("CS201", "MATH101"));
+
+    // Cạnh bị xóa không còn chặn chiều ngược lại
+    EXPECT_TRUE(graph->add("MATH101", "CS301").has_value());
+    EXPECT_FALSE(PrerequisiteGraph::build({{"A", "B"}, {"B", "C"}, {"C", "A"}}).has_value());
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/services/TimetableIndex.h"
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<MeetingSlot> schedule(const std::string& text) {
+        return MeetingSlot::parseSchedule(text).value();
+    }
+}
+
+TEST(TimetableIndexTest, MaskMatchesSlotOverlap) {
+    auto morning = WeeklyTimetable::maskOf(schedule("Mon 07:30-09:30 E301"));
+    auto touching = WeeklyTimetable::maskOf(schedule("Mon 09:30-11:00 E302"));
+    auto overlapping = WeeklyTimetable::maskOf(schedule("Mon 09:25-10:00 E302"));
+    auto otherDay = WeeklyTimetable::maskOf(schedule("Tue 07:30-09:30 E301"));
+    auto lastCell = WeeklyTimetable::maskOf(schedule("Sun 23:55-24:00 E301"));
+
+    WeeklyTimetable timetable;
+    EXPECT_TRUE(timetable.empty());
+    timetable.add(morning);
+    EXPECT_FALSE(timetable.clashesWith(touching));
+    EXPECT_TRUE(timetable.clashesWith(overlapping));
+    EXPECT_FALSE(timetable.clashesWith(otherDay));
+    EXPECT_TRUE(lastCell.test(WeeklyTimetable::CELLS - 1));
+    EXPECT_EQ(morning.count(), 24u);
+}
+
+TEST(TimetableIndexTest, StudentTimetableIsKeyedByCourseSetAndInvalidated) {
+    TimetableIndex index;
+    index.storeCourse("CS101", schedule("Mon 07:30-09:30 E301"));
+    ASSERT_TRUE(index.findCourse("CS101").has_value());
+    EXPECT_FALSE(index.findCourse("CS102").has_value());
+
+    WeeklyTimetable timetable;
+    timetable.add(index.findCourse("CS101")->mask);
+    index.storeStudent("S001", {"CS101"}, timetable);
+    EXPECT_TRUE(index.findStudent("S001", {"CS101"}).has_value());
+    // Danh sách khóa học khác với lúc đệm (ví dụ được đăng ký từ danh sách chờ): phải ghép lại
+    EXPECT_FALSE(index.findStudent("S001", {"CS101", "CS102"}).has_value());
+
+    index.invalidateCourse("CS101");
+    EXPECT_FALSE(index.findCourse("CS101").has_value());
+    EXPECT_FALSE(index.findStudent("S001", {"CS101"}).has_value());
+}
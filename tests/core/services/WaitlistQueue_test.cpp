@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "../../../src/core/services/WaitlistQueue.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    WaitlistEntry entry(const std::string& studentId, int priorityClass, long long requestedAt) {
+        return WaitlistEntry{"CS101", studentId, priorityClass, requestedAt};
+    }
+}
+
+TEST(WaitlistQueueTest, OrdersByPriorityClassThenRequestTime) {
+    WaitlistQueue queue("CS101");
+    ASSERT_TRUE(queue.push(entry("S001", 1, 10)));
+    ASSERT_TRUE(queue.push(entry("S002", 0, 20)));
+    ASSERT_TRUE(queue.push(entry("S003", 1, 30)));
+    ASSERT_TRUE(queue.push(entry("S004", 0, 40)));
+    EXPECT_FALSE(queue.push(entry("S001", 0, 50)));
+    EXPECT_FALSE(queue.push(WaitlistEntry{"CS102", "S005", 0, 60}));
+
+    EXPECT_EQ(queue.position("S002"), 1u);
+    EXPECT_EQ(queue.position("S004"), 2u);
+    EXPECT_EQ(queue.position("S001"), 3u);
+    EXPECT_EQ(queue.position("S003"), 4u);
+    EXPECT_FALSE(queue.position("S999").has_value());
+    EXPECT_EQ(queue.front()->studentId, "S002");
+
+    ASSERT_TRUE(queue.erase("S002"));
+    EXPECT_FALSE(queue.erase("S002"));
+    EXPECT_EQ(queue.front()->studentId, "S004");
+    EXPECT_EQ(queue.position("S003"), 3u);
+}
+
+TEST(WaitlistQueueTest, LateArrivalIsInsertedInRequestOrder) {
+    WaitlistQueue queue("CS101");
+    ASSERT_TRUE(queue.push(entry("S001", 0, 10)));
+    ASSERT_TRUE(queue.push(entry("S003", 0, 30)));
+    ASSERT_TRUE(queue.push(entry("S002", 0, 20)));
+
+    EXPECT_EQ(queue.position("S002"), 2u);
+    EXPECT_EQ(queue.position("S003"), 3u);
+    auto entries = queue.entries();
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[1].studentId, "S002");
+}
+
+TEST(WaitlistQueueTest, PositionsMatchSortedOrderUnderChurn) {
+    WaitlistQueue queue("CS101");
+    std::vector<WaitlistEntry> expected;
+    std::mt19937 rng(40);
+    long long clock = 0;
+    for (int step = 0; step < 2000; ++step) {
+        if (!expected.empty() && rng() % 3 == 0) {
+            std::size_t victim = rng() % expected.size();
+            ASSERT_TRUE(queue.erase(expected[victim].studentId));
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(victim));
+        } else {
+            auto added = entry("S" + std::to_string(step), static_cast<int>(rng() % 3), ++clock);
+            ASSERT_TRUE(queue.push(added));
+            expected.push_back(added);
+        }
+    }
+    std::sort(expected.begin(), expected.end(), [](const WaitlistEntry& a, const WaitlistEntry& b) { return a.queuedBefore(b); });
+
+    ASSERT_EQ(queue.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(queue.position(expected[i].studentId), i + 1) << expected[i].studentId;
+    }
+    EXPECT_EQ(queue.front()->studentId, expected.front().studentId);
+}
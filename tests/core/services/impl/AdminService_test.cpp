@@ -332,4 +332,228 @@
 //     ASSERT_FALSE(result);
 // }
 
-// // --- END OF MODIFIED FILE tests/core/services/impl/AdminService_test.cpp ---
\ No newline at end of file
+// // --- END OF MODIFIED FILE tests/core/services/impl/AdminService_test.cpp ---
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/AdminService.h"
+#include "../../../../src/core/services/impl/IdSequenceService.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockTeacherDao.h"
+#include "../../../../src/core/data_access/mock/MockLoginDao.h"
+#include "../../../../src/core/data_access/mock/MockFeeRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockSalaryRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/data_access/mock/MockSequenceDao.h"
+#include "../../../../src/core/data_access/NullTransactionManager.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "CountingReportService.h"
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+
+namespace {
+    // Đếm số lần giữ chỗ khối ID của mỗi tiền tố, phần cấp phát thật do IdSequenceService làm
+    class CountingIdSequenceService : public IIdSequenceService {
+    public:
+        std::shared_ptr<IIdSequenceService> inner;
+        std::map<std::string, std::vector<std::size_t>> reservations; // Tiền tố -> số lượng của từng lần giữ chỗ
+
+        explicit CountingIdSequenceService(std::shared_ptr<IIdSequenceService> service) : inner(std::move(service)) {}
+
+        std::string studentIdPrefix(const std::string& facultyId) const override { return inner->studentIdPrefix(facultyId); }
+        std::expected<std::string, Error> nextStudentId(const std::string& idPrefix) override { return inner->nextStudentId(idPrefix); }
+        std::expected<StudentIdBlock, Error> reserveStudentIds(const std::string& idPrefix, std::size_t count) override {
+            reservations[idPrefix].push_back(count);
+            return inner->reserveStudentIds(idPrefix, count);
+        }
+        std::expected<std::size_t, Error> ensureInitialized() override { return inner->ensureInitialized(); }
+    };
+
+    // Ghi thông tin đăng nhập theo lô luôn thất bại, để kiểm tra cả lô được rollback
+    class FailingBatchLoginDao : public MockLoginDao {
+    public:
+        std::expected<bool, Error> addUserCredentialsBatch(const std::vector<LoginCredentials>&) override {
+            return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "login batch failed"});
+        }
+    };
+
+    const std::string ADMISSION_HEADER = "email,firstName,lastName,facultyId,birthDay,birthMonth,birthYear,citizenId,address,phoneNumber,password\n";
+
+    std::string admissionLine(const std::string& suffix, const std::string& facultyId, const std::string& email = "") {
+        return (email.empty() ? "new" + suffix + "@example.com" : email) + ",Van,Nguyen," + facultyId + ",1,1,2006,0792000000" + suffix +
+               ",Hanoi,09100000" + suffix + ",\n";
+    }
+}
+
+class AdminServiceImportTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<MockFeeRecordDao> feeDao;
+    std::shared_ptr<CountingIdSequenceService> idSequenceService;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<CountingReportService> reportService;
+    std::filesystem::path file;
+
+    void SetUp() override {
+        clearMocks();
+        studentDao = std::make_shared<MockStudentDao>();
+        feeDao = std::make_shared<MockFeeRecordDao>();
+        idSequenceService = std::make_shared<CountingIdSequenceService>(
+            std::make_shared<IdSequenceService>(std::make_shared<MockSequenceDao>(), studentDao, std::make_shared<MockTeacherDao>()));
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        reportService = std::make_shared<CountingReportService>();
+        MockFacultyDao facultyDao;
+        ASSERT_TRUE(facultyDao.add(Faculty("IT", "Information Technology")).has_value());
+        ASSERT_TRUE(facultyDao.add(Faculty("CS", "Computer Science")).has_value());
+        file = std::filesystem::temp_directory_path() /
+               ("admin_service_import_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".csv");
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(file);
+        clearMocks();
+    }
+
+    static void clearMocks() {
+        MockStudentDao::clearMockData();
+        MockTeacherDao::clearMockData();
+        MockLoginDao::clearMockData();
+        MockFeeRecordDao::clearMockData();
+        MockFacultyDao::clearMockData();
+        MockSequenceDao::clearMockData();
+    }
+
+    void writeFile(const std::string& content) {
+        std::ofstream out(file, std::ios::binary);
+        out << content;
+    }
+
+    std::shared_ptr<AdminService> makeService(std::shared_ptr<ILoginDao> loginDao = std::make_shared<MockLoginDao>()) {
+        return std::make_shared<AdminService>(studentDao, std::make_shared<MockTeacherDao>(), std::make_shared<MockFacultyDao>(),
+                                              std::move(loginDao), feeDao, std::make_shared<MockSalaryRecordDao>(),
+                                              std::make_shared<MockEnrollmentDao>(), std::make_shared<MockCourseResultDao>(),
+                                              std::make_shared<GeneralInputValidator>(), sessionContext, idSequenceService,
+                                              std::make_shared<NullTransactionManager>(), reportService);
+    }
+
+    void addExistingStudent(const std::string& email, const std::string& citizenId) {
+        Student student(idSequenceService->studentIdPrefix("IT") + "0001", "Thi", "Tran", "IT", LoginStatus::ACTIVE);
+        student.setBirthday(2, 2, 2005);
+        student.setEmail(email);
+        student.setCitizenId(citizenId);
+        student.setPhoneNumber("0911111111");
+        ASSERT_TRUE(studentDao->add(student).has_value());
+    }
+};
+
+TEST_F(AdminServiceImportTest, DuplicatesInFileAndInSystemAreReported) {
+    addExistingStudent("taken@example.com", "079200000099");
+    writeFile(ADMISSION_HEADER +
+              admissionLine("11", "IT") +                           // Dòng 2: hợp lệ
+              admissionLine("12", "IT", "NEW11@example.com") +      // Dòng 3: trùng email dòng 2 (không phân biệt hoa thường)
+              admissionLine("13", "IT", "taken@example.com") +      // Dòng 4: email đã có trong hệ thống
+              "new14@example.com,Van,Nguyen,IT,1,1,2006,079200000011,Hanoi,0910000014,\n" + // Dòng 5: trùng CCCD dòng 2
+              "new15@example.com,Van,Nguyen,IT,1,1,2006,079200000099,Hanoi,0910000015,\n" + // Dòng 6: CCCD đã có trong hệ thống
+              admissionLine("16", "IT", "new14@example.com"));      // Dòng 7: email của dòng bị loại vẫn dùng được
+
+    auto report = makeService()->importStudentAdmissions(file.string(), "Password123");
+    ASSERT_TRUE(report.has_value()) << report.error().message;
+    EXPECT_EQ(report->totalRows, 6u);
+
+    ASSERT_EQ(report->admitted.size(), 2u);
+    EXPECT_EQ(report->admitted[0].lineNumber, 2u);
+    EXPECT_EQ(report->admitted[1].lineNumber, 7u);
+    EXPECT_EQ(report->admitted[1].email, "new14@example.com");
+
+    ASSERT_EQ(report->lineErrors.size(), 4u);
+    EXPECT_EQ(report->lineErrors[0].lineNumber, 3u);
+    EXPECT_EQ(report->lineErrors[0].message, "Duplicate email; already listed on line 2.");
+    EXPECT_EQ(report->lineErrors[1].lineNumber, 4u);
+    EXPECT_EQ(report->lineErrors[1].message, "Email already registered.");
+    EXPECT_EQ(report->lineErrors[2].lineNumber, 5u);
+    EXPECT_EQ(report->lineErrors[2].message, "Duplicate citizen ID; already listed on line 2.");
+    EXPECT_EQ(report->lineErrors[3].lineNumber, 6u);
+    EXPECT_EQ(report->lineErrors[3].message, "Citizen ID already registered.");
+}
+
+TEST_F(AdminServiceImportTest, IdsAreReservedAsOneBlockPerPrefix) {
+    addExistingStudent("old@example.com", "079200000099"); // Tiền tố IT đã dùng số 0001
+    writeFile(ADMISSION_HEADER + admissionLine("11", "IT") + admissionLine("12", "CS") + admissionLine("13", "IT") +
+              admissionLine("14", "IT") + admissionLine("15", "CS"));
+
+    auto report = makeService()->importStudentAdmissions(file.string(), "Password123");
+    ASSERT_TRUE(report.has_value()) << report.error().message;
+    ASSERT_EQ(report->admitted.size(), 5u);
+    EXPECT_EQ(report->batchCount, 1u);
+
+    const std::string itPrefix = idSequenceService->studentIdPrefix("IT");
+    const std::string csPrefix = idSequenceService->studentIdPrefix("CS");
+    ASSERT_EQ(idSequenceService->reservations.size(), 2u);
+    EXPECT_EQ(idSequenceService->reservations[itPrefix], std::vector<std::size_t>{3});
+    EXPECT_EQ(idSequenceService->reservations[csPrefix], std::vector<std::size_t>{2});
+
+    // ID liên tiếp trong khối, theo thứ tự dòng trong file
+    EXPECT_EQ(report->admitted[0].studentId, itPrefix + "0002");
+    EXPECT_EQ(report->admitted[1].studentId, csPrefix + "0001");
+    EXPECT_EQ(report->admitted[2].studentId, itPrefix + "0003");
+    EXPECT_EQ(report->admitted[3].studentId, itPrefix + "0004");
+    EXPECT_EQ(report->admitted[4].studentId, csPrefix + "0002");
+
+    for (const auto& entry : report->admitted) {
+        EXPECT_TRUE(studentDao->exists(entry.studentId).value());
+        auto fee = feeDao->getById(entry.studentId);
+        ASSERT_TRUE(fee.has_value());
+        EXPECT_EQ(fee->getTotalFee(), 0);
+        EXPECT_EQ(MockLoginDao().findCredentialsByUserId(entry.studentId)->role, UserRole::STUDENT);
+    }
+    EXPECT_EQ(reportService->invalidations, 1);
+}
+
+TEST_F(AdminServiceImportTest, FailedLoginBatchRollsBackTheWholeBatch) {
+    writeFile(ADMISSION_HEADER + admissionLine("11", "IT") + admissionLine("12", "IT"));
+
+    auto report = makeService(std::make_shared<FailingBatchLoginDao>())->importStudentAdmissions(file.string(), "Password123");
+    ASSERT_TRUE(report.has_value()) << report.error().message;
+    EXPECT_TRUE(report->admitted.empty());
+    EXPECT_EQ(report->batchCount, 0u);
+    ASSERT_EQ(report->lineErrors.size(), 2u);
+    for (const auto& lineError : report->lineErrors) {
+        EXPECT_EQ(lineError.message, "Batch not saved: login batch failed");
+    }
+
+    EXPECT_TRUE(studentDao->getAll()->empty());
+    EXPECT_TRUE(feeDao->getAll()->empty());
+    EXPECT_EQ(reportService->invalidations, 0);
+}
+
+TEST_F(AdminServiceImportTest, InvalidLinesAreReportedInLineOrder) {
+    writeFile(ADMISSION_HEADER +
+              "bad@example.com,Van,Nguyen,IT,1,1\n" +                                             // Dòng 2: thiếu cột
+              "date@example.com,Van,Nguyen,IT,31,2,2006,079200000013,Hanoi,0910000013,\n" +      // Dòng 3: ngày sinh sai
+              admissionLine("14", "EE") +                                                       // Dòng 4: khoa không tồn tại
+              admissionLine("15", "IT") +                                                       // Dòng 5: không có mật khẩu
+              "weak@example.com,Van,Nguyen,IT,1,1,2006,079200000016,Hanoi,0910000016,weak\n" +   // Dòng 6: mật khẩu yếu
+              "not-an-email,Van,Nguyen,IT,1,1,2006,079200000017,Hanoi,0910000017,Password123\n"); // Dòng 7: email sai định dạng
+
+    auto report = makeService()->importStudentAdmissions(file.string(), "");
+    ASSERT_TRUE(report.has_value()) << report.error().message;
+    EXPECT_EQ(report->totalRows, 6u);
+    EXPECT_TRUE(report->admitted.empty());
+
+    ASSERT_EQ(report->lineErrors.size(), 6u);
+    for (std::size_t i = 0; i < report->lineErrors.size(); ++i) {
+        EXPECT_EQ(report->lineErrors[i].lineNumber, i + 2);
+    }
+    EXPECT_EQ(report->lineErrors[0].email, "bad@example.com");
+    EXPECT_EQ(report->lineErrors[0].message, "Malformed CSV record (expected 11 fields).");
+    EXPECT_EQ(report->lineErrors[1].message, "Invalid birth date 31/2/2006.");
+    EXPECT_NE(report->lineErrors[2].message.find("Faculty ID 'EE' not found."), std::string::npos);
+    EXPECT_NE(report->lineErrors[3].message.find("Password is required"), std::string::npos);
+    EXPECT_NE(report->lineErrors[4].message.find("at least 8 characters"), std::string::npos);
+    EXPECT_EQ(report->lineErrors[5].email, "not-an-email");
+    EXPECT_NE(report->lineErrors[5].message.find("Invalid email address format."), std::string::npos);
+}
@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/ArchiveService.h"
+#include "../../../../src/core/services/impl/GraduationAuditService.h"
+#include "../../../../src/core/data_access/NullStudentArchiveDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentArchiveDao.h"
+#include "../../../../src/core/data_access/mock/MockDegreeRequirementDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "../../../../src/core/entities/Student.h"
+#include <memory>
+
+class ArchiveServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<MockCourseDao> courseDao;
+    std::shared_ptr<MockCourseResultDao> courseResultDao;
+    std::shared_ptr<MockEnrollmentDao> enrollmentDao;
+    std::shared_ptr<MockFacultyDao> facultyDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<GraduationAuditService> graduationAuditService;
+    std::shared_ptr<ArchiveService> service;
+
+    void clearAll() {
+        MockStudentArchiveDao::clearMockData();
+        MockDegreeRequirementDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockCourseDao::clearMockData();
+        MockCourseResultDao::clearMockData();
+        MockEnrollmentDao::clearMockData();
+        MockFacultyDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        studentDao = std::make_shared<MockStudentDao>();
+        courseDao = std::make_shared<MockCourseDao>();
+        courseResultDao = std::make_shared<MockCourseResultDao>();
+        enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        facultyDao = std::make_shared<MockFacultyDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        graduationAuditService = std::make_shared<GraduationAuditService>(std::make_shared<MockDegreeRequirementDao>(), studentDao, courseDao,
+                                                                          courseResultDao, facultyDao, std::make_shared<GeneralInputValidator>(),
+                                                                          sessionContext);
+        service = std::make_shared<ArchiveService>(std::make_shared<MockStudentArchiveDao>(), graduationAuditService, enrollmentDao,
+                                                   courseResultDao, sessionContext);
+        ASSERT_TRUE(facultyDao->add(Faculty("IT", "Information Technology")).has_value());
+        ASSERT_TRUE(courseDao->add(Course("CS101", "Programming", 3, "IT")).has_value());
+        ASSERT_TRUE(courseDao->add(Course("CS201", "Data Structures", 3, "IT")).has_value());
+        ASSERT_TRUE(graduationAuditService->setDegreeRequirement(DegreeRequirement{"IT", 3, 2.0, {"CS101"}}).has_value());
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    void addStudent(const std::string& id, const std::string& suffix, LoginStatus status) {
+        Student student(id, "Van", "Nguyen", "IT", status);
+        student.setBirthday(1, 1, 2005);
+        student.setEmail("student" + suffix + "@example.com");
+        student.setCitizenId("0791000000" + suffix);
+        student.setPhoneNumber("09000000" + suffix);
+        ASSERT_TRUE(studentDao->add(student).has_value());
+    }
+
+    void addGrade(const std::string& studentId, const std::string& courseId, int marks) {
+        ASSERT_TRUE(enrollmentDao->addEnrollment(studentId, courseId).has_value());
+        ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult(studentId, courseId, marks)).has_value());
+    }
+};
+
+TEST_F(ArchiveServiceTest, ArchivesDisabledStudentsAndSettledGraduates) {
+    addStudent("S001", "01", LoginStatus::DISABLED);
+    addStudent("S002", "02", LoginStatus::ACTIVE);
+    addStudent("S003", "03", LoginStatus::ACTIVE);
+    addStudent("S004", "04", LoginStatus::ACTIVE);
+    addStudent("S005", "05", LoginStatus::DISABLED);
+    addGrade("S002", "CS101", 80);
+    addGrade("S003", "CS101", 80);
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S003", "CS201").has_value()); // Còn môn đang học
+    addGrade("S004", "CS101", 20);
+
+    auto report = service->runArchival(ArchivePolicy{365, true, 1});
+    ASSERT_TRUE(report.has_value());
+    EXPECT_EQ(report->disabledArchived, 2u);
+    EXPECT_EQ(report->graduatesArchived, 1u);
+    EXPECT_EQ(report->batches, 3u);
+
+    EXPECT_TRUE(service->isStudentArchived("S001").value());
+    EXPECT_TRUE(service->isStudentArchived("S002").value());
+    EXPECT_FALSE(service->isStudentArchived("S003").value());
+    EXPECT_FALSE(studentDao->exists("S002").value());
+    EXPECT_TRUE(courseResultDao->findByStudentId("S002")->empty());
+    EXPECT_EQ(studentDao->getAll()->size(), 2u);
+
+    // Lần chạy sau không còn gì để chuyển
+    auto again = service->runArchival(ArchivePolicy{});
+    ASSERT_TRUE(again.has_value());
+    EXPECT_EQ(again->disabledArchived + again->graduatesArchived, 0u);
+}
+
+TEST_F(ArchiveServiceTest, RejectsInvalidPolicyAndMissingArchive) {
+    EXPECT_EQ(service->runArchival(ArchivePolicy{-1, true, 10}).error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(service->runArchival(ArchivePolicy{30, true, 0}).error().code, ErrorCode::VALIDATION_ERROR);
+
+    ArchiveService withoutArchive(std::make_shared<NullStudentArchiveDao>(), graduationAuditService, enrollmentDao,
+                                  courseResultDao, sessionContext);
+    EXPECT_EQ(withoutArchive.runArchival(ArchivePolicy{}).error().code, ErrorCode::OPERATION_FAILED);
+
+    sessionContext->clearCurrentUser();
+    EXPECT_EQ(service->runArchival(ArchivePolicy{}).error().code, ErrorCode::AUTHENTICATION_FAILED);
+}
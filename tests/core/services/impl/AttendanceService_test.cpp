@@ -0,0 +1,72 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/AttendanceService.h"
+#include "../../../../src/core/data_access/mock/MockAttendanceDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "../../../../src/core/entities/Student.h"
+#include <memory>
+
+class AttendanceServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockEnrollmentDao> enrollmentDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<AttendanceService> service;
+
+    void clearAll() {
+        MockAttendanceDao::clearMockData();
+        MockEnrollmentDao::clearMockData();
+        MockCourseDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        auto courseDao = std::make_shared<MockCourseDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        service = std::make_shared<AttendanceService>(std::make_shared<MockAttendanceDao>(), enrollmentDao, courseDao,
+                                                      std::make_shared<GeneralInputValidator>(), sessionContext);
+        ASSERT_TRUE(courseDao->add(Course("CS101", "Programming", 3, "IT")).has_value());
+        for (const std::string studentId : {"S001", "S002", "S003"}) {
+            ASSERT_TRUE(enrollmentDao->addEnrollment(studentId, "CS101").has_value());
+        }
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+};
+
+TEST_F(AttendanceServiceTest, MarksSessionsAndReportsRates) {
+    EXPECT_EQ(service->markAttendance("CS101", 1, {"S009"}).error().code, ErrorCode::VALIDATION_ERROR);
+    ASSERT_EQ(service->markAttendance("CS101", 1, {"S001", "S002"}).value(), 2u);
+    ASSERT_EQ(service->markAttendance("CS101", 2, {"S001"}).value(), 1u);
+    ASSERT_TRUE(service->setAttendance("CS101", 2, "S003", true).has_value());
+    ASSERT_EQ(service->markAttendance("CS101", 3, {"S001", "S003"}).value(), 2u);
+    ASSERT_TRUE(service->setAttendance("CS101", 3, "S001", false).has_value());
+
+    auto rates = service->getAttendanceRates("CS101");
+    ASSERT_TRUE(rates.has_value());
+    ASSERT_EQ(rates->size(), 3u);
+    EXPECT_EQ(rates->at(0).attended, 2); // S001: buổi 1, 2
+    EXPECT_EQ(rates->at(1).attended, 1); // S002: buổi 1
+    EXPECT_EQ(rates->at(2).attended, 2); // S003: buổi 2, 3
+    EXPECT_EQ(rates->at(0).sessions, 3);
+
+    auto below = service->getStudentsBelowThreshold("CS101", 0.5);
+    ASSERT_TRUE(below.has_value());
+    ASSERT_EQ(below->size(), 1u);
+    EXPECT_EQ(below->front().studentId, "S002");
+
+    // Sinh viên đăng ký sau vẫn được cấp slot mới, các slot cũ giữ nguyên
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S004", "CS101").has_value());
+    ASSERT_EQ(service->markAttendance("CS101", 4, {"S004"}).value(), 1u);
+    EXPECT_EQ(service->getAttendanceRates("CS101")->at(0).attended, 2);
+
+    sessionContext->setCurrentUser(std::make_shared<Student>("S002", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_EQ(service->getStudentAttendance("S002", "CS101")->attended, 1);
+    EXPECT_EQ(service->getStudentAttendance("S001", "CS101").error().code, ErrorCode::PERMISSION_DENIED);
+    EXPECT_EQ(service->markAttendance("CS101", 5, {}).error().code, ErrorCode::PERMISSION_DENIED);
+}
@@ -0,0 +1,17 @@
+#ifndef COUNTINGREPORTSERVICE_H
+#define COUNTINGREPORTSERVICE_H
+
+#include "../../../../src/core/services/interface/IFinanceReportService.h"
+
+// Đếm số lần báo cáo tài chính bị invalidate
+class CountingReportService : public IFinanceReportService {
+public:
+    int invalidations = 0;
+
+    std::expected<std::vector<FacultyFeeSummary>, Error> getFeeSummaryByFacultyAndCohort() override { return std::vector<FacultyFeeSummary>{}; }
+    std::expected<std::vector<FacultyFeeSummary>, Error> getFeeSummaryByFaculty() override { return std::vector<FacultyFeeSummary>{}; }
+    std::expected<std::vector<FacultyPayrollSummary>, Error> getPayrollByFaculty() override { return std::vector<FacultyPayrollSummary>{}; }
+    void invalidate() override { ++invalidations; }
+};
+
+#endif // COUNTINGREPORTSERVICE_H
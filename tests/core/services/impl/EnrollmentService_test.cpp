@@ -0,0 +1,203 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/EnrollmentService.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/data_access/mock/MockWaitlistDao.h"
+#include "../../../../src/core/data_access/mock/MockPrerequisiteDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/data_access/NullTransactionManager.h"
+#include "../../../../src/core/services/impl/WaitlistService.h"
+#include "../../../../src/core/services/impl/PrerequisiteService.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "../../../../src/core/entities/Student.h"
+#include <memory>
+
+class EnrollmentServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<MockCourseDao> courseDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<WaitlistService> waitlistService;
+    std::shared_ptr<MockCourseResultDao> courseResultDao;
+    std::shared_ptr<PrerequisiteService> prerequisiteService;
+    std::shared_ptr<EnrollmentService> service;
+
+    void clearAll() {
+        MockEnrollmentDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockCourseDao::clearMockData();
+        MockWaitlistDao::clearMockData();
+        MockPrerequisiteDao::clearMockData();
+        MockCourseResultDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        studentDao = std::make_shared<MockStudentDao>();
+        courseDao = std::make_shared<MockCourseDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        auto enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        auto validator = std::make_shared<GeneralInputValidator>();
+        courseResultDao = std::make_shared<MockCourseResultDao>();
+        prerequisiteService = std::make_shared<PrerequisiteService>(std::make_shared<MockPrerequisiteDao>(), courseDao, courseResultDao,
+                                                                    validator, sessionContext);
+        auto timetableIndex = std::make_shared<TimetableIndex>();
+        auto enrollmentPolicy = std::make_shared<EnrollmentPolicy>(enrollmentDao, studentDao, courseDao, timetableIndex, prerequisiteService);
+        waitlistService = std::make_shared<WaitlistService>(std::make_shared<MockWaitlistDao>(), enrollmentDao, studentDao, courseDao,
+                                                            validator, sessionContext, std::make_shared<NullTransactionManager>(),
+                                                            enrollmentPolicy);
+        service = std::make_shared<EnrollmentService>(enrollmentDao, studentDao, courseDao, validator, sessionContext, waitlistService,
+                                                      timetableIndex, enrollmentPolicy);
+        ASSERT_TRUE(courseDao->add(Course("CS101", "Programming", 3, "IT", 2)).has_value());
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    Student addStudent(const std::string& id, const std::string& suffix, LoginStatus status = LoginStatus::ACTIVE) {
+        Student student(id, "Van", "Nguyen", "IT", status);
+        student.setBirthday(1, 1, 2005);
+        student.setEmail("student" + suffix + "@example.com");
+        student.setCitizenId("0791000000" + suffix);
+        student.setPhoneNumber("09000000" + suffix);
+        EXPECT_TRUE(studentDao->add(student).has_value());
+        return student;
+    }
+};
+
+TEST_F(EnrollmentServiceTest, RejectsEnrollmentWhenCourseIsFull) {
+    addStudent("S001", "01");
+    addStudent("S002", "02");
+    addStudent("S003", "03");
+    ASSERT_TRUE(service->enrollStudentInCourse("S001", "CS101").has_value());
+    ASSERT_TRUE(service->enrollStudentInCourse("S002", "CS101").has_value());
+
+    auto full = service->enrollStudentInCourse("S003", "CS101");
+    ASSERT_FALSE(full.has_value());
+    EXPECT_EQ(full.error().code, ErrorCode::COURSE_CAPACITY_REACHED);
+
+    ASSERT_TRUE(service->dropCourseForStudent("S001", "CS101").has_value());
+    EXPECT_TRUE(service->enrollStudentInCourse("S003", "CS101").has_value());
+}
+
+TEST_F(EnrollmentServiceTest, StudentSelfEnrollUsesSessionAccount) {
+    // Sinh viên đang đăng nhập không cần có trong StudentDao: trạng thái lấy từ phiên
+    sessionContext->setCurrentUser(std::make_shared<Student>("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    ASSERT_TRUE(service->enrollStudentInCourse("S001", "CS101").has_value());
+
+    auto other = service->enrollStudentInCourse("S002", "CS101");
+    ASSERT_FALSE(other.has_value());
+    EXPECT_EQ(other.error().code, ErrorCode::PERMISSION_DENIED);
+}
+
+TEST_F(EnrollmentServiceTest, AdminCannotEnrollInactiveStudent) {
+    addStudent("S001", "01", LoginStatus::DISABLED);
+    auto result = service->enrollStudentInCourse("S001", "CS101");
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code, ErrorCode::VALIDATION_ERROR);
+
+    addStudent("S002", "02");
+    EXPECT_EQ(service->enrollStudentInCourse("S002", "NOPE101").error().code, ErrorCode::NOT_FOUND);
+}
+
+TEST_F(EnrollmentServiceTest, DropPromotesHeadOfWaitlist) {
+    addStudent("S001", "01");
+    addStudent("S002", "02");
+    addStudent("S003", "03");
+    addStudent("S004", "04");
+    ASSERT_TRUE(service->enrollStudentInCourse("S001", "CS101").has_value());
+    ASSERT_TRUE(service->enrollStudentInCourse("S002", "CS101").has_value());
+    ASSERT_EQ(waitlistService->joinWaitlist("S003", "CS101").value(), 1u);
+    ASSERT_EQ(waitlistService->joinWaitlist("S004", "CS101").value(), 2u);
+
+    ASSERT_TRUE(service->dropCourseForStudent("S001", "CS101").has_value());
+    EXPECT_TRUE(service->isStudentEnrolled("S003", "CS101").value());
+    EXPECT_EQ(waitlistService->getWaitlistPosition("S004", "CS101").value(), 1u);
+    EXPECT_EQ(waitlistService->getWaitlistPosition("S003", "CS101").error().code, ErrorCode::NOT_FOUND);
+
+    // Hủy hàng loạt: cả hai chỗ được lấp trong một lượt
+    ASSERT_EQ(service->dropCoursesForStudents({{"S002", "CS101"}, {"S003", "CS101"}}).value(), 2u);
+    EXPECT_TRUE(service->isStudentEnrolled("S004", "CS101").value());
+    EXPECT_TRUE(waitlistService->getWaitlist("CS101").value().empty());
+}
+
+TEST_F(EnrollmentServiceTest, RejectsScheduleClash) {
+    addStudent("S001", "01");
+    Course first("CS201", "Data Structures", 4, "IT");
+    ASSERT_TRUE(first.setMeetingSlots(MeetingSlot::parseSchedule("Mon 07:30-09:30 E301").value()));
+    Course clashing("CS202", "Databases", 4, "IT");
+    ASSERT_TRUE(clashing.setMeetingSlots(MeetingSlot::parseSchedule("Wed 13:00-15:00 F201; Mon 09:00-11:00 E302").value()));
+    Course afterwards("CS203", "Networks", 4, "IT");
+    ASSERT_TRUE(afterwards.setMeetingSlots(MeetingSlot::parseSchedule("Mon 09:30-11:30 E303").value()));
+    ASSERT_TRUE(courseDao->add(first).has_value());
+    ASSERT_TRUE(courseDao->add(clashing).has_value());
+    ASSERT_TRUE(courseDao->add(afterwards).has_value());
+
+    ASSERT_TRUE(service->enrollStudentInCourse("S001", "CS201").has_value());
+    ASSERT_TRUE(service->enrollStudentInCourse("S001", "CS101").has_value()); // Không có lịch
+    auto clash = service->enrollStudentInCourse("S001", "CS202");
+    ASSERT_FALSE(clash.has_value());
+    EXPECT_EQ(clash.error().code, ErrorCode::COURSE_SCHEDULE_CONFLICT);
+    EXPECT_NE(clash.error().message.find("CS201"), std::string::npos);
+    EXPECT_TRUE(service->enrollStudentInCourse("S001", "CS203").has_value());
+
+    // Sau khi hủy CS201 và CS203, thời khóa biểu được ghép lại và CS202 không còn trùng
+    ASSERT_TRUE(service->dropCourseForStudent("S001", "CS201").has_value());
+    ASSERT_TRUE(service->dropCourseForStudent("S001", "CS203").has_value());
+    EXPECT_TRUE(service->enrollStudentInCourse("S001", "CS202").has_value());
+}
+
+TEST_F(EnrollmentServiceTest, ClashReportFindsClashesAfterScheduleChange) {
+    addStudent("S001", "01");
+    addStudent("S002", "02");
+    Course morning("CS201", "Data Structures", 4, "IT");
+    ASSERT_TRUE(morning.setMeetingSlots(MeetingSlot::parseSchedule("Mon 07:30-09:30 E301").value()));
+    Course afternoon("CS202", "Databases", 4, "IT");
+    ASSERT_TRUE(afternoon.setMeetingSlots(MeetingSlot::parseSchedule("Mon 13:00-15:00 F201").value()));
+    ASSERT_TRUE(courseDao->add(morning).has_value());
+    ASSERT_TRUE(courseDao->add(afternoon).has_value());
+    for (const std::string studentId : {"S001", "S002"}) {
+        ASSERT_TRUE(service->enrollStudentInCourse(studentId, "CS201").has_value());
+    }
+    ASSERT_TRUE(service->enrollStudentInCourse("S001", "CS202").has_value());
+    EXPECT_TRUE(service->getTimetableClashReport().value().empty());
+
+    // Đổi lịch CS202 sang buổi sáng: chỉ S001 học cả hai khóa học
+    ASSERT_TRUE(afternoon.setMeetingSlots(MeetingSlot::parseSchedule("Mon 08:00-10:00 F201").value()));
+    ASSERT_TRUE(courseDao->update(afternoon).has_value());
+    auto report = service->getTimetableClashReport();
+    ASSERT_TRUE(report.has_value());
+    ASSERT_EQ(report->size(), 1u);
+    EXPECT_EQ(report->at(0).studentId, "S001");
+    EXPECT_EQ(report->at(0).courseId, "CS201");
+    EXPECT_EQ(report->at(0).otherCourseId, "CS202");
+    EXPECT_EQ(report->at(0).otherMeeting.toString(), "Mon 08:00-10:00 F201");
+
+    sessionContext->setCurrentUser(std::make_shared<Student>("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_EQ(service->getTimetableClashReport().error().code, ErrorCode::PERMISSION_DENIED);
+}
+
+TEST_F(EnrollmentServiceTest, RequiresPassingTransitivePrerequisites) {
+    addStudent("S001", "01");
+    ASSERT_TRUE(courseDao->add(Course("CS201", "Data Structures", 4, "IT")).has_value());
+    ASSERT_TRUE(courseDao->add(Course("CS301", "Algorithms", 4, "IT")).has_value());
+    ASSERT_TRUE(prerequisiteService->addPrerequisite("CS201", "CS101").has_value());
+    ASSERT_TRUE(prerequisiteService->addPrerequisite("CS301", "CS201").has_value());
+    EXPECT_EQ(prerequisiteService->addPrerequisite("CS101", "CS301").error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(prerequisiteService->addPrerequisite("CS301", "NOPE101").error().code, ErrorCode::NOT_FOUND);
+
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S001", "CS201", 90)).has_value());
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S001", "CS101", 39)).has_value()); // Chưa qua
+    auto blocked = service->enrollStudentInCourse("S001", "CS301");
+    ASSERT_FALSE(blocked.has_value());
+    EXPECT_EQ(blocked.error().code, ErrorCode::COURSE_PREREQUISITE_NOT_MET);
+    EXPECT_NE(blocked.error().message.find("CS101"), std::string::npos);
+
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S001", "CS101", 40)).has_value());
+    EXPECT_TRUE(service->enrollStudentInCourse("S001", "CS301").has_value());
+    EXPECT_EQ(prerequisiteService->getPrerequisites("CS301", true).value(), (std::vector<std::string>{"CS101", "CS201"}));
+}
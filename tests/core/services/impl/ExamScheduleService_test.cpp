@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/ExamScheduleService.h"
+#include "../../../../src/core/data_access/mock/MockExamScheduleDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockTermDao.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "../../../../src/core/entities/Student.h"
+#include <memory>
+
+class ExamScheduleServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockEnrollmentDao> enrollmentDao;
+    std::shared_ptr<MockTermDao> termDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<ExamScheduleService> service;
+
+    void SetUp() override {
+        MockEnrollmentDao::clearMockData();
+        MockExamScheduleDao::clearMockData();
+        MockTermDao::clearMockData();
+        enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        termDao = std::make_shared<MockTermDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        service = std::make_shared<ExamScheduleService>(std::make_shared<MockExamScheduleDao>(), enrollmentDao,
+                                                        std::make_shared<GeneralInputValidator>(), sessionContext, termDao);
+    }
+
+    void TearDown() override {
+        MockEnrollmentDao::clearMockData();
+        MockExamScheduleDao::clearMockData();
+        MockTermDao::clearMockData();
+    }
+};
+
+TEST_F(ExamScheduleServiceTest, GeneratesAndPersistsSchedule) {
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS102").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S002", "CS102").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S002", "CS103").has_value());
+
+    auto summary = service->generateExamSchedule(ExamSchedulingOptions{2, 1, 0});
+    ASSERT_TRUE(summary.has_value());
+    EXPECT_EQ(summary->slots.size(), 3u);
+    EXPECT_EQ(summary->studentCount, 2u);
+    EXPECT_EQ(summary->conflictCount, 2u);
+    EXPECT_EQ(summary->dayCount, 2);
+    EXPECT_EQ(service->getExamSchedule().value().size(), 3u);
+
+    sessionContext->setCurrentUser(std::make_shared<Student>("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    auto mine = service->getStudentExamSchedule("S001");
+    ASSERT_TRUE(mine.has_value());
+    ASSERT_EQ(mine->size(), 2u);
+    EXPECT_NE(mine->at(0).day, mine->at(1).day);
+    EXPECT_EQ(service->getStudentExamSchedule("S002").error().code, ErrorCode::PERMISSION_DENIED);
+    EXPECT_EQ(service->generateExamSchedule(ExamSchedulingOptions{}).error().code, ErrorCode::PERMISSION_DENIED);
+}
+
+TEST_F(ExamScheduleServiceTest, OnlyEnrollmentsOfTheTermConflict) {
+    ASSERT_TRUE(termDao->add(AcademicTerm{"2000-1", "Old term", "2000-01-01", "2000-06-30", false}).has_value());
+    ASSERT_TRUE(termDao->add(AcademicTerm{"2001-1", "Current term", "2001-01-01", "2099-12-31", false}).has_value());
+    // S001 học CS101 ở học kỳ trước, nên CS101 và CS102 không xung đột trong học kỳ hiện tại
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS102").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S002", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->setEnrollmentTerm("S001", "CS101", "2000-1").has_value());
+    ASSERT_TRUE(enrollmentDao->setEnrollmentTerm("S001", "CS102", "2001-1").has_value());
+
+    auto current = service->generateExamSchedule(ExamSchedulingOptions{1, 1, 0});
+    ASSERT_TRUE(current.has_value());
+    EXPECT_EQ(current->slots.size(), 2u);
+    EXPECT_EQ(current->conflictCount, 0u);
+    EXPECT_EQ(current->dayCount, 1);
+
+    // Học kỳ trước chỉ có CS101 (cùng đăng ký chưa gán học kỳ của S002)
+    auto old = service->generateExamSchedule(ExamSchedulingOptions{1, 1, 0, "2000-1"});
+    ASSERT_TRUE(old.has_value());
+    ASSERT_EQ(old->slots.size(), 1u);
+    EXPECT_EQ(old->slots.front().courseId, "CS101");
+    EXPECT_EQ(old->studentCount, 2u);
+    EXPECT_EQ(service->generateExamSchedule(ExamSchedulingOptions{1, 1, 0, "NOPE"}).error().code, ErrorCode::NOT_FOUND);
+}
@@ -0,0 +1,271 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/ExportService.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockTeacherDao.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/data_access/mock/MockFeeRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockSalaryRecordDao.h"
+#include "../../../../src/core/parsing/impl_csv_parser/StudentCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/TeacherCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/FacultyCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/CourseCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/EnrollmentRecordCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/CourseResultCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/FeeRecordCsvParser.h"
+#include "../../../../src/core/parsing/impl_csv_parser/SalaryRecordCsvParser.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "../../../../src/utils/CsvTokenizer.h"
+#include "../../../../src/utils/JsonLineParser.h"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Đọc file CSV đã xuất thành các dòng dữ liệu (bỏ dòng tiêu đề)
+     */
+    std::vector<CsvRow> readCsvRows(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        std::string data = buffer.str();
+
+        std::vector<CsvRow> rows;
+        CsvTokenizer tokenizer(data);
+        std::vector<std::string_view> fields;
+        bool header = true;
+        while (tokenizer.nextRecord(fields)) {
+            if (header) { header = false; continue; }
+            CsvRow row;
+            for (auto field : fields) row.push_back(CsvTokenizer::unescapeField(field));
+            rows.push_back(std::move(row));
+        }
+        return rows;
+    }
+
+    std::vector<std::string> readLines(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(in, line);) {
+            if (!line.empty()) lines.push_back(line);
+        }
+        return lines;
+    }
+
+    /**
+     * @brief Nạp lại file CSV đã xuất bằng parser CSV của bảng
+     */
+    template <typename TParser>
+    auto loadCsv(const std::string& path) {
+        TParser parser;
+        std::vector<typename decltype(parser.parse(CsvRow{}))::value_type> entities;
+        for (const auto& row : readCsvRows(path)) {
+            auto entity = parser.parse(row);
+            EXPECT_TRUE(entity.has_value()) << path << ": " << entity.error().message;
+            if (entity.has_value()) entities.push_back(std::move(entity.value()));
+        }
+        return entities;
+    }
+}
+
+class ExportServiceTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<MockTeacherDao> teacherDao;
+    std::shared_ptr<MockFacultyDao> facultyDao;
+    std::shared_ptr<MockCourseDao> courseDao;
+    std::shared_ptr<MockEnrollmentDao> enrollmentDao;
+    std::shared_ptr<MockCourseResultDao> courseResultDao;
+    std::shared_ptr<MockFeeRecordDao> feeDao;
+    std::shared_ptr<MockSalaryRecordDao> salaryDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<ExportService> service;
+
+    void clearAll() {
+        MockStudentDao::clearMockData();
+        MockTeacherDao::clearMockData();
+        MockFacultyDao::clearMockData();
+        MockCourseDao::clearMockData();
+        MockEnrollmentDao::clearMockData();
+        MockCourseResultDao::clearMockData();
+        MockFeeRecordDao::clearMockData();
+        MockSalaryRecordDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        dir = std::filesystem::temp_directory_path() / ("export_service_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+
+        studentDao = std::make_shared<MockStudentDao>();
+        teacherDao = std::make_shared<MockTeacherDao>();
+        facultyDao = std::make_shared<MockFacultyDao>();
+        courseDao = std::make_shared<MockCourseDao>();
+        enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        courseResultDao = std::make_shared<MockCourseResultDao>();
+        feeDao = std::make_shared<MockFeeRecordDao>();
+        salaryDao = std::make_shared<MockSalaryRecordDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        service = std::make_shared<ExportService>(studentDao, teacherDao, facultyDao, courseDao, enrollmentDao,
+                                                  courseResultDao, feeDao, salaryDao, sessionContext);
+    }
+
+    void TearDown() override {
+        clearAll();
+        std::filesystem::remove_all(dir);
+    }
+
+    std::string pathOf(const std::string& name) const {
+        return (dir / name).string();
+    }
+
+    // Một bản ghi cho mỗi bảng; địa chỉ và lịch học có dấu phẩy/chấm phẩy để kiểm tra việc thoát ký tự
+    void addOneRowPerTable() {
+        Student student("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE);
+        ASSERT_TRUE(student.setBirthday(2, 3, 2004));
+        ASSERT_TRUE(student.setAddress("12 Le Loi, District 1"));
+        ASSERT_TRUE(student.setEmail("s001@example.com"));
+        ASSERT_TRUE(student.setCitizenId("079100000001"));
+        ASSERT_TRUE(student.setPhoneNumber("0900000001"));
+        ASSERT_TRUE(studentDao->add(student).has_value());
+
+        Teacher teacher("T001", "Thi", "Tran", "IT", LoginStatus::ACTIVE);
+        ASSERT_TRUE(teacher.setEmail("t001@example.com"));
+        ASSERT_TRUE(teacher.setCitizenId("079100000002"));
+        ASSERT_TRUE(teacher.setQualification("PhD"));
+        ASSERT_TRUE(teacher.setExperienceYears(7));
+        ASSERT_TRUE(teacherDao->add(teacher).has_value());
+
+        ASSERT_TRUE(facultyDao->add(Faculty("IT", "Information Technology")).has_value());
+        Course course("C1", "Programming", 3, "IT", 40);
+        ASSERT_TRUE(course.setMeetingSlots(MeetingSlot::parseSchedule("Mon 07:30-09:30 E301; Wed 13:00-15:00 F201").value()));
+        ASSERT_TRUE(courseDao->add(course).has_value());
+        ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "C1").has_value());
+        ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S001", "C1", 72)).has_value());
+        ASSERT_TRUE(feeDao->add(FeeRecord("S001", 1500000, 500000)).has_value());
+        ASSERT_TRUE(salaryDao->add(SalaryRecord("T001", 12000000)).has_value());
+    }
+};
+
+TEST_F(ExportServiceTest, EnrollmentsAndResultsRoundTripWithTheirTerm) {
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S1", "C1").has_value());
+    ASSERT_TRUE(enrollmentDao->setEnrollmentTerm("S1", "C1", "2024-1").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S2", "C1").has_value()); // Chưa gán học kỳ
+    CourseResult graded("S1", "C1", 85);
+    graded.setTermId("2024-1");
+    ASSERT_TRUE(courseResultDao->addOrUpdate(graded).has_value());
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S2", "C1", -1)).has_value());
+
+    auto enrollments = service->exportTable(EntityType::ENROLLMENT, pathOf("enrollments.csv"), ExportFormat::CSV);
+    ASSERT_TRUE(enrollments.has_value()) << enrollments.error().message;
+    EXPECT_EQ(enrollments->rowCount, 2u);
+    EnrollmentRecordCsvParser enrollmentParser;
+    std::vector<EnrollmentRecord> loadedEnrollments;
+    for (const auto& row : readCsvRows(pathOf("enrollments.csv"))) {
+        auto record = enrollmentParser.parse(row);
+        ASSERT_TRUE(record.has_value()) << record.error().message;
+        loadedEnrollments.push_back(record.value());
+    }
+    ASSERT_EQ(loadedEnrollments.size(), 2u);
+    for (const auto& record : loadedEnrollments) {
+        EXPECT_EQ(record.termId, record.studentId == "S1" ? "2024-1" : "");
+    }
+
+    auto results = service->exportTable(EntityType::COURSERESULT, pathOf("course_results.csv"), ExportFormat::CSV);
+    ASSERT_TRUE(results.has_value()) << results.error().message;
+    EXPECT_EQ(results->rowCount, 2u);
+    CourseResultCsvParser resultParser;
+    std::size_t loadedResults = 0;
+    for (const auto& row : readCsvRows(pathOf("course_results.csv"))) {
+        auto result = resultParser.parse(row);
+        ASSERT_TRUE(result.has_value()) << result.error().message;
+        EXPECT_EQ(result->getTermId(), result->getStudentId() == "S1" ? "2024-1" : "");
+        EXPECT_EQ(result->getMarks(), result->getStudentId() == "S1" ? 85 : -1);
+        ++loadedResults;
+    }
+    EXPECT_EQ(loadedResults, 2u);
+}
+
+TEST_F(ExportServiceTest, EveryTableExportsAsCsvThatItsParserReadsBack) {
+    addOneRowPerTable();
+    auto reports = service->exportTables(service->getExportableTables(), dir.string(), ExportFormat::CSV, false);
+    ASSERT_TRUE(reports.has_value()) << reports.error().message;
+    for (const auto& report : reports.value()) {
+        EXPECT_FALSE(report.error.has_value()) << report.filePath << ": " << report.error->message;
+        EXPECT_EQ(report.rowCount, 1u) << report.filePath;
+    }
+
+    auto students = loadCsv<StudentCsvParser>(pathOf("students.csv"));
+    ASSERT_EQ(students.size(), 1u);
+    EXPECT_EQ(students[0].getAddress(), "12 Le Loi, District 1");
+    EXPECT_EQ(students[0].getBirthday().getYear(), 2004);
+    EXPECT_EQ(students[0].getFacultyId(), "IT");
+
+    auto teachers = loadCsv<TeacherCsvParser>(pathOf("teachers.csv"));
+    ASSERT_EQ(teachers.size(), 1u);
+    EXPECT_EQ(teachers[0].getQualification(), "PhD");
+    EXPECT_EQ(teachers[0].getExperienceYears(), 7);
+
+    auto faculties = loadCsv<FacultyCsvParser>(pathOf("faculties.csv"));
+    ASSERT_EQ(faculties.size(), 1u);
+    EXPECT_EQ(faculties[0].getName(), "Information Technology");
+
+    auto courses = loadCsv<CourseCsvParser>(pathOf("courses.csv"));
+    ASSERT_EQ(courses.size(), 1u);
+    EXPECT_EQ(courses[0].getCapacity(), 40);
+    EXPECT_EQ(courses[0].getMeetingSlots().size(), 2u);
+
+    auto enrollments = loadCsv<EnrollmentRecordCsvParser>(pathOf("enrollments.csv"));
+    ASSERT_EQ(enrollments.size(), 1u);
+    EXPECT_EQ(enrollments[0].courseId, "C1");
+
+    auto results = loadCsv<CourseResultCsvParser>(pathOf("course_results.csv"));
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].getMarks(), 72);
+
+    auto fees = loadCsv<FeeRecordCsvParser>(pathOf("fee_records.csv"));
+    ASSERT_EQ(fees.size(), 1u);
+    EXPECT_EQ(fees[0].getTotalFee(), 1500000);
+    EXPECT_EQ(fees[0].getPaidFee(), 500000);
+
+    auto salaries = loadCsv<SalaryRecordCsvParser>(pathOf("salary_records.csv"));
+    ASSERT_EQ(salaries.size(), 1u);
+    EXPECT_EQ(salaries[0].getBasicMonthlyPay(), 12000000);
+}
+
+TEST_F(ExportServiceTest, EveryTableExportsAsJsonLinesWithTheCsvColumns) {
+    addOneRowPerTable();
+    auto reports = service->exportTables(service->getExportableTables(), dir.string(), ExportFormat::JSON_LINES, true);
+    ASSERT_TRUE(reports.has_value()) << reports.error().message;
+    ASSERT_EQ(reports->size(), service->getExportableTables().size());
+
+    const std::vector<std::pair<std::string, const std::vector<std::string>*>> expected = {
+        {"students.jsonl", &StudentCsvParser::columns()},          {"teachers.jsonl", &TeacherCsvParser::columns()},
+        {"faculties.jsonl", &FacultyCsvParser::columns()},         {"courses.jsonl", &CourseCsvParser::columns()},
+        {"enrollments.jsonl", &EnrollmentRecordCsvParser::columns()}, {"course_results.jsonl", &CourseResultCsvParser::columns()},
+        {"fee_records.jsonl", &FeeRecordCsvParser::columns()},     {"salary_records.jsonl", &SalaryRecordCsvParser::columns()}};
+    for (const auto& [fileName, columns] : expected) {
+        auto lines = readLines(pathOf(fileName));
+        ASSERT_EQ(lines.size(), 1u) << fileName;
+        auto object = JsonLineParser::parseObject(lines[0]);
+        ASSERT_TRUE(object.has_value()) << fileName << ": " << object.error().message;
+        ASSERT_EQ(object->size(), columns->size()) << fileName;
+        for (std::size_t i = 0; i < columns->size(); ++i) EXPECT_EQ(object->at(i).first, columns->at(i)) << fileName;
+    }
+}
+
+TEST_F(ExportServiceTest, OnlyAdminsCanExport) {
+    sessionContext->setCurrentUser(std::make_shared<Student>("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_EQ(service->exportTable(EntityType::STUDENT, pathOf("students.csv"), ExportFormat::CSV).error().code, ErrorCode::PERMISSION_DENIED);
+    EXPECT_EQ(service->exportTables({EntityType::STUDENT}, dir.string(), ExportFormat::CSV, false).error().code, ErrorCode::PERMISSION_DENIED);
+    EXPECT_FALSE(std::filesystem::exists(pathOf("students.csv")));
+}
@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/FinanceReportService.h"
+#include "../../../../src/core/data_access/StreamingFinanceReportDao.h"
+#include "../../../../src/core/data_access/mock/MockFeeRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockSalaryRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockTeacherDao.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include <memory>
+
+class FinanceReportServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockFeeRecordDao> feeDao;
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<FinanceReportService> service;
+
+    void clearAll() {
+        MockFeeRecordDao::clearMockData();
+        MockSalaryRecordDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockTeacherDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        feeDao = std::make_shared<MockFeeRecordDao>();
+        studentDao = std::make_shared<MockStudentDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        auto reportDao = std::make_shared<StreamingFinanceReportDao>(feeDao, std::make_shared<MockSalaryRecordDao>(),
+                                                                     studentDao, std::make_shared<MockTeacherDao>());
+        service = std::make_shared<FinanceReportService>(reportDao, sessionContext);
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    void addStudentWithFee(const std::string& id, const std::string& facultyId, const std::string& suffix, long total, long paid) {
+        Student student(id, "Van", "Nguyen", facultyId, LoginStatus::ACTIVE);
+        student.setBirthday(1, 1, 2005);
+        student.setEmail("student" + suffix + "@example.com");
+        student.setCitizenId("0791000000" + suffix);
+        student.setPhoneNumber("09000000" + suffix);
+        ASSERT_TRUE(studentDao->add(student).has_value());
+        ASSERT_TRUE(feeDao->add(FeeRecord(id, total, paid)).has_value());
+    }
+};
+
+TEST_F(FinanceReportServiceTest, GroupsFeesByFacultyAndCohort) {
+    addStudentWithFee("24IT0001", "IT", "01", 1000, 400);
+    addStudentWithFee("25IT0001", "IT", "02", 1000, 1000);
+    addStudentWithFee("25IT0002", "IT", "03", 2000, 0);
+    addStudentWithFee("25CS0001", "CS", "04", 500, 100);
+
+    auto byCohort = service->getFeeSummaryByFacultyAndCohort();
+    ASSERT_TRUE(byCohort.has_value());
+    ASSERT_EQ(byCohort->size(), 3u);
+    EXPECT_EQ(byCohort->at(0).facultyId, "CS");
+    EXPECT_EQ(byCohort->at(2).cohort, "25");
+    EXPECT_EQ(byCohort->at(2).studentCount, 2u);
+    EXPECT_EQ(byCohort->at(2).outstanding(), 2000);
+
+    auto byFaculty = service->getFeeSummaryByFaculty();
+    ASSERT_TRUE(byFaculty.has_value());
+    ASSERT_EQ(byFaculty->size(), 2u);
+    EXPECT_EQ(byFaculty->at(1).facultyId, "IT");
+    EXPECT_EQ(byFaculty->at(1).totalBilled, 4000);
+    EXPECT_EQ(byFaculty->at(1).totalPaid, 1400);
+}
+
+TEST_F(FinanceReportServiceTest, CachedUntilInvalidated) {
+    addStudentWithFee("25IT0001", "IT", "01", 1000, 0);
+    ASSERT_EQ(service->getFeeSummaryByFaculty()->front().totalPaid, 0);
+
+    ASSERT_TRUE(feeDao->recordPayment(FeePayment{"key-1", "25IT0001", 300, 1700000000}).has_value());
+    EXPECT_EQ(service->getFeeSummaryByFaculty()->front().totalPaid, 0);
+
+    service->invalidate();
+    EXPECT_EQ(service->getFeeSummaryByFaculty()->front().totalPaid, 300);
+}
+
+TEST_F(FinanceReportServiceTest, RequiresAdmin) {
+    sessionContext->clearCurrentUser();
+    auto report = service->getPayrollByFaculty();
+    ASSERT_FALSE(report.has_value());
+    EXPECT_EQ(report.error().code, ErrorCode::PERMISSION_DENIED);
+}
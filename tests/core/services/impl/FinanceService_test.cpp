@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/FinanceService.h"
+#include "../../../../src/core/data_access/sql/SqlFeeRecordDao.h"
+#include "../../../../src/core/data_access/sql/SqlInstallmentDao.h"
+#include "../../../../src/core/data_access/sql/SqlTransactionManager.h"
+#include "../../../../src/core/data_access/mock/MockSalaryRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockTeacherDao.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/database_adapter/sql/SQLiteAdapter.h"
+#include "../../../../src/core/parsing/impl_sql_parser/FeeRecordSqlParser.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "CountingReportService.h"
+#include <memory>
+
+namespace {
+    // Lịch trả góp không phân bổ được tiền đã đóng, để kiểm tra khoản thanh toán bị rollback
+    class FailingAllocationDao : public SqlInstallmentDao {
+    public:
+        using SqlInstallmentDao::SqlInstallmentDao;
+        std::expected<bool, Error> allocatePaid(const std::string&, long) override {
+            return std::unexpected(Error{ErrorCode::OPERATION_FAILED, "allocation failed"});
+        }
+    };
+}
+
+class FinanceServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<SQLiteAdapter> dbAdapter;
+    std::shared_ptr<SqlFeeRecordDao> feeDao;
+    std::shared_ptr<SqlInstallmentDao> installmentDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<CountingReportService> reportService;
+
+    void SetUp() override {
+        dbAdapter = std::make_shared<SQLiteAdapter>();
+        ASSERT_TRUE(dbAdapter->connect(":memory:").has_value());
+        ASSERT_TRUE(dbAdapter->ensureTablesExist().has_value());
+        ASSERT_TRUE(dbAdapter->executeUpdate("INSERT INTO Users (id, firstName, lastName, role, status) VALUES ('S001', 'Van', 'Nguyen', 1, 1);").has_value());
+        feeDao = std::make_shared<SqlFeeRecordDao>(dbAdapter, std::make_shared<FeeRecordSqlParser>());
+        installmentDao = std::make_shared<SqlInstallmentDao>(dbAdapter);
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        reportService = std::make_shared<CountingReportService>();
+
+        ASSERT_TRUE(feeDao->add(FeeRecord("S001", 1000, 0)).has_value());
+        ASSERT_TRUE(installmentDao->replaceSchedule("S001", {FeeInstallment{"S001", 1, "2025-01-15", 400, 0, false},
+                                                             FeeInstallment{"S001", 2, "2025-02-15", 600, 0, true}}).has_value());
+    }
+
+    std::shared_ptr<FinanceService> makeService(std::shared_ptr<IInstallmentDao> installments) {
+        return std::make_shared<FinanceService>(feeDao, std::make_shared<MockSalaryRecordDao>(), std::make_shared<MockStudentDao>(),
+                                                std::make_shared<MockTeacherDao>(), std::make_shared<MockFacultyDao>(),
+                                                std::make_shared<GeneralInputValidator>(), sessionContext, reportService,
+                                                std::move(installments), std::make_shared<SqlTransactionManager>(dbAdapter));
+    }
+};
+
+TEST_F(FinanceServiceTest, PaymentIsAllocatedToInstallments) {
+    auto service = makeService(installmentDao);
+    ASSERT_TRUE(service->makeFeePayment("S001", 500, "pay-1").has_value());
+
+    auto schedule = installmentDao->getByStudent("S001");
+    ASSERT_TRUE(schedule.has_value());
+    EXPECT_EQ(schedule->at(0).paidAmount, 400);
+    EXPECT_EQ(schedule->at(1).paidAmount, 100);
+    EXPECT_EQ(reportService->invalidations, 1);
+}
+
+TEST_F(FinanceServiceTest, FailedAllocationRollsBackThePayment) {
+    auto service = makeService(std::make_shared<FailingAllocationDao>(dbAdapter));
+    auto paid = service->makeFeePayment("S001", 500, "pay-1");
+    ASSERT_FALSE(paid.has_value());
+    EXPECT_EQ(paid.error().code, ErrorCode::OPERATION_FAILED);
+
+    EXPECT_EQ(feeDao->getById("S001")->getPaidFee(), 0);
+    EXPECT_TRUE(feeDao->getPayments("S001")->empty());
+    EXPECT_EQ(reportService->invalidations, 0);
+}
+
+TEST_F(FinanceServiceTest, TotalFeeChangeRescalesTheInstallmentPlan) {
+    auto service = makeService(installmentDao);
+    ASSERT_TRUE(service->makeFeePayment("S001", 300, "pay-1").has_value());
+    ASSERT_TRUE(service->setStudentTotalFee("S001", 1500).has_value());
+
+    auto schedule = installmentDao->getByStudent("S001");
+    ASSERT_TRUE(schedule.has_value());
+    ASSERT_EQ(schedule->size(), 2u);
+    EXPECT_EQ(schedule->at(0).amount, 600);
+    EXPECT_EQ(schedule->at(1).amount, 900);
+    EXPECT_EQ(schedule->at(0).paidAmount, 300);
+    EXPECT_EQ(schedule->at(1).dueDate, "2025-02-15");
+    EXPECT_TRUE(schedule->at(1).late);
+}
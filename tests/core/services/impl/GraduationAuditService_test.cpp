@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/GraduationAuditService.h"
+#include "../../../../src/core/data_access/mock/MockDegreeRequirementDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "../../../../src/core/entities/Student.h"
+#include <memory>
+
+class GraduationAuditServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<MockCourseDao> courseDao;
+    std::shared_ptr<MockCourseResultDao> courseResultDao;
+    std::shared_ptr<MockFacultyDao> facultyDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<GraduationAuditService> service;
+
+    void clearAll() {
+        MockDegreeRequirementDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockCourseDao::clearMockData();
+        MockCourseResultDao::clearMockData();
+        MockFacultyDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        studentDao = std::make_shared<MockStudentDao>();
+        courseDao = std::make_shared<MockCourseDao>();
+        courseResultDao = std::make_shared<MockCourseResultDao>();
+        facultyDao = std::make_shared<MockFacultyDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        service = std::make_shared<GraduationAuditService>(std::make_shared<MockDegreeRequirementDao>(), studentDao, courseDao,
+                                                           courseResultDao, facultyDao, std::make_shared<GeneralInputValidator>(),
+                                                           sessionContext);
+        ASSERT_TRUE(facultyDao->add(Faculty("IT", "Information Technology")).has_value());
+        ASSERT_TRUE(courseDao->add(Course("CS101", "Programming", 3, "IT")).has_value());
+        ASSERT_TRUE(courseDao->add(Course("CS201", "Data Structures", 3, "IT")).has_value());
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    void addStudent(const std::string& id, const std::string& suffix) {
+        Student student(id, "Van", "Nguyen", "IT", LoginStatus::ACTIVE);
+        student.setBirthday(1, 1, 2005);
+        student.setEmail("student" + suffix + "@example.com");
+        student.setCitizenId("0791000000" + suffix);
+        student.setPhoneNumber("09000000" + suffix);
+        ASSERT_TRUE(studentDao->add(student).has_value());
+    }
+};
+
+TEST_F(GraduationAuditServiceTest, AuditsAllStudentsAgainstFacultyRule) {
+    EXPECT_EQ(service->setDegreeRequirement(DegreeRequirement{"IT", 6, 2.0, {"NOPE"}}).error().code, ErrorCode::NOT_FOUND);
+    ASSERT_TRUE(service->setDegreeRequirement(DegreeRequirement{"IT", 6, 2.0, {"CS201", "CS101"}}).has_value());
+
+    addStudent("S001", "01");
+    addStudent("S002", "02");
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S001", "CS101", 80)).has_value());
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S001", "CS201", 60)).has_value());
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S002", "CS101", 90)).has_value());
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S002", "CS201", 30)).has_value());
+
+    auto report = service->runGraduationAudit();
+    ASSERT_TRUE(report.has_value());
+    ASSERT_EQ(report->entries.size(), 2u);
+    EXPECT_EQ(report->eligibleCount, 1u);
+    for (const auto& entry : report->entries) {
+        auto single = service->auditStudent(entry.studentId);
+        ASSERT_TRUE(single.has_value());
+        EXPECT_EQ(single->eligible, entry.eligible);
+        EXPECT_EQ(single->earnedCredits, entry.earnedCredits);
+        EXPECT_EQ(single->missingCourseIds, entry.missingCourseIds);
+        if (entry.studentId == "S002") {
+            EXPECT_EQ(entry.missingCourseIds, (std::vector<std::string>{"CS201"}));
+        }
+    }
+
+    sessionContext->setCurrentUser(std::make_shared<Student>("S002", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_TRUE(service->auditStudent("S002").has_value());
+    EXPECT_EQ(service->auditStudent("S001").error().code, ErrorCode::PERMISSION_DENIED);
+    EXPECT_EQ(service->runGraduationAudit().error().code, ErrorCode::PERMISSION_DENIED);
+}
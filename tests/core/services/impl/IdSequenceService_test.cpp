@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/IdSequenceService.h"
+#include "../../../../src/core/data_access/mock/MockSequenceDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockTeacherDao.h"
+#include <memory>
+
+class IdSequenceServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockSequenceDao> sequenceDao;
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<IdSequenceService> service;
+
+    void SetUp() override {
+        MockSequenceDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockTeacherDao::clearMockData();
+        sequenceDao = std::make_shared<MockSequenceDao>();
+        studentDao = std::make_shared<MockStudentDao>();
+        service = std::make_shared<IdSequenceService>(sequenceDao, studentDao, std::make_shared<MockTeacherDao>());
+    }
+
+    void TearDown() override {
+        MockSequenceDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockTeacherDao::clearMockData();
+    }
+
+    void addStudent(const std::string& id, const std::string& facultyId, const std::string& suffix) {
+        Student student(id, "Van", "Nguyen", facultyId, LoginStatus::ACTIVE);
+        student.setBirthday(1, 1, 2005);
+        student.setEmail("student" + suffix + "@example.com");
+        student.setCitizenId("0791000000" + suffix);
+        student.setPhoneNumber("09000000" + suffix);
+        ASSERT_TRUE(studentDao->add(student).has_value());
+    }
+};
+
+TEST_F(IdSequenceServiceTest, NewPrefixStartsAtOne) {
+    auto first = service->nextStudentId("25IT");
+    ASSERT_TRUE(first.has_value()) << first.error().message;
+    EXPECT_EQ(first.value(), "25IT0001");
+    EXPECT_EQ(service->nextStudentId("25IT").value(), "25IT0002");
+    EXPECT_EQ(service->nextStudentId("25CS").value(), "25CS0001");
+}
+
+TEST_F(IdSequenceServiceTest, EmptyTableIsRebuiltFromExistingIds) {
+    addStudent("25IT0007", "IT", "11");
+    addStudent("25IT0003", "IT", "12");
+    addStudent("24IT0050", "IT", "13");
+
+    auto rebuilt = service->ensureInitialized();
+    ASSERT_TRUE(rebuilt.has_value()) << rebuilt.error().message;
+    EXPECT_EQ(rebuilt.value(), 2u);
+    EXPECT_EQ(service->nextStudentId("25IT").value(), "25IT0008");
+    EXPECT_EQ(service->nextStudentId("24IT").value(), "24IT0051");
+
+    // Bảng đã có dữ liệu: lần gọi sau không duyệt lại
+    EXPECT_EQ(service->ensureInitialized().value(), 0u);
+}
+
+TEST_F(IdSequenceServiceTest, MissingPrefixIsSeededFromExistingIdsWhenTableIsNotEmpty) {
+    ASSERT_TRUE(service->nextStudentId("25IT").has_value()); // Bảng bộ đếm không còn rỗng
+
+    // Mã giảng viên do admin tự đặt dùng chung không gian ID với sinh viên
+    Teacher teacher("26IT0005", "Thi", "Tran", "IT");
+    teacher.setEmail("teacher26@example.com");
+    ASSERT_TRUE(MockTeacherDao().add(teacher).has_value());
+    addStudent("26IT0002", "IT", "21");
+
+    EXPECT_EQ(service->nextStudentId("26IT").value(), "26IT0006");
+    EXPECT_EQ(service->nextStudentId("26CS").value(), "26CS0001");
+}
+
+TEST_F(IdSequenceServiceTest, ReserveReturnsContiguousBlock) {
+    ASSERT_TRUE(service->nextStudentId("25IT").has_value());
+    auto block = service->reserveStudentIds("25IT", 3);
+    ASSERT_TRUE(block.has_value()) << block.error().message;
+    EXPECT_EQ(block->size(), 3u);
+    EXPECT_EQ(block->idAt(0), "25IT0002");
+    EXPECT_EQ(block->idAt(2), "25IT0004");
+    EXPECT_EQ(service->nextStudentId("25IT").value(), "25IT0005");
+}
+
+TEST_F(IdSequenceServiceTest, ReserveIsCappedAtLastSequence) {
+    ASSERT_TRUE(sequenceDao->raiseTo("25IT", 9997).has_value());
+    auto block = service->reserveStudentIds("25IT", 5);
+    ASSERT_TRUE(block.has_value()) << block.error().message;
+    EXPECT_EQ(block->size(), 2u);
+    EXPECT_EQ(block->idAt(0), "25IT9998");
+    EXPECT_EQ(block->idAt(1), "25IT9999");
+
+    auto exhausted = service->nextStudentId("25IT");
+    ASSERT_FALSE(exhausted.has_value());
+    EXPECT_EQ(exhausted.error().code, ErrorCode::OPERATION_FAILED);
+    EXPECT_EQ(sequenceDao->getValue("25IT").value(), 9999);
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/InstallmentService.h"
+#include "../../../../src/core/data_access/mock/MockInstallmentDao.h"
+#include "../../../../src/core/data_access/mock/MockFeeRecordDao.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "CountingReportService.h"
+#include <memory>
+
+class InstallmentServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockFeeRecordDao> feeDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<CountingReportService> reportService;
+    std::shared_ptr<InstallmentService> service;
+
+    void clearAll() {
+        MockInstallmentDao::clearMockData();
+        MockFeeRecordDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        feeDao = std::make_shared<MockFeeRecordDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        reportService = std::make_shared<CountingReportService>();
+        service = std::make_shared<InstallmentService>(std::make_shared<MockInstallmentDao>(), feeDao, sessionContext, reportService);
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+};
+
+TEST_F(InstallmentServiceTest, EqualPlanClampsMonthEndAndAllocatesPaidFee) {
+    ASSERT_TRUE(feeDao->add(FeeRecord("S001", 1000, 400)).has_value());
+
+    ASSERT_TRUE(service->createEqualInstallmentPlan("S001", 3, "2025-01-31", 1).has_value());
+    auto schedule = service->getInstallments("S001");
+    ASSERT_TRUE(schedule.has_value());
+    ASSERT_EQ(schedule->size(), 3u);
+    EXPECT_EQ(schedule->at(1).dueDate, "2025-02-28");
+    EXPECT_EQ(schedule->at(2).dueDate, "2025-03-31");
+    EXPECT_EQ(schedule->at(0).paidAmount, 333);
+    EXPECT_EQ(schedule->at(1).paidAmount, 67);
+    EXPECT_EQ(schedule->at(2).amount, 334);
+}
+
+TEST_F(InstallmentServiceTest, RejectsPlanThatDoesNotMatchTotalFee) {
+    ASSERT_TRUE(feeDao->add(FeeRecord("S001", 1000, 0)).has_value());
+
+    auto mismatch = service->setInstallmentPlan("S001", {{"2025-01-15", 500}, {"2025-02-15", 400}});
+    ASSERT_FALSE(mismatch.has_value());
+    EXPECT_EQ(mismatch.error().code, ErrorCode::VALIDATION_ERROR);
+
+    auto badDate = service->setInstallmentPlan("S001", {{"2025-02-30", 500}, {"2025-03-15", 500}});
+    ASSERT_FALSE(badDate.has_value());
+    EXPECT_EQ(badDate.error().code, ErrorCode::VALIDATION_ERROR);
+}
+
+TEST_F(InstallmentServiceTest, OverdueJobReportsNewlyLateAndTotals) {
+    ASSERT_TRUE(feeDao->add(FeeRecord("S001", 600, 250)).has_value());
+    ASSERT_TRUE(feeDao->add(FeeRecord("S002", 300, 0)).has_value());
+    ASSERT_TRUE(service->setInstallmentPlan("S001", {{"2025-03-01", 200}, {"2025-01-01", 200}, {"2025-02-01", 200}}).has_value());
+    ASSERT_TRUE(service->setInstallmentPlan("S002", {{"2025-04-01", 300}}).has_value());
+
+    auto report = service->runOverdueJob("2025-02-15");
+    ASSERT_TRUE(report.has_value());
+    EXPECT_EQ(report->newlyLate, 1u);
+    ASSERT_EQ(report->balances.size(), 1u);
+    EXPECT_EQ(report->balances[0].overdueAmount, 150);
+    EXPECT_EQ(report->totalOverdue, 150);
+    // Hai lần đặt lịch và một lần đánh dấu trễ hạn
+    EXPECT_EQ(reportService->invalidations, 3);
+    ASSERT_TRUE(service->runOverdueJob("2025-02-15").has_value());
+    EXPECT_EQ(reportService->invalidations, 3);
+
+    sessionContext->clearCurrentUser();
+    auto denied = service->runOverdueJob("2025-02-15");
+    ASSERT_FALSE(denied.has_value());
+    EXPECT_EQ(denied.error().code, ErrorCode::PERMISSION_DENIED);
+}
@@ -0,0 +1,109 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/PayrollService.h"
+#include "../../../../src/core/data_access/mock/MockPayrollDao.h"
+#include "../../../../src/core/data_access/mock/MockSalaryRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockTeacherDao.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "CountingReportService.h"
+#include <memory>
+
+class PayrollServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockTeacherDao> teacherDao;
+    std::shared_ptr<MockSalaryRecordDao> salaryDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<CountingReportService> reportService;
+    std::shared_ptr<PayrollService> service;
+
+    void clearAll() {
+        MockPayrollDao::clearMockData();
+        MockSalaryRecordDao::clearMockData();
+        MockTeacherDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        teacherDao = std::make_shared<MockTeacherDao>();
+        salaryDao = std::make_shared<MockSalaryRecordDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        reportService = std::make_shared<CountingReportService>();
+        service = std::make_shared<PayrollService>(std::make_shared<MockPayrollDao>(), teacherDao, salaryDao, sessionContext, reportService);
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    void addTeacher(const std::string& id, const std::string& designation, int experienceYears, long basicPay) {
+        Teacher teacher(id, "Van", "Tran", "IT");
+        teacher.setEmail(id + "@example.com");
+        teacher.setDesignation(designation);
+        teacher.setExperienceYears(experienceYears);
+        ASSERT_TRUE(teacherDao->add(teacher).has_value());
+        if (basicPay > 0) {
+            ASSERT_TRUE(salaryDao->add(SalaryRecord(id, basicPay)).has_value());
+        }
+    }
+};
+
+TEST_F(PayrollServiceTest, AllowanceFollowsDesignationAndExperience) {
+    Teacher teacher("T001", "Van", "Tran", "IT");
+    teacher.setDesignation("Associate Professor, Head of Department");
+    teacher.setExperienceYears(30);
+    // 15% chức danh + 10% trưởng bộ môn + 20% thâm niên (đã chặn)
+    EXPECT_EQ(PayrollService::computeAllowance(teacher, 10000000), 4500000);
+
+    teacher.setDesignation("Lecturer");
+    teacher.setExperienceYears(3);
+    EXPECT_EQ(PayrollService::computeAllowance(teacher, 10000000), 800000);
+}
+
+TEST_F(PayrollServiceTest, RerunWritesOnlyChangedTeachers) {
+    addTeacher("T001", "Lecturer", 0, 10000000);
+    addTeacher("T002", "Professor", 0, 20000000);
+    addTeacher("T003", "Lecturer", 0, 0);
+
+    auto first = service->runPayroll(2025, 3);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->period, "2025-03");
+    EXPECT_EQ(first->teacherCount, 3u);
+    EXPECT_EQ(first->created, 2u);
+    EXPECT_EQ(first->skipped, 1u);
+    EXPECT_EQ(first->totalGross, 10500000 + 25000000);
+    EXPECT_EQ(reportService->invalidations, 1);
+
+    // Chạy lại không có thay đổi thì không ghi và giữ nguyên báo cáo đã lưu đệm
+    ASSERT_TRUE(service->runPayroll(2025, 3).has_value());
+    EXPECT_EQ(reportService->invalidations, 1);
+
+    ASSERT_TRUE(salaryDao->update(SalaryRecord("T001", 12000000)).has_value());
+    auto rerun = service->runPayroll(2025, 3);
+    ASSERT_TRUE(rerun.has_value());
+    EXPECT_EQ(rerun->created, 0u);
+    EXPECT_EQ(rerun->updated, 1u);
+    EXPECT_EQ(rerun->unchanged, 1u);
+    EXPECT_EQ(reportService->invalidations, 2);
+
+    auto history = service->getTeacherPayrollHistory("T001");
+    ASSERT_TRUE(history.has_value());
+    ASSERT_EQ(history->size(), 1u);
+    EXPECT_EQ(history->front().grossPay(), 12600000);
+}
+
+TEST_F(PayrollServiceTest, YearToDateSumsRequestedMonthsOnly) {
+    addTeacher("T001", "Lecturer", 0, 10000000);
+    for (int month : {1, 2, 3}) ASSERT_TRUE(service->runPayroll(2025, month).has_value());
+    ASSERT_TRUE(service->runPayroll(2024, 12).has_value());
+
+    auto ytd = service->getYearToDate(2025, 2);
+    ASSERT_TRUE(ytd.has_value());
+    ASSERT_EQ(ytd->size(), 1u);
+    EXPECT_EQ(ytd->front().months, 2u);
+    EXPECT_EQ(ytd->front().totalGross(), 21000000);
+
+    sessionContext->clearCurrentUser();
+    auto denied = service->runPayroll(2025, 4);
+    ASSERT_FALSE(denied.has_value());
+    EXPECT_EQ(denied.error().code, ErrorCode::PERMISSION_DENIED);
+}
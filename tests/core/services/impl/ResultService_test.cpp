@@ -0,0 +1,191 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/ResultService.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include "../../../../src/core/entities/Student.h"
+#include "../../../../src/core/entities/Course.h"
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+namespace {
+    // Đếm số lần đọc danh sách đăng ký để kiểm tra việc nhập file không đọc lại ở mỗi lô
+    class CountingEnrollmentDao : public MockEnrollmentDao {
+    public:
+        mutable int rosterReads = 0;
+        std::expected<std::vector<std::string>, Error> findStudentIdsByCourseId(const std::string& courseId) const override {
+            ++rosterReads;
+            return MockEnrollmentDao::findStudentIdsByCourseId(courseId);
+        }
+    };
+}
+
+class ResultServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockCourseResultDao> resultDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<ResultService> service;
+
+    void clearAll() {
+        MockCourseResultDao::clearMockData();
+        MockFacultyDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockCourseDao::clearMockData();
+        MockEnrollmentDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        resultDao = std::make_shared<MockCourseResultDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        service = std::make_shared<ResultService>(resultDao, std::make_shared<MockFacultyDao>(), std::make_shared<MockStudentDao>(),
+                                                  std::make_shared<MockCourseDao>(), std::make_shared<MockEnrollmentDao>(),
+                                                  std::make_shared<GeneralInputValidator>(), sessionContext);
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    int marksOf(const std::string& studentId) {
+        return resultDao->find(studentId, "CS101").value().getMarks();
+    }
+};
+
+TEST_F(ResultServiceTest, CurvesCourseMarksAndUndoes) {
+    ASSERT_TRUE(resultDao->addOrUpdateBatch({CourseResult("S001", "CS101", 30), CourseResult("S002", "CS101", 50),
+                                             CourseResult("S003", "CS101", 70), CourseResult("S004", "CS101", -1)}).has_value());
+
+    GradeCurvePolicy linear{GradeCurveMethod::LINEAR, 1.0, 12.0};
+    auto preview = service->previewCourseCurve("CS101", linear);
+    ASSERT_TRUE(preview.has_value());
+    EXPECT_FALSE(preview->applied);
+    EXPECT_EQ(preview->changedCount, 3u);
+    EXPECT_EQ(preview->passFailBefore.failed, 1u);
+    EXPECT_EQ(preview->passFailAfter.failed, 0u);
+    EXPECT_EQ(preview->after.countFor('-'), 1u);
+    EXPECT_EQ(marksOf("S001"), 30);
+
+    ASSERT_TRUE(service->curveCourseMarks("CS101", linear).value().applied);
+    EXPECT_EQ(marksOf("S001"), 42);
+    EXPECT_EQ(marksOf("S004"), -1);
+
+    // Điểm sửa tay sau khi điều chỉnh không bị undo ghi đè
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S003", "CS101", 90)).has_value());
+    ASSERT_EQ(service->undoCourseCurve("CS101").value(), 2u);
+    EXPECT_EQ(marksOf("S001"), 30);
+    EXPECT_EQ(marksOf("S002"), 50);
+    EXPECT_EQ(marksOf("S003"), 90);
+    EXPECT_EQ(service->undoCourseCurve("CS101").error().code, ErrorCode::NOT_FOUND);
+
+    // Z-score: 30, 50, 90 có trung bình 56.67, đưa về trung bình 70
+    GradeCurvePolicy zScore{GradeCurveMethod::Z_SCORE};
+    zScore.targetMean = 70.0;
+    zScore.targetStdDev = 10.0;
+    ASSERT_TRUE(service->curveCourseMarks("CS101", zScore).has_value());
+    EXPECT_NEAR(marksOf("S001") + marksOf("S002") + marksOf("S003"), 210, 2);
+
+    GradeCurvePolicy invalid{GradeCurveMethod::LINEAR, 20.0};
+    EXPECT_EQ(service->previewCourseCurve("CS101", invalid).error().code, ErrorCode::VALIDATION_ERROR);
+    sessionContext->setCurrentUser(std::make_shared<Student>("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_EQ(service->curveCourseMarks("CS101", linear).error().code, ErrorCode::PERMISSION_DENIED);
+}
+
+TEST_F(ResultServiceTest, ZScoreCurveRejectsOffsetsOutsideTheKernelRange) {
+    // 46 và 50: trung bình 48, độ lệch 2; hệ số 15 cho offset 70 - 15 * 48 = -650, vẫn biểu diễn được
+    ASSERT_TRUE(resultDao->addOrUpdateBatch({CourseResult("S001", "CS101", 46), CourseResult("S002", "CS101", 50)}).has_value());
+    GradeCurvePolicy zScore{GradeCurveMethod::Z_SCORE};
+    zScore.targetMean = 70.0;
+    zScore.targetStdDev = 30.0;
+    ASSERT_TRUE(service->curveCourseMarks("CS101", zScore).has_value());
+    EXPECT_EQ(marksOf("S001"), 40);
+    EXPECT_EQ(marksOf("S002"), 100);
+
+    // 96 và 100: cùng hệ số nhưng offset 70 - 15 * 98 = -1400 vượt MarksAffine::MAX_OFFSET
+    ASSERT_TRUE(resultDao->addOrUpdateBatch({CourseResult("S001", "CS102", 96), CourseResult("S002", "CS102", 100)}).has_value());
+    EXPECT_EQ(service->previewCourseCurve("CS102", zScore).error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(resultDao->find("S001", "CS102").value().getMarks(), 96);
+}
+
+TEST_F(ResultServiceTest, CreatesGpaSimulatorFromGradedAndInProgressCourses) {
+    auto courseDao = std::make_shared<MockCourseDao>();
+    auto enrollmentDao = std::make_shared<MockEnrollmentDao>();
+    ASSERT_TRUE(courseDao->add(Course("CS101", "Intro", 3, "IT")).has_value());
+    ASSERT_TRUE(courseDao->add(Course("CS102", "Data", 3, "IT")).has_value());
+    ASSERT_TRUE(courseDao->add(Course("CS103", "Systems", 2, "IT")).has_value());
+    for (const char* courseId : {"CS101", "CS102", "CS103"}) {
+        ASSERT_TRUE(enrollmentDao->addEnrollment("S001", courseId).has_value());
+    }
+    ASSERT_TRUE(resultDao->addOrUpdateBatch({CourseResult("S001", "CS101", 90), CourseResult("S001", "CS102", -1)}).has_value());
+
+    auto simulator = service->createGpaSimulator("S001");
+    ASSERT_TRUE(simulator.has_value());
+    EXPECT_DOUBLE_EQ(simulator->currentCgpa(), 4.0);
+    ASSERT_EQ(simulator->getPendingCourses().size(), 2u); // CS102 (-1) và CS103 (chưa có kết quả)
+    EXPECT_DOUBLE_EQ(simulator->simulate({{"CS102", 60}, {"CS103", 75}}).value(), (12.0 + 6.0 + 6.0) / 8.0);
+    EXPECT_EQ(simulator->simulate({{"CS101", 60}}).error().code, ErrorCode::VALIDATION_ERROR);
+
+    sessionContext->setCurrentUser(std::make_shared<Student>("S002", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_EQ(service->createGpaSimulator("S001").error().code, ErrorCode::PERMISSION_DENIED);
+}
+
+TEST_F(ResultServiceTest, EntersMultipleMarksAllOrNothing) {
+    auto courseDao = std::make_shared<MockCourseDao>();
+    auto enrollmentDao = std::make_shared<MockEnrollmentDao>();
+    ASSERT_TRUE(std::make_shared<MockStudentDao>()->add(Student("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE)).has_value());
+    ASSERT_TRUE(courseDao->add(Course("CS101", "Intro", 3, "IT")).has_value());
+    ASSERT_TRUE(courseDao->add(Course("CS102", "Data", 3, "IT")).has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS101").has_value());
+
+    // CS102 chưa đăng ký nên cả lô bị từ chối, kể cả điểm hợp lệ của CS101
+    EXPECT_EQ(service->enterMultipleMarks("S001", {{"CS101", 80}, {"CS102", 70}}).error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(resultDao->find("S001", "CS101").error().code, ErrorCode::NOT_FOUND);
+
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S001", "CS102").has_value());
+    ASSERT_TRUE(service->enterMultipleMarks("S001", {{"CS101", 80}, {"CS102", 70}}).has_value());
+    EXPECT_EQ(marksOf("S001"), 80);
+    EXPECT_EQ(resultDao->find("S001", "CS102")->getMarks(), 70);
+}
+
+TEST_F(ResultServiceTest, ImportsMarkSheetCsvCheckingCourseOnce) {
+    auto enrollmentDao = std::make_shared<CountingEnrollmentDao>();
+    service = std::make_shared<ResultService>(resultDao, std::make_shared<MockFacultyDao>(), std::make_shared<MockStudentDao>(),
+                                              std::make_shared<MockCourseDao>(), enrollmentDao,
+                                              std::make_shared<GeneralInputValidator>(), sessionContext);
+    ASSERT_TRUE(std::make_shared<MockCourseDao>()->add(Course("CS101", "Intro", 3, "IT")).has_value());
+
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / "result_service_mark_sheet_test.csv";
+    {
+        std::ofstream out(file);
+        out << "studentId,marks\n";
+        for (int i = 0; i < 1200; ++i) {
+            const std::string studentId = "S" + std::to_string(10000 + i);
+            ASSERT_TRUE(enrollmentDao->addEnrollment(studentId, "CS101").has_value());
+            out << studentId << "," << (i % 101) << "\n";
+        }
+        out << "S99999,50\n"  // Chưa đăng ký
+            << "S10000,70\n"  // Trùng dòng 2
+            << "S10001,abc\n";
+    }
+
+    auto report = service->importCourseMarkSheetCsv("CS101", file.string());
+    std::filesystem::remove(file);
+    ASSERT_TRUE(report.has_value()) << report.error().message;
+    EXPECT_EQ(report->totalRows, 1203u);
+    EXPECT_EQ(report->savedCount, 1200u);
+    EXPECT_EQ(report->batchCount, 3u);
+    ASSERT_EQ(report->lineErrors.size(), 3u);
+    EXPECT_EQ(report->lineErrors[0].studentId, "S99999");
+    EXPECT_EQ(enrollmentDao->rosterReads, 1);
+    EXPECT_EQ(resultDao->find("S10005", "CS101")->getMarks(), 5);
+
+    EXPECT_EQ(service->importCourseMarkSheetCsv("NOPE1", file.string()).error().code, ErrorCode::NOT_FOUND);
+    sessionContext->setCurrentUser(std::make_shared<Student>("S001", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_EQ(service->importCourseMarkSheetCsv("CS101", file.string()).error().code, ErrorCode::PERMISSION_DENIED);
+}
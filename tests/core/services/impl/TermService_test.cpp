@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/TermService.h"
+#include "../../../../src/core/data_access/mock/MockTermDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include <memory>
+
+class TermServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockEnrollmentDao> enrollmentDao;
+    std::shared_ptr<MockCourseResultDao> resultDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<TermService> service;
+
+    void clearAll() {
+        MockTermDao::clearMockData();
+        MockEnrollmentDao::clearMockData();
+        MockCourseResultDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        resultDao = std::make_shared<MockCourseResultDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        service = std::make_shared<TermService>(std::make_shared<MockTermDao>(), enrollmentDao, resultDao,
+                                                std::make_shared<GeneralInputValidator>(), sessionContext);
+        ASSERT_TRUE(service->createTerm(AcademicTerm{"2000-1", "Old term", "2000-01-01", "2000-06-30", false}).has_value());
+        ASSERT_TRUE(service->createTerm(AcademicTerm{"2001-1", "Current term", "2001-01-01", "2099-12-31", false}).has_value());
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    void enroll(const std::string& studentId, const std::string& courseId, const std::string& termId) {
+        ASSERT_TRUE(enrollmentDao->addEnrollment(studentId, courseId).has_value());
+        ASSERT_TRUE(enrollmentDao->setEnrollmentTerm(studentId, courseId, termId).has_value());
+    }
+};
+
+TEST_F(TermServiceTest, CreatesTermsAndFindsCurrentTerm) {
+    EXPECT_EQ(service->createTerm(AcademicTerm{"BAD", "Bad date", "2000-02-30", "2000-06-30", false}).error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(service->createTerm(AcademicTerm{"BAD", "Backwards", "2000-06-30", "2000-01-01", false}).error().code, ErrorCode::VALIDATION_ERROR);
+    EXPECT_EQ(service->createTerm(AcademicTerm{"2000-1", "Duplicate", "2000-01-01", "2000-06-30", false}).error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(service->getAllTerms()->size(), 2u);
+
+    auto current = service->getCurrentTerm();
+    ASSERT_TRUE(current.has_value());
+    EXPECT_EQ(current->id, "2001-1");
+
+    EXPECT_TRUE(service->closeTerm("2001-1").value());
+    EXPECT_FALSE(service->closeTerm("2001-1").value());
+    EXPECT_EQ(service->getCurrentTerm()->id, "2000-1");
+
+    sessionContext->clearCurrentUser();
+    EXPECT_EQ(service->closeTerm("2000-1").error().code, ErrorCode::AUTHENTICATION_FAILED);
+}
+
+TEST_F(TermServiceTest, MovesEnrollmentAndResultBetweenOpenTerms) {
+    enroll("S001", "CS101", "2001-1");
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS101", 80)).has_value());
+    EXPECT_EQ(resultDao->find("S001", "CS101")->getTermId(), "2001-1");
+
+    ASSERT_TRUE(service->assignEnrollmentTerm("S001", "CS101", "2000-1").has_value());
+    EXPECT_EQ(enrollmentDao->findStudentIdsByTermAndCourse("2000-1", "CS101")->size(), 1u);
+    EXPECT_EQ(resultDao->find("S001", "CS101")->getTermId(), "2000-1");
+
+    EXPECT_EQ(service->assignEnrollmentTerm("S002", "CS101", "2000-1").error().code, ErrorCode::NOT_FOUND);
+    EXPECT_EQ(service->assignEnrollmentTerm("S001", "CS101", "NOPE").error().code, ErrorCode::NOT_FOUND);
+
+    ASSERT_TRUE(service->closeTerm("2000-1").value());
+    EXPECT_EQ(service->assignEnrollmentTerm("S001", "CS101", "2001-1").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+    enroll("S002", "CS101", "2001-1");
+    EXPECT_EQ(service->assignEnrollmentTerm("S002", "CS101", "2000-1").error().code, ErrorCode::COURSE_ENROLLMENT_CLOSED);
+}
+
+TEST_F(TermServiceTest, SummarizesTermAndCachesClosedTerm) {
+    enroll("S001", "CS101", "2000-1");
+    enroll("S002", "CS101", "2000-1");
+    enroll("S003", "CS101", "2000-1");
+    enroll("S001", "CS201", "2001-1");
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS101", 90)).has_value());
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S002", "CS101", 30)).has_value());
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S001", "CS201", 70)).has_value());
+
+    auto open = service->getTermSummary("2000-1");
+    ASSERT_TRUE(open.has_value());
+    EXPECT_FALSE(open->closed);
+    EXPECT_EQ(open->enrollmentCount, 3u);
+    EXPECT_EQ(open->passFail.passed, 1u);
+    EXPECT_EQ(open->passFail.failed, 1u);
+    EXPECT_EQ(service->getTermSummary("NOPE").error().code, ErrorCode::NOT_FOUND);
+
+    // Học kỳ đang mở luôn được tính lại
+    ASSERT_TRUE(resultDao->addOrUpdate(CourseResult("S003", "CS101", 80)).has_value());
+    EXPECT_EQ(service->getTermSummary("2000-1")->passFail.passed, 2u);
+
+    ASSERT_TRUE(service->closeTerm("2000-1").value());
+    auto closed = service->getTermSummary("2000-1");
+    ASSERT_TRUE(closed.has_value());
+    EXPECT_TRUE(closed->closed);
+    EXPECT_EQ(closed->passFail.passed, 2u);
+
+    // Mock DAO không khóa học kỳ đã đóng; thống kê đã lưu đệm không đọc lại dữ liệu
+    ASSERT_TRUE(resultDao->remove("S003", "CS101").has_value());
+    EXPECT_EQ(service->getTermSummary("2000-1")->passFail.passed, 2u);
+    EXPECT_EQ(service->getTermSummary("2001-1")->passFail.passed, 1u);
+}
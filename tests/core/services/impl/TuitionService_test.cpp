@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/TuitionService.h"
+#include "../../../../src/core/services/impl/FinanceReportService.h"
+#include "../../../../src/core/data_access/StreamingTuitionDao.h"
+#include "../../../../src/core/data_access/StreamingFinanceReportDao.h"
+#include "../../../../src/core/data_access/mock/MockTuitionRateDao.h"
+#include "../../../../src/core/data_access/mock/MockFeeRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockSalaryRecordDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockTeacherDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/data_access/mock/MockTermDao.h"
+#include "../../../../src/core/data_access/mock/MockInstallmentDao.h"
+#include "../../../../src/core/data_access/NullTransactionManager.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include <memory>
+
+class TuitionServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockFeeRecordDao> feeDao;
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<MockEnrollmentDao> enrollmentDao;
+    std::shared_ptr<MockCourseDao> courseDao;
+    std::shared_ptr<MockFacultyDao> facultyDao;
+    std::shared_ptr<MockTermDao> termDao;
+    std::shared_ptr<MockInstallmentDao> installmentDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<TuitionService> service;
+
+    void clearAll() {
+        MockTuitionRateDao::clearMockData();
+        MockFeeRecordDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockEnrollmentDao::clearMockData();
+        MockCourseDao::clearMockData();
+        MockFacultyDao::clearMockData();
+        MockTermDao::clearMockData();
+        MockInstallmentDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        feeDao = std::make_shared<MockFeeRecordDao>();
+        studentDao = std::make_shared<MockStudentDao>();
+        enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        courseDao = std::make_shared<MockCourseDao>();
+        facultyDao = std::make_shared<MockFacultyDao>();
+        termDao = std::make_shared<MockTermDao>();
+        installmentDao = std::make_shared<MockInstallmentDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        auto rateDao = std::make_shared<MockTuitionRateDao>();
+        auto tuitionDao = std::make_shared<StreamingTuitionDao>(rateDao, studentDao, enrollmentDao, courseDao, feeDao);
+        auto reportService = std::make_shared<FinanceReportService>(
+            std::make_shared<StreamingFinanceReportDao>(feeDao, std::make_shared<MockSalaryRecordDao>(), studentDao,
+                                                        std::make_shared<MockTeacherDao>()),
+            sessionContext);
+        service = std::make_shared<TuitionService>(tuitionDao, rateDao, feeDao, facultyDao, sessionContext, reportService, termDao,
+                                                   installmentDao, std::make_shared<NullTransactionManager>());
+
+        ASSERT_TRUE(facultyDao->add(Faculty("IT", "Information Technology")).has_value());
+        ASSERT_TRUE(courseDao->add(Course("C1", "Programming", 3, "IT")).has_value());
+        ASSERT_TRUE(courseDao->add(Course("C2", "Databases", 4, "IT")).has_value());
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    void addStudent(const std::string& id, const std::string& facultyId, const std::string& suffix) {
+        Student student(id, "Van", "Nguyen", facultyId, LoginStatus::ACTIVE);
+        student.setBirthday(1, 1, 2005);
+        student.setEmail("student" + suffix + "@example.com");
+        student.setCitizenId("0791000000" + suffix);
+        student.setPhoneNumber("09000000" + suffix);
+        ASSERT_TRUE(studentDao->add(student).has_value());
+    }
+};
+
+TEST_F(TuitionServiceTest, RecomputeWritesCreditBasedTotals) {
+    addStudent("S1", "IT", "01");
+    addStudent("S2", "IT", "02");
+    addStudent("S3", "CS", "03");
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S1", "C1").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S1", "C2").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S2", "C1").has_value());
+    ASSERT_TRUE(feeDao->add(FeeRecord("S2", 9000000, 200000)).has_value());
+    ASSERT_TRUE(service->setTuitionRate("IT", 500000).has_value());
+
+    auto report = service->recomputeTuition();
+    ASSERT_TRUE(report.has_value());
+    EXPECT_EQ(report->studentCount, 3u);
+    EXPECT_EQ(report->unratedCount, 1u);
+    EXPECT_EQ(report->createdCount, 1u);
+    EXPECT_EQ(report->updatedCount, 1u);
+    EXPECT_TRUE(report->blocked.empty());
+    EXPECT_EQ(feeDao->getById("S1")->getTotalFee(), 3500000);
+    EXPECT_EQ(feeDao->getById("S2")->getTotalFee(), 1500000);
+    EXPECT_EQ(feeDao->getById("S2")->getPaidFee(), 200000);
+
+    auto rerun = service->recomputeTuition();
+    ASSERT_TRUE(rerun.has_value());
+    EXPECT_TRUE(rerun->applied.empty());
+    EXPECT_EQ(rerun->unchangedCount, 2u);
+}
+
+TEST_F(TuitionServiceTest, TotalsBelowPaidAreBlocked) {
+    addStudent("S1", "IT", "01");
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S1", "C1").has_value());
+    ASSERT_TRUE(feeDao->add(FeeRecord("S1", 5000000, 2000000)).has_value());
+    ASSERT_TRUE(service->setTuitionRate("IT", 500000).has_value());
+
+    auto report = service->recomputeTuition();
+    ASSERT_TRUE(report.has_value());
+    ASSERT_EQ(report->blocked.size(), 1u);
+    EXPECT_EQ(report->blocked.front().newTotalFee, 1500000);
+    EXPECT_EQ(feeDao->getById("S1")->getTotalFee(), 5000000);
+}
+
+TEST_F(TuitionServiceTest, RecomputeRescalesInstallmentPlans) {
+    addStudent("S1", "IT", "01");
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S1", "C1").has_value());
+    ASSERT_TRUE(feeDao->add(FeeRecord("S1", 1000000, 300000)).has_value());
+    ASSERT_TRUE(installmentDao->replaceSchedule("S1", {FeeInstallment{"S1", 1, "2025-01-15", 500000, 300000, false},
+                                                       FeeInstallment{"S1", 2, "2025-02-15", 500000, 0, false}}).has_value());
+    ASSERT_TRUE(service->setTuitionRate("IT", 500000).has_value());
+
+    ASSERT_TRUE(service->recomputeTuition().has_value());
+    auto schedule = installmentDao->getByStudent("S1");
+    ASSERT_TRUE(schedule.has_value());
+    ASSERT_EQ(schedule->size(), 2u);
+    EXPECT_EQ(schedule->at(0).amount, 750000);
+    EXPECT_EQ(schedule->at(1).amount, 750000);
+    EXPECT_EQ(schedule->at(0).paidAmount, 300000);
+}
+
+TEST_F(TuitionServiceTest, OnlyCurrentTermEnrollmentsCount) {
+    addStudent("S1", "IT", "01");
+    addStudent("S2", "IT", "02");
+    ASSERT_TRUE(termDao->add(AcademicTerm{"2000-1", "Old term", "2000-01-01", "2000-06-30", false}).has_value());
+    ASSERT_TRUE(termDao->add(AcademicTerm{"2001-1", "Current term", "2001-01-01", "2099-12-31", false}).has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S1", "C1").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S1", "C2").has_value());
+    ASSERT_TRUE(enrollmentDao->addEnrollment("S2", "C1").has_value());
+    ASSERT_TRUE(enrollmentDao->setEnrollmentTerm("S1", "C1", "2000-1").has_value());
+    ASSERT_TRUE(enrollmentDao->setEnrollmentTerm("S1", "C2", "2001-1").has_value());
+    ASSERT_TRUE(service->setTuitionRate("IT", 500000).has_value());
+
+    // C1 của S1 thuộc học kỳ trước; đăng ký chưa gán học kỳ của S2 vẫn được tính
+    ASSERT_TRUE(service->recomputeTuition().has_value());
+    EXPECT_EQ(feeDao->getById("S1")->getTotalFee(), 2000000);
+    EXPECT_EQ(feeDao->getById("S2")->getTotalFee(), 1500000);
+
+    // Đã có học kỳ nhưng không học kỳ nào đang diễn ra: không đoán học kỳ
+    ASSERT_TRUE(termDao->close("2001-1").has_value());
+    ASSERT_TRUE(termDao->close("2000-1").has_value());
+    EXPECT_EQ(service->recomputeTuition().error().code, ErrorCode::VALIDATION_ERROR);
+}
+
+TEST_F(TuitionServiceTest, RateRequiresExistingFacultyAndAdmin) {
+    auto missing = service->setTuitionRate("XX", 100);
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error().code, ErrorCode::NOT_FOUND);
+
+    sessionContext->clearCurrentUser();
+    auto denied = service->recomputeTuition();
+    ASSERT_FALSE(denied.has_value());
+    EXPECT_EQ(denied.error().code, ErrorCode::PERMISSION_DENIED);
+}
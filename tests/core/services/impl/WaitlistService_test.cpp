@@ -0,0 +1,210 @@
+#include "gtest/gtest.h"
+#include "../../../../src/core/services/impl/WaitlistService.h"
+#include "../../../../src/core/data_access/mock/MockWaitlistDao.h"
+#include "../../../../src/core/data_access/mock/MockEnrollmentDao.h"
+#include "../../../../src/core/data_access/mock/MockStudentDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseDao.h"
+#include "../../../../src/core/data_access/mock/MockCourseResultDao.h"
+#include "../../../../src/core/data_access/mock/MockPrerequisiteDao.h"
+#include "../../../../src/core/services/impl/PrerequisiteService.h"
+#include "../../../../src/core/services/impl/CourseService.h"
+#include "../../../../src/core/data_access/mock/MockFacultyDao.h"
+#include "../../../../src/core/data_access/NullTransactionManager.h"
+#include "../../../../src/core/validators/impl/GeneralInputValidator.h"
+#include "../../../../src/core/entities/AdminUser.h"
+#include <memory>
+
+class WaitlistServiceTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockEnrollmentDao> enrollmentDao;
+    std::shared_ptr<MockStudentDao> studentDao;
+    std::shared_ptr<MockCourseDao> courseDao;
+    std::shared_ptr<MockCourseResultDao> courseResultDao;
+    std::shared_ptr<SessionContext> sessionContext;
+    std::shared_ptr<PrerequisiteService> prerequisiteService;
+    std::shared_ptr<WaitlistService> service;
+
+    void clearAll() {
+        MockWaitlistDao::clearMockData();
+        MockEnrollmentDao::clearMockData();
+        MockStudentDao::clearMockData();
+        MockCourseDao::clearMockData();
+        MockCourseResultDao::clearMockData();
+        MockPrerequisiteDao::clearMockData();
+    }
+
+    void SetUp() override {
+        clearAll();
+        enrollmentDao = std::make_shared<MockEnrollmentDao>();
+        studentDao = std::make_shared<MockStudentDao>();
+        courseDao = std::make_shared<MockCourseDao>();
+        sessionContext = std::make_shared<SessionContext>();
+        courseResultDao = std::make_shared<MockCourseResultDao>();
+        sessionContext->setCurrentUser(std::make_shared<AdminUser>("admin", "Admin", "User"));
+        auto validator = std::make_shared<GeneralInputValidator>();
+        prerequisiteService = std::make_shared<PrerequisiteService>(std::make_shared<MockPrerequisiteDao>(), courseDao, courseResultDao,
+                                                                    validator, sessionContext);
+        service = std::make_shared<WaitlistService>(std::make_shared<MockWaitlistDao>(), enrollmentDao, studentDao, courseDao,
+                                                    validator, sessionContext, std::make_shared<NullTransactionManager>(),
+                                                    std::make_shared<EnrollmentPolicy>(enrollmentDao, studentDao, courseDao,
+                                                                                       std::make_shared<TimetableIndex>(),
+                                                                                       prerequisiteService));
+        ASSERT_TRUE(courseDao->add(Course("CS101", "Programming", 3, "IT", 1)).has_value());
+        addStudent("S000", "00", "IT");
+        ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S000", "CS101").has_value());
+    }
+
+    void TearDown() override {
+        clearAll();
+    }
+
+    void addStudent(const std::string& id, const std::string& suffix, const std::string& facultyId) {
+        Student student(id, "Van", "Nguyen", facultyId, LoginStatus::ACTIVE);
+        student.setBirthday(1, 1, 2005);
+        student.setEmail("student" + suffix + "@example.com");
+        student.setCitizenId("0791000000" + suffix);
+        student.setPhoneNumber("09000000" + suffix);
+        ASSERT_TRUE(studentDao->add(student).has_value());
+    }
+};
+
+TEST_F(WaitlistServiceTest, SameFacultyStudentsQueueFirst) {
+    addStudent("S001", "01", "CS");
+    addStudent("S002", "02", "IT");
+    addStudent("S003", "03", "CS");
+    ASSERT_EQ(service->joinWaitlist("S001", "CS101").value(), 1u);
+    ASSERT_EQ(service->joinWaitlist("S002", "CS101").value(), 1u);
+    ASSERT_EQ(service->joinWaitlist("S003", "CS101").value(), 3u);
+    EXPECT_EQ(service->getWaitlistPosition("S001", "CS101").value(), 2u);
+
+    EXPECT_EQ(service->joinWaitlist("S001", "CS101").error().code, ErrorCode::ALREADY_EXISTS);
+    EXPECT_EQ(service->joinWaitlist("S000", "CS101").error().code, ErrorCode::STUDENT_ALREADY_ENROLLED);
+
+    ASSERT_TRUE(service->leaveWaitlist("S002", "CS101").has_value());
+    EXPECT_EQ(service->getWaitlistPosition("S001", "CS101").value(), 1u);
+}
+
+TEST_F(WaitlistServiceTest, RejectsJoinWhileSeatsAreOpen) {
+    addStudent("S001", "01", "IT");
+    ASSERT_TRUE(enrollmentDao->removeEnrollment("S000", "CS101").has_value());
+    EXPECT_EQ(service->joinWaitlist("S001", "CS101").error().code, ErrorCode::VALIDATION_ERROR);
+
+    sessionContext->setCurrentUser(std::make_shared<Student>("S002", "Van", "Nguyen", "IT", LoginStatus::ACTIVE));
+    EXPECT_EQ(service->joinWaitlist("S001", "CS101").error().code, ErrorCode::PERMISSION_DENIED);
+}
+
+TEST_F(WaitlistServiceTest, PromotionFillsEveryFreedSeatOnce) {
+    addStudent("S001", "01", "IT");
+    addStudent("S002", "02", "IT");
+    addStudent("S003", "03", "IT");
+    ASSERT_TRUE(service->joinWaitlist("S001", "CS101").has_value());
+    ASSERT_TRUE(service->joinWaitlist("S002", "CS101").has_value());
+    ASSERT_TRUE(service->joinWaitlist("S003", "CS101").has_value());
+
+    // Thêm hai chỗ; S001 tự đăng ký một chỗ nên vé của S001 đã cũ và chỉ còn một chỗ cho S002
+    Course course = courseDao->getById("CS101").value();
+    ASSERT_TRUE(course.setCapacity(3));
+    ASSERT_TRUE(courseDao->update(course).has_value());
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S001", "CS101").has_value());
+
+    auto promoted = service->promoteWaitlisted({"CS101", "CS101"});
+    ASSERT_TRUE(promoted.has_value());
+    ASSERT_EQ(promoted->size(), 1u);
+    EXPECT_EQ(promoted->front().studentId, "S002");
+    EXPECT_TRUE(enrollmentDao->isEnrolled("S002", "CS101").value());
+
+    auto remaining = service->getWaitlist("CS101");
+    ASSERT_TRUE(remaining.has_value());
+    ASSERT_EQ(remaining->size(), 1u);
+    EXPECT_EQ(remaining->front().studentId, "S003");
+    EXPECT_TRUE(service->promoteWaitlisted({"CS101"})->empty());
+}
+
+TEST_F(WaitlistServiceTest, PromotionDropsStudentsWhoNoLongerQualify) {
+    addStudent("S001", "01", "IT");
+    addStudent("S002", "02", "IT");
+    ASSERT_TRUE(service->joinWaitlist("S001", "CS101").has_value());
+    ASSERT_TRUE(service->joinWaitlist("S002", "CS101").has_value());
+    ASSERT_TRUE(studentDao->updateStatus("S001", LoginStatus::DISABLED).has_value());
+
+    ASSERT_TRUE(enrollmentDao->removeEnrollment("S000", "CS101").has_value());
+    auto promoted = service->promoteWaitlisted({"CS101"});
+    ASSERT_TRUE(promoted.has_value());
+    ASSERT_EQ(promoted->size(), 1u);
+    EXPECT_EQ(promoted->front().studentId, "S002");
+    EXPECT_FALSE(enrollmentDao->isEnrolled("S001", "CS101").value());
+    EXPECT_TRUE(service->getWaitlist("CS101")->empty());
+}
+
+TEST_F(WaitlistServiceTest, ScheduleClashBlocksJoiningAndPromotion) {
+    Course course = courseDao->getById("CS101").value();
+    ASSERT_TRUE(course.setMeetingSlots(MeetingSlot::parseSchedule("Mon 07:30-09:30 E301").value()));
+    ASSERT_TRUE(courseDao->update(course).has_value());
+    Course lab("CS102", "Programming Lab", 1, "IT", 0);
+    ASSERT_TRUE(lab.setMeetingSlots(MeetingSlot::parseSchedule("Mon 08:00-10:00 E302").value()));
+    ASSERT_TRUE(courseDao->add(lab).has_value());
+    addStudent("S001", "01", "IT");
+    addStudent("S002", "02", "IT");
+    addStudent("S003", "03", "IT");
+
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S001", "CS102").has_value());
+    EXPECT_EQ(service->joinWaitlist("S001", "CS101").error().code, ErrorCode::COURSE_SCHEDULE_CONFLICT);
+
+    // S002 đăng ký khóa học trùng lịch sau khi đã xếp hàng: bị loại khỏi danh sách chờ khi đến lượt
+    ASSERT_TRUE(service->joinWaitlist("S002", "CS101").has_value());
+    ASSERT_TRUE(service->joinWaitlist("S003", "CS101").has_value());
+    ASSERT_TRUE(enrollmentDao->enrollIfSeatAvailable("S002", "CS102").has_value());
+
+    ASSERT_TRUE(enrollmentDao->removeEnrollment("S000", "CS101").has_value());
+    auto promoted = service->promoteWaitlisted({"CS101"});
+    ASSERT_TRUE(promoted.has_value());
+    ASSERT_EQ(promoted->size(), 1u);
+    EXPECT_EQ(promoted->front().studentId, "S003");
+    EXPECT_FALSE(enrollmentDao->isEnrolled("S002", "CS101").value());
+    EXPECT_TRUE(service->getWaitlist("CS101")->empty());
+}
+
+TEST_F(WaitlistServiceTest, MissingPrerequisitesBlockJoiningAndPromotion) {
+    ASSERT_TRUE(courseDao->add(Course("CS100", "Introduction", 2, "IT", 0)).has_value());
+    addStudent("S001", "01", "IT");
+    addStudent("S002", "02", "IT");
+    addStudent("S003", "03", "IT");
+    ASSERT_TRUE(service->joinWaitlist("S002", "CS101").has_value());
+    ASSERT_TRUE(service->joinWaitlist("S003", "CS101").has_value());
+
+    // Môn tiên quyết được thêm khi S002, S003 đã xếp hàng; chỉ S003 đã qua CS100
+    ASSERT_TRUE(prerequisiteService->addPrerequisite("CS101", "CS100").has_value());
+    ASSERT_TRUE(courseResultDao->addOrUpdate(CourseResult("S003", "CS100", 80)).has_value());
+    EXPECT_EQ(service->joinWaitlist("S001", "CS101").error().code, ErrorCode::COURSE_PREREQUISITE_NOT_MET);
+
+    ASSERT_TRUE(enrollmentDao->removeEnrollment("S000", "CS101").has_value());
+    auto promoted = service->promoteWaitlisted({"CS101"});
+    ASSERT_TRUE(promoted.has_value());
+    ASSERT_EQ(promoted->size(), 1u);
+    EXPECT_EQ(promoted->front().studentId, "S003");
+    EXPECT_FALSE(enrollmentDao->isEnrolled("S002", "CS101").value());
+    EXPECT_TRUE(service->getWaitlist("CS101")->empty());
+}
+
+TEST_F(WaitlistServiceTest, RaisingCapacityPromotesWaitlistedStudents) {
+    addStudent("S001", "01", "IT");
+    addStudent("S002", "02", "IT");
+    addStudent("S003", "03", "IT");
+    ASSERT_TRUE(service->joinWaitlist("S001", "CS101").has_value());
+    ASSERT_TRUE(service->joinWaitlist("S002", "CS101").has_value());
+    ASSERT_TRUE(service->joinWaitlist("S003", "CS101").has_value());
+    CourseService courseService(courseDao, std::make_shared<MockFacultyDao>(), enrollmentDao, courseResultDao,
+                                std::make_shared<GeneralInputValidator>(), sessionContext, std::make_shared<TimetableIndex>(), service);
+
+    ASSERT_TRUE(courseService.setCourseCapacity("CS101", 2).has_value());
+    EXPECT_TRUE(enrollmentDao->isEnrolled("S001", "CS101").value());
+    EXPECT_FALSE(enrollmentDao->isEnrolled("S002", "CS101").value());
+
+    // Giảm số chỗ không xếp ai; bỏ giới hạn thì xếp hết danh sách chờ
+    ASSERT_TRUE(courseService.setCourseCapacity("CS101", 1).has_value());
+    EXPECT_EQ(service->getWaitlist("CS101")->size(), 2u);
+    ASSERT_TRUE(courseService.setCourseCapacity("CS101", 0).has_value());
+    EXPECT_TRUE(enrollmentDao->isEnrolled("S002", "CS101").value());
+    EXPECT_TRUE(enrollmentDao->isEnrolled("S003", "CS101").value());
+    EXPECT_TRUE(service->getWaitlist("CS101")->empty());
+}
@@ -103,4 +103,29 @@ TEST(ConfigLoaderTest, ParseLogLevelValid) {
 
 TEST(ConfigLoaderTest, ParseLogLevelInvalid) {
     ASSERT_EQ(parseLogLevel("INVALID"), Logger::Level::INFO); // Should default to INFO
-}
\ No newline at end of file
+}
+TEST(ConfigLoaderTest, LoadCsvFilesSection) {
+    std::string configContent = R"(
+[Database]
+DataSourceType = CSV
+
+[CsvFiles]
+DataDirectory = csv_data
+Students = custom/students.csv
+CompactionThreshold = 50
+)";
+    std::filesystem::path tempConfigFile = createTempConfigFile(configContent);
+    ConfigLoader configLoader(tempConfigFile);
+    auto configResult = configLoader.loadConfig();
+    ASSERT_TRUE(configResult.has_value());
+
+    const AppConfig& config = configResult.value();
+    EXPECT_EQ(config.dataSourceType, DataSourceType::CSV);
+    EXPECT_EQ(config.csvDataDirectory, "csv_data");
+    EXPECT_EQ(config.csvCompactionThreshold, 50u);
+    ASSERT_EQ(config.csvFilePaths.count(EntityType::STUDENT), 1u);
+    EXPECT_EQ(config.csvFilePaths.at(EntityType::STUDENT), "custom/students.csv");
+    EXPECT_EQ(config.csvFilePaths.count(EntityType::TEACHER), 0u);
+
+    std::filesystem::remove(tempConfigFile);
+}
@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "../../src/utils/CsvTokenizer.h"
+#include "../../src/utils/MappedFile.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST(CsvTokenizerTest, SplitsSimpleRecords) {
+    CsvTokenizer tokenizer("a,b,c\n1,2,3\n");
+    std::vector<std::string_view> fields;
+
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    ASSERT_EQ(fields.size(), 3u);
+    EXPECT_EQ(fields[0], "a");
+    EXPECT_EQ(fields[2], "c");
+    EXPECT_EQ(tokenizer.recordLine(), 1u);
+
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(fields[1], "2");
+    EXPECT_EQ(tokenizer.recordLine(), 2u);
+
+    EXPECT_FALSE(tokenizer.nextRecord(fields));
+}
+
+TEST(CsvTokenizerTest, HandlesQuotesCrLfAndBom) {
+    std::string data = "\xEF\xBB\xBFid,note\r\n\"S1\",\"has, comma\"\r\n\"S2\",\"say \"\"hi\"\"\nnext line\"\r\nS3,";
+    CsvTokenizer tokenizer(data);
+    std::vector<std::string_view> fields;
+
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(fields[0], "id");
+
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(fields[0], "S1");
+    EXPECT_EQ(fields[1], "has, comma");
+
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(CsvTokenizer::unescapeField(fields[1]), "say \"hi\"\nnext line");
+    EXPECT_FALSE(tokenizer.isRecordMalformed());
+
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(tokenizer.recordLine(), 5u); // Trường ở bản ghi trước chứa một lần xuống dòng
+    ASSERT_EQ(fields.size(), 2u);
+    EXPECT_EQ(fields[0], "S3");
+    EXPECT_TRUE(fields[1].empty());
+}
+
+TEST(CsvTokenizerTest, FlagsUnterminatedQuote) {
+    CsvTokenizer tokenizer("S1,\"90\nS2,80\n");
+    std::vector<std::string_view> fields;
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_TRUE(tokenizer.isRecordMalformed());
+    EXPECT_FALSE(tokenizer.nextRecord(fields));
+}
+
+TEST(CsvTokenizerTest, TrimView) {
+    EXPECT_EQ(CsvTokenizer::trimView("  S001 \t"), "S001");
+    EXPECT_TRUE(CsvTokenizer::trimView("   ").empty());
+}
+
+TEST(MappedFileTest, MapsFileContentAndHandlesMissingFile) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "mapped_file_test.csv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "S001,90\nS002,75\n";
+    }
+    auto mapped = MappedFile::open(path.string());
+    ASSERT_TRUE(mapped.has_value()) << mapped.error().message;
+    EXPECT_EQ(mapped->view(), "S001,90\nS002,75\n");
+
+    MappedFile moved = std::move(mapped.value());
+    EXPECT_EQ(moved.size(), 16u);
+    std::filesystem::remove(path);
+
+    auto missing = MappedFile::open((std::filesystem::temp_directory_path() / "no_such_mapped_file.csv").string());
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error().code, ErrorCode::FILE_NOT_FOUND);
+}
+
+TEST(CsvTokenizerTest, EscapeFieldRoundTrips) {
+    EXPECT_EQ(CsvTokenizer::escapeField("plain"), "plain");
+    std::vector<std::string> values = {"a,b", "say \"hi\"", "two\nlines", " padded ", ""};
+    std::string line;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) line += ',';
+        line += CsvTokenizer::escapeField(values[i]);
+    }
+    CsvTokenizer tokenizer(line);
+    std::vector<std::string_view> fields;
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    ASSERT_EQ(fields.size(), values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(CsvTokenizer::unescapeField(fields[i]), values[i]);
+    }
+}
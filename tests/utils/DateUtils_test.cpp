@@ -0,0 +1,34 @@
+#include "gtest/gtest.h"
+#include "../../src/utils/DateUtils.h"
+#include <ctime>
+#include <string>
+
+namespace {
+    std::string utcDateOf(std::time_t time) {
+        std::tm utc = {};
+        #if defined(_WIN32) || defined(_WIN64)
+            gmtime_s(&utc, &time);
+        #else
+            gmtime_r(&time, &utc);
+        #endif
+        char buffer[16];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", &utc);
+        return buffer;
+    }
+}
+
+TEST(DateUtilsTest, TodayIsTheUtcDate) {
+    const std::string before = utcDateOf(std::time(nullptr));
+    const std::string today = DateUtils::todayIsoDate();
+    const std::string after = utcDateOf(std::time(nullptr));
+    // Chấp nhận cả hai ngày nếu lần chạy rơi đúng vào nửa đêm UTC
+    EXPECT_TRUE(today == before || today == after) << today;
+}
+
+TEST(DateUtilsTest, DaysAgoCountsBackFromToday) {
+    EXPECT_EQ(DateUtils::isoDateDaysAgo(0), DateUtils::todayIsoDate());
+    EXPECT_LT(DateUtils::isoDateDaysAgo(1), DateUtils::todayIsoDate());
+    EXPECT_GT(DateUtils::isoDateDaysAgo(-1), DateUtils::todayIsoDate());
+    EXPECT_LT(DateUtils::isoDateDaysAgo(400), DateUtils::isoDateDaysAgo(365));
+    EXPECT_EQ(DateUtils::isoDateDaysAgo(30).size(), 10u);
+}
@@ -0,0 +1,36 @@
+#include "gtest/gtest.h"
+#include "../../src/utils/JsonLineParser.h"
+#include <string>
+
+TEST(JsonLineParserTest, ParsesStringsNumbersAndNull) {
+    auto fields = JsonLineParser::parseObject(R"( {"email":"a@b.com", "birthYear": 2005, "address":null, "active":true} )");
+    ASSERT_TRUE(fields.has_value());
+    ASSERT_EQ(fields->size(), 4u);
+    EXPECT_EQ((*fields)[0].first, "email");
+    EXPECT_EQ((*fields)[0].second, "a@b.com");
+    EXPECT_EQ((*fields)[1].second, "2005");
+    EXPECT_EQ((*fields)[2].second, "");
+    EXPECT_EQ((*fields)[3].second, "true");
+}
+
+TEST(JsonLineParserTest, DecodesEscapes) {
+    auto fields = JsonLineParser::parseObject(R"({"name":"Nguyễn \"A\"\\\t","emoji":"\ud83d\ude00"})");
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_EQ((*fields)[0].second, "Nguyễn \"A\"\\\t");
+    EXPECT_EQ((*fields)[1].second, "\xF0\x9F\x98\x80");
+}
+
+TEST(JsonLineParserTest, EmptyObject) {
+    auto fields = JsonLineParser::parseObject("{}");
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_TRUE(fields->empty());
+}
+
+TEST(JsonLineParserTest, RejectsMalformedLines) {
+    for (const char* line : {"", "[1,2]", R"({"a":1)", R"({"a":"unterminated})", R"({"a":{"b":1}})",
+                             R"({"a":1} trailing)", R"({"a":bad})", R"({"a":"\ud83d"})", R"({a:1})"}) {
+        auto fields = JsonLineParser::parseObject(line);
+        ASSERT_FALSE(fields.has_value()) << line;
+        EXPECT_EQ(fields.error().code, ErrorCode::PARSING_ERROR) << line;
+    }
+}
@@ -0,0 +1,35 @@
+#include "gtest/gtest.h"
+#include "../../src/utils/ParallelUtils.h"
+#include <mutex>
+#include <utility>
+#include <vector>
+
+TEST(ParallelUtilsTest, SmallInputRunsAsOneChunk) {
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    ParallelUtils::parallelForChunks(10, 256, [&](std::size_t begin, std::size_t end) { chunks.emplace_back(begin, end); });
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_EQ(chunks[0], std::make_pair(std::size_t{0}, std::size_t{10}));
+}
+
+TEST(ParallelUtilsTest, EmptyInputStillCallsOnce) {
+    int calls = 0;
+    ParallelUtils::parallelForChunks(0, 256, [&](std::size_t begin, std::size_t end) {
+        ++calls;
+        EXPECT_EQ(begin, end);
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ParallelUtilsTest, ChunksCoverEveryIndexExactlyOnce) {
+    const std::size_t count = 10007;
+    std::vector<int> visits(count, 0);
+    std::mutex mutex;
+    std::size_t chunkCount = 0;
+    ParallelUtils::parallelForChunks(count, 16, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) ++visits[i]; // Các đoạn không giao nhau
+        std::lock_guard<std::mutex> lock(mutex);
+        ++chunkCount;
+    });
+    EXPECT_GE(chunkCount, 1u);
+    for (std::size_t i = 0; i < count; ++i) ASSERT_EQ(visits[i], 1) << "index " << i;
+}
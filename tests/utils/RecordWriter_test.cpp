@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+#include "../../src/utils/RecordWriter.h"
+#include "../../src/utils/CsvTokenizer.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    std::string readFile(const std::filesystem::path& path) {
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        return buffer.str();
+    }
+}
+
+class RecordWriterTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() / ("record_writer_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+};
+
+TEST_F(RecordWriterTest, CsvOutputRoundTripsThroughTokenizer) {
+    auto path = (dir / "out.csv").string();
+    auto writer = RecordWriter::open(path, RecordWriter::Format::CSV, {"id", "note", "count"});
+    ASSERT_TRUE(writer.has_value());
+
+    writer->writeField("S1");
+    writer->writeField("has, comma and \"quotes\"\nnewline");
+    writer->writeField(42LL);
+    ASSERT_TRUE(writer->endRecord().has_value());
+    writer->writeField("S2");
+    writer->writeNull();
+    writer->writeField(-7LL);
+    ASSERT_TRUE(writer->endRecord().has_value());
+    ASSERT_TRUE(writer->close().has_value());
+    EXPECT_EQ(writer->recordCount(), 2u);
+
+    std::string data = readFile(path);
+    CsvTokenizer tokenizer(data);
+    std::vector<std::string_view> fields;
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(fields[0], "id");
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(CsvTokenizer::unescapeField(fields[1]), "has, comma and \"quotes\"\nnewline");
+    EXPECT_EQ(fields[2], "42");
+    ASSERT_TRUE(tokenizer.nextRecord(fields));
+    EXPECT_EQ(fields[1], "");
+    EXPECT_EQ(fields[2], "-7");
+    EXPECT_FALSE(tokenizer.nextRecord(fields));
+}
+
+TEST_F(RecordWriterTest, JsonLinesEscapesStringsAndKeepsNumbers) {
+    auto path = (dir / "out.jsonl").string();
+    auto writer = RecordWriter::open(path, RecordWriter::Format::JSON_LINES, {"id", "name", "marks"});
+    ASSERT_TRUE(writer.has_value());
+
+    writer->writeField("S1");
+    writer->writeField("Nguyễn \"A\"\\\t\x01");
+    writer->writeField(85LL);
+    ASSERT_TRUE(writer->endRecord().has_value());
+    writer->writeField("S2");
+    writer->writeField("");
+    writer->writeNull();
+    ASSERT_TRUE(writer->endRecord().has_value());
+    ASSERT_TRUE(writer->close().has_value());
+
+    EXPECT_EQ(readFile(path),
+              "{\"id\":\"S1\",\"name\":\"Nguyễn \\\"A\\\"\\\\\\t\\u0001\",\"marks\":85}\n"
+              "{\"id\":\"S2\",\"name\":\"\",\"marks\":null}\n");
+}
+
+TEST_F(RecordWriterTest, FlushesOncePerFullBuffer) {
+    auto path = (dir / "big.csv").string();
+    auto writer = RecordWriter::open(path, RecordWriter::Format::CSV, {"id", "value"}, 4096);
+    ASSERT_TRUE(writer.has_value());
+
+    const int rows = 10000;
+    for (int i = 0; i < rows; ++i) {
+        writer->writeField("ROW");
+        writer->writeField(static_cast<long long>(i));
+        ASSERT_TRUE(writer->endRecord().has_value());
+    }
+    ASSERT_TRUE(writer->close().has_value());
+
+    auto size = std::filesystem::file_size(path);
+    EXPECT_GT(writer->flushCount(), 1u);
+    EXPECT_LE(writer->flushCount(), size / 4096 + 1);
+
+    std::string data = readFile(path);
+    CsvTokenizer tokenizer(data);
+    std::vector<std::string_view> fields;
+    int count = -1; // Bỏ qua dòng tiêu đề
+    while (tokenizer.nextRecord(fields)) ++count;
+    EXPECT_EQ(count, rows);
+}
+
+TEST_F(RecordWriterTest, UnclosedWriterLeavesExistingTargetUntouched) {
+    auto path = dir / "keep.csv";
+    { std::ofstream(path) << "old content\n"; }
+    {
+        auto writer = RecordWriter::open(path.string(), RecordWriter::Format::CSV, {"id"});
+        ASSERT_TRUE(writer.has_value());
+        writer->writeField("new");
+        ASSERT_TRUE(writer->endRecord().has_value());
+    } // Hủy mà không close(): mô phỏng lần xuất bị gián đoạn
+
+    EXPECT_EQ(readFile(path), "old content\n");
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+}
+
+TEST_F(RecordWriterTest, RejectsRecordWithWrongFieldCount) {
+    auto writer = RecordWriter::open((dir / "bad.csv").string(), RecordWriter::Format::CSV, {"a", "b"});
+    ASSERT_TRUE(writer.has_value());
+    writer->writeField("only one");
+    auto result = writer->endRecord();
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code, ErrorCode::VALIDATION_ERROR);
+}